@@ -3051,6 +3051,86 @@ func (m *UESessionContextResponse) GetCauseInfo() *CauseIE {
 	return nil
 }
 
+// Tunnel updates coalesced by the MME, applied in order
+type UESessionSetBatch struct {
+	Sessions             []*UESessionSet `protobuf:"bytes,1,rep,name=sessions,proto3" json:"sessions,omitempty"`
+	XXX_NoUnkeyedLiteral struct{}        `json:"-"`
+	XXX_unrecognized     []byte          `json:"-"`
+	XXX_sizecache        int32           `json:"-"`
+}
+
+func (m *UESessionSetBatch) Reset()         { *m = UESessionSetBatch{} }
+func (m *UESessionSetBatch) String() string { return proto.CompactTextString(m) }
+func (*UESessionSetBatch) ProtoMessage()    {}
+func (*UESessionSetBatch) Descriptor() ([]byte, []int) {
+	return fileDescriptor_e17e923ef6f5752e, []int{43}
+}
+
+func (m *UESessionSetBatch) XXX_Unmarshal(b []byte) error {
+	return xxx_messageInfo_UESessionSetBatch.Unmarshal(m, b)
+}
+func (m *UESessionSetBatch) XXX_Marshal(b []byte, deterministic bool) ([]byte, error) {
+	return xxx_messageInfo_UESessionSetBatch.Marshal(b, m, deterministic)
+}
+func (m *UESessionSetBatch) XXX_Merge(src proto.Message) {
+	xxx_messageInfo_UESessionSetBatch.Merge(m, src)
+}
+func (m *UESessionSetBatch) XXX_Size() int {
+	return xxx_messageInfo_UESessionSetBatch.Size(m)
+}
+func (m *UESessionSetBatch) XXX_DiscardUnknown() {
+	xxx_messageInfo_UESessionSetBatch.DiscardUnknown(m)
+}
+
+var xxx_messageInfo_UESessionSetBatch proto.InternalMessageInfo
+
+func (m *UESessionSetBatch) GetSessions() []*UESessionSet {
+	if m != nil {
+		return m.Sessions
+	}
+	return nil
+}
+
+// One response per session of the batch, in the same order
+type UESessionContextResponseBatch struct {
+	Responses            []*UESessionContextResponse `protobuf:"bytes,1,rep,name=responses,proto3" json:"responses,omitempty"`
+	XXX_NoUnkeyedLiteral struct{}                    `json:"-"`
+	XXX_unrecognized     []byte                      `json:"-"`
+	XXX_sizecache        int32                       `json:"-"`
+}
+
+func (m *UESessionContextResponseBatch) Reset()         { *m = UESessionContextResponseBatch{} }
+func (m *UESessionContextResponseBatch) String() string { return proto.CompactTextString(m) }
+func (*UESessionContextResponseBatch) ProtoMessage()    {}
+func (*UESessionContextResponseBatch) Descriptor() ([]byte, []int) {
+	return fileDescriptor_e17e923ef6f5752e, []int{44}
+}
+
+func (m *UESessionContextResponseBatch) XXX_Unmarshal(b []byte) error {
+	return xxx_messageInfo_UESessionContextResponseBatch.Unmarshal(m, b)
+}
+func (m *UESessionContextResponseBatch) XXX_Marshal(b []byte, deterministic bool) ([]byte, error) {
+	return xxx_messageInfo_UESessionContextResponseBatch.Marshal(b, m, deterministic)
+}
+func (m *UESessionContextResponseBatch) XXX_Merge(src proto.Message) {
+	xxx_messageInfo_UESessionContextResponseBatch.Merge(m, src)
+}
+func (m *UESessionContextResponseBatch) XXX_Size() int {
+	return xxx_messageInfo_UESessionContextResponseBatch.Size(m)
+}
+func (m *UESessionContextResponseBatch) XXX_DiscardUnknown() {
+	xxx_messageInfo_UESessionContextResponseBatch.DiscardUnknown(m)
+}
+
+var xxx_messageInfo_UESessionContextResponseBatch proto.InternalMessageInfo
+
+func (m *UESessionContextResponseBatch) GetResponses() []*UESessionContextResponse {
+	if m != nil {
+		return m.Responses
+	}
+	return nil
+}
+
 type GetStatsRequest struct {
 	Cookie               uint32   `protobuf:"varint,1,opt,name=cookie,proto3" json:"cookie,omitempty"`
 	CookieMask           uint32   `protobuf:"varint,2,opt,name=cookie_mask,json=cookieMask,proto3" json:"cookie_mask,omitempty"`
@@ -3063,7 +3143,7 @@ func (m *GetStatsRequest) Reset()         { *m = GetStatsRequest{} }
 func (m *GetStatsRequest) String() string { return proto.CompactTextString(m) }
 func (*GetStatsRequest) ProtoMessage()    {}
 func (*GetStatsRequest) Descriptor() ([]byte, []int) {
-	return fileDescriptor_e17e923ef6f5752e, []int{43}
+	return fileDescriptor_e17e923ef6f5752e, []int{45}
 }
 
 func (m *GetStatsRequest) XXX_Unmarshal(b []byte) error {
@@ -3156,261 +3236,267 @@ func init() {
 	proto.RegisterType((*UESessionState)(nil), "magma.lte.UESessionState")
 	proto.RegisterType((*UESessionSet)(nil), "magma.lte.UESessionSet")
 	proto.RegisterType((*UESessionContextResponse)(nil), "magma.lte.UESessionContextResponse")
+	proto.RegisterType((*UESessionSetBatch)(nil), "magma.lte.UESessionSetBatch")
+	proto.RegisterType((*UESessionContextResponseBatch)(nil), "magma.lte.UESessionContextResponseBatch")
 	proto.RegisterType((*GetStatsRequest)(nil), "magma.lte.GetStatsRequest")
 }
 
 func init() { proto.RegisterFile("lte/protos/pipelined.proto", fileDescriptor_e17e923ef6f5752e) }
 
 var fileDescriptor_e17e923ef6f5752e = []byte{
-	// 3967 bytes of a gzipped FileDescriptorProto
+	// 4030 bytes of a gzipped FileDescriptorProto
 	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xb4, 0x3a, 0x4b, 0x6f, 0x1b, 0x49,
-	0x7a, 0xe2, 0x43, 0x7c, 0x7c, 0x7c, 0xa8, 0x5d, 0xb6, 0x25, 0x4a, 0x33, 0xf6, 0xc8, 0x3d, 0x3b,
-	0x19, 0xdb, 0x9b, 0x91, 0xb3, 0x5a, 0x43, 0xb3, 0x3b, 0xb3, 0xc8, 0x6e, 0x9b, 0xdd, 0x94, 0xdb,
-	0x4b, 0x91, 0x74, 0x35, 0xa9, 0xf1, 0x04, 0x41, 0x0a, 0x2d, 0x76, 0x51, 0xd3, 0x31, 0xd9, 0xdd,
-	0xae, 0x6e, 0xfa, 0x11, 0x04, 0x39, 0x04, 0x79, 0x00, 0x39, 0xe5, 0x9e, 0x43, 0x6e, 0xb9, 0x07,
-	0xc8, 0x25, 0x7f, 0x20, 0x08, 0x90, 0x00, 0xb9, 0xe4, 0xb6, 0xc9, 0x1f, 0x08, 0x10, 0x20, 0x87,
-	0x20, 0xe7, 0xa0, 0x1e, 0x4d, 0x35, 0x29, 0xda, 0xf2, 0xec, 0xcc, 0x9e, 0x58, 0xfd, 0xd5, 0x57,
-	0x5f, 0x7d, 0xf5, 0xbd, 0xbf, 0x2a, 0xc2, 0xde, 0x34, 0xa1, 0x0f, 0x22, 0x16, 0x26, 0x61, 0xfc,
-	0x20, 0xf2, 0x23, 0x3a, 0xf5, 0x03, 0xea, 0x1d, 0x08, 0x00, 0xaa, 0xce, 0xdc, 0xf3, 0x99, 0x7b,
-	0x30, 0x4d, 0xe8, 0xde, 0x6e, 0xc8, 0xc6, 0x3f, 0x61, 0x29, 0xe2, 0x38, 0x9c, 0xcd, 0xc2, 0x40,
-	0x62, 0xed, 0xdd, 0xc8, 0x50, 0x70, 0xa3, 0x14, 0xba, 0x9b, 0xa5, 0x1b, 0x4e, 0xfd, 0xf1, 0x1b,
-	0xef, 0x4c, 0x4d, 0xed, 0x67, 0xa6, 0x62, 0x1a, 0xc7, 0x7e, 0x18, 0x90, 0x99, 0x1b, 0xb8, 0xe7,
-	0x94, 0x29, 0x8c, 0x5b, 0x59, 0x8c, 0xf9, 0x59, 0x3c, 0x66, 0xfe, 0x19, 0x65, 0x0b, 0x02, 0x59,
-	0x9e, 0x67, 0xe1, 0x99, 0x3f, 0xf5, 0x93, 0x37, 0x8a, 0x67, 0xfd, 0x1f, 0x73, 0x70, 0xcd, 0xa1,
-	0xc9, 0x3c, 0xea, 0x4c, 0xc3, 0x57, 0x31, 0xa6, 0x2f, 0xe6, 0x34, 0x4e, 0xd0, 0x97, 0x50, 0x61,
-	0x72, 0x18, 0xb7, 0x72, 0xfb, 0x85, 0xbb, 0xb5, 0xc3, 0x8f, 0x0e, 0x16, 0x87, 0x3b, 0x30, 0xc6,
-	0x89, 0xff, 0xd2, 0x4d, 0x68, 0x76, 0x09, 0x5e, 0x2c, 0x40, 0x37, 0x60, 0x93, 0x46, 0xe1, 0xf8,
-	0x9b, 0x56, 0x7e, 0x3f, 0x77, 0xb7, 0x88, 0xe5, 0x07, 0x7a, 0x0a, 0x8d, 0x17, 0xf3, 0x30, 0x71,
-	0xc9, 0x3c, 0xf2, 0xdc, 0x84, 0xc6, 0xad, 0xc2, 0x7e, 0xee, 0x6e, 0xed, 0xf0, 0xb7, 0x33, 0x74,
-	0x47, 0x62, 0xc6, 0x59, 0x1c, 0xe0, 0x29, 0xc7, 0x77, 0x12, 0x37, 0xa1, 0xe9, 0x26, 0x75, 0x41,
-	0x42, 0xe2, 0xc5, 0xfa, 0x0f, 0xe1, 0xba, 0x60, 0xdd, 0xa4, 0x13, 0x77, 0x3e, 0x4d, 0x52, 0xe6,
-	0x17, 0xfb, 0xe7, 0x32, 0xfb, 0xeb, 0x67, 0xea, 0x9c, 0x23, 0xeb, 0xc4, 0x1d, 0xa7, 0xa8, 0x9f,
-	0x5f, 0x3a, 0xe7, 0x07, 0x59, 0x7e, 0x38, 0x2a, 0x3f, 0xe4, 0x7b, 0x9e, 0x51, 0x3f, 0x07, 0x24,
-	0xf6, 0x18, 0x08, 0x05, 0xfe, 0xe6, 0x84, 0xa9, 0xff, 0xb1, 0x3a, 0x8c, 0x90, 0x50, 0xba, 0xcf,
-	0x25, 0x09, 0xe7, 0xbe, 0xab, 0x84, 0xdf, 0xb2, 0xfb, 0x5f, 0xe4, 0x40, 0xcb, 0xda, 0x4c, 0x3c,
-	0x9f, 0x26, 0xe8, 0x0b, 0x28, 0x31, 0x31, 0x12, 0xdb, 0x36, 0x0f, 0xf5, 0xcc, 0xb6, 0xab, 0xc8,
-	0x07, 0xf2, 0x07, 0xab, 0x15, 0xfa, 0x11, 0x94, 0x14, 0x95, 0x1a, 0x94, 0x9d, 0x51, 0xbb, 0x6d,
-	0x39, 0x8e, 0xb6, 0xc1, 0x3f, 0x3a, 0x86, 0xdd, 0x1d, 0x61, 0x4b, 0xcb, 0x21, 0x04, 0xcd, 0xfe,
-	0x68, 0x68, 0x1a, 0x43, 0xcb, 0x24, 0xd6, 0xa0, 0xdf, 0x7e, 0xac, 0xe5, 0xf5, 0x3f, 0xcb, 0xc1,
-	0x35, 0xc5, 0x78, 0x9f, 0xf9, 0xe7, 0x7e, 0x30, 0x7c, 0x13, 0x51, 0xf4, 0x25, 0x14, 0x93, 0x37,
-	0x11, 0x55, 0x7c, 0x7c, 0x9a, 0xe1, 0xe3, 0x12, 0xee, 0xc1, 0xc5, 0x10, 0x8b, 0x45, 0xfa, 0x21,
-	0x40, 0x86, 0x54, 0x09, 0xf2, 0xc7, 0xcf, 0xb4, 0x0d, 0xf1, 0xfb, 0xb5, 0x96, 0xe3, 0xbf, 0xbd,
-	0x87, 0x5a, 0x1e, 0xd5, 0xa1, 0xf2, 0x95, 0xdd, 0x35, 0xdb, 0x06, 0x36, 0xb5, 0x82, 0x7e, 0x0a,
-	0x5b, 0xa7, 0x94, 0x71, 0xbf, 0xa4, 0x9e, 0x54, 0x3d, 0xba, 0x07, 0x45, 0x36, 0x9f, 0x52, 0xa5,
-	0x82, 0x9b, 0x19, 0x1e, 0x94, 0x6d, 0xcc, 0xa7, 0x14, 0x0b, 0x14, 0xd4, 0x82, 0xf2, 0x4b, 0xb9,
-	0x5a, 0x48, 0xb9, 0x81, 0xd3, 0x4f, 0xfd, 0xef, 0x0a, 0x70, 0x63, 0x9d, 0x79, 0xa0, 0x7b, 0x50,
-	0x88, 0x7d, 0x4f, 0x11, 0xdf, 0xc9, 0x0a, 0x7a, 0xa1, 0x59, 0xdb, 0xc4, 0x1c, 0x07, 0xed, 0x40,
-	0xd9, 0x8f, 0x88, 0xeb, 0x79, 0x4c, 0x50, 0xaf, 0xe2, 0x92, 0x1f, 0x19, 0x9e, 0xc7, 0x50, 0x1b,
-	0x9a, 0xca, 0xc8, 0x48, 0x28, 0x0e, 0xdc, 0xda, 0x14, 0xe4, 0x3e, 0x7c, 0x97, 0xbc, 0x70, 0x83,
-	0x65, 0x41, 0xe8, 0x77, 0xa1, 0xe2, 0x46, 0x01, 0x71, 0x67, 0x67, 0xac, 0x55, 0x12, 0xcb, 0x3f,
-	0xce, 0x9a, 0xf6, 0xf9, 0x39, 0xa3, 0xe7, 0x6e, 0x42, 0xbd, 0x13, 0xf7, 0xb5, 0x3f, 0x9b, 0xcf,
-	0x1e, 0xf9, 0x09, 0xe3, 0xb6, 0x56, 0x76, 0xa3, 0xc0, 0x98, 0x9d, 0x31, 0xf4, 0x01, 0x54, 0xfd,
-	0xe8, 0xe5, 0x91, 0xe4, 0xaf, 0xbc, 0x9f, 0xbb, 0x5b, 0xc7, 0x15, 0x0e, 0x10, 0x1c, 0x6e, 0x43,
-	0x69, 0x16, 0xfb, 0xb1, 0x17, 0xb4, 0x2a, 0x62, 0x46, 0x7d, 0xa1, 0x8f, 0xa1, 0x31, 0x8f, 0xa6,
-	0x7e, 0xf0, 0x9c, 0x24, 0xf3, 0x20, 0xa0, 0xd3, 0x56, 0x55, 0x88, 0xad, 0x2e, 0x81, 0x43, 0x01,
-	0x43, 0x9f, 0xc2, 0x96, 0x17, 0xbe, 0x0a, 0xb2, 0x68, 0x20, 0xd0, 0x9a, 0x29, 0x58, 0x21, 0x1e,
-	0x41, 0x45, 0xc4, 0x5b, 0x9f, 0xc6, 0xad, 0x9a, 0xf0, 0xce, 0xbd, 0xcc, 0x11, 0x56, 0xf4, 0x8a,
-	0x17, 0xb8, 0x4f, 0x8a, 0x95, 0x82, 0x56, 0x7c, 0x52, 0xac, 0x14, 0xb5, 0x4d, 0xbd, 0x03, 0xd7,
-	0x56, 0x10, 0x6d, 0x93, 0x4b, 0x9e, 0xeb, 0x97, 0x28, 0x45, 0x55, 0x71, 0x89, 0x7f, 0xda, 0xde,
-	0x3b, 0x14, 0xfe, 0x97, 0x05, 0xd8, 0x36, 0xa9, 0xfb, 0x1d, 0x55, 0x7e, 0x59, 0xb3, 0x85, 0x6f,
-	0xaf, 0xd9, 0x8c, 0xdd, 0x14, 0x97, 0xec, 0x66, 0x49, 0x65, 0x9b, 0x2b, 0x2a, 0xfb, 0x29, 0xec,
-	0x32, 0x3a, 0x0b, 0x5f, 0x52, 0xe2, 0xc9, 0x98, 0x4c, 0x3c, 0x16, 0x46, 0x64, 0xc2, 0x4f, 0x22,
-	0x0c, 0xa4, 0x82, 0xb7, 0x25, 0x82, 0x8a, 0xd9, 0x26, 0x0b, 0x65, 0x60, 0xb8, 0xac, 0xd5, 0xf2,
-	0xfb, 0x69, 0xb5, 0xb2, 0x56, 0xab, 0x3f, 0xc9, 0x68, 0xb5, 0x2a, 0xb4, 0xfa, 0xe1, 0xdb, 0xb5,
-	0x6a, 0x9b, 0x4b, 0x7a, 0xcd, 0x6b, 0x05, 0xfd, 0x1f, 0x72, 0xd0, 0xe0, 0x3e, 0x7a, 0x12, 0x7a,
-	0x2a, 0x32, 0xbd, 0x55, 0x9d, 0x9f, 0x2f, 0x02, 0x5f, 0x5e, 0x04, 0x9c, 0x6c, 0x70, 0x5f, 0x22,
-	0xb1, 0x12, 0xf5, 0xb2, 0x76, 0x50, 0x10, 0xe1, 0x75, 0x61, 0x07, 0x9f, 0xaf, 0x8f, 0x87, 0xd7,
-	0x61, 0x6b, 0x60, 0xe0, 0xa1, 0x6d, 0x74, 0x49, 0x0a, 0xcc, 0x65, 0x83, 0x64, 0x5e, 0xff, 0x7d,
-	0xb8, 0xbe, 0x12, 0x30, 0x04, 0x95, 0x9f, 0x43, 0x53, 0xd6, 0x14, 0x44, 0x6e, 0x1d, 0xb7, 0xf2,
-	0x42, 0x26, 0xad, 0xb7, 0xb1, 0x8a, 0x1b, 0x91, 0x4a, 0x61, 0x02, 0xfd, 0x49, 0xb1, 0x92, 0xd3,
-	0xf2, 0xfa, 0x5f, 0xe7, 0xe0, 0xe6, 0x25, 0xf3, 0x54, 0x1b, 0x2c, 0x07, 0xff, 0x6c, 0xd0, 0x5d,
-	0xbb, 0xe2, 0xfb, 0xca, 0x00, 0xff, 0x9d, 0x87, 0x5a, 0x26, 0x43, 0xa3, 0xfb, 0xb0, 0x39, 0x73,
-	0x13, 0x95, 0xfb, 0x6b, 0x87, 0x37, 0x32, 0x7c, 0x70, 0xb4, 0x13, 0x3e, 0x87, 0x25, 0x0a, 0xda,
-	0xe5, 0xc1, 0x2b, 0x22, 0x81, 0x3b, 0xa3, 0x2a, 0x36, 0x96, 0xdd, 0x28, 0xea, 0xb9, 0x33, 0xca,
-	0xa7, 0xce, 0xde, 0x24, 0x34, 0x26, 0xec, 0x75, 0xaa, 0x1b, 0xf1, 0x8d, 0x5f, 0xa3, 0x3b, 0x50,
-	0x8f, 0x29, 0x7b, 0xe9, 0x8f, 0x29, 0x11, 0x59, 0x46, 0x7a, 0x47, 0x4d, 0xc1, 0x44, 0xd6, 0xd8,
-	0x81, 0x72, 0xcc, 0xc6, 0x64, 0xe6, 0x8e, 0x85, 0x83, 0x54, 0x71, 0x29, 0x66, 0xe3, 0x13, 0x77,
-	0xcc, 0x27, 0xbc, 0x38, 0x11, 0x13, 0x25, 0x39, 0xe1, 0xc5, 0x09, 0x9f, 0x38, 0x82, 0xcd, 0x98,
-	0x67, 0x61, 0x61, 0xf4, 0xcd, 0xc3, 0xfd, 0x15, 0xb6, 0xd5, 0xe9, 0xc4, 0x58, 0x66, 0x6b, 0x89,
-	0xae, 0x87, 0x50, 0x5d, 0xc0, 0x90, 0x06, 0xf5, 0x4e, 0xb7, 0xff, 0x15, 0x69, 0x63, 0x8b, 0xcb,
-	0x48, 0xdb, 0x40, 0x1f, 0xc1, 0x07, 0x02, 0x92, 0x5a, 0x4d, 0xbb, 0x6b, 0x38, 0x8e, 0xdd, 0xb1,
-	0xdb, 0xc6, 0xd0, 0xee, 0xf7, 0xb4, 0x1c, 0xba, 0x05, 0xbb, 0x02, 0xa1, 0x63, 0xf7, 0x2e, 0x4f,
-	0xe7, 0x17, 0x14, 0xad, 0x67, 0x03, 0x1b, 0x5b, 0x3c, 0xd5, 0xfd, 0x09, 0xd4, 0x25, 0x43, 0x71,
-	0x14, 0x06, 0x31, 0x45, 0x47, 0x2b, 0x8a, 0xbf, 0x7d, 0x89, 0x73, 0x89, 0xf8, 0x7d, 0xe9, 0xfb,
-	0xdf, 0x72, 0xa0, 0xad, 0x96, 0x65, 0xdf, 0x26, 0x36, 0xee, 0x42, 0x65, 0xe6, 0x8e, 0xb3, 0xf9,
-	0xb0, 0x3c, 0x73, 0xc7, 0x2b, 0xe9, 0xa6, 0x20, 0x75, 0xa3, 0xd2, 0xcd, 0x6d, 0xa8, 0xb9, 0x11,
-	0x59, 0xac, 0x92, 0xfa, 0xae, 0xba, 0xd1, 0x89, 0x5a, 0xb7, 0x03, 0x65, 0x57, 0x59, 0x91, 0xd2,
-	0xb6, 0x2b, 0x8d, 0xe8, 0x07, 0xd0, 0x8c, 0xbc, 0x88, 0xc4, 0x89, 0xcb, 0x12, 0x92, 0xf8, 0x33,
-	0x2a, 0x94, 0x5e, 0xc4, 0xf5, 0xc8, 0x8b, 0x1c, 0x0e, 0x1c, 0xfa, 0x33, 0xaa, 0xff, 0x2a, 0x07,
-	0x37, 0x57, 0x0a, 0x32, 0x59, 0x7d, 0x7d, 0x4f, 0xc7, 0xea, 0x40, 0x4d, 0xd6, 0x83, 0xd2, 0x5c,
-	0x0b, 0x42, 0x4d, 0x9f, 0xac, 0xa5, 0x96, 0xd9, 0xfc, 0x40, 0xe4, 0x04, 0x90, 0x2b, 0xf9, 0x58,
-	0x7f, 0x08, 0x45, 0x61, 0xdc, 0x5b, 0x50, 0x3b, 0x35, 0xba, 0xb6, 0x49, 0x9e, 0x8e, 0xfa, 0x43,
-	0x43, 0xdb, 0xe0, 0xb5, 0x50, 0xaf, 0xaf, 0xbe, 0x72, 0xa8, 0x01, 0xd5, 0xa1, 0x85, 0x4f, 0xec,
-	0x9e, 0x31, 0xe4, 0x01, 0x89, 0xc0, 0x9d, 0x2b, 0x6b, 0x4e, 0xf4, 0x05, 0x94, 0x2f, 0x4a, 0x56,
-	0x1e, 0x97, 0xf6, 0xaf, 0x62, 0x0f, 0xa7, 0x0b, 0x74, 0x06, 0x5b, 0x43, 0xf7, 0x6c, 0x4a, 0x8d,
-	0x38, 0xf6, 0xcf, 0x83, 0x19, 0x0d, 0x92, 0x25, 0xbf, 0xce, 0x2d, 0xfb, 0xf5, 0x2d, 0x80, 0x99,
-	0xeb, 0x07, 0x24, 0xe1, 0x4b, 0x54, 0x51, 0x5b, 0xe5, 0x10, 0x41, 0x03, 0x7d, 0x02, 0xcd, 0x78,
-	0xcc, 0x78, 0x70, 0x90, 0x18, 0xbc, 0x49, 0x29, 0xdc, 0x2d, 0xe2, 0x86, 0x82, 0x0a, 0xac, 0x58,
-	0xff, 0x03, 0xb8, 0x6e, 0x4c, 0xa7, 0x2b, 0xdb, 0xc6, 0xe8, 0x18, 0xae, 0x89, 0x55, 0xc4, 0xbd,
-	0x00, 0xaa, 0x03, 0x65, 0x4b, 0x8a, 0x95, 0x75, 0x58, 0x4b, 0x56, 0x08, 0xe9, 0x5f, 0xf2, 0xbe,
-	0x86, 0xf9, 0xee, 0xd4, 0xff, 0x23, 0xea, 0xe1, 0x37, 0xf3, 0x81, 0x3b, 0x7e, 0x4e, 0x13, 0xa4,
-	0x41, 0x21, 0x7a, 0x2e, 0x1d, 0xad, 0x8e, 0xf9, 0x10, 0x21, 0x28, 0xfa, 0xb3, 0xd8, 0x57, 0x2a,
-	0x17, 0x63, 0xfd, 0x00, 0xae, 0x49, 0x7c, 0x9e, 0x5a, 0xc5, 0x5e, 0xb6, 0xb0, 0x0f, 0xc9, 0x9a,
-	0xb2, 0xa7, 0x4d, 0x5c, 0x4e, 0xe4, 0x94, 0xfe, 0xbf, 0x39, 0xa8, 0x76, 0xe2, 0x19, 0x11, 0x01,
-	0x05, 0xfd, 0x38, 0x0d, 0x44, 0xd2, 0x9d, 0x6f, 0x65, 0xdd, 0x39, 0x45, 0xe2, 0xa3, 0xa5, 0x28,
-	0xf4, 0xf7, 0x39, 0xa8, 0xa4, 0x30, 0xee, 0xb5, 0x8e, 0xe5, 0x38, 0x76, 0xbf, 0x47, 0x8c, 0xf6,
-	0xd0, 0x3e, 0xb5, 0xb4, 0x0d, 0xb4, 0x0d, 0x28, 0x85, 0x2d, 0x8c, 0xc3, 0xd4, 0x8a, 0xe8, 0x0e,
-	0xdc, 0x5a, 0x85, 0xf3, 0xb1, 0xd3, 0x7e, 0x6c, 0x99, 0xa3, 0xae, 0x65, 0x6a, 0x9b, 0xe8, 0x06,
-	0x68, 0x29, 0x0a, 0xb6, 0xba, 0x96, 0xe1, 0x58, 0xa6, 0x56, 0xe2, 0x36, 0x27, 0xa2, 0x9c, 0xdd,
-	0x3b, 0xd6, 0xca, 0x3c, 0x6a, 0xa4, 0x31, 0xaf, 0x82, 0x00, 0x4a, 0x6a, 0xdf, 0x2a, 0x47, 0xb3,
-	0x7b, 0xea, 0x0b, 0x38, 0x9a, 0x22, 0xa1, 0xd5, 0xf4, 0x3f, 0xcd, 0x01, 0x38, 0xde, 0xa4, 0xe3,
-	0x4f, 0x13, 0xca, 0x62, 0x74, 0x0f, 0xf2, 0x93, 0xd4, 0xd5, 0x76, 0x57, 0x62, 0x98, 0x49, 0xb9,
-	0x01, 0x46, 0x49, 0xc8, 0x70, 0x7e, 0xe2, 0x71, 0x35, 0x24, 0xc9, 0x58, 0xc8, 0xbc, 0x8e, 0xf9,
-	0x90, 0x43, 0xe2, 0xc8, 0x17, 0xae, 0x55, 0xc7, 0x7c, 0x88, 0x9a, 0x90, 0x9f, 0x4c, 0x45, 0xa8,
-	0xa8, 0xe3, 0xfc, 0x64, 0x8a, 0x6e, 0x42, 0x29, 0xf6, 0x26, 0x5c, 0xfa, 0x9b, 0xa2, 0x5c, 0xd9,
-	0x8c, 0xbd, 0x89, 0xed, 0xe9, 0x7f, 0x08, 0xcd, 0xe5, 0x0d, 0xd0, 0x67, 0xcb, 0xf9, 0x6b, 0x67,
-	0x5d, 0xfe, 0xea, 0xd1, 0x57, 0x69, 0x0a, 0xbb, 0x07, 0x25, 0x9e, 0x5c, 0x55, 0x25, 0xd9, 0x3c,
-	0xbc, 0xb6, 0xd2, 0x58, 0x86, 0x01, 0x56, 0x08, 0xfa, 0xdf, 0xe6, 0x64, 0xe8, 0x4e, 0x49, 0x70,
-	0x9b, 0xf0, 0xa3, 0x97, 0x0f, 0x49, 0xcc, 0xc6, 0xa9, 0x9b, 0xf0, 0x6f, 0x87, 0x8d, 0x17, 0x53,
-	0x5e, 0x9c, 0xa4, 0xe1, 0x84, 0x7f, 0x9b, 0x71, 0xc2, 0xcb, 0x34, 0x71, 0x71, 0x30, 0x0e, 0xa7,
-	0x17, 0x01, 0xa5, 0x8a, 0xeb, 0x29, 0x50, 0xc4, 0x88, 0x5d, 0xa8, 0xf0, 0x3c, 0x17, 0x85, 0x2c,
-	0x11, 0x42, 0x68, 0x60, 0x9e, 0xf7, 0x06, 0x21, 0x13, 0xce, 0xc9, 0x73, 0xa3, 0x98, 0x92, 0xb2,
-	0xe0, 0xb9, 0x92, 0x4f, 0xe9, 0xff, 0x92, 0x83, 0x3a, 0xa6, 0x9e, 0xcf, 0xe8, 0x38, 0xb1, 0x83,
-	0x49, 0x88, 0x9e, 0x40, 0x9d, 0x51, 0x8f, 0x47, 0x35, 0x92, 0x69, 0xe8, 0xee, 0x2e, 0x95, 0xb1,
-	0x17, 0xe8, 0x8b, 0x0f, 0x1e, 0xf6, 0x64, 0xf8, 0x62, 0xd4, 0x33, 0x3c, 0x4f, 0xb0, 0xf4, 0x5b,
-	0xb0, 0xc5, 0x69, 0xf1, 0x34, 0x4d, 0x59, 0x36, 0x50, 0x36, 0x18, 0xf5, 0x1c, 0x01, 0xe5, 0xeb,
-	0xf4, 0x63, 0xd0, 0x56, 0xe9, 0xa0, 0x0a, 0x14, 0xed, 0xc1, 0xe9, 0x43, 0x6d, 0x43, 0x8d, 0x8e,
-	0xb4, 0x1c, 0x2a, 0x43, 0x61, 0x84, 0xbb, 0x5a, 0x9e, 0xdb, 0x9b, 0x63, 0x0f, 0x46, 0xd8, 0xd6,
-	0x0a, 0x7c, 0xcc, 0x11, 0x4f, 0x8f, 0xb4, 0xa2, 0x7e, 0x0e, 0xd7, 0xfb, 0xf3, 0x84, 0xb2, 0xc7,
-	0xd4, 0xf5, 0x28, 0x6b, 0x33, 0xea, 0x72, 0x35, 0x70, 0x4b, 0x08, 0x49, 0x42, 0x95, 0x1f, 0x36,
-	0xf0, 0x66, 0x38, 0xa4, 0xbe, 0x87, 0xf6, 0xa1, 0x7e, 0x1e, 0x9c, 0x11, 0x21, 0x75, 0x77, 0xc1,
-	0x1b, 0x9c, 0x07, 0x67, 0x76, 0xf4, 0xf2, 0xa1, 0x21, 0xd3, 0x0c, 0x17, 0x1a, 0x09, 0x42, 0x21,
-	0xf2, 0x06, 0x2e, 0xf1, 0xcf, 0x5e, 0xa8, 0xff, 0x2b, 0xf7, 0xbe, 0x57, 0xde, 0xc0, 0x65, 0xee,
-	0x8c, 0x07, 0x38, 0x8f, 0x17, 0xfe, 0xfe, 0xc4, 0x1d, 0x53, 0xb5, 0x45, 0x95, 0x43, 0x6c, 0x0e,
-	0xe0, 0xc5, 0x4b, 0x40, 0x13, 0xe2, 0x07, 0x71, 0xe2, 0x06, 0xe3, 0xb4, 0xec, 0xa9, 0x05, 0x34,
-	0xb1, 0x15, 0x08, 0xfd, 0x0c, 0xb8, 0x44, 0x84, 0x00, 0x88, 0x1f, 0x4c, 0x42, 0xd5, 0x3c, 0xec,
-	0xbc, 0x45, 0xea, 0xb8, 0xce, 0xb2, 0x2a, 0xfb, 0x05, 0xd4, 0xc3, 0x79, 0xc2, 0xc8, 0x37, 0xd4,
-	0xf5, 0xc8, 0x58, 0x66, 0xcb, 0xda, 0x52, 0x55, 0xb0, 0x46, 0x28, 0x18, 0xf8, 0x1a, 0x0e, 0x6b,
-	0x33, 0xfd, 0x1e, 0x54, 0xcc, 0x79, 0xf4, 0x3e, 0xa7, 0xe1, 0xa1, 0xab, 0x30, 0x30, 0x6d, 0x6e,
-	0x93, 0xdc, 0xa6, 0xfc, 0x20, 0xa1, 0x2c, 0x83, 0x59, 0x8f, 0xd9, 0xd8, 0x4e, 0x61, 0x5c, 0xc2,
-	0xd3, 0x70, 0xec, 0x4e, 0xc9, 0x44, 0x8a, 0x5f, 0xb6, 0x5e, 0x20, 0x60, 0x1d, 0xa1, 0x83, 0x55,
-	0xe1, 0x14, 0x2e, 0x0b, 0x67, 0x0f, 0xaa, 0x73, 0x4a, 0x44, 0x63, 0x94, 0x56, 0x02, 0xe5, 0x39,
-	0xb5, 0x23, 0xae, 0xa0, 0x16, 0x54, 0x12, 0x46, 0x68, 0x94, 0x7a, 0x79, 0x1d, 0x97, 0x12, 0x66,
-	0x45, 0xb6, 0x87, 0x8e, 0xa0, 0xc6, 0xbd, 0x7f, 0x22, 0x63, 0x8d, 0x6a, 0x94, 0xb3, 0x77, 0x02,
-	0x17, 0x81, 0x08, 0x43, 0x7c, 0x11, 0x94, 0x6e, 0x42, 0x89, 0x27, 0x32, 0xdf, 0x13, 0x65, 0x61,
-	0x15, 0x6f, 0xba, 0x51, 0x64, 0x7b, 0xfa, 0x7f, 0x14, 0xa0, 0xe6, 0xd0, 0xe4, 0x98, 0x85, 0xf3,
-	0x68, 0x60, 0x62, 0x8e, 0x16, 0x79, 0x8c, 0x5c, 0x98, 0x54, 0xe4, 0x31, 0xdb, 0x43, 0x1f, 0x41,
-	0x8d, 0x83, 0xb3, 0xad, 0xe6, 0x26, 0x86, 0xc8, 0x63, 0xaa, 0xfb, 0x41, 0xb7, 0x01, 0x22, 0x46,
-	0xc7, 0xd4, 0xa3, 0xe9, 0x69, 0x1b, 0x38, 0x03, 0x41, 0xbf, 0x03, 0x55, 0x4e, 0x40, 0xe6, 0x83,
-	0xa2, 0xf0, 0xbd, 0xeb, 0xd9, 0x8b, 0x0c, 0x8f, 0xc9, 0x2c, 0x50, 0x89, 0xd4, 0x08, 0xed, 0x43,
-	0x21, 0xf2, 0x7c, 0x75, 0x91, 0xd0, 0xcc, 0xe2, 0x9a, 0x36, 0xe6, 0x53, 0xe8, 0x0e, 0x34, 0x42,
-	0xf2, 0x0d, 0xe1, 0x3d, 0x20, 0xf1, 0x68, 0x2c, 0xeb, 0xe0, 0x06, 0x86, 0xf0, 0x31, 0xa6, 0xb3,
-	0x90, 0x07, 0x42, 0x74, 0x17, 0x34, 0xd1, 0x30, 0x50, 0x12, 0x71, 0x8f, 0x15, 0xd7, 0x28, 0xf2,
-	0xfc, 0x4d, 0x09, 0x1f, 0x30, 0xea, 0xf1, 0x6e, 0x05, 0x3d, 0x04, 0x88, 0x69, 0x42, 0xce, 0x19,
-	0x99, 0xb8, 0x4c, 0x34, 0x82, 0xb5, 0xc3, 0xed, 0xe5, 0x6b, 0x27, 0x21, 0xa4, 0x8e, 0x81, 0x71,
-	0x25, 0xe6, 0x1f, 0x1d, 0x97, 0xa1, 0xa7, 0x70, 0xdd, 0x5b, 0xb4, 0x24, 0xa2, 0x35, 0x25, 0x8c,
-	0xbe, 0x10, 0x97, 0x08, 0xb5, 0xc3, 0x3b, 0xef, 0x6a, 0x5c, 0xe4, 0x0d, 0xd9, 0x35, 0x6f, 0x09,
-	0x8e, 0xe9, 0x0b, 0xf4, 0x4b, 0xb8, 0x76, 0x99, 0x20, 0x08, 0x82, 0x57, 0x5e, 0xf5, 0x6d, 0xad,
-	0x10, 0xd3, 0xff, 0x29, 0x77, 0xa1, 0xde, 0x8e, 0x21, 0xd4, 0x3b, 0x71, 0xb3, 0xea, 0x9d, 0xb8,
-	0x5c, 0xbd, 0xbf, 0x80, 0xeb, 0x1c, 0x2c, 0xa3, 0x3b, 0x49, 0x42, 0xe2, 0x46, 0xd1, 0xf4, 0x8d,
-	0x68, 0xec, 0xd6, 0xe6, 0x01, 0x6d, 0xe2, 0x32, 0x39, 0x1c, 0x86, 0x06, 0x47, 0x45, 0x07, 0x50,
-	0x99, 0xbc, 0xf2, 0x48, 0xe4, 0xb2, 0x99, 0x72, 0xf2, 0xac, 0x7a, 0xd3, 0x90, 0x82, 0xcb, 0x13,
-	0x31, 0x9a, 0x71, 0x7c, 0x6f, 0xce, 0xd1, 0xdd, 0x99, 0xf2, 0xeb, 0x2c, 0x7e, 0xea, 0xb4, 0xb8,
-	0xec, 0xcd, 0xc5, 0x40, 0xff, 0xab, 0x3c, 0x80, 0x23, 0xef, 0xab, 0x1d, 0x2a, 0x32, 0xc7, 0xc5,
-	0xdd, 0xf4, 0x45, 0x1b, 0x5d, 0xbf, 0x00, 0xda, 0xde, 0x7b, 0x78, 0xe9, 0xa7, 0xb0, 0x95, 0x5e,
-	0x82, 0x67, 0xbb, 0xe7, 0x06, 0x6e, 0x2a, 0x70, 0x6a, 0xde, 0xf7, 0xa1, 0x1c, 0x84, 0x9e, 0x28,
-	0x79, 0x24, 0xb7, 0x59, 0xa1, 0xf4, 0x42, 0x8f, 0xda, 0x26, 0x2e, 0x71, 0x0c, 0xdb, 0xe3, 0x6d,
-	0xa3, 0x34, 0xf3, 0xcd, 0xcb, 0x6d, 0x63, 0x5a, 0xf6, 0xa8, 0x6a, 0x27, 0x63, 0x75, 0x91, 0xc7,
-	0x5a, 0x25, 0x51, 0xdf, 0xad, 0xb3, 0xba, 0x81, 0x99, 0x5a, 0xdd, 0xc0, 0x63, 0xfa, 0x7f, 0xe6,
-	0x60, 0x7b, 0x34, 0xe8, 0x28, 0x79, 0xb4, 0xc3, 0x20, 0xa1, 0xaf, 0x13, 0xe9, 0x35, 0x3f, 0x02,
-	0x18, 0xbb, 0xf3, 0x98, 0xca, 0x70, 0x2b, 0x13, 0x3f, 0xca, 0x10, 0x6c, 0xf3, 0x49, 0xdb, 0xc2,
-	0x55, 0x81, 0x25, 0xc2, 0xac, 0x05, 0x5a, 0x2a, 0x84, 0x38, 0x70, 0xa3, 0xf8, 0x9b, 0x50, 0x26,
-	0xea, 0xe5, 0x4a, 0xf3, 0x62, 0x3f, 0xe9, 0xa8, 0xa9, 0xe0, 0x1c, 0xb5, 0x04, 0xd9, 0xb0, 0x35,
-	0x71, 0xfd, 0xe9, 0x9c, 0x51, 0x92, 0xde, 0x6d, 0x14, 0x2e, 0xb9, 0x41, 0x47, 0x62, 0x70, 0x8f,
-	0xe3, 0x7b, 0xb3, 0x99, 0x8c, 0xd9, 0x8d, 0x49, 0x06, 0xee, 0xe9, 0x7f, 0x53, 0x84, 0xb2, 0x62,
-	0x14, 0xfd, 0x14, 0x2a, 0xea, 0x40, 0x74, 0x4d, 0x5b, 0xa8, 0xb0, 0xe4, 0xef, 0xa9, 0x3b, 0x9d,
-	0xd3, 0x18, 0x97, 0xe5, 0xd1, 0xa8, 0xfe, 0xef, 0x05, 0xa8, 0x65, 0x26, 0x78, 0x05, 0x87, 0x2d,
-	0xc7, 0xc2, 0xa7, 0xa2, 0x9f, 0xbd, 0x01, 0x1a, 0xb6, 0x9e, 0x8e, 0x2c, 0x67, 0x48, 0x8c, 0x76,
-	0xdb, 0x1a, 0xf0, 0x8a, 0x2f, 0x87, 0x6e, 0xc3, 0x5e, 0x0a, 0xc5, 0xd6, 0x13, 0xab, 0xcd, 0xfb,
-	0xc5, 0x5e, 0x9f, 0x60, 0xcb, 0x70, 0x44, 0x17, 0x7b, 0x0b, 0x76, 0xd3, 0x12, 0xb2, 0xdd, 0xef,
-	0x0d, 0xad, 0x67, 0x43, 0xd2, 0xeb, 0x0f, 0x49, 0xa7, 0x3f, 0xea, 0x99, 0x5a, 0x01, 0xb5, 0xe0,
-	0xc6, 0x89, 0xd1, 0x33, 0x8d, 0x61, 0x1f, 0x7f, 0x4d, 0x6c, 0x8b, 0x9c, 0xd8, 0x8e, 0xc3, 0xeb,
-	0xca, 0x22, 0xda, 0x83, 0xed, 0x76, 0xbf, 0x67, 0xda, 0xbc, 0x28, 0x35, 0xba, 0xd9, 0xb9, 0x4d,
-	0x5e, 0xe6, 0xda, 0x3d, 0xd9, 0x08, 0x75, 0xad, 0xde, 0xf1, 0xf0, 0xb1, 0x56, 0xe2, 0xf8, 0x4b,
-	0x94, 0xec, 0x5e, 0xbb, 0x8f, 0xb1, 0xd5, 0x1e, 0x6a, 0x65, 0xce, 0x44, 0x8a, 0xdf, 0xe9, 0xe3,
-	0xaf, 0x0c, 0x6c, 0xda, 0xbd, 0x63, 0x32, 0xe8, 0x77, 0xed, 0xf6, 0xd7, 0x5a, 0x05, 0xfd, 0x00,
-	0xf6, 0x17, 0xd3, 0x64, 0x68, 0xd9, 0x26, 0x31, 0xba, 0xdd, 0xbe, 0x6c, 0xc4, 0x49, 0x7f, 0x20,
-	0xfa, 0xf1, 0x2a, 0xfa, 0x18, 0x3e, 0xea, 0xf5, 0x89, 0xe5, 0x0c, 0x8d, 0x47, 0x5d, 0xdb, 0x79,
-	0x6c, 0x99, 0x64, 0xd0, 0x69, 0x0f, 0x88, 0xe1, 0x38, 0xfd, 0xb6, 0x2d, 0x9b, 0x76, 0x40, 0xf7,
-	0xe0, 0x13, 0x3c, 0xea, 0x5a, 0xf2, 0x1a, 0x40, 0x2c, 0xc7, 0xe4, 0xa4, 0x6f, 0x2e, 0xfa, 0x7a,
-	0x92, 0x76, 0xd8, 0x35, 0xf4, 0x21, 0xb4, 0x04, 0x01, 0xab, 0x37, 0xe4, 0x1c, 0x0b, 0xf9, 0x1c,
-	0x5b, 0x8e, 0x20, 0x54, 0xe7, 0xc7, 0x11, 0x62, 0x74, 0xfa, 0x23, 0xdc, 0xb6, 0x1c, 0x62, 0x9c,
-	0x1a, 0x76, 0xd7, 0x78, 0xd4, 0xb5, 0xb4, 0x06, 0xda, 0x85, 0x9b, 0x5c, 0x2b, 0x76, 0xdb, 0x12,
-	0xb2, 0x74, 0x46, 0x83, 0x41, 0x1f, 0x73, 0x75, 0x34, 0x45, 0x03, 0xf0, 0xb5, 0x33, 0xb4, 0x4e,
-	0x16, 0x1b, 0x6d, 0xe9, 0x8f, 0x60, 0x7b, 0xbd, 0x19, 0xa1, 0xbb, 0x3c, 0x65, 0x30, 0xd5, 0x26,
-	0x65, 0xdd, 0xa8, 0x3f, 0x99, 0xd0, 0xc0, 0xf3, 0x83, 0x73, 0xdb, 0xe2, 0xa9, 0x83, 0xe9, 0xff,
-	0x95, 0x83, 0x5a, 0x06, 0xc8, 0xd3, 0x97, 0xef, 0xd1, 0x20, 0xf1, 0x27, 0x3e, 0x65, 0x2a, 0x36,
-	0x66, 0x20, 0x6f, 0xbf, 0x66, 0x45, 0x5f, 0x41, 0xeb, 0x45, 0x18, 0x13, 0xca, 0xd9, 0x18, 0x2b,
-	0xd3, 0x4f, 0x2f, 0xc6, 0x0a, 0x97, 0x0a, 0x96, 0x35, 0x17, 0x6a, 0xf8, 0xe6, 0x8b, 0x30, 0xb6,
-	0xe4, 0x72, 0x71, 0x93, 0x2f, 0x17, 0xa3, 0xc7, 0xb0, 0xe5, 0xd1, 0x29, 0x79, 0x41, 0xd9, 0x82,
-	0x9e, 0x0c, 0x3d, 0xfb, 0x57, 0xdd, 0x87, 0xe1, 0x86, 0x47, 0xa7, 0x4f, 0x29, 0x53, 0x94, 0xf4,
-	0x7f, 0xce, 0x43, 0xc5, 0x1e, 0x88, 0xe6, 0xa0, 0xcb, 0xcb, 0x20, 0x1e, 0x71, 0x44, 0xe4, 0x8d,
-	0xd3, 0x32, 0x28, 0xa6, 0x89, 0x08, 0xb3, 0x31, 0x8f, 0x99, 0xc9, 0x38, 0x22, 0x8b, 0x8a, 0x5b,
-	0xc5, 0xcc, 0x64, 0x1c, 0x99, 0xaa, 0xe8, 0x56, 0x18, 0x8b, 0xc2, 0xbb, 0xb0, 0xc0, 0x70, 0x64,
-	0xed, 0xcd, 0x31, 0xe6, 0x5e, 0x86, 0x86, 0xac, 0xda, 0x61, 0xee, 0x65, 0x69, 0x70, 0x8c, 0x95,
-	0xe2, 0x9d, 0x63, 0xa4, 0x34, 0x44, 0xd7, 0x40, 0x44, 0x23, 0xa0, 0xd2, 0x7a, 0xd9, 0x8f, 0x06,
-	0xe2, 0x65, 0xf4, 0x87, 0x50, 0x12, 0x15, 0x5a, 0x24, 0x32, 0xf9, 0x72, 0x80, 0xb5, 0x07, 0xbc,
-	0xd0, 0xa6, 0x71, 0x8c, 0x37, 0x79, 0xc1, 0x16, 0xa1, 0xcf, 0xa0, 0x2c, 0xab, 0xbe, 0x48, 0xe5,
-	0xf4, 0xf5, 0xd8, 0x25, 0x51, 0x08, 0x46, 0x2b, 0x65, 0x4c, 0x75, 0xb5, 0x8c, 0xd1, 0x7f, 0x95,
-	0x83, 0xe6, 0xc8, 0xca, 0x06, 0x42, 0xd4, 0x87, 0xad, 0x39, 0x25, 0xe3, 0x30, 0x98, 0xf8, 0xe7,
-	0x24, 0xdb, 0xef, 0x7e, 0xba, 0xf4, 0xfa, 0x97, 0x5d, 0x73, 0x30, 0xb2, 0xda, 0x02, 0x5f, 0x86,
-	0xd2, 0xc6, 0x9c, 0x66, 0x3e, 0xf5, 0xd7, 0xd0, 0x58, 0x9a, 0xcf, 0x74, 0xa1, 0x1b, 0x48, 0x83,
-	0xfa, 0xa8, 0x87, 0xad, 0x63, 0xdb, 0x19, 0x5a, 0x58, 0x44, 0x2c, 0x0d, 0xea, 0x76, 0xcf, 0x19,
-	0x1a, 0xdd, 0x2e, 0xb1, 0xcd, 0xae, 0xa5, 0xe5, 0xb9, 0xd3, 0x8c, 0x7a, 0x4b, 0xb0, 0x82, 0x70,
-	0xa4, 0x91, 0x33, 0xb0, 0x7a, 0xa6, 0x65, 0x12, 0xd3, 0x18, 0x1a, 0x5a, 0x11, 0x6d, 0x41, 0x0d,
-	0x5b, 0xce, 0xe8, 0xc4, 0x92, 0x80, 0x4d, 0xfd, 0xff, 0x0a, 0x50, 0xbf, 0xe0, 0x94, 0x26, 0xbc,
-	0x7e, 0xbf, 0x9c, 0x66, 0xdf, 0x71, 0x7f, 0xb4, 0x9c, 0x7f, 0x97, 0x85, 0x99, 0xbf, 0x54, 0x13,
-	0xfe, 0x4c, 0x48, 0x4e, 0xb5, 0x29, 0x42, 0x0f, 0xca, 0x63, 0xd6, 0xeb, 0xa8, 0xc1, 0x8b, 0x63,
-	0xde, 0xbf, 0x88, 0xcf, 0x8b, 0xd5, 0x47, 0x8b, 0xd5, 0xc5, 0x2b, 0x57, 0x1f, 0xa5, 0xab, 0xbf,
-	0x80, 0x26, 0x15, 0x3d, 0xd2, 0x62, 0xf1, 0xe6, 0x3b, 0x16, 0xd7, 0x29, 0xef, 0x9d, 0xd2, 0xb5,
-	0x1a, 0x14, 0xdc, 0x28, 0x50, 0xb7, 0xae, 0x7c, 0x88, 0x10, 0x14, 0x5f, 0x4e, 0xdd, 0x40, 0x3d,
-	0x33, 0x88, 0xb1, 0x78, 0xf4, 0x08, 0x64, 0xe1, 0x21, 0x9f, 0x15, 0x4a, 0x7e, 0x20, 0x8a, 0x8e,
-	0x5d, 0xa8, 0x84, 0xf3, 0x44, 0xce, 0x48, 0x0b, 0x2b, 0x87, 0xf3, 0x44, 0x4c, 0xb5, 0x41, 0x9b,
-	0x53, 0xb2, 0xc8, 0xc6, 0xc2, 0x98, 0xe0, 0xd2, 0x3d, 0xc2, 0xb2, 0x31, 0xe1, 0xe6, 0x9c, 0x2e,
-	0x19, 0xe4, 0x8f, 0x00, 0x7c, 0xf9, 0x4c, 0x42, 0xbc, 0x69, 0xab, 0x71, 0xa9, 0xb8, 0x4a, 0x43,
-	0x01, 0xae, 0xf8, 0xe2, 0xb9, 0xc4, 0x9c, 0xea, 0xff, 0x93, 0x83, 0xd6, 0x82, 0xaa, 0xaa, 0x27,
-	0x16, 0xd7, 0xb2, 0x6b, 0xd4, 0x94, 0xfb, 0x4e, 0x6a, 0xca, 0xbf, 0xbf, 0x9a, 0x3e, 0x81, 0x66,
-	0x18, 0x51, 0xe6, 0xca, 0xba, 0x34, 0xbd, 0x22, 0x68, 0xe0, 0xc6, 0x02, 0x2a, 0x9a, 0xea, 0xe5,
-	0xaa, 0xa7, 0xf8, 0x1e, 0x55, 0x8f, 0xfe, 0x04, 0xb6, 0x8e, 0xa9, 0x28, 0x9a, 0x16, 0xcf, 0x62,
-	0xdb, 0x50, 0x1a, 0x87, 0xe1, 0x73, 0x3f, 0xed, 0xf9, 0xd4, 0x17, 0x6f, 0x7e, 0xe4, 0x88, 0xcc,
-	0xdc, 0xf8, 0x79, 0x6a, 0xc8, 0x12, 0x74, 0xe2, 0xc6, 0xcf, 0xef, 0x7f, 0x01, 0x25, 0x59, 0x0d,
-	0xf3, 0x9e, 0xde, 0xc4, 0xfd, 0x81, 0xec, 0xee, 0x79, 0x6e, 0xd6, 0x72, 0x7c, 0xf4, 0x68, 0xd4,
-	0xe9, 0x68, 0x79, 0x3e, 0xea, 0xf5, 0xdb, 0x03, 0xad, 0x20, 0xf0, 0x46, 0x83, 0xae, 0x56, 0xbc,
-	0xff, 0x39, 0x5c, 0x77, 0xc2, 0x39, 0x1b, 0xd3, 0x45, 0x77, 0x29, 0x4e, 0x24, 0x7c, 0x5e, 0x5d,
-	0x64, 0x57, 0xa0, 0xd8, 0xee, 0x8b, 0x5b, 0x6c, 0x80, 0x92, 0x73, 0xec, 0x77, 0x8d, 0x9e, 0x96,
-	0xbf, 0xff, 0x19, 0x54, 0xd2, 0xae, 0x09, 0xd5, 0xa0, 0xac, 0xfc, 0x5d, 0xdb, 0xe0, 0x48, 0xd8,
-	0x3a, 0xe9, 0x9f, 0x5a, 0x72, 0x6f, 0x19, 0x14, 0x0e, 0xff, 0xbc, 0x06, 0xd5, 0x41, 0xfa, 0x1f,
-	0x13, 0xf4, 0x0c, 0x76, 0xb2, 0xff, 0x76, 0xe0, 0x2a, 0x67, 0xe1, 0x74, 0xca, 0x1b, 0xc5, 0xdb,
-	0xab, 0x6f, 0xed, 0xcb, 0xff, 0x88, 0xd8, 0xfb, 0xe0, 0x1d, 0x6f, 0xf1, 0xfa, 0x06, 0xea, 0x42,
-	0xd3, 0xa1, 0x89, 0x73, 0x92, 0x56, 0x8b, 0x31, 0x5a, 0x6a, 0x4e, 0x17, 0xb1, 0x65, 0xef, 0xce,
-	0xda, 0xe2, 0x32, 0x5b, 0xcc, 0xea, 0x1b, 0x68, 0xa0, 0xfe, 0x1c, 0x20, 0xdf, 0xd6, 0xe4, 0xe3,
-	0xde, 0xad, 0x55, 0x06, 0x96, 0xfe, 0x21, 0x71, 0x15, 0x7f, 0x18, 0x1a, 0x4b, 0x49, 0x18, 0x5d,
-	0xd5, 0x54, 0xed, 0x5d, 0x91, 0xbf, 0xf5, 0x0d, 0xf4, 0x0c, 0xb6, 0x56, 0x12, 0x31, 0xba, 0xba,
-	0xf7, 0xdb, 0xbb, 0x32, 0x8f, 0xeb, 0x1b, 0xc8, 0x80, 0xe6, 0x31, 0x4d, 0xe4, 0x01, 0x47, 0xb1,
-	0x7b, 0x4e, 0x51, 0xda, 0x78, 0x88, 0xff, 0x04, 0x1d, 0x9c, 0x86, 0xbe, 0xb7, 0xb7, 0xb7, 0xf2,
-	0xf2, 0x86, 0xe9, 0x38, 0x64, 0x9e, 0xb8, 0xae, 0xd5, 0x37, 0x90, 0x09, 0x95, 0xd4, 0xd0, 0x51,
-	0x16, 0x73, 0xc5, 0xfa, 0xaf, 0xa0, 0xf2, 0x73, 0x00, 0x71, 0xc3, 0x22, 0xf8, 0x43, 0xdb, 0xeb,
-	0xdf, 0x94, 0xf6, 0x76, 0xde, 0xf2, 0x62, 0x23, 0x09, 0x60, 0xf1, 0x58, 0xfb, 0xeb, 0x12, 0x30,
-	0x61, 0x4b, 0xde, 0xd7, 0xa7, 0x8f, 0x54, 0xf1, 0xaf, 0x43, 0xa5, 0x07, 0x5b, 0x17, 0x7f, 0x76,
-	0x91, 0xaa, 0xfa, 0x70, 0xd5, 0x60, 0xb2, 0x7f, 0x84, 0xb9, 0xca, 0x9c, 0x28, 0xec, 0xbd, 0xfd,
-	0x4d, 0x02, 0x7d, 0xab, 0xbf, 0xcb, 0xbc, 0x0f, 0xdb, 0x8b, 0xe7, 0xaa, 0x35, 0x6c, 0x67, 0xff,
-	0x8c, 0x74, 0x15, 0xdb, 0x1d, 0xa8, 0x1b, 0x9e, 0xb7, 0xa0, 0x86, 0xde, 0xf5, 0x4f, 0xa5, 0x77,
-	0xf1, 0x65, 0x73, 0xcb, 0x9f, 0xd2, 0x84, 0x7e, 0x2f, 0xa4, 0xa4, 0x88, 0xec, 0x41, 0xc7, 0x7e,
-	0xf6, 0x9d, 0x48, 0xfd, 0x12, 0xb6, 0x8f, 0x69, 0xb2, 0xee, 0x59, 0x65, 0x8d, 0xf7, 0x2c, 0xb9,
-	0xf7, 0x9a, 0x25, 0x27, 0xd0, 0x90, 0x7c, 0x8d, 0x2c, 0xa9, 0xd4, 0x9d, 0xb5, 0xa9, 0x98, 0x26,
-	0x7b, 0x1f, 0xaf, 0x9b, 0x58, 0xc9, 0xa6, 0x8f, 0x3e, 0xf8, 0xbd, 0x5d, 0x81, 0xf5, 0x60, 0x9a,
-	0xd0, 0x07, 0xe3, 0x69, 0x38, 0xf7, 0x1e, 0x9c, 0x87, 0xea, 0x0f, 0x75, 0x67, 0x25, 0xf1, 0xfb,
-	0xe3, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x39, 0xd5, 0x29, 0x80, 0x19, 0x28, 0x00, 0x00,
+	0x7a, 0xe2, 0x43, 0x7c, 0x7c, 0x7c, 0xa8, 0x5d, 0xb6, 0x65, 0x49, 0x7e, 0x8c, 0xdc, 0xb3, 0x93,
+	0xb1, 0xbd, 0x59, 0x39, 0xab, 0x31, 0x34, 0xbb, 0x33, 0x8b, 0xec, 0xb6, 0xd9, 0x4d, 0xb9, 0xbd,
+	0x14, 0x49, 0x57, 0x93, 0x1a, 0x4f, 0xb0, 0x48, 0xa1, 0xc5, 0x2e, 0x6a, 0x3a, 0x26, 0xbb, 0xdb,
+	0xd5, 0x4d, 0x3f, 0x82, 0x20, 0x87, 0x20, 0x48, 0x80, 0x9c, 0x72, 0xcf, 0x21, 0xb7, 0xdc, 0x03,
+	0xe4, 0x92, 0x3f, 0x10, 0x04, 0x48, 0x80, 0x5c, 0x72, 0xdb, 0xe4, 0x94, 0x5b, 0x80, 0x00, 0x39,
+	0x04, 0x39, 0x07, 0xf5, 0x68, 0xaa, 0x49, 0x51, 0x96, 0x66, 0x67, 0x72, 0xea, 0xaa, 0xaf, 0xbe,
+	0xfa, 0xaa, 0xea, 0x7b, 0x7f, 0x55, 0x0d, 0x3b, 0x93, 0x84, 0x3e, 0x8e, 0x58, 0x98, 0x84, 0xf1,
+	0xe3, 0xc8, 0x8f, 0xe8, 0xc4, 0x0f, 0xa8, 0xb7, 0x27, 0x00, 0xa8, 0x3a, 0x75, 0x4f, 0xa7, 0xee,
+	0xde, 0x24, 0xa1, 0x3b, 0xdb, 0x21, 0x1b, 0xfd, 0x84, 0xa5, 0x88, 0xa3, 0x70, 0x3a, 0x0d, 0x03,
+	0x89, 0xb5, 0x73, 0x23, 0x43, 0xc1, 0x8d, 0x52, 0xe8, 0x76, 0x96, 0x6e, 0x38, 0xf1, 0x47, 0xef,
+	0xbd, 0x13, 0x35, 0xb4, 0x9b, 0x19, 0x8a, 0x69, 0x1c, 0xfb, 0x61, 0x40, 0xa6, 0x6e, 0xe0, 0x9e,
+	0x52, 0xa6, 0x30, 0xee, 0x66, 0x31, 0x66, 0x27, 0xf1, 0x88, 0xf9, 0x27, 0x94, 0xcd, 0x09, 0x64,
+	0xf7, 0x3c, 0x0d, 0x4f, 0xfc, 0x89, 0x9f, 0xbc, 0x57, 0x7b, 0xd6, 0xff, 0x3e, 0x07, 0xd7, 0x1c,
+	0x9a, 0xcc, 0xa2, 0xf6, 0x24, 0x7c, 0x1b, 0x63, 0xfa, 0x7a, 0x46, 0xe3, 0x04, 0x7d, 0x09, 0x15,
+	0x26, 0x9b, 0xf1, 0x56, 0x6e, 0xb7, 0xf0, 0xa0, 0xb6, 0xff, 0xd1, 0xde, 0xfc, 0x70, 0x7b, 0xc6,
+	0x28, 0xf1, 0xdf, 0xb8, 0x09, 0xcd, 0x4e, 0xc1, 0xf3, 0x09, 0xe8, 0x06, 0xac, 0xd3, 0x28, 0x1c,
+	0x7d, 0xb3, 0x95, 0xdf, 0xcd, 0x3d, 0x28, 0x62, 0xd9, 0x41, 0x2f, 0xa0, 0xf1, 0x7a, 0x16, 0x26,
+	0x2e, 0x99, 0x45, 0x9e, 0x9b, 0xd0, 0x78, 0xab, 0xb0, 0x9b, 0x7b, 0x50, 0xdb, 0xff, 0xed, 0x0c,
+	0xdd, 0xa1, 0x18, 0x71, 0xe6, 0x07, 0x78, 0xc1, 0xf1, 0x9d, 0xc4, 0x4d, 0x68, 0xba, 0x48, 0x5d,
+	0x90, 0x90, 0x78, 0xb1, 0xfe, 0x43, 0xb8, 0x2e, 0xb6, 0x6e, 0xd2, 0xb1, 0x3b, 0x9b, 0x24, 0xe9,
+	0xe6, 0xe7, 0xeb, 0xe7, 0x32, 0xeb, 0xeb, 0x27, 0xea, 0x9c, 0x43, 0xeb, 0xc8, 0x1d, 0xa5, 0xa8,
+	0x9f, 0x9f, 0x3b, 0xe7, 0xed, 0xec, 0x7e, 0x38, 0x2a, 0x3f, 0xe4, 0x15, 0xcf, 0xa8, 0x9f, 0x02,
+	0x12, 0x6b, 0xf4, 0x85, 0x00, 0xff, 0xff, 0x98, 0xa9, 0xff, 0x91, 0x3a, 0x8c, 0xe0, 0x50, 0xba,
+	0xce, 0x39, 0x0e, 0xe7, 0xbe, 0x2b, 0x87, 0x2f, 0x58, 0xfd, 0xcf, 0x72, 0xa0, 0x65, 0x75, 0x26,
+	0x9e, 0x4d, 0x12, 0xf4, 0x05, 0x94, 0x98, 0x68, 0x89, 0x65, 0x9b, 0xfb, 0x7a, 0x66, 0xd9, 0x65,
+	0xe4, 0x3d, 0xf9, 0xc1, 0x6a, 0x86, 0x7e, 0x00, 0x25, 0x45, 0xa5, 0x06, 0x65, 0x67, 0xd8, 0x6a,
+	0x59, 0x8e, 0xa3, 0xad, 0xf1, 0x4e, 0xdb, 0xb0, 0x3b, 0x43, 0x6c, 0x69, 0x39, 0x84, 0xa0, 0xd9,
+	0x1b, 0x0e, 0x4c, 0x63, 0x60, 0x99, 0xc4, 0xea, 0xf7, 0x5a, 0xcf, 0xb4, 0xbc, 0xfe, 0xa7, 0x39,
+	0xb8, 0xa6, 0x36, 0xde, 0x63, 0xfe, 0xa9, 0x1f, 0x0c, 0xde, 0x47, 0x14, 0x7d, 0x09, 0xc5, 0xe4,
+	0x7d, 0x44, 0xd5, 0x3e, 0x3e, 0xcd, 0xec, 0xe3, 0x1c, 0xee, 0xde, 0x59, 0x13, 0x8b, 0x49, 0xfa,
+	0x3e, 0x40, 0x86, 0x54, 0x09, 0xf2, 0x87, 0x2f, 0xb5, 0x35, 0xf1, 0xfd, 0x5a, 0xcb, 0xf1, 0x6f,
+	0xf7, 0x89, 0x96, 0x47, 0x75, 0xa8, 0x7c, 0x65, 0x77, 0xcc, 0x96, 0x81, 0x4d, 0xad, 0xa0, 0x1f,
+	0xc3, 0xc6, 0x31, 0x65, 0xdc, 0x2e, 0xa9, 0x27, 0x45, 0x8f, 0x1e, 0x42, 0x91, 0xcd, 0x26, 0x54,
+	0x89, 0xe0, 0x66, 0x66, 0x0f, 0x4a, 0x37, 0x66, 0x13, 0x8a, 0x05, 0x0a, 0xda, 0x82, 0xf2, 0x1b,
+	0x39, 0x5b, 0x70, 0xb9, 0x81, 0xd3, 0xae, 0xfe, 0x37, 0x05, 0xb8, 0xb1, 0x4a, 0x3d, 0xd0, 0x43,
+	0x28, 0xc4, 0xbe, 0xa7, 0x88, 0xdf, 0xca, 0x32, 0x7a, 0x2e, 0x59, 0xdb, 0xc4, 0x1c, 0x07, 0xdd,
+	0x82, 0xb2, 0x1f, 0x11, 0xd7, 0xf3, 0x98, 0xa0, 0x5e, 0xc5, 0x25, 0x3f, 0x32, 0x3c, 0x8f, 0xa1,
+	0x16, 0x34, 0x95, 0x92, 0x91, 0x50, 0x1c, 0x78, 0x6b, 0x5d, 0x90, 0xbb, 0xf3, 0x21, 0x7e, 0xe1,
+	0x06, 0xcb, 0x82, 0xd0, 0xef, 0x42, 0xc5, 0x8d, 0x02, 0xe2, 0x4e, 0x4f, 0xd8, 0x56, 0x49, 0x4c,
+	0xff, 0x38, 0xab, 0xda, 0xa7, 0xa7, 0x8c, 0x9e, 0xba, 0x09, 0xf5, 0x8e, 0xdc, 0x77, 0xfe, 0x74,
+	0x36, 0x7d, 0xea, 0x27, 0x8c, 0xeb, 0x5a, 0xd9, 0x8d, 0x02, 0x63, 0x7a, 0xc2, 0xd0, 0x6d, 0xa8,
+	0xfa, 0xd1, 0x9b, 0x03, 0xb9, 0xbf, 0xf2, 0x6e, 0xee, 0x41, 0x1d, 0x57, 0x38, 0x40, 0xec, 0x70,
+	0x13, 0x4a, 0xd3, 0xd8, 0x8f, 0xbd, 0x60, 0xab, 0x22, 0x46, 0x54, 0x0f, 0x7d, 0x0c, 0x8d, 0x59,
+	0x34, 0xf1, 0x83, 0x57, 0x24, 0x99, 0x05, 0x01, 0x9d, 0x6c, 0x55, 0x05, 0xdb, 0xea, 0x12, 0x38,
+	0x10, 0x30, 0xf4, 0x29, 0x6c, 0x78, 0xe1, 0xdb, 0x20, 0x8b, 0x06, 0x02, 0xad, 0x99, 0x82, 0x15,
+	0xe2, 0x01, 0x54, 0x84, 0xbf, 0xf5, 0x69, 0xbc, 0x55, 0x13, 0xd6, 0xb9, 0x93, 0x39, 0xc2, 0x92,
+	0x5c, 0xf1, 0x1c, 0xf7, 0x79, 0xb1, 0x52, 0xd0, 0x8a, 0xcf, 0x8b, 0x95, 0xa2, 0xb6, 0xae, 0xb7,
+	0xe1, 0xda, 0x12, 0xa2, 0x6d, 0x72, 0xce, 0x73, 0xf9, 0x12, 0x25, 0xa8, 0x2a, 0x2e, 0xf1, 0xae,
+	0xed, 0x7d, 0x40, 0xe0, 0x7f, 0x5e, 0x80, 0x4d, 0x93, 0xba, 0xdf, 0x51, 0xe4, 0xe7, 0x25, 0x5b,
+	0xf8, 0xf6, 0x92, 0xcd, 0xe8, 0x4d, 0x71, 0x41, 0x6f, 0x16, 0x44, 0xb6, 0xbe, 0x24, 0xb2, 0x9f,
+	0xc2, 0x36, 0xa3, 0xd3, 0xf0, 0x0d, 0x25, 0x9e, 0xf4, 0xc9, 0xc4, 0x63, 0x61, 0x44, 0xc6, 0xfc,
+	0x24, 0x42, 0x41, 0x2a, 0x78, 0x53, 0x22, 0x28, 0x9f, 0x6d, 0xb2, 0x50, 0x3a, 0x86, 0xf3, 0x52,
+	0x2d, 0x5f, 0x4d, 0xaa, 0x95, 0x95, 0x52, 0xfd, 0x49, 0x46, 0xaa, 0x55, 0x21, 0xd5, 0x3b, 0x17,
+	0x4b, 0xd5, 0x36, 0x17, 0xe4, 0x9a, 0xd7, 0x0a, 0xfa, 0xdf, 0xe5, 0xa0, 0xc1, 0x6d, 0xf4, 0x28,
+	0xf4, 0x94, 0x67, 0xba, 0x50, 0x9c, 0x9f, 0xcf, 0x1d, 0x5f, 0x5e, 0x38, 0x9c, 0xac, 0x73, 0x5f,
+	0x20, 0xb1, 0xe4, 0xf5, 0xb2, 0x7a, 0x50, 0x10, 0xee, 0x75, 0xae, 0x07, 0x9f, 0xaf, 0xf6, 0x87,
+	0xd7, 0x61, 0xa3, 0x6f, 0xe0, 0x81, 0x6d, 0x74, 0x48, 0x0a, 0xcc, 0x65, 0x9d, 0x64, 0x5e, 0xff,
+	0x15, 0x5c, 0x5f, 0x72, 0x18, 0x82, 0xca, 0xcf, 0xa1, 0x29, 0x73, 0x0a, 0x22, 0x97, 0x8e, 0xb7,
+	0xf2, 0x82, 0x27, 0x5b, 0x17, 0x6d, 0x15, 0x37, 0x22, 0x15, 0xc2, 0x04, 0xfa, 0xf3, 0x62, 0x25,
+	0xa7, 0xe5, 0xf5, 0xbf, 0xcc, 0xc1, 0xcd, 0x73, 0xea, 0xa9, 0x16, 0x58, 0x74, 0xfe, 0x59, 0xa7,
+	0xbb, 0x72, 0xc6, 0xf7, 0x15, 0x01, 0xfe, 0x2b, 0x0f, 0xb5, 0x4c, 0x84, 0x46, 0x8f, 0x60, 0x7d,
+	0xea, 0x26, 0x2a, 0xf6, 0xd7, 0xf6, 0x6f, 0x64, 0xf6, 0xc1, 0xd1, 0x8e, 0xf8, 0x18, 0x96, 0x28,
+	0x68, 0x9b, 0x3b, 0xaf, 0x88, 0x04, 0xee, 0x94, 0x2a, 0xdf, 0x58, 0x76, 0xa3, 0xa8, 0xeb, 0x4e,
+	0x29, 0x1f, 0x3a, 0x79, 0x9f, 0xd0, 0x98, 0xb0, 0x77, 0xa9, 0x6c, 0x44, 0x1f, 0xbf, 0x43, 0xf7,
+	0xa1, 0x1e, 0x53, 0xf6, 0xc6, 0x1f, 0x51, 0x22, 0xa2, 0x8c, 0xb4, 0x8e, 0x9a, 0x82, 0x89, 0xa8,
+	0x71, 0x0b, 0xca, 0x31, 0x1b, 0x91, 0xa9, 0x3b, 0x12, 0x06, 0x52, 0xc5, 0xa5, 0x98, 0x8d, 0x8e,
+	0xdc, 0x11, 0x1f, 0xf0, 0xe2, 0x44, 0x0c, 0x94, 0xe4, 0x80, 0x17, 0x27, 0x7c, 0xe0, 0x00, 0xd6,
+	0x63, 0x1e, 0x85, 0x85, 0xd2, 0x37, 0xf7, 0x77, 0x97, 0xb6, 0xad, 0x4e, 0x27, 0xda, 0x32, 0x5a,
+	0x4b, 0x74, 0x3d, 0x84, 0xea, 0x1c, 0x86, 0x34, 0xa8, 0xb7, 0x3b, 0xbd, 0xaf, 0x48, 0x0b, 0x5b,
+	0x9c, 0x47, 0xda, 0x1a, 0xfa, 0x08, 0x6e, 0x0b, 0x48, 0xaa, 0x35, 0xad, 0x8e, 0xe1, 0x38, 0x76,
+	0xdb, 0x6e, 0x19, 0x03, 0xbb, 0xd7, 0xd5, 0x72, 0xe8, 0x2e, 0x6c, 0x0b, 0x84, 0xb6, 0xdd, 0x3d,
+	0x3f, 0x9c, 0x9f, 0x53, 0xb4, 0x5e, 0xf6, 0x6d, 0x6c, 0xf1, 0x50, 0xf7, 0xc7, 0x50, 0x97, 0x1b,
+	0x8a, 0xa3, 0x30, 0x88, 0x29, 0x3a, 0x58, 0x12, 0xfc, 0xbd, 0x73, 0x3b, 0x97, 0x88, 0xdf, 0x97,
+	0xbc, 0xff, 0x25, 0x07, 0xda, 0x72, 0x5a, 0xf6, 0x6d, 0x7c, 0xe3, 0x36, 0x54, 0xa6, 0xee, 0x28,
+	0x1b, 0x0f, 0xcb, 0x53, 0x77, 0xb4, 0x14, 0x6e, 0x0a, 0x52, 0x36, 0x2a, 0xdc, 0xdc, 0x83, 0x9a,
+	0x1b, 0x91, 0xf9, 0x2c, 0x29, 0xef, 0xaa, 0x1b, 0x1d, 0xa9, 0x79, 0xb7, 0xa0, 0xec, 0x2a, 0x2d,
+	0x52, 0xd2, 0x76, 0xa5, 0x12, 0xfd, 0x00, 0x9a, 0x91, 0x17, 0x91, 0x38, 0x71, 0x59, 0x42, 0x12,
+	0x7f, 0x4a, 0x85, 0xd0, 0x8b, 0xb8, 0x1e, 0x79, 0x91, 0xc3, 0x81, 0x03, 0x7f, 0x4a, 0xf5, 0x5f,
+	0xe7, 0xe0, 0xe6, 0x52, 0x42, 0x26, 0xb3, 0xaf, 0xef, 0xe9, 0x58, 0x6d, 0xa8, 0xc9, 0x7c, 0x50,
+	0xaa, 0x6b, 0x41, 0x88, 0xe9, 0x93, 0x95, 0xd4, 0x32, 0x8b, 0xef, 0x89, 0x98, 0x00, 0x72, 0x26,
+	0x6f, 0xeb, 0x4f, 0xa0, 0x28, 0x94, 0x7b, 0x03, 0x6a, 0xc7, 0x46, 0xc7, 0x36, 0xc9, 0x8b, 0x61,
+	0x6f, 0x60, 0x68, 0x6b, 0x3c, 0x17, 0xea, 0xf6, 0x54, 0x2f, 0x87, 0x1a, 0x50, 0x1d, 0x58, 0xf8,
+	0xc8, 0xee, 0x1a, 0x03, 0xee, 0x90, 0x08, 0xdc, 0xbf, 0x34, 0xe7, 0x44, 0x5f, 0x40, 0xf9, 0x2c,
+	0x65, 0xe5, 0x7e, 0x69, 0xf7, 0xb2, 0xed, 0xe1, 0x74, 0x82, 0xce, 0x60, 0x63, 0xe0, 0x9e, 0x4c,
+	0xa8, 0x11, 0xc7, 0xfe, 0x69, 0x30, 0xa5, 0x41, 0xb2, 0x60, 0xd7, 0xb9, 0x45, 0xbb, 0xbe, 0x0b,
+	0x30, 0x75, 0xfd, 0x80, 0x24, 0x7c, 0x8a, 0x4a, 0x6a, 0xab, 0x1c, 0x22, 0x68, 0xa0, 0x4f, 0xa0,
+	0x19, 0x8f, 0x18, 0x77, 0x0e, 0x12, 0x83, 0x17, 0x29, 0x85, 0x07, 0x45, 0xdc, 0x50, 0x50, 0x81,
+	0x15, 0xeb, 0xbf, 0x0f, 0xd7, 0x8d, 0xc9, 0x64, 0x69, 0xd9, 0x18, 0x1d, 0xc2, 0x35, 0x31, 0x8b,
+	0xb8, 0x67, 0x40, 0x75, 0xa0, 0x6c, 0x4a, 0xb1, 0x34, 0x0f, 0x6b, 0xc9, 0x12, 0x21, 0xfd, 0x4b,
+	0x5e, 0xd7, 0x30, 0xdf, 0x9d, 0xf8, 0x7f, 0x48, 0x3d, 0xfc, 0x7e, 0xd6, 0x77, 0x47, 0xaf, 0x68,
+	0x82, 0x34, 0x28, 0x44, 0xaf, 0xa4, 0xa1, 0xd5, 0x31, 0x6f, 0x22, 0x04, 0x45, 0x7f, 0x1a, 0xfb,
+	0x4a, 0xe4, 0xa2, 0xad, 0xef, 0xc1, 0x35, 0x89, 0xcf, 0x43, 0xab, 0x58, 0xcb, 0x16, 0xfa, 0x21,
+	0xb7, 0xa6, 0xf4, 0x69, 0x1d, 0x97, 0x13, 0x39, 0xa4, 0xff, 0x4f, 0x0e, 0xaa, 0xed, 0x78, 0x4a,
+	0x84, 0x43, 0x41, 0x9f, 0xa5, 0x8e, 0x48, 0x9a, 0xf3, 0xdd, 0xac, 0x39, 0xa7, 0x48, 0xbc, 0xb5,
+	0xe0, 0x85, 0xfe, 0x36, 0x07, 0x95, 0x14, 0xc6, 0xad, 0xd6, 0xb1, 0x1c, 0xc7, 0xee, 0x75, 0x89,
+	0xd1, 0x1a, 0xd8, 0xc7, 0x96, 0xb6, 0x86, 0x36, 0x01, 0xa5, 0xb0, 0xb9, 0x72, 0x98, 0x5a, 0x11,
+	0xdd, 0x87, 0xbb, 0xcb, 0x70, 0xde, 0x76, 0x5a, 0xcf, 0x2c, 0x73, 0xd8, 0xb1, 0x4c, 0x6d, 0x1d,
+	0xdd, 0x00, 0x2d, 0x45, 0xc1, 0x56, 0xc7, 0x32, 0x1c, 0xcb, 0xd4, 0x4a, 0x5c, 0xe7, 0x84, 0x97,
+	0xb3, 0xbb, 0x87, 0x5a, 0x99, 0x7b, 0x8d, 0xd4, 0xe7, 0x55, 0x10, 0x40, 0x49, 0xad, 0x5b, 0xe5,
+	0x68, 0x76, 0x57, 0xf5, 0x80, 0xa3, 0x29, 0x12, 0x5a, 0x4d, 0xff, 0x93, 0x1c, 0x80, 0xe3, 0x8d,
+	0xdb, 0xfe, 0x24, 0xa1, 0x2c, 0x46, 0x0f, 0x21, 0x3f, 0x4e, 0x4d, 0x6d, 0x7b, 0xc9, 0x87, 0x99,
+	0x94, 0x2b, 0x60, 0x94, 0x84, 0x0c, 0xe7, 0xc7, 0x1e, 0x17, 0x43, 0x92, 0x8c, 0x04, 0xcf, 0xeb,
+	0x98, 0x37, 0x39, 0x24, 0x8e, 0x7c, 0x61, 0x5a, 0x75, 0xcc, 0x9b, 0xa8, 0x09, 0xf9, 0xf1, 0x44,
+	0xb8, 0x8a, 0x3a, 0xce, 0x8f, 0x27, 0xe8, 0x26, 0x94, 0x62, 0x6f, 0xcc, 0xb9, 0xbf, 0x2e, 0xd2,
+	0x95, 0xf5, 0xd8, 0x1b, 0xdb, 0x9e, 0xfe, 0x07, 0xd0, 0x5c, 0x5c, 0x00, 0xfd, 0x68, 0x31, 0x7e,
+	0xdd, 0x5a, 0x15, 0xbf, 0xba, 0xf4, 0x6d, 0x1a, 0xc2, 0x1e, 0x42, 0x89, 0x07, 0x57, 0x95, 0x49,
+	0x36, 0xf7, 0xaf, 0x2d, 0x15, 0x96, 0x61, 0x80, 0x15, 0x82, 0xfe, 0xd7, 0x39, 0xe9, 0xba, 0x53,
+	0x12, 0x5c, 0x27, 0xfc, 0xe8, 0xcd, 0x13, 0x12, 0xb3, 0x51, 0x6a, 0x26, 0xbc, 0xef, 0xb0, 0xd1,
+	0x7c, 0xc8, 0x8b, 0x93, 0xd4, 0x9d, 0xf0, 0xbe, 0x19, 0x27, 0x3c, 0x4d, 0x13, 0x17, 0x07, 0xa3,
+	0x70, 0x72, 0xe6, 0x50, 0xaa, 0xb8, 0x9e, 0x02, 0x85, 0x8f, 0xd8, 0x86, 0x0a, 0x8f, 0x73, 0x51,
+	0xc8, 0x12, 0xc1, 0x84, 0x06, 0xe6, 0x71, 0xaf, 0x1f, 0x32, 0x61, 0x9c, 0x3c, 0x36, 0x8a, 0x21,
+	0xc9, 0x0b, 0x1e, 0x2b, 0xf9, 0x90, 0xfe, 0x4f, 0x39, 0xa8, 0x63, 0xea, 0xf9, 0x8c, 0x8e, 0x12,
+	0x3b, 0x18, 0x87, 0xe8, 0x39, 0xd4, 0x19, 0xf5, 0xb8, 0x57, 0x23, 0x99, 0x82, 0xee, 0xc1, 0x42,
+	0x1a, 0x7b, 0x86, 0x3e, 0xef, 0x70, 0xb7, 0x27, 0xdd, 0x17, 0xa3, 0x9e, 0xe1, 0x79, 0x62, 0x4b,
+	0xbf, 0x05, 0x1b, 0x9c, 0x16, 0x0f, 0xd3, 0x94, 0x65, 0x1d, 0x65, 0x83, 0x51, 0xcf, 0x11, 0x50,
+	0x3e, 0x4f, 0x3f, 0x04, 0x6d, 0x99, 0x0e, 0xaa, 0x40, 0xd1, 0xee, 0x1f, 0x3f, 0xd1, 0xd6, 0x54,
+	0xeb, 0x40, 0xcb, 0xa1, 0x32, 0x14, 0x86, 0xb8, 0xa3, 0xe5, 0xb9, 0xbe, 0x39, 0x76, 0x7f, 0x88,
+	0x6d, 0xad, 0xc0, 0xdb, 0x1c, 0xf1, 0xf8, 0x40, 0x2b, 0xea, 0xa7, 0x70, 0xbd, 0x37, 0x4b, 0x28,
+	0x7b, 0x46, 0x5d, 0x8f, 0xb2, 0x16, 0xa3, 0x2e, 0x17, 0x03, 0xd7, 0x84, 0x90, 0x24, 0x54, 0xd9,
+	0x61, 0x03, 0xaf, 0x87, 0x03, 0xea, 0x7b, 0x68, 0x17, 0xea, 0xa7, 0xc1, 0x09, 0x11, 0x5c, 0x77,
+	0xe7, 0x7b, 0x83, 0xd3, 0xe0, 0xc4, 0x8e, 0xde, 0x3c, 0x31, 0x64, 0x98, 0xe1, 0x4c, 0x23, 0x41,
+	0x28, 0x58, 0xde, 0xc0, 0x25, 0xde, 0xed, 0x86, 0xfa, 0x3f, 0x73, 0xeb, 0x7b, 0xeb, 0xf5, 0x5d,
+	0xe6, 0x4e, 0xb9, 0x83, 0xf3, 0x78, 0xe2, 0xef, 0x8f, 0xdd, 0x11, 0x55, 0x4b, 0x54, 0x39, 0xc4,
+	0xe6, 0x00, 0x9e, 0xbc, 0x04, 0x34, 0x21, 0x7e, 0x10, 0x27, 0x6e, 0x30, 0x4a, 0xd3, 0x9e, 0x5a,
+	0x40, 0x13, 0x5b, 0x81, 0xd0, 0xcf, 0x80, 0x73, 0x44, 0x30, 0x80, 0xf8, 0xc1, 0x38, 0x54, 0xc5,
+	0xc3, 0xad, 0x0b, 0xb8, 0x8e, 0xeb, 0x2c, 0x2b, 0xb2, 0x5f, 0x40, 0x3d, 0x9c, 0x25, 0x8c, 0x7c,
+	0x43, 0x5d, 0x8f, 0x8c, 0x64, 0xb4, 0xac, 0x2d, 0x64, 0x05, 0x2b, 0x98, 0x82, 0x81, 0xcf, 0xe1,
+	0xb0, 0x16, 0xd3, 0x1f, 0x42, 0xc5, 0x9c, 0x45, 0x57, 0x39, 0x0d, 0x77, 0x5d, 0x85, 0xbe, 0x69,
+	0x73, 0x9d, 0xe4, 0x3a, 0xe5, 0x07, 0x09, 0x65, 0x19, 0xcc, 0x7a, 0xcc, 0x46, 0x76, 0x0a, 0xe3,
+	0x1c, 0x9e, 0x84, 0x23, 0x77, 0x42, 0xc6, 0x92, 0xfd, 0xb2, 0xf4, 0x02, 0x01, 0x6b, 0x0b, 0x19,
+	0x2c, 0x33, 0xa7, 0x70, 0x9e, 0x39, 0x3b, 0x50, 0x9d, 0x51, 0x22, 0x0a, 0xa3, 0x34, 0x13, 0x28,
+	0xcf, 0xa8, 0x1d, 0x71, 0x01, 0x6d, 0x41, 0x25, 0x61, 0x84, 0x46, 0xa9, 0x95, 0xd7, 0x71, 0x29,
+	0x61, 0x56, 0x64, 0x7b, 0xe8, 0x00, 0x6a, 0xdc, 0xfa, 0xc7, 0xd2, 0xd7, 0xa8, 0x42, 0x39, 0x7b,
+	0x27, 0x70, 0xe6, 0x88, 0x30, 0xc4, 0x67, 0x4e, 0xe9, 0x26, 0x94, 0x78, 0x20, 0xf3, 0x3d, 0x91,
+	0x16, 0x56, 0xf1, 0xba, 0x1b, 0x45, 0xb6, 0xa7, 0xff, 0x5b, 0x01, 0x6a, 0x0e, 0x4d, 0x0e, 0x59,
+	0x38, 0x8b, 0xfa, 0x26, 0xe6, 0x68, 0x91, 0xc7, 0xc8, 0x99, 0x4a, 0x45, 0x1e, 0xb3, 0x3d, 0xf4,
+	0x11, 0xd4, 0x38, 0x38, 0x5b, 0x6a, 0xae, 0x63, 0x88, 0x3c, 0xa6, 0xaa, 0x1f, 0x74, 0x0f, 0x20,
+	0x62, 0x74, 0x44, 0x3d, 0x9a, 0x9e, 0xb6, 0x81, 0x33, 0x10, 0xf4, 0x3b, 0x50, 0xe5, 0x04, 0x64,
+	0x3c, 0x28, 0x0a, 0xdb, 0xbb, 0x9e, 0xbd, 0xc8, 0xf0, 0x98, 0x8c, 0x02, 0x95, 0x48, 0xb5, 0xd0,
+	0x2e, 0x14, 0x22, 0xcf, 0x57, 0x17, 0x09, 0xcd, 0x2c, 0xae, 0x69, 0x63, 0x3e, 0x84, 0xee, 0x43,
+	0x23, 0x24, 0xdf, 0x10, 0x5e, 0x03, 0x12, 0x8f, 0xc6, 0x32, 0x0f, 0x6e, 0x60, 0x08, 0x9f, 0x61,
+	0x3a, 0x0d, 0xb9, 0x23, 0x44, 0x0f, 0x40, 0x13, 0x05, 0x03, 0x25, 0x11, 0xb7, 0x58, 0x71, 0x8d,
+	0x22, 0xcf, 0xdf, 0x94, 0xf0, 0x3e, 0xa3, 0x1e, 0xaf, 0x56, 0xd0, 0x13, 0x80, 0x98, 0x26, 0xe4,
+	0x94, 0x91, 0xb1, 0xcb, 0x44, 0x21, 0x58, 0xdb, 0xdf, 0x5c, 0xbc, 0x76, 0x12, 0x4c, 0x6a, 0x1b,
+	0x18, 0x57, 0x62, 0xde, 0x69, 0xbb, 0x0c, 0xbd, 0x80, 0xeb, 0xde, 0xbc, 0x24, 0x11, 0xa5, 0x29,
+	0x61, 0xf4, 0xb5, 0xb8, 0x44, 0xa8, 0xed, 0xdf, 0xff, 0x50, 0xe1, 0x22, 0x6f, 0xc8, 0xae, 0x79,
+	0x0b, 0x70, 0x4c, 0x5f, 0xa3, 0x5f, 0xc2, 0xb5, 0xf3, 0x04, 0x41, 0x10, 0xbc, 0xf4, 0xaa, 0x6f,
+	0x63, 0x89, 0x98, 0xfe, 0x0f, 0xb9, 0x33, 0xf1, 0xb6, 0x0d, 0x21, 0xde, 0xb1, 0x9b, 0x15, 0xef,
+	0xd8, 0xe5, 0xe2, 0xfd, 0x05, 0x5c, 0xe7, 0x60, 0xe9, 0xdd, 0x49, 0x12, 0x12, 0x37, 0x8a, 0x26,
+	0xef, 0x45, 0x61, 0xb7, 0x32, 0x0e, 0x68, 0x63, 0x97, 0xc9, 0xe6, 0x20, 0x34, 0x38, 0x2a, 0xda,
+	0x83, 0xca, 0xf8, 0xad, 0x47, 0x22, 0x97, 0x4d, 0x95, 0x91, 0x67, 0xc5, 0x9b, 0xba, 0x14, 0x5c,
+	0x1e, 0x8b, 0xd6, 0x94, 0xe3, 0x7b, 0x33, 0x8e, 0xee, 0x4e, 0x95, 0x5d, 0x67, 0xf1, 0x53, 0xa3,
+	0xc5, 0x65, 0x6f, 0x26, 0x1a, 0xfa, 0x5f, 0xe4, 0x01, 0x1c, 0x79, 0x5f, 0xed, 0x50, 0x11, 0x39,
+	0xce, 0xee, 0xa6, 0xcf, 0xca, 0xe8, 0xfa, 0x19, 0xd0, 0xf6, 0xae, 0x60, 0xa5, 0x9f, 0xc2, 0x46,
+	0x7a, 0x09, 0x9e, 0xad, 0x9e, 0x1b, 0xb8, 0xa9, 0xc0, 0xa9, 0x7a, 0x3f, 0x82, 0x72, 0x10, 0x7a,
+	0x22, 0xe5, 0x91, 0xbb, 0xcd, 0x32, 0xa5, 0x1b, 0x7a, 0xd4, 0x36, 0x71, 0x89, 0x63, 0xd8, 0x1e,
+	0x2f, 0x1b, 0xa5, 0x9a, 0xaf, 0x9f, 0x2f, 0x1b, 0xd3, 0xb4, 0x47, 0x65, 0x3b, 0x19, 0xad, 0x8b,
+	0x3c, 0xb6, 0x55, 0x12, 0xf9, 0xdd, 0x2a, 0xad, 0xeb, 0x9b, 0xa9, 0xd6, 0xf5, 0x3d, 0xa6, 0xff,
+	0x7b, 0x0e, 0x36, 0x87, 0xfd, 0xb6, 0xe2, 0x47, 0x2b, 0x0c, 0x12, 0xfa, 0x2e, 0x91, 0x56, 0xf3,
+	0x63, 0x80, 0x91, 0x3b, 0x8b, 0xa9, 0x74, 0xb7, 0x32, 0xf0, 0xa3, 0x0c, 0xc1, 0x16, 0x1f, 0xb4,
+	0x2d, 0x5c, 0x15, 0x58, 0xc2, 0xcd, 0x5a, 0xa0, 0xa5, 0x4c, 0x88, 0x03, 0x37, 0x8a, 0xbf, 0x09,
+	0x65, 0xa0, 0x5e, 0xcc, 0x34, 0xcf, 0xd6, 0x93, 0x86, 0x9a, 0x32, 0xce, 0x51, 0x53, 0x90, 0x0d,
+	0x1b, 0x63, 0xd7, 0x9f, 0xcc, 0x18, 0x25, 0xe9, 0xdd, 0x46, 0xe1, 0x9c, 0x19, 0xb4, 0x25, 0x06,
+	0xb7, 0x38, 0xbe, 0x36, 0x9b, 0x4a, 0x9f, 0xdd, 0x18, 0x67, 0xe0, 0x9e, 0xfe, 0x57, 0x45, 0x28,
+	0xab, 0x8d, 0xa2, 0x9f, 0x42, 0x45, 0x1d, 0x88, 0xae, 0x28, 0x0b, 0x15, 0x96, 0xfc, 0x1e, 0xbb,
+	0x93, 0x19, 0x8d, 0x71, 0x59, 0x1e, 0x8d, 0xea, 0xff, 0x5a, 0x80, 0x5a, 0x66, 0x80, 0x67, 0x70,
+	0xd8, 0x72, 0x2c, 0x7c, 0x2c, 0xea, 0xd9, 0x1b, 0xa0, 0x61, 0xeb, 0xc5, 0xd0, 0x72, 0x06, 0xc4,
+	0x68, 0xb5, 0xac, 0x3e, 0xcf, 0xf8, 0x72, 0xe8, 0x1e, 0xec, 0xa4, 0x50, 0x6c, 0x3d, 0xb7, 0x5a,
+	0xbc, 0x5e, 0xec, 0xf6, 0x08, 0xb6, 0x0c, 0x47, 0x54, 0xb1, 0x77, 0x61, 0x3b, 0x4d, 0x21, 0x5b,
+	0xbd, 0xee, 0xc0, 0x7a, 0x39, 0x20, 0xdd, 0xde, 0x80, 0xb4, 0x7b, 0xc3, 0xae, 0xa9, 0x15, 0xd0,
+	0x16, 0xdc, 0x38, 0x32, 0xba, 0xa6, 0x31, 0xe8, 0xe1, 0xaf, 0x89, 0x6d, 0x91, 0x23, 0xdb, 0x71,
+	0x78, 0x5e, 0x59, 0x44, 0x3b, 0xb0, 0xd9, 0xea, 0x75, 0x4d, 0x9b, 0x27, 0xa5, 0x46, 0x27, 0x3b,
+	0xb6, 0xce, 0xd3, 0x5c, 0xbb, 0x2b, 0x0b, 0xa1, 0x8e, 0xd5, 0x3d, 0x1c, 0x3c, 0xd3, 0x4a, 0x1c,
+	0x7f, 0x81, 0x92, 0xdd, 0x6d, 0xf5, 0x30, 0xb6, 0x5a, 0x03, 0xad, 0xcc, 0x37, 0x91, 0xe2, 0xb7,
+	0x7b, 0xf8, 0x2b, 0x03, 0x9b, 0x76, 0xf7, 0x90, 0xf4, 0x7b, 0x1d, 0xbb, 0xf5, 0xb5, 0x56, 0x41,
+	0x3f, 0x80, 0xdd, 0xf9, 0x30, 0x19, 0x58, 0xb6, 0x49, 0x8c, 0x4e, 0xa7, 0x27, 0x0b, 0x71, 0xd2,
+	0xeb, 0x8b, 0x7a, 0xbc, 0x8a, 0x3e, 0x86, 0x8f, 0xba, 0x3d, 0x62, 0x39, 0x03, 0xe3, 0x69, 0xc7,
+	0x76, 0x9e, 0x59, 0x26, 0xe9, 0xb7, 0x5b, 0x7d, 0x62, 0x38, 0x4e, 0xaf, 0x65, 0xcb, 0xa2, 0x1d,
+	0xd0, 0x43, 0xf8, 0x04, 0x0f, 0x3b, 0x96, 0xbc, 0x06, 0x10, 0xd3, 0x31, 0x39, 0xea, 0x99, 0xf3,
+	0xba, 0x9e, 0xa4, 0x15, 0x76, 0x0d, 0xdd, 0x81, 0x2d, 0x41, 0xc0, 0xea, 0x0e, 0xf8, 0x8e, 0x05,
+	0x7f, 0x0e, 0x2d, 0x47, 0x10, 0xaa, 0xf3, 0xe3, 0x08, 0x36, 0x3a, 0xbd, 0x21, 0x6e, 0x59, 0x0e,
+	0x31, 0x8e, 0x0d, 0xbb, 0x63, 0x3c, 0xed, 0x58, 0x5a, 0x03, 0x6d, 0xc3, 0x4d, 0x2e, 0x15, 0xbb,
+	0x65, 0x09, 0x5e, 0x3a, 0xc3, 0x7e, 0xbf, 0x87, 0xb9, 0x38, 0x9a, 0xa2, 0x00, 0xf8, 0xda, 0x19,
+	0x58, 0x47, 0xf3, 0x85, 0x36, 0xf4, 0xa7, 0xb0, 0xb9, 0x5a, 0x8d, 0xd0, 0x03, 0x1e, 0x32, 0x98,
+	0x2a, 0x93, 0xb2, 0x66, 0xd4, 0x1b, 0x8f, 0x69, 0xe0, 0xf9, 0xc1, 0xa9, 0x6d, 0xf1, 0xd0, 0xc1,
+	0xf4, 0xff, 0xcc, 0x41, 0x2d, 0x03, 0xe4, 0xe1, 0xcb, 0xf7, 0x68, 0x90, 0xf8, 0x63, 0x9f, 0x32,
+	0xe5, 0x1b, 0x33, 0x90, 0x8b, 0xaf, 0x59, 0xd1, 0x57, 0xb0, 0xf5, 0x3a, 0x8c, 0x09, 0xe5, 0xdb,
+	0x18, 0x29, 0xd5, 0x4f, 0x2f, 0xc6, 0x0a, 0xe7, 0x12, 0x96, 0x15, 0x17, 0x6a, 0xf8, 0xe6, 0xeb,
+	0x30, 0xb6, 0xe4, 0x74, 0x71, 0x93, 0x2f, 0x27, 0xa3, 0x67, 0xb0, 0xe1, 0xd1, 0x09, 0x79, 0x4d,
+	0xd9, 0x9c, 0x9e, 0x74, 0x3d, 0xbb, 0x97, 0xdd, 0x87, 0xe1, 0x86, 0x47, 0x27, 0x2f, 0x28, 0x53,
+	0x94, 0xf4, 0x7f, 0xcc, 0x43, 0xc5, 0xee, 0x8b, 0xe2, 0xa0, 0xc3, 0xd3, 0x20, 0xee, 0x71, 0x84,
+	0xe7, 0x8d, 0xd3, 0x34, 0x28, 0xa6, 0x89, 0x70, 0xb3, 0x31, 0xf7, 0x99, 0xc9, 0x28, 0x22, 0xf3,
+	0x8c, 0x5b, 0xf9, 0xcc, 0x64, 0x14, 0x99, 0x2a, 0xe9, 0x56, 0x18, 0xf3, 0xc4, 0xbb, 0x30, 0xc7,
+	0x70, 0x64, 0xee, 0xcd, 0x31, 0x66, 0x5e, 0x86, 0x86, 0xcc, 0xda, 0x61, 0xe6, 0x65, 0x69, 0x70,
+	0x8c, 0xa5, 0xe4, 0x9d, 0x63, 0xa4, 0x34, 0x44, 0xd5, 0x40, 0x44, 0x21, 0xa0, 0xc2, 0x7a, 0xd9,
+	0x8f, 0xfa, 0xe2, 0x65, 0xf4, 0x87, 0x50, 0x12, 0x19, 0x5a, 0x24, 0x22, 0xf9, 0xa2, 0x83, 0xb5,
+	0xfb, 0x3c, 0xd1, 0xa6, 0x71, 0x8c, 0xd7, 0x79, 0xc2, 0x16, 0xa1, 0x1f, 0x41, 0x59, 0x66, 0x7d,
+	0x91, 0x8a, 0xe9, 0xab, 0xb1, 0x4b, 0x22, 0x11, 0x8c, 0x96, 0xd2, 0x98, 0xea, 0x72, 0x1a, 0xa3,
+	0xff, 0x3a, 0x07, 0xcd, 0xa1, 0x95, 0x75, 0x84, 0xa8, 0x07, 0x1b, 0x33, 0x4a, 0x46, 0x61, 0x30,
+	0xf6, 0x4f, 0x49, 0xb6, 0xde, 0xfd, 0x74, 0xe1, 0xf5, 0x2f, 0x3b, 0x67, 0x6f, 0x68, 0xb5, 0x04,
+	0xbe, 0x74, 0xa5, 0x8d, 0x19, 0xcd, 0x74, 0xf5, 0x77, 0xd0, 0x58, 0x18, 0xcf, 0x54, 0xa1, 0x6b,
+	0x48, 0x83, 0xfa, 0xb0, 0x8b, 0xad, 0x43, 0xdb, 0x19, 0x58, 0x58, 0x78, 0x2c, 0x0d, 0xea, 0x76,
+	0xd7, 0x19, 0x18, 0x9d, 0x0e, 0xb1, 0xcd, 0x8e, 0xa5, 0xe5, 0xb9, 0xd1, 0x0c, 0xbb, 0x0b, 0xb0,
+	0x82, 0x30, 0xa4, 0xa1, 0xd3, 0xb7, 0xba, 0xa6, 0x65, 0x12, 0xd3, 0x18, 0x18, 0x5a, 0x11, 0x6d,
+	0x40, 0x0d, 0x5b, 0xce, 0xf0, 0xc8, 0x92, 0x80, 0x75, 0xfd, 0x7f, 0x0b, 0x50, 0x3f, 0xdb, 0x29,
+	0x4d, 0x78, 0xfe, 0x7e, 0x3e, 0xcc, 0x7e, 0xe0, 0xfe, 0x68, 0x31, 0xfe, 0x2e, 0x32, 0x33, 0x7f,
+	0x2e, 0x27, 0xfc, 0x99, 0xe0, 0x9c, 0x2a, 0x53, 0x84, 0x1c, 0x94, 0xc5, 0xac, 0x96, 0x51, 0x83,
+	0x27, 0xc7, 0xbc, 0x7e, 0x11, 0xdd, 0xb3, 0xd9, 0x07, 0xf3, 0xd9, 0xc5, 0x4b, 0x67, 0x1f, 0xa4,
+	0xb3, 0xbf, 0x80, 0x26, 0x15, 0x35, 0xd2, 0x7c, 0xf2, 0xfa, 0x07, 0x26, 0xd7, 0x29, 0xaf, 0x9d,
+	0xd2, 0xb9, 0x1a, 0x14, 0xdc, 0x28, 0x50, 0xb7, 0xae, 0xbc, 0x89, 0x10, 0x14, 0xdf, 0x4c, 0xdc,
+	0x40, 0x3d, 0x33, 0x88, 0xb6, 0x78, 0xf4, 0x08, 0x64, 0xe2, 0x21, 0x9f, 0x15, 0x4a, 0x7e, 0x20,
+	0x92, 0x8e, 0x6d, 0xa8, 0x84, 0xb3, 0x44, 0x8e, 0x48, 0x0d, 0x2b, 0x87, 0xb3, 0x44, 0x0c, 0xb5,
+	0x40, 0x9b, 0x51, 0x32, 0x8f, 0xc6, 0x42, 0x99, 0xe0, 0xdc, 0x3d, 0xc2, 0xa2, 0x32, 0xe1, 0xe6,
+	0x8c, 0x2e, 0x28, 0xe4, 0x8f, 0x01, 0x7c, 0xf9, 0x4c, 0x42, 0xbc, 0xc9, 0x56, 0xe3, 0x5c, 0x72,
+	0x95, 0xba, 0x02, 0x5c, 0xf1, 0xc5, 0x73, 0x89, 0x39, 0xd1, 0xff, 0x3b, 0x07, 0x5b, 0x73, 0xaa,
+	0x2a, 0x9f, 0x98, 0x5f, 0xcb, 0xae, 0x10, 0x53, 0xee, 0x3b, 0x89, 0x29, 0x7f, 0x75, 0x31, 0x7d,
+	0x02, 0xcd, 0x30, 0xa2, 0xcc, 0x95, 0x79, 0x69, 0x7a, 0x45, 0xd0, 0xc0, 0x8d, 0x39, 0x54, 0x14,
+	0xd5, 0x8b, 0x59, 0x4f, 0xf1, 0x0a, 0x59, 0x8f, 0xfe, 0x0c, 0xae, 0x65, 0x55, 0xfd, 0xa9, 0xb8,
+	0x02, 0xf9, 0x0c, 0x2a, 0x8a, 0xf9, 0xe9, 0x65, 0xdb, 0xad, 0x95, 0x7c, 0xa7, 0x09, 0x9e, 0x23,
+	0xea, 0x27, 0x70, 0xf7, 0x22, 0xde, 0x49, 0xaa, 0x06, 0x54, 0x99, 0x02, 0xa4, 0x64, 0x3f, 0x5e,
+	0x45, 0x76, 0x69, 0x32, 0x3e, 0x9b, 0xa5, 0x3f, 0x87, 0x8d, 0x43, 0x2a, 0x52, 0xbc, 0xf9, 0x23,
+	0xde, 0x26, 0x94, 0x46, 0x61, 0xf8, 0xca, 0x4f, 0x2b, 0x54, 0xd5, 0xe3, 0xa5, 0x9a, 0x6c, 0x91,
+	0xa9, 0x1b, 0xbf, 0x4a, 0xcd, 0x4e, 0x82, 0x8e, 0xdc, 0xf8, 0xd5, 0xa3, 0x2f, 0xa0, 0x24, 0x73,
+	0x77, 0x54, 0x81, 0xa2, 0x89, 0x7b, 0x7d, 0x79, 0x17, 0xc1, 0x33, 0x09, 0x2d, 0xc7, 0x5b, 0x4f,
+	0x87, 0xed, 0xb6, 0x96, 0xe7, 0xad, 0x6e, 0xaf, 0xd5, 0xd7, 0x0a, 0x02, 0x6f, 0xd8, 0xef, 0x68,
+	0xc5, 0x47, 0x9f, 0xc3, 0x75, 0x27, 0x9c, 0xb1, 0x11, 0x9d, 0xd7, 0xc2, 0x82, 0xff, 0xc2, 0x43,
+	0xa9, 0x6b, 0xf7, 0x0a, 0x14, 0x5b, 0x3d, 0x71, 0xe7, 0x0e, 0x50, 0x72, 0x0e, 0xfd, 0x8e, 0xd1,
+	0xd5, 0xf2, 0x8f, 0x7e, 0x04, 0x95, 0xb4, 0xc6, 0x43, 0x35, 0x28, 0x2b, 0xef, 0xa4, 0xad, 0x71,
+	0x24, 0x6c, 0x1d, 0xf5, 0x8e, 0x2d, 0xb9, 0xb6, 0x74, 0x61, 0xfb, 0xff, 0x51, 0x83, 0x6a, 0x3f,
+	0xfd, 0x23, 0x06, 0xbd, 0x84, 0x5b, 0xd9, 0x7f, 0x33, 0x38, 0x9f, 0x58, 0x38, 0x99, 0xf0, 0xb2,
+	0xf6, 0xde, 0xf2, 0x9f, 0x01, 0x8b, 0xff, 0x6f, 0xec, 0xdc, 0xfe, 0xc0, 0x9f, 0x03, 0xfa, 0x1a,
+	0xea, 0x40, 0xd3, 0xa1, 0x89, 0x73, 0x94, 0xe6, 0xb6, 0x31, 0x5a, 0x28, 0xa5, 0xe7, 0xe2, 0xde,
+	0xb9, 0xbf, 0x32, 0x15, 0xce, 0xa6, 0xde, 0xfa, 0x1a, 0xea, 0xab, 0x5f, 0x19, 0xe4, 0x4b, 0xa0,
+	0x7c, 0x8a, 0xbc, 0xbb, 0xbc, 0x81, 0x85, 0xff, 0x39, 0x2e, 0xdb, 0x1f, 0x86, 0xc6, 0x42, 0xca,
+	0x80, 0x2e, 0x2b, 0x01, 0x77, 0x2e, 0xc9, 0x36, 0xf4, 0x35, 0xf4, 0x12, 0x36, 0x96, 0xd2, 0x06,
+	0x74, 0x79, 0xa5, 0xba, 0x73, 0x69, 0xd6, 0xa1, 0xaf, 0x21, 0x03, 0x9a, 0x87, 0x34, 0x91, 0x07,
+	0x1c, 0xc6, 0xee, 0x29, 0x45, 0x69, 0x99, 0x24, 0xfe, 0x60, 0xda, 0x3b, 0x0e, 0x7d, 0x6f, 0x67,
+	0x67, 0xe9, 0x9d, 0x10, 0xd3, 0x51, 0xc8, 0x3c, 0x71, 0xb9, 0xac, 0xaf, 0x21, 0x13, 0x2a, 0xa9,
+	0xa2, 0xa3, 0x2c, 0xe6, 0x92, 0xf6, 0x5f, 0x42, 0xe5, 0xe7, 0x00, 0xe2, 0x3e, 0x48, 0xec, 0x0f,
+	0x6d, 0xae, 0x7e, 0x01, 0xdb, 0xb9, 0x75, 0xc1, 0xfb, 0x92, 0x24, 0x80, 0xc5, 0xd3, 0xf2, 0x6f,
+	0x4a, 0xc0, 0x84, 0x0d, 0xf9, 0xba, 0x90, 0x3e, 0xa9, 0xc5, 0xbf, 0x09, 0x95, 0x2e, 0x6c, 0x9c,
+	0xfd, 0x9a, 0x23, 0x45, 0x75, 0x67, 0x59, 0x61, 0xb2, 0xbf, 0xed, 0x5c, 0xa6, 0x4e, 0x14, 0x76,
+	0x2e, 0x7e, 0x41, 0x41, 0xdf, 0xea, 0xe7, 0x9e, 0xab, 0x6c, 0x7b, 0xfe, 0xb8, 0xb6, 0x62, 0xdb,
+	0xd9, 0x5f, 0xa7, 0x2e, 0xdb, 0x76, 0x1b, 0xea, 0x86, 0xe7, 0xcd, 0xa9, 0xa1, 0x0f, 0xfd, 0x57,
+	0xf5, 0xa1, 0x7d, 0xd9, 0x5c, 0xf3, 0x27, 0x34, 0xa1, 0xdf, 0x0b, 0x29, 0xc9, 0x22, 0xbb, 0xdf,
+	0xb6, 0x5f, 0x7e, 0x27, 0x52, 0xbf, 0x84, 0xcd, 0x43, 0x9a, 0xac, 0x7a, 0x04, 0x5a, 0x61, 0x3d,
+	0x0b, 0xe6, 0xbd, 0x62, 0xca, 0x11, 0x34, 0xe4, 0xbe, 0x86, 0x96, 0x14, 0xea, 0x45, 0x01, 0x6c,
+	0xe7, 0x2a, 0x21, 0x08, 0xfd, 0x0a, 0xd0, 0x02, 0x39, 0x19, 0xd0, 0xee, 0x5c, 0x40, 0x53, 0x8c,
+	0xee, 0x3c, 0xb8, 0x02, 0x61, 0x81, 0xf9, 0xf4, 0xf6, 0xef, 0x6d, 0x0b, 0xd4, 0xc7, 0x93, 0x84,
+	0x3e, 0x1e, 0x4d, 0xc2, 0x99, 0xf7, 0xf8, 0x34, 0x54, 0x3f, 0x17, 0x9e, 0x94, 0xc4, 0xf7, 0xb3,
+	0xff, 0x0b, 0x00, 0x00, 0xff, 0xff, 0x53, 0x64, 0x78, 0x03, 0x25, 0x29, 0x00, 0x00,
 }
 
 // Reference imports to suppress errors if they are not otherwise used.
@@ -3459,6 +3545,7 @@ type PipelinedClient interface {
 	// and name
 	GetAllTableAssignments(ctx context.Context, in *protos.Void, opts ...grpc.CallOption) (*AllTableAssignments, error)
 	UpdateUEState(ctx context.Context, in *UESessionSet, opts ...grpc.CallOption) (*UESessionContextResponse, error)
+	UpdateUEStateBatch(ctx context.Context, in *UESessionSetBatch, opts ...grpc.CallOption) (*UESessionContextResponseBatch, error)
 }
 
 type pipelinedClient struct {
@@ -3631,6 +3718,15 @@ func (c *pipelinedClient) UpdateUEState(ctx context.Context, in *UESessionSet, o
 	return out, nil
 }
 
+func (c *pipelinedClient) UpdateUEStateBatch(ctx context.Context, in *UESessionSetBatch, opts ...grpc.CallOption) (*UESessionContextResponseBatch, error) {
+	out := new(UESessionContextResponseBatch)
+	err := c.cc.Invoke(ctx, "/magma.lte.Pipelined/UpdateUEStateBatch", in, out, opts...)
+	if err != nil {
+		return nil, err
+	}
+	return out, nil
+}
+
 // PipelinedServer is the server API for Pipelined service.
 type PipelinedServer interface {
 	// Setup pipelined basic controllers
@@ -3667,6 +3763,7 @@ type PipelinedServer interface {
 	// and name
 	GetAllTableAssignments(context.Context, *protos.Void) (*AllTableAssignments, error)
 	UpdateUEState(context.Context, *UESessionSet) (*UESessionContextResponse, error)
+	UpdateUEStateBatch(context.Context, *UESessionSetBatch) (*UESessionContextResponseBatch, error)
 }
 
 // UnimplementedPipelinedServer can be embedded to have forward compatible implementations.
@@ -3727,6 +3824,9 @@ func (*UnimplementedPipelinedServer) GetAllTableAssignments(ctx context.Context,
 func (*UnimplementedPipelinedServer) UpdateUEState(ctx context.Context, req *UESessionSet) (*UESessionContextResponse, error) {
 	return nil, status.Errorf(codes.Unimplemented, "method UpdateUEState not implemented")
 }
+func (*UnimplementedPipelinedServer) UpdateUEStateBatch(ctx context.Context, req *UESessionSetBatch) (*UESessionContextResponseBatch, error) {
+	return nil, status.Errorf(codes.Unimplemented, "method UpdateUEStateBatch not implemented")
+}
 
 func RegisterPipelinedServer(s *grpc.Server, srv PipelinedServer) {
 	s.RegisterService(&_Pipelined_serviceDesc, srv)
@@ -4056,6 +4156,24 @@ func _Pipelined_UpdateUEState_Handler(srv interface{}, ctx context.Context, dec
 	return interceptor(ctx, in, info, handler)
 }
 
+func _Pipelined_UpdateUEStateBatch_Handler(srv interface{}, ctx context.Context, dec func(interface{}) error, interceptor grpc.UnaryServerInterceptor) (interface{}, error) {
+	in := new(UESessionSetBatch)
+	if err := dec(in); err != nil {
+		return nil, err
+	}
+	if interceptor == nil {
+		return srv.(PipelinedServer).UpdateUEStateBatch(ctx, in)
+	}
+	info := &grpc.UnaryServerInfo{
+		Server:     srv,
+		FullMethod: "/magma.lte.Pipelined/UpdateUEStateBatch",
+	}
+	handler := func(ctx context.Context, req interface{}) (interface{}, error) {
+		return srv.(PipelinedServer).UpdateUEStateBatch(ctx, req.(*UESessionSetBatch))
+	}
+	return interceptor(ctx, in, info, handler)
+}
+
 var _Pipelined_serviceDesc = grpc.ServiceDesc{
 	ServiceName: "magma.lte.Pipelined",
 	HandlerType: (*PipelinedServer)(nil),
@@ -4132,6 +4250,10 @@ var _Pipelined_serviceDesc = grpc.ServiceDesc{
 			MethodName: "UpdateUEState",
 			Handler:    _Pipelined_UpdateUEState_Handler,
 		},
+		{
+			MethodName: "UpdateUEStateBatch",
+			Handler:    _Pipelined_UpdateUEStateBatch_Handler,
+		},
 	},
 	Streams:  []grpc.StreamDesc{},
 	Metadata: "lte/protos/pipelined.proto",
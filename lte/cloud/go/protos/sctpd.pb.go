@@ -312,6 +312,159 @@ func (m *SendDlRes) GetResult() SendDlRes_SendDlResult {
 	return SendDlRes_SEND_DL_UNKNOWN
 }
 
+// SendDlTarget - association and stream a batched payload is sent on
+type SendDlTarget struct {
+	AssocId              uint32   `protobuf:"varint,1,opt,name=assoc_id,json=assocId,proto3" json:"assoc_id,omitempty"`
+	Stream               uint32   `protobuf:"varint,2,opt,name=stream,proto3" json:"stream,omitempty"`
+	PayloadIndex         uint32   `protobuf:"varint,3,opt,name=payload_index,json=payloadIndex,proto3" json:"payload_index,omitempty"`
+	XXX_NoUnkeyedLiteral struct{} `json:"-"`
+	XXX_unrecognized     []byte   `json:"-"`
+	XXX_sizecache        int32    `json:"-"`
+}
+
+func (m *SendDlTarget) Reset()         { *m = SendDlTarget{} }
+func (m *SendDlTarget) String() string { return proto.CompactTextString(m) }
+func (*SendDlTarget) ProtoMessage()    {}
+func (*SendDlTarget) Descriptor() ([]byte, []int) {
+	return fileDescriptor_4b79271ac29ed95c, []int{4}
+}
+
+func (m *SendDlTarget) XXX_Unmarshal(b []byte) error {
+	return xxx_messageInfo_SendDlTarget.Unmarshal(m, b)
+}
+func (m *SendDlTarget) XXX_Marshal(b []byte, deterministic bool) ([]byte, error) {
+	return xxx_messageInfo_SendDlTarget.Marshal(b, m, deterministic)
+}
+func (m *SendDlTarget) XXX_Merge(src proto.Message) {
+	xxx_messageInfo_SendDlTarget.Merge(m, src)
+}
+func (m *SendDlTarget) XXX_Size() int {
+	return xxx_messageInfo_SendDlTarget.Size(m)
+}
+func (m *SendDlTarget) XXX_DiscardUnknown() {
+	xxx_messageInfo_SendDlTarget.DiscardUnknown(m)
+}
+
+var xxx_messageInfo_SendDlTarget proto.InternalMessageInfo
+
+func (m *SendDlTarget) GetAssocId() uint32 {
+	if m != nil {
+		return m.AssocId
+	}
+	return 0
+}
+
+func (m *SendDlTarget) GetStream() uint32 {
+	if m != nil {
+		return m.Stream
+	}
+	return 0
+}
+
+func (m *SendDlTarget) GetPayloadIndex() uint32 {
+	if m != nil {
+		return m.PayloadIndex
+	}
+	return 0
+}
+
+// SendDlBatchReq - requests downlink packets to be sent to several eNBs,
+// identical payloads are carried once and referenced by index
+type SendDlBatchReq struct {
+	Ppid                 uint32          `protobuf:"varint,1,opt,name=ppid,proto3" json:"ppid,omitempty"`
+	Payloads             [][]byte        `protobuf:"bytes,2,rep,name=payloads,proto3" json:"payloads,omitempty"`
+	Targets              []*SendDlTarget `protobuf:"bytes,3,rep,name=targets,proto3" json:"targets,omitempty"`
+	XXX_NoUnkeyedLiteral struct{}        `json:"-"`
+	XXX_unrecognized     []byte          `json:"-"`
+	XXX_sizecache        int32           `json:"-"`
+}
+
+func (m *SendDlBatchReq) Reset()         { *m = SendDlBatchReq{} }
+func (m *SendDlBatchReq) String() string { return proto.CompactTextString(m) }
+func (*SendDlBatchReq) ProtoMessage()    {}
+func (*SendDlBatchReq) Descriptor() ([]byte, []int) {
+	return fileDescriptor_4b79271ac29ed95c, []int{5}
+}
+
+func (m *SendDlBatchReq) XXX_Unmarshal(b []byte) error {
+	return xxx_messageInfo_SendDlBatchReq.Unmarshal(m, b)
+}
+func (m *SendDlBatchReq) XXX_Marshal(b []byte, deterministic bool) ([]byte, error) {
+	return xxx_messageInfo_SendDlBatchReq.Marshal(b, m, deterministic)
+}
+func (m *SendDlBatchReq) XXX_Merge(src proto.Message) {
+	xxx_messageInfo_SendDlBatchReq.Merge(m, src)
+}
+func (m *SendDlBatchReq) XXX_Size() int {
+	return xxx_messageInfo_SendDlBatchReq.Size(m)
+}
+func (m *SendDlBatchReq) XXX_DiscardUnknown() {
+	xxx_messageInfo_SendDlBatchReq.DiscardUnknown(m)
+}
+
+var xxx_messageInfo_SendDlBatchReq proto.InternalMessageInfo
+
+func (m *SendDlBatchReq) GetPpid() uint32 {
+	if m != nil {
+		return m.Ppid
+	}
+	return 0
+}
+
+func (m *SendDlBatchReq) GetPayloads() [][]byte {
+	if m != nil {
+		return m.Payloads
+	}
+	return nil
+}
+
+func (m *SendDlBatchReq) GetTargets() []*SendDlTarget {
+	if m != nil {
+		return m.Targets
+	}
+	return nil
+}
+
+// SendDlBatchRes - per target send status, in SendDlBatchReq.targets order
+type SendDlBatchRes struct {
+	Results              []SendDlRes_SendDlResult `protobuf:"varint,1,rep,packed,name=results,proto3,enum=magma.sctpd.SendDlRes_SendDlResult" json:"results,omitempty"`
+	XXX_NoUnkeyedLiteral struct{}                 `json:"-"`
+	XXX_unrecognized     []byte                   `json:"-"`
+	XXX_sizecache        int32                    `json:"-"`
+}
+
+func (m *SendDlBatchRes) Reset()         { *m = SendDlBatchRes{} }
+func (m *SendDlBatchRes) String() string { return proto.CompactTextString(m) }
+func (*SendDlBatchRes) ProtoMessage()    {}
+func (*SendDlBatchRes) Descriptor() ([]byte, []int) {
+	return fileDescriptor_4b79271ac29ed95c, []int{6}
+}
+
+func (m *SendDlBatchRes) XXX_Unmarshal(b []byte) error {
+	return xxx_messageInfo_SendDlBatchRes.Unmarshal(m, b)
+}
+func (m *SendDlBatchRes) XXX_Marshal(b []byte, deterministic bool) ([]byte, error) {
+	return xxx_messageInfo_SendDlBatchRes.Marshal(b, m, deterministic)
+}
+func (m *SendDlBatchRes) XXX_Merge(src proto.Message) {
+	xxx_messageInfo_SendDlBatchRes.Merge(m, src)
+}
+func (m *SendDlBatchRes) XXX_Size() int {
+	return xxx_messageInfo_SendDlBatchRes.Size(m)
+}
+func (m *SendDlBatchRes) XXX_DiscardUnknown() {
+	xxx_messageInfo_SendDlBatchRes.DiscardUnknown(m)
+}
+
+var xxx_messageInfo_SendDlBatchRes proto.InternalMessageInfo
+
+func (m *SendDlBatchRes) GetResults() []SendDlRes_SendDlResult {
+	if m != nil {
+		return m.Results
+	}
+	return nil
+}
+
 // SendUlReq - requests an uplink packet to be sent to MME
 type SendUlReq struct {
 	AssocId              uint32   `protobuf:"varint,1,opt,name=assoc_id,json=assocId,proto3" json:"assoc_id,omitempty"`
@@ -327,7 +480,7 @@ func (m *SendUlReq) Reset()         { *m = SendUlReq{} }
 func (m *SendUlReq) String() string { return proto.CompactTextString(m) }
 func (*SendUlReq) ProtoMessage()    {}
 func (*SendUlReq) Descriptor() ([]byte, []int) {
-	return fileDescriptor_4b79271ac29ed95c, []int{4}
+	return fileDescriptor_4b79271ac29ed95c, []int{7}
 }
 
 func (m *SendUlReq) XXX_Unmarshal(b []byte) error {
@@ -387,7 +540,7 @@ func (m *SendUlRes) Reset()         { *m = SendUlRes{} }
 func (m *SendUlRes) String() string { return proto.CompactTextString(m) }
 func (*SendUlRes) ProtoMessage()    {}
 func (*SendUlRes) Descriptor() ([]byte, []int) {
-	return fileDescriptor_4b79271ac29ed95c, []int{5}
+	return fileDescriptor_4b79271ac29ed95c, []int{8}
 }
 
 func (m *SendUlRes) XXX_Unmarshal(b []byte) error {
@@ -424,7 +577,7 @@ func (m *NewAssocReq) Reset()         { *m = NewAssocReq{} }
 func (m *NewAssocReq) String() string { return proto.CompactTextString(m) }
 func (*NewAssocReq) ProtoMessage()    {}
 func (*NewAssocReq) Descriptor() ([]byte, []int) {
-	return fileDescriptor_4b79271ac29ed95c, []int{6}
+	return fileDescriptor_4b79271ac29ed95c, []int{9}
 }
 
 func (m *NewAssocReq) XXX_Unmarshal(b []byte) error {
@@ -491,7 +644,7 @@ func (m *NewAssocRes) Reset()         { *m = NewAssocRes{} }
 func (m *NewAssocRes) String() string { return proto.CompactTextString(m) }
 func (*NewAssocRes) ProtoMessage()    {}
 func (*NewAssocRes) Descriptor() ([]byte, []int) {
-	return fileDescriptor_4b79271ac29ed95c, []int{7}
+	return fileDescriptor_4b79271ac29ed95c, []int{10}
 }
 
 func (m *NewAssocRes) XXX_Unmarshal(b []byte) error {
@@ -526,7 +679,7 @@ func (m *CloseAssocReq) Reset()         { *m = CloseAssocReq{} }
 func (m *CloseAssocReq) String() string { return proto.CompactTextString(m) }
 func (*CloseAssocReq) ProtoMessage()    {}
 func (*CloseAssocReq) Descriptor() ([]byte, []int) {
-	return fileDescriptor_4b79271ac29ed95c, []int{8}
+	return fileDescriptor_4b79271ac29ed95c, []int{11}
 }
 
 func (m *CloseAssocReq) XXX_Unmarshal(b []byte) error {
@@ -579,7 +732,7 @@ func (m *CloseAssocRes) Reset()         { *m = CloseAssocRes{} }
 func (m *CloseAssocRes) String() string { return proto.CompactTextString(m) }
 func (*CloseAssocRes) ProtoMessage()    {}
 func (*CloseAssocRes) Descriptor() ([]byte, []int) {
-	return fileDescriptor_4b79271ac29ed95c, []int{9}
+	return fileDescriptor_4b79271ac29ed95c, []int{12}
 }
 
 func (m *CloseAssocRes) XXX_Unmarshal(b []byte) error {
@@ -607,6 +760,9 @@ func init() {
 	proto.RegisterType((*InitRes)(nil), "magma.sctpd.InitRes")
 	proto.RegisterType((*SendDlReq)(nil), "magma.sctpd.SendDlReq")
 	proto.RegisterType((*SendDlRes)(nil), "magma.sctpd.SendDlRes")
+	proto.RegisterType((*SendDlTarget)(nil), "magma.sctpd.SendDlTarget")
+	proto.RegisterType((*SendDlBatchReq)(nil), "magma.sctpd.SendDlBatchReq")
+	proto.RegisterType((*SendDlBatchRes)(nil), "magma.sctpd.SendDlBatchRes")
 	proto.RegisterType((*SendUlReq)(nil), "magma.sctpd.SendUlReq")
 	proto.RegisterType((*SendUlRes)(nil), "magma.sctpd.SendUlRes")
 	proto.RegisterType((*NewAssocReq)(nil), "magma.sctpd.NewAssocReq")
@@ -618,45 +774,52 @@ func init() {
 func init() { proto.RegisterFile("lte/protos/sctpd.proto", fileDescriptor_4b79271ac29ed95c) }
 
 var fileDescriptor_4b79271ac29ed95c = []byte{
-	// 609 bytes of a gzipped FileDescriptorProto
-	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xbc, 0x54, 0xcf, 0x6e, 0x9b, 0x4e,
-	0x10, 0x36, 0xb1, 0x63, 0xec, 0x01, 0x12, 0x6b, 0x7f, 0x3f, 0x45, 0xc4, 0xfd, 0x67, 0x91, 0x8b,
-	0x4f, 0xb6, 0xe4, 0x5a, 0xae, 0x94, 0x5e, 0xea, 0xc6, 0x89, 0x84, 0x12, 0x11, 0x09, 0xd7, 0xaa,
-	0xda, 0x0b, 0xa2, 0x66, 0x1b, 0xa1, 0x62, 0x58, 0x33, 0x4b, 0xa2, 0x5e, 0x2a, 0xf5, 0x09, 0xfa,
-	0x06, 0x7d, 0xa0, 0x5e, 0xfb, 0x42, 0x15, 0x6b, 0x30, 0x50, 0xd9, 0x6a, 0x4f, 0x3d, 0xc1, 0x7c,
-	0xdf, 0x30, 0xf3, 0x7d, 0xc3, 0xec, 0xc2, 0x49, 0xc0, 0xe9, 0x90, 0xc5, 0x11, 0x8f, 0x70, 0x88,
-	0x4b, 0xce, 0xbc, 0x81, 0x08, 0x88, 0xb2, 0x72, 0xef, 0x56, 0xee, 0x40, 0x40, 0xc6, 0x0f, 0x09,
-	0x64, 0x33, 0xf4, 0xb9, 0x4d, 0xd7, 0xe4, 0x14, 0x5a, 0x09, 0x52, 0xc7, 0x67, 0xf7, 0x63, 0x5d,
-	0xea, 0x49, 0xfd, 0x96, 0x2d, 0x27, 0x48, 0x4d, 0x76, 0x3f, 0x2e, 0x51, 0x13, 0xfd, 0xa0, 0x4c,
-	0x4d, 0xc8, 0x13, 0x80, 0xf4, 0x0b, 0xc7, 0xf5, 0xbc, 0x18, 0xf5, 0x7a, 0xaf, 0xde, 0x6f, 0xdb,
-	0xed, 0x14, 0x99, 0xa6, 0x40, 0x46, 0x4f, 0x32, 0xba, 0xb1, 0xa5, 0x27, 0x1b, 0x9a, 0x40, 0x83,
-	0x45, 0x31, 0xd7, 0x0f, 0x7b, 0x52, 0x5f, 0xb3, 0xc5, 0xbb, 0xc0, 0x98, 0xef, 0xe9, 0xcd, 0x0c,
-	0x63, 0xbe, 0x47, 0xce, 0x40, 0xfb, 0x18, 0xc5, 0x4b, 0xea, 0xc4, 0x14, 0xb9, 0x1b, 0x73, 0x5d,
-	0x16, 0x2a, 0x54, 0x01, 0xda, 0x1b, 0xcc, 0xf8, 0x92, 0x7b, 0x41, 0xf2, 0x02, 0x9a, 0x31, 0xc5,
-	0x24, 0xe0, 0xc2, 0xc9, 0xd1, 0xe8, 0xd9, 0xa0, 0xe4, 0x7a, 0x90, 0x65, 0xe5, 0xcf, 0x24, 0xe0,
-	0x76, 0x96, 0x6e, 0x9c, 0x03, 0x14, 0x28, 0xe9, 0x80, 0x6a, 0x5a, 0xe6, 0x1b, 0x67, 0x61, 0x5d,
-	0x5b, 0xb7, 0x6f, 0xad, 0x4e, 0x8d, 0x28, 0x20, 0x0b, 0xe4, 0xf6, 0xba, 0x23, 0x11, 0x0d, 0xda,
-	0x22, 0xb8, 0x9a, 0x9a, 0x37, 0x9d, 0x03, 0x23, 0x80, 0xf6, 0x9c, 0x86, 0xde, 0x2c, 0xc8, 0xa6,
-	0xe9, 0x22, 0x46, 0x4b, 0xc7, 0xf7, 0x84, 0x06, 0xcd, 0x96, 0x45, 0x6c, 0x7a, 0xe4, 0x04, 0x9a,
-	0xc8, 0x63, 0xea, 0xae, 0xc4, 0x2c, 0x35, 0x3b, 0x8b, 0x88, 0x0e, 0x32, 0x73, 0x3f, 0x07, 0x91,
-	0xeb, 0xe9, 0xf5, 0x9e, 0xd4, 0x57, 0xed, 0x3c, 0xdc, 0x8e, 0xa4, 0x51, 0x8c, 0xc4, 0xf8, 0x26,
-	0x15, 0xed, 0x90, 0xbc, 0xfc, 0xcd, 0xf0, 0x59, 0xc5, 0xf0, 0x36, 0xaf, 0x78, 0x2b, 0x9b, 0xbe,
-	0x04, 0xb5, 0x8c, 0x93, 0xff, 0xe0, 0x78, 0x7e, 0x69, 0xcd, 0x9c, 0xd9, 0x4d, 0xc9, 0xf9, 0x11,
-	0x40, 0x0e, 0x0a, 0xf3, 0x1d, 0x50, 0xf3, 0xb8, 0xea, 0x7f, 0xf1, 0x6f, 0xfc, 0x2b, 0x45, 0x37,
-	0x34, 0xbe, 0x4b, 0xa0, 0x58, 0xf4, 0x61, 0x9a, 0x76, 0xf8, 0x43, 0xf7, 0xc7, 0xd0, 0xf6, 0xc3,
-	0x4d, 0x47, 0xcc, 0x04, 0x14, 0x00, 0x79, 0x0a, 0x10, 0x25, 0x3c, 0xa7, 0xeb, 0x82, 0x2e, 0x21,
-	0xc4, 0x00, 0x2d, 0x76, 0x43, 0x67, 0xc9, 0x1c, 0x9f, 0xa5, 0x3b, 0x2d, 0x24, 0xa9, 0xb6, 0x12,
-	0xbb, 0xe1, 0x05, 0x33, 0x05, 0xb4, 0x55, 0x7b, 0x58, 0x52, 0xab, 0x95, 0xf5, 0xa1, 0xf1, 0x0e,
-	0xb4, 0x8b, 0x20, 0x42, 0xfa, 0x37, 0x82, 0x4f, 0xa1, 0xe5, 0x63, 0xba, 0xf8, 0x94, 0xe7, 0x87,
-	0xcf, 0x47, 0x3b, 0x0d, 0xb7, 0x9d, 0xea, 0xa5, 0x4e, 0xc7, 0xd5, 0xd2, 0x38, 0xfa, 0x2a, 0x81,
-	0x36, 0x4f, 0xd7, 0x60, 0x16, 0x3d, 0x84, 0x81, 0x1f, 0x7e, 0x22, 0x63, 0x68, 0xa4, 0x4b, 0x4e,
-	0xfe, 0xdf, 0x71, 0x2a, 0xd6, 0xdd, 0x5d, 0x28, 0x1a, 0x35, 0x72, 0x0e, 0xcd, 0xcd, 0x96, 0x90,
-	0x93, 0x9d, 0xcb, 0xb5, 0xee, 0xee, 0xc6, 0xd1, 0xa8, 0x8d, 0x7e, 0x4a, 0xa0, 0x08, 0x0d, 0x0b,
-	0x26, 0x14, 0x64, 0xb5, 0x16, 0xbb, 0x6a, 0x2d, 0xf6, 0xd4, 0xda, 0xfc, 0xe9, 0x1a, 0x79, 0x05,
-	0xad, 0x7c, 0x94, 0x44, 0xaf, 0x64, 0x95, 0x36, 0xa0, 0xbb, 0x8f, 0x49, 0x2b, 0x5c, 0x01, 0x14,
-	0x23, 0x22, 0xdd, 0x4a, 0x66, 0xe5, 0xb7, 0x74, 0xf7, 0x73, 0x68, 0xd4, 0x5e, 0x3f, 0x7a, 0x7f,
-	0x2a, 0xe8, 0x61, 0x7a, 0xd5, 0x2e, 0x83, 0x28, 0xf1, 0x86, 0x77, 0x51, 0x76, 0xe7, 0x7e, 0x68,
-	0x8a, 0xe7, 0xf3, 0x5f, 0x01, 0x00, 0x00, 0xff, 0xff, 0xd8, 0x17, 0xf8, 0xdd, 0x88, 0x05, 0x00,
+	// 721 bytes of a gzipped FileDescriptorProto
+	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xbc, 0x55, 0xcd, 0x4e, 0xdb, 0x4c,
+	0x14, 0x8d, 0x49, 0x88, 0x93, 0x6b, 0x1b, 0xa2, 0xf9, 0x3e, 0x21, 0x27, 0x7c, 0x3f, 0x91, 0xd9,
+	0x64, 0x95, 0x48, 0x01, 0xa5, 0x12, 0x55, 0xa5, 0x02, 0x01, 0xc9, 0x02, 0x05, 0x69, 0x20, 0xaa,
+	0xda, 0x8d, 0xe5, 0xc6, 0x03, 0xb5, 0x6a, 0x6c, 0xe3, 0x99, 0x40, 0xbb, 0xe9, 0x2b, 0xf4, 0x0d,
+	0xfa, 0x40, 0x55, 0x77, 0x7d, 0xa1, 0x6a, 0xc6, 0x33, 0x89, 0x83, 0x4c, 0x8b, 0xba, 0xe8, 0xca,
+	0xbe, 0xe7, 0xde, 0xf1, 0x3d, 0xe7, 0xcc, 0xd5, 0x35, 0x6c, 0x45, 0x8c, 0x0c, 0xd2, 0x2c, 0x61,
+	0x09, 0x1d, 0xd0, 0x19, 0x4b, 0x83, 0xbe, 0x08, 0x90, 0x71, 0xe3, 0x5f, 0xdf, 0xf8, 0x7d, 0x01,
+	0x39, 0x5f, 0x35, 0xd0, 0xdd, 0x38, 0x64, 0x98, 0xdc, 0xa2, 0x36, 0x34, 0xe6, 0x94, 0x78, 0x61,
+	0x7a, 0xb7, 0x67, 0x6b, 0x5d, 0xad, 0xd7, 0xc0, 0xfa, 0x9c, 0x12, 0x37, 0xbd, 0xdb, 0x2b, 0xa4,
+	0x46, 0xf6, 0x5a, 0x31, 0x35, 0x42, 0xff, 0x02, 0xf0, 0x13, 0x9e, 0x1f, 0x04, 0x19, 0xb5, 0xab,
+	0xdd, 0x6a, 0xaf, 0x89, 0x9b, 0x1c, 0x39, 0xe0, 0x80, 0x4c, 0x8f, 0x64, 0xba, 0xb6, 0x48, 0x8f,
+	0xf2, 0x34, 0x82, 0x5a, 0x9a, 0x64, 0xcc, 0x5e, 0xef, 0x6a, 0x3d, 0x0b, 0x8b, 0x77, 0x81, 0xa5,
+	0x61, 0x60, 0xd7, 0x25, 0x96, 0x86, 0x01, 0xda, 0x01, 0xeb, 0x2a, 0xc9, 0x66, 0xc4, 0xcb, 0x08,
+	0x65, 0x7e, 0xc6, 0x6c, 0x5d, 0xb0, 0x30, 0x05, 0x88, 0x73, 0xcc, 0xf9, 0xa4, 0xb4, 0x50, 0xf4,
+	0x0c, 0xea, 0x19, 0xa1, 0xf3, 0x88, 0x09, 0x25, 0x1b, 0xc3, 0xff, 0xfb, 0x05, 0xd5, 0x7d, 0x59,
+	0xa5, 0x9e, 0xf3, 0x88, 0x61, 0x59, 0xee, 0xec, 0x03, 0x2c, 0x51, 0xd4, 0x02, 0xd3, 0x9d, 0xb8,
+	0x97, 0xde, 0x74, 0x72, 0x3a, 0x39, 0x7f, 0x35, 0x69, 0x55, 0x90, 0x01, 0xba, 0x40, 0xce, 0x4f,
+	0x5b, 0x1a, 0xb2, 0xa0, 0x29, 0x82, 0x93, 0x03, 0xf7, 0xac, 0xb5, 0xe6, 0x44, 0xd0, 0xbc, 0x20,
+	0x71, 0x30, 0x8e, 0xa4, 0x9b, 0x3e, 0xa5, 0xc9, 0xcc, 0x0b, 0x03, 0xc1, 0xc1, 0xc2, 0xba, 0x88,
+	0xdd, 0x00, 0x6d, 0x41, 0x9d, 0xb2, 0x8c, 0xf8, 0x37, 0xc2, 0x4b, 0x0b, 0xcb, 0x08, 0xd9, 0xa0,
+	0xa7, 0xfe, 0xc7, 0x28, 0xf1, 0x03, 0xbb, 0xda, 0xd5, 0x7a, 0x26, 0x56, 0xe1, 0xc2, 0x92, 0xda,
+	0xd2, 0x12, 0xe7, 0xb3, 0xb6, 0x6c, 0x47, 0xd1, 0xf3, 0x07, 0x82, 0x77, 0x56, 0x04, 0x2f, 0xea,
+	0x96, 0x6f, 0x45, 0xd1, 0xc7, 0x60, 0x16, 0x71, 0xf4, 0x17, 0x6c, 0x5e, 0x1c, 0x4f, 0xc6, 0xde,
+	0xf8, 0xac, 0xa0, 0x7c, 0x03, 0x40, 0x81, 0x42, 0x7c, 0x0b, 0x4c, 0x15, 0x4b, 0xfd, 0x57, 0xea,
+	0x33, 0x97, 0x7e, 0x76, 0x4d, 0xd8, 0xef, 0x58, 0xb0, 0x03, 0x96, 0xd4, 0xec, 0x85, 0x71, 0x40,
+	0x3e, 0x08, 0x23, 0x2c, 0x6c, 0x4a, 0xd0, 0xe5, 0x98, 0x33, 0x87, 0x8d, 0xbc, 0xcf, 0xa1, 0xcf,
+	0x66, 0xef, 0xb8, 0xd9, 0xca, 0x1f, 0xad, 0x30, 0x32, 0x1d, 0x68, 0xc8, 0x53, 0xd4, 0x5e, 0xeb,
+	0x56, 0x7b, 0x26, 0x5e, 0xc4, 0x68, 0x17, 0x74, 0x26, 0x38, 0xe6, 0x13, 0x6b, 0x0c, 0xdb, 0x25,
+	0x76, 0xe5, 0x2a, 0xb0, 0xaa, 0x74, 0xce, 0x1f, 0xb4, 0xa5, 0xe8, 0x05, 0xe8, 0xb9, 0x83, 0xd4,
+	0xd6, 0xba, 0xd5, 0xa7, 0xba, 0xae, 0xce, 0xa8, 0x79, 0x99, 0xfe, 0x99, 0x79, 0x31, 0x96, 0xdd,
+	0xa8, 0xf3, 0x45, 0x03, 0x63, 0x42, 0xee, 0x0f, 0x78, 0x87, 0x5f, 0x74, 0xff, 0x07, 0x9a, 0x61,
+	0x9c, 0x77, 0xa4, 0x92, 0xc0, 0x12, 0x40, 0xff, 0x01, 0x24, 0x73, 0xa6, 0xd2, 0xf9, 0x6d, 0x15,
+	0x10, 0xe4, 0x80, 0x95, 0xf9, 0xb1, 0x37, 0x4b, 0xbd, 0x30, 0xe5, 0x3b, 0x40, 0x50, 0x32, 0xb1,
+	0x91, 0xf9, 0xf1, 0x51, 0xea, 0x0a, 0x68, 0xc1, 0x76, 0xbd, 0xc0, 0xd6, 0x2a, 0xf2, 0xa3, 0xce,
+	0x6b, 0xb0, 0x8e, 0xa2, 0x84, 0x92, 0xa7, 0x10, 0x6e, 0x43, 0x23, 0xa4, 0x7c, 0x51, 0x10, 0xa6,
+	0x96, 0x55, 0x48, 0x31, 0x0f, 0x17, 0x9d, 0xaa, 0x85, 0x4e, 0x9b, 0xab, 0x9f, 0xa6, 0xc3, 0x6f,
+	0x1a, 0x58, 0x17, 0xfc, 0x02, 0xc7, 0xc9, 0x7d, 0x1c, 0x85, 0xf1, 0x7b, 0xb4, 0x07, 0x35, 0xbe,
+	0x14, 0xd0, 0xdf, 0x25, 0x5b, 0xe4, 0xb6, 0x53, 0x86, 0x52, 0xa7, 0x82, 0xf6, 0xa1, 0x9e, 0xdf,
+	0x3b, 0xda, 0x2a, 0x1d, 0x8b, 0xdb, 0x4e, 0x39, 0xce, 0xcf, 0xba, 0x60, 0x14, 0x66, 0x0d, 0x6d,
+	0x97, 0x14, 0xaa, 0xe1, 0xef, 0xfc, 0x24, 0x49, 0x9d, 0xca, 0xf0, 0xbb, 0x06, 0x86, 0x90, 0x33,
+	0x4d, 0x85, 0x18, 0x49, 0x6b, 0x5a, 0x46, 0x6b, 0xfa, 0x08, 0xad, 0xa9, 0xa4, 0xf5, 0x12, 0x1a,
+	0xea, 0x56, 0x90, 0xbd, 0x52, 0x55, 0x18, 0xa6, 0xce, 0x63, 0x19, 0xfe, 0x85, 0x13, 0x80, 0xa5,
+	0xdb, 0xa8, 0xb3, 0x52, 0xb9, 0x72, 0xc3, 0x9d, 0xc7, 0x73, 0xd4, 0xa9, 0x1c, 0x6e, 0xbf, 0x69,
+	0x8b, 0xf4, 0x80, 0xff, 0xe5, 0x66, 0x51, 0x32, 0x0f, 0x06, 0xd7, 0x89, 0xfc, 0xdd, 0xbd, 0xad,
+	0x8b, 0xe7, 0xee, 0x8f, 0x00, 0x00, 0x00, 0xff, 0xff, 0xb7, 0xa9, 0xdb, 0x55, 0x03, 0x07, 0x00,
 	0x00,
 }
 
@@ -680,6 +843,11 @@ type SctpdDownlinkClient interface {
 	// @param SendDlReq request specifying packet data and destination
 	// @return SendDlRes response w/ send success status
 	SendDl(ctx context.Context, in *SendDlReq, opts ...grpc.CallOption) (*SendDlRes, error)
+	// SendDlBatch - send the same or different downlink packets to several
+	// associations in one call
+	// @param SendDlBatchReq request specifying payloads and destinations
+	// @return SendDlBatchRes response w/ per destination send status
+	SendDlBatch(ctx context.Context, in *SendDlBatchReq, opts ...grpc.CallOption) (*SendDlBatchRes, error)
 }
 
 type sctpdDownlinkClient struct {
@@ -708,6 +876,15 @@ func (c *sctpdDownlinkClient) SendDl(ctx context.Context, in *SendDlReq, opts ..
 	return out, nil
 }
 
+func (c *sctpdDownlinkClient) SendDlBatch(ctx context.Context, in *SendDlBatchReq, opts ...grpc.CallOption) (*SendDlBatchRes, error) {
+	out := new(SendDlBatchRes)
+	err := c.cc.Invoke(ctx, "/magma.sctpd.SctpdDownlink/SendDlBatch", in, out, opts...)
+	if err != nil {
+		return nil, err
+	}
+	return out, nil
+}
+
 // SctpdDownlinkServer is the server API for SctpdDownlink service.
 type SctpdDownlinkServer interface {
 	// Init - initialize sctp connection according to InitReq
@@ -718,6 +895,11 @@ type SctpdDownlinkServer interface {
 	// @param SendDlReq request specifying packet data and destination
 	// @return SendDlRes response w/ send success status
 	SendDl(context.Context, *SendDlReq) (*SendDlRes, error)
+	// SendDlBatch - send the same or different downlink packets to several
+	// associations in one call
+	// @param SendDlBatchReq request specifying payloads and destinations
+	// @return SendDlBatchRes response w/ per destination send status
+	SendDlBatch(context.Context, *SendDlBatchReq) (*SendDlBatchRes, error)
 }
 
 // UnimplementedSctpdDownlinkServer can be embedded to have forward compatible implementations.
@@ -730,6 +912,9 @@ func (*UnimplementedSctpdDownlinkServer) Init(ctx context.Context, req *InitReq)
 func (*UnimplementedSctpdDownlinkServer) SendDl(ctx context.Context, req *SendDlReq) (*SendDlRes, error) {
 	return nil, status.Errorf(codes.Unimplemented, "method SendDl not implemented")
 }
+func (*UnimplementedSctpdDownlinkServer) SendDlBatch(ctx context.Context, req *SendDlBatchReq) (*SendDlBatchRes, error) {
+	return nil, status.Errorf(codes.Unimplemented, "method SendDlBatch not implemented")
+}
 
 func RegisterSctpdDownlinkServer(s *grpc.Server, srv SctpdDownlinkServer) {
 	s.RegisterService(&_SctpdDownlink_serviceDesc, srv)
@@ -771,6 +956,24 @@ func _SctpdDownlink_SendDl_Handler(srv interface{}, ctx context.Context, dec fun
 	return interceptor(ctx, in, info, handler)
 }
 
+func _SctpdDownlink_SendDlBatch_Handler(srv interface{}, ctx context.Context, dec func(interface{}) error, interceptor grpc.UnaryServerInterceptor) (interface{}, error) {
+	in := new(SendDlBatchReq)
+	if err := dec(in); err != nil {
+		return nil, err
+	}
+	if interceptor == nil {
+		return srv.(SctpdDownlinkServer).SendDlBatch(ctx, in)
+	}
+	info := &grpc.UnaryServerInfo{
+		Server:     srv,
+		FullMethod: "/magma.sctpd.SctpdDownlink/SendDlBatch",
+	}
+	handler := func(ctx context.Context, req interface{}) (interface{}, error) {
+		return srv.(SctpdDownlinkServer).SendDlBatch(ctx, req.(*SendDlBatchReq))
+	}
+	return interceptor(ctx, in, info, handler)
+}
+
 var _SctpdDownlink_serviceDesc = grpc.ServiceDesc{
 	ServiceName: "magma.sctpd.SctpdDownlink",
 	HandlerType: (*SctpdDownlinkServer)(nil),
@@ -783,6 +986,10 @@ var _SctpdDownlink_serviceDesc = grpc.ServiceDesc{
 			MethodName: "SendDl",
 			Handler:    _SctpdDownlink_SendDl_Handler,
 		},
+		{
+			MethodName: "SendDlBatch",
+			Handler:    _SctpdDownlink_SendDlBatch_Handler,
+		},
 	},
 	Streams:  []grpc.StreamDesc{},
 	Metadata: "lte/protos/sctpd.proto",
@@ -25,6 +25,7 @@
 #include <stdint.h>
 
 #include "bstrlib.h"
+#include "mem_arena.h"
 #include "TLVDecoder.h"
 
 int errorCodeDecoder = 0;
@@ -38,7 +39,7 @@ int decode_bstring(
   }
 
   if ((bstr) && (buffer)) {
-    *bstr = blk2bstr(buffer, pdulen);
+    *bstr = mem_arena_current_blk2bstr(buffer, pdulen);
     return pdulen;
   } else {
     return TLV_BUFFER_TOO_SHORT;
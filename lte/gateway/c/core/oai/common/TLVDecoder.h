@@ -87,6 +87,28 @@ void tlv_decode_perror(void);
     return TLV_BUFFER_TOO_SHORT;                                               \
   }
 
+/*
+ * Checks that a mandatory LV IE, length octet included, fits in the
+ * remaining buffer before its decoder reads it
+ */
+#define CHECK_LV_LENGTH_DECODER_FOR_MANDATORY_IE(                              \
+    bUFFER, bUFFERlENGTH, mINIMUMlENGTH)                                       \
+  if ((bUFFERlENGTH) < 1 || *(bUFFER) < (mINIMUMlENGTH) ||                     \
+      (bUFFERlENGTH) - 1 < *(bUFFER)) {                                        \
+    OAILOG_WARNING(LOG_NAS, "Mandatory IE runs past the end of the PDU\n");    \
+    errorCodeDecoder = TLV_MANDATORY_FIELD_NOT_PRESENT;                        \
+    return TLV_MANDATORY_FIELD_NOT_PRESENT;                                    \
+  }
+
+#define CHECK_LV_E_LENGTH_DECODER_FOR_MANDATORY_IE(bUFFER, bUFFERlENGTH)       \
+  if ((bUFFERlENGTH) < 2 ||                                                    \
+      (bUFFERlENGTH) - 2 <                                                     \
+          (uint32_t)((*(bUFFER) << 8) | *((bUFFER) + 1))) {                    \
+    OAILOG_WARNING(LOG_NAS, "Mandatory IE runs past the end of the PDU\n");    \
+    errorCodeDecoder = TLV_MANDATORY_FIELD_NOT_PRESENT;                        \
+    return TLV_MANDATORY_FIELD_NOT_PRESENT;                                    \
+  }
+
 #define CHECK_MESSAGE_TYPE(mESSAGE_tYPE, bUFFER)                               \
   {                                                                            \
     if (mESSAGE_tYPE != bUFFER) {                                              \
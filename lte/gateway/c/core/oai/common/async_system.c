@@ -52,6 +52,11 @@
 #include "itti_types.h"
 
 static void async_system_exit(void);
+static int async_system_popen(const_bstring command, const_bstring input);
+static status_code_e async_system_send(
+    int sender_itti_task, bool is_abort_on_error, bool notify_result,
+    bstring input, const char* format, va_list args);
+static void async_system_send_result(task_id_t destination_task_id, int rc);
 
 task_zmq_ctx_t async_system_task_zmq_ctx;
 
@@ -64,8 +69,14 @@ static int handle_message(zloop_t* loop, zsock_t* reader, void* arg) {
       OAILOG_DEBUG(
           LOG_ASYNC_SYSTEM, "C system() call: %s\n",
           bdata(ASYNC_SYSTEM_COMMAND(received_message_p).system_command));
-      rc = system(
-          bdata(ASYNC_SYSTEM_COMMAND(received_message_p).system_command));
+      if (ASYNC_SYSTEM_COMMAND(received_message_p).input) {
+        rc = async_system_popen(
+            ASYNC_SYSTEM_COMMAND(received_message_p).system_command,
+            ASYNC_SYSTEM_COMMAND(received_message_p).input);
+      } else {
+        rc = system(
+            bdata(ASYNC_SYSTEM_COMMAND(received_message_p).system_command));
+      }
 
       if (rc) {
         OAILOG_ERROR(
@@ -79,6 +90,9 @@ static int handle_message(zloop_t* loop, zsock_t* reader, void* arg) {
         bdestroy_wrapper(
             &ASYNC_SYSTEM_COMMAND(received_message_p).system_command);
       }
+      if (ASYNC_SYSTEM_COMMAND(received_message_p).notify_result) {
+        async_system_send_result(ITTI_MSG_ORIGIN_ID(received_message_p), rc);
+      }
     } break;
 
     case TERMINATE_MESSAGE: {
@@ -103,7 +117,8 @@ static int handle_message(zloop_t* loop, zsock_t* reader, void* arg) {
 static void* async_system_thread(__attribute__((unused)) void* args_p) {
   itti_mark_task_ready(TASK_ASYNC_SYSTEM);
   init_task_context(
-      TASK_ASYNC_SYSTEM, (task_id_t[]){}, 0, handle_message,
+      TASK_ASYNC_SYSTEM, (task_id_t[]){TASK_ASYNC_SYSTEM, TASK_SPGW_APP}, 2,
+      handle_message,
       &async_system_task_zmq_ctx);
 
   zloop_start(async_system_task_zmq_ctx.event_loop);
@@ -125,31 +140,90 @@ status_code_e async_system_init(void) {
 }
 
 //------------------------------------------------------------------------------
-status_code_e async_system_command(
-    int sender_itti_task, bool is_abort_on_error, char* format, ...) {
-  va_list args;
+// Runs command with input as its standard input, returns its exit status
+static int async_system_popen(const_bstring command, const_bstring input) {
+  FILE* pipe = popen(bdata(command), "w");
+  if (!pipe) {
+    return -1;
+  }
+  size_t written = fwrite(bdata(input), 1, blength(input), pipe);
+  int rc         = pclose(pipe);
+  if (!rc && (written != (size_t) blength(input))) {
+    rc = -1;
+  }
+  return rc;
+}
+
+//------------------------------------------------------------------------------
+static void async_system_send_result(task_id_t destination_task_id, int rc) {
+  MessageDef* message_p = DEPRECATEDitti_alloc_new_message_fatal(
+      TASK_ASYNC_SYSTEM, ASYNC_SYSTEM_COMMAND_RESULT);
+  ASYNC_SYSTEM_COMMAND_RESULT(message_p).exit_status = rc;
+  send_msg_to_task(&async_system_task_zmq_ctx, destination_task_id, message_p);
+}
+
+//------------------------------------------------------------------------------
+static status_code_e async_system_send(
+    int sender_itti_task, bool is_abort_on_error, bool notify_result,
+    bstring input, const char* format, va_list args) {
   int rv       = 0;
   bstring bstr = NULL;
-  va_start(args, format);
-  bstr = bfromcstralloc(1024, " ");
+  bstr         = bfromcstralloc(1024, " ");
   btrunc(bstr, 0);
   rv = bvcformata(bstr, 1024, format, args);  // big number, see bvcformata
-  va_end(args);
 
   if (NULL == bstr || BSTR_OK != rv) {
     OAILOG_ERROR(LOG_ASYNC_SYSTEM, "Error while formatting system command");
+    bdestroy_wrapper(&bstr);
+    bdestroy_wrapper(&input);
     return RETURNerror;
   }
   MessageDef* message_p = NULL;
   message_p             = DEPRECATEDitti_alloc_new_message_fatal(
       sender_itti_task, ASYNC_SYSTEM_COMMAND);
   ASYNC_SYSTEM_COMMAND(message_p).system_command    = bstr;
+  ASYNC_SYSTEM_COMMAND(message_p).input             = input;
   ASYNC_SYSTEM_COMMAND(message_p).is_abort_on_error = is_abort_on_error;
+  ASYNC_SYSTEM_COMMAND(message_p).notify_result     = notify_result;
   status_code_e result                              = send_msg_to_task(
       &async_system_task_zmq_ctx, TASK_ASYNC_SYSTEM, message_p);
   return result;
 }
 
+//------------------------------------------------------------------------------
+status_code_e async_system_command(
+    int sender_itti_task, bool is_abort_on_error, char* format, ...) {
+  va_list args;
+  va_start(args, format);
+  status_code_e result = async_system_send(
+      sender_itti_task, is_abort_on_error, false, NULL, format, args);
+  va_end(args);
+  return result;
+}
+
+//------------------------------------------------------------------------------
+status_code_e async_system_command_with_input(
+    int sender_itti_task, bool is_abort_on_error, bstring input, char* format,
+    ...) {
+  va_list args;
+  va_start(args, format);
+  status_code_e result = async_system_send(
+      sender_itti_task, is_abort_on_error, false, input, format, args);
+  va_end(args);
+  return result;
+}
+
+//------------------------------------------------------------------------------
+status_code_e async_system_command_with_result(
+    int sender_itti_task, bstring input, char* format, ...) {
+  va_list args;
+  va_start(args, format);
+  status_code_e result =
+      async_system_send(sender_itti_task, false, true, input, format, args);
+  va_end(args);
+  return result;
+}
+
 //------------------------------------------------------------------------------
 void async_system_exit(void) {
   destroy_task_context(&async_system_task_zmq_ctx);
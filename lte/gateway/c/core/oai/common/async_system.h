@@ -41,10 +41,26 @@
 #define FILE_ASYNC_SYSTEM_SEEN
 
 #include <stdbool.h>
+#include "bstrlib.h"
 #include "common_defs.h"
 
 status_code_e async_system_init(void);
 status_code_e async_system_command(
     int sender_itti_task, bool is_abort_on_error, char* format, ...);
+/*
+ * Same as async_system_command, input is written to the standard input of the
+ * command (e.g. a whole iptables-restore transaction). The ownership of input
+ * is taken.
+ */
+status_code_e async_system_command_with_input(
+    int sender_itti_task, bool is_abort_on_error, bstring input, char* format,
+    ...);
+/*
+ * Same as async_system_command_with_input without aborting on error, the exit
+ * status of the command is sent back to sender_itti_task in an
+ * ASYNC_SYSTEM_COMMAND_RESULT message.
+ */
+status_code_e async_system_command_with_result(
+    int sender_itti_task, bstring input, char* format, ...);
 
 #endif /* FILE_SHARED_TS_LOG_SEEN */
@@ -35,6 +35,12 @@
 
 #include "backtrace.h"
 
+static void (*crash_dump)(void) = NULL;
+
+void backtrace_set_crash_dump(void (*dump)(void)) {
+  crash_dump = dump;
+}
+
 /* Obtain a backtrace and print it to stdout. */
 void display_backtrace(void) {
   void* array[10];
@@ -49,6 +55,10 @@ void display_backtrace(void) {
   for (i = 0; i < size; i++) printf("%s\n", strings[i]);
 
   free(strings);
+
+  if (crash_dump != NULL) {
+    crash_dump();
+  }
 }
 
 void backtrace_handle_signal(siginfo_t* info) {
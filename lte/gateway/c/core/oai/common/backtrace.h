@@ -37,4 +37,7 @@ void display_backtrace(void);
 
 void backtrace_handle_signal(siginfo_t* info);
 
+/* Extra state printed after the stack frames, NULL to print none. */
+void backtrace_set_crash_dump(void (*dump)(void));
+
 #endif /* BACKTRACE_H_ */
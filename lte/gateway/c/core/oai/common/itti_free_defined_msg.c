@@ -29,6 +29,7 @@
 #include "3gpp_24.008.h"
 #include "intertask_interface.h"
 #include "itti_free_defined_msg.h"
+#include "mem_arena.h"
 #include "async_system_messages_types.h"
 #include "ip_forward_messages_types.h"
 #include "s11_messages_types.h"
@@ -41,6 +42,9 @@ void itti_free_msg_content(MessageDef* const message_p) {
       if (ASYNC_SYSTEM_COMMAND(message_p).system_command) {
         bdestroy_wrapper(&ASYNC_SYSTEM_COMMAND(message_p).system_command);
       }
+      if (ASYNC_SYSTEM_COMMAND(message_p).input) {
+        bdestroy_wrapper(&ASYNC_SYSTEM_COMMAND(message_p).input);
+      }
     } break;
 
     case GTPV1U_CREATE_TUNNEL_REQ:
@@ -206,6 +210,10 @@ void itti_free_msg_content(MessageDef* const message_p) {
       bdestroy_wrapper(&message_p->ittiMsg.sctp_data_req.payload);
       break;
 
+    case SCTP_DATA_BATCH_REQ:
+      bdestroy_wrapper(&message_p->ittiMsg.sctp_data_batch_req.payload);
+      break;
+
     case SCTP_DATA_IND:
       bdestroy_wrapper(&message_p->ittiMsg.sctp_data_ind.payload);
       break;
@@ -220,4 +228,6 @@ void itti_free_msg_content(MessageDef* const message_p) {
       break;
     default:;
   }
+  // Everything carved from the message arena goes away in one shot
+  mem_arena_destroy(&message_p->ittiMsgHeader.arena);
 }
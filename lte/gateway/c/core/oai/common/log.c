@@ -781,6 +781,17 @@ void log_itti_connect(void) {
     AssertFatal(rv == 0, "Create task for OAI logging failed!\n");
   }
 }
+//------------------------------------------------------------------------------
+void log_end_use(void) {
+  if (g_oai_log.thread_context_htbl) {
+    hashtable_ts_free(
+        g_oai_log.thread_context_htbl, (hash_key_t) pthread_self());
+  }
+  if (g_oai_log.is_async) {
+    shared_log_end_use();
+  }
+}
+
 //------------------------------------------------------------------------------
 void log_flush_message(struct shared_log_queue_item_s* item_p) {
   int rv     = 0;
@@ -838,6 +849,7 @@ static void log_exit(void) {
     closelog();
   }
   hashtable_ts_destroy(g_oai_log.thread_context_htbl);
+  g_oai_log.thread_context_htbl = NULL;
   bdestroy_wrapper(&g_oai_log.bserver_address);
   bdestroy_wrapper(&g_oai_log.bserver_port);
   OAI_FPRINTF_INFO("[TRACE] Leaving %s\n", __FUNCTION__);
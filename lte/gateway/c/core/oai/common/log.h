@@ -304,6 +304,8 @@ int log_init(
 
 void log_itti_connect(void);
 void log_start_use(void);
+// Releases the log context of the calling thread, called before it exits
+void log_end_use(void);
 struct shared_log_queue_item_s;
 
 void log_flush_message(struct shared_log_queue_item_s* item_p)
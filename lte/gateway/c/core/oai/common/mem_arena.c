@@ -0,0 +1,246 @@
+/**
+ * Copyright 2020 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "mem_arena.h"
+
+// bstrlib treats any mlen <= 0 as write protected: bdestroy() and every
+// mutating call return BSTR_ERR without touching the memory. A dedicated
+// value lets us tell arena bstrings apart from bwriteprotect()ed ones.
+#define MEM_ARENA_BSTR_MLEN (-0x4152)
+
+#define MEM_ARENA_ROUND_UP(sIzE)                                               \
+  (((sIzE) + MEM_ARENA_ALIGNMENT - 1) & ~((size_t) MEM_ARENA_ALIGNMENT - 1))
+
+static __thread mem_arena_t* current_arena = NULL;
+
+//------------------------------------------------------------------------------
+mem_arena_t* mem_arena_create(size_t chunk_size) {
+  mem_arena_t* arena = calloc(1, sizeof(mem_arena_t));
+  if (!arena) {
+    return NULL;
+  }
+  arena->chunk_size = chunk_size ? chunk_size : MEM_ARENA_DEFAULT_CHUNK_SIZE;
+  return arena;
+}
+
+//------------------------------------------------------------------------------
+void mem_arena_destroy(mem_arena_t** arena) {
+  if (!arena || !*arena) {
+    return;
+  }
+  mem_arena_chunk_t* chunk = (*arena)->head;
+  while (chunk) {
+    mem_arena_chunk_t* next = chunk->next;
+    free(chunk);
+    chunk = next;
+  }
+  if (current_arena == *arena) {
+    current_arena = NULL;
+  }
+  free(*arena);
+  *arena = NULL;
+}
+
+//------------------------------------------------------------------------------
+void* mem_arena_alloc(mem_arena_t* arena, size_t size) {
+  if (!arena) {
+    return NULL;
+  }
+  size                     = MEM_ARENA_ROUND_UP(size ? size : 1);
+  mem_arena_chunk_t* chunk = arena->head;
+
+  if (!chunk || (chunk->size - chunk->used) < size) {
+    // Oversized requests get a dedicated chunk so that the current head,
+    // which probably still has room, keeps being used for small objects
+    size_t chunk_size = size > arena->chunk_size ? size : arena->chunk_size;
+    mem_arena_chunk_t* new_chunk =
+        malloc(sizeof(mem_arena_chunk_t) + chunk_size);
+    if (!new_chunk) {
+      return NULL;
+    }
+    new_chunk->size = chunk_size;
+    new_chunk->used = 0;
+    arena->num_chunks++;
+    if (chunk && size > arena->chunk_size) {
+      new_chunk->next = chunk->next;
+      chunk->next     = new_chunk;
+    } else {
+      new_chunk->next = chunk;
+      arena->head     = new_chunk;
+    }
+    chunk = new_chunk;
+  }
+
+  void* ptr = chunk->data + chunk->used;
+  chunk->used += size;
+  arena->num_allocs++;
+  memset(ptr, 0, size);
+  return ptr;
+}
+
+//------------------------------------------------------------------------------
+bstring mem_arena_blk2bstr(mem_arena_t* arena, const void* blk, int len) {
+  if (!arena || (!blk && len > 0) || len < 0) {
+    return NULL;
+  }
+  // Single allocation for the header and the data, NUL terminated like
+  // blk2bstr() does
+  struct tagbstring* b =
+      mem_arena_alloc(arena, sizeof(struct tagbstring) + len + 1);
+  if (!b) {
+    return NULL;
+  }
+  b->data = (unsigned char*) (b + 1);
+  if (len > 0) {
+    memcpy(b->data, blk, len);
+  }
+  b->data[len] = '\0';
+  b->slen      = len;
+  b->mlen      = MEM_ARENA_BSTR_MLEN;
+  return b;
+}
+
+//------------------------------------------------------------------------------
+bstring mem_arena_bstrcpy(mem_arena_t* arena, const_bstring b) {
+  if (!b || b->slen < 0 || !b->data) {
+    return NULL;
+  }
+  return mem_arena_blk2bstr(arena, b->data, b->slen);
+}
+
+//------------------------------------------------------------------------------
+bool mem_arena_bstr_is_arena(const_bstring b) {
+  return b && b->mlen == MEM_ARENA_BSTR_MLEN;
+}
+
+//------------------------------------------------------------------------------
+bstring mem_arena_bstr_persist(bstring b) {
+  if (mem_arena_bstr_is_arena(b)) {
+    return blk2bstr(b->data, b->slen);
+  }
+  return b;
+}
+
+//------------------------------------------------------------------------------
+bool mem_arena_owns(const mem_arena_t* arena, const void* ptr) {
+  if (!arena || !ptr) {
+    return false;
+  }
+  const uint8_t* p               = ptr;
+  const mem_arena_chunk_t* chunk = arena->head;
+  while (chunk) {
+    if (p >= chunk->data && p < chunk->data + chunk->used) {
+      return true;
+    }
+    chunk = chunk->next;
+  }
+  return false;
+}
+
+//------------------------------------------------------------------------------
+void mem_arena_set_current(mem_arena_t* arena) {
+  current_arena = arena;
+}
+
+//------------------------------------------------------------------------------
+mem_arena_t* mem_arena_get_current(void) {
+  return current_arena;
+}
+
+//------------------------------------------------------------------------------
+bstring mem_arena_current_blk2bstr(const void* blk, int len) {
+  if (current_arena) {
+    return mem_arena_blk2bstr(current_arena, blk, len);
+  }
+  return blk2bstr(blk, len);
+}
+
+//------------------------------------------------------------------------------
+void* mem_arena_current_calloc(size_t nmemb, size_t size) {
+  if (current_arena) {
+    if (size && nmemb > SIZE_MAX / size) {
+      return NULL;
+    }
+    return mem_arena_alloc(current_arena, nmemb * size);
+  }
+  return calloc(nmemb, size);
+}
+
+//------------------------------------------------------------------------------
+void mem_arena_current_free(void* ptr) {
+  if (!mem_arena_owns(current_arena, ptr)) {
+    free(ptr);
+  }
+}
+
+//------------------------------------------------------------------------------
+// asn1c reallocates the buffers it grows while decoding, so arena blocks
+// handed to it carry their size
+typedef struct mem_arena_asn_block_s {
+  size_t size;
+  uint8_t data[] __attribute__((aligned(MEM_ARENA_ALIGNMENT)));
+} mem_arena_asn_block_t;
+
+void* mem_arena_asn_malloc(size_t size) {
+  if (!current_arena) {
+    return malloc(size);
+  }
+  mem_arena_asn_block_t* block =
+      mem_arena_alloc(current_arena, sizeof(mem_arena_asn_block_t) + size);
+  if (!block) {
+    return NULL;
+  }
+  block->size = size;
+  return block->data;
+}
+
+//------------------------------------------------------------------------------
+void* mem_arena_asn_calloc(size_t nmemb, size_t size) {
+  if (!current_arena) {
+    return calloc(nmemb, size);
+  }
+  if (size && nmemb > SIZE_MAX / size) {
+    return NULL;
+  }
+  // Arena memory is zeroed already
+  return mem_arena_asn_malloc(nmemb * size);
+}
+
+//------------------------------------------------------------------------------
+void* mem_arena_asn_realloc(void* ptr, size_t size) {
+  if (!ptr) {
+    return mem_arena_asn_malloc(size);
+  }
+  if (!mem_arena_owns(current_arena, ptr)) {
+    return realloc(ptr, size);
+  }
+  mem_arena_asn_block_t* block =
+      (mem_arena_asn_block_t*) ((uint8_t*) ptr -
+                                offsetof(mem_arena_asn_block_t, data));
+  if (size <= block->size) {
+    return ptr;
+  }
+  void* new_ptr = mem_arena_asn_malloc(size);
+  if (new_ptr) {
+    memcpy(new_ptr, ptr, block->size);
+  }
+  return new_ptr;
+}
+
+//------------------------------------------------------------------------------
+void mem_arena_asn_free(void* ptr) {
+  mem_arena_current_free(ptr);
+}
@@ -0,0 +1,126 @@
+/**
+ * Copyright 2020 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*! \file mem_arena.h
+  \brief Chunked bump allocator whose lifetime is bound to one ITTI message.
+  Everything carved from an arena is released at once by mem_arena_destroy(),
+  which itti_free_msg_content() calls for the arena attached to the message.
+  bstrings handed out by the arena are write protected, so a stray
+  bdestroy()/bdestroy_wrapper() on them is a harmless no-op. Anything that
+  must outlive the message has to be copied out with mem_arena_bstr_persist().
+*/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "bstrlib.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MEM_ARENA_DEFAULT_CHUNK_SIZE 2048
+// Matches malloc() guarantees on the platforms we build for
+#define MEM_ARENA_ALIGNMENT 16
+
+typedef struct mem_arena_chunk_s {
+  struct mem_arena_chunk_s* next;
+  size_t size;
+  size_t used;
+  uint8_t data[] __attribute__((aligned(MEM_ARENA_ALIGNMENT)));
+} mem_arena_chunk_t;
+
+typedef struct mem_arena_s {
+  mem_arena_chunk_t* head;
+  size_t chunk_size;
+  uint32_t num_allocs;  // Number of objects carved from the arena
+  uint32_t num_chunks;  // Number of malloc calls made by the arena
+} mem_arena_t;
+
+/**
+ * Create an arena; chunk_size 0 selects MEM_ARENA_DEFAULT_CHUNK_SIZE.
+ * @return newly allocated arena, NULL on allocation failure
+ */
+mem_arena_t* mem_arena_create(size_t chunk_size);
+
+/**
+ * Release every allocation made from the arena and the arena itself.
+ * @param arena pointer to the arena pointer, set to NULL on return
+ */
+void mem_arena_destroy(mem_arena_t** arena);
+
+/**
+ * Allocate size bytes (zeroed, MEM_ARENA_ALIGNMENT aligned) from the arena.
+ */
+void* mem_arena_alloc(mem_arena_t* arena, size_t size);
+
+/**
+ * Arena equivalent of blk2bstr(): the returned bstring and its data both live
+ * in the arena and are write protected.
+ */
+bstring mem_arena_blk2bstr(mem_arena_t* arena, const void* blk, int len);
+
+/**
+ * Arena equivalent of bstrcpy().
+ */
+bstring mem_arena_bstrcpy(mem_arena_t* arena, const_bstring b);
+
+/**
+ * @return true if b was handed out by mem_arena_blk2bstr/mem_arena_bstrcpy
+ */
+bool mem_arena_bstr_is_arena(const_bstring b);
+
+/**
+ * Opt-in escape hatch for IEs that must outlive their message: returns a heap
+ * copy of an arena bstring, or b itself if it already lives on the heap.
+ */
+bstring mem_arena_bstr_persist(bstring b);
+
+/**
+ * @return true if ptr points into memory carved from the arena
+ */
+bool mem_arena_owns(const mem_arena_t* arena, const void* ptr);
+
+/**
+ * Install/fetch the arena scratch allocations of the calling thread should
+ * use while it handles the current message. NULL means plain heap.
+ */
+void mem_arena_set_current(mem_arena_t* arena);
+mem_arena_t* mem_arena_get_current(void);
+
+/**
+ * Allocators of the message decoders: they use the current arena of the
+ * thread if one is installed and the heap otherwise. Decoded IEs that must
+ * outlive the message are copied out with mem_arena_bstr_persist().
+ */
+bstring mem_arena_current_blk2bstr(const void* blk, int len);
+void* mem_arena_current_calloc(size_t nmemb, size_t size);
+// No-op for memory of the current arena
+void mem_arena_current_free(void* ptr);
+
+/**
+ * asn1c allocator hooks, wired into the generated asn_internal.h of S1AP.
+ * While an arena is current the decoded PDU lives in it and must not be
+ * freed with ASN_STRUCT_FREE once the arena is no longer current.
+ */
+void* mem_arena_asn_malloc(size_t size);
+void* mem_arena_asn_calloc(size_t nmemb, size_t size);
+void* mem_arena_asn_realloc(void* ptr, size_t size);
+void mem_arena_asn_free(void* ptr);
+
+#ifdef __cplusplus
+}
+#endif
@@ -73,6 +73,49 @@
 
 #define RELATIVE_CAPACITY (15)
 
+/*
+ * Overload control: the MME is overloaded once the queueing delay of its
+ * tasks stayed above the target for a whole interval (microseconds)
+ */
+#define OVERLOAD_TARGET_DELAY (5000)
+#define OVERLOAD_INTERVAL (100000)
+
+/*
+ * Worker threads MME_APP spreads the UEs over, 1 handles every message on the
+ * MME_APP thread itself
+ */
+#define MME_APP_SHARDS (1)
+#define MME_APP_SHARDS_MAX (16)
+
+/*
+ * UEs each UE state region is sized for, the records of UEs beyond are only
+ * kept in redis
+ */
+#define UE_STATE_REGION_MAX_UES (10000)
+
+/*
+ * IMSIs whose spare authentication vectors are cached, and how long the
+ * vectors are kept, in seconds
+ */
+#define AUTH_VECTOR_CACHE_MAX_UES (10000)
+#define AUTH_VECTOR_CACHE_TTL (3600)
+
+/*
+ * Queue of the events reported to eventd, and the RPCs sending it. Once the
+ * queue is full the oldest events are dropped, or 1 in EVENTD_SAMPLE_RATE
+ * events is kept when not 0
+ */
+#define EVENTD_MAX_QUEUED_EVENTS (4096)
+#define EVENTD_MAX_IN_FLIGHT (16)
+#define EVENTD_MAX_BATCH_SIZE (64)
+#define EVENTD_SAMPLE_RATE (0)
+
+/*
+ * Completion queue threads running the callbacks of the gRPC clients of the
+ * MME
+ */
+#define GRPC_CQ_THREADS (2)
+
 /*******************************************************************************
  * GRPC Service Constants
  ******************************************************************************/
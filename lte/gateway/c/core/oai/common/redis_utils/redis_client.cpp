@@ -17,6 +17,10 @@
 
 #include "redis_client.h"
 
+#include <algorithm>
+#include <future>
+#include <vector>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -128,6 +132,54 @@ int RedisClient::read_version(const std::string& key) {
   return wrapper_proto.version();
 }
 
+status_code_e RedisClient::read_batch(
+    const std::vector<std::string>& keys, size_t batch_size,
+    std::vector<std::string>& values_out, std::vector<bool>& found_out) {
+  if (!is_connected() || batch_size == 0) {
+    return RETURNerror;
+  }
+
+  std::vector<std::future<cpp_redis::reply>> batch_futs;
+  for (size_t first = 0; first < keys.size(); first += batch_size) {
+    size_t last = std::min(first + batch_size, keys.size());
+    batch_futs.emplace_back(db_client_->mget(std::vector<std::string>(
+        keys.begin() + first, keys.begin() + last)));
+  }
+  db_client_->sync_commit();
+
+  values_out.clear();
+  values_out.reserve(keys.size());
+  found_out.clear();
+  found_out.reserve(keys.size());
+  for (auto& batch_fut : batch_futs) {
+    auto reply = batch_fut.get();
+    if (reply.is_error() || !reply.is_array()) {
+      return RETURNerror;
+    }
+    // Keys removed since they were listed are nil
+    for (const auto& value : reply.as_array()) {
+      found_out.push_back(value.is_string());
+      values_out.emplace_back(value.is_string() ? value.as_string() : "");
+    }
+  }
+  return values_out.size() == keys.size() ? RETURNok : RETURNerror;
+}
+
+status_code_e RedisClient::unwrap_proto(
+    const std::string& value, Message& proto_msg, uint64_t* version) {
+  orc8r::RedisState wrapper_proto = orc8r::RedisState();
+  if (deserialize(wrapper_proto, value) != RETURNok) {
+    return RETURNerror;
+  }
+  if (deserialize(proto_msg, wrapper_proto.serialized_msg()) != RETURNok) {
+    return RETURNerror;
+  }
+  if (version) {
+    *version = wrapper_proto.version();
+  }
+  return RETURNok;
+}
+
 status_code_e RedisClient::clear_keys(
     const std::vector<std::string>& keys_to_clear) {
   auto db_write = db_client_->del(keys_to_clear);
@@ -84,6 +84,32 @@ class RedisClient {
 
   int read_version(const std::string& key);
 
+  /**
+   * Reads the values mapped to keys with MGET commands of at most batch_size
+   * keys each. All commands are pipelined and sent with a single commit.
+   * @param keys
+   * @param batch_size
+   * @param values_out value of each key in keys order, empty if missing
+   * @param found_out false for each key missing from the db, whose value
+   * must be skipped
+   * @return response code of operation
+   */
+  status_code_e read_batch(
+      const std::vector<std::string>& keys, size_t batch_size,
+      std::vector<std::string>& values_out, std::vector<bool>& found_out);
+
+  /**
+   * Parses a RedisState wrapped value, as returned by read_batch, into a
+   * protobuf object. Does not touch the db, safe to call from any thread.
+   * @param value
+   * @param proto_msg
+   * @param version set to the state version when not null
+   * @return response code of operation
+   */
+  static status_code_e unwrap_proto(
+      const std::string& value, google::protobuf::Message& proto_msg,
+      uint64_t* version);
+
   status_code_e clear_keys(const std::vector<std::string>& keys_to_clear);
 
   std::vector<std::string> get_keys(const std::string& pattern);
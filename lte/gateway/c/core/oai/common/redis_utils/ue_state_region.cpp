@@ -0,0 +1,498 @@
+/**
+ * Copyright 2020 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ue_state_region.h"
+
+#include <fcntl.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+namespace {
+constexpr uint64_t REGION_MAGIC          = 0x4554415453455540;  // "@UESTATE"
+constexpr uint32_t REGION_LAYOUT_VERSION = 1;
+// IMSI digits and their terminating NUL
+constexpr size_t IMSI_MAX_LENGTH = 16;
+constexpr uint32_t NO_SLOT       = UINT32_MAX;
+
+enum SlotState : uint32_t {
+  SLOT_FREE = 0,
+  SLOT_STORED,
+  SLOT_SPILLED,
+  // Tombstone, keeps the probe sequences going
+  SLOT_REMOVED,
+};
+
+// Regions reported in the service info
+std::mutex regions_mutex;
+std::vector<magma::lte::UeStateRegion*> regions;
+
+// Stable across processes, unlike std::hash
+uint64_t fnv1a(const void* data, size_t length) {
+  const uint8_t* bytes = (const uint8_t*) data;
+  uint64_t hash        = 0xcbf29ce484222325;
+
+  for (size_t i = 0; i < length; i++) {
+    hash = (hash ^ bytes[i]) * 0x100000001b3;
+  }
+  return hash;
+}
+
+uint64_t round_up(uint64_t value, uint64_t alignment) {
+  return (value + alignment - 1) / alignment * alignment;
+}
+}  // namespace
+
+namespace magma {
+namespace lte {
+
+struct UeStateRegion::RegionHeader {
+  uint64_t magic;
+  uint32_t layout_version;
+  uint32_t num_slots;
+  uint32_t record_size;
+  // Updated by the writer, read atomically
+  uint32_t stored;
+  uint32_t spilled;
+  uint32_t removed;
+  uint64_t bytes;
+};
+
+struct UeStateRegion::SlotHeader {
+  // Odd while the slot is written
+  uint32_t seq;
+  uint32_t state;
+  uint32_t length;
+  uint32_t reserved;
+  uint64_t version;
+  uint64_t checksum;
+  char imsi[IMSI_MAX_LENGTH];
+};
+
+UeStateRegion::UeStateRegion(
+    const std::string& path, uint32_t num_slots, uint32_t record_size)
+    : path_(path),
+      num_slots_(std::max(num_slots, 1u)),
+      page_size_(sysconf(_SC_PAGESIZE)),
+      fd_(-1),
+      base_(nullptr),
+      overflowed_(false) {
+  // The header takes the first page, the index the next ones
+  record_size_    = round_up(std::max(record_size, 1u), page_size_);
+  payload_offset_ = round_up(
+      page_size_ + (uint64_t) num_slots_ * sizeof(SlotHeader), page_size_);
+  file_size_ = payload_offset_ + (uint64_t) num_slots_ * record_size_;
+}
+
+UeStateRegion::~UeStateRegion() {
+  {
+    std::lock_guard<std::mutex> lock(regions_mutex);
+    regions.erase(
+        std::remove(regions.begin(), regions.end(), this), regions.end());
+  }
+  if (base_) {
+    munmap(base_, file_size_);
+  }
+  if (fd_ >= 0) {
+    close(fd_);
+  }
+}
+
+bool UeStateRegion::open() {
+  size_t slash = path_.rfind('/');
+  struct stat st;
+
+  if (slash != std::string::npos && slash > 0) {
+    // Fails with EEXIST on every open but the first
+    mkdir(path_.substr(0, slash).c_str(), 0700);
+  }
+  fd_ = ::open(path_.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+  if (fd_ < 0 || fstat(fd_, &st) != 0) {
+    return false;
+  }
+  // Sparse file, only the index and the stored records take memory. The
+  // index is allocated upfront: touching a page that the file system cannot
+  // allocate any more raises SIGBUS.
+  if ((uint64_t) st.st_size != file_size_ &&
+      (ftruncate(fd_, 0) != 0 || ftruncate(fd_, file_size_) != 0)) {
+    return false;
+  }
+  if (!reserve_index()) {
+    return false;
+  }
+  void* base = mmap(
+      nullptr, file_size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+  if (base == MAP_FAILED) {
+    return false;
+  }
+  base_ = (uint8_t*) base;
+
+  RegionHeader* header = (RegionHeader*) base_;
+  if (header->magic != REGION_MAGIC ||
+      header->layout_version != REGION_LAYOUT_VERSION ||
+      header->num_slots != num_slots_ || header->record_size != record_size_) {
+    if (!reset()) {
+      munmap(base_, file_size_);
+      base_ = nullptr;
+      return false;
+    }
+  } else {
+    repair();
+  }
+
+  std::lock_guard<std::mutex> lock(regions_mutex);
+  regions.push_back(this);
+  return true;
+}
+
+UeStateRegion::SlotHeader* UeStateRegion::slot(uint32_t index) const {
+  return (SlotHeader*) (base_ + page_size_) + index;
+}
+
+uint8_t* UeStateRegion::payload(uint32_t index) const {
+  return base_ + payload_offset_ + (uint64_t) index * record_size_;
+}
+
+bool UeStateRegion::reserve_index() {
+  return posix_fallocate(fd_, 0, payload_offset_) == 0;
+}
+
+bool UeStateRegion::reset() {
+  RegionHeader* header = (RegionHeader*) base_;
+
+  header->magic = 0;
+  // Nobody reads the region yet, the index is dropped at once and allocated
+  // again
+  if (fallocate(
+          fd_, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE, page_size_,
+          file_size_ - page_size_) != 0) {
+    memset(slot(0), 0, payload_offset_ - page_size_);
+  } else if (!reserve_index()) {
+    return false;
+  }
+  header->stored         = 0;
+  header->spilled        = 0;
+  header->removed        = 0;
+  header->bytes          = 0;
+  header->layout_version = REGION_LAYOUT_VERSION;
+  header->num_slots      = num_slots_;
+  header->record_size    = record_size_;
+  __atomic_store_n(&header->magic, REGION_MAGIC, __ATOMIC_RELEASE);
+  return true;
+}
+
+void UeStateRegion::repair() {
+  RegionHeader* header = (RegionHeader*) base_;
+  uint32_t stored      = 0;
+  uint32_t spilled     = 0;
+  uint32_t removed     = 0;
+  uint64_t bytes       = 0;
+
+  for (uint32_t index = 0; index < num_slots_; index++) {
+    SlotHeader* s = slot(index);
+    // Torn by a crash: the record is still in redis if its IMSI made it
+    if ((s->seq & 1) || s->state > SLOT_REMOVED) {
+      bool has_imsi = (s->state == SLOT_STORED || s->state == SLOT_SPILLED) &&
+                      memchr(s->imsi, '\0', IMSI_MAX_LENGTH) && s->imsi[0];
+      s->state    = has_imsi ? SLOT_SPILLED : SLOT_REMOVED;
+      s->length   = 0;
+      s->checksum = 0;
+      s->seq++;
+    }
+    switch (s->state) {
+      case SLOT_STORED:
+        stored++;
+        bytes += s->length;
+        break;
+      case SLOT_SPILLED:
+        spilled++;
+        break;
+      case SLOT_REMOVED:
+        removed++;
+        break;
+      default:
+        break;
+    }
+  }
+  header->stored  = stored;
+  header->spilled = spilled;
+  header->removed = removed;
+  header->bytes   = bytes;
+}
+
+void UeStateRegion::clear() {
+  if (base_ == nullptr) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(writer_mutex_);
+  // Slot by slot, concurrent readers see free slots. The index keeps its
+  // pages, the payloads give theirs back.
+  for (uint32_t index = 0; index < num_slots_; index++) {
+    if (slot(index)->state != SLOT_FREE) {
+      update_slot(index, SLOT_FREE, "", nullptr, 0);
+    }
+  }
+  fallocate(
+      fd_, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE, payload_offset_,
+      file_size_ - payload_offset_);
+  overflowed_ = false;
+}
+
+uint32_t UeStateRegion::find_slot(
+    const std::string& imsi, uint32_t* free_index) const {
+  uint32_t start = fnv1a(imsi.data(), imsi.size()) % num_slots_;
+
+  *free_index = NO_SLOT;
+  for (uint32_t i = 0; i < num_slots_; i++) {
+    uint32_t index      = (start + i) % num_slots_;
+    const SlotHeader* s = slot(index);
+    if (s->state == SLOT_FREE || s->state == SLOT_REMOVED) {
+      if (*free_index == NO_SLOT) {
+        *free_index = index;
+      }
+      if (s->state == SLOT_FREE) {
+        return NO_SLOT;
+      }
+    } else if (strncmp(s->imsi, imsi.c_str(), IMSI_MAX_LENGTH) == 0) {
+      return index;
+    }
+  }
+  return NO_SLOT;
+}
+
+void UeStateRegion::update_slot(
+    uint32_t index, uint32_t state, const std::string& imsi,
+    const std::string* record, uint64_t version) {
+  RegionHeader* header = (RegionHeader*) base_;
+  SlotHeader* s        = slot(index);
+  uint32_t old_state   = s->state;
+  uint32_t old_length  = s->length;
+  uint32_t seq         = s->seq;
+
+  __atomic_store_n(&s->seq, seq + 1, __ATOMIC_RELAXED);
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+  s->state   = state;
+  s->version = version;
+  strncpy(s->imsi, imsi.c_str(), IMSI_MAX_LENGTH);
+  if (state == SLOT_STORED) {
+    memcpy(payload(index), record->data(), record->size());
+    s->length   = record->size();
+    s->checksum = fnv1a(record->data(), record->size());
+  } else {
+    s->length   = 0;
+    s->checksum = 0;
+  }
+  __atomic_store_n(&s->seq, seq + 2, __ATOMIC_RELEASE);
+
+  uint32_t* counters[] = {nullptr, &header->stored, &header->spilled,
+                          &header->removed};
+  if (counters[old_state]) {
+    __atomic_fetch_sub(counters[old_state], 1, __ATOMIC_RELAXED);
+  }
+  if (counters[state]) {
+    __atomic_fetch_add(counters[state], 1, __ATOMIC_RELAXED);
+  }
+  __atomic_fetch_add(
+      &header->bytes, (uint64_t) s->length - old_length, __ATOMIC_RELAXED);
+}
+
+bool UeStateRegion::reserve_payload(uint32_t index, uint32_t length) {
+  if (length == 0) {
+    return true;
+  }
+  return posix_fallocate(
+             fd_, payload_offset_ + (uint64_t) index * record_size_,
+             round_up(length, page_size_)) == 0;
+}
+
+void UeStateRegion::release_payload(uint32_t index) {
+  fallocate(
+      fd_, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE,
+      payload_offset_ + (uint64_t) index * record_size_, record_size_);
+}
+
+void UeStateRegion::write(
+    const std::string& imsi, const std::string& record, uint64_t version) {
+  uint32_t free_index = NO_SLOT;
+
+  if (base_ == nullptr || imsi.empty() || imsi.size() >= IMSI_MAX_LENGTH) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(writer_mutex_);
+  uint32_t index = find_slot(imsi, &free_index);
+  if (index == NO_SLOT) {
+    // Full: the restore finds the record missing and falls back to redis
+    if (free_index == NO_SLOT) {
+      overflowed_ = true;
+      return;
+    }
+    index = free_index;
+  }
+  // Out of memory on tmpfs, the record is only in redis like a large one
+  uint32_t state = record.size() <= record_size_ &&
+                           reserve_payload(index, record.size()) ?
+                       SLOT_STORED :
+                       SLOT_SPILLED;
+  update_slot(index, state, imsi, &record, version);
+}
+
+void UeStateRegion::remove(const std::string& imsi) {
+  uint32_t free_index = NO_SLOT;
+
+  if (base_ == nullptr) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(writer_mutex_);
+  uint32_t index = find_slot(imsi, &free_index);
+  if (index == NO_SLOT) {
+    return;
+  }
+  // No probe sequence goes past a free slot, the tombstones right before
+  // one are free slots too
+  bool last = slot((index + 1) % num_slots_)->state == SLOT_FREE;
+  update_slot(index, last ? SLOT_FREE : SLOT_REMOVED, "", nullptr, 0);
+  release_payload(index);
+  if (last) {
+    for (uint32_t prev = (index + num_slots_ - 1) % num_slots_;
+         slot(prev)->state == SLOT_REMOVED;
+         prev = (prev + num_slots_ - 1) % num_slots_) {
+      update_slot(prev, SLOT_FREE, "", nullptr, 0);
+    }
+  }
+}
+
+// Copies the header of a slot, and its record when stored for imsi, or for
+// any IMSI if null
+void UeStateRegion::copy_slot(
+    uint32_t index, const char* imsi, SlotHeader* copy,
+    std::string* record) const {
+  const SlotHeader* s = slot(index);
+
+  for (;;) {
+    uint32_t seq = __atomic_load_n(&s->seq, __ATOMIC_ACQUIRE);
+    if (seq & 1) {
+      sched_yield();
+      continue;
+    }
+    memcpy(copy, s, sizeof(*copy));
+    if (copy->state == SLOT_STORED &&
+        (!imsi || strncmp(copy->imsi, imsi, IMSI_MAX_LENGTH) == 0)) {
+      record->assign(
+          (const char*) payload(index), std::min(copy->length, record_size_));
+    }
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    if (__atomic_load_n(&s->seq, __ATOMIC_RELAXED) == seq) {
+      return;
+    }
+  }
+}
+
+UeStateRegion::ReadResult UeStateRegion::read(
+    const std::string& imsi, std::string* record_out,
+    uint64_t* version_out) const {
+  if (base_ == nullptr || imsi.empty() || imsi.size() >= IMSI_MAX_LENGTH) {
+    return ReadResult::NOT_FOUND;
+  }
+  uint32_t start = fnv1a(imsi.data(), imsi.size()) % num_slots_;
+
+  for (uint32_t i = 0; i < num_slots_; i++) {
+    SlotHeader copy;
+    std::string record;
+    copy_slot((start + i) % num_slots_, imsi.c_str(), &copy, &record);
+    if (copy.state == SLOT_FREE) {
+      return ReadResult::NOT_FOUND;
+    }
+    if (copy.state == SLOT_REMOVED ||
+        strncmp(copy.imsi, imsi.c_str(), IMSI_MAX_LENGTH) != 0) {
+      continue;
+    }
+    if (version_out) {
+      *version_out = copy.version;
+    }
+    if (copy.state == SLOT_SPILLED ||
+        fnv1a(record.data(), record.size()) != copy.checksum) {
+      return ReadResult::SPILLED;
+    }
+    if (record_out) {
+      *record_out = std::move(record);
+    }
+    return ReadResult::FOUND;
+  }
+  return ReadResult::NOT_FOUND;
+}
+
+void UeStateRegion::for_each(const RecordCallback& callback) const {
+  if (base_ == nullptr) {
+    return;
+  }
+  std::string record;
+  for (uint32_t index = 0; index < num_slots_; index++) {
+    SlotHeader copy;
+    copy_slot(index, nullptr, &copy, &record);
+    if (copy.state != SLOT_STORED ||
+        fnv1a(record.data(), record.size()) != copy.checksum) {
+      continue;
+    }
+    copy.imsi[IMSI_MAX_LENGTH - 1] = '\0';
+    if (callback(copy.imsi, record)) {
+      return;
+    }
+  }
+}
+
+uint32_t UeStateRegion::size() const {
+  const RegionHeader* header = (const RegionHeader*) base_;
+
+  if (header == nullptr) {
+    return 0;
+  }
+  return __atomic_load_n(&header->stored, __ATOMIC_RELAXED) +
+         __atomic_load_n(&header->spilled, __ATOMIC_RELAXED);
+}
+
+bool UeStateRegion::holds_all_records() const {
+  const RegionHeader* header = (const RegionHeader*) base_;
+
+  return header && !overflowed_ &&
+         __atomic_load_n(&header->spilled, __ATOMIC_RELAXED) == 0;
+}
+
+char* UeStateRegion::dump_all_to_string() {
+  std::ostringstream dump;
+  std::lock_guard<std::mutex> lock(regions_mutex);
+
+  for (const UeStateRegion* region : regions) {
+    const RegionHeader* header = (const RegionHeader*) region->base_;
+    dump << region->path_ << ": "
+         << __atomic_load_n(&header->stored, __ATOMIC_RELAXED)
+         << " records stored in "
+         << __atomic_load_n(&header->bytes, __ATOMIC_RELAXED) << " bytes, "
+         << __atomic_load_n(&header->spilled, __ATOMIC_RELAXED)
+         << " spilled to redis, "
+         << __atomic_load_n(&header->removed, __ATOMIC_RELAXED)
+         << " tombstones, " << region->num_slots_ << " slots of "
+         << region->record_size_ << " bytes\n";
+  }
+  return strdup(dump.str().c_str());
+}
+
+}  // namespace lte
+}  // namespace magma
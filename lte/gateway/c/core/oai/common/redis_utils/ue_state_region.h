@@ -0,0 +1,153 @@
+/**
+ * Copyright 2020 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <string>
+
+namespace magma {
+namespace lte {
+
+/**
+ * UeStateRegion keeps the UE state records of a task in a file mapped in
+ * memory, next to their copy in redis. The file is meant to live on tmpfs:
+ * it survives a restart of the process, so that the UE state is restored
+ * from memory instead of being fetched from redis, but not a reboot, after
+ * which redis holds the only copy.
+ *
+ * The region is a hash table of fixed-size slots keyed by IMSI, with the
+ * slot headers packed in an index followed by the payloads, so that only
+ * the pages of the records stored are ever allocated. The pages of a record
+ * are allocated before it is copied in: a record that does not fit in its
+ * slot, or in the file system, is flagged as spilled and only kept in redis.
+ * Each slot is guarded by a sequence number, odd while the slot is written:
+ * slots torn by a crash are found on open() and flagged as spilled, and
+ * readers on any thread get consistent copies without taking a lock.
+ *
+ * Writers are serialized, the MME_APP shards persisting their UEs may write
+ * concurrently.
+ */
+class UeStateRegion {
+ public:
+  enum class ReadResult {
+    NOT_FOUND,
+    FOUND,
+    // Only in redis
+    SPILLED,
+  };
+
+  using RecordCallback =
+      std::function<bool(const std::string& imsi, const std::string& record)>;
+
+  /**
+   * @param num_slots: number of slots of the hash table, twice the UEs kept
+   * @param record_size: largest record kept, rounded up to pages
+   */
+  UeStateRegion(
+      const std::string& path, uint32_t num_slots, uint32_t record_size);
+  ~UeStateRegion();
+
+  /**
+   * Maps the region file, creating it and its directory if needed. A file
+   * of another layout is reset. Not thread safe.
+   * @return false if the region cannot be used
+   */
+  bool open();
+
+  /**
+   * Stores the record of an IMSI, flagged as spilled if it does not fit in
+   * its slot or if its pages cannot be allocated
+   */
+  void write(
+      const std::string& imsi, const std::string& record, uint64_t version);
+
+  void remove(const std::string& imsi);
+
+  /**
+   * Drops every record
+   */
+  void clear();
+
+  /**
+   * Copies the record of an IMSI without locking, from any thread
+   * @param record_out set when found
+   * @param version_out set when found
+   */
+  ReadResult read(
+      const std::string& imsi, std::string* record_out,
+      uint64_t* version_out) const;
+
+  /**
+   * Calls callback on a consistent copy of every stored record, without
+   * locking, from any thread, until it returns true. Spilled records are
+   * skipped.
+   */
+  void for_each(const RecordCallback& callback) const;
+
+  /**
+   * @return number of records stored or spilled
+   */
+  uint32_t size() const;
+
+  /**
+   * @return false if some records written since the last clear() are only
+   * in redis, because they spilled or the region was full
+   */
+  bool holds_all_records() const;
+
+  /**
+   * @return the usage of every open region in a string to free, for the
+   * service info
+   */
+  static char* dump_all_to_string();
+
+ private:
+  struct RegionHeader;
+  struct SlotHeader;
+
+  SlotHeader* slot(uint32_t index) const;
+  uint8_t* payload(uint32_t index) const;
+  void copy_slot(
+      uint32_t index, const char* imsi, SlotHeader* copy,
+      std::string* record) const;
+  uint32_t find_slot(const std::string& imsi, uint32_t* free_index) const;
+  bool reserve_payload(uint32_t index, uint32_t length);
+  void update_slot(
+      uint32_t index, uint32_t state, const std::string& imsi,
+      const std::string* record, uint64_t version);
+  void release_payload(uint32_t index);
+  bool reserve_index();
+  bool reset();
+  void repair();
+
+  std::string path_;
+  uint32_t num_slots_;
+  uint32_t record_size_;
+  uint64_t page_size_;
+  uint64_t payload_offset_;
+  uint64_t file_size_;
+  int fd_;
+  uint8_t* base_;
+  // Set when a record is dropped because the region is full
+  std::atomic<bool> overflowed_;
+  // Taken by write(), remove() and clear(), readers go without it
+  std::mutex writer_mutex_;
+};
+
+}  // namespace lte
+}  // namespace magma
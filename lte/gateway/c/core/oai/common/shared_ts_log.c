@@ -289,6 +289,14 @@ void shared_log_start_use(void) {
   }
 }
 
+//------------------------------------------------------------------------------
+void shared_log_end_use(void) {
+  if (g_shared_log.thread_context_htbl) {
+    hashtable_ts_free(
+        g_shared_log.thread_context_htbl, (hash_key_t) pthread_self());
+  }
+}
+
 //------------------------------------------------------------------------------
 void shared_log_flush_messages(void) {
   shared_log_queue_item_t* item_p = NULL;
@@ -336,6 +344,7 @@ static void shared_log_exit(void) {
   destroy_task_context(&shared_log_task_zmq_ctx);
   shared_log_flush_messages();
   hashtable_ts_destroy(g_shared_log.thread_context_htbl);
+  g_shared_log.thread_context_htbl = NULL;
   lfds710_queue_bmm_cleanup(
       &g_shared_log.log_message_queue,
       shared_log_element_dequeue_cleanup_callback);
@@ -80,6 +80,7 @@ void shared_log_get_elapsed_time_since_start(
 int shared_log_init(const int max_threadsP);
 void shared_log_itti_connect(void);
 void shared_log_start_use(void);
+void shared_log_end_use(void);
 void shared_log_flush_messages(void);
 void shared_log_item(shared_log_queue_item_t* messageP);
 #endif /* FILE_SHARED_TS_LOG_SEEN */
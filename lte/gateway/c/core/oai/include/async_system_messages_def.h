@@ -39,3 +39,6 @@
 
 MESSAGE_DEF(
     ASYNC_SYSTEM_COMMAND, itti_async_system_command_t, async_system_command)
+MESSAGE_DEF(
+    ASYNC_SYSTEM_COMMAND_RESULT, itti_async_system_command_result_t,
+    async_system_command_result)
@@ -42,10 +42,20 @@
 #include "bstrlib.h"
 
 #define ASYNC_SYSTEM_COMMAND(mSGpTR) (mSGpTR)->ittiMsg.async_system_command
+#define ASYNC_SYSTEM_COMMAND_RESULT(mSGpTR)                                    \
+  (mSGpTR)->ittiMsg.async_system_command_result
 
 typedef struct itti_async_system_command_s {
   bstring system_command;
+  // Written to the standard input of the command if not NULL
+  bstring input;
   bool is_abort_on_error;
+  // The exit status is sent back to the sender task if set
+  bool notify_result;
 } itti_async_system_command_t;
 
+typedef struct itti_async_system_command_result_s {
+  int exit_status;
+} itti_async_system_command_result_t;
+
 #endif /* FILE_ASYNC_SYSTEM_MESSAGES_TYPES_SEEN */
@@ -47,3 +47,5 @@ MESSAGE_DEF(
     GTPV1U_DELETE_TUNNEL_RESP, Gtpv1uDeleteTunnelResp, gtpv1uDeleteTunnelResp)
 MESSAGE_DEF(GTPV1U_TUNNEL_DATA_IND, Gtpv1uTunnelDataInd, gtpv1uTunnelDataInd)
 MESSAGE_DEF(GTPV1U_TUNNEL_DATA_REQ, Gtpv1uTunnelDataReq, gtpv1uTunnelDataReq)
+MESSAGE_DEF(
+    GTPV1U_TUNNEL_FAILURE_IND, Gtpv1uTunnelFailureInd, gtpv1uTunnelFailureInd)
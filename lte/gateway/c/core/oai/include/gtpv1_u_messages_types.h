@@ -95,4 +95,12 @@ typedef struct Gtpv1uTunnelDataReq_s {
   teid_t S1u_enb_teid;    ///< Tunnel Endpoint Identifier
 } Gtpv1uTunnelDataReq;
 
+// A tunnel add or delete failed after the GTP tunnel op returned
+typedef struct Gtpv1uTunnelFailureInd_s {
+  bool is_add;          ///< Failure to add the tunnel, or else to delete it
+  teid_t sgw_S1u_teid;  ///< SGW S1U local Tunnel Endpoint Identifier
+  teid_t enb_S1u_teid;  ///< eNB S1U Tunnel Endpoint Identifier
+  int error;            ///< errno of the failure
+} Gtpv1uTunnelFailureInd;
+
 #endif /* FILE_GTPV1_U_MESSAGES_TYPES_SEEN */
@@ -40,8 +40,15 @@ int mme_nas_state_init(const mme_config_t* mme_config_p);
 mme_app_desc_t* get_mme_nas_state(bool read_from_db);
 
 /**
- * Write the MME/NAS state to data store after processing any message. This is a
- * thread safe call
+ * Serialize the MME/NAS state after processing any message, while no other
+ * MME_APP shard runs
+ */
+void snapshot_mme_nas_state(void);
+
+/**
+ * Write the MME/NAS state serialized by snapshot_mme_nas_state() on the
+ * calling thread to data store. This is a thread safe call, other shards may
+ * run meanwhile.
  */
 void put_mme_nas_state(void);
 
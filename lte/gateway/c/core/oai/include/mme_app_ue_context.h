@@ -465,6 +465,8 @@ typedef struct ue_mm_context_s {
    * when UE is in ECM_IDLE state*/
   emm_cn_activate_dedicated_bearer_req_t* pending_ded_ber_req[BEARERS_PER_UE];
   LIST_HEAD(s11_procedures_s, mme_app_s11_proc_s) * s11_procedures;
+  /* Slot index + 1 in the UE context pool, 0 when not allocated from it */
+  uint32_t pool_slot;
 } ue_mm_context_t;
 
 typedef struct mme_ue_context_s {
@@ -75,6 +75,7 @@
 #define MME_CONFIG_STRING_REALM "REALM"
 #define MME_CONFIG_STRING_MAXENB "MAXENB"
 #define MME_CONFIG_STRING_MAXUE "MAXUE"
+#define MME_CONFIG_STRING_MAX_S11_TRANSACTIONS "MAX_S11_TRANSACTIONS"
 #define MME_CONFIG_STRING_RELATIVE_CAPACITY "RELATIVE_CAPACITY"
 
 #define MME_CONFIG_STRING_USE_STATELESS "USE_STATELESS"
@@ -203,11 +204,33 @@
 // Congestion Control
 #define MME_CONFIG_STRING_CONGESTION_CONTROL_ENABLED                           \
   "CONGESTION_CONTROL_ENABLED"
-#define MME_CONFIG_STRING_S1AP_ZMQ_TH "S1AP_ZMQ_TH"
-#define MME_CONFIG_STRING_MME_APP_ZMQ_CONGEST_TH "MME_APP_ZMQ_CONGEST_TH"
-#define MME_CONFIG_STRING_MME_APP_ZMQ_AUTH_TH "MME_APP_ZMQ_AUTH_TH"
-#define MME_CONFIG_STRING_MME_APP_ZMQ_IDENT_TH "MME_APP_ZMQ_IDENT_TH"
-#define MME_CONFIG_STRING_MME_APP_ZMQ_SMC_TH "MME_APP_ZMQ_SMC_TH"
+#define MME_CONFIG_STRING_OVERLOAD_TARGET_DELAY "OVERLOAD_TARGET_DELAY"
+#define MME_CONFIG_STRING_OVERLOAD_INTERVAL "OVERLOAD_INTERVAL"
+
+// Latency tracing of the ITTI tasks
+#define MME_CONFIG_STRING_ITTI_TRACING "ITTI_TRACING"
+// 1 in N attach and TAU procedures kept in the procedure trace
+#define MME_CONFIG_STRING_NAS_PROC_TRACE_SAMPLING "NAS_PROC_TRACE_SAMPLING"
+
+// Worker threads of MME_APP
+#define MME_CONFIG_STRING_MME_APP_SHARDS "MME_APP_SHARDS"
+
+// UE state regions kept next to redis for warm restarts
+#define MME_CONFIG_STRING_UE_STATE_REGION_DIR "UE_STATE_REGION_DIR"
+#define MME_CONFIG_STRING_UE_STATE_REGION_MAX_UES "UE_STATE_REGION_MAX_UES"
+
+// Authentication vectors kept by IMSI across UE contexts
+#define MME_CONFIG_STRING_AUTH_VECTOR_CACHE_MAX_UES "AUTH_VECTOR_CACHE_MAX_UES"
+#define MME_CONFIG_STRING_AUTH_VECTOR_CACHE_TTL "AUTH_VECTOR_CACHE_TTL"
+
+// Events reported to eventd
+#define MME_CONFIG_STRING_EVENTD_MAX_QUEUED_EVENTS "EVENTD_MAX_QUEUED_EVENTS"
+#define MME_CONFIG_STRING_EVENTD_MAX_IN_FLIGHT "EVENTD_MAX_IN_FLIGHT"
+#define MME_CONFIG_STRING_EVENTD_MAX_BATCH_SIZE "EVENTD_MAX_BATCH_SIZE"
+#define MME_CONFIG_STRING_EVENTD_SAMPLE_RATE "EVENTD_SAMPLE_RATE"
+
+// Completion queue threads of the gRPC clients
+#define MME_CONFIG_STRING_GRPC_CQ_THREADS "GRPC_CQ_THREADS"
 
 // INBOUND ROAMING
 #define MME_CONFIG_STRING_FED_MODE_MAP "FEDERATED_MODE_MAP"
@@ -371,6 +394,8 @@ typedef struct mme_config_s {
 
   uint32_t max_enbs;
   uint32_t max_ues;
+  // Outstanding S11 transactions the GTPv2-C stack preallocates for
+  uint32_t max_s11_trxns;
 
   uint8_t relative_capacity;
 
@@ -410,11 +435,26 @@ typedef struct mme_config_s {
   bool enable_converged_core;
 
   bool enable_congestion_control;
-  long s1ap_zmq_th;
-  long mme_app_zmq_congest_th;
-  long mme_app_zmq_auth_th;
-  long mme_app_zmq_ident_th;
-  long mme_app_zmq_smc_th;
+  long overload_target_delay;  // microseconds
+  long overload_interval;      // microseconds
+
+  bool itti_tracing;
+  uint32_t nas_proc_trace_sampling;  // 0 when disabled
+
+  uint32_t mme_app_shards;
+
+  bstring ue_state_region_dir;  // NULL or empty when disabled
+  uint32_t ue_state_region_max_ues;
+
+  uint32_t auth_vector_cache_max_ues;  // 0 when disabled
+  uint32_t auth_vector_cache_ttl;      // seconds
+
+  uint32_t eventd_max_queued_events;
+  uint32_t eventd_max_in_flight;
+  uint32_t eventd_max_batch_size;
+  uint32_t eventd_sample_rate;  // 0 to drop the oldest events instead
+
+  uint32_t grpc_cq_threads;
 } mme_config_t;
 
 extern mme_config_t mme_config;
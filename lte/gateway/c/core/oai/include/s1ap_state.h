@@ -43,6 +43,20 @@ ue_description_t* s1ap_state_get_ue_mmeid(mme_ue_s1ap_id_t mme_ue_s1ap_id);
 
 ue_description_t* s1ap_state_get_ue_imsi(imsi64_t imsi64);
 
+/**
+ * Index ue_ref under its mme_ue_s1ap_id for s1ap_state_get_ue_mmeid(), to be
+ * called whenever the MME assigns the id to an S1AP UE context
+ * @param ue_ref UE context already inserted in the UE state hashtable
+ */
+void s1ap_state_bind_ue_mmeid(const ue_description_t* ue_ref);
+
+/**
+ * Drop the mme_ue_s1ap_id index entry of ue_ref, unless the id has since been
+ * bound to another UE context
+ * @param ue_ref UE context about to be removed
+ */
+void s1ap_state_unbind_ue_mmeid(const ue_description_t* ue_ref);
+
 /**
  * Return unique composite id for S1AP UE context
  * @param sctp_assoc_id unique SCTP assoc id
@@ -62,6 +76,19 @@ void put_s1ap_imsi_map(void);
  */
 s1ap_imsi_map_t* get_s1ap_imsi_map(void);
 
+/**
+ * Record the IMSI of mme_ue_s1ap_id in s1ap_imsi_map, keeping the reverse
+ * IMSI index used by s1ap_state_get_ue_imsi() in sync
+ * @return result of the insertion in mme_ue_id_imsi_htbl
+ */
+hashtable_rc_t s1ap_imsi_map_insert(
+    mme_ue_s1ap_id_t mme_ue_s1ap_id, imsi64_t imsi64);
+
+/**
+ * Forget the IMSI of mme_ue_s1ap_id in s1ap_imsi_map and its reverse index
+ */
+void s1ap_imsi_map_remove(mme_ue_s1ap_id_t mme_ue_s1ap_id);
+
 hash_table_ts_t* get_s1ap_ue_state(void);
 
 int read_s1ap_ue_state_db(void);
@@ -70,14 +97,6 @@ void put_s1ap_ue_state(imsi64_t imsi64);
 
 void delete_s1ap_ue_state(imsi64_t imsi64);
 
-bool s1ap_ue_compare_by_mme_ue_id_cb(
-    __attribute__((unused)) hash_key_t keyP, void* elementP, void* parameterP,
-    void** resultP);
-
-bool s1ap_ue_compare_by_imsi(
-    __attribute__((unused)) hash_key_t keyP, void* elementP, void* parameterP,
-    void** resultP);
-
 bool get_mme_ue_ids_no_imsi(
     const hash_key_t keyP, uint64_t const dataP,
     __attribute__((unused)) void* argP, void** resultP);
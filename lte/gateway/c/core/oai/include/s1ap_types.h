@@ -41,6 +41,8 @@ typedef struct s1ap_state_s {
 
 typedef struct s1ap_imsi_map_s {
   hash_table_uint64_ts_t* mme_ue_id_imsi_htbl;
+  // Reverse of mme_ue_id_imsi_htbl, key is imsi64; rebuilt from it on restore
+  hash_table_uint64_ts_t* imsi_mme_ue_id_htbl;
 } s1ap_imsi_map_t;
 
 enum s1_timer_class_s {
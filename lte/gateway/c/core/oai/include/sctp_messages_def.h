@@ -39,6 +39,7 @@
 
 MESSAGE_DEF(SCTP_INIT_MSG, sctp_init_t, sctpInit)
 MESSAGE_DEF(SCTP_DATA_REQ, sctp_data_req_t, sctp_data_req)
+MESSAGE_DEF(SCTP_DATA_BATCH_REQ, sctp_data_batch_req_t, sctp_data_batch_req)
 MESSAGE_DEF(SCTP_DATA_IND, sctp_data_ind_t, sctp_data_ind)
 MESSAGE_DEF(SCTP_DATA_CNF, sctp_data_cnf_t, sctp_data_cnf)
 MESSAGE_DEF(SCTP_NEW_ASSOCIATION, sctp_new_peer_t, sctp_new_peer)
@@ -48,6 +48,7 @@ typedef uint32_t sctp_ppid_t;
 
 #define SCTP_DATA_IND(msg) (msg)->ittiMsg.sctp_data_ind
 #define SCTP_DATA_REQ(msg) (msg)->ittiMsg.sctp_data_req
+#define SCTP_DATA_BATCH_REQ(msg) (msg)->ittiMsg.sctp_data_batch_req
 #define SCTP_DATA_CNF(msg) (msg)->ittiMsg.sctp_data_cnf
 #define SCTP_INIT_MSG(msg) (msg)->ittiMsg.sctpInit
 #define SCTP_NEW_ASSOCIATION(msg) (msg)->ittiMsg.sctp_new_peer
@@ -80,6 +81,20 @@ typedef struct sctp_data_req_s {
   sctp_ppid_t ppid;
 } sctp_data_req_t;
 
+typedef struct sctp_data_target_s {
+  sctp_assoc_id_t assoc_id;
+  sctp_stream_id_t stream;
+} sctp_data_target_t;
+
+// Same encoded PDU sent to several associations (paging, broadcast messages).
+// targets is carved from the message arena and released with the message.
+typedef struct sctp_data_batch_req_s {
+  bstring payload;
+  sctp_data_target_t* targets;
+  uint16_t num_targets;
+  sctp_ppid_t ppid;
+} sctp_data_batch_req_t;
+
 typedef struct sctp_data_ind_s {
   bstring payload;           ///< SCTP buffer
   sctp_assoc_id_t assoc_id;  ///< SCTP physical association ID
@@ -157,6 +157,22 @@ void observe_histogram(
  */
 void service303_set_application_health(application_health_t health);
 
+/**
+ * Report the output of dump under key in the meta of the service info, e.g.
+ * returned by GetServiceInfo, along with the dumps set under other keys.
+ * Can be called before start_service303_server.
+ * @param key: meta key
+ * @param dump: returns a string the service frees, NULL to report nothing
+ */
+void service303_set_service_info_dump(const char* key, char* (*dump)(void));
+
+/**
+ * Set the number of threads running the callbacks of the gRPC clients of the
+ * service. Only effective when called before any client is created.
+ * @param num_threads: completion queue threads, at least 1
+ */
+void service303_set_grpc_threads(uint32_t num_threads);
+
 #ifdef __cplusplus
 }
 #endif
@@ -62,6 +62,8 @@
 #define SGW_CONFIG_STRING_OVS_GTP_ECHO "GTP_ECHO"
 #define SGW_CONFIG_STRING_OVS_PIPELINED_CONFIG_ENABLED                         \
   "PIPELINED_CONFIG_ENABLED"
+#define SGW_CONFIG_STRING_OVS_PIPELINED_BATCH_SIZE "PIPELINED_BATCH_SIZE"
+#define SGW_CONFIG_STRING_OVS_PIPELINED_BATCH_DELAY "PIPELINED_BATCH_DELAY"
 
 #define SPGW_ABORT_ON_ERROR true
 #define SPGW_WARN_ON_ERROR false
@@ -77,6 +79,10 @@ typedef struct ovs_config_s {
   bool multi_tunnel;
   bool gtp_echo;
   bool pipelined_managed_tbl0;
+  // Tunnel updates coalesced in a RPC to pipelined, 1 to send them one by
+  // one, and the longest they wait to be sent, in microseconds
+  uint32_t pipelined_batch_size;
+  uint32_t pipelined_batch_delay_usec;
 } ovs_config_t;
 
 typedef struct sgw_config_s {
@@ -26,22 +26,135 @@ extern "C" {
 #include <cstdlib>
 #include <log.h>
 #include <hashtable.h>
+#include "service303.h"
 
 #ifdef __cplusplus
 }
 #endif
 
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
+#include <vector>
 #include <conversions.h>
 #include "redis_utils/redis_client.h"
+#include "redis_utils/ue_state_region.h"
 
 namespace {
 constexpr char IMSI_PREFIX[] = "IMSI";
+// Keys fetched per pipelined MGET command on UE state restore
+constexpr size_t RESTORE_MGET_BATCH_SIZE = 500;
+// Below this many UE records per worker a restore thread is not worth it
+constexpr size_t RESTORE_MIN_UES_PER_WORKER = 1000;
+// Largest UE record kept in the UE state region, larger ones stay in redis
+constexpr uint32_t UE_STATE_REGION_RECORD_SIZE = 4096;
 }  // namespace
 
 namespace magma {
 namespace lte {
 
+/**
+ * Threads decoding and converting UE state on restore, shared by the state
+ * managers of all tasks. They are started on first use and kept, so that
+ * their number and their log contexts stay bounded.
+ */
+class RestoreWorkerPool {
+ public:
+  static RestoreWorkerPool& get_instance() {
+    static RestoreWorkerPool pool(
+        std::max(1u, std::thread::hardware_concurrency()) - 1);
+    return pool;
+  }
+
+  // Threads processing a run, the calling thread included
+  size_t size() const { return workers_.size() + 1; }
+
+  /**
+   * Runs fn(i) for i in [0, count) split in num_slices slices, returns once
+   * every index has been processed. The calling thread processes slices too.
+   */
+  void run(
+      size_t count, size_t num_slices, const std::function<void(size_t)>& fn) {
+    size_t slice_size = (count + num_slices - 1) / num_slices;
+    // Guarded by mutex_
+    size_t pending = 0;
+    std::condition_variable done;
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (size_t first = 0; first < count; first += slice_size) {
+      size_t last = std::min(first + slice_size, count);
+      pending++;
+      slices_.emplace_back([this, &fn, &pending, &done, first, last]() {
+        for (size_t i = first; i < last; i++) {
+          fn(i);
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (--pending == 0) {
+          done.notify_one();
+        }
+      });
+    }
+    cond_.notify_all();
+    while (pending) {
+      if (slices_.empty()) {
+        done.wait(lock);
+        continue;
+      }
+      run_next_slice(lock);
+    }
+  }
+
+  ~RestoreWorkerPool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopping_ = true;
+    }
+    cond_.notify_all();
+    for (auto& worker : workers_) {
+      worker.join();
+    }
+  }
+
+ private:
+  explicit RestoreWorkerPool(size_t num_workers) : stopping_(false) {
+    for (size_t i = 0; i < num_workers; i++) {
+      workers_.emplace_back([this]() { work(); });
+    }
+  }
+
+  void work() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      cond_.wait(lock, [this]() { return stopping_ || !slices_.empty(); });
+      if (slices_.empty()) {
+        break;
+      }
+      run_next_slice(lock);
+    }
+    lock.unlock();
+    log_end_use();
+  }
+
+  // Called and returns with lock held, runs the slice without it
+  void run_next_slice(std::unique_lock<std::mutex>& lock) {
+    std::function<void()> slice = std::move(slices_.front());
+    slices_.pop_front();
+    lock.unlock();
+    slice();
+    lock.lock();
+  }
+
+  std::mutex mutex_;
+  std::condition_variable cond_;
+  std::deque<std::function<void()>> slices_;
+  bool stopping_;
+  std::vector<std::thread> workers_;
+};
+
 template<
     typename StateType, typename UeContextType, typename ProtoType,
     typename ProtoUe, typename StateConverter>
@@ -79,6 +192,34 @@ class StateManager {
     return state_ue_ht;
   }
 
+  /**
+   * Calls callback on a copy of each UE record of the task until it returns
+   * true. The records are read from the UE state region, without locking,
+   * so that other tasks can look at the UEs without touching the contexts
+   * the task is updating.
+   * @return false, without calling callback, if the region is disabled or
+   * does not hold every UE record
+   */
+  bool for_each_ue_proto_in_region(
+      const std::function<bool(const std::string& imsi, const ProtoUe&)>&
+          callback) const {
+    if (!ue_state_region || !ue_state_region->holds_all_records()) {
+      return false;
+    }
+    ue_state_region->for_each(
+        [&](const std::string& imsi, const std::string& record) {
+          ProtoUe ue_proto;
+          if (!ue_proto.ParseFromString(record)) {
+            OAILOG_ERROR(
+                log_task, "Failed to decode UE state %s from region",
+                imsi.c_str());
+            return false;
+          }
+          return callback(imsi, ue_proto);
+        });
+    return true;
+  }
+
   /**
    * Reads and parses task state from db if persist_state is enabled
    * @return response code of operation
@@ -103,23 +244,25 @@ class StateManager {
     if (!persist_state_enabled) {
       return RETURNok;
     }
-    auto keys = redis_client->get_keys("IMSI*" + task_name + "*");
-    for (const auto& key : keys) {
-      ProtoUe ue_proto = ProtoUe();
-      auto* ue_context = (UeContextType*) (calloc(1, sizeof(UeContextType)));
-      if (redis_client->read_proto(key.c_str(), ue_proto) != RETURNok) {
-        return RETURNerror;
-      }
-
-      // Update each UE state version from redis
-      this->ue_state_version[key] = redis_client->read_version(table_key);
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::string> keys;
+    std::vector<ProtoUe> ue_protos;
+    if (read_ue_protos_from_db(keys, ue_protos) != RETURNok) {
+      return RETURNerror;
+    }
 
-      StateConverter::proto_to_ue(ue_proto, ue_context);
+    std::vector<UeContextType*> ue_contexts(keys.size(), nullptr);
+    run_restore_workers(keys.size(), [&](size_t i) {
+      ue_contexts[i] = (UeContextType*) (calloc(1, sizeof(UeContextType)));
+      StateConverter::proto_to_ue(ue_protos[i], ue_contexts[i]);
+    });
 
+    for (size_t i = 0; i < keys.size(); i++) {
       hashtable_ts_insert(
-          state_ue_ht, get_imsi_from_key(key), (void*) ue_context);
-      OAILOG_DEBUG(log_task, "Reading UE state from db for %s", key.c_str());
+          state_ue_ht, get_imsi_from_key(keys[i]), (void*) ue_contexts[i]);
+      OAILOG_DEBUG(log_task, "Reading UE state from db for %s", keys[i].c_str());
     }
+    report_ue_state_restore(keys.size(), start);
     return RETURNok;
   }
 
@@ -127,33 +270,53 @@ class StateManager {
    * Writes task state to db if persist_state is enabled
    */
   virtual void write_state_to_db() {
+    std::string proto_str;
+    if (serialize_state(proto_str)) {
+      write_serialized_state_to_db(proto_str);
+    }
+  }
+
+  /**
+   * Serializes task state for write_serialized_state_to_db(), so that the
+   * caller may let the state change while it is written. Returns false if
+   * there is nothing to write.
+   */
+  virtual bool serialize_state(std::string& proto_str) {
     AssertFatal(
         is_initialized,
         "StateManager init() function should be called to initialize state");
 
     if (!state_dirty) {
       OAILOG_ERROR(log_task, "Tried to put state while it was not in use");
-      return;
+      return false;
+    }
+    if (!persist_state_enabled) {
+      return false;
     }
+    ProtoType state_proto = ProtoType();
+    StateConverter::state_to_proto(state_cache_p, &state_proto);
+    redis_client->serialize(state_proto, proto_str);
+    // A failed write is retried by the next one, the hash is left unchanged
+    this->state_dirty = false;
+    return true;
+  }
 
-    if (persist_state_enabled) {
-      ProtoType state_proto = ProtoType();
-      StateConverter::state_to_proto(state_cache_p, &state_proto);
-      std::string proto_str;
-      redis_client->serialize(state_proto, proto_str);
-      std::size_t new_hash = std::hash<std::string>{}(proto_str);
-
-      if (new_hash != this->task_state_hash) {
-        if (redis_client->write_proto_str(
-                table_key, proto_str, this->task_state_version) != RETURNok) {
-          OAILOG_ERROR(log_task, "Failed to write state to db");
-          return;
-        }
-        OAILOG_DEBUG(log_task, "Finished writing state");
-        this->task_state_version++;
-        this->state_dirty     = false;
-        this->task_state_hash = new_hash;
+  /**
+   * Writes task state serialized by serialize_state() unless it did not
+   * change since the last write. Calls are to be serialized by the caller.
+   */
+  virtual void write_serialized_state_to_db(const std::string& proto_str) {
+    std::size_t new_hash = std::hash<std::string>{}(proto_str);
+
+    if (new_hash != this->task_state_hash) {
+      if (redis_client->write_proto_str(
+              table_key, proto_str, this->task_state_version) != RETURNok) {
+        OAILOG_ERROR(log_task, "Failed to write state to db");
+        return;
       }
+      OAILOG_DEBUG(log_task, "Finished writing state");
+      this->task_state_version++;
+      this->task_state_hash = new_hash;
     }
   }
 
@@ -169,18 +332,29 @@ class StateManager {
     redis_client->serialize(ue_proto, proto_str);
     std::size_t new_hash = std::hash<std::string>{}(proto_str);
 
-    if (new_hash != this->ue_state_hash[imsi_str]) {
+    // Callers serialize the writes of an IMSI, not those of different IMSIs.
+    // The entries of the IMSI are found under the lock, the map nodes stay
+    // put while other IMSIs are inserted.
+    std::unique_lock<std::mutex> lock(ue_state_mutex);
+    uint64_t& version    = this->ue_state_version[imsi_str];
+    std::size_t& ue_hash = this->ue_state_hash[imsi_str];
+    lock.unlock();
+
+    if (new_hash != ue_hash) {
       std::string key = IMSI_PREFIX + imsi_str + ":" + task_name;
-      if (redis_client->write_proto_str(
-              key, proto_str, ue_state_version[imsi_str]) != RETURNok) {
+      // Before redis, a failed write leaves the region ahead and not behind
+      if (ue_state_region) {
+        ue_state_region->write(imsi_str, proto_str, version);
+      }
+      if (redis_client->write_proto_str(key, proto_str, version) != RETURNok) {
         OAILOG_ERROR(
             log_task, "Failed to write UE state to db for IMSI %s",
             imsi_str.c_str());
         return;
       }
 
-      this->ue_state_version[imsi_str]++;
-      this->ue_state_hash[imsi_str] = new_hash;
+      version++;
+      ue_hash = new_hash;
       OAILOG_DEBUG(
           log_task, "Finished writing UE state for IMSI %s", imsi_str.c_str());
     }
@@ -204,6 +378,10 @@ class StateManager {
     if (persist_state_enabled) {
       std::vector<std::string> keys = {IMSI_PREFIX + imsi_str + ":" +
                                        task_name};
+      // A record left in redis fails the validation of the region on restore
+      if (ue_state_region) {
+        ue_state_region->remove(imsi_str);
+      }
       if (redis_client->clear_keys(keys) != RETURNok) {
         OAILOG_ERROR(log_task, "Failed to remove UE state from db");
         return;
@@ -231,6 +409,7 @@ class StateManager {
         ue_state_version(0),
         task_state_hash(0),
         ue_state_hash(0),
+        ue_state_region(nullptr),
         log_task(LOG_UTIL) {}
   virtual ~StateManager() = default;
 
@@ -239,6 +418,233 @@ class StateManager {
    */
   virtual void create_state() = 0;
 
+  /**
+   * Maps the UE state region of the task in dir, sized for max_ues. UE
+   * records are then kept in the region as well as in redis, and restored
+   * from it when it matches the keys in redis. Called on init, before the
+   * UE state is read.
+   * @param dir: directory of the regions, the region is disabled if empty
+   */
+  void open_ue_state_region(const char* dir, uint32_t max_ues) {
+    if (!persist_state_enabled || dir == nullptr || dir[0] == '\0') {
+      return;
+    }
+    std::string path = std::string(dir) + "/" + task_name + ".ue_state";
+    std::unique_ptr<UeStateRegion> region(new UeStateRegion(
+        path, 2 * std::max(max_ues, 1u), UE_STATE_REGION_RECORD_SIZE));
+    if (!region->open()) {
+      OAILOG_ERROR(
+          log_task, "Failed to open UE state region %s, using redis only",
+          path.c_str());
+      return;
+    }
+    ue_state_region = std::move(region);
+    service303_set_service_info_dump(
+        "ue_state_region", UeStateRegion::dump_all_to_string);
+  }
+
+  /**
+   * Fetches every UE record of the task with pipelined MGET batches and
+   * decodes them on the restore workers. Versions of the records are kept
+   * so that the next write of each UE continues from them. The records are
+   * taken from the UE state region when it holds every key found in redis,
+   * the region is rebuilt from redis otherwise.
+   * @param keys_out UE keys found in db
+   * @param ue_protos_out decoded UE protos, in keys_out order
+   * @return response code of operation
+   */
+  status_code_e read_ue_protos_from_db(
+      std::vector<std::string>& keys_out, std::vector<ProtoUe>& ue_protos_out) {
+    keys_out = redis_client->get_keys("IMSI*" + task_name + "*");
+    if (ue_state_region &&
+        read_ue_protos_from_region(keys_out, ue_protos_out) == RETURNok) {
+      return RETURNok;
+    }
+    std::vector<std::string> values;
+    std::vector<bool> found;
+    if (redis_client->read_batch(
+            keys_out, RESTORE_MGET_BATCH_SIZE, values, found) != RETURNok) {
+      OAILOG_ERROR(log_task, "Failed to read UE state from db");
+      return RETURNerror;
+    }
+    // UEs removed between the SCAN and the MGET are not restored
+    size_t num_found = 0;
+    for (size_t i = 0; i < keys_out.size(); i++) {
+      if (!found[i]) {
+        OAILOG_INFO(
+            log_task, "UE state %s removed from db", keys_out[i].c_str());
+        continue;
+      }
+      keys_out[num_found] = std::move(keys_out[i]);
+      values[num_found]   = std::move(values[i]);
+      num_found++;
+    }
+    keys_out.resize(num_found);
+    values.resize(num_found);
+    OAILOG_INFO(
+        log_task, "Fetched %lu UE records of %s from db", keys_out.size(),
+        task_name.c_str());
+
+    ue_protos_out.assign(keys_out.size(), ProtoUe());
+    std::vector<uint64_t> versions(keys_out.size(), 0);
+    std::vector<char> decoded(keys_out.size(), false);
+    run_restore_workers(keys_out.size(), [&](size_t i) {
+      decoded[i] = RedisClient::unwrap_proto(
+                       values[i], ue_protos_out[i], &versions[i]) == RETURNok;
+    });
+
+    for (size_t i = 0; i < keys_out.size(); i++) {
+      if (!decoded[i]) {
+        OAILOG_ERROR(
+            log_task, "Failed to decode UE state %s", keys_out[i].c_str());
+        return RETURNerror;
+      }
+      ue_state_version[get_imsi_str_from_key(keys_out[i])] = versions[i];
+    }
+    if (ue_state_region) {
+      ue_state_region->clear();
+      for (size_t i = 0; i < keys_out.size(); i++) {
+        std::string proto_str;
+        ue_protos_out[i].SerializeToString(&proto_str);
+        ue_state_region->write(
+            get_imsi_str_from_key(keys_out[i]), proto_str, versions[i]);
+      }
+    }
+    return RETURNok;
+  }
+
+  /**
+   * Takes the UE records from the UE state region, only fetching from redis
+   * the records spilled out of it
+   * @param keys UE keys found in db
+   * @param ue_protos_out decoded UE protos, in keys order
+   * @return RETURNerror if the region does not match the keys in db
+   */
+  status_code_e read_ue_protos_from_region(
+      const std::vector<std::string>& keys,
+      std::vector<ProtoUe>& ue_protos_out) {
+    if (ue_state_region->size() != keys.size()) {
+      OAILOG_INFO(
+          log_task, "UE state region of %s holds %u UEs, %lu in db",
+          task_name.c_str(), ue_state_region->size(), keys.size());
+      return RETURNerror;
+    }
+    std::vector<std::string> records(keys.size());
+    std::vector<uint64_t> versions(keys.size(), 0);
+    std::vector<size_t> spilled;
+    for (size_t i = 0; i < keys.size(); i++) {
+      switch (ue_state_region->read(
+          get_imsi_str_from_key(keys[i]), &records[i], &versions[i])) {
+        case UeStateRegion::ReadResult::FOUND:
+          break;
+        case UeStateRegion::ReadResult::SPILLED:
+          spilled.push_back(i);
+          break;
+        default:
+          OAILOG_INFO(
+              log_task, "UE state region of %s misses %s", task_name.c_str(),
+              keys[i].c_str());
+          return RETURNerror;
+      }
+    }
+
+    std::vector<std::string> spilled_keys;
+    std::vector<std::string> spilled_values;
+    std::vector<bool> spilled_found;
+    for (size_t i : spilled) {
+      spilled_keys.push_back(keys[i]);
+    }
+    if (!spilled_keys.empty() &&
+        redis_client->read_batch(
+            spilled_keys, RESTORE_MGET_BATCH_SIZE, spilled_values,
+            spilled_found) != RETURNok) {
+      return RETURNerror;
+    }
+    for (size_t j = 0; j < spilled.size(); j++) {
+      // Removed since the SCAN, the region no longer matches the db
+      if (!spilled_found[j]) {
+        OAILOG_INFO(
+            log_task, "UE state %s removed from db", spilled_keys[j].c_str());
+        return RETURNerror;
+      }
+      records[spilled[j]] = std::move(spilled_values[j]);
+    }
+
+    ue_protos_out.assign(keys.size(), ProtoUe());
+    std::vector<char> is_spilled(keys.size(), false);
+    std::vector<char> decoded(keys.size(), false);
+    for (size_t i : spilled) {
+      is_spilled[i] = true;
+    }
+    run_restore_workers(keys.size(), [&](size_t i) {
+      // Spilled records are wrapped with their version as stored in redis
+      if (is_spilled[i]) {
+        decoded[i] = RedisClient::unwrap_proto(
+                         records[i], ue_protos_out[i], &versions[i]) ==
+                     RETURNok;
+      } else {
+        decoded[i] = ue_protos_out[i].ParseFromString(records[i]);
+      }
+    });
+
+    for (size_t i = 0; i < keys.size(); i++) {
+      if (!decoded[i]) {
+        OAILOG_ERROR(
+            log_task, "Failed to decode UE state %s from region",
+            keys[i].c_str());
+        return RETURNerror;
+      }
+    }
+    for (size_t i = 0; i < keys.size(); i++) {
+      ue_state_version[get_imsi_str_from_key(keys[i])] = versions[i];
+    }
+    OAILOG_INFO(
+        log_task, "Took %lu UE records of %s from region, %lu from db",
+        keys.size() - spilled.size(), task_name.c_str(), spilled.size());
+    return RETURNok;
+  }
+
+  /**
+   * Runs fn(i) for i in [0, count) on the restore worker pool, returns once
+   * every index has been processed. fn must only touch data owned by index i
+   * or thread-safe structures.
+   */
+  void run_restore_workers(
+      size_t count, const std::function<void(size_t)>& fn) const {
+    size_t num_slices = (count + RESTORE_MIN_UES_PER_WORKER - 1) /
+                        RESTORE_MIN_UES_PER_WORKER;
+    if (num_slices <= 1) {
+      for (size_t i = 0; i < count; i++) {
+        fn(i);
+      }
+      return;
+    }
+    RestoreWorkerPool& pool = RestoreWorkerPool::get_instance();
+    pool.run(count, std::min(num_slices, pool.size()), fn);
+  }
+
+  /**
+   * Logs and exports the duration of a UE state restore
+   */
+  void report_ue_state_restore(
+      size_t num_ues, std::chrono::steady_clock::time_point start) const {
+    auto duration_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                           std::chrono::steady_clock::now() - start)
+                           .count();
+    OAILOG_INFO(
+        log_task, "Restored %lu UE states of %s in %ld ms", num_ues,
+        task_name.c_str(), (long) duration_ms);
+    set_gauge(
+        "ue_state_restore_duration_ms", duration_ms, 1, "task",
+        task_name.c_str());
+    set_gauge("ue_state_restored", num_ues, 1, "task", task_name.c_str());
+  }
+
+  std::string get_imsi_str_from_key(const std::string& key) const {
+    std::string imsi_str_prefix = key.substr(0, key.find(':'));
+    return imsi_str_prefix.substr(4, imsi_str_prefix.length());
+  }
+
   imsi64_t get_imsi_from_key(const std::string& key) const {
     imsi64_t imsi64;
     std::string imsi_str_prefix = key.substr(0, key.find(':'));
@@ -264,6 +670,10 @@ class StateManager {
   // Last written hash values for task and ue context
   std::size_t task_state_hash;
   std::unordered_map<std::string, std::size_t> ue_state_hash;
+  // Guards the insertions in ue_state_version and ue_state_hash
+  std::mutex ue_state_mutex;
+  // Copy of the UE records surviving restarts, null if disabled
+  std::unique_ptr<UeStateRegion> ue_state_region;
 
  protected:
   std::string table_key;
@@ -40,6 +40,7 @@
 #include <string.h>
 
 #include "bstrlib.h"
+#include "mem_arena.h"
 #include "dynamic_memory_check.h"
 #include "common_defs.h"
 #include "assertions.h"
@@ -76,14 +77,23 @@ int decode_access_point_name_ie(
   CHECK_LENGTH_DECODER(len - decoded, ielen);
 
   if (1 <= ielen) {
+    // The labels are joined on the stack, the APN is no longer than the IE
+    char apn[UINT8_MAX];
+    int apn_len    = 0;
     int length_apn = *(buffer + decoded);
     decoded++;
-    *access_point_name = blk2bstr((void*) (buffer + decoded), length_apn);
+    ielen = ielen - 1;
+    AssertFatal(
+        ielen >= length_apn,
+        "Mismatch in lengths remaining ielen %d apn length %d", ielen,
+        length_apn);
+    memcpy(apn, buffer + decoded, length_apn);
+    apn_len += length_apn;
     decoded += length_apn;
-    ielen = ielen - 1 - length_apn;
+    ielen = ielen - length_apn;
     while (1 <= ielen) {
-      bconchar(*access_point_name, '.');
-      length_apn = *(buffer + decoded);
+      apn[apn_len++] = '.';
+      length_apn     = *(buffer + decoded);
       decoded++;
       ielen = ielen - 1;
 
@@ -93,11 +103,13 @@ int decode_access_point_name_ie(
             ielen >= length_apn,
             "Mismatch in lengths remaining ielen %d apn length %d", ielen,
             length_apn);
-        bcatblk(*access_point_name, (void*) (buffer + decoded), length_apn);
+        memcpy(apn + apn_len, buffer + decoded, length_apn);
+        apn_len += length_apn;
         decoded += length_apn;
         ielen = ielen - length_apn;
       }
     }
+    *access_point_name = mem_arena_current_blk2bstr(apn, apn_len);
   }
   return decoded;
 }
@@ -67,5 +67,10 @@
  * MME.
  */
 #define MAX_EPS_AUTH_VECTORS 1
+/* Vectors requested at once when the MME caches the spare ones for the next
+ * authentications of the UE, the most an HSS returns per TS 29.272. The
+ * cached vectors are used in order, so that their SQNs keep increasing.
+ */
+#define MAX_EPS_AUTH_VECTORS_PER_AIR 5
 
 #endif /* FILE_3GPP_33_401_SEEN */
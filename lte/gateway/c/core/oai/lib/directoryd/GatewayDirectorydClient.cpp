@@ -17,7 +17,6 @@
 #include "GatewayDirectorydClient.h"
 
 #include <memory>
-#include <thread>
 #include <utility>
 
 #include <grpcpp/impl/codegen/async_unary_call.h>
@@ -46,12 +45,11 @@ GatewayDirectoryServiceClient& GatewayDirectoryServiceClient::get_instance() {
   return client_instance;
 }
 
-GatewayDirectoryServiceClient::GatewayDirectoryServiceClient() {
+GatewayDirectoryServiceClient::GatewayDirectoryServiceClient()
+    : GRPCReceiver(magma::GRPCRuntime::get_instance()) {
   auto channel = ServiceRegistrySingleton::Instance()->GetGrpcChannel(
       "directoryd", ServiceRegistrySingleton::LOCAL);
   stub_ = GatewayDirectoryService::NewStub(channel);
-  std::thread resp_loop_thread([&]() { rpc_response_loop(); });
-  resp_loop_thread.detach();
 }
 
 bool GatewayDirectoryServiceClient::UpdateRecord(
@@ -79,8 +77,9 @@ bool GatewayDirectoryServiceClient::updateRecordImpl(
   GatewayDirectoryServiceClient& client = get_instance();
   // Create a raw response pointer that stores a callback to be called when the
   // gRPC call is answered
-  auto local_response =
-      new AsyncLocalResponse<Void>(std::move(callback), RESPONSE_TIMEOUT);
+  auto local_response = new AsyncLocalResponse<Void>(
+      std::move(callback), RESPONSE_TIMEOUT,
+      "GatewayDirectoryService/UpdateRecord");
   // Create a response reader for the `UpdateRecord` RPC call. This reader
   // stores the client context, the request to pass in, and the queue to add
   // the response to when done
@@ -100,8 +99,9 @@ bool GatewayDirectoryServiceClient::DeleteRecord(
 
   request.set_id(id);
 
-  auto local_response =
-      new AsyncLocalResponse<Void>(std::move(callback), RESPONSE_TIMEOUT);
+  auto local_response = new AsyncLocalResponse<Void>(
+      std::move(callback), RESPONSE_TIMEOUT,
+      "GatewayDirectoryService/DeleteRecord");
   GatewayDirectoryServiceClient& client = get_instance();
   auto response_reader                  = client.stub_->AsyncDeleteRecord(
       local_response->get_context(), request, &client.queue_);
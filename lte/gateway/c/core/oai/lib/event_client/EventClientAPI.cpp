@@ -18,30 +18,45 @@
 #include "EventClientAPI.h"
 
 #include <iostream>
-#include <thread>
 #include <grpcpp/support/status.h>
 #include <orc8r/protos/common.pb.h>
 
 #include "includes/EventdClient.h"
+#include "includes/EventdPipeline.h"
 
 using grpc::Status;
+using grpc::StatusCode::ABORTED;
 using grpc::StatusCode::DEADLINE_EXCEEDED;
+using grpc::StatusCode::RESOURCE_EXHAUSTED;
 using grpc::StatusCode::UNAVAILABLE;
 using magma::AsyncEventdClient;
+using magma::EventdPipeline;
+using magma::EventdPipelineConfig;
 using magma::orc8r::Event;
 using magma::orc8r::Void;
 
+namespace {
+// Bursts of events (e.g. attach storms) are queued here instead of being
+// turned into as many concurrent RPCs to eventd. Never destroyed, responses
+// may still come in at exit. The configuration of the first call is kept.
+EventdPipeline& get_eventd_pipeline(
+    const EventdPipelineConfig& config = EventdPipelineConfig()) {
+  static EventdPipeline* pipeline =
+      new EventdPipeline(AsyncEventdClient::getInstance(), config);
+  return *pipeline;
+}
+}  // namespace
+
 namespace magma {
 namespace lte {
 
-void init_eventd_client() {
-  auto& client = AsyncEventdClient::getInstance();
-  std::thread resp_loop_thread([&]() { client.rpc_response_loop(); });
-  resp_loop_thread.detach();
+void init_eventd_client(const EventdPipelineConfig& config) {
+  // Responses are handled by the shared GRPCRuntime
+  get_eventd_pipeline(config);
 }
 
 int log_event(const Event& event) {
-  AsyncEventdClient::getInstance().log_event(event, [=](Status status, Void v) {
+  get_eventd_pipeline().log_event(event, [=](Status status, Void v) {
     if (status.ok()) {
       std::cout << "[DEBUG] Success logging event: " << event.event_type()
                 << std::endl;
@@ -51,6 +66,10 @@ int log_event(const Event& event) {
         status.error_code() == UNAVAILABLE) {
       return 0;  // Suppress error logs if EventD is unavailable
     }
+    if (status.error_code() == RESOURCE_EXHAUSTED ||
+        status.error_code() == ABORTED) {
+      return 0;  // Dropped under overload, counted by the pipeline
+    }
     std::cout << "[ERROR] Failed to log event: " << event.event_type()
               << "; Status: " << status.error_message() << std::endl;
     return int(status.error_code());
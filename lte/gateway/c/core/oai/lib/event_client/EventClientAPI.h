@@ -17,11 +17,15 @@
 #pragma once
 
 #include "orc8r/protos/eventd.pb.h"
+#include "includes/EventdPipeline.h"
 
 namespace magma {
 namespace lte {
 
-void init_eventd_client();
+/**
+ * Sets the queue and RPC window of the events, before the first one is logged
+ */
+void init_eventd_client(const EventdPipelineConfig& config);
 
 // This call is async so the return code does not matter here.
 // TODO return void?
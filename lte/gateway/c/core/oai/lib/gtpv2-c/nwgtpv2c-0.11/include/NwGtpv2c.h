@@ -597,6 +597,23 @@ nw_rc_t nwGtpv2cSetLogMgrEntity(
 nw_rc_t nwGtpv2cSetLogLevel(
     NW_IN nw_gtpv2c_stack_handle_t hGtpcStackHandle, NW_IN uint32_t logLevel);
 
+/**
+ Size the stack for the expected load. The tunnel and transaction lookup
+ tables and the timer heap are grown, and the tunnel, transaction and message
+ pools are filled upfront, so that the signaling path does not allocate until
+ the load exceeds these numbers. The stack still grows past them on demand.
+
+ @param[in] hGtpcStackHandle : Stack handle
+ @param[in] maxTunnels : Expected number of local tunnels.
+ @param[in] maxTrxns : Expected number of outstanding transactions.
+ @param[in] maxMsgs : Number of messages to preallocate.
+ @return NW_OK on success.
+ */
+
+nw_rc_t nwGtpv2cSetCapacity(
+    NW_IN nw_gtpv2c_stack_handle_t hGtpcStackHandle, NW_IN uint32_t maxTunnels,
+    NW_IN uint32_t maxTrxns, NW_IN uint32_t maxMsgs);
+
 /**
  Process Data Request from UDP entity.
 
@@ -0,0 +1,83 @@
+/**
+ * Copyright 2020 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NW_GTPV2C_HASH_MAP_H__
+#define __NW_GTPV2C_HASH_MAP_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "NwError.h"
+
+/**
+ * @file NwGtpv2cHashMap.h
+ * @brief Intrusive chained hash map used by the stack to index tunnels and
+ * outstanding transactions. Entries carry their own chaining pointer, so
+ * inserting and removing never allocates. Lookups take a key shaped like an
+ * entry, with only the key fields set, the same way the RB trees they
+ * replace were searched.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef uint32_t (*nw_gtpv2c_hash_map_hash_t)(const void* entry);
+typedef bool (*nw_gtpv2c_hash_map_equal_t)(const void* a, const void* b);
+
+typedef struct nw_gtpv2c_hash_map_s {
+  void** buckets;
+  uint32_t size;     /**< Number of buckets, a power of 2       */
+  uint32_t count;    /**< Number of entries                     */
+  size_t nextOffset; /**< Offset of the chaining pointer in the entries */
+  nw_gtpv2c_hash_map_hash_t hash;
+  nw_gtpv2c_hash_map_equal_t equal;
+} nw_gtpv2c_hash_map_t;
+
+/**
+ * Initialize an empty map of at least size buckets.
+ */
+nw_rc_t nwGtpv2cHashMapInit(
+    nw_gtpv2c_hash_map_t* thiz, uint32_t size, size_t nextOffset,
+    nw_gtpv2c_hash_map_hash_t hash, nw_gtpv2c_hash_map_equal_t equal);
+
+void nwGtpv2cHashMapDestroy(nw_gtpv2c_hash_map_t* thiz);
+
+/**
+ * Rehash the map into at least size buckets, the map never shrinks. The map
+ * also grows by itself once it holds more entries than buckets, sizing it
+ * upfront avoids rehashing under load.
+ */
+nw_rc_t nwGtpv2cHashMapResize(nw_gtpv2c_hash_map_t* thiz, uint32_t size);
+
+/**
+ * @return The entry equal to key, NULL if there is none.
+ */
+void* nwGtpv2cHashMapFind(nw_gtpv2c_hash_map_t* thiz, const void* key);
+
+/**
+ * @return NULL if entry was inserted, the entry equal to it otherwise.
+ */
+void* nwGtpv2cHashMapInsert(nw_gtpv2c_hash_map_t* thiz, void* entry);
+
+/**
+ * @return entry if it was removed, NULL if it was not in the map.
+ */
+void* nwGtpv2cHashMapRemove(nw_gtpv2c_hash_map_t* thiz, void* entry);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __NW_GTPV2C_HASH_MAP_H__ */
@@ -47,6 +47,7 @@
 #include "NwGtpv2cMsg.h"
 #include "NwGtpv2cMsgIeParseInfo.h"
 #include "NwGtpv2cTunnel.h"
+#include "NwGtpv2cHashMap.h"
 
 /**
  * @file NwGtpv2cPrivate.h
@@ -86,6 +87,31 @@ extern "C" {
     }                                                                          \
   } while (0)
 
+/**
+ * Fill the free list _pool of _type objects from a single allocation, until
+ * it holds at least _count objects. Like every pooled object, the slab is
+ * never freed.
+ */
+#define NW_GTPV2C_POOL_PREALLOCATE(_stack, _pool, _type, _count, _rc)          \
+  do {                                                                         \
+    uint32_t _free = 0;                                                        \
+    _type* _slab   = NULL;                                                     \
+    for (_type* _obj = (_pool); _obj; _obj = _obj->next) _free++;              \
+    (_rc) = NW_OK;                                                             \
+    if ((_count) > _free) {                                                    \
+      uint32_t _num = (_count) - _free;                                        \
+      NW_GTPV2C_MALLOC(_stack, _num * sizeof(_type), _slab, _type*);           \
+      if (_slab) {                                                             \
+        while (_num--) {                                                       \
+          _slab[_num].next = (_pool);                                          \
+          (_pool)          = &_slab[_num];                                     \
+        }                                                                      \
+      } else {                                                                 \
+        (_rc) = NW_FAILURE;                                                    \
+      }                                                                        \
+    }                                                                          \
+  } while (0)
+
 /*--------------------------------------------------------------------------*
  *  G T P V 2 C   S T A C K   O B J E C T   T Y P E    D E F I N I T I O N  *
  *--------------------------------------------------------------------------*/
@@ -109,12 +135,11 @@ typedef struct nw_gtpv2c_stack_s {
   nw_gtpv2c_msg_ie_parse_info_t* pGtpv2cMsgIeParseInfo[NW_GTP_MSG_END];
   struct nw_gtpv2c_timeout_info_s* activeTimerInfo;
 
-  RB_HEAD(NwGtpv2cTunnelMap, nw_gtpv2c_tunnel_s) tunnelMap;
-  RB_HEAD(NwGtpv2cOutstandingTxSeqNumTrxnMap, nw_gtpv2c_trxn_s)
-  outstandingTxSeqNumMap;
-  RB_HEAD(NwGtpv2cOutstandingRxSeqNumTrxnMap, nw_gtpv2c_trxn_s)
-  outstandingRxSeqNumMap;
-  RB_HEAD(NwGtpv2cActiveTimerList, nw_gtpv2c_timeout_info_s) activeTimerList;
+  nw_gtpv2c_hash_map_t tunnelMap; /**< Tunnels by (peer, teid) */
+  nw_gtpv2c_hash_map_t
+      outstandingTxSeqNumMap; /**< Sent requests by (peer, seqNum) */
+  nw_gtpv2c_hash_map_t
+      outstandingRxSeqNumMap; /**< Received requests by (peer, port, seqNum) */
   NwPtrT hTmrMinHeap;
 } nw_gtpv2c_stack_t;
 
@@ -133,8 +158,6 @@ typedef struct nw_gtpv2c_timeout_info_s {
   void* timeoutArg;
   nw_rc_t (*timeoutCallbackFunc)(void*);
   nw_gtpv2c_timer_handle_t hTimer;
-  RB_ENTRY(nw_gtpv2c_timeout_info_s)
-  activeTimerListRbtNode; /**< RB Tree Data Structure Node        */
   uint32_t timerMinHeapIndex;
   struct nw_gtpv2c_timeout_info_s* next;
 } nw_gtpv2c_timeout_info_t;
@@ -196,10 +219,10 @@ typedef struct nw_gtpv2c_trxn_s {
   nw_gtpv2c_tunnel_handle_t hTunnel; /**< Handle to local tunnel context     */
   nw_gtpv2c_ulp_trxn_handle_t hUlpTrxn; /**< Handle to ULP tunnel context */
   uint8_t trx_flags; /**< Flags in the trx to be signalized back. */
-  RB_ENTRY(nw_gtpv2c_trxn_s)
-  outstandingTxSeqNumMapRbtNode; /**< RB Tree Data Structure Node        */
-  RB_ENTRY(nw_gtpv2c_trxn_s)
-  outstandingRxSeqNumMapRbtNode; /**< RB Tree Data Structure Node        */
+  struct nw_gtpv2c_trxn_s*
+      outstandingTxSeqNumMapNext; /**< Hash Map Chaining Pointer   */
+  struct nw_gtpv2c_trxn_s*
+      outstandingRxSeqNumMapNext; /**< Hash Map Chaining Pointer   */
   struct nw_gtpv2c_trxn_s* next;
 } nw_gtpv2c_trxn_t;
 
@@ -218,18 +241,11 @@ typedef struct NwGtpv2cPathS {
   RB_ENTRY(NwGtpv2cPathS) pathMapRbtNode;
 } NwGtpv2cPathT;
 
-RB_PROTOTYPE(
-    NwGtpv2cTunnelMap, nw_gtpv2c_tunnel_s, tunnelMapRbtNode,
-    nwGtpv2cCompareTunnel)
-RB_PROTOTYPE(
-    NwGtpv2cOutstandingTxSeqNumTrxnMap, nw_gtpv2c_trxn_s,
-    outstandingTxSeqNumMapRbtNode, nwGtpv2cCompareSeqNum)
-RB_PROTOTYPE(
-    NwGtpv2cOutstandingRxSeqNumTrxnMap, nw_gtpv2c_trxn_s,
-    outstandingRxSeqNumMapRbtNode, nwGtpv2cCompareSeqNum)
-RB_PROTOTYPE(
-    NwGtpv2cActiveTimerList, nw_gtpv2c_timeout_info_s, activeTimerListRbtNode,
-    nwGtpv2cCompareOutstandingTxRexmitTime)
+/**
+ * Preallocate count messages into the message pool
+ */
+
+nw_rc_t nwGtpv2cMsgPoolPreallocate(nw_gtpv2c_stack_t* thiz, uint32_t count);
 
 /**
  * Start Timer with ULP Timer Manager
@@ -77,6 +77,17 @@ nw_gtpv2c_trxn_t* nwGtpv2cTrxnOutstandingRxNew(
 
 nw_rc_t nwGtpv2cTrxnDelete(NW_INOUT nw_gtpv2c_trxn_t** ppTrxn);
 
+/**
+ * Preallocate transactions into the transaction pool
+ *
+ * @param[in] thiz : Pointer to stack.
+ * @param[in] count : Number of transactions the pool should hold.
+ * @return NW_OK on success.
+ */
+
+nw_rc_t nwGtpv2cTrxnPoolPreallocate(
+    NW_IN nw_gtpv2c_stack_t* pStack, NW_IN uint32_t count);
+
 /**
  * Start timer to wait before pruginf a req tran for which response has been
  * sent
@@ -38,7 +38,6 @@
 #include <stdlib.h>
 #include <string.h>
 
-#include "tree.h"
 #include "NwTypes.h"
 #include "NwUtils.h"
 #include "NwError.h"
@@ -58,8 +57,8 @@ typedef struct nw_gtpv2c_tunnel_s {
   } ipAddrRemote;
 
   nw_gtpv2c_ulp_tunnel_handle_t hUlpTunnel;
-  RB_ENTRY(nw_gtpv2c_tunnel_s)
-  tunnelMapRbtNode; /**< RB Tree Data Structure Node        */
+  struct nw_gtpv2c_tunnel_s*
+      tunnelMapNext; /**< Hash Map Chaining Pointer          */
   struct nw_gtpv2c_tunnel_s* next;
 } nw_gtpv2c_tunnel_t;
 
@@ -70,6 +69,12 @@ nw_gtpv2c_tunnel_t* nwGtpv2cTunnelNew(
 nw_rc_t nwGtpv2cTunnelDelete(
     struct nw_gtpv2c_stack_s* pStack, nw_gtpv2c_tunnel_t* thiz);
 
+/**
+ * Preallocate count tunnels into the tunnel pool
+ */
+nw_rc_t nwGtpv2cTunnelPoolPreallocate(
+    struct nw_gtpv2c_stack_s* pStack, uint32_t count);
+
 nw_rc_t nwGtpv2cTunnelGetUlpTunnelHandle(
     nw_gtpv2c_tunnel_t* thiz, nw_gtpv2c_ulp_tunnel_handle_t* phUlpTunnel);
 
@@ -91,6 +91,11 @@
 
 #define NW_GTPV2C_UDP_PORT (2123)
 
+/* Sizes the stack starts with until nwGtpv2cSetCapacity() is called */
+#define NW_GTPV2C_DEFAULT_TUNNEL_CAPACITY (1024)
+#define NW_GTPV2C_DEFAULT_TRXN_CAPACITY (256)
+#define NW_GTPV2C_DEFAULT_TIMER_CAPACITY (10000)
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -124,11 +129,30 @@ void nwGtpv2cTmrMinHeapDelete(NwGtpv2cTmrMinHeapT* thiz) {
   free_wrapper((void**) &thiz);
 }
 
+static nw_rc_t nwGtpv2cTmrMinHeapReserve(
+    NwGtpv2cTmrMinHeapT* thiz, int maxSize) {
+  nw_gtpv2c_timeout_info_t** pHeap = NULL;
+
+  if (maxSize <= thiz->maxSize) return NW_OK;
+
+  pHeap = (nw_gtpv2c_timeout_info_t**) realloc(
+      thiz->pHeap, maxSize * sizeof(nw_gtpv2c_timeout_info_t*));
+  if (!pHeap) return NW_FAILURE;
+
+  thiz->pHeap   = pHeap;
+  thiz->maxSize = maxSize;
+  return NW_OK;
+}
+
 static nw_rc_t nwGtpv2cTmrMinHeapInsert(
     NwGtpv2cTmrMinHeapT* thiz, nw_gtpv2c_timeout_info_t* pTimerEvent) {
-  int holeIndex = thiz->currSize++;
+  int holeIndex = 0;
 
-  NW_ASSERT(thiz->currSize < thiz->maxSize);
+  if (thiz->currSize == thiz->maxSize) {
+    nw_rc_t rc = nwGtpv2cTmrMinHeapReserve(thiz, 2 * thiz->maxSize);
+    AssertFatal(NW_OK == rc, "Failed to grow the GTPv2-C timer heap\n");
+  }
+  holeIndex = thiz->currSize++;
 
   while ((holeIndex > 0) &&
          NW_GTPV2C_TIMER_CMP_P(
@@ -347,184 +371,103 @@ static void nwGtpv2cDisplayBanner(nw_gtpv2c_stack_t* thiz) {
 }
 
 /*---------------------------------------------------------------------------
-   Tunnel RBTree Search Data Structure
+   Tunnel and Transaction Hash Maps
   --------------------------------------------------------------------------*/
 
+#define NW_GTPV2C_HASH_MULTIPLIER (0x9E3779B1)
+
 /**
-  Comparator funtion for comparing two sequence number transactions.
+  Hash of a peer address, only the family and the address are significant.
 
-  @param[in] a: Pointer to session a.
-  @param[in] b: Pointer to session b.
-  @return  An integer greater than, equal to or less than zero according to
-  whether the object pointed to by a is greater than, equal to or less than the
-  object pointed to by b.
+  @param[in] peer: Pointer to the peer address.
+  @return The hash value.
 */
-
-static inline int32_t nwGtpv2cCompareTunnel(
-    struct nw_gtpv2c_tunnel_s* a, struct nw_gtpv2c_tunnel_s* b) {
-  if (a->teid > b->teid) return 1;
-
-  if (a->teid < b->teid) return -1;
-
-  /** Compare the sa_family. */
-  if (((struct sockaddr*) &a->ipAddrRemote)->sa_family >
-      ((struct sockaddr*) &b->ipAddrRemote)->sa_family)
-    return 1;
-
-  if (((struct sockaddr*) &a->ipAddrRemote)->sa_family <
-      ((struct sockaddr*) &b->ipAddrRemote)->sa_family)
-    return -1;
-
-  /** compare the address. */
-  if (((struct sockaddr*) &a->ipAddrRemote)->sa_family == AF_INET) {
-    if (((struct sockaddr_in*) &a->ipAddrRemote)->sin_addr.s_addr >
-        ((struct sockaddr_in*) &b->ipAddrRemote)->sin_addr.s_addr)
-      return 1;
-
-    if (((struct sockaddr_in*) &a->ipAddrRemote)->sin_addr.s_addr <
-        ((struct sockaddr_in*) &b->ipAddrRemote)->sin_addr.s_addr)
-      return -1;
-  } else {
-    DevAssert(((struct sockaddr*) &a->ipAddrRemote)->sa_family == AF_INET6);
-    /** Should return 1 if a is bigger. */
-    return memcmp(
-        ((struct sockaddr_in6*) &a->ipAddrRemote)->sin6_addr.s6_addr,
-        ((struct sockaddr_in6*) &b->ipAddrRemote)->sin6_addr.s6_addr, 16);
+static inline uint32_t nwGtpv2cHashPeer(const struct sockaddr* peer) {
+  if (peer->sa_family == AF_INET) {
+    return ((const struct sockaddr_in*) peer)->sin_addr.s_addr;
   }
 
-  return 0;
+  const uint32_t* addr =
+      (const uint32_t*) ((const struct sockaddr_in6*) peer)->sin6_addr.s6_addr;
+  return addr[0] ^ addr[1] ^ addr[2] ^ addr[3] ^ peer->sa_family;
 }
 
-RB_GENERATE(
-    NwGtpv2cTunnelMap, nw_gtpv2c_tunnel_s, tunnelMapRbtNode,
-    nwGtpv2cCompareTunnel)
-
-/*---------------------------------------------------------------------------
-   Transaction RBTree Search Data Structure
-  --------------------------------------------------------------------------*/
 /**
-  Comparator funtion for comparing two outstancing TX transactions.
-
-  @param[in] a: Pointer to session a.
-  @param[in] b: Pointer to session b.
-  @return  An integer greater than, equal to or less than zero according to
-  whether the object pointed to by a is greater than, equal to or less than the
-  object pointed to by b.
+  Mix a TEID or sequence number with the hash of the peer.
 */
-static inline int32_t nwGtpv2cCompareOutstandingTxSeqNumTrxn(
-    struct nw_gtpv2c_trxn_s* a, struct nw_gtpv2c_trxn_s* b) {
-  if (a->seqNum > b->seqNum) return 1;
-
-  if (a->seqNum < b->seqNum) return -1;
-
-  /** Compare the sa_family. */
-  if (((struct sockaddr*) &a->peer_ip)->sa_family >
-      ((struct sockaddr*) &b->peer_ip)->sa_family)
-    return 1;
-
-  if (((struct sockaddr*) &a->peer_ip)->sa_family <
-      ((struct sockaddr*) &b->peer_ip)->sa_family)
-    return -1;
-
-  /** compare the address. */
-  if (((struct sockaddr*) &a->peer_ip)->sa_family == AF_INET) {
-    if (((struct sockaddr_in*) &a->peer_ip)->sin_addr.s_addr >
-        ((struct sockaddr_in*) &b->peer_ip)->sin_addr.s_addr)
-      return 1;
-
-    if (((struct sockaddr_in*) &a->peer_ip)->sin_addr.s_addr <
-        ((struct sockaddr_in*) &b->peer_ip)->sin_addr.s_addr)
-      return -1;
-  } else {
-    DevAssert(((struct sockaddr*) &a->peer_ip)->sa_family == AF_INET6);
-    /** Should return 1 if a is bigger. */
-    return memcmp(
-        ((struct sockaddr_in6*) &a->peer_ip)->sin6_addr.s6_addr,
-        ((struct sockaddr_in6*) &b->peer_ip)->sin6_addr.s6_addr, 16);
-  }
-
-  return 0;
+static inline uint32_t nwGtpv2cHashMix(uint32_t value, uint32_t peerHash) {
+  uint32_t hash = (value ^ peerHash) * NW_GTPV2C_HASH_MULTIPLIER;
+  return hash ^ (hash >> 16);
 }
 
-RB_GENERATE(
-    NwGtpv2cOutstandingTxSeqNumTrxnMap, nw_gtpv2c_trxn_s,
-    outstandingTxSeqNumMapRbtNode, nwGtpv2cCompareOutstandingTxSeqNumTrxn)
-
 /**
-  Comparator funtion for comparing outstanding RX transactions.
+  Compare two peer addresses the way the tunnel and transaction maps do.
 
-  @param[in] a: Pointer to session a.
-  @param[in] b: Pointer to session b.
-  @return  An integer greater than, equal to or less than zero according to
-  whether the object pointed to by a is greater than, equal to or less than the
-  object pointed to by b.
+  @param[in] a: Pointer to peer address a.
+  @param[in] b: Pointer to peer address b.
+  @return true if both have the same family and address.
 */
-static inline int32_t nwGtpv2cCompareOutstandingRxSeqNumTrxn(
-    struct nw_gtpv2c_trxn_s* a, struct nw_gtpv2c_trxn_s* b) {
-  if (a->seqNum > b->seqNum) return 1;
-
-  if (a->seqNum < b->seqNum) return -1;
-  /** Compare the sa_family. */
-  if (((struct sockaddr*) &a->peer_ip)->sa_family >
-      ((struct sockaddr*) &b->peer_ip)->sa_family)
-    return 1;
-
-  if (((struct sockaddr*) &a->peer_ip)->sa_family <
-      ((struct sockaddr*) &b->peer_ip)->sa_family)
-    return -1;
-
-  /** compare the address. */
-  if (((struct sockaddr*) &a->peer_ip)->sa_family == AF_INET) {
-    if (((struct sockaddr_in*) &a->peer_ip)->sin_addr.s_addr >
-        ((struct sockaddr_in*) &b->peer_ip)->sin_addr.s_addr)
-      return 1;
-
-    if (((struct sockaddr_in*) &a->peer_ip)->sin_addr.s_addr <
-        ((struct sockaddr_in*) &b->peer_ip)->sin_addr.s_addr)
-      return -1;
-  } else {
-    DevAssert(((struct sockaddr*) &a->peer_ip)->sa_family == AF_INET6);
-    /** Should return 1 if a is bigger. */
-    return memcmp(
-        ((struct sockaddr_in6*) &a->peer_ip)->sin6_addr.s6_addr,
-        ((struct sockaddr_in6*) &b->peer_ip)->sin6_addr.s6_addr, 16);
+static inline bool nwGtpv2cIsSamePeer(
+    const struct sockaddr* a, const struct sockaddr* b) {
+  if (a->sa_family != b->sa_family) return false;
+
+  if (a->sa_family == AF_INET) {
+    return ((const struct sockaddr_in*) a)->sin_addr.s_addr ==
+           ((const struct sockaddr_in*) b)->sin_addr.s_addr;
   }
 
-  if (a->peerPort > b->peerPort) return 1;
+  DevAssert(a->sa_family == AF_INET6);
+  return memcmp(
+             ((const struct sockaddr_in6*) a)->sin6_addr.s6_addr,
+             ((const struct sockaddr_in6*) b)->sin6_addr.s6_addr, 16) == 0;
+}
+
+static uint32_t nwGtpv2cHashTunnel(const void* entry) {
+  const nw_gtpv2c_tunnel_t* tunnel = (const nw_gtpv2c_tunnel_t*) entry;
+  return nwGtpv2cHashMix(
+      tunnel->teid, nwGtpv2cHashPeer((struct sockaddr*) &tunnel->ipAddrRemote));
+}
 
-  if (a->peerPort < b->peerPort) return -1;
+static bool nwGtpv2cIsSameTunnel(const void* a, const void* b) {
+  const nw_gtpv2c_tunnel_t* tunnelA = (const nw_gtpv2c_tunnel_t*) a;
+  const nw_gtpv2c_tunnel_t* tunnelB = (const nw_gtpv2c_tunnel_t*) b;
+  return (tunnelA->teid == tunnelB->teid) &&
+         nwGtpv2cIsSamePeer(
+             (struct sockaddr*) &tunnelA->ipAddrRemote,
+             (struct sockaddr*) &tunnelB->ipAddrRemote);
+}
 
-  return 0;
+static uint32_t nwGtpv2cHashTxTrxn(const void* entry) {
+  const nw_gtpv2c_trxn_t* trxn = (const nw_gtpv2c_trxn_t*) entry;
+  return nwGtpv2cHashMix(
+      trxn->seqNum, nwGtpv2cHashPeer((struct sockaddr*) &trxn->peer_ip));
 }
 
-RB_GENERATE(
-    NwGtpv2cOutstandingRxSeqNumTrxnMap, nw_gtpv2c_trxn_s,
-    outstandingRxSeqNumMapRbtNode, nwGtpv2cCompareOutstandingRxSeqNumTrxn)
+static bool nwGtpv2cIsSameTxTrxn(const void* a, const void* b) {
+  const nw_gtpv2c_trxn_t* trxnA = (const nw_gtpv2c_trxn_t*) a;
+  const nw_gtpv2c_trxn_t* trxnB = (const nw_gtpv2c_trxn_t*) b;
+  return (trxnA->seqNum == trxnB->seqNum) &&
+         nwGtpv2cIsSamePeer(
+             (struct sockaddr*) &trxnA->peer_ip,
+             (struct sockaddr*) &trxnB->peer_ip);
+}
 
-/*---------------------------------------------------------------------------
-   Timer RB-tree data structure.
-  --------------------------------------------------------------------------*/
 /**
-  Comparator funtion for comparing two outstancing TX transactions.
-
-  @param[in] a: Pointer to session a.
-  @param[in] b: Pointer to session b.
-  @return  An integer greater than, equal to or less than zero according to
-  whether the object pointed to by a is greater than, equal to or less than the
-  object pointed to by b.
+  Received requests are also told apart by the peer port, a peer may use
+  several source ports with overlapping sequence numbers.
 */
-static inline int32_t nwGtpv2cCompareOutstandingTxRexmitTime(
-    struct nw_gtpv2c_timeout_info_s* a, struct nw_gtpv2c_timeout_info_s* b) {
-  if (NW_GTPV2C_TIMER_CMP_P(&a->tvTimeout, &b->tvTimeout, >)) return 1;
-
-  if (NW_GTPV2C_TIMER_CMP_P(&a->tvTimeout, &b->tvTimeout, <)) return -1;
-
-  return 0;
+static uint32_t nwGtpv2cHashRxTrxn(const void* entry) {
+  const nw_gtpv2c_trxn_t* trxn = (const nw_gtpv2c_trxn_t*) entry;
+  return nwGtpv2cHashMix(
+      trxn->seqNum,
+      nwGtpv2cHashPeer((struct sockaddr*) &trxn->peer_ip) + trxn->peerPort);
 }
 
-RB_GENERATE(
-    NwGtpv2cActiveTimerList, nw_gtpv2c_timeout_info_s, activeTimerListRbtNode,
-    nwGtpv2cCompareOutstandingTxRexmitTime)
+static bool nwGtpv2cIsSameRxTrxn(const void* a, const void* b) {
+  const nw_gtpv2c_trxn_t* trxnA = (const nw_gtpv2c_trxn_t*) a;
+  const nw_gtpv2c_trxn_t* trxnB = (const nw_gtpv2c_trxn_t*) b;
+  return (trxnA->peerPort == trxnB->peerPort) && nwGtpv2cIsSameTxTrxn(a, b);
+}
 
 /**
    Send msg to peer via data request to UDP Entity
@@ -631,7 +574,7 @@ static nw_rc_t nwGtpv2cCreateLocalTunnel(
   pTunnel = nwGtpv2cTunnelNew(thiz, teid, fa, hUlpTunnel);
 
   if (pTunnel) {
-    pCollision = RB_INSERT(NwGtpv2cTunnelMap, &(thiz->tunnelMap), pTunnel);
+    pCollision = nwGtpv2cHashMapInsert(&(thiz->tunnelMap), pTunnel);
 
     if (pCollision) {
       rc = nwGtpv2cTunnelDelete(thiz, pTunnel);
@@ -667,8 +610,8 @@ static nw_rc_t nwGtpv2cDeleteLocalTunnel(
 
   OAILOG_FUNC_IN(LOG_GTPV2C);
 
-  pTunnel = RB_REMOVE(
-      NwGtpv2cTunnelMap, &(thiz->tunnelMap), (nw_gtpv2c_tunnel_t*) hTunnel);
+  pTunnel = nwGtpv2cHashMapRemove(
+      &(thiz->tunnelMap), (nw_gtpv2c_tunnel_t*) hTunnel);
   NW_ASSERT(pTunnel == (nw_gtpv2c_tunnel_t*) hTunnel);
 
   inet_ntop(
@@ -723,9 +666,8 @@ static nw_rc_t nwGtpv2cHandleUlpInitialReq(
               sizeof(struct sockaddr_in) :
               sizeof(struct sockaddr_in6));
 
-      pLocalTunnel = RB_FIND(NwGtpv2cTunnelMap, &(thiz->tunnelMap), &keyTunnel);
+      pLocalTunnel = nwGtpv2cHashMapFind(&(thiz->tunnelMap), &keyTunnel);
       if (!pLocalTunnel) {
-        pLocalTunnel = RB_MIN(NwGtpv2cTunnelMap, &(thiz->tunnelMap));
         OAILOG_WARNING(
             LOG_GTPV2C,
             "Request message received on non-existent teid 0x%x received! "
@@ -783,9 +725,7 @@ static nw_rc_t nwGtpv2cHandleUlpInitialReq(
 
       // Insert into search tree
 
-      pTrxn = RB_INSERT(
-          NwGtpv2cOutstandingTxSeqNumTrxnMap, &(thiz->outstandingTxSeqNumMap),
-          pTrxn);
+      pTrxn = nwGtpv2cHashMapInsert(&(thiz->outstandingTxSeqNumMap), pTrxn);
       NW_ASSERT(pTrxn == NULL);
     } else {
       rc = nwGtpv2cTrxnDelete(&pTrxn);
@@ -841,9 +781,7 @@ static nw_rc_t nwGtpv2cHandleUlpTriggeredReq(
 
       // Insert into search tree
 
-      RB_INSERT(
-          NwGtpv2cOutstandingTxSeqNumTrxnMap, &(thiz->outstandingTxSeqNumMap),
-          pTrxn);
+      nwGtpv2cHashMapInsert(&(thiz->outstandingTxSeqNumMap), pTrxn);
 
       if (!pUlpReq->u_api_info.triggeredReqInfo.hTunnel) {
         rc = nwGtpv2cCreateLocalTunnel(
@@ -949,7 +887,7 @@ static nw_rc_t nwGtpv2cHandleUlpTriggeredRsp(
             sizeof(struct sockaddr_in) :
             sizeof(struct sockaddr_in6));
 
-    pLocalTunnel = RB_FIND(NwGtpv2cTunnelMap, &(thiz->tunnelMap), &keyTunnel);
+    pLocalTunnel = nwGtpv2cHashMapFind(&(thiz->tunnelMap), &keyTunnel);
     char ip[INET6_ADDRSTRLEN];
     inet_ntop(
         AF_INET, (void*) &pReqTrxn->peer_ip, ip,
@@ -1008,9 +946,7 @@ static nw_rc_t nwGtpv2cHandleUlpTriggeredAck(
 
   /** A transaction of the initial request (cmd) for the triggered request
    * should exist. */
-  pAckTrxn = RB_FIND(
-      NwGtpv2cOutstandingTxSeqNumTrxnMap, &(thiz->outstandingTxSeqNumMap),
-      &keyTrxn);
+  pAckTrxn = nwGtpv2cHashMapFind(&(thiz->outstandingTxSeqNumMap), &keyTrxn);
 
   if (pAckTrxn) {
     OAILOG_INFO(
@@ -1078,7 +1014,7 @@ static nw_rc_t nwGtpv2cHandleUlpCreateLocalTunnel(
       pUlpReq->u_api_info.createLocalTunnelInfo.peerIp,
       pUlpReq->u_api_info.triggeredRspInfo.hUlpTunnel);
   NW_ASSERT(pTunnel);
-  pCollision = RB_INSERT(NwGtpv2cTunnelMap, &(thiz->tunnelMap), pTunnel);
+  pCollision = nwGtpv2cHashMapInsert(&(thiz->tunnelMap), pTunnel);
 
   if (pCollision) {
     rc = nwGtpv2cTunnelDelete(thiz, pTunnel);
@@ -1222,7 +1158,7 @@ static nw_rc_t nwGtpv2cHandleUlpFindLocalTunnel(
       (((struct sockaddr*) &keyTunnel.ipAddrRemote)->sa_family == AF_INET) ?
           sizeof(struct sockaddr_in) :
           sizeof(struct sockaddr_in6));
-  pLocalTunnel = RB_FIND(NwGtpv2cTunnelMap, &(thiz->tunnelMap), &keyTunnel);
+  pLocalTunnel = nwGtpv2cHashMapFind(&(thiz->tunnelMap), &keyTunnel);
   pUlpReq->u_api_info.findLocalTunnelInfo.hTunnel =
       (nw_gtpv2c_tunnel_handle_t) pLocalTunnel;
 
@@ -1309,7 +1245,7 @@ static nw_rc_t nwGtpv2cHandleInitialReq(
         (void*) &keyTunnel.ipAddrRemote, peerIp,
         (peerIp->sa_family == AF_INET) ? sizeof(struct sockaddr_in) :
                                          sizeof(struct sockaddr_in6));
-    pLocalTunnel = RB_FIND(NwGtpv2cTunnelMap, &(thiz->tunnelMap), &keyTunnel);
+    pLocalTunnel = nwGtpv2cHashMapFind(&(thiz->tunnelMap), &keyTunnel);
 
     if (!pLocalTunnel) {
       OAILOG_WARNING(
@@ -1393,18 +1329,14 @@ static nw_rc_t nwGtpv2cHandleTriggeredReq(
 
   /** A transaction of the initial request (cmd) for the triggered request
    * should exist. */
-  pTrxn = RB_FIND(
-      NwGtpv2cOutstandingTxSeqNumTrxnMap, &(thiz->outstandingTxSeqNumMap),
-      &keyTrxn);
+  pTrxn = nwGtpv2cHashMapFind(&(thiz->outstandingTxSeqNumMap), &keyTrxn);
 
   if (pTrxn) {
     /**
      * We remove the transaction of the initial request and create a new
      * transaction the the received triggered request.
      */
-    RB_REMOVE(
-        NwGtpv2cOutstandingTxSeqNumTrxnMap, &(thiz->outstandingTxSeqNumMap),
-        pTrxn);
+    nwGtpv2cHashMapRemove(&(thiz->outstandingTxSeqNumMap), pTrxn);
     rc = nwGtpv2cTrxnDelete(&pTrxn);
     NW_ASSERT(NW_OK == rc);
   } else {
@@ -1423,7 +1355,7 @@ static nw_rc_t nwGtpv2cHandleTriggeredReq(
         (void*) &keyTunnel.ipAddrRemote, peerIp,
         (peerIp->sa_family == AF_INET) ? sizeof(struct sockaddr_in) :
                                          sizeof(struct sockaddr_in6));
-    pLocalTunnel = RB_FIND(NwGtpv2cTunnelMap, &(thiz->tunnelMap), &keyTunnel);
+    pLocalTunnel = nwGtpv2cHashMapFind(&(thiz->tunnelMap), &keyTunnel);
 
     if (!pLocalTunnel) {
       OAILOG_WARNING(
@@ -1496,9 +1428,7 @@ static nw_rc_t nwGtpv2cHandleTriggeredRsp(
       "%x.\n",
       msgType, msgBufLen, keyTrxn.seqNum);
 
-  pTrxn = RB_FIND(
-      NwGtpv2cOutstandingTxSeqNumTrxnMap, &(thiz->outstandingTxSeqNumMap),
-      &keyTrxn);
+  pTrxn = nwGtpv2cHashMapFind(&(thiz->outstandingTxSeqNumMap), &keyTrxn);
   uint8_t trx_flags = 0;
   if (pTrxn) {
     uint32_t hUlpTunnel;
@@ -1567,9 +1497,7 @@ static nw_rc_t nwGtpv2cHandleTriggeredRsp(
           "%x in conclusion (not late response). \n",
           msgType, keyTrxn.seqNum);
       /** Remove the transaction. */
-      RB_REMOVE(
-          NwGtpv2cOutstandingTxSeqNumTrxnMap, &(thiz->outstandingTxSeqNumMap),
-          pTrxn);
+      nwGtpv2cHashMapRemove(&(thiz->outstandingTxSeqNumMap), pTrxn);
       rc = nwGtpv2cTrxnDelete(&pTrxn);
       NW_ASSERT(NW_OK == rc);
       remove = false;
@@ -1614,12 +1542,24 @@ nw_rc_t nwGtpv2cInitialize(
     thiz->id     = (uint32_t) thiz;
     thiz->seqNum = ((uint32_t) thiz) & 0x0000FFFF;
     OAI_GCC_DIAG_ON("-Wpointer-to-int-cast");
-    RB_INIT(&(thiz->tunnelMap));
-    RB_INIT(&(thiz->outstandingTxSeqNumMap));
-    RB_INIT(&(thiz->outstandingRxSeqNumMap));
-    RB_INIT(&(thiz->activeTimerList));
+    rc = nwGtpv2cHashMapInit(
+        &(thiz->tunnelMap), NW_GTPV2C_DEFAULT_TUNNEL_CAPACITY,
+        offsetof(nw_gtpv2c_tunnel_t, tunnelMapNext), nwGtpv2cHashTunnel,
+        nwGtpv2cIsSameTunnel);
+    NW_ASSERT(NW_OK == rc);
+    rc = nwGtpv2cHashMapInit(
+        &(thiz->outstandingTxSeqNumMap), NW_GTPV2C_DEFAULT_TRXN_CAPACITY,
+        offsetof(nw_gtpv2c_trxn_t, outstandingTxSeqNumMapNext),
+        nwGtpv2cHashTxTrxn, nwGtpv2cIsSameTxTrxn);
+    NW_ASSERT(NW_OK == rc);
+    rc = nwGtpv2cHashMapInit(
+        &(thiz->outstandingRxSeqNumMap), NW_GTPV2C_DEFAULT_TRXN_CAPACITY,
+        offsetof(nw_gtpv2c_trxn_t, outstandingRxSeqNumMapNext),
+        nwGtpv2cHashRxTrxn, nwGtpv2cIsSameRxTrxn);
+    NW_ASSERT(NW_OK == rc);
     OAI_GCC_DIAG_OFF("-Wpointer-to-int-cast");
-    thiz->hTmrMinHeap = (NwPtrT) nwGtpv2cTmrMinHeapNew(10000);
+    thiz->hTmrMinHeap =
+        (NwPtrT) nwGtpv2cTmrMinHeapNew(NW_GTPV2C_DEFAULT_TIMER_CAPACITY);
     OAI_GCC_DIAG_ON("-Wpointer-to-int-cast");
     NW_GTPV2C_INIT_MSG_IE_PARSE_INFO(thiz, NW_GTP_ECHO_RSP);
 
@@ -1792,6 +1732,11 @@ nw_rc_t nwGtpv2cFinalize(NW_IN nw_gtpv2c_stack_handle_t hGtpcStackHandle) {
       ((nw_gtpv2c_stack_t*) hGtpcStackHandle)
           ->pGtpv2cMsgIeParseInfo[NW_GTP_IDENTIFICATION_RSP]);
 
+  nwGtpv2cHashMapDestroy(
+      &((nw_gtpv2c_stack_t*) hGtpcStackHandle)->outstandingRxSeqNumMap);
+  nwGtpv2cHashMapDestroy(
+      &((nw_gtpv2c_stack_t*) hGtpcStackHandle)->outstandingTxSeqNumMap);
+  nwGtpv2cHashMapDestroy(&((nw_gtpv2c_stack_t*) hGtpcStackHandle)->tunnelMap);
   OAI_GCC_DIAG_OFF("-Wint-to-pointer-cast");
   nwGtpv2cTmrMinHeapDelete(
       (NwGtpv2cTmrMinHeapT*) ((nw_gtpv2c_stack_t*) hGtpcStackHandle)
@@ -1886,6 +1831,51 @@ nw_rc_t nwGtpv2cSetLogLevel(
   return NW_OK;
 }
 
+/**
+   Size the stack for the expected load
+*/
+
+nw_rc_t nwGtpv2cSetCapacity(
+    NW_IN nw_gtpv2c_stack_handle_t hGtpcStackHandle, NW_IN uint32_t maxTunnels,
+    NW_IN uint32_t maxTrxns, NW_IN uint32_t maxMsgs) {
+  nw_gtpv2c_stack_t* thiz = (nw_gtpv2c_stack_t*) hGtpcStackHandle;
+  nw_rc_t rc              = NW_OK;
+  nw_rc_t poolRc          = NW_OK;
+
+  NW_ASSERT(thiz);
+  OAILOG_FUNC_IN(LOG_GTPV2C);
+
+  if ((nwGtpv2cHashMapResize(&thiz->tunnelMap, maxTunnels) != NW_OK) ||
+      (nwGtpv2cHashMapResize(&thiz->outstandingTxSeqNumMap, maxTrxns) !=
+       NW_OK) ||
+      (nwGtpv2cHashMapResize(&thiz->outstandingRxSeqNumMap, maxTrxns) !=
+       NW_OK)) {
+    rc = NW_FAILURE;
+  }
+  // Every outstanding transaction runs one timer
+  OAI_GCC_DIAG_OFF("-Wint-to-pointer-cast");
+  if (nwGtpv2cTmrMinHeapReserve(
+          (NwGtpv2cTmrMinHeapT*) thiz->hTmrMinHeap, maxTrxns + 1) != NW_OK) {
+    rc = NW_FAILURE;
+  }
+  OAI_GCC_DIAG_ON("-Wint-to-pointer-cast");
+  NW_GTPV2C_POOL_PREALLOCATE(
+      thiz, gpGtpv2cTimeoutInfoPool, nw_gtpv2c_timeout_info_t, maxTrxns,
+      poolRc);
+  if ((poolRc != NW_OK) ||
+      (nwGtpv2cTunnelPoolPreallocate(thiz, maxTunnels) != NW_OK) ||
+      (nwGtpv2cTrxnPoolPreallocate(thiz, maxTrxns) != NW_OK) ||
+      (nwGtpv2cMsgPoolPreallocate(thiz, maxMsgs) != NW_OK)) {
+    rc = NW_FAILURE;
+  }
+
+  OAILOG_INFO(
+      LOG_GTPV2C,
+      "GTPv2-C stack sized for %u tunnels, %u transactions and %u messages\n",
+      maxTunnels, maxTrxns, maxMsgs);
+  OAILOG_FUNC_RETURN(LOG_GTPV2C, rc);
+}
+
 /**
    Process Request from Udp Layer
 */
@@ -2105,67 +2095,6 @@ nw_rc_t nwGtpv2cProcessUlpReq(
    Process Timer timeout Request from Timer ULP Manager
 */
 
-nw_rc_t nwGtpv2cProcessTimeoutOld(void* arg) {
-  nw_rc_t rc                                 = NW_FAILURE;
-  nw_gtpv2c_stack_t* thiz                    = NULL;
-  nw_gtpv2c_timeout_info_t* timeoutInfo      = (nw_gtpv2c_timeout_info_t*) arg;
-  nw_gtpv2c_timeout_info_t* pNextTimeoutInfo = NULL;
-  struct timeval tv                          = {0};
-
-  NW_ASSERT(timeoutInfo != NULL);
-  thiz =
-      (nw_gtpv2c_stack_t*) (((nw_gtpv2c_timeout_info_t*) timeoutInfo)->hStack);
-  NW_ASSERT(thiz != NULL);
-  OAILOG_FUNC_IN(LOG_GTPV2C);
-
-  if (thiz->activeTimerInfo == timeoutInfo) {
-    thiz->activeTimerInfo = NULL;
-    RB_REMOVE(NwGtpv2cActiveTimerList, &(thiz->activeTimerList), timeoutInfo);
-    timeoutInfo->next       = gpGtpv2cTimeoutInfoPool;
-    gpGtpv2cTimeoutInfoPool = timeoutInfo;
-    rc = ((timeoutInfo)->timeoutCallbackFunc)(timeoutInfo->timeoutArg);
-  } else {
-    OAILOG_WARNING(
-        LOG_GTPV2C,
-        "Received timeout event from ULP for non-existent timeoutInfo 0x%p and "
-        "activeTimer 0x%p!\n",
-        timeoutInfo, thiz->activeTimerInfo);
-    OAILOG_FUNC_RETURN(LOG_GTPV2C, NW_OK);
-  }
-
-  NW_ASSERT(gettimeofday(&tv, NULL) == 0);
-
-  for ((timeoutInfo) =
-           RB_MIN(NwGtpv2cActiveTimerList, &(thiz->activeTimerList));
-       (timeoutInfo) != NULL;) {
-    if (NW_GTPV2C_TIMER_CMP_P(&timeoutInfo->tvTimeout, &tv, >)) break;
-
-    pNextTimeoutInfo =
-        RB_NEXT(NwGtpv2cActiveTimerList, &(thiz->activeTimerList), timeoutInfo);
-    RB_REMOVE(NwGtpv2cActiveTimerList, &(thiz->activeTimerList), timeoutInfo);
-    timeoutInfo->next       = gpGtpv2cTimeoutInfoPool;
-    gpGtpv2cTimeoutInfoPool = timeoutInfo;
-    rc          = ((timeoutInfo)->timeoutCallbackFunc)(timeoutInfo->timeoutArg);
-    timeoutInfo = pNextTimeoutInfo;
-  }
-
-  // activeTimerInfo may be reset by the timeoutCallbackFunc call above
-  if (thiz->activeTimerInfo == NULL) {
-    timeoutInfo = RB_MIN(NwGtpv2cActiveTimerList, &(thiz->activeTimerList));
-
-    if (timeoutInfo) {
-      NW_GTPV2C_TIMER_SUB(&timeoutInfo->tvTimeout, &tv, &tv);
-      rc = thiz->tmrMgr.tmrStartCallback(
-          thiz->tmrMgr.tmrMgrHandle, tv.tv_sec, tv.tv_usec,
-          timeoutInfo->tmrType, (void*) timeoutInfo, &timeoutInfo->hTimer);
-      NW_ASSERT(NW_OK == rc);
-      thiz->activeTimerInfo = timeoutInfo;
-    }
-  }
-
-  OAILOG_FUNC_RETURN(LOG_GTPV2C, rc);
-}
-
 nw_rc_t nwGtpv2cProcessTimeout(void* arg) {
   nw_rc_t rc                            = NW_FAILURE;
   nw_gtpv2c_stack_t* thiz               = NULL;
@@ -2276,24 +2205,6 @@ nw_rc_t nwGtpv2cStartTimer(
     rc = nwGtpv2cTmrMinHeapInsert(
         (NwGtpv2cTmrMinHeapT*) thiz->hTmrMinHeap, timeoutInfo);
     OAI_GCC_DIAG_ON("-Wint-to-pointer-cast");
-#if 0
-
-      do {
-        collision = RB_INSERT (NwGtpv2cActiveTimerList, &(thiz->activeTimerList), timeoutInfo);
-
-        if (!collision)
-          break;
-
-        OAILOG_WARNING (LOG_GTPV2C,  "timer collision!\n");
-        timeoutInfo->tvTimeout.tv_usec++;       /* HACK: In case there is a collision, schedule this event 1 usec later */
-
-        if (timeoutInfo->tvTimeout.tv_usec > (999999 /*1000000 - 1 */ )) {
-          timeoutInfo->tvTimeout.tv_usec = 0;
-          timeoutInfo->tvTimeout.tv_sec++;
-        }
-      } while (1);
-
-#endif
 
     if (thiz->activeTimerInfo) {
       if (NW_GTPV2C_TIMER_CMP_P(
@@ -2328,87 +2239,6 @@ nw_rc_t nwGtpv2cStartTimer(
   OAILOG_FUNC_RETURN(LOG_GTPV2C, rc);
 }
 
-nw_rc_t nwGtpv2cStartTimerOld(
-    nw_gtpv2c_stack_t* thiz, uint32_t timeoutSec, uint32_t timeoutUsec,
-    uint32_t tmrType, nw_rc_t (*timeoutCallbackFunc)(void*),
-    void* timeoutCallbackArg, nw_gtpv2c_timer_handle_t* phTimer) {
-  nw_rc_t rc = NW_OK;
-  struct timeval tv;
-  nw_gtpv2c_timeout_info_t* timeoutInfo;
-  nw_gtpv2c_timeout_info_t* collision;
-
-  NW_ASSERT(thiz != NULL);
-  OAILOG_FUNC_IN(LOG_GTPV2C);
-
-  if (gpGtpv2cTimeoutInfoPool) {
-    timeoutInfo             = gpGtpv2cTimeoutInfoPool;
-    gpGtpv2cTimeoutInfoPool = gpGtpv2cTimeoutInfoPool->next;
-  } else {
-    NW_GTPV2C_MALLOC(
-        thiz, sizeof(nw_gtpv2c_timeout_info_t), timeoutInfo,
-        nw_gtpv2c_timeout_info_t*);
-  }
-
-  if (timeoutInfo) {
-    timeoutInfo->tmrType             = tmrType;
-    timeoutInfo->timeoutArg          = timeoutCallbackArg;
-    timeoutInfo->timeoutCallbackFunc = timeoutCallbackFunc;
-    timeoutInfo->hStack              = (nw_gtpv2c_stack_handle_t) thiz;
-    NW_ASSERT(gettimeofday(&tv, NULL) == 0);
-    NW_ASSERT(gettimeofday(&timeoutInfo->tvTimeout, NULL) == 0);
-    timeoutInfo->tvTimeout.tv_sec  = timeoutSec;
-    timeoutInfo->tvTimeout.tv_usec = timeoutUsec;
-    NW_GTPV2C_TIMER_ADD(&tv, &timeoutInfo->tvTimeout, &timeoutInfo->tvTimeout);
-
-    do {
-      collision = RB_INSERT(
-          NwGtpv2cActiveTimerList, &(thiz->activeTimerList), timeoutInfo);
-
-      if (!collision) break;
-
-      OAILOG_WARNING(LOG_GTPV2C, "timer collision!\n");
-      timeoutInfo->tvTimeout.tv_usec++; /* HACK: In case there is a collision,
-                                           schedule this event 1 usec later */
-
-      if (timeoutInfo->tvTimeout.tv_usec > (999999 /*1000000 - 1 */)) {
-        timeoutInfo->tvTimeout.tv_usec = 0;
-        timeoutInfo->tvTimeout.tv_sec++;
-      }
-    } while (1);
-
-    if (thiz->activeTimerInfo) {
-      if (NW_GTPV2C_TIMER_CMP_P(
-              &(thiz->activeTimerInfo->tvTimeout), &(timeoutInfo->tvTimeout),
-              >)) {
-        OAILOG_DEBUG(
-            LOG_GTPV2C, "Stopping active timer 0x%" PRIxPTR " for info 0x%p!\n",
-            thiz->activeTimerInfo->hTimer, thiz->activeTimerInfo);
-        rc = thiz->tmrMgr.tmrStopCallback(
-            thiz->tmrMgr.tmrMgrHandle, thiz->activeTimerInfo->hTimer);
-        NW_ASSERT(NW_OK == rc);
-      } else {
-        OAILOG_DEBUG(
-            LOG_GTPV2C, "Already Started timer 0x%" PRIxPTR " for info 0x%p!\n",
-            thiz->activeTimerInfo->hTimer, thiz->activeTimerInfo);
-        *phTimer = (nw_gtpv2c_timer_handle_t) timeoutInfo;
-        OAILOG_FUNC_RETURN(LOG_GTPV2C, NW_OK);
-      }
-    }
-
-    rc = thiz->tmrMgr.tmrStartCallback(
-        thiz->tmrMgr.tmrMgrHandle, timeoutSec, timeoutUsec, tmrType,
-        (void*) timeoutInfo, &timeoutInfo->hTimer);
-    OAILOG_DEBUG(
-        LOG_GTPV2C, "Started timer 0x%" PRIxPTR " for info 0x%p!\n",
-        timeoutInfo->hTimer, timeoutInfo);
-    NW_ASSERT(NW_OK == rc);
-    thiz->activeTimerInfo = timeoutInfo;
-  }
-
-  *phTimer = (nw_gtpv2c_timer_handle_t) timeoutInfo;
-  OAILOG_FUNC_RETURN(LOG_GTPV2C, rc);
-}
-
 /**
    Stop Timer with ULP Timer Manager
 */
@@ -2475,56 +2305,6 @@ nw_rc_t nwGtpv2cStopTimer(
   OAILOG_FUNC_RETURN(LOG_GTPV2C, rc);
 }
 
-nw_rc_t nwGtpv2cStopTimerOld(
-    nw_gtpv2c_stack_t* thiz, nw_gtpv2c_timer_handle_t hTimer) {
-  nw_rc_t rc = NW_OK;
-  struct timeval tv;
-  nw_gtpv2c_timeout_info_t* timeoutInfo;
-
-  NW_ASSERT(thiz != NULL);
-  OAILOG_FUNC_IN(LOG_GTPV2C);
-  timeoutInfo = (nw_gtpv2c_timeout_info_t*) hTimer;
-  RB_REMOVE(NwGtpv2cActiveTimerList, &(thiz->activeTimerList), timeoutInfo);
-  timeoutInfo->next       = gpGtpv2cTimeoutInfoPool;
-  gpGtpv2cTimeoutInfoPool = timeoutInfo;
-  OAILOG_DEBUG(
-      LOG_GTPV2C, "Stopping active timer 0x%" PRIxPTR " for info 0x%p!\n",
-      timeoutInfo->hTimer, timeoutInfo);
-
-  if (thiz->activeTimerInfo == timeoutInfo) {
-    OAILOG_DEBUG(
-        LOG_GTPV2C, "Stopping active timer 0x%" PRIxPTR " for info 0x%p!\n",
-        timeoutInfo->hTimer, timeoutInfo);
-    rc = thiz->tmrMgr.tmrStopCallback(
-        thiz->tmrMgr.tmrMgrHandle, timeoutInfo->hTimer);
-    thiz->activeTimerInfo = NULL;
-    NW_ASSERT(NW_OK == rc);
-    timeoutInfo = RB_MIN(NwGtpv2cActiveTimerList, &(thiz->activeTimerList));
-
-    if (timeoutInfo) {
-      NW_ASSERT(gettimeofday(&tv, NULL) == 0);
-
-      if (NW_GTPV2C_TIMER_CMP_P(&timeoutInfo->tvTimeout, &tv, <)) {
-        thiz->activeTimerInfo = timeoutInfo;
-        rc                    = nwGtpv2cProcessTimeout(timeoutInfo);
-        NW_ASSERT(NW_OK == rc);
-      } else {
-        NW_GTPV2C_TIMER_SUB(&timeoutInfo->tvTimeout, &tv, &tv);
-        rc = thiz->tmrMgr.tmrStartCallback(
-            thiz->tmrMgr.tmrMgrHandle, tv.tv_sec, tv.tv_usec,
-            timeoutInfo->tmrType, (void*) timeoutInfo, &timeoutInfo->hTimer);
-        NW_ASSERT(NW_OK == rc);
-        OAILOG_DEBUG(
-            LOG_GTPV2C, "Started timer 0x%" PRIxPTR " for info 0x%p!\n",
-            timeoutInfo->hTimer, timeoutInfo);
-        thiz->activeTimerInfo = timeoutInfo;
-      }
-    }
-  }
-
-  OAILOG_FUNC_RETURN(LOG_GTPV2C, rc);
-}
-
 #ifdef __cplusplus
 }
 #endif
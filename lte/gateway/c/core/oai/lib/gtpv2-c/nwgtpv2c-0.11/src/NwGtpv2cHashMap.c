@@ -0,0 +1,144 @@
+/**
+ * Copyright 2020 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdlib.h>
+
+#include "NwGtpv2cHashMap.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define NW_GTPV2C_HASH_MAP_MIN_SIZE (64)
+
+#define NW_GTPV2C_HASH_MAP_NEXT(_thiz, _entry)                                 \
+  (*(void**) ((char*) (_entry) + (_thiz)->nextOffset))
+
+//------------------------------------------------------------------------------
+static uint32_t nwGtpv2cHashMapRoundUp(uint32_t size) {
+  uint32_t rounded = NW_GTPV2C_HASH_MAP_MIN_SIZE;
+
+  while ((rounded < size) && (rounded < 0x80000000)) {
+    rounded <<= 1;
+  }
+  return rounded;
+}
+
+//------------------------------------------------------------------------------
+static inline void** nwGtpv2cHashMapBucket(
+    nw_gtpv2c_hash_map_t* thiz, const void* entry) {
+  return &thiz->buckets[thiz->hash(entry) & (thiz->size - 1)];
+}
+
+//------------------------------------------------------------------------------
+nw_rc_t nwGtpv2cHashMapInit(
+    nw_gtpv2c_hash_map_t* thiz, uint32_t size, size_t nextOffset,
+    nw_gtpv2c_hash_map_hash_t hash, nw_gtpv2c_hash_map_equal_t equal) {
+  thiz->size       = nwGtpv2cHashMapRoundUp(size);
+  thiz->count      = 0;
+  thiz->nextOffset = nextOffset;
+  thiz->hash       = hash;
+  thiz->equal      = equal;
+  thiz->buckets    = (void**) calloc(thiz->size, sizeof(void*));
+  return thiz->buckets ? NW_OK : NW_FAILURE;
+}
+
+//------------------------------------------------------------------------------
+void nwGtpv2cHashMapDestroy(nw_gtpv2c_hash_map_t* thiz) {
+  free(thiz->buckets);
+  thiz->buckets = NULL;
+  thiz->size    = 0;
+  thiz->count   = 0;
+}
+
+//------------------------------------------------------------------------------
+nw_rc_t nwGtpv2cHashMapResize(nw_gtpv2c_hash_map_t* thiz, uint32_t size) {
+  void** oldBuckets = thiz->buckets;
+  uint32_t oldSize  = thiz->size;
+
+  size = nwGtpv2cHashMapRoundUp(size);
+  if (size <= oldSize) {
+    return NW_OK;
+  }
+  thiz->buckets = (void**) calloc(size, sizeof(void*));
+  if (!thiz->buckets) {
+    thiz->buckets = oldBuckets;
+    return NW_FAILURE;
+  }
+  thiz->size = size;
+
+  for (uint32_t i = 0; i < oldSize; i++) {
+    void* entry = oldBuckets[i];
+
+    while (entry) {
+      void* next    = NW_GTPV2C_HASH_MAP_NEXT(thiz, entry);
+      void** bucket = nwGtpv2cHashMapBucket(thiz, entry);
+
+      NW_GTPV2C_HASH_MAP_NEXT(thiz, entry) = *bucket;
+      *bucket                              = entry;
+      entry                                = next;
+    }
+  }
+  free(oldBuckets);
+  return NW_OK;
+}
+
+//------------------------------------------------------------------------------
+void* nwGtpv2cHashMapFind(nw_gtpv2c_hash_map_t* thiz, const void* key) {
+  void* entry = *nwGtpv2cHashMapBucket(thiz, key);
+
+  while (entry && !thiz->equal(entry, key)) {
+    entry = NW_GTPV2C_HASH_MAP_NEXT(thiz, entry);
+  }
+  return entry;
+}
+
+//------------------------------------------------------------------------------
+void* nwGtpv2cHashMapInsert(nw_gtpv2c_hash_map_t* thiz, void* entry) {
+  void** bucket = nwGtpv2cHashMapBucket(thiz, entry);
+  void* other   = *bucket;
+
+  while (other) {
+    if (thiz->equal(other, entry)) {
+      return other;
+    }
+    other = NW_GTPV2C_HASH_MAP_NEXT(thiz, other);
+  }
+  NW_GTPV2C_HASH_MAP_NEXT(thiz, entry) = *bucket;
+  *bucket                              = entry;
+
+  // Growing is best effort, a failure only makes the chains longer
+  if (++thiz->count > thiz->size) {
+    nwGtpv2cHashMapResize(thiz, thiz->size << 1);
+  }
+  return NULL;
+}
+
+//------------------------------------------------------------------------------
+void* nwGtpv2cHashMapRemove(nw_gtpv2c_hash_map_t* thiz, void* entry) {
+  void** link = nwGtpv2cHashMapBucket(thiz, entry);
+
+  while (*link) {
+    if (*link == entry) {
+      *link = NW_GTPV2C_HASH_MAP_NEXT(thiz, entry);
+      thiz->count--;
+      return entry;
+    }
+    link = &NW_GTPV2C_HASH_MAP_NEXT(thiz, *link);
+  }
+  return NULL;
+}
+
+#ifdef __cplusplus
+}
+#endif
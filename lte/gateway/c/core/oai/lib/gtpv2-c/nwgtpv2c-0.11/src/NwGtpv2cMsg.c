@@ -136,6 +136,13 @@ nw_rc_t nwGtpv2cMsgFromBufferNew(
   return NW_FAILURE;
 }
 
+nw_rc_t nwGtpv2cMsgPoolPreallocate(nw_gtpv2c_stack_t* thiz, uint32_t count) {
+  nw_rc_t rc = NW_OK;
+
+  NW_GTPV2C_POOL_PREALLOCATE(thiz, gpGtpv2cMsgPool, nw_gtpv2c_msg_t, count, rc);
+  return rc;
+}
+
 nw_rc_t nwGtpv2cMsgDelete(
     NW_IN nw_gtpv2c_stack_handle_t hGtpcStackHandle,
     NW_IN nw_gtpv2c_msg_handle_t hMsg) {
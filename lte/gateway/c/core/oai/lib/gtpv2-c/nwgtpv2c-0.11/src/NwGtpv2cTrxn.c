@@ -93,9 +93,7 @@ static nw_rc_t nwGtpv2cTrxnPeerRspWaitTimeout(void* arg) {
         "Transaction transaction %p (seqNo=0x%x) was acknowledged. Removing "
         "for timeout. \n",
         thiz, thiz->seqNum);
-    RB_REMOVE(
-        NwGtpv2cOutstandingTxSeqNumTrxnMap, &(pStack->outstandingTxSeqNumMap),
-        thiz);
+    nwGtpv2cHashMapRemove(&(pStack->outstandingTxSeqNumMap), thiz);
     rc = nwGtpv2cTrxnDelete(&thiz);
     return rc;
   }
@@ -107,7 +105,7 @@ static nw_rc_t nwGtpv2cTrxnPeerRspWaitTimeout(void* arg) {
     memcpy(
         (void*) &keyTunnel.ipAddrRemote, (void*) &thiz->peer_ip,
         sizeof(thiz->peer_ip));
-    pLocalTunnel = RB_FIND(NwGtpv2cTunnelMap, &(pStack->tunnelMap), &keyTunnel);
+    pLocalTunnel = nwGtpv2cHashMapFind(&(pStack->tunnelMap), &keyTunnel);
     if (pLocalTunnel) {
       rc = nwGtpv2cTrxnSendMsgRetransmission(thiz);
       NW_ASSERT(NW_OK == rc);
@@ -120,9 +118,7 @@ static nw_rc_t nwGtpv2cTrxnPeerRspWaitTimeout(void* arg) {
           "Tunnel for local-TEID 0x%x is removed for request transaction %p "
           "(seqNo=0x%x)! Removing the trx and ignoring timeout. \n",
           thiz->teidLocal, thiz, thiz->seqNum);
-      RB_REMOVE(
-          NwGtpv2cOutstandingTxSeqNumTrxnMap, &(pStack->outstandingTxSeqNumMap),
-          thiz);
+      nwGtpv2cHashMapRemove(&(pStack->outstandingTxSeqNumMap), thiz);
       rc = nwGtpv2cTrxnDelete(&thiz);
     }
   } else {
@@ -143,9 +139,7 @@ static nw_rc_t nwGtpv2cTrxnPeerRspWaitTimeout(void* arg) {
     /** Set the flags. */
     ulpApi.u_api_info.rspFailureInfo.trx_flags = thiz->trx_flags;
     OAILOG_ERROR(LOG_GTPV2C, "N3 retries expired for transaction %p\n", thiz);
-    RB_REMOVE(
-        NwGtpv2cOutstandingTxSeqNumTrxnMap, &(pStack->outstandingTxSeqNumMap),
-        thiz);
+    nwGtpv2cHashMapRemove(&(pStack->outstandingTxSeqNumMap), thiz);
     rc = nwGtpv2cTrxnDelete(&thiz);
     rc = pStack->ulp.ulpReqCallback(pStack->ulp.hUlp, &ulpApi);
   }
@@ -168,9 +162,7 @@ static nw_rc_t nwGtpv2cTrxnDuplicateRequestWaitTimeout(void* arg) {
       "%d\n",
       thiz, thiz->seqNum);
   thiz->hRspTmr = 0;
-  RB_REMOVE(
-      NwGtpv2cOutstandingRxSeqNumTrxnMap, &(pStack->outstandingRxSeqNumMap),
-      thiz);
+  nwGtpv2cHashMapRemove(&(pStack->outstandingRxSeqNumMap), thiz);
   rc = nwGtpv2cTrxnDelete(&thiz);
   NW_ASSERT(NW_OK == rc);
   return rc;
@@ -352,9 +344,8 @@ nw_gtpv2c_trxn_t* nwGtpv2cTrxnOutstandingRxNew(
     pTrxn->pMsg     = NULL;
     pTrxn->hRspTmr  = 0;
     pTrxn->pt_trx   = false;
-    pCollision      = RB_INSERT(
-        NwGtpv2cOutstandingRxSeqNumTrxnMap, &(thiz->outstandingRxSeqNumMap),
-        pTrxn);
+    pCollision      = nwGtpv2cHashMapInsert(
+        &(thiz->outstandingRxSeqNumMap), pTrxn);
 
     if (pCollision) {
       OAILOG_WARNING(
@@ -394,6 +385,23 @@ nw_gtpv2c_trxn_t* nwGtpv2cTrxnOutstandingRxNew(
   return (pTrxn);
 }
 
+/**
+   Preallocate transactions into the transaction pool
+
+   @param[in] thiz : Pointer to stack.
+   @param[in] count : Number of transactions the pool should hold.
+   @return NW_OK on success.
+*/
+
+nw_rc_t nwGtpv2cTrxnPoolPreallocate(
+    NW_IN nw_gtpv2c_stack_t* thiz, NW_IN uint32_t count) {
+  nw_rc_t rc = NW_OK;
+
+  NW_GTPV2C_POOL_PREALLOCATE(
+      thiz, gpGtpv2cTrxnPool, nw_gtpv2c_trxn_t, count, rc);
+  return rc;
+}
+
 /**
    Destructor
 
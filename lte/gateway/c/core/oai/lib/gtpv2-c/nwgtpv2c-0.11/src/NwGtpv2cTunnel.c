@@ -83,6 +83,16 @@ nw_rc_t nwGtpv2cTunnelDelete(
   return NW_OK;
 }
 
+//------------------------------------------------------------------------------
+nw_rc_t nwGtpv2cTunnelPoolPreallocate(
+    struct nw_gtpv2c_stack_s* pStack, uint32_t count) {
+  nw_rc_t rc = NW_OK;
+
+  NW_GTPV2C_POOL_PREALLOCATE(
+      pStack, gpGtpv2cTunnelPool, nw_gtpv2c_tunnel_t, count, rc);
+  return rc;
+}
+
 //------------------------------------------------------------------------------
 nw_rc_t nwGtpv2cTunnelGetUlpTunnelHandle(
     nw_gtpv2c_tunnel_t* thiz, nw_gtpv2c_ulp_tunnel_handle_t* phUlpTunnel) {
@@ -103,6 +103,12 @@ static inline hash_size_t def_hashfunc(const uint64_t keyP) {
   return (hash_size_t) keyP;
 }
 
+//------------------------------------------------------------------------------
+hash_size_t hash_key_pair_hashfunc(const hash_key_t keyP) {
+  // Knuth's multiplicative hash keeps consecutive upper ids apart
+  return (hash_size_t)(((keyP >> 32) * 2654435761u) ^ (keyP & 0xFFFFFFFF));
+}
+
 //------------------------------------------------------------------------------
 /*
    Initialization
@@ -147,6 +147,12 @@ typedef struct hashtable_uint64_element_array_s {
 
 char* hashtable_rc_code2string(hashtable_rc_t rc);
 void hash_free_int_func(void** memory);
+/**
+ * Hash function for keys made of two 32 bit ids, e.g. the composite S1AP and
+ * NGAP ids of a UE. The default one keeps the key, whose low bits only index
+ * a power of 2 sized table, so keys sharing their lower id share a bucket.
+ */
+hash_size_t hash_key_pair_hashfunc(const hash_key_t keyP);
 hash_table_t* hashtable_init(
     hash_table_t* const hashtbl, const hash_size_t size,
     hash_size_t (*hashfunc)(const hash_key_t), void (*freefunc)(void**),
@@ -57,6 +57,8 @@
 #include "signals.h"
 #include "timer.h"
 #include "dynamic_memory_check.h"
+#include "mem_arena.h"
+#include "itti_trace.h"
 #include "shared_ts_log.h"
 #include "log.h"
 
@@ -118,9 +120,17 @@ typedef struct itti_desc_s {
 
 static itti_desc_t itti_desc;
 
+// Messages sent to and received by each task, updated atomically. Their
+// difference is the depth of the task queue.
+static uint64_t itti_sent_msgs[TASK_MAX];
+static uint64_t itti_received_msgs[TASK_MAX];
+// Task receiving messages on the current thread
+static __thread task_id_t itti_thread_task_id = TASK_UNKNOWN;
+
 status_code_e send_msg_to_task(
     task_zmq_ctx_t* task_zmq_ctx_p, task_id_t destination_task_id,
     MessageDef* message) {
+  bool sent = false;
   if (likely(task_zmq_ctx_p->ready)) {
     AssertFatal(
         task_zmq_ctx_p->push_socks[destination_task_id],
@@ -137,8 +147,18 @@ status_code_e send_msg_to_task(
     pthread_mutex_lock(&task_zmq_ctx_p->send_mutex);
     int rc =
         zframe_send(&frame, task_zmq_ctx_p->push_socks[destination_task_id], 0);
-    assert(rc == 0);
     pthread_mutex_unlock(&task_zmq_ctx_p->send_mutex);
+    if (likely(rc == 0)) {
+      __atomic_fetch_add(
+          &itti_sent_msgs[destination_task_id], 1, __ATOMIC_RELAXED);
+      sent = true;
+    } else {
+      zframe_destroy(&frame);
+      OAI_FPRINTF_ERR(
+          "Failed to send msg %s to %s!\n",
+          itti_get_message_name(message->ittiMsgHeader.messageId),
+          itti_get_task_name(destination_task_id));
+    }
   } else {
     OAI_FPRINTF_ERR(
         "Sending msg using uninitialized context. %s to %s!\n",
@@ -146,6 +166,10 @@ status_code_e send_msg_to_task(
         itti_get_task_name(destination_task_id));
   }
 
+  if (!sent) {
+    // No receiver will free the message, its arena goes with it
+    mem_arena_destroy(&message->ittiMsgHeader.arena);
+  }
   free(message);
   return RETURNok;
 }
@@ -160,10 +184,22 @@ MessageDef* receive_msg(zsock_t* reader) {
   memcpy(msg, zframe_data(msg_frame), zframe_size(msg_frame));
 
   zframe_destroy(&msg_frame);
+  if (itti_thread_task_id != TASK_UNKNOWN) {
+    __atomic_fetch_add(
+        &itti_received_msgs[itti_thread_task_id], 1, __ATOMIC_RELAXED);
+    if (unlikely(itti_trace_enabled)) {
+      itti_trace_msg_received(itti_thread_task_id, msg);
+    }
+  }
   return msg;
 }
 
 void send_broadcast_msg(task_zmq_ctx_t* task_zmq_ctx_p, MessageDef* message) {
+  // Every receiver frees its copy of the message, an arena would be freed
+  // more than once
+  AssertFatal(
+      !message->ittiMsgHeader.arena, "Broadcasting msg %s with an arena!\n",
+      itti_get_message_name(message->ittiMsgHeader.messageId));
   zframe_t* frame = zframe_new(
       message, sizeof(MessageHeader) + message->ittiMsgHeader.ittiMsgSize);
   assert(frame);
@@ -173,6 +209,7 @@ void send_broadcast_msg(task_zmq_ctx_t* task_zmq_ctx_p, MessageDef* message) {
       // Reuse the same frame
       int rc = zframe_send(&frame, task_zmq_ctx_p->push_socks[i], ZFRAME_REUSE);
       assert(rc == 0);
+      __atomic_fetch_add(&itti_sent_msgs[i], 1, __ATOMIC_RELAXED);
     }
   }
 
@@ -199,6 +236,17 @@ void stop_timer(task_zmq_ctx_t* task_zmq_ctx_p, int timer_id) {
   zloop_timer_end(task_zmq_ctx_p->event_loop, timer_id);
 }
 
+// Runs the task handler, timing it when tracing
+static int handle_task_msg(zloop_t* loop, zsock_t* reader, void* arg) {
+  task_zmq_ctx_t* task_zmq_ctx_p = (task_zmq_ctx_t*) arg;
+  int rc = task_zmq_ctx_p->msg_handler(loop, reader, NULL);
+
+  if (unlikely(itti_trace_enabled)) {
+    itti_trace_msg_handled(task_zmq_ctx_p->task_id);
+  }
+  return rc;
+}
+
 void init_task_context(
     task_id_t task_id, const task_id_t* remote_task_ids,
     uint8_t remote_tasks_count, zloop_reader_fn msg_handler,
@@ -226,10 +274,14 @@ void init_task_context(
         task_zmq_ctx_p->pull_sock, "task id: %d uri: %s", task_id,
         itti_desc.tasks_info[task_id].uri);
 
+    task_zmq_ctx_p->msg_handler = msg_handler;
+
     int rc = zloop_reader(
-        task_zmq_ctx_p->event_loop, task_zmq_ctx_p->pull_sock, msg_handler,
-        NULL);
+        task_zmq_ctx_p->event_loop, task_zmq_ctx_p->pull_sock,
+        handle_task_msg, task_zmq_ctx_p);
     assert(rc == 0);
+    // Tasks set up their context on the thread running their loop
+    itti_thread_task_id = task_id;
   }
 
   task_zmq_ctx_p->ready = true;
@@ -266,6 +318,15 @@ const char* itti_get_task_name(task_id_t task_id) {
   return (itti_desc.tasks_info[task_id].name);
 }
 
+uint64_t itti_get_task_queue_depth(task_id_t task_id) {
+  AssertFatal(task_id < TASK_MAX, "Task id (%d) is out of range!\n", task_id);
+  uint64_t received =
+      __atomic_load_n(&itti_received_msgs[task_id], __ATOMIC_RELAXED);
+  uint64_t sent = __atomic_load_n(&itti_sent_msgs[task_id], __ATOMIC_RELAXED);
+  // The counters are read separately, do not report a transient underflow
+  return (sent > received) ? sent - received : 0;
+}
+
 static task_id_t itti_get_current_task_id(void) {
   task_id_t task_id;
   thread_id_t thread_id;
@@ -306,6 +367,7 @@ static MessageDef* itti_alloc_new_message_sized(
   new_msg->ittiMsgHeader.originTaskId = origin_task_id;
   new_msg->ittiMsgHeader.ittiMsgSize  = size;
   new_msg->ittiMsgHeader.imsi         = 0;
+  new_msg->ittiMsgHeader.arena        = NULL;
   clock_gettime(CLOCK_MONOTONIC_RAW, &new_msg->ittiMsgHeader.timestamp);
 
   return new_msg;
@@ -325,6 +387,15 @@ MessageDef* DEPRECATEDitti_alloc_new_message_fatal(
   return message_p;
 }
 
+mem_arena_t* itti_get_msg_arena(MessageDef* message) {
+  if (!message->ittiMsgHeader.arena) {
+    message->ittiMsgHeader.arena = mem_arena_create(0);
+    AssertFatal(
+        message->ittiMsgHeader.arena, "Message arena allocation failed!\n");
+  }
+  return message->ittiMsgHeader.arena;
+}
+
 status_code_e itti_create_task(
     task_id_t task_id, void* (*start_routine)(void*), void* args_p) {
   thread_id_t thread_id = TASK_GET_THREAD_ID(task_id);
@@ -73,6 +73,7 @@ typedef struct task_zmq_ctx_s {
   zsock_t* pull_sock;
   zsock_t* push_socks[TASK_MAX];
   pthread_mutex_t send_mutex;
+  zloop_reader_fn* msg_handler;
   bool ready;
 } task_zmq_ctx_t;
 
@@ -183,6 +184,12 @@ const char* itti_get_message_name(MessagesIds message_id);
  **/
 const char* itti_get_task_name(task_id_t task_id);
 
+/** \brief Return the number of messages sent to a task that it did not
+ * receive yet, across all senders.
+ * \param task_id Id of the task
+ **/
+uint64_t itti_get_task_queue_depth(task_id_t task_id);
+
 /** \brief Alloc and memset(0) a new itti message.
  * \param origin_task_id Task ID of the sending task
  * \param message_id Message ID
@@ -201,6 +208,16 @@ MessageDef* itti_alloc_new_message(
 MessageDef* DEPRECATEDitti_alloc_new_message_fatal(
     task_id_t origin_task_id, MessagesIds message_id);
 
+/** \brief Return the arena bound to the message, creating it on first use.
+ * Allocations made from it are released by itti_free_msg_content(), or by
+ * send_msg_to_task() if the message is dropped. Messages sent with
+ * send_broadcast_msg() cannot have an arena.
+ * \param message Message owning the arena
+ * @returns arena of the message
+ * @note Asserts that the arena could be allocated
+ **/
+struct mem_arena_s* itti_get_msg_arena(MessageDef* message);
+
 /**
  * \brief Returns IMSI of ITTI task
  * @param msg MessageDef struct
@@ -130,11 +130,11 @@ typedef struct MessageHeader_s {
       task_id_t destinationTaskId; /**< ID of the destination task */
       struct timespec timestamp;   /** Time msg got created */
       instance_t instance;         /**< Task instance for virtualization */
-      imsi64_t imsi;               /** IMSI associated to sender task */
-      long last_hop_latency;       /** Last hop zmq latency */
-
       MessageHeaderSize
           ittiMsgSize; /**< Message size (not including header size) */
+      imsi64_t imsi;               /** IMSI associated to sender task */
+      long last_hop_latency;       /** Last hop zmq latency */
+      struct mem_arena_s* arena;   /** Payload arena, freed with content */
     };
     // Add padding to avoid any holes in MessageDef object.
     uint8_t __pad[64];
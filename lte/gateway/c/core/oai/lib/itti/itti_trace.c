@@ -0,0 +1,235 @@
+/**
+ * Copyright 2020 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "itti_trace.h"
+#include "intertask_interface.h"
+#include "backtrace.h"
+
+typedef struct itti_trace_histogram_s {
+  uint64_t buckets[ITTI_TRACE_BUCKETS];
+  uint64_t sum_usec;
+  uint64_t max_usec;
+} itti_trace_histogram_t;
+
+// Updated by every task receiving the message id, hence atomically
+typedef struct itti_trace_msg_stats_s {
+  uint64_t count;
+  uint64_t cpu_usec;
+  itti_trace_histogram_t queue;
+  itti_trace_histogram_t handler;
+} itti_trace_msg_stats_t;
+
+typedef struct itti_trace_record_s {
+  struct timespec received;
+  MessagesIds message_id;
+  task_id_t origin_task_id;
+  imsi64_t imsi;
+  uint32_t queue_usec;
+  uint32_t handler_usec;
+  uint32_t cpu_usec;
+} itti_trace_record_t;
+
+// Only written by the thread of the task
+typedef struct itti_trace_task_stats_s {
+  uint64_t count;
+  uint64_t handler_usec;
+  uint64_t cpu_usec;
+  uint64_t max_handler_usec;
+  uint64_t recorded;
+  itti_trace_record_t recorder[ITTI_TRACE_RECORDER_SIZE];
+} itti_trace_task_stats_t;
+
+// Message being handled by the task of the current thread
+typedef struct itti_trace_current_s {
+  bool pending;
+  itti_trace_record_t record;
+  struct timespec cpu_start;
+} itti_trace_current_t;
+
+bool itti_trace_enabled = false;
+
+static itti_trace_msg_stats_t itti_trace_msgs[MESSAGES_ID_MAX];
+static itti_trace_task_stats_t itti_trace_tasks[TASK_MAX];
+static __thread itti_trace_current_t itti_trace_current;
+
+static uint64_t elapsed_usec(
+    const struct timespec* start, const struct timespec* end) {
+  int64_t usec = (end->tv_sec - start->tv_sec) * 1000000 +
+                 (end->tv_nsec - start->tv_nsec) / 1000;
+  return usec > 0 ? (uint64_t) usec : 0;
+}
+
+static void histogram_observe(
+    itti_trace_histogram_t* histogram, uint64_t usec) {
+  int bucket = (usec == 0) ? 0 : 64 - __builtin_clzll(usec);
+  if (bucket >= ITTI_TRACE_BUCKETS) {
+    bucket = ITTI_TRACE_BUCKETS - 1;
+  }
+  __atomic_fetch_add(&histogram->buckets[bucket], 1, __ATOMIC_RELAXED);
+  __atomic_fetch_add(&histogram->sum_usec, usec, __ATOMIC_RELAXED);
+
+  uint64_t max = __atomic_load_n(&histogram->max_usec, __ATOMIC_RELAXED);
+  while (usec > max &&
+         !__atomic_compare_exchange_n(
+             &histogram->max_usec, &max, usec, true, __ATOMIC_RELAXED,
+             __ATOMIC_RELAXED)) {
+  }
+}
+
+// Upper bound of the bucket holding the percentile, in microseconds
+static uint64_t histogram_percentile(
+    const itti_trace_histogram_t* histogram, uint64_t count,
+    uint32_t percentile) {
+  uint64_t rank = (count * percentile + 99) / 100;
+  uint64_t seen = 0;
+
+  for (int bucket = 0; bucket < ITTI_TRACE_BUCKETS; bucket++) {
+    seen += histogram->buckets[bucket];
+    if (seen >= rank) {
+      return bucket < ITTI_TRACE_BUCKETS - 1 ? (1ULL << bucket) :
+                                               histogram->max_usec;
+    }
+  }
+  return histogram->max_usec;
+}
+
+static void dump_backtrace_trace(void) {
+  itti_trace_dump(stdout);
+}
+
+void itti_trace_enable(bool enable) {
+  itti_trace_enabled = enable;
+  backtrace_set_crash_dump(enable ? dump_backtrace_trace : NULL);
+}
+
+void itti_trace_msg_received(task_id_t task_id, const MessageDef* message) {
+  itti_trace_current_t* current = &itti_trace_current;
+
+  current->pending               = true;
+  current->record.message_id     = message->ittiMsgHeader.messageId;
+  current->record.origin_task_id = message->ittiMsgHeader.originTaskId;
+  current->record.imsi           = message->ittiMsgHeader.imsi;
+  clock_gettime(CLOCK_MONOTONIC_RAW, &current->record.received);
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &current->cpu_start);
+  current->record.queue_usec = elapsed_usec(
+      &message->ittiMsgHeader.timestamp, &current->record.received);
+}
+
+void itti_trace_msg_handled(task_id_t task_id) {
+  itti_trace_current_t* current = &itti_trace_current;
+  struct timespec now, cpu_now;
+
+  if (!current->pending || task_id >= TASK_MAX) {
+    return;
+  }
+  current->pending = false;
+  clock_gettime(CLOCK_MONOTONIC_RAW, &now);
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpu_now);
+  current->record.handler_usec =
+      elapsed_usec(&current->record.received, &now);
+  current->record.cpu_usec = elapsed_usec(&current->cpu_start, &cpu_now);
+
+  itti_trace_msg_stats_t* msg = &itti_trace_msgs[current->record.message_id];
+  __atomic_fetch_add(&msg->count, 1, __ATOMIC_RELAXED);
+  __atomic_fetch_add(
+      &msg->cpu_usec, current->record.cpu_usec, __ATOMIC_RELAXED);
+  histogram_observe(&msg->queue, current->record.queue_usec);
+  histogram_observe(&msg->handler, current->record.handler_usec);
+
+  itti_trace_task_stats_t* task = &itti_trace_tasks[task_id];
+  task->count++;
+  task->handler_usec += current->record.handler_usec;
+  task->cpu_usec += current->record.cpu_usec;
+  if (current->record.handler_usec > task->max_handler_usec) {
+    task->max_handler_usec = current->record.handler_usec;
+  }
+  task->recorder[task->recorded % ITTI_TRACE_RECORDER_SIZE] = current->record;
+  task->recorded++;
+}
+
+static void dump_task(FILE* stream, task_id_t task_id) {
+  const itti_trace_task_stats_t* task = &itti_trace_tasks[task_id];
+  struct timespec now;
+  uint64_t first = task->recorded > ITTI_TRACE_RECORDER_SIZE ?
+                       task->recorded - ITTI_TRACE_RECORDER_SIZE :
+                       0;
+
+  fprintf(
+      stream,
+      "%s: %lu messages, handler %lu us (max %lu us), cpu %lu us\n",
+      itti_get_task_name(task_id), task->count, task->handler_usec,
+      task->max_handler_usec, task->cpu_usec);
+  clock_gettime(CLOCK_MONOTONIC_RAW, &now);
+  // Most recent first
+  for (uint64_t i = task->recorded; i > first; i--) {
+    const itti_trace_record_t* record =
+        &task->recorder[(i - 1) % ITTI_TRACE_RECORDER_SIZE];
+    fprintf(
+        stream,
+        "  -%lu us %s from %s imsi %lu queue %u us handler %u us cpu %u us\n",
+        elapsed_usec(&record->received, &now),
+        itti_get_message_name(record->message_id),
+        itti_get_task_name(record->origin_task_id), record->imsi,
+        record->queue_usec, record->handler_usec, record->cpu_usec);
+  }
+}
+
+static void dump_message(FILE* stream, MessagesIds message_id) {
+  const itti_trace_msg_stats_t* msg = &itti_trace_msgs[message_id];
+
+  fprintf(
+      stream,
+      "%s: %lu messages, queue p50 %lu us p99 %lu us max %lu us, "
+      "handler p50 %lu us p99 %lu us max %lu us, cpu %lu us\n",
+      itti_get_message_name(message_id), msg->count,
+      histogram_percentile(&msg->queue, msg->count, 50),
+      histogram_percentile(&msg->queue, msg->count, 99), msg->queue.max_usec,
+      histogram_percentile(&msg->handler, msg->count, 50),
+      histogram_percentile(&msg->handler, msg->count, 99),
+      msg->handler.max_usec, msg->cpu_usec);
+}
+
+void itti_trace_dump(FILE* stream) {
+  fprintf(stream, "ITTI trace, latencies are bucket upper bounds\n");
+  for (task_id_t task_id = TASK_FIRST; task_id < TASK_MAX; task_id++) {
+    if (itti_trace_tasks[task_id].count > 0) {
+      dump_task(stream, task_id);
+    }
+  }
+  for (MessagesIds message_id = 0; message_id < MESSAGES_ID_MAX;
+       message_id++) {
+    if (itti_trace_msgs[message_id].count > 0) {
+      dump_message(stream, message_id);
+    }
+  }
+  fflush(stream);
+}
+
+char* itti_trace_dump_to_string(void) {
+  char* dump   = NULL;
+  size_t size  = 0;
+  FILE* stream = open_memstream(&dump, &size);
+
+  if (stream == NULL) {
+    return NULL;
+  }
+  itti_trace_dump(stream);
+  fclose(stream);
+  return dump;
+}
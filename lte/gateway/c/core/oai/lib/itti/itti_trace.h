@@ -0,0 +1,74 @@
+/**
+ * Copyright 2020 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*! \file itti_trace.h
+  \brief Latency tracing of the messages handled by ITTI tasks.
+  When enabled, every message a task receives is timed from its allocation
+  to its reception (queueing) and from its reception to the return of the
+  task handler (handling), wall clock and thread CPU time. Per message id
+  histograms and per task totals are kept, along with a flight recorder of
+  the last ITTI_TRACE_RECORDER_SIZE messages of each task. When disabled the
+  cost is a load and a branch per message.
+*/
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "intertask_interface_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Histogram bucket i holds durations below 2^i microseconds, the last one
+// everything above
+#define ITTI_TRACE_BUCKETS 24
+// Messages kept per task, a power of 2
+#define ITTI_TRACE_RECORDER_SIZE 128
+
+extern bool itti_trace_enabled;
+
+/**
+ * Start or stop tracing. Enabling also has the trace dumped along with the
+ * backtrace when the process crashes.
+ */
+void itti_trace_enable(bool enable);
+
+/**
+ * Called by receive_msg() on the thread of the receiving task
+ */
+void itti_trace_msg_received(task_id_t task_id, const MessageDef* message);
+
+/**
+ * Called once the task handler returned
+ */
+void itti_trace_msg_handled(task_id_t task_id);
+
+/**
+ * Print the per task totals, the flight recorders and the per message id
+ * latencies. Meant for diagnostics, it reads counters that may be updated
+ * concurrently.
+ */
+void itti_trace_dump(FILE* stream);
+
+/**
+ * @return itti_trace_dump() output in a string to free, NULL on error
+ */
+char* itti_trace_dump_to_string(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -26,7 +26,6 @@
 #include <iostream>
 #include <memory>
 #include <string>
-#include <thread>
 #include <utility>
 
 #include "lte/protos/mobilityd.grpc.pb.h"
@@ -251,7 +250,8 @@ void MobilityServiceClient::AllocateIPAddressRPC(
     const AllocateIPRequest& request,
     const std::function<void(Status, AllocateIPAddressResponse)>& callback) {
   auto localResp = new AsyncLocalResponse<AllocateIPAddressResponse>(
-      std::move(callback), RESPONSE_TIMEOUT);
+      std::move(callback), RESPONSE_TIMEOUT,
+      "MobilityService/AllocateIPAddress");
   localResp->set_response_reader(std::move(stub_->AsyncAllocateIPAddress(
       localResp->get_context(), request, &queue_)));
 }
@@ -259,17 +259,17 @@ void MobilityServiceClient::AllocateIPAddressRPC(
 void MobilityServiceClient::ReleaseIPAddressRPC(
     const ReleaseIPRequest& request,
     const std::function<void(grpc::Status, magma::orc8r::Void)>& callback) {
-  auto localResp = new AsyncLocalResponse<Void>(callback, RESPONSE_TIMEOUT);
+  auto localResp = new AsyncLocalResponse<Void>(
+      callback, RESPONSE_TIMEOUT, "MobilityService/ReleaseIPAddress");
   localResp->set_response_reader(std::move(stub_->AsyncReleaseIPAddress(
       localResp->get_context(), request, &queue_)));
 }
 
-MobilityServiceClient::MobilityServiceClient() {
+MobilityServiceClient::MobilityServiceClient()
+    : GRPCReceiver(GRPCRuntime::get_instance()) {
   auto channel = ServiceRegistrySingleton::Instance()->GetGrpcChannel(
       "mobilityd", ServiceRegistrySingleton::LOCAL);
   stub_ = MobilityService::NewStub(channel);
-  std::thread resp_loop_thread([&]() { rpc_response_loop(); });
-  resp_loop_thread.detach();
 }
 
 MobilityServiceClient& MobilityServiceClient::getInstance() {
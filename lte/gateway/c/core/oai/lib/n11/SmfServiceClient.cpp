@@ -52,7 +52,8 @@ void AsyncSmfServiceClient::set_smf_session_rpc(
     const SetSMSessionContext& request,
     std::function<void(Status, SmContextVoid)> callback) {
   auto local_resp = new magma::AsyncLocalResponse<SmContextVoid>(
-      std::move(callback), RESPONSE_TIMEOUT);
+      std::move(callback), RESPONSE_TIMEOUT,
+      "AmfPduSessionSmContext/SetAmfSessionContext");
   local_resp->set_response_reader(std::move(stub_->AsyncSetAmfSessionContext(
       local_resp->get_context(), request, &queue_)));
 }
@@ -65,6 +65,11 @@ SwitchUpEvent::SwitchUpEvent(
     const void* data, const size_t len)
     : DataEvent(ofconn, ofhandler, data, len, EVENT_SWITCH_UP) {}
 
+FlowStatsReplyEvent::FlowStatsReplyEvent(
+    fluid_base::OFConnection* ofconn, fluid_base::OFHandler& ofhandler,
+    const void* data, const size_t len)
+    : DataEvent(ofconn, ofhandler, data, len, EVENT_FLOW_STATS_REPLY) {}
+
 SwitchDownEvent::SwitchDownEvent(fluid_base::OFConnection* ofconn)
     : ControllerEvent(ofconn, EVENT_SWITCH_DOWN) {}
 
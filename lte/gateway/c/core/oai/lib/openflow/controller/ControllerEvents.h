@@ -41,6 +41,8 @@ enum ControllerEventType {
   EVENT_DELETE_PAGING_RULE,
   EVENT_ADD_GTP_S8_TUNNEL,
   EVENT_DELETE_GTP_S8_TUNNEL,
+  EVENT_FLOW_STATS_REPLY,
+  EVENT_RECONCILE_GTP_TUNNELS,
 };
 
 /**
@@ -106,6 +108,17 @@ class SwitchUpEvent : public DataEvent {
       const void* data, const size_t len);
 };
 
+/**
+ * Event triggered when the switch replies to a flow stats request, once for
+ * each part of the reply
+ */
+class FlowStatsReplyEvent : public DataEvent {
+ public:
+  FlowStatsReplyEvent(
+      fluid_base::OFConnection* ofconn, fluid_base::OFHandler& ofhandler,
+      const void* data, const size_t len);
+};
+
 /**
  * Event triggered when the controller loses connection with the switch
  */
@@ -53,7 +53,7 @@ int start_of_controller(bool persist_state) {
       spgw_config.sgw_config.ovs_config.mtr_port_num,
       spgw_config.sgw_config.ovs_config.internal_sampling_port_num,
       spgw_config.sgw_config.ovs_config.internal_sampling_fwd_tbl_num,
-      uplink_port_num_);
+      uplink_port_num_, persist_state);
   // Base app registers first, because it deletes/creates default flow
   ctrl.register_for_event(&base_app, openflow::EVENT_SWITCH_UP);
   ctrl.register_for_event(&base_app, openflow::EVENT_ERROR);
@@ -68,6 +68,8 @@ int start_of_controller(bool persist_state) {
   ctrl.register_for_event(&gtp_app, openflow::EVENT_DELETE_GTP_S8_TUNNEL);
   ctrl.register_for_event(&gtp_app, openflow::EVENT_DISCARD_DATA_ON_GTP_TUNNEL);
   ctrl.register_for_event(&gtp_app, openflow::EVENT_FORWARD_DATA_ON_GTP_TUNNEL);
+  ctrl.register_for_event(&gtp_app, openflow::EVENT_FLOW_STATS_REPLY);
+  ctrl.register_for_event(&gtp_app, openflow::EVENT_RECONCILE_GTP_TUNNELS);
   ctrl.start();
   OAILOG_INFO(LOG_GTPV1U, "Started openflow controller\n");
 #define CONNECTION_WAIT_TIME 300
@@ -190,6 +192,13 @@ int openflow_controller_forward_data_on_tunnel(
   OAILOG_FUNC_RETURN(LOG_GTPV1U, RETURNok);
 }
 
+int openflow_controller_reconcile_gtp_tunnels(void) {
+  auto reconcile_event = std::make_shared<openflow::ExternalEvent>(
+      openflow::EVENT_RECONCILE_GTP_TUNNELS);
+  ctrl.inject_external_event(reconcile_event, external_event_callback);
+  OAILOG_FUNC_RETURN(LOG_GTPV1U, RETURNok);
+}
+
 int openflow_controller_add_paging_rule(struct in_addr ue_ip) {
   auto paging_event = std::make_shared<openflow::AddPagingRuleEvent>(ue_ip);
   ctrl.inject_external_event(paging_event, external_event_callback);
@@ -64,6 +64,12 @@ int openflow_controller_del_gtp_s8_tunnel(
     struct in_addr ue, struct in6_addr* ue_ipv6, uint32_t i_tei,
     struct ip_flow_dl* flow_dl, uint32_t enb_gtp_port, uint32_t pgw_gtp_port);
 
+/*
+ * Called once the tunnels restored on restart were added again, removes the
+ * tunnel flows left on the switch for the other tunnels
+ */
+int openflow_controller_reconcile_gtp_tunnels(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -22,6 +22,7 @@
 #include "GTPApplication.h"
 #include "IMSIEncoder.h"
 #include "gtpv1u.h"
+#include "service303.h"
 
 extern "C" {
 #include "log.h"
@@ -38,18 +39,27 @@ const std::uint16_t OFPVID_PRESENT             = 0x1000;
 GTPApplication::GTPApplication(
     const std::string& uplink_mac, uint32_t gtp_port_num, uint32_t mtr_port_num,
     uint32_t internal_sampling_port_num, uint32_t internal_sampling_fwd_tbl_num,
-    uint32_t uplink_port_num)
+    uint32_t uplink_port_num, bool persist_state)
     : uplink_mac_(uplink_mac),
       gtp0_port_num_(gtp_port_num),
       mtr_port_num_(mtr_port_num),
       internal_sampling_port_num_(internal_sampling_port_num),
       internal_sampling_fwd_tbl_num_(internal_sampling_fwd_tbl_num),
-      uplink_port_num_(uplink_port_num) {}
+      uplink_port_num_(uplink_port_num),
+      reconcile_pending_(persist_state),
+      tunnel_flows_dumped_(false),
+      tunnels_replayed_(false),
+      legacy_tunnel_flows_(persist_state),
+      num_legacy_flows_(0),
+      num_kept_tunnels_(0) {}
 
 void GTPApplication::event_callback(
     const ControllerEvent& ev, const OpenflowMessenger& messenger) {
   if (ev.get_type() == EVENT_ADD_GTP_TUNNEL) {
     auto add_tunnel_event = static_cast<const AddGTPTunnelEvent&>(ev);
+    if (is_replayed_tunnel_installed(add_tunnel_event)) {
+      return;
+    }
     add_uplink_tunnel_flow(add_tunnel_event, messenger);
     add_downlink_tunnel_flow(
         add_tunnel_event, messenger, uplink_port_num_, false, false);
@@ -113,7 +123,228 @@ void GTPApplication::event_callback(
     install_internal_pkt_fwd_flow(
         ev.get_connection(), messenger, internal_sampling_port_num_,
         internal_sampling_fwd_tbl_num_);
+    if (reconcile_pending_ && !tunnel_flows_dumped_) {
+      request_tunnel_flows(ev.get_connection(), messenger);
+    }
+  } else if (ev.get_type() == EVENT_FLOW_STATS_REPLY) {
+    handle_flow_stats_reply(
+        static_cast<const FlowStatsReplyEvent&>(ev), messenger);
+  } else if (ev.get_type() == EVENT_RECONCILE_GTP_TUNNELS) {
+    handle_tunnels_replayed(ev, messenger);
+  }
+}
+
+void GTPApplication::request_tunnel_flows(
+    fluid_base::OFConnection* ofconn, const OpenflowMessenger& messenger) {
+  // Tunnel flows can't be told apart by cookie in the request, filter them
+  // in the reply
+  of13::MultipartRequestFlow request(
+      1, 0, 0, of13::OFPP_ANY, of13::OFPG_ANY, 0, 0);
+  switch_tunnel_flows_.clear();
+  num_legacy_flows_ = 0;
+  messenger.send_of_msg(request, ofconn);
+  OAILOG_INFO(LOG_GTPV1U, "Requested flows to reconcile GTP tunnels\n");
+}
+
+void GTPApplication::handle_flow_stats_reply(
+    const FlowStatsReplyEvent& ev, const OpenflowMessenger& messenger) {
+  auto header = reinterpret_cast<const struct of13::ofp_multipart_reply*>(
+      ev.get_data());
+  if (!reconcile_pending_ || tunnel_flows_dumped_ ||
+      ntohs(header->type) != of13::OFPMP_FLOW) {
+    return;
+  }
+  of13::MultipartReplyFlow reply;
+  if (reply.unpack(const_cast<uint8_t*>(ev.get_data())) != 0) {
+    OAILOG_ERROR(LOG_GTPV1U, "Could not unpack flow stats reply\n");
+    return;
+  }
+  for (auto& stats : reply.flow_stats()) {
+    uint32_t kind = tunnel_flow_kind(stats);
+    if (kind == 0) {
+      continue;
+    }
+    uint32_t in_tei = stats.cookie() >> TUNNEL_COOKIE_SHIFT;
+    if (in_tei == 0) {
+      num_legacy_flows_++;
+      continue;
+    }
+    // The flows discarding data are not among those added for the tunnel,
+    // they are still deleted with it if stale
+    uint32_t& flows = switch_tunnel_flows_[in_tei];
+    if ((stats.cookie() & ~TUNNEL_COOKIE_MASK) == 0) {
+      flows |= kind;
+    }
+  }
+  if (ntohs(header->flags) & of13::OFPMPF_REPLY_MORE) {
+    return;
+  }
+  tunnel_flows_dumped_ = true;
+  // The legacy flows can't be told from those of S8 tunnels, which are not
+  // replayed, so they are left on the switch
+  legacy_tunnel_flows_ = num_legacy_flows_ > 0;
+  OAILOG_INFO(
+      LOG_GTPV1U,
+      "Found flows of %lu GTP tunnels on the switch, %u legacy flows\n",
+      switch_tunnel_flows_.size(), num_legacy_flows_);
+  if (tunnels_replayed_) {
+    remove_stale_tunnel_flows(ev.get_connection(), messenger);
+  }
+}
+
+void GTPApplication::handle_tunnels_replayed(
+    const ControllerEvent& ev, const OpenflowMessenger& messenger) {
+  if (!reconcile_pending_) {
+    return;
+  }
+  tunnels_replayed_ = true;
+  OAILOG_INFO(
+      LOG_GTPV1U, "SPGW replayed %lu GTP tunnels\n", replayed_teids_.size());
+  if (tunnel_flows_dumped_) {
+    remove_stale_tunnel_flows(ev.get_connection(), messenger);
+  }
+}
+
+bool GTPApplication::is_replayed_tunnel_installed(
+    const AddGTPTunnelEvent& ev) {
+  if (!reconcile_pending_ || tunnels_replayed_) {
+    return false;
+  }
+  replayed_teids_.insert(ev.get_in_tei());
+  // Until the flows are dumped, or if some are missing, the tunnel is added
+  // again, which replaces the flows the switch has
+  if (!tunnel_flows_dumped_) {
+    return false;
+  }
+  auto found = switch_tunnel_flows_.find(ev.get_in_tei());
+  if (found == switch_tunnel_flows_.end()) {
+    return false;
+  }
+  uint32_t expected = expected_tunnel_flows(ev);
+  if ((found->second & expected) != expected) {
+    return false;
+  }
+  num_kept_tunnels_++;
+  return true;
+}
+
+uint32_t GTPApplication::tunnel_flow_kind(of13::FlowStats& stats) {
+  auto in_port  = static_cast<of13::InPort*>(
+      stats.get_oxm_field(of13::OFPXMT_OFB_IN_PORT));
+  auto eth_type = static_cast<of13::EthType*>(
+      stats.get_oxm_field(of13::OFPXMT_OFB_ETH_TYPE));
+  uint32_t kind = 0;
+
+  if (stats.table_id() != 0 || in_port == NULL) {
+    return 0;
+  }
+  if (stats.get_oxm_field(of13::OFPXMT_OFB_TUNNEL_ID) != NULL) {
+    return TUNNEL_FLOW_UPLINK;
+  }
+  switch (eth_type ? eth_type->value() : 0) {
+    case 0x0800:
+      kind = TUNNEL_FLOW_DL_IPV4;
+      break;
+    case 0x86DD:
+      kind = TUNNEL_FLOW_DL_IPV6;
+      break;
+    case 0x0806:
+      kind = TUNNEL_FLOW_DL_ARP;
+      break;
+    default:
+      return 0;
+  }
+  if (in_port->value() == mtr_port_num_) {
+    return kind << TUNNEL_FLOW_MTR_SHIFT;
+  }
+  return in_port->value() == uplink_port_num_ ? kind : 0;
+}
+
+uint32_t GTPApplication::expected_tunnel_flows(const AddGTPTunnelEvent& ev) {
+  uint32_t dl_flows = TUNNEL_FLOW_DL_ARP;
+
+  if (ev.is_dl_flow_valid()) {
+    const struct ip_flow_dl& flow = ev.get_dl_flow();
+    dl_flows |= (flow.set_params & (DST_IPV4 | SRC_IPV4)) ?
+                    TUNNEL_FLOW_DL_IPV4 :
+                    TUNNEL_FLOW_DL_IPV6;
+  } else {
+    UeNetworkInfo ue_info = ev.get_ue_info();
+    if (ue_info.is_ue_ipv4_addr_valid()) {
+      dl_flows |= TUNNEL_FLOW_DL_IPV4;
+    }
+    if (ue_info.is_ue_ipv6_addr_valid()) {
+      dl_flows |= TUNNEL_FLOW_DL_IPV6;
+    }
+  }
+  return TUNNEL_FLOW_UPLINK | dl_flows | (dl_flows << TUNNEL_FLOW_MTR_SHIFT);
+}
+
+void GTPApplication::remove_stale_tunnel_flows(
+    fluid_base::OFConnection* ofconn, const OpenflowMessenger& messenger) {
+  uint32_t num_stale = 0;
+  for (const auto& tunnel : switch_tunnel_flows_) {
+    uint32_t in_tei = tunnel.first;
+    if (replayed_teids_.count(in_tei) > 0) {
+      continue;
+    }
+    of13::FlowMod fm =
+        messenger.create_default_flow_mod(0, of13::OFPFC_DELETE, 0);
+    // match all ports and groups
+    fm.out_port(of13::OFPP_ANY);
+    fm.out_group(of13::OFPG_ANY);
+    // Every flow of the tunnel, discarding data or not
+    fm.cookie((uint64_t) in_tei << TUNNEL_COOKIE_SHIFT);
+    fm.cookie_mask(TUNNEL_COOKIE_MASK);
+    messenger.send_of_msg(fm, ofconn);
+    num_stale++;
   }
+  uint32_t num_added = replayed_teids_.size() - num_kept_tunnels_;
+  OAILOG_INFO(
+      LOG_GTPV1U,
+      "Reconciled GTP tunnels: %u kept, %u stale removed, %u added\n",
+      num_kept_tunnels_, num_stale, num_added);
+  increment_counter(
+      "openflow_reconciled_tunnels", num_kept_tunnels_, 1, "result", "kept");
+  increment_counter(
+      "openflow_reconciled_tunnels", num_stale, 1, "result", "removed");
+  increment_counter(
+      "openflow_reconciled_tunnels", num_added, 1, "result", "added");
+
+  reconcile_pending_ = false;
+  std::unordered_map<uint32_t, uint32_t>().swap(switch_tunnel_flows_);
+  std::unordered_set<uint32_t>().swap(replayed_teids_);
+}
+
+/*
+ * Helper method to send the delete of flows of an S1 tunnel. Flows added
+ * before the in TEID was in the cookie have 0 in its upper half, they are
+ * deleted by a second flow mod while the switch may have some.
+ */
+void GTPApplication::send_tunnel_flow_delete(
+    of13::FlowMod& fm, const ControllerEvent& ev,
+    const OpenflowMessenger& messenger) {
+  messenger.send_of_msg(fm, ev.get_connection());
+  if (legacy_tunnel_flows_ && ev.get_type() == EVENT_DELETE_GTP_TUNNEL) {
+    fm.cookie(fm.cookie() & ~TUNNEL_COOKIE_MASK);
+    fm.cookie_mask(TUNNEL_COOKIE_MASK);
+    messenger.send_of_msg(fm, ev.get_connection());
+  }
+}
+
+/*
+ * Helper method to tag the flows of an S1 tunnel with its in TEID. S8 tunnels
+ * are not restored by SPGW, they keep the default cookie
+ */
+void GTPApplication::set_tunnel_cookie(
+    of13::FlowMod& fm, const ControllerEvent& ev, uint32_t in_tei) {
+  if (ev.get_type() != EVENT_ADD_GTP_TUNNEL &&
+      ev.get_type() != EVENT_DELETE_GTP_TUNNEL &&
+      ev.get_type() != EVENT_DISCARD_DATA_ON_GTP_TUNNEL) {
+    return;
+  }
+  fm.cookie(fm.cookie() | ((uint64_t) in_tei << TUNNEL_COOKIE_SHIFT));
+  fm.cookie_mask(TUNNEL_COOKIE_MASK);
 }
 
 void GTPApplication::install_internal_pkt_fwd_flow(
@@ -164,6 +395,7 @@ void GTPApplication::add_uplink_tunnel_flow(
       convert_precedence_to_priority(ev.get_dl_flow_precedence());
   of13::FlowMod uplink_fm =
       messenger.create_default_flow_mod(0, of13::OFPFC_ADD, flow_priority);
+  set_tunnel_cookie(uplink_fm, ev, ev.get_in_tei());
   add_tunnel_match(uplink_fm, ev.get_enb_gtp_portno(), ev.get_in_tei());
 
   // Set eth src and dst
@@ -226,10 +458,11 @@ void GTPApplication::delete_uplink_tunnel_flow(
   // match all ports and groups
   uplink_fm.out_port(of13::OFPP_ANY);
   uplink_fm.out_group(of13::OFPG_ANY);
+  set_tunnel_cookie(uplink_fm, ev, ev.get_in_tei());
 
   add_tunnel_match(uplink_fm, ev.get_enb_gtp_portno(), ev.get_in_tei());
 
-  messenger.send_of_msg(uplink_fm, ev.get_connection());
+  send_tunnel_flow_delete(uplink_fm, ev, messenger);
 }
 
 /*
@@ -426,6 +659,7 @@ void GTPApplication::add_downlink_tunnel_flow_action(
   } else {
     in_teid = ev.get_in_tei();
   }
+  set_tunnel_cookie(downlink_fm, ev, ev.get_in_tei());
 
   add_tunnel_flow_action(
       ev.get_out_tei(), in_teid, ev.get_imsi(), ev.get_enb_ip(),
@@ -524,6 +758,7 @@ void GTPApplication::add_downlink_arp_flow(
   of13::FlowMod downlink_fm =
       messenger.create_default_flow_mod(0, of13::OFPFC_ADD, flow_priority);
 
+  set_tunnel_cookie(downlink_fm, ev, ev.get_in_tei());
   add_downlink_arp_match(downlink_fm, ev.get_ue_ip(), ingress_port);
 
   add_downlink_arp_flow_action(ev, messenger, downlink_fm);
@@ -537,9 +772,10 @@ void GTPApplication::delete_downlink_tunnel_flow_ipv4(
   // match all ports and groups
   downlink_fm.out_port(of13::OFPP_ANY);
   downlink_fm.out_group(of13::OFPG_ANY);
+  set_tunnel_cookie(downlink_fm, ev, ev.get_in_tei());
 
   add_downlink_match(downlink_fm, ev.get_ue_ip(), ingress_port);
-  messenger.send_of_msg(downlink_fm, ev.get_connection());
+  send_tunnel_flow_delete(downlink_fm, ev, messenger);
 }
 
 void GTPApplication::delete_downlink_tunnel_flow_ded_brr(
@@ -550,9 +786,10 @@ void GTPApplication::delete_downlink_tunnel_flow_ded_brr(
   // match all ports and groups
   downlink_fm.out_port(of13::OFPP_ANY);
   downlink_fm.out_group(of13::OFPG_ANY);
+  set_tunnel_cookie(downlink_fm, ev, ev.get_in_tei());
 
   add_ded_brr_dl_match(downlink_fm, ev.get_dl_flow(), ingress_port);
-  messenger.send_of_msg(downlink_fm, ev.get_connection());
+  send_tunnel_flow_delete(downlink_fm, ev, messenger);
 }
 
 void GTPApplication::delete_downlink_tunnel_flow_ipv6(
@@ -563,10 +800,11 @@ void GTPApplication::delete_downlink_tunnel_flow_ipv6(
   // match all ports and groups
   downlink_fm.out_port(of13::OFPP_ANY);
   downlink_fm.out_group(of13::OFPG_ANY);
+  set_tunnel_cookie(downlink_fm, ev, ev.get_in_tei());
 
   add_downlink_match_ipv6(
       downlink_fm, ev.get_ue_info().get_ipv6(), ingress_port);
-  messenger.send_of_msg(downlink_fm, ev.get_connection());
+  send_tunnel_flow_delete(downlink_fm, ev, messenger);
 }
 
 void GTPApplication::delete_downlink_tunnel_flow(
@@ -594,10 +832,11 @@ void GTPApplication::delete_downlink_arp_flow(
   // match all ports and groups
   downlink_fm.out_port(of13::OFPP_ANY);
   downlink_fm.out_group(of13::OFPG_ANY);
+  set_tunnel_cookie(downlink_fm, ev, ev.get_in_tei());
 
   add_downlink_arp_match(downlink_fm, ev.get_ue_ip(), ingress_port);
 
-  messenger.send_of_msg(downlink_fm, ev.get_connection());
+  send_tunnel_flow_delete(downlink_fm, ev, messenger);
 }
 
 void GTPApplication::discard_uplink_tunnel_flow(
@@ -609,6 +848,7 @@ void GTPApplication::discard_uplink_tunnel_flow(
   uplink_fm.out_group(of13::OFPG_ANY);
   uplink_fm.cookie(cookie);
   uplink_fm.cookie_mask(cookie);
+  set_tunnel_cookie(uplink_fm, ev, ev.get_in_tei());
 
   add_tunnel_match(uplink_fm, gtp0_port_num_, ev.get_in_tei());
 
@@ -625,6 +865,7 @@ void GTPApplication::discard_downlink_tunnel_flow(
   downlink_fm.out_group(of13::OFPG_ANY);
   downlink_fm.cookie(cookie + 1);
   downlink_fm.cookie_mask(cookie + 1);
+  set_tunnel_cookie(downlink_fm, ev, ev.get_in_tei());
 
   if (ev.is_dl_flow_valid()) {
     add_ded_brr_dl_match(downlink_fm, ev.get_dl_flow(), ingress_port);
@@ -19,6 +19,9 @@
 
 #include <gmp.h>  // gross but necessary to link spgw_config.h
 
+#include <unordered_map>
+#include <unordered_set>
+
 #include "OpenflowController.h"
 #include "gtpv1u.h"
 
@@ -26,14 +29,21 @@ namespace openflow {
 
 /**
  * GTPApplication handles external callbacks to add/delete tunnel flows for a
- * UE when it connects
+ * UE when it connects.
+ * The flows of an S1 tunnel carry its in TEID in the upper half of their
+ * cookie. When the state is persisted, the flows are kept on restart and
+ * reconciled with the tunnels SPGW restored: the tunnel flows of table 0 are
+ * dumped on the first switch up, the restored tunnels SPGW replays are only
+ * added if the switch does not have them, and the tunnels SPGW did not replay
+ * are deleted by cookie once it is done.
  */
 class GTPApplication : public Application {
  public:
   GTPApplication(
       const std::string& uplink_mac, uint32_t gtp_port_num,
       uint32_t mtr_port_num, uint32_t internal_sampling_port_num,
-      uint32_t internal_sampling_fwd_tbl_num, uint32_t uplink_port_num);
+      uint32_t internal_sampling_fwd_tbl_num, uint32_t uplink_port_num,
+      bool persist_state);
 
  private:
   /**
@@ -137,6 +147,61 @@ class GTPApplication : public Application {
       const DeleteGTPTunnelEvent& ev, const OpenflowMessenger& messenger,
       uint32_t port_number);
 
+  /**
+   * Request the flows of table 0 from the switch to reconcile them with the
+   * restored tunnels
+   */
+  void request_tunnel_flows(
+      fluid_base::OFConnection* ofconn, const OpenflowMessenger& messenger);
+
+  /**
+   * Record the tunnels found in a part of the flow stats reply, and remove
+   * the stale ones after the last part if SPGW is done replaying
+   */
+  void handle_flow_stats_reply(
+      const FlowStatsReplyEvent& ev, const OpenflowMessenger& messenger);
+
+  /**
+   * Called when SPGW is done replaying the restored tunnels, removes the
+   * stale ones if the flows were dumped
+   */
+  void handle_tunnels_replayed(
+      const ControllerEvent& ev, const OpenflowMessenger& messenger);
+
+  /**
+   * Record a tunnel replayed by SPGW while reconciling.
+   * @return true if the switch already has every flow of the tunnel, which
+   * are kept as is
+   */
+  bool is_replayed_tunnel_installed(const AddGTPTunnelEvent& ev);
+
+  /**
+   * Delete the flows of the tunnels found on the switch that SPGW did not
+   * replay, one flow mod per tunnel matching on its cookie, and end the
+   * reconciliation
+   */
+  void remove_stale_tunnel_flows(
+      fluid_base::OFConnection* ofconn, const OpenflowMessenger& messenger);
+
+  /**
+   * @return the TunnelFlow kind of a table 0 flow found on the switch, 0 if
+   * not a flow of an S1 tunnel
+   */
+  uint32_t tunnel_flow_kind(of13::FlowStats& stats);
+
+  /**
+   * @return the TunnelFlow kinds of the flows added for a tunnel
+   */
+  uint32_t expected_tunnel_flows(const AddGTPTunnelEvent& ev);
+
+  /**
+   * Send the delete of flows of an S1 tunnel and, while the switch may have
+   * some, of the same flows with the legacy cookie
+   */
+  void send_tunnel_flow_delete(
+      of13::FlowMod& fm, const ControllerEvent& ev,
+      const OpenflowMessenger& messenger);
+
   /**
    * Add uplink port match to UL flows
    * @param uplink_fm OF flow mod msg
@@ -146,6 +211,15 @@ class GTPApplication : public Application {
   void add_tunnel_match(
       of13::FlowMod& uplink_fm, uint32_t gtp_port, uint32_t i_tei);
 
+  /**
+   * Set the cookie of the flows of S1 tunnels, to add or delete them
+   * @param fm OF flow mod msg
+   * @param ev event the flow mod is made for
+   * @param in_tei tunnel id.
+   */
+  void set_tunnel_cookie(
+      of13::FlowMod& fm, const ControllerEvent& ev, uint32_t in_tei);
+
  private:
   static const uint32_t DEFAULT_PRIORITY = 10;
   static const std::string GTP_PORT_MAC;
@@ -154,6 +228,21 @@ class GTPApplication : public Application {
   static const uint32_t TUNNEL_PORT_REG = 8;
   static const uint32_t TUNNEL_ID_REG   = 9;
 
+  // The in TEID of an S1 tunnel is in the upper half of its flow cookies,
+  // the lower bits mark the flows discarding data of a suspended UE
+  static const uint32_t TUNNEL_COOKIE_SHIFT = 32;
+  static const uint64_t TUNNEL_COOKIE_MASK  = 0xffffffff00000000;
+
+  // Flows of an S1 tunnel, the downlink ones from the uplink port, shifted
+  // by TUNNEL_FLOW_MTR_SHIFT from the monitoring port
+  enum TunnelFlow {
+    TUNNEL_FLOW_UPLINK  = 1 << 0,
+    TUNNEL_FLOW_DL_IPV4 = 1 << 1,
+    TUNNEL_FLOW_DL_IPV6 = 1 << 2,
+    TUNNEL_FLOW_DL_ARP  = 1 << 3,
+  };
+  static const uint32_t TUNNEL_FLOW_MTR_SHIFT = 3;
+
   const std::string uplink_mac_;
   const uint32_t gtp0_port_num_;
   // Internal port number for monitoring service
@@ -168,6 +257,25 @@ class GTPApplication : public Application {
 
   const uint32_t uplink_port_num_;
 
+  // Tunnel flows are reconciled once, on the first switch up with the
+  // persisted state
+  bool reconcile_pending_;
+  bool tunnel_flows_dumped_;
+  bool tunnels_replayed_;
+  // Tunnel flows added before the in TEID was in the cookie may be on the
+  // switch, with the legacy cookie: 0 in the upper half. Unknown until the
+  // flows are dumped.
+  bool legacy_tunnel_flows_;
+  // In TEIDs of the S1 tunnels found on the switch, with the TunnelFlow
+  // kinds of their flows
+  std::unordered_map<uint32_t, uint32_t> switch_tunnel_flows_;
+  // Tunnel flows with the legacy cookie found on the switch
+  uint32_t num_legacy_flows_;
+  // Replayed tunnels found with all their flows on the switch
+  uint32_t num_kept_tunnels_;
+  // In TEIDs of the tunnels SPGW replayed from its restored state
+  std::unordered_set<uint32_t> replayed_teids_;
+
   void add_downlink_arp_flow_action(
       const AddGTPTunnelEvent& ev, const OpenflowMessenger& messenger,
       of13::FlowMod downlink_fm);
@@ -39,9 +39,10 @@ class Application {
 };
 
 enum OF_MESSAGE_TYPES {
-  OFPT_ERROR               = 1,
-  OFPT_FEATURES_REPLY_TYPE = 6,
-  OFPT_PACKET_IN_TYPE      = 10
+  OFPT_ERROR                = 1,
+  OFPT_FEATURES_REPLY_TYPE  = 6,
+  OFPT_PACKET_IN_TYPE       = 10,
+  OFPT_MULTIPART_REPLY_TYPE = 19
 };
 
 class OpenflowController : public fluid_base::OFServer {
@@ -23,6 +23,7 @@
 
 extern "C" {
 #include "log.h"
+#include "service303.h"
 #include "sgw_paging.h"
 }
 
@@ -64,9 +65,15 @@ void PagingApplication::handle_paging_message(
   struct ip* ip_header = (struct ip*) (data + ETH_HEADER_LENGTH);
   struct in_addr dest_ip;
   memcpy(&dest_ip, &ip_header->ip_dst, sizeof(struct in_addr));
-  char* dest_ip_str = inet_ntoa(dest_ip);
+  if (is_paging_in_progress(dest_ip.s_addr)) {
+    OAILOG_DEBUG(
+        LOG_GTPV1U, "Paging already initiated for IP %x\n", dest_ip.s_addr);
+    increment_counter("paging_trigger", 1, 1, "result", "deduped");
+    return;
+  }
   OAILOG_DEBUG(
-      LOG_GTPV1U, "Initiating paging procedure for IP %s\n", dest_ip_str);
+      LOG_GTPV1U, "Initiating paging procedure for IP %x\n", dest_ip.s_addr);
+  increment_counter("paging_trigger", 1, 1, "result", "triggered");
   sgw_send_paging_request(&dest_ip);
 
   /*
@@ -90,6 +97,24 @@ void PagingApplication::handle_paging_message(
   return;
 }
 
+bool PagingApplication::is_paging_in_progress(uint32_t ue_ip) {
+  auto now = std::chrono::steady_clock::now();
+  std::lock_guard<std::mutex> lock(paging_mutex_);
+
+  auto it = paged_ips_.find(ue_ip);
+  if (it != paged_ips_.end() &&
+      now - it->second < std::chrono::seconds(CLAMPING_TIMEOUT)) {
+    return true;
+  }
+  paged_ips_[ue_ip] = now;
+  return false;
+}
+
+void PagingApplication::clear_paging(uint32_t ue_ip) {
+  std::lock_guard<std::mutex> lock(paging_mutex_);
+  paged_ips_.erase(ue_ip);
+}
+
 void PagingApplication::add_paging_flow(
     const AddPagingRuleEvent& ev, const OpenflowMessenger& messenger) {
   of13::FlowMod fm =
@@ -110,6 +135,8 @@ void PagingApplication::add_paging_flow(
   fm.add_instruction(inst);
 
   messenger.send_of_msg(fm, ev.get_connection());
+  // The UE went idle again, the next downlink packet pages it
+  clear_paging(ue_ip.s_addr);
   // Convert to string for logging
   char ip_str[INET_ADDRSTRLEN];
   inet_ntop(AF_INET, &(ue_ip.s_addr), ip_str, INET_ADDRSTRLEN);
@@ -143,6 +170,8 @@ void PagingApplication::delete_paging_flow(
   fm.add_instruction(inst);
 
   messenger.send_of_msg(fm, ev.get_connection());
+  // The clamping flow is deleted as well
+  clear_paging(ue_ip.s_addr);
   // Convert to string for logging
   char* ip_str = inet_ntoa(ue_ip);
   OAILOG_INFO(LOG_GTPV1U, "Deleted paging flow rule for UE IP %s\n", ip_str);
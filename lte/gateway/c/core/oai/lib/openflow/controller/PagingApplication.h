@@ -17,6 +17,10 @@
 
 #pragma once
 
+#include <chrono>
+#include <mutex>
+#include <unordered_map>
+
 #include "OpenflowController.h"
 
 namespace openflow {
@@ -49,6 +53,21 @@ class PagingApplication : public Application {
       fluid_base::OFConnection* ofconn, uint8_t* data,
       const OpenflowMessenger& messenger);
 
+  /**
+   * Tells whether paging was already triggered for the UE IP in the last
+   * CLAMPING_TIMEOUT, for the packet-ins received before the clamping flow
+   * was installed. Otherwise the IP is recorded as paged.
+   *
+   * @param ue_ip (in) - the UE IP, in network byte order
+   */
+  bool is_paging_in_progress(uint32_t ue_ip);
+
+  /**
+   * Forgets the paging of the UE IP, whose paging flows are (re)installed
+   * or removed
+   */
+  void clear_paging(uint32_t ue_ip);
+
   /**
    * Creates exact paging flow, which sends a packet intended for an
    * idle UE to this application
@@ -61,6 +80,11 @@ class PagingApplication : public Application {
    */
   void delete_paging_flow(
       const DeletePagingRuleEvent& ev, const OpenflowMessenger& messenger);
+
+  std::mutex paging_mutex_;
+  // UE IP, in network byte order -> time paging was triggered
+  std::unordered_map<uint32_t, std::chrono::steady_clock::time_point>
+      paged_ips_;
 };
 
 }  // namespace openflow
@@ -17,8 +17,6 @@
 
 #include <grpcpp/channel.h>
 #include <grpcpp/impl/codegen/async_unary_call.h>
-#include <thread>
-#include <iostream>
 #include <string>
 #include <utility>
 
@@ -47,16 +45,13 @@ PCEFClient& PCEFClient::get_instance() {
   return client_instance;
 }
 
-PCEFClient::PCEFClient() {
+PCEFClient::PCEFClient() : GRPCReceiver(GRPCRuntime::get_instance()) {
   // Create channel
   std::shared_ptr<Channel> channel;
   channel = ServiceRegistrySingleton::Instance()->GetGrpcChannel(
       "sessiond", ServiceRegistrySingleton::LOCAL);
   // Create stub for LocalSessionManager gRPC service
   stub_ = LocalSessionManager::NewStub(channel);
-  std::thread resp_loop_thread([&]() { rpc_response_loop(); });
-  std::cout << "PCEF Client thread id " << resp_loop_thread.native_handle();
-  resp_loop_thread.detach();
 }
 
 void PCEFClient::create_session(
@@ -66,7 +61,8 @@ void PCEFClient::create_session(
   // Create a raw response pointer that stores a callback to be called when the
   // gRPC call is answered
   auto local_response = new AsyncLocalResponse<LocalCreateSessionResponse>(
-      std::move(callback), RESPONSE_TIMEOUT);
+      std::move(callback), RESPONSE_TIMEOUT,
+      "LocalSessionManager/CreateSession");
   // Create a response reader for the `CreateSession` RPC call. This reader
   // stores the client context, the request to pass in, and the queue to add
   // the response to when done
@@ -83,7 +79,7 @@ void PCEFClient::end_session(
     std::function<void(Status, LocalEndSessionResponse)> callback) {
   PCEFClient& client  = get_instance();
   auto local_response = new AsyncLocalResponse<LocalEndSessionResponse>(
-      std::move(callback), RESPONSE_TIMEOUT);
+      std::move(callback), RESPONSE_TIMEOUT, "LocalSessionManager/EndSession");
   auto response_reader = client.stub_->AsyncEndSession(
       local_response->get_context(), request, &client.queue_);
   local_response->set_response_reader(std::move(response_reader));
@@ -94,7 +90,8 @@ void PCEFClient::bind_policy2bearer(
     std::function<void(Status, PolicyBearerBindingResponse)> callback) {
   PCEFClient& client  = get_instance();
   auto local_response = new AsyncLocalResponse<PolicyBearerBindingResponse>(
-      std::move(callback), RESPONSE_TIMEOUT);
+      std::move(callback), RESPONSE_TIMEOUT,
+      "LocalSessionManager/BindPolicy2Bearer");
   auto response_reader = client.stub_->AsyncBindPolicy2Bearer(
       local_response->get_context(), request, &client.queue_);
   local_response->set_response_reader(std::move(response_reader));
@@ -105,7 +102,8 @@ void PCEFClient::update_teids(
     std::function<void(Status, UpdateTunnelIdsResponse)> callback) {
   PCEFClient& client  = get_instance();
   auto local_response = new AsyncLocalResponse<UpdateTunnelIdsResponse>(
-      std::move(callback), RESPONSE_TIMEOUT);
+      std::move(callback), RESPONSE_TIMEOUT,
+      "LocalSessionManager/UpdateTunnelIds");
   auto response_reader = client.stub_->AsyncUpdateTunnelIds(
       local_response->get_context(), request, &client.queue_);
   local_response->set_response_reader(std::move(response_reader));
@@ -45,8 +45,8 @@ using namespace lte;
 /**
  * PCEFClient is the main asynchronous client for interacting with sessiond.
  * Responses will come in a queue and call the callback passed
- * To start the client and make sure it receives calls, one must call the
- * rpc_response_loop method defined in the GRPCReceiver base class
+ * The queue is one of the shared GRPCRuntime, the client runs no response
+ * loop of its own
  */
 class PCEFClient : public GRPCReceiver {
  public:
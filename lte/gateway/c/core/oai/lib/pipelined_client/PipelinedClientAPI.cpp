@@ -169,6 +169,11 @@ int upf_classifier_delete_paging_rule(struct in_addr ue) {
   return RETURNok;
 }
 
+void upf_classifier_set_batching(
+    uint32_t max_batch_size, uint32_t max_delay_usec) {
+  PipelinedServiceClient::set_batching(max_batch_size, max_delay_usec);
+}
+
 void handle_upf_classifier_rpc_call_done(
     const grpc::Status& status, UESessionContextResponse response) {
   if (!status.ok()) {
@@ -52,6 +52,9 @@ int upf_classifier_add_paging_rule(struct in_addr ue);
 
 int upf_classifier_delete_paging_rule(struct in_addr ue);
 
+void upf_classifier_set_batching(
+    uint32_t max_batch_size, uint32_t max_delay_usec);
+
 #ifdef __cplusplus
 }
 #endif
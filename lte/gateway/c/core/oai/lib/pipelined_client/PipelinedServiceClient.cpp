@@ -22,7 +22,6 @@
 #include <iostream>
 #include <memory>
 #include <string>
-#include <thread>
 
 #include <grpcpp/impl/codegen/async_unary_call.h>
 
@@ -55,12 +54,58 @@ PipelinedServiceClient& PipelinedServiceClient::get_instance() {
   return client_instance;
 }
 
-PipelinedServiceClient::PipelinedServiceClient() {
+PipelinedServiceClient::PipelinedServiceClient()
+    : GRPCReceiver(GRPCRuntime::get_instance()),
+      batcher_(
+          [this](
+              const UESessionSet& request,
+              std::function<void(Status, UESessionContextResponse)> callback) {
+            send_update(request, std::move(callback));
+          },
+          [this](
+              const UESessionSetBatch& batch,
+              std::function<void(Status, UESessionContextResponseBatch)>
+                  callback) { send_batch(batch, std::move(callback)); }) {
   auto channel = ServiceRegistrySingleton::Instance()->GetGrpcChannel(
       "pipelined", ServiceRegistrySingleton::LOCAL);
   stub_ = Pipelined::NewStub(channel);
-  std::thread resp_loop_thread([&]() { rpc_response_loop(); });
-  resp_loop_thread.detach();
+}
+
+PipelinedServiceClient::~PipelinedServiceClient() {}
+
+void PipelinedServiceClient::set_batching(
+    uint32_t max_batch_size, uint32_t max_delay_usec) {
+  get_instance().batcher_.set_batching(max_batch_size, max_delay_usec);
+}
+
+int PipelinedServiceClient::update_ue_state(
+    UESessionSet request,
+    std::function<void(Status, UESessionContextResponse)> callback) {
+  get_instance().batcher_.update_ue_state(
+      std::move(request), std::move(callback));
+  return RETURNok;
+}
+
+void PipelinedServiceClient::send_update(
+    const UESessionSet& request,
+    std::function<void(Status, UESessionContextResponse)> callback) {
+  auto local_response = new AsyncLocalResponse<UESessionContextResponse>(
+      std::move(callback), RESPONSE_TIMEOUT, "Pipelined/UpdateUEState");
+
+  auto response_reader = stub_->AsyncUpdateUEState(
+      local_response->get_context(), request, &queue_);
+  local_response->set_response_reader(std::move(response_reader));
+}
+
+void PipelinedServiceClient::send_batch(
+    const UESessionSetBatch& batch,
+    std::function<void(Status, UESessionContextResponseBatch)> callback) {
+  auto local_response = new AsyncLocalResponse<UESessionContextResponseBatch>(
+      std::move(callback), RESPONSE_TIMEOUT, "Pipelined/UpdateUEStateBatch");
+
+  auto response_reader = stub_->AsyncUpdateUEStateBatch(
+      local_response->get_context(), batch, &queue_);
+  local_response->set_response_reader(std::move(response_reader));
 }
 
 //------------------- TUNNEL ADD -------------------
@@ -76,18 +121,7 @@ int PipelinedServiceClient::UpdateUEIPv4SessionSet(
       ue_ipv4_addr, vlan, enb_ipv4_addr, in_teid, out_teid, imsi,
       flow_precedence, apn, ue_state);
 
-  UESessionContextResponse response;
-
-  PipelinedServiceClient& client = get_instance();
-
-  auto local_response = new AsyncLocalResponse<UESessionContextResponse>(
-      std::move(callback), RESPONSE_TIMEOUT);
-
-  auto response_reader = client.stub_->AsyncUpdateUEState(
-      local_response->get_context(), request, &client.queue_);
-  local_response->set_response_reader(std::move(response_reader));
-
-  return RETURNok;
+  return update_ue_state(std::move(request), std::move(callback));
 }
 
 //                    ADD : v4 with flow_dl
@@ -102,18 +136,7 @@ int PipelinedServiceClient::UpdateUEIPv4SessionSetWithFlowdl(
       ue_ipv4_addr, vlan, enb_ipv4_addr, in_teid, out_teid, imsi, flow_dl,
       flow_precedence, apn, ue_state);
 
-  UESessionContextResponse response;
-
-  PipelinedServiceClient& client = get_instance();
-
-  auto local_response = new AsyncLocalResponse<UESessionContextResponse>(
-      std::move(callback), RESPONSE_TIMEOUT);
-
-  auto response_reader = client.stub_->AsyncUpdateUEState(
-      local_response->get_context(), request, &client.queue_);
-  local_response->set_response_reader(std::move(response_reader));
-
-  return RETURNok;
+  return update_ue_state(std::move(request), std::move(callback));
 }
 
 //                    ADD : v4v6
@@ -128,17 +151,7 @@ int PipelinedServiceClient::UpdateUEIPv4v6SessionSet(
       ue_ipv4_addr, ue_ipv6_addr, vlan, enb_ipv4_addr, in_teid, out_teid, imsi,
       flow_precedence, apn, ue_state);
 
-  UESessionContextResponse response;
-
-  PipelinedServiceClient& client = get_instance();
-
-  auto local_response = new AsyncLocalResponse<UESessionContextResponse>(
-      std::move(callback), RESPONSE_TIMEOUT);
-
-  auto response_reader = client.stub_->AsyncUpdateUEState(
-      local_response->get_context(), request, &client.queue_);
-  local_response->set_response_reader(std::move(response_reader));
-  return RETURNok;
+  return update_ue_state(std::move(request), std::move(callback));
 }
 
 //                    ADD : v4v6 with flow dl
@@ -153,19 +166,7 @@ int PipelinedServiceClient::UpdateUEIPv4v6SessionSetWithFlowdl(
       ue_ipv4_addr, ue_ipv6_addr, vlan, enb_ipv4_addr, in_teid, out_teid, imsi,
       flow_dl, flow_precedence, apn, ue_state);
 
-  UESessionContextResponse response;
-
-  PipelinedServiceClient& client = get_instance();
-
-  auto local_response = new AsyncLocalResponse<UESessionContextResponse>(
-      std::move(callback), RESPONSE_TIMEOUT);
-
-  auto response_reader = client.stub_->AsyncUpdateUEState(
-      local_response->get_context(), request, &client.queue_);
-
-  local_response->set_response_reader(std::move(response_reader));
-
-  return RETURNok;
+  return update_ue_state(std::move(request), std::move(callback));
 }  // namespace lte
 
 //------------------- TUNNEL DEL -------------------
@@ -179,19 +180,7 @@ int PipelinedServiceClient::UpdateUEIPv4SessionSet(
   UESessionSet request = create_del_update_request_ipv4(
       enb_ipv4_addr, ue_ipv4_addr, in_teid, out_teid, ue_state);
 
-  UESessionContextResponse response;
-
-  PipelinedServiceClient& client = get_instance();
-
-  auto local_response = new AsyncLocalResponse<UESessionContextResponse>(
-      std::move(callback), RESPONSE_TIMEOUT);
-
-  auto response_reader = client.stub_->AsyncUpdateUEState(
-      local_response->get_context(), request, &client.queue_);
-
-  local_response->set_response_reader(std::move(response_reader));
-
-  return RETURNok;
+  return update_ue_state(std::move(request), std::move(callback));
 }  // namespace magma
 
 //                    DEL : v4 with flow_dl
@@ -204,18 +193,7 @@ int PipelinedServiceClient::UpdateUEIPv4SessionSetWithFlowdl(
   UESessionSet request = create_del_update_request_ipv4_flow_dl(
       enb_ipv4_addr, ue_ipv4_addr, in_teid, out_teid, flow_dl, ue_state);
 
-  UESessionContextResponse response;
-
-  PipelinedServiceClient& client = get_instance();
-
-  auto local_response = new AsyncLocalResponse<UESessionContextResponse>(
-      std::move(callback), RESPONSE_TIMEOUT);
-
-  auto response_reader = client.stub_->AsyncUpdateUEState(
-      local_response->get_context(), request, &client.queue_);
-  local_response->set_response_reader(std::move(response_reader));
-
-  return RETURNok;
+  return update_ue_state(std::move(request), std::move(callback));
 }
 
 //                    DEL : v4v6
@@ -228,18 +206,7 @@ int PipelinedServiceClient::UpdateUEIPv4v6SessionSet(
   UESessionSet request = create_del_update_request_ipv4v6(
       enb_ipv4_addr, ue_ipv4_addr, ue_ipv6_addr, in_teid, out_teid, ue_state);
 
-  UESessionContextResponse response;
-
-  PipelinedServiceClient& client = get_instance();
-
-  auto local_response = new AsyncLocalResponse<UESessionContextResponse>(
-      std::move(callback), RESPONSE_TIMEOUT);
-
-  auto response_reader = client.stub_->AsyncUpdateUEState(
-      local_response->get_context(), request, &client.queue_);
-  local_response->set_response_reader(std::move(response_reader));
-
-  return RETURNok;
+  return update_ue_state(std::move(request), std::move(callback));
 }
 
 //                    DEL : v4v6 with flow_dl
@@ -253,18 +220,7 @@ int PipelinedServiceClient::UpdateUEIPv4v6SessionSetWithFlowdl(
       enb_ipv4_addr, ue_ipv4_addr, ue_ipv6_addr, in_teid, out_teid, flow_dl,
       ue_state);
 
-  UESessionContextResponse response;
-
-  PipelinedServiceClient& client = get_instance();
-
-  auto local_response = new AsyncLocalResponse<UESessionContextResponse>(
-      std::move(callback), RESPONSE_TIMEOUT);
-
-  auto response_reader = client.stub_->AsyncUpdateUEState(
-      local_response->get_context(), request, &client.queue_);
-  local_response->set_response_reader(std::move(response_reader));
-
-  return RETURNok;
+  return update_ue_state(std::move(request), std::move(callback));
 }
 
 //------------------- DISCARDING DATA on TUNNEL -------------------
@@ -276,18 +232,7 @@ int PipelinedServiceClient::UpdateUEIPv4SessionSet(
   UESessionSet request =
       create_discard_data_update_request_ipv4(ue_ipv4_addr, in_teid, ue_state);
 
-  UESessionContextResponse response;
-
-  PipelinedServiceClient& client = get_instance();
-
-  auto local_response = new AsyncLocalResponse<UESessionContextResponse>(
-      std::move(callback), RESPONSE_TIMEOUT);
-
-  auto response_reader = client.stub_->AsyncUpdateUEState(
-      local_response->get_context(), request, &client.queue_);
-  local_response->set_response_reader(std::move(response_reader));
-
-  return RETURNok;
+  return update_ue_state(std::move(request), std::move(callback));
 }
 
 //                    DISCARD : v4 with flow_dl
@@ -299,19 +244,7 @@ int PipelinedServiceClient::UpdateUEIPv4SessionSetWithFlowdl(
   UESessionSet request = create_discard_data_update_request_ipv4_flow_dl(
       ue_ipv4_addr, in_teid, flow_dl, ue_state);
 
-  UESessionContextResponse response;
-
-  PipelinedServiceClient& client = get_instance();
-
-  auto local_response = new AsyncLocalResponse<UESessionContextResponse>(
-      std::move(callback), RESPONSE_TIMEOUT);
-
-  auto response_reader = client.stub_->AsyncUpdateUEState(
-      local_response->get_context(), request, &client.queue_);
-
-  local_response->set_response_reader(std::move(response_reader));
-
-  return RETURNok;
+  return update_ue_state(std::move(request), std::move(callback));
 }
 
 //                    DISCARD : v4v6
@@ -323,18 +256,7 @@ int PipelinedServiceClient::UpdateUEIPv4v6SessionSet(
   UESessionSet request = create_discard_data_update_request_ipv4v6(
       ue_ipv4_addr, ue_ipv6_addr, in_teid, ue_state);
 
-  UESessionContextResponse response;
-
-  PipelinedServiceClient& client = get_instance();
-
-  auto local_response = new AsyncLocalResponse<UESessionContextResponse>(
-      std::move(callback), RESPONSE_TIMEOUT);
-
-  auto response_reader = client.stub_->AsyncUpdateUEState(
-      local_response->get_context(), request, &client.queue_);
-  local_response->set_response_reader(std::move(response_reader));
-
-  return RETURNok;
+  return update_ue_state(std::move(request), std::move(callback));
 }
 
 //                    DISCARD : v4v6 with flow_dl
@@ -346,19 +268,7 @@ int PipelinedServiceClient::UpdateUEIPv4v6SessionSetWithFlowdl(
   UESessionSet request = create_discard_data_update_request_ipv4v6_flow_dl(
       ue_ipv4_addr, ue_ipv6_addr, in_teid, flow_dl, ue_state);
 
-  UESessionContextResponse response;
-
-  PipelinedServiceClient& client = get_instance();
-
-  auto local_response = new AsyncLocalResponse<UESessionContextResponse>(
-      std::move(callback), RESPONSE_TIMEOUT);
-
-  auto response_reader = client.stub_->AsyncUpdateUEState(
-      local_response->get_context(), request, &client.queue_);
-
-  local_response->set_response_reader(std::move(response_reader));
-
-  return RETURNok;
+  return update_ue_state(std::move(request), std::move(callback));
 }
 
 //------------------- FORWARDING DATA on TUNNEL -------------------
@@ -371,18 +281,7 @@ int PipelinedServiceClient::UpdateUEIPv4SessionSet(
   UESessionSet request = create_forwarding_data_update_request_ipv4(
       ue_ipv4_addr, in_teid, flow_precedence, ue_state);
 
-  UESessionContextResponse response;
-
-  PipelinedServiceClient& client = get_instance();
-
-  auto local_response = new AsyncLocalResponse<UESessionContextResponse>(
-      std::move(callback), RESPONSE_TIMEOUT);
-
-  auto response_reader = client.stub_->AsyncUpdateUEState(
-      local_response->get_context(), request, &client.queue_);
-  local_response->set_response_reader(std::move(response_reader));
-
-  return RETURNok;
+  return update_ue_state(std::move(request), std::move(callback));
 }
 
 //                    FORWARD : v4 with flow_dl
@@ -395,18 +294,7 @@ int PipelinedServiceClient::UpdateUEIPv4SessionSetWithFlowdl(
   UESessionSet request = create_forwarding_data_update_request_ipv4_flow_dl(
       ue_ipv4_addr, in_teid, flow_dl, flow_precedence, ue_state);
 
-  UESessionContextResponse response;
-
-  PipelinedServiceClient& client = get_instance();
-
-  auto local_response = new AsyncLocalResponse<UESessionContextResponse>(
-      std::move(callback), RESPONSE_TIMEOUT);
-
-  auto response_reader = client.stub_->AsyncUpdateUEState(
-      local_response->get_context(), request, &client.queue_);
-  local_response->set_response_reader(std::move(response_reader));
-
-  return RETURNok;
+  return update_ue_state(std::move(request), std::move(callback));
 }
 
 //                    FORWARD : v4v6
@@ -418,18 +306,7 @@ int PipelinedServiceClient::UpdateUEIPv4v6SessionSet(
   UESessionSet request = create_forwarding_data_update_request_ipv4v6(
       ue_ipv4_addr, ue_ipv6_addr, in_teid, flow_precedence, ue_state);
 
-  UESessionContextResponse response;
-
-  PipelinedServiceClient& client = get_instance();
-
-  auto local_response = new AsyncLocalResponse<UESessionContextResponse>(
-      std::move(callback), RESPONSE_TIMEOUT);
-
-  auto response_reader = client.stub_->AsyncUpdateUEState(
-      local_response->get_context(), request, &client.queue_);
-  local_response->set_response_reader(std::move(response_reader));
-
-  return RETURNok;
+  return update_ue_state(std::move(request), std::move(callback));
 }
 
 //                    FORWARD : v4v6 with flow_dl
@@ -442,18 +319,7 @@ int PipelinedServiceClient::UpdateUEIPv4v6SessionSetWithFlowdl(
   UESessionSet request = create_forwarding_data_update_request_ipv4v6_flow_dl(
       ue_ipv4_addr, ue_ipv6_addr, in_teid, flow_dl, flow_precedence, ue_state);
 
-  UESessionContextResponse response;
-
-  PipelinedServiceClient& client = get_instance();
-
-  auto local_response = new AsyncLocalResponse<UESessionContextResponse>(
-      std::move(callback), RESPONSE_TIMEOUT);
-
-  auto response_reader = client.stub_->AsyncUpdateUEState(
-      local_response->get_context(), request, &client.queue_);
-  local_response->set_response_reader(std::move(response_reader));
-
-  return RETURNok;
+  return update_ue_state(std::move(request), std::move(callback));
 }
 
 //------------------- PAGING DATA on TUNNEL -------------------
@@ -463,18 +329,7 @@ int PipelinedServiceClient::UpdateUEIPv4SessionSet(
   UESessionSet request =
       create_paging_update_request_ipv4(ue_ipv4_addr, ue_state);
 
-  UESessionContextResponse response;
-
-  PipelinedServiceClient& client = get_instance();
-
-  auto local_response = new AsyncLocalResponse<UESessionContextResponse>(
-      std::move(callback), RESPONSE_TIMEOUT);
-
-  auto response_reader = client.stub_->AsyncUpdateUEState(
-      local_response->get_context(), request, &client.queue_);
-  local_response->set_response_reader(std::move(response_reader));
-
-  return RETURNok;
+  return update_ue_state(std::move(request), std::move(callback));
 }
 
 }  // namespace lte
@@ -21,6 +21,7 @@
 #include <string>
 
 #include "PipelinedClientAPI.h"
+#include "PipelinedUpdateBatcher.h"
 #include "includes/GRPCReceiver.h"
 #include "lte/protos/pipelined.grpc.pb.h"
 
@@ -157,11 +158,32 @@ class PipelinedServiceClient : public GRPCReceiver {
   static PipelinedServiceClient& get_instance();
   PipelinedServiceClient(PipelinedServiceClient const&) = delete;
   void operator=(PipelinedServiceClient const&) = delete;
+  ~PipelinedServiceClient();
+
+  /**
+   * Coalesce the tunnel updates into UpdateUEStateBatch RPCs, see
+   * PipelinedUpdateBatcher::set_batching
+   */
+  static void set_batching(uint32_t max_batch_size, uint32_t max_delay_usec);
 
  private:
   PipelinedServiceClient();
+
+  // Send the update, or queue it for the next batch
+  static int update_ue_state(
+      UESessionSet request,
+      std::function<void(Status, UESessionContextResponse)> callback);
+  void send_update(
+      const UESessionSet& request,
+      std::function<void(Status, UESessionContextResponse)> callback);
+  void send_batch(
+      const UESessionSetBatch& batch,
+      std::function<void(Status, UESessionContextResponseBatch)> callback);
+
   std::unique_ptr<Pipelined::Stub> stub_{};
   static const uint32_t RESPONSE_TIMEOUT = 3;  // seconds
+  // Declared after stub_, its flush thread sends through it
+  PipelinedUpdateBatcher batcher_;
 };
 
 }  // namespace lte
@@ -0,0 +1,170 @@
+/**
+ * Copyright 2021 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PipelinedUpdateBatcher.h"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+
+extern "C" {
+#include "log.h"
+}
+
+using grpc::Status;
+
+namespace magma {
+namespace lte {
+
+PipelinedUpdateBatcher::PipelinedUpdateBatcher(
+    SendUpdate send_update, SendBatch send_batch)
+    : send_update_(std::move(send_update)),
+      send_batch_(std::move(send_batch)),
+      max_batch_size_(1),
+      max_delay_(0),
+      batch_supported_(true),
+      stopping_(false) {}
+
+PipelinedUpdateBatcher::~PipelinedUpdateBatcher() {
+  {
+    std::lock_guard<std::mutex> lock(batch_mutex_);
+    stopping_ = true;
+  }
+  batch_cv_.notify_one();
+  if (flush_thread_.joinable()) {
+    flush_thread_.join();
+  }
+}
+
+void PipelinedUpdateBatcher::set_batching(
+    uint32_t max_batch_size, uint32_t max_delay_usec) {
+  std::lock_guard<std::mutex> lock(batch_mutex_);
+
+  send_pending_updates();
+  max_batch_size_ = max_batch_size;
+  max_delay_      = std::chrono::microseconds(max_delay_usec);
+  if (max_batch_size > 1 && !flush_thread_.joinable()) {
+    flush_thread_ = std::thread([this]() { flush_loop(); });
+  }
+  OAILOG_INFO(
+      LOG_UTIL, "Tunnel updates to pipelined batched by %u, up to %u us\n",
+      max_batch_size, max_delay_usec);
+}
+
+void PipelinedUpdateBatcher::update_ue_state(
+    UESessionSet request, UpdateCallback callback) {
+  std::unique_lock<std::mutex> lock(batch_mutex_);
+
+  if (max_batch_size_ <= 1 || !batch_supported_) {
+    lock.unlock();
+    send_update_(request, std::move(callback));
+    return;
+  }
+  auto now = std::chrono::steady_clock::now();
+  if (pending_.empty()) {
+    first_queued_ = now;
+  }
+  last_queued_ = now;
+  pending_.push_back({std::move(request), std::move(callback)});
+
+  if (pending_.size() >= max_batch_size_) {
+    send_pending_updates();
+  } else if (pending_.size() == 1) {
+    // Start the window of the batch
+    batch_cv_.notify_one();
+  }
+}
+
+void PipelinedUpdateBatcher::send_pending_updates() {
+  if (pending_.size() == 1 || !batch_supported_) {
+    for (auto& update : pending_) {
+      send_update_(update.request, std::move(update.callback));
+    }
+    pending_.clear();
+    return;
+  }
+  if (pending_.empty()) {
+    return;
+  }
+  auto batch = std::make_shared<UESessionSetBatch>();
+  std::vector<UpdateCallback> callbacks;
+  callbacks.reserve(pending_.size());
+  for (auto& update : pending_) {
+    batch->add_sessions()->Swap(&update.request);
+    callbacks.push_back(std::move(update.callback));
+  }
+  pending_.clear();
+
+  // Route the response of each update of the batch to its own callback
+  send_batch_(
+      *batch,
+      [this, batch, callbacks](
+          Status status, UESessionContextResponseBatch response) {
+        if (status.error_code() == grpc::StatusCode::UNIMPLEMENTED) {
+          resend_unbatched(*batch, callbacks);
+          return;
+        }
+        for (size_t i = 0; i < callbacks.size(); i++) {
+          if (!status.ok()) {
+            callbacks[i](status, UESessionContextResponse());
+          } else if ((int) i < response.responses_size()) {
+            callbacks[i](status, response.responses(i));
+          } else {
+            callbacks[i](
+                Status(grpc::StatusCode::INTERNAL, "No response in batch"),
+                UESessionContextResponse());
+          }
+        }
+      });
+}
+
+void PipelinedUpdateBatcher::resend_unbatched(
+    const UESessionSetBatch& batch,
+    const std::vector<UpdateCallback>& callbacks) {
+  std::lock_guard<std::mutex> lock(batch_mutex_);
+
+  if (batch_supported_) {
+    OAILOG_WARNING(
+        LOG_UTIL,
+        "pipelined does not support batched tunnel updates, sending them "
+        "one by one\n");
+    batch_supported_ = false;
+  }
+  for (int i = 0; i < batch.sessions_size(); i++) {
+    send_update_(batch.sessions(i), callbacks[i]);
+  }
+  // Updates queued meanwhile follow the ones of the batch
+  send_pending_updates();
+}
+
+void PipelinedUpdateBatcher::flush_loop() {
+  std::unique_lock<std::mutex> lock(batch_mutex_);
+
+  while (!stopping_) {
+    if (pending_.empty()) {
+      batch_cv_.wait(lock);
+      continue;
+    }
+    // Send once the window is over or the burst of updates ended
+    auto deadline =
+        std::min(first_queued_ + max_delay_, last_queued_ + max_delay_ / 4);
+    if (std::chrono::steady_clock::now() >= deadline) {
+      send_pending_updates();
+    } else {
+      batch_cv_.wait_until(lock, deadline);
+    }
+  }
+}
+
+}  // namespace lte
+}  // namespace magma
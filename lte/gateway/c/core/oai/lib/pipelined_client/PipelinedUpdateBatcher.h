@@ -0,0 +1,99 @@
+/**
+ * Copyright 2021 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <grpcpp/impl/codegen/status.h>
+#include <stdint.h>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "lte/protos/pipelined.pb.h"
+
+namespace magma {
+namespace lte {
+
+/*
+ * Coalesces the tunnel updates sent to pipelined into UpdateUEStateBatch
+ * RPCs. The RPCs themselves are issued by the senders given at construction,
+ * their callbacks are expected to run asynchronously, from another thread
+ * than the one sending.
+ */
+class PipelinedUpdateBatcher {
+ public:
+  using UpdateCallback =
+      std::function<void(grpc::Status, UESessionContextResponse)>;
+  using BatchCallback =
+      std::function<void(grpc::Status, UESessionContextResponseBatch)>;
+  // Issue UpdateUEState
+  using SendUpdate =
+      std::function<void(const UESessionSet&, UpdateCallback)>;
+  // Issue UpdateUEStateBatch
+  using SendBatch =
+      std::function<void(const UESessionSetBatch&, BatchCallback)>;
+
+  PipelinedUpdateBatcher(SendUpdate send_update, SendBatch send_batch);
+  ~PipelinedUpdateBatcher();
+  PipelinedUpdateBatcher(PipelinedUpdateBatcher const&) = delete;
+  void operator=(PipelinedUpdateBatcher const&) = delete;
+
+  /**
+   * Coalesce the tunnel updates into batches of up to max_batch_size
+   * updates. An update waits at most max_delay_usec for others to join its
+   * batch, and the batch is sent as soon as no update was queued for a
+   * quarter of that delay, so that isolated updates are not held back for
+   * the whole delay. Updates are sent one by one when max_batch_size is 1 or
+   * less, the default.
+   */
+  void set_batching(uint32_t max_batch_size, uint32_t max_delay_usec);
+
+  // Send the update, or queue it for the next batch
+  void update_ue_state(UESessionSet request, UpdateCallback callback);
+
+ private:
+  struct PendingUpdate {
+    UESessionSet request;
+    UpdateCallback callback;
+  };
+
+  // Send the queued updates, called with batch_mutex_ held
+  void send_pending_updates();
+  // Send the updates of a batch one by one, when pipelined does not
+  // support batches
+  void resend_unbatched(
+      const UESessionSetBatch& batch,
+      const std::vector<UpdateCallback>& callbacks);
+  void flush_loop();
+
+  SendUpdate send_update_;
+  SendBatch send_batch_;
+
+  std::mutex batch_mutex_;
+  std::condition_variable batch_cv_;
+  uint32_t max_batch_size_;
+  std::chrono::microseconds max_delay_;
+  // Updates are sent one by one when pipelined does not support batches
+  bool batch_supported_;
+  bool stopping_;
+  std::vector<PendingUpdate> pending_;
+  std::chrono::steady_clock::time_point first_queued_;
+  std::chrono::steady_clock::time_point last_queued_;
+  std::thread flush_thread_;
+};
+
+}  // namespace lte
+}  // namespace magma
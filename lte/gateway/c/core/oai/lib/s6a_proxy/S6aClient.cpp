@@ -15,7 +15,6 @@
  *      contact@openairinterface.org
  */
 #include <grpcpp/impl/codegen/async_unary_call.h>
-#include <thread>  // std::thread
 #include <iostream>
 #include <utility>
 
@@ -120,7 +119,8 @@ S6aClient& S6aClient::get_client_based_on_fed_mode(const char* imsi) {
   }
 }
 
-S6aClient::S6aClient(bool enable_s6a_proxy_channel) {
+S6aClient::S6aClient(bool enable_s6a_proxy_channel)
+    : GRPCReceiver(GRPCRuntime::get_instance()) {
   // Create channel based on relay_enabled, enable_s6a_proxy_channel and
   // cloud_subscriberdb_enabled flags.
   // If relay_enabled is true and enable_s6a_proxy_channel is true i.e federated
@@ -139,9 +139,6 @@ S6aClient::S6aClient(bool enable_s6a_proxy_channel) {
     // Create stub for subscriberdb gRPC service
     stub_ = S6aProxy::NewStub(channel);
   }
-
-  std::thread resp_loop_thread([&]() { rpc_response_loop(); });
-  resp_loop_thread.detach();
 }
 
 void S6aClient::purge_ue(
@@ -151,7 +148,7 @@ void S6aClient::purge_ue(
   // Create a raw response pointer that stores a callback to be called when the
   // gRPC call is answered
   auto resp = new AsyncLocalResponse<PurgeUEAnswer>(
-      std::move(callbk), RESPONSE_TIMEOUT);
+      std::move(callbk), RESPONSE_TIMEOUT, "S6aProxy/PurgeUE");
 
   // Create a response reader for the `PurgeUE` RPC call. This reader
   // stores the client context, the request to pass in, and the queue to add
@@ -177,7 +174,8 @@ void S6aClient::authentication_info_req(
   // Create a raw response pointer that stores a callback to be called when the
   // gRPC call is answered
   auto resp = new AsyncLocalResponse<AuthenticationInformationAnswer>(
-      std::move(callbk), RESPONSE_TIMEOUT);
+      std::move(callbk), RESPONSE_TIMEOUT,
+      "S6aProxy/AuthenticationInformation");
 
   // Create a response reader for the `authentication_info_req` RPC call.
   // This reader stores the client context, the request to pass in, and
@@ -201,7 +199,7 @@ void S6aClient::update_location_request(
   // Create a raw response pointer that stores a callback to be called when the
   // gRPC call is answered
   auto resp = new AsyncLocalResponse<UpdateLocationAnswer>(
-      std::move(callbk), RESPONSE_TIMEOUT);
+      std::move(callbk), RESPONSE_TIMEOUT, "S6aProxy/UpdateLocation");
 
   // Create a response reader for the `update_location_request` RPC call.
   // This reader stores the client context, the request to pass in, and
@@ -49,8 +49,8 @@ namespace magma {
 /**
  * S6aClient is the main asynchronous client for interacting with s6a_proxy.
  * Responses will come in a queue and call the callback passed
- * To start the client and make sure it receives calls, one must call the
- * rpc_response_loop method defined in the GRPCReceiver base class
+ * The queue is one of the shared GRPCRuntime, the client runs no response
+ * loop of its own
  */
 class S6aClient : public GRPCReceiver {
  public:
@@ -12,7 +12,6 @@ limitations under the License.
 */
 
 #include <grpcpp/impl/codegen/async_unary_call.h>
-#include <thread>  // std::thread
 #include <utility>
 
 #include "S8Client.h"
@@ -31,14 +30,12 @@ S8Client& S8Client::get_instance() {
   return client_instance;
 }
 
-S8Client::S8Client() {
+S8Client::S8Client() : GRPCReceiver(GRPCRuntime::get_instance()) {
   // Create channel
   auto channel = ServiceRegistrySingleton::Instance()->GetGrpcChannel(
       "s8_proxy", ServiceRegistrySingleton::CLOUD);
   // Create stub for s8_proxy gRPC service
   stub_ = S8Proxy::NewStub(channel);
-  std::thread resp_loop_thread([&]() { rpc_response_loop(); });
-  resp_loop_thread.detach();
 }
 
 void S8Client::s8_create_session_request(
@@ -48,7 +45,7 @@ void S8Client::s8_create_session_request(
   // Create a raw response pointer that stores a callback to be called when the
   // gRPC call is answered
   auto response = new AsyncLocalResponse<CreateSessionResponsePgw>(
-      std::move(callback), RESPONSE_TIMEOUT);
+      std::move(callback), RESPONSE_TIMEOUT, "S8Proxy/CreateSession");
   // Create a response reader for the `CreateSession` RPC call. This reader
   // stores the client context, the request to pass in, and the queue to add
   // the response to when done
@@ -67,7 +64,7 @@ void S8Client::s8_delete_session_request(
   // Create a raw response pointer that stores a callback to be called when the
   // gRPC call is answered
   auto response = new AsyncLocalResponse<DeleteSessionResponsePgw>(
-      std::move(callback), RESPONSE_TIMEOUT);
+      std::move(callback), RESPONSE_TIMEOUT, "S8Proxy/DeleteSession");
   // Create a response reader for the `DeleteSession` RPC call. This reader
   // stores the client context, the request to pass in, and the queue to add
   // the response to when done
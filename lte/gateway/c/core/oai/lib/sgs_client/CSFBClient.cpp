@@ -16,7 +16,6 @@
  */
 
 #include <grpcpp/impl/codegen/async_unary_call.h>
-#include <thread>  // std::thread
 #include <utility>
 
 #include "CSFBClient.h"
@@ -36,14 +35,12 @@ CSFBClient& CSFBClient::get_instance() {
   return client_instance;
 }
 
-CSFBClient::CSFBClient() {
+CSFBClient::CSFBClient() : GRPCReceiver(GRPCRuntime::get_instance()) {
   // Create channel
   auto channel = ServiceRegistrySingleton::Instance()->GetGrpcChannel(
       "csfb", ServiceRegistrySingleton::CLOUD);
   // Create stub for LocalSessionManager gRPC service
   stub_ = CSFBFedGWService::NewStub(channel);
-  std::thread resp_loop_thread([&]() { rpc_response_loop(); });
-  resp_loop_thread.detach();
 }
 
 void CSFBClient::location_update_request(
@@ -54,8 +51,9 @@ void CSFBClient::location_update_request(
       convert_itti_sgsap_location_update_req_to_proto_msg(msg);
   // Create a raw response pointer that stores a callback to be called when the
   // gRPC call is answered
-  auto local_response =
-      new AsyncLocalResponse<Void>(std::move(callback), RESPONSE_TIMEOUT);
+  auto local_response = new AsyncLocalResponse<Void>(
+      std::move(callback), RESPONSE_TIMEOUT,
+      "CSFBFedGWService/LocationUpdateReq");
   // Create a response reader for the `CreateSession` RPC call. This reader
   // stores the client context, the request to pass in, and the queue to add
   // the response to when done
@@ -72,8 +70,8 @@ void CSFBClient::alert_ack(
     std::function<void(grpc::Status, Void)> callback) {
   CSFBClient& client = get_instance();
   AlertAck proto_msg = convert_itti_sgsap_alert_ack_to_proto_msg(msg);
-  auto local_response =
-      new AsyncLocalResponse<Void>(std::move(callback), RESPONSE_TIMEOUT);
+  auto local_response = new AsyncLocalResponse<Void>(
+      std::move(callback), RESPONSE_TIMEOUT, "CSFBFedGWService/AlertAc");
   auto response_reader = client.stub_->AsyncAlertAc(
       local_response->get_context(), proto_msg, &client.queue_);
   local_response->set_response_reader(std::move(response_reader));
@@ -84,8 +82,8 @@ void CSFBClient::alert_reject(
     std::function<void(grpc::Status, Void)> callback) {
   CSFBClient& client    = get_instance();
   AlertReject proto_msg = convert_itti_sgsap_alert_reject_to_proto_msg(msg);
-  auto local_response =
-      new AsyncLocalResponse<Void>(std::move(callback), RESPONSE_TIMEOUT);
+  auto local_response = new AsyncLocalResponse<Void>(
+      std::move(callback), RESPONSE_TIMEOUT, "CSFBFedGWService/AlertRej");
   auto response_reader = client.stub_->AsyncAlertRej(
       local_response->get_context(), proto_msg, &client.queue_);
   local_response->set_response_reader(std::move(response_reader));
@@ -97,8 +95,9 @@ void CSFBClient::tmsi_reallocation_complete(
   CSFBClient& client = get_instance();
   TMSIReallocationComplete proto_msg =
       convert_itti_sgsap_tmsi_reallocation_comp_to_proto_msg(msg);
-  auto local_response =
-      new AsyncLocalResponse<Void>(std::move(callback), RESPONSE_TIMEOUT);
+  auto local_response = new AsyncLocalResponse<Void>(
+      std::move(callback), RESPONSE_TIMEOUT,
+      "CSFBFedGWService/TMSIReallocationComp");
   auto response_reader = client.stub_->AsyncTMSIReallocationComp(
       local_response->get_context(), proto_msg, &client.queue_);
   local_response->set_response_reader(std::move(response_reader));
@@ -110,8 +109,8 @@ void CSFBClient::eps_detach_indication(
   CSFBClient& client = get_instance();
   EPSDetachIndication proto_msg =
       convert_itti_sgsap_eps_detach_ind_to_proto_msg(msg);
-  auto local_response =
-      new AsyncLocalResponse<Void>(std::move(callback), RESPONSE_TIMEOUT);
+  auto local_response = new AsyncLocalResponse<Void>(
+      std::move(callback), RESPONSE_TIMEOUT, "CSFBFedGWService/EPSDetachInd");
   auto response_reader = client.stub_->AsyncEPSDetachInd(
       local_response->get_context(), proto_msg, &client.queue_);
   local_response->set_response_reader(std::move(response_reader));
@@ -123,8 +122,8 @@ void CSFBClient::imsi_detach_indication(
   CSFBClient& client = get_instance();
   IMSIDetachIndication proto_msg =
       convert_itti_sgsap_imsi_detach_ind_to_proto_msg(msg);
-  auto local_response =
-      new AsyncLocalResponse<Void>(std::move(callback), RESPONSE_TIMEOUT);
+  auto local_response = new AsyncLocalResponse<Void>(
+      std::move(callback), RESPONSE_TIMEOUT, "CSFBFedGWService/IMSIDetachInd");
   auto response_reader = client.stub_->AsyncIMSIDetachInd(
       local_response->get_context(), proto_msg, &client.queue_);
   local_response->set_response_reader(std::move(response_reader));
@@ -135,8 +134,8 @@ void CSFBClient::paging_reject(
     std::function<void(grpc::Status, Void)> callback) {
   CSFBClient& client     = get_instance();
   PagingReject proto_msg = convert_itti_sgsap_paging_reject_to_proto_msg(msg);
-  auto local_response =
-      new AsyncLocalResponse<Void>(std::move(callback), RESPONSE_TIMEOUT);
+  auto local_response = new AsyncLocalResponse<Void>(
+      std::move(callback), RESPONSE_TIMEOUT, "CSFBFedGWService/PagingRej");
   auto response_reader = client.stub_->AsyncPagingRej(
       local_response->get_context(), proto_msg, &client.queue_);
   local_response->set_response_reader(std::move(response_reader));
@@ -148,8 +147,8 @@ void CSFBClient::service_request(
   CSFBClient& client = get_instance();
   ServiceRequest proto_msg =
       convert_itti_sgsap_service_request_to_proto_msg(msg);
-  auto local_response =
-      new AsyncLocalResponse<Void>(std::move(callback), RESPONSE_TIMEOUT);
+  auto local_response = new AsyncLocalResponse<Void>(
+      std::move(callback), RESPONSE_TIMEOUT, "CSFBFedGWService/ServiceReq");
   auto response_reader = client.stub_->AsyncServiceReq(
       local_response->get_context(), proto_msg, &client.queue_);
   local_response->set_response_reader(std::move(response_reader));
@@ -161,8 +160,8 @@ void CSFBClient::ue_activity_indication(
   CSFBClient& client = get_instance();
   UEActivityIndication proto_msg =
       convert_itti_sgsap_ue_activity_indication_to_proto_msg(msg);
-  auto local_response =
-      new AsyncLocalResponse<Void>(std::move(callback), RESPONSE_TIMEOUT);
+  auto local_response = new AsyncLocalResponse<Void>(
+      std::move(callback), RESPONSE_TIMEOUT, "CSFBFedGWService/UEActivityInd");
   auto response_reader = client.stub_->AsyncUEActivityInd(
       local_response->get_context(), proto_msg, &client.queue_);
   local_response->set_response_reader(std::move(response_reader));
@@ -173,8 +172,8 @@ void CSFBClient::ue_unreachable(
     std::function<void(grpc::Status, Void)> callback) {
   CSFBClient& client      = get_instance();
   UEUnreachable proto_msg = convert_itti_sgsap_ue_unreachable_to_proto_msg(msg);
-  auto local_response =
-      new AsyncLocalResponse<Void>(std::move(callback), RESPONSE_TIMEOUT);
+  auto local_response = new AsyncLocalResponse<Void>(
+      std::move(callback), RESPONSE_TIMEOUT, "CSFBFedGWService/UEUnreach");
   auto response_reader = client.stub_->AsyncUEUnreach(
       local_response->get_context(), proto_msg, &client.queue_);
   local_response->set_response_reader(std::move(response_reader));
@@ -186,8 +185,8 @@ void CSFBClient::send_uplink_unitdata(
   CSFBClient& client = get_instance();
   UplinkUnitdata proto_msg =
       convert_itti_sgsap_uplink_unitdata_to_proto_msg(msg);
-  auto local_response =
-      new AsyncLocalResponse<Void>(std::move(callback), RESPONSE_TIMEOUT);
+  auto local_response = new AsyncLocalResponse<Void>(
+      std::move(callback), RESPONSE_TIMEOUT, "CSFBFedGWService/Uplink");
   auto response_reader = client.stub_->AsyncUplink(
       local_response->get_context(), proto_msg, &client.queue_);
   local_response->set_response_reader(std::move(response_reader));
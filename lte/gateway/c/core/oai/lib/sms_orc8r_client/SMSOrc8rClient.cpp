@@ -16,7 +16,6 @@
  */
 
 #include <grpcpp/impl/codegen/async_unary_call.h>
-#include <thread>  // std::thread
 #include <utility>
 
 #include "SMSOrc8rClient.h"
@@ -36,14 +35,12 @@ SMSOrc8rClient& SMSOrc8rClient::get_instance() {
   return client_instance;
 }
 
-SMSOrc8rClient::SMSOrc8rClient() {
+SMSOrc8rClient::SMSOrc8rClient() : GRPCReceiver(GRPCRuntime::get_instance()) {
   // Create channel
   auto channel = ServiceRegistrySingleton::Instance()->GetGrpcChannel(
       "smsd", ServiceRegistrySingleton::LOCAL);
   // Create stub for LocalSessionManager gRPC service
   stub_ = SMSOrc8rService::NewStub(channel);
-  std::thread resp_loop_thread([&]() { rpc_response_loop(); });
-  resp_loop_thread.detach();
 }
 
 void SMSOrc8rClient::send_uplink_unitdata(
@@ -52,8 +49,8 @@ void SMSOrc8rClient::send_uplink_unitdata(
   SMSOrc8rClient& client = get_instance();
   SMOUplinkUnitdata proto_msg =
       convert_itti_sgsap_uplink_unitdata_to_proto_msg(msg);
-  auto local_response =
-      new AsyncLocalResponse<Void>(std::move(callback), RESPONSE_TIMEOUT);
+  auto local_response = new AsyncLocalResponse<Void>(
+      std::move(callback), RESPONSE_TIMEOUT, "SMSOrc8rService/SMOUplink");
   auto response_reader = client.stub_->AsyncSMOUplink(
       local_response->get_context(), proto_msg, &client.queue_);
   local_response->set_response_reader(std::move(response_reader));
@@ -64,6 +64,7 @@
 #include "shared_ts_log.h"
 #include "grpc_service.h"
 #include "timer.h"
+#include "itti_trace.h"
 
 static void send_timer_recovery_message(void);
 
@@ -129,11 +130,17 @@ int main(int argc, char* argv[]) {
   }
   free_wrapper((void**) &pid_file_name);
 
+  if (mme_config.itti_tracing) {
+    itti_trace_enable(true);
+  }
+
   /*
    * Calling each layer init function
    */
   // Intialize loggers and configured log levels.
   OAILOG_LOG_CONFIGURE(&mme_config.log_config);
+  // Before the first gRPC client is created
+  service303_set_grpc_threads(mme_config.grpc_cq_threads);
   CHECK_INIT_RETURN(service303_init(&(mme_config.service303_config)));
 
   event_client_init();
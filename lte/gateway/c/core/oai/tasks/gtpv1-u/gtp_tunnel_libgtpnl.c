@@ -19,10 +19,14 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#include <pthread.h>
+#include <time.h>
 #include <sys/types.h>
 #include <arpa/inet.h>
 #include <net/if.h>
 
+#include <linux/genetlink.h>
+#include <linux/gtp.h>
 #include <libgtpnl/gtp.h>
 #include <libgtpnl/gtpnl.h>
 #include <libmnl/libmnl.h>
@@ -30,19 +34,288 @@
 
 #include "log.h"
 #include "common_defs.h"
+#include "common_types.h"
 #include "gtpv1u.h"
 #include "gtpv1u_sgw_defs.h"
+#include "service303.h"
 
 extern struct gtp_tunnel_ops gtp_tunnel_ops;
 
+/*
+ * Tunnel adds and deletes are queued and sent to the kernel in batches of
+ * netlink requests, GTP_NL_BATCH_SIZE at most, and GTP_NL_BATCH_DELAY_USEC
+ * after the first one was queued at the latest. Each request is acked on its
+ * own, the ack is matched with its request by sequence number, so failures
+ * are reported asynchronously with the TEIDs of the tunnel.
+ */
+#define GTP_NL_BATCH_SIZE 64
+#define GTP_NL_BATCH_DELAY_USEC 1000
+// A GTP tunnel request is a genetlink header and 6 u32 attributes
+#define GTP_NL_MSG_MAX_SIZE 128
+
+typedef struct gtp_nl_op_s {
+  uint8_t cmd;
+  struct in_addr ue;
+  struct in_addr enb;
+  uint32_t i_tei;
+  uint32_t o_tei;
+  uint64_t queued_usec;
+} gtp_nl_op_t;
+
+// Tunnel added again from the restored state
+typedef struct gtp_nl_replayed_s {
+  gtp_nl_op_t op;
+  bool in_kernel;
+} gtp_nl_replayed_t;
+
 static struct {
   int genl_id;
   struct mnl_socket* nl;
   bool is_enabled;
+  uint32_t ifidx;
+  uint32_t seq;
+  gtp_tunnel_failure_cb_t failure_cb;
+
+  // Protects the pending batch and the socket
+  pthread_mutex_t lock;
+  pthread_cond_t cond;
+  pthread_t flush_thread;
+  bool stopping;
+  gtp_nl_op_t pending[GTP_NL_BATCH_SIZE];
+  int num_pending;
+
+  // Tunnels added again while reconciling with the restored state
+  bool reconciling;
+  gtp_nl_replayed_t* replayed;
+  size_t num_replayed;
+  size_t replayed_size;
 } gtp_nl;
 
 #define GTP_DEVNAME "gtp0"
 
+static void libgtpnl_end_reconcile(void);
+
+static uint64_t monotonic_usec(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t) ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static const char* gtp_nl_cmd2str(uint8_t cmd) {
+  return cmd == GTP_CMD_NEWPDP ? "add" : "del";
+}
+
+static void gtp_nl_build_tunnel_msg(
+    struct mnl_nlmsg_batch* batch, const gtp_nl_op_t* op) {
+  uint16_t flags = NLM_F_ACK;
+  struct nlmsghdr* nlh;
+
+  if (op->cmd == GTP_CMD_NEWPDP) {
+    flags |= NLM_F_EXCL;
+  }
+  nlh = genl_nlmsg_build_hdr(
+      mnl_nlmsg_batch_current(batch), gtp_nl.genl_id, flags, ++gtp_nl.seq,
+      op->cmd);
+  mnl_attr_put_u32(nlh, GTPA_VERSION, GTP_V1);
+  mnl_attr_put_u32(nlh, GTPA_LINK, gtp_nl.ifidx);
+  // looking at kernel/drivers/net/gtp.c: addresses are not needed to delete
+  if (op->cmd == GTP_CMD_NEWPDP) {
+    mnl_attr_put_u32(nlh, GTPA_PEER_ADDRESS, op->enb.s_addr);
+    mnl_attr_put_u32(nlh, GTPA_MS_ADDRESS, op->ue.s_addr);
+  }
+  mnl_attr_put_u32(nlh, GTPA_I_TEI, op->i_tei);
+  mnl_attr_put_u32(nlh, GTPA_O_TEI, op->o_tei);
+  mnl_nlmsg_batch_next(batch);
+}
+
+typedef struct gtp_nl_batch_acks_s {
+  uint32_t first_seq;
+  bool acked[GTP_NL_BATCH_SIZE];
+  int num_acked;
+  int num_failed;
+  uint64_t acked_usec;
+} gtp_nl_batch_acks_t;
+
+// Called with the lock held, the failure callback must not queue requests
+static void gtp_nl_report_failure(const gtp_nl_op_t* op, int error) {
+  OAILOG_ERROR(
+      LOG_GTPV1U, "Failed to %s GTP tunnel " TEID_FMT " <-> " TEID_FMT ": %s\n",
+      gtp_nl_cmd2str(op->cmd), op->i_tei, op->o_tei, strerror(error));
+  increment_counter(
+      "gtpnl_tunnel_ops", 1, 2, "op", gtp_nl_cmd2str(op->cmd), "result",
+      "failure");
+  if (gtp_nl.failure_cb) {
+    gtp_nl.failure_cb(
+        op->cmd == GTP_CMD_NEWPDP, op->i_tei, op->o_tei, error);
+  }
+}
+
+static int gtp_nl_ack_cb(const struct nlmsghdr* nlh, void* data) {
+  gtp_nl_batch_acks_t* acks = (gtp_nl_batch_acks_t*) data;
+  const struct nlmsgerr* err =
+      (const struct nlmsgerr*) mnl_nlmsg_get_payload(nlh);
+  uint32_t idx = nlh->nlmsg_seq - acks->first_seq;
+
+  // Acks of an earlier batch whose receive failed are dropped
+  if (idx >= (uint32_t) gtp_nl.num_pending || acks->acked[idx]) {
+    return MNL_CB_OK;
+  }
+  const gtp_nl_op_t* op = &gtp_nl.pending[idx];
+  acks->acked[idx]      = true;
+  acks->num_acked++;
+  observe_histogram(
+      "gtpnl_tunnel_op_latency_ms",
+      (acks->acked_usec - op->queued_usec) / 1000., 1, "op",
+      gtp_nl_cmd2str(op->cmd), (size_t) 6, 0.1, 0.5, 1., 5., 10., 50.);
+  if (err->error != 0) {
+    gtp_nl_report_failure(op, -err->error);
+    acks->num_failed++;
+    return MNL_CB_OK;
+  }
+  increment_counter(
+      "gtpnl_tunnel_ops", 1, 2, "op", gtp_nl_cmd2str(op->cmd), "result",
+      "success");
+  return MNL_CB_OK;
+}
+
+/*
+ * Send the pending requests in one write on the socket and wait for their
+ * acks, with the lock held. Requests whose ack never came are reported as
+ * failed.
+ */
+static void gtp_nl_flush_locked(void) {
+  char buf[GTP_NL_BATCH_SIZE * GTP_NL_MSG_MAX_SIZE];
+  char ack_buf[MNL_SOCKET_BUFFER_SIZE];
+  mnl_cb_t ctl_cbs[NLMSG_MIN_TYPE] = {[NLMSG_ERROR] = gtp_nl_ack_cb};
+  gtp_nl_batch_acks_t acks         = {.first_seq = gtp_nl.seq + 1};
+  struct mnl_nlmsg_batch* batch;
+  int error = 0;
+
+  if (gtp_nl.num_pending == 0) {
+    return;
+  }
+  batch = mnl_nlmsg_batch_start(buf, sizeof(buf) - GTP_NL_MSG_MAX_SIZE);
+  for (int i = 0; i < gtp_nl.num_pending; i++) {
+    gtp_nl_build_tunnel_msg(batch, &gtp_nl.pending[i]);
+  }
+  if (mnl_socket_sendto(
+          gtp_nl.nl, mnl_nlmsg_batch_head(batch),
+          mnl_nlmsg_batch_size(batch)) < 0) {
+    error = errno;
+    OAILOG_ERROR(
+        LOG_GTPV1U, "Failed to send %d GTP tunnel requests: %s\n",
+        gtp_nl.num_pending, strerror(error));
+  }
+  mnl_nlmsg_batch_stop(batch);
+
+  while (error == 0 && acks.num_acked < gtp_nl.num_pending) {
+    int len = mnl_socket_recvfrom(gtp_nl.nl, ack_buf, sizeof(ack_buf));
+    if (len < 0) {
+      error = errno;
+      OAILOG_ERROR(
+          LOG_GTPV1U, "Failed to receive GTP tunnel acks: %s\n",
+          strerror(error));
+      break;
+    }
+    acks.acked_usec = monotonic_usec();
+    mnl_cb_run2(
+        ack_buf, len, 0, mnl_socket_get_portid(gtp_nl.nl), NULL, &acks,
+        ctl_cbs, NLMSG_MIN_TYPE);
+  }
+  // Whether the kernel applied them is unknown, the owner is told they failed
+  for (int i = 0; i < gtp_nl.num_pending; i++) {
+    if (!acks.acked[i]) {
+      gtp_nl_report_failure(&gtp_nl.pending[i], error);
+      acks.num_failed++;
+    }
+  }
+  if (acks.num_failed > 0) {
+    OAILOG_WARNING(
+        LOG_GTPV1U, "%d of %d GTP tunnel requests failed\n", acks.num_failed,
+        gtp_nl.num_pending);
+  }
+  gtp_nl.num_pending = 0;
+}
+
+static void* gtp_nl_flush_loop(__attribute__((unused)) void* args) {
+  pthread_mutex_lock(&gtp_nl.lock);
+  while (!gtp_nl.stopping) {
+    if (gtp_nl.num_pending == 0) {
+      pthread_cond_wait(&gtp_nl.cond, &gtp_nl.lock);
+      continue;
+    }
+    uint64_t deadline = gtp_nl.pending[0].queued_usec + GTP_NL_BATCH_DELAY_USEC;
+    uint64_t now      = monotonic_usec();
+    if (now < deadline) {
+      struct timespec ts;
+      clock_gettime(CLOCK_REALTIME, &ts);
+      uint64_t nsec = ts.tv_nsec + (deadline - now) * 1000;
+      ts.tv_sec += nsec / 1000000000;
+      ts.tv_nsec = nsec % 1000000000;
+      pthread_cond_timedwait(&gtp_nl.cond, &gtp_nl.lock, &ts);
+      continue;
+    }
+    gtp_nl_flush_locked();
+  }
+  gtp_nl_flush_locked();
+  pthread_mutex_unlock(&gtp_nl.lock);
+  return NULL;
+}
+
+static void gtp_nl_queue_op(
+    uint8_t cmd, struct in_addr ue, struct in_addr enb, uint32_t i_tei,
+    uint32_t o_tei) {
+  pthread_mutex_lock(&gtp_nl.lock);
+  gtp_nl_op_t* op = &gtp_nl.pending[gtp_nl.num_pending++];
+  op->cmd         = cmd;
+  op->ue          = ue;
+  op->enb         = enb;
+  op->i_tei       = i_tei;
+  op->o_tei       = o_tei;
+  op->queued_usec = monotonic_usec();
+
+  if (gtp_nl.num_pending == GTP_NL_BATCH_SIZE) {
+    gtp_nl_flush_locked();
+  } else if (gtp_nl.num_pending == 1) {
+    // Wake the flush thread up to wait for the batch delay
+    pthread_cond_signal(&gtp_nl.cond);
+  }
+  pthread_mutex_unlock(&gtp_nl.lock);
+}
+
+int libgtpnl_start(
+    struct mnl_socket* nl, int genl_id, uint32_t ifidx, bool persist_state) {
+  gtp_nl.nl          = nl;
+  gtp_nl.genl_id     = genl_id;
+  gtp_nl.ifidx       = ifidx;
+  gtp_nl.stopping    = false;
+  gtp_nl.num_pending = 0;
+  gtp_nl.reconciling = persist_state;
+  pthread_mutex_init(&gtp_nl.lock, NULL);
+  pthread_cond_init(&gtp_nl.cond, NULL);
+  if (pthread_create(&gtp_nl.flush_thread, NULL, gtp_nl_flush_loop, NULL) !=
+      0) {
+    OAILOG_ERROR(LOG_GTPV1U, "Cannot start GTP tunnel flush thread\n");
+    return RETURNerror;
+  }
+  gtp_nl.is_enabled = true;
+  return RETURNok;
+}
+
+void libgtpnl_stop(void) {
+  if (!gtp_nl.is_enabled) return;
+
+  // The pending requests are sent before the thread exits
+  pthread_mutex_lock(&gtp_nl.lock);
+  gtp_nl.stopping = true;
+  pthread_cond_signal(&gtp_nl.cond);
+  pthread_mutex_unlock(&gtp_nl.lock);
+  pthread_join(gtp_nl.flush_thread, NULL);
+  pthread_cond_destroy(&gtp_nl.cond);
+  pthread_mutex_destroy(&gtp_nl.lock);
+  gtp_nl.is_enabled = false;
+}
+
 status_code_e libgtpnl_init(
     struct in_addr* ue_net, uint32_t mask, int mtu, int* fd0, int* fd1u,
     bool persist_state) {
@@ -80,21 +353,23 @@ status_code_e libgtpnl_init(
         LOG_GTPV1U, "Cannot create GTP tunnel device: %s\n", strerror(errno));
     return RETURNerror;
   }
-  gtp_nl.is_enabled = true;
 
-  gtp_nl.nl = genl_socket_open();
-  if (gtp_nl.nl == NULL) {
+  struct mnl_socket* nl = genl_socket_open();
+  if (nl == NULL) {
     OAILOG_ERROR(LOG_GTPV1U, "Cannot create genetlink socket\n");
     return RETURNerror;
   }
-  gtp_nl.genl_id = genl_lookup_family(gtp_nl.nl, "gtp");
-  if (gtp_nl.genl_id < 0) {
+  int genl_id = genl_lookup_family(nl, "gtp");
+  if (genl_id < 0) {
     OAILOG_ERROR(LOG_GTPV1U, "Cannot lookup GTP genetlink ID\n");
     return RETURNerror;
   }
+  if (libgtpnl_start(nl, genl_id, if_nametoindex(GTP_DEVNAME), persist_state) <
+      0) {
+    return RETURNerror;
+  }
   OAILOG_NOTICE(
-      LOG_GTPV1U, "Using the GTP kernel mode (genl ID is %d)\n",
-      gtp_nl.genl_id);
+      LOG_GTPV1U, "Using the GTP kernel mode (genl ID is %d)\n", genl_id);
 
   bstring system_cmd = bformat("ip link set dev %s mtu %u", GTP_DEVNAME, mtu);
   int ret            = system((const char*) system_cmd->data);
@@ -138,6 +413,7 @@ status_code_e libgtpnl_init(
 status_code_e libgtpnl_uninit(void) {
   if (!gtp_nl.is_enabled) return -1;
 
+  libgtpnl_stop();
   return gtp_dev_destroy(GTP_DEVNAME);
 }
 
@@ -153,52 +429,169 @@ status_code_e libgtpnl_add_tunnel(
     __attribute__((unused)) int vlan, struct in_addr enb, uint32_t i_tei,
     uint32_t o_tei, Imsi_t imsi, struct ip_flow_dl* flow_dl,
     __attribute__((unused)) char* apn) {
-  struct gtp_tunnel* t;
-  int ret;
+  if (!gtp_nl.is_enabled) return RETURNok;
+
+  // While reconciling, tunnels are only added by the replay of the restored
+  // state, on the thread initializing SPGW
+  if (gtp_nl.reconciling) {
+    if (gtp_nl.num_replayed == gtp_nl.replayed_size) {
+      size_t size = gtp_nl.replayed_size ? 2 * gtp_nl.replayed_size :
+                                           GTP_NL_BATCH_SIZE;
+      gtp_nl_replayed_t* replayed =
+          realloc(gtp_nl.replayed, size * sizeof(gtp_nl_replayed_t));
+      if (replayed == NULL) {
+        OAILOG_ERROR(
+            LOG_GTPV1U,
+            "Cannot track the restored GTP tunnels, they are not checked\n");
+        libgtpnl_end_reconcile();
+      } else {
+        gtp_nl.replayed      = replayed;
+        gtp_nl.replayed_size = size;
+      }
+    }
+    if (gtp_nl.reconciling) {
+      gtp_nl.replayed[gtp_nl.num_replayed++] = (gtp_nl_replayed_t){
+          .op =
+              {
+                  .cmd   = GTP_CMD_NEWPDP,
+                  .ue    = ue,
+                  .enb   = enb,
+                  .i_tei = i_tei,
+                  .o_tei = o_tei,
+              },
+          .in_kernel = false,
+      };
+    }
+  }
+  gtp_nl_queue_op(GTP_CMD_NEWPDP, ue, enb, i_tei, o_tei);
+  return RETURNok;
+}
 
+status_code_e libgtpnl_del_tunnel(
+    struct in_addr enb, struct in_addr ue,
+    __attribute__((unused)) struct in6_addr* ue_ipv6, uint32_t i_tei,
+    uint32_t o_tei, struct ip_flow_dl* flow_dl) {
   if (!gtp_nl.is_enabled) return RETURNok;
 
-  t = gtp_tunnel_alloc();
-  if (t == NULL) return RETURNerror;
+  gtp_nl_queue_op(GTP_CMD_DELPDP, ue, enb, i_tei, o_tei);
+  return RETURNok;
+}
 
-  gtp_tunnel_set_ifidx(t, if_nametoindex(GTP_DEVNAME));
-  gtp_tunnel_set_version(t, 1);
-  gtp_tunnel_set_ms_ip4(t, &ue);
-  gtp_tunnel_set_sgsn_ip4(t, &enb);
-  gtp_tunnel_set_i_tei(t, i_tei);
-  gtp_tunnel_set_o_tei(t, o_tei);
+static void libgtpnl_end_reconcile(void) {
+  free(gtp_nl.replayed);
+  gtp_nl.replayed      = NULL;
+  gtp_nl.num_replayed  = 0;
+  gtp_nl.replayed_size = 0;
+  gtp_nl.reconciling   = false;
+}
 
-  ret = gtp_add_tunnel(gtp_nl.genl_id, gtp_nl.nl, t);
-  gtp_tunnel_free(t);
+typedef struct gtp_nl_dump_s {
+  size_t num_tunnels;
+  size_t num_unknown;
+} gtp_nl_dump_t;
 
-  return ret;
+static int compare_replayed(const void* a, const void* b) {
+  uint32_t tei_a = ((const gtp_nl_replayed_t*) a)->op.i_tei;
+  uint32_t tei_b = ((const gtp_nl_replayed_t*) b)->op.i_tei;
+  return (tei_a > tei_b) - (tei_a < tei_b);
 }
 
-status_code_e libgtpnl_del_tunnel(
-    __attribute__((unused)) struct in_addr enb,
-    __attribute__((unused)) struct in_addr ue,
-    __attribute__((unused)) struct in6_addr* ue_ipv6, uint32_t i_tei,
-    uint32_t o_tei, struct ip_flow_dl* flow_dl) {
-  struct gtp_tunnel* t;
-  int ret;
+static int gtp_nl_dump_attr_cb(const struct nlattr* attr, void* data) {
+  const struct nlattr** tb = (const struct nlattr**) data;
 
-  if (!gtp_nl.is_enabled) return RETURNok;
+  if (mnl_attr_type_valid(attr, GTPA_MAX) < 0) {
+    return MNL_CB_OK;
+  }
+  tb[mnl_attr_get_type(attr)] = attr;
+  return MNL_CB_OK;
+}
 
-  t = gtp_tunnel_alloc();
-  if (t == NULL) return RETURNerror;
+static int gtp_nl_dump_cb(const struct nlmsghdr* nlh, void* data) {
+  const struct nlattr* tb[GTPA_MAX + 1] = {NULL};
+  gtp_nl_dump_t* dump                   = (gtp_nl_dump_t*) data;
+  gtp_nl_replayed_t key                 = {0};
+  gtp_nl_replayed_t* replayed;
 
-  gtp_tunnel_set_ifidx(t, if_nametoindex(GTP_DEVNAME));
-  gtp_tunnel_set_version(t, 1);
-  // looking at kernel/drivers/net/gtp.c: not needed gtp_tunnel_set_ms_ip4(t,
-  // &ue); looking at kernel/drivers/net/gtp.c: not needed
-  // gtp_tunnel_set_sgsn_ip4(t, &enb);
-  gtp_tunnel_set_i_tei(t, i_tei);
-  gtp_tunnel_set_o_tei(t, o_tei);
+  mnl_attr_parse(nlh, sizeof(struct genlmsghdr), gtp_nl_dump_attr_cb, tb);
+  if (tb[GTPA_I_TEI] == NULL) {
+    return MNL_CB_OK;
+  }
+  key.op.i_tei = mnl_attr_get_u32(tb[GTPA_I_TEI]);
+  dump->num_tunnels++;
+  replayed = bsearch(
+      &key, gtp_nl.replayed, gtp_nl.num_replayed, sizeof(gtp_nl_replayed_t),
+      compare_replayed);
+  if (replayed == NULL) {
+    dump->num_unknown++;
+    return MNL_CB_OK;
+  }
+  replayed->in_kernel = true;
+  return MNL_CB_OK;
+}
 
-  ret = gtp_del_tunnel(gtp_nl.genl_id, gtp_nl.nl, t);
-  gtp_tunnel_free(t);
+/*
+ * The gtp module is reloaded on start, the device only has the tunnels added
+ * again from the restored state by then. They are checked against a dump of
+ * the device, the ones missing from it are added again, a failure of that
+ * second attempt is reported to the failure callback like any other.
+ */
+status_code_e libgtpnl_reconcile_tunnels(void) {
+  char buf[MNL_SOCKET_BUFFER_SIZE];
+  gtp_nl_dump_t dump = {0};
+  size_t num_missing = 0;
+  struct nlmsghdr* nlh;
+  int ret;
 
-  return ret;
+  if (!gtp_nl.is_enabled || !gtp_nl.reconciling) return RETURNok;
+
+  gtp_nl.reconciling = false;
+  qsort(
+      gtp_nl.replayed, gtp_nl.num_replayed, sizeof(gtp_nl_replayed_t),
+      compare_replayed);
+  pthread_mutex_lock(&gtp_nl.lock);
+  // The replayed tunnels are in the kernel once their requests are acked
+  gtp_nl_flush_locked();
+  nlh = genl_nlmsg_build_hdr(
+      buf, gtp_nl.genl_id, NLM_F_DUMP, ++gtp_nl.seq, GTP_CMD_GETPDP);
+  ret = genl_socket_talk(gtp_nl.nl, nlh, gtp_nl.seq, gtp_nl_dump_cb, &dump);
+  pthread_mutex_unlock(&gtp_nl.lock);
+
+  if (ret < 0) {
+    OAILOG_ERROR(
+        LOG_GTPV1U, "Cannot dump the GTP tunnels: %s\n", strerror(errno));
+  } else {
+    for (size_t i = 0; i < gtp_nl.num_replayed; i++) {
+      const gtp_nl_op_t* op = &gtp_nl.replayed[i].op;
+      if (gtp_nl.replayed[i].in_kernel) {
+        continue;
+      }
+      OAILOG_WARNING(
+          LOG_GTPV1U,
+          "Restored GTP tunnel " TEID_FMT " <-> " TEID_FMT
+          " is missing, adding it again\n",
+          op->i_tei, op->o_tei);
+      gtp_nl_queue_op(op->cmd, op->ue, op->enb, op->i_tei, op->o_tei);
+      num_missing++;
+    }
+    increment_counter("gtpnl_restored_tunnels_missing", num_missing, NO_LABELS);
+    OAILOG_INFO(
+        LOG_GTPV1U,
+        "Resynced GTP tunnels: %zu restored, %zu in the kernel, %zu missing "
+        "added again, %zu unknown\n",
+        gtp_nl.num_replayed, dump.num_tunnels, num_missing, dump.num_unknown);
+  }
+  libgtpnl_end_reconcile();
+  return ret < 0 ? RETURNerror : RETURNok;
+}
+
+void libgtpnl_set_failure_cb(gtp_tunnel_failure_cb_t failure_cb) {
+  if (!gtp_nl.is_enabled) {
+    gtp_nl.failure_cb = failure_cb;
+    return;
+  }
+  pthread_mutex_lock(&gtp_nl.lock);
+  gtp_nl.failure_cb = failure_cb;
+  pthread_mutex_unlock(&gtp_nl.lock);
 }
 
 /**
@@ -213,13 +606,15 @@ const char* libgtpnl_get_dev_name() {
 }
 
 static const struct gtp_tunnel_ops libgtpnl_ops = {
-    .init            = libgtpnl_init,
-    .uninit          = libgtpnl_uninit,
-    .reset           = libgtpnl_reset,
-    .add_tunnel      = libgtpnl_add_tunnel,
-    .del_tunnel      = libgtpnl_del_tunnel,
-    .send_end_marker = libgtpnl_send_end_marker,
-    .get_dev_name    = libgtpnl_get_dev_name,
+    .init              = libgtpnl_init,
+    .uninit            = libgtpnl_uninit,
+    .reset             = libgtpnl_reset,
+    .add_tunnel        = libgtpnl_add_tunnel,
+    .del_tunnel        = libgtpnl_del_tunnel,
+    .send_end_marker   = libgtpnl_send_end_marker,
+    .get_dev_name      = libgtpnl_get_dev_name,
+    .reconcile_tunnels = libgtpnl_reconcile_tunnels,
+    .set_failure_cb    = libgtpnl_set_failure_cb,
 };
 
 const struct gtp_tunnel_ops* gtp_tunnel_ops_init_libgtpnl(void) {
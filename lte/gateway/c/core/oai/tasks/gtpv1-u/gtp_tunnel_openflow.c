@@ -250,11 +250,17 @@ int openflow_init(
   return 0;
 }
 
+// Flows are removed by the controller on switch up, unless the state is
+// persisted, then they are reconciled with the restored tunnels instead
 int openflow_reset(void) {
   int rv = 0;
   return rv;
 }
 
+int openflow_reconcile_tunnels(void) {
+  return openflow_controller_reconcile_gtp_tunnels();
+}
+
 int openflow_add_tunnel(
     struct in_addr ue, struct in6_addr* ue_ipv6, int vlan, struct in_addr enb,
     uint32_t i_tei, uint32_t o_tei, Imsi_t imsi, struct ip_flow_dl* flow_dl,
@@ -388,6 +394,7 @@ static const struct gtp_tunnel_ops openflow_ops = {
     .delete_paging_rule     = openflow_delete_paging_rule,
     .send_end_marker        = openflow_send_end_marker,
     .get_dev_name           = openflow_get_dev_name,
+    .reconcile_tunnels      = openflow_reconcile_tunnels,
 };
 
 const struct gtp_tunnel_ops* gtp_tunnel_ops_init_openflow(void) {
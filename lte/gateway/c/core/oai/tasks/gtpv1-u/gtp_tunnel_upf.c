@@ -48,6 +48,11 @@ const struct gtp_tunnel_ops* upf_gtp_tunnel_ops_init_openflow(void) {
   return (&upf_openflow_ops);
 }
 
+void upf_set_tunnel_update_batching(
+    uint32_t max_batch_size, uint32_t max_delay_usec) {
+  upf_classifier_set_batching(max_batch_size, max_delay_usec);
+}
+
 int upf_add_tunnel(
     struct in_addr ue, struct in6_addr* ue_ipv6, int vlan, struct in_addr enb,
     uint32_t i_tei, uint32_t o_tei, Imsi_t imsi, struct ip_flow_dl* flow_dl,
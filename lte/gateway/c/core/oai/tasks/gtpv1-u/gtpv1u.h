@@ -129,7 +129,22 @@ struct ip_flow_dl {
  * int (*send_end_marker) (struct in_addr enb, uint32_t i_tei);
  *        @enb: eNB IP address
  *        @i_tei: RX GTP Tunnel ID
+ *
+ * int (*reconcile_tunnels)(void);
+ *     Called once the tunnels of the state restored on restart were added
+ *     again, to check that they all are in the device and add the missing
+ *     ones once more.
+ *
+ * void (*set_failure_cb)(gtp_tunnel_failure_cb_t failure_cb);
+ *     Set the function called when a tunnel add or delete failed after
+ *     add_tunnel or del_tunnel returned, for the ops applying them
+ *     asynchronously.
+ *        @failure_cb: called from the thread applying the tunnel ops
  */
+// Failure of a tunnel add or delete reported asynchronously
+typedef void (*gtp_tunnel_failure_cb_t)(
+    bool is_add, uint32_t i_tei, uint32_t o_tei, int error);
+
 struct gtp_tunnel_ops {
   int (*init)(
       struct in_addr* ue_net, uint32_t mask, int mtu, int* fd0, int* fd1u,
@@ -162,12 +177,19 @@ struct gtp_tunnel_ops {
   int (*delete_paging_rule)(struct in_addr ue);
   int (*send_end_marker)(struct in_addr enbode, uint32_t i_tei);
   const char* (*get_dev_name)(void);
+  int (*reconcile_tunnels)(void);
+  void (*set_failure_cb)(gtp_tunnel_failure_cb_t failure_cb);
 };
 
 #if ENABLE_OPENFLOW
 const struct gtp_tunnel_ops* gtp_tunnel_ops_init_openflow(void);
 #else
 const struct gtp_tunnel_ops* gtp_tunnel_ops_init_libgtpnl(void);
+// Start and stop the tunnel ops on an opened genetlink socket
+struct mnl_socket;
+int libgtpnl_start(
+    struct mnl_socket* nl, int genl_id, uint32_t ifidx, bool persist_state);
+void libgtpnl_stop(void);
 #endif
 
 int gtpv1u_add_tunnel(
@@ -123,6 +123,9 @@ int gtpv1u_init(
   if (spgw_config->sgw_config.ovs_config.pipelined_managed_tbl0) {
     OAILOG_INFO(LOG_GTPV1U, "Initializing upf classifier for gtp apps");
     gtp_tunnel_ops = upf_gtp_tunnel_ops_init_openflow();
+    upf_set_tunnel_update_batching(
+        spgw_config->sgw_config.ovs_config.pipelined_batch_size,
+        spgw_config->sgw_config.ovs_config.pipelined_batch_delay_usec);
   } else {
     OAILOG_DEBUG(LOG_GTPV1U, "Initializing gtp_tunnel_ops_openflow\n");
     gtp_tunnel_ops = gtp_tunnel_ops_init_openflow();
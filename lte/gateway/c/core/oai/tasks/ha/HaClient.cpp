@@ -11,7 +11,6 @@ See the License for the specific language governing permissions and
 limitations under the License.
 */
 #include <grpcpp/impl/codegen/async_unary_call.h>
-#include <thread>  // std::thread
 #include <iostream>
 #include <utility>
 
@@ -26,14 +25,12 @@ HaClient& HaClient::get_instance() {
   return client_instance;
 }
 
-HaClient::HaClient() {
+HaClient::HaClient() : GRPCReceiver(GRPCRuntime::get_instance()) {
   auto channel = ServiceRegistrySingleton::Instance()->GetGrpcChannel(
       "ha", ServiceRegistrySingleton::CLOUD);
   // Create stub for HaProxy gRPC service
   stub_ = lte::Ha::NewStub(channel);
 
-  std::thread resp_loop_thread([&]() { rpc_response_loop(); });
-  resp_loop_thread.detach();
 }
 
 void HaClient::get_eNB_offload_state(
@@ -44,7 +41,7 @@ void HaClient::get_eNB_offload_state(
   // Create a raw response pointer that stores a callback to be called when the
   // gRPC call is answered
   auto resp = new AsyncLocalResponse<lte::GetEnodebOffloadStateResponse>(
-      std::move(callback), RESPONSE_TIMEOUT);
+      std::move(callback), RESPONSE_TIMEOUT, "Ha/GetEnodebOffloadState");
 
   // Create a response reader for the `GetEnodebOffloadStateRequest` RPC call.
   // This reader stores the client context, the request to pass in,
@@ -11,6 +11,7 @@ See the License for the specific language governing permissions and
 limitations under the License.
 */
 #include <iostream>
+#include <string>
 #include <string.h>
 #include <sys/types.h>
 
@@ -75,13 +76,50 @@ typedef struct callback_data_s {
   ha_agw_offload_req_t* request;
 } callback_data_t;
 
+// What the offload of a UE depends on, taken from its UE context or from a
+// copy of its record
+typedef struct ue_offload_state_s {
+  imsi64_t imsi64;
+  std::string imsi;
+  sctp_assoc_id_t sctp_assoc_id_key;
+  ecm_state_t ecm_state;
+  mm_state_t mm_state;
+  mme_ue_s1ap_id_t mme_ue_s1ap_id;
+  enb_ue_s1ap_id_t enb_ue_s1ap_id;
+  uint32_t cell_enb_id;
+  uint32_t cell_id;
+} ue_offload_state_t;
+
+static bool offload_ue(
+    const ue_offload_state_t& ue, callback_data_t* callback_data);
+
 void handle_agw_offload_req(ha_agw_offload_req_t* offload_req) {
-  hash_table_ts_t* state_imsi_ht =
-      magma::lte::MmeNasStateManager::getInstance().get_ue_state_ht();
+  auto& mme_nas_state_manager = magma::lte::MmeNasStateManager::getInstance();
   callback_data_t callback_data;
   callback_data.s1ap_state =
       magma::lte::S1apStateManager::getInstance().get_state(false);
   callback_data.request = offload_req;
+
+  // Copies of the UE records kept by MME_APP in its UE state region, the UE
+  // contexts MME_APP is updating are left alone
+  bool from_region = mme_nas_state_manager.for_each_ue_proto_in_region(
+      [&](const std::string& imsi, const magma::lte::oai::UeContext& ue) {
+        ue_offload_state_t state;
+        state.imsi64            = ue.emm_context().imsi64();
+        state.imsi              = imsi;
+        state.sctp_assoc_id_key = ue.sctp_assoc_id_key();
+        state.ecm_state         = (ecm_state_t) ue.ecm_state();
+        state.mm_state          = (mm_state_t) ue.mm_state();
+        state.mme_ue_s1ap_id    = ue.mme_ue_s1ap_id();
+        state.enb_ue_s1ap_id    = ue.enb_ue_s1ap_id();
+        state.cell_enb_id       = ue.e_utran_cgi().enb_id();
+        state.cell_id           = ue.e_utran_cgi().cell_id();
+        return offload_ue(state, &callback_data);
+      });
+  if (from_region) {
+    return;
+  }
+  hash_table_ts_t* state_imsi_ht = mme_nas_state_manager.get_ue_state_ht();
   hashtable_ts_apply_callback_on_elements(
       state_imsi_ht, trigger_agw_offload_for_ue, (void*) &callback_data, NULL);
 }
@@ -89,22 +127,42 @@ void handle_agw_offload_req(ha_agw_offload_req_t* offload_req) {
 bool trigger_agw_offload_for_ue(
     const hash_key_t keyP, void* const elementP, void* parameterP,
     void** resultP) {
-  imsi64_t imsi64                = INVALID_IMSI64;
-  callback_data_t* callback_data = (callback_data_t*) parameterP;
-  ha_agw_offload_req_t* offload_request =
-      (ha_agw_offload_req_t*) callback_data->request;
-  s1ap_state_t* s1ap_state = (s1ap_state_t*) callback_data->s1ap_state;
   struct ue_mm_context_s* ue_context_p = (struct ue_mm_context_s*) elementP;
+  ue_offload_state_t state;
+  char imsi[IMSI_BCD_DIGITS_MAX + 1] = {0};
+
+  IMSI64_TO_STRING(
+      ue_context_p->emm_context._imsi64, imsi,
+      ue_context_p->emm_context._imsi.length);
+  state.imsi64            = ue_context_p->emm_context._imsi64;
+  state.imsi              = imsi;
+  state.sctp_assoc_id_key = ue_context_p->sctp_assoc_id_key;
+  state.ecm_state         = ue_context_p->ecm_state;
+  state.mm_state          = ue_context_p->mm_state;
+  state.mme_ue_s1ap_id    = ue_context_p->mme_ue_s1ap_id;
+  state.enb_ue_s1ap_id    = ue_context_p->enb_ue_s1ap_id;
+  state.cell_enb_id       = ue_context_p->e_utran_cgi.cell_identity.enb_id;
+  state.cell_id           = ue_context_p->e_utran_cgi.cell_identity.cell_id;
+  return offload_ue(state, (callback_data_t*) parameterP);
+}
+
+static bool offload_ue(
+    const ue_offload_state_t& ue, callback_data_t* callback_data) {
+  imsi64_t imsi64                       = INVALID_IMSI64;
+  ha_agw_offload_req_t* offload_request = callback_data->request;
+  s1ap_state_t* s1ap_state              = callback_data->s1ap_state;
   bool any_flag = false;  // true if we tried offloading any UE
 
   IMSI_STRING_TO_IMSI64(offload_request->imsi, &imsi64);
 
   enb_description_t* enb_ref_p =
-      s1ap_state_get_enb(s1ap_state, ue_context_p->sctp_assoc_id_key);
+      s1ap_state_get_enb(s1ap_state, ue.sctp_assoc_id_key);
+  if (enb_ref_p == NULL) {
+    return false;
+  }
 
   // Return if this UE does not satisfy any of the filtering criteria
-  if ((imsi64 != ue_context_p->emm_context._imsi64) &&
-      (offload_request->eNB_id != enb_ref_p->enb_id)) {
+  if ((imsi64 != ue.imsi64) && (offload_request->eNB_id != enb_ref_p->enb_id)) {
     return false;
   }
 
@@ -112,15 +170,13 @@ bool trigger_agw_offload_for_ue(
   // When a UE is in ECM_CONNECTED state, we can direcly start offloading.
   // For a UE in ECM_IDLE mode however, we need to first page the user and
   // then we can offload it.
-  if ((ue_context_p->ecm_state == ECM_CONNECTED) &&
+  if ((ue.ecm_state == ECM_CONNECTED) &&
       ((enb_offtype == ALL) || (enb_offtype == ANY) ||
        (enb_offtype == ANY_CONNECTED))) {
     MessageDef* message_p =
         itti_alloc_new_message(TASK_HA, S1AP_UE_CONTEXT_RELEASE_REQ);
-    S1AP_UE_CONTEXT_RELEASE_REQ(message_p).mme_ue_s1ap_id =
-        ue_context_p->mme_ue_s1ap_id;
-    S1AP_UE_CONTEXT_RELEASE_REQ(message_p).enb_ue_s1ap_id =
-        ue_context_p->enb_ue_s1ap_id;
+    S1AP_UE_CONTEXT_RELEASE_REQ(message_p).mme_ue_s1ap_id = ue.mme_ue_s1ap_id;
+    S1AP_UE_CONTEXT_RELEASE_REQ(message_p).enb_ue_s1ap_id = ue.enb_ue_s1ap_id;
     S1AP_UE_CONTEXT_RELEASE_REQ(message_p).enb_id   = enb_ref_p->enb_id;
     S1AP_UE_CONTEXT_RELEASE_REQ(message_p).relCause = S1AP_NAS_MME_OFFLOADING;
 
@@ -131,10 +187,8 @@ bool trigger_agw_offload_for_ue(
         "Context ENB ID: "
         "%d, UE "
         "Context cell id: %d, S1AP State ENB ID: %d",
-        ue_context_p->emm_context._imsi64, offload_request->imsi,
-        ue_context_p->mme_ue_s1ap_id, ue_context_p->enb_ue_s1ap_id,
-        ue_context_p->e_utran_cgi.cell_identity.enb_id,
-        ue_context_p->e_utran_cgi.cell_identity.cell_id, enb_ref_p->enb_id);
+        ue.imsi64, offload_request->imsi, ue.mme_ue_s1ap_id,
+        ue.enb_ue_s1ap_id, ue.cell_enb_id, ue.cell_id, enb_ref_p->enb_id);
     OAILOG_INFO(
         LOG_UTIL, "UE Context Release procedure initiated for IMSI%s",
         offload_request->imsi);
@@ -143,28 +197,22 @@ bool trigger_agw_offload_for_ue(
     send_msg_to_task(&ha_task_zmq_ctx, TASK_MME_APP, message_p);
     any_flag = true;
   } else if (
-      (ue_context_p->ecm_state == ECM_IDLE) &&
-      (ue_context_p->mm_state == UE_REGISTERED) &&
+      (ue.ecm_state == ECM_IDLE) && (ue.mm_state == UE_REGISTERED) &&
       ((enb_offtype == ALL) || (enb_offtype == ANY) ||
        (enb_offtype == ANY_IDLE))) {
-    // Upon connection re-establishment, this release cause value will
-    // be checked and cleared by MME APP to send offload request.
-    ue_context_p->ue_context_rel_cause = S1AP_NAS_MME_PENDING_OFFLOADING;
-
-    char imsi[IMSI_BCD_DIGITS_MAX + 1] = {0};
-    IMSI64_TO_STRING(
-        ue_context_p->emm_context._imsi64, imsi,
-        ue_context_p->emm_context._imsi.length);
-
-    OAILOG_INFO(LOG_UTIL, "Paging procedure initiated for IMSI%s", imsi);
+    // MME_APP flags the UE context as pending offloading on this paging
+    // request. The flag is checked and cleared upon connection
+    // re-establishment to send the offload request.
+    OAILOG_INFO(
+        LOG_UTIL, "Paging procedure initiated for IMSI%s", ue.imsi.c_str());
     MessageDef* message_p                       = NULL;
     itti_s11_paging_request_t* paging_request_p = NULL;
 
     message_p        = itti_alloc_new_message(TASK_HA, S11_PAGING_REQUEST);
     paging_request_p = &message_p->ittiMsg.s11_paging_request;
     memset((void*) paging_request_p, 0, sizeof(itti_s11_paging_request_t));
-    paging_request_p->imsi        = strdup(imsi);
-    message_p->ittiMsgHeader.imsi = ue_context_p->emm_context._imsi64;
+    paging_request_p->imsi        = strdup(ue.imsi.c_str());
+    message_p->ittiMsgHeader.imsi = ue.imsi64;
     send_msg_to_task(&ha_task_zmq_ctx, TASK_MME_APP, message_p);
     any_flag = true;
   }
@@ -0,0 +1,317 @@
+/*
+Copyright 2020 The Magma Authors.
+
+This source code is licensed under the BSD-style license found in the
+LICENSE file in the root directory of this source tree.
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <algorithm>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "mme_app_auth_vector_cache.h"
+#include "lte/protos/oai/mme_nas_state.pb.h"
+#include "redis_utils/redis_client.h"
+
+extern "C" {
+#include "log.h"
+#include "service303.h"
+}
+
+using magma::lte::RedisClient;
+using magma::lte::oai::AuthVector;
+using magma::lte::oai::AuthVectorCacheEntry;
+
+namespace {
+constexpr char AUTH_VECTOR_CACHE_KEY_PREFIX[] = "auth_vectors:";
+constexpr char AUTH_VECTOR_CACHE_METRIC[]     = "mme_auth_vector_cache";
+// Keys fetched per pipelined MGET command on restore
+constexpr size_t RESTORE_MGET_BATCH_SIZE = 500;
+
+struct CacheEntry {
+  // Oldest first, their SQNs increase
+  std::vector<auth_vector_t> vectors;
+  uint64_t expiry_sec;
+  std::list<imsi64_t>::iterator order;
+};
+
+typedef std::unordered_map<imsi64_t, CacheEntry> Cache;
+
+uint32_t max_ues = 0;
+uint32_t ttl_sec = 0;
+// Updated by the MME_APP shards
+std::mutex cache_mutex;
+Cache cache;
+// IMSIs by expiry, which is the order they were put in
+std::list<imsi64_t> expiry_order;
+// IMSIs whose vectors changed since the last flush to redis
+std::unordered_set<imsi64_t> dirty;
+// Serializes the flushes, so that the writes of an IMSI keep their order
+std::mutex flush_mutex;
+// Null when the MME state is not persisted
+std::unique_ptr<RedisClient> redis_client;
+
+uint64_t now_sec() {
+  return time(nullptr);
+}
+
+std::string cache_key(imsi64_t imsi64) {
+  return AUTH_VECTOR_CACHE_KEY_PREFIX + std::to_string(imsi64);
+}
+
+/**
+ * Marks the vectors of an IMSI to be written to redis on the next flush
+ */
+void persist_entry(imsi64_t imsi64) {
+  if (redis_client) {
+    dirty.insert(imsi64);
+  }
+}
+
+/**
+ * Writes the vectors of an IMSI to redis, or removes them if entry is null
+ */
+void write_entry(imsi64_t imsi64, const CacheEntry* entry) {
+  if (entry == nullptr) {
+    if (redis_client->clear_keys({cache_key(imsi64)}) != RETURNok) {
+      OAILOG_ERROR_UE(
+          LOG_MME_APP, imsi64, "Failed to remove cached auth vectors\n");
+    }
+    return;
+  }
+
+  AuthVectorCacheEntry entry_proto;
+  for (const auto& vector : entry->vectors) {
+    AuthVector* vector_proto = entry_proto.add_vectors();
+    vector_proto->set_kasme(vector.kasme, AUTH_KASME_SIZE);
+    vector_proto->set_rand(vector.rand, AUTH_RAND_SIZE);
+    vector_proto->set_autn(vector.autn, AUTH_AUTN_SIZE);
+    vector_proto->set_xres(vector.xres, vector.xres_size);
+  }
+  entry_proto.set_expiry_sec(entry->expiry_sec);
+  std::string proto_str;
+  if (RedisClient::serialize(entry_proto, proto_str) != RETURNok ||
+      redis_client->write_proto_str(cache_key(imsi64), proto_str, 0) !=
+          RETURNok) {
+    OAILOG_ERROR_UE(
+        LOG_MME_APP, imsi64, "Failed to write cached auth vectors\n");
+  }
+}
+
+void insert_entry(
+    imsi64_t imsi64, std::vector<auth_vector_t>&& vectors,
+    uint64_t expiry_sec) {
+  CacheEntry& entry = cache[imsi64];
+  entry.vectors     = std::move(vectors);
+  entry.expiry_sec  = expiry_sec;
+  entry.order       = expiry_order.insert(expiry_order.end(), imsi64);
+}
+
+void erase_entry(Cache::iterator it) {
+  expiry_order.erase(it->second.order);
+  cache.erase(it);
+}
+
+/**
+ * Drops the expired vectors, and the oldest beyond max_ues IMSIs
+ */
+void evict(uint64_t now) {
+  while (!expiry_order.empty()) {
+    imsi64_t imsi64 = expiry_order.front();
+    auto it         = cache.find(imsi64);
+    if (it->second.expiry_sec > now && cache.size() <= max_ues) {
+      break;
+    }
+    erase_entry(it);
+    persist_entry(imsi64);
+  }
+  set_gauge("mme_auth_vector_cache_ues", cache.size(), NO_LABELS);
+}
+
+bool proto_to_vectors(
+    const AuthVectorCacheEntry& entry_proto,
+    std::vector<auth_vector_t>* vectors) {
+  for (const auto& vector_proto : entry_proto.vectors()) {
+    auth_vector_t vector = {};
+    if (vector_proto.kasme().size() != AUTH_KASME_SIZE ||
+        vector_proto.rand().size() != AUTH_RAND_SIZE ||
+        vector_proto.autn().size() != AUTH_AUTN_SIZE ||
+        vector_proto.xres().size() > AUTH_XRES_SIZE) {
+      return false;
+    }
+    memcpy(vector.kasme, vector_proto.kasme().data(), AUTH_KASME_SIZE);
+    memcpy(vector.rand, vector_proto.rand().data(), AUTH_RAND_SIZE);
+    memcpy(vector.autn, vector_proto.autn().data(), AUTH_AUTN_SIZE);
+    memcpy(vector.xres, vector_proto.xres().data(), vector_proto.xres().size());
+    vector.xres_size = vector_proto.xres().size();
+    vectors->push_back(vector);
+  }
+  return !vectors->empty();
+}
+
+void restore_cache() {
+  std::vector<std::string> keys =
+      redis_client->get_keys(std::string(AUTH_VECTOR_CACHE_KEY_PREFIX) + "*");
+  std::vector<std::string> values;
+  std::vector<bool> found;
+  if (redis_client->read_batch(
+          keys, RESTORE_MGET_BATCH_SIZE, values, found) != RETURNok) {
+    OAILOG_ERROR(LOG_MME_APP, "Failed to read cached auth vectors from db\n");
+    return;
+  }
+
+  // Inserted by expiry, for the eviction order
+  std::vector<std::pair<uint64_t, size_t>> restored;
+  std::vector<AuthVectorCacheEntry> entry_protos(keys.size());
+  for (size_t i = 0; i < keys.size(); i++) {
+    if (found[i] &&
+        RedisClient::unwrap_proto(values[i], entry_protos[i], nullptr) ==
+            RETURNok) {
+      restored.emplace_back(entry_protos[i].expiry_sec(), i);
+    }
+  }
+  std::sort(restored.begin(), restored.end());
+
+  for (const auto& expiry_index : restored) {
+    const std::string& key = keys[expiry_index.second];
+    imsi64_t imsi64        = strtoull(
+        key.c_str() + strlen(AUTH_VECTOR_CACHE_KEY_PREFIX), nullptr, 10);
+    std::vector<auth_vector_t> vectors;
+    if (imsi64 != INVALID_IMSI64 &&
+        proto_to_vectors(entry_protos[expiry_index.second], &vectors)) {
+      insert_entry(imsi64, std::move(vectors), expiry_index.first);
+    }
+  }
+  evict(now_sec());
+}
+}  // namespace
+
+void mme_app_auth_vector_cache_init(
+    uint32_t max_ues_p, uint32_t ttl_sec_p, bool persist_state) {
+  std::lock_guard<std::mutex> lock(cache_mutex);
+  max_ues = max_ues_p;
+  ttl_sec = ttl_sec_p;
+  cache.clear();
+  expiry_order.clear();
+  dirty.clear();
+  if (max_ues == 0) {
+    return;
+  }
+  if (persist_state) {
+    redis_client = std::make_unique<RedisClient>(true);
+    restore_cache();
+  }
+  OAILOG_INFO(
+      LOG_MME_APP,
+      "Caching the auth vectors of up to %u UEs for %u s, %lu restored\n",
+      max_ues, ttl_sec, cache.size());
+}
+
+uint8_t mme_app_auth_vector_cache_vectors_per_air(void) {
+  return max_ues ? MAX_EPS_AUTH_VECTORS_PER_AIR : MAX_EPS_AUTH_VECTORS;
+}
+
+void mme_app_auth_vector_cache_put(
+    imsi64_t imsi64, const eutran_vector_t* vectors, int num_vectors) {
+  if (max_ues == 0 || imsi64 == INVALID_IMSI64) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(cache_mutex);
+  uint64_t now = now_sec();
+
+  // Older vectors have lower SQNs than the new ones, that are used first
+  auto it = cache.find(imsi64);
+  if (it != cache.end()) {
+    erase_entry(it);
+    if (num_vectors == 0) {
+      persist_entry(imsi64);
+    }
+  }
+  if (num_vectors > 0) {
+    std::vector<auth_vector_t> entry_vectors(num_vectors);
+    for (int i = 0; i < num_vectors; i++) {
+      auth_vector_t* vector = &entry_vectors[i];
+      memcpy(vector->kasme, vectors[i].kasme, AUTH_KASME_SIZE);
+      memcpy(vector->rand, vectors[i].rand, AUTH_RAND_SIZE);
+      memcpy(vector->autn, vectors[i].autn, AUTH_AUTN_SIZE);
+      vector->xres_size =
+          std::min<uint8_t>(vectors[i].xres.size, AUTH_XRES_SIZE);
+      memcpy(vector->xres, vectors[i].xres.data, vector->xres_size);
+    }
+    insert_entry(imsi64, std::move(entry_vectors), now + ttl_sec);
+    persist_entry(imsi64);
+  }
+  evict(now);
+}
+
+bool mme_app_auth_vector_cache_take(imsi64_t imsi64, auth_vector_t* vector) {
+  if (max_ues == 0 || imsi64 == INVALID_IMSI64) {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(cache_mutex);
+
+  evict(now_sec());
+  auto it = cache.find(imsi64);
+  if (it == cache.end()) {
+    increment_counter(AUTH_VECTOR_CACHE_METRIC, 1, 1, "result", "miss");
+    return false;
+  }
+  std::vector<auth_vector_t>& vectors = it->second.vectors;
+  *vector                             = vectors.front();
+  vectors.erase(vectors.begin());
+  if (vectors.empty()) {
+    erase_entry(it);
+  }
+  persist_entry(imsi64);
+  increment_counter(AUTH_VECTOR_CACHE_METRIC, 1, 1, "result", "hit");
+  OAILOG_DEBUG_UE(LOG_MME_APP, imsi64, "Took a cached auth vector\n");
+  return true;
+}
+
+void mme_app_auth_vector_cache_remove(imsi64_t imsi64) {
+  if (max_ues == 0) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(cache_mutex);
+  auto it = cache.find(imsi64);
+  if (it != cache.end()) {
+    erase_entry(it);
+    persist_entry(imsi64);
+  }
+}
+
+void mme_app_auth_vector_cache_flush(void) {
+  if (!redis_client) {
+    return;
+  }
+  std::lock_guard<std::mutex> flush_lock(flush_mutex);
+  // Taken under the cache lock, written to redis outside of it
+  std::vector<std::pair<imsi64_t, std::unique_ptr<CacheEntry>>> entries;
+  {
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    for (imsi64_t imsi64 : dirty) {
+      auto it = cache.find(imsi64);
+      entries.emplace_back(
+          imsi64, it == cache.end() ? nullptr :
+                                      std::make_unique<CacheEntry>(it->second));
+    }
+    dirty.clear();
+  }
+  for (const auto& entry : entries) {
+    write_entry(entry.first, entry.second.get());
+  }
+}
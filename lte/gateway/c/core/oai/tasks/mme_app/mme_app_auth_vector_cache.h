@@ -0,0 +1,79 @@
+/*
+Copyright 2020 The Magma Authors.
+
+This source code is licensed under the BSD-style license found in the
+LICENSE file in the root directory of this source tree.
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+/*! \file mme_app_auth_vector_cache.h
+  \brief Authentication vectors kept by IMSI across UE contexts.
+  When the cache is enabled, MAX_EPS_AUTH_VECTORS_PER_AIR vectors are
+  requested per S6a AIR: the first ones go to the authentication procedure
+  as before, the spare ones are cached for the IMSI, outliving its UE context.
+  When the MME state is persisted, changed entries are written to redis along
+  with the UE state, outside of the cache lock. The next authentication of
+  the IMSI takes the oldest cached vector instead of sending an AIR.
+  A vector leaves the cache once taken, and the vectors of an IMSI are
+  replaced by each new AIA, so that the SQNs the UE sees keep increasing.
+  The vectors of an IMSI are dropped on synchronisation or MAC failure and
+  expire after a while. The cache is shared by the MME_APP shards.
+*/
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "common_types.h"
+#include "nas/securityDef.h"
+
+/**
+ * Keep the vectors of up to max_ues IMSIs for ttl_sec seconds, none if
+ * max_ues is 0, and restore the cache from redis when persist_state is set.
+ * Called once before the MME_APP task starts.
+ */
+void mme_app_auth_vector_cache_init(
+    uint32_t max_ues, uint32_t ttl_sec, bool persist_state);
+
+/**
+ * @return the number of vectors to request in an S6a AIR
+ */
+uint8_t mme_app_auth_vector_cache_vectors_per_air(void);
+
+/**
+ * Replace the cached vectors of an IMSI by the spare vectors of an AIA,
+ * dropping them if num_vectors is 0
+ */
+void mme_app_auth_vector_cache_put(
+    imsi64_t imsi64, const eutran_vector_t* vectors, int num_vectors);
+
+/**
+ * Take the oldest cached vector of an IMSI, counted as a hit or a miss
+ * @return false if none is cached
+ */
+bool mme_app_auth_vector_cache_take(imsi64_t imsi64, auth_vector_t* vector);
+
+/**
+ * Drop the cached vectors of an IMSI
+ */
+void mme_app_auth_vector_cache_remove(imsi64_t imsi64);
+
+/**
+ * Write the entries changed since the last flush to redis, if the MME state
+ * is persisted. Called with the UE state writes.
+ */
+void mme_app_auth_vector_cache_flush(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -75,6 +75,7 @@
 #include "mme_app_timer.h"
 #include "mme_app_pdn_context.h"
 #include "mme_app_ip_imsi.h"
+#include "nas_proc_span.h"
 
 #if EMBEDDED_SGW
 #define TASK_SPGW TASK_SPGW_APP
@@ -508,6 +509,7 @@ void mme_app_handle_conn_est_cnf(
 
   message_p->ittiMsgHeader.imsi = ue_context_p->emm_context._imsi64;
   send_msg_to_task(&mme_app_task_zmq_ctx, TASK_S1AP, message_p);
+  nas_proc_span_leg_begin(&ue_context_p->emm_context, NAS_PROC_LEG_ICS);
 
   /*
    * Move the UE to ECM Connected State.However if S1-U bearer establishment
@@ -1061,6 +1063,8 @@ status_code_e mme_app_handle_create_sess_resp(
       ", cause = %d\n",
       ue_context_p->mme_ue_s1ap_id, create_sess_resp_pP->teid,
       create_sess_resp_pP->cause.cause_value);
+  nas_proc_span_leg_end(
+      &ue_context_p->emm_context, NAS_PROC_LEG_CREATE_SESSION);
 
   proc_tid_t transaction_identifier = 0;
   pdn_cid_t pdn_cx_id               = 0;
@@ -1618,6 +1622,7 @@ void mme_app_handle_initial_context_setup_rsp(
     ue_context_p->initial_context_setup_rsp_timer.id =
         MME_APP_TIMER_INACTIVE_ID;
     ue_context_p->time_ics_rsp_timer_started = 0;
+    nas_proc_span_leg_end(&ue_context_p->emm_context, NAS_PROC_LEG_ICS);
 
     if (mme_app_send_modify_bearer_request_for_active_pdns(
             ue_context_p, initial_ctxt_setup_rsp_p) != RETURNok) {
@@ -2191,12 +2196,18 @@ void mme_app_send_paging_request(
     mme_ue_context_dump_coll_keys(&mme_app_desc_p->mme_ue_contexts);
     OAILOG_FUNC_OUT(LOG_MME_APP);
   }
-  if (!(ue_context_p->paging_retx_count)) {
-    if (mme_app_paging_request_helper(
-            ue_context_p, true, true /* s-tmsi */, CN_DOMAIN_PS) != RETURNok) {
-      OAILOG_ERROR_UE(
-          LOG_MME_APP, imsi64, "Failed to send paging request to S1AP \n");
-    }
+  if (ue_context_p->paging_retx_count) {
+    // Already being paged, the paging timer retransmits
+    increment_counter("mme_paging", 1, 1, "result", "deduped");
+    OAILOG_FUNC_OUT(LOG_MME_APP);
+  }
+  if (mme_app_paging_request_helper(
+          ue_context_p, true, true /* s-tmsi */, CN_DOMAIN_PS) != RETURNok) {
+    OAILOG_ERROR_UE(
+        LOG_MME_APP, imsi64, "Failed to send paging request to S1AP \n");
+    increment_counter("mme_paging", 1, 1, "result", "failed");
+  } else {
+    increment_counter("mme_paging", 1, 1, "result", "paged");
   }
   OAILOG_FUNC_OUT(LOG_MME_APP);
 }
@@ -2213,25 +2224,31 @@ imsi64_t mme_app_handle_initial_paging_request(
     mme_app_send_paging_request(mme_app_desc_p, imsi64);
     OAILOG_FUNC_RETURN(LOG_MME_APP, RETURNok);
   }
-  imsi64_t* imsi_list = NULL;
+  imsi64_t imsi_list[MME_APP_MAX_IMSIS_PER_UE_IP];
   OAILOG_DEBUG(
       LOG_MME_APP, "paging is requested for ue_ip:%x \n",
       paging_req->ipv4_addr.s_addr);
-  int num_imsis =
-      mme_app_get_imsi_from_ipv4(paging_req->ipv4_addr.s_addr, &imsi_list);
+  int num_imsis = mme_app_get_imsi_from_ipv4(
+      paging_req->ipv4_addr.s_addr, imsi_list, MME_APP_MAX_IMSIS_PER_UE_IP);
   if (!(num_imsis)) {
     OAILOG_ERROR(
         LOG_MME_APP, "Failed to fetch imsi from ue_ip:%x \n",
         paging_req->ipv4_addr.s_addr);
+    increment_counter("mme_paging", 1, 1, "result", "unknown_ue_ip");
     OAILOG_FUNC_RETURN(LOG_MME_APP, RETURNerror);
   }
+  if (num_imsis > MME_APP_MAX_IMSIS_PER_UE_IP) {
+    OAILOG_WARNING(
+        LOG_MME_APP, "Paging only %d of the %d imsis of ue_ip:%x \n",
+        MME_APP_MAX_IMSIS_PER_UE_IP, num_imsis, paging_req->ipv4_addr.s_addr);
+    num_imsis = MME_APP_MAX_IMSIS_PER_UE_IP;
+  }
   for (int idx = 0; idx < num_imsis; idx++) {
     if (imsi_list[idx] != INVALID_IMSI64) {
       imsi64 = imsi_list[idx];
       mme_app_send_paging_request(mme_app_desc_p, imsi64);
     }
   }
-  free_wrapper((void**) &imsi_list);
   OAILOG_FUNC_RETURN(LOG_MME_APP, RETURNok);
 }
 
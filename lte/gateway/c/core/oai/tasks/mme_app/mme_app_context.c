@@ -50,6 +50,7 @@
 #include "mme_app_defs.h"
 #include "mme_app_itti_messaging.h"
 #include "mme_app_procedures.h"
+#include "mme_app_ue_context_pool.h"
 #include "nas_proc.h"
 #include "common_defs.h"
 #include "esm_ebr.h"
@@ -124,7 +125,7 @@ static void mme_app_handle_timer_for_unregistered_ue(
 //------------------------------------------------------------------------------
 // warning: lock the UE context
 ue_mm_context_t* mme_create_new_ue_context(void) {
-  ue_mm_context_t* new_p = calloc(1, sizeof(ue_mm_context_t));
+  ue_mm_context_t* new_p = mme_app_ue_context_pool_alloc();
   if (!new_p) {
     OAILOG_ERROR(LOG_MME_APP, "Failed to allocate memory for UE context \n");
     return NULL;
@@ -269,7 +270,7 @@ void mme_app_state_free_ue_context(void** ue_context_node) {
   emm_context_t* emm_ctx = &ue_context_p->emm_context;
   free_emm_ctx_memory(emm_ctx, ue_context_p->mme_ue_s1ap_id);
   mme_app_ue_context_free_content(ue_context_p);
-  free_wrapper((void**) &ue_context_p);
+  mme_app_ue_context_pool_free(ue_context_p);
   OAILOG_FUNC_OUT(LOG_MME_APP);
 }
 
@@ -292,11 +293,17 @@ ue_mm_context_t* mme_ue_context_exists_enb_ue_s1ap_id(
 //------------------------------------------------------------------------------
 ue_mm_context_t* mme_ue_context_exists_mme_ue_s1ap_id(
     const mme_ue_s1ap_id_t mme_ue_s1ap_id) {
-  struct ue_mm_context_s* ue_context_p = NULL;
-  hash_table_ts_t* state_imsi_ht       = get_mme_ue_state();
+  struct ue_mm_context_s* ue_context_p =
+      mme_app_ue_context_pool_get_by_ue_id(mme_ue_s1ap_id);
 
-  hashtable_ts_get(
-      state_imsi_ht, (const hash_key_t) mme_ue_s1ap_id, (void**) &ue_context_p);
+  if (!ue_context_p) {
+    // Not indexed yet or evicted by a colliding id
+    hash_table_ts_t* state_imsi_ht = get_mme_ue_state();
+    hashtable_ts_get(
+        state_imsi_ht, (const hash_key_t) mme_ue_s1ap_id,
+        (void**) &ue_context_p);
+    mme_app_ue_context_pool_bind_ue_id(ue_context_p, mme_ue_s1ap_id);
+  }
   if (ue_context_p) {
     OAILOG_TRACE(
         LOG_MME_APP,
@@ -456,6 +463,7 @@ void mme_ue_context_update_coll_keys(
       h_rc = hashtable_ts_insert(
           mme_state_ue_id_ht, (const hash_key_t) mme_ue_s1ap_id,
           (void*) ue_context_p);
+      mme_app_ue_context_pool_bind_ue_id(ue_context_p, mme_ue_s1ap_id);
 
       if (HASH_TABLE_OK != h_rc) {
         OAILOG_ERROR_UE(
@@ -663,6 +671,8 @@ status_code_e mme_insert_ue_context(
           ue_context_p, ue_context_p->mme_ue_s1ap_id);
       OAILOG_FUNC_RETURN(LOG_MME_APP, RETURNerror);
     }
+    mme_app_ue_context_pool_bind_ue_id(
+        ue_context_p, ue_context_p->mme_ue_s1ap_id);
 
     // filled IMSI
     if (ue_context_p->emm_context._imsi64) {
@@ -834,7 +844,7 @@ void mme_remove_ue_context(
           ue_context_p->enb_ue_s1ap_id, ue_context_p->mme_ue_s1ap_id);
   }
 
-  free_wrapper((void**) &ue_context_p);
+  mme_app_ue_context_pool_free(ue_context_p);
   OAILOG_FUNC_OUT(LOG_MME_APP);
 }
 
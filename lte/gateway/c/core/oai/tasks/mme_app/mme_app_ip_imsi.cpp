@@ -11,28 +11,33 @@ See the License for the specific language governing permissions and
 limitations under the License.
 */
 
-#include <bits/stdc++.h>
+#include <algorithm>
+#include <mutex>
 #include <unordered_map>
-#include <iostream>
+#include <vector>
 #include "mme_app_ip_imsi.h"
-using namespace std;
-typedef unordered_map<string, vector<uint64_t>> Ipv4Map;
 
-Ipv4Map ipv4map;
+// UE ipv4 address, in network byte order -> imsis sharing the address
+typedef std::unordered_map<uint32_t, std::vector<imsi64_t>> Ipv4Map;
+
+static Ipv4Map ipv4map;
+// Updated by the MME_APP shards
+static std::mutex ipv4map_mutex;
 
 void initialize_ipv4_map() {
   OAILOG_FUNC_IN(LOG_MME_APP);
+  std::lock_guard<std::mutex> lock(ipv4map_mutex);
   ipv4map = Ipv4Map{};
   OAILOG_FUNC_OUT(LOG_MME_APP);
 }
 
 void mme_app_log_ipv4_imsi_map() {
   OAILOG_FUNC_IN(LOG_MME_APP);
-  for (auto itr = ipv4map.begin(); itr != ipv4map.end(); ++itr) {
-    for (auto it_vec = itr->second.begin(); it_vec != itr->second.end();
-         ++it_vec) {
+  std::lock_guard<std::mutex> lock(ipv4map_mutex);
+  for (const auto& entry : ipv4map) {
+    for (const auto imsi64 : entry.second) {
       OAILOG_TRACE(
-          LOG_MME_APP, "ue_ip: %s \t imsi:%lu \n", itr->first.c_str(), *it_vec);
+          LOG_MME_APP, "ue_ip: %x \t imsi:%lu \n", entry.first, imsi64);
     }
     OAILOG_TRACE(LOG_MME_APP, "\n");
   }
@@ -46,76 +51,65 @@ void mme_app_log_ipv4_imsi_map() {
  */
 int mme_app_insert_ue_ipv4_addr(uint32_t ipv4_addr, imsi64_t imsi64) {
   OAILOG_FUNC_IN(LOG_MME_APP);
-  char ipv4[INET_ADDRSTRLEN] = {0};
-  inet_ntop(AF_INET, (void*) &ipv4_addr, ipv4, INET_ADDRSTRLEN);
-  auto itr = ipv4map.find(ipv4);
-  if (itr == ipv4map.end()) {
-    vector<uint64_t> vec = {imsi64};
-    ipv4map[ipv4]        = vec;
+  std::lock_guard<std::mutex> lock(ipv4map_mutex);
+  auto& imsis = ipv4map[ipv4_addr];
+  if (imsis.empty()) {
     OAILOG_DEBUG_UE(LOG_MME_APP, imsi64, "Inserting ue_ip:%x \n", ipv4_addr);
   } else {
     OAILOG_DEBUG_UE(
         LOG_MME_APP, imsi64, "Inserting imsi for existing ue_ip:%x \n",
         ipv4_addr);
-    ipv4map[ipv4].push_back(imsi64);
   }
+  imsis.push_back(imsi64);
   OAILOG_FUNC_RETURN(LOG_MME_APP, RETURNok);
 }
 
-/* Description: The function shall provide list of imsis allocated for
- * ue ip address; Imsi list is dynamically created and filled with imsis
- * The caller of function needs to free the memory allocated for imsi list
+/* Description: The function shall provide the imsis allocated the ue ip
+ * address, copying up to max_imsis of them in imsi_list, and return how many
+ * imsis have the address
  */
-int mme_app_get_imsi_from_ipv4(uint32_t ipv4_addr, imsi64_t** imsi_list) {
+int mme_app_get_imsi_from_ipv4(
+    uint32_t ipv4_addr, imsi64_t* imsi_list, int max_imsis) {
   OAILOG_FUNC_IN(LOG_MME_APP);
-  int num_imsis              = 0;
-  char ipv4[INET_ADDRSTRLEN] = {0};
-  inet_ntop(AF_INET, (void*) &ipv4_addr, ipv4, INET_ADDRSTRLEN);
-  auto itr = ipv4map.find(ipv4);
+  std::lock_guard<std::mutex> lock(ipv4map_mutex);
+  auto itr = ipv4map.find(ipv4_addr);
   if (itr == ipv4map.end()) {
     OAILOG_ERROR(LOG_MME_APP, " No imsi found for ip:%x \n", ipv4_addr);
-  } else {
-    uint8_t idx  = 0;
-    num_imsis    = itr->second.size();
-    (*imsi_list) = (imsi64_t*) calloc(num_imsis, sizeof(imsi64_t));
-
-    for (auto vect_itr = itr->second.begin(); vect_itr != itr->second.end();
-         vect_itr++) {
-      (*imsi_list)[idx++] = *vect_itr;
-      OAILOG_DEBUG_UE(
-          LOG_MME_APP, *vect_itr, " Found imsi for ip:%x \n", ipv4_addr);
-    }
+    OAILOG_FUNC_RETURN(LOG_MME_APP, 0);
+  }
+  int num_imsis = itr->second.size();
+  for (int idx = 0; idx < num_imsis && idx < max_imsis; idx++) {
+    imsi_list[idx] = itr->second[idx];
+    OAILOG_DEBUG_UE(
+        LOG_MME_APP, imsi_list[idx], " Found imsi for ip:%x \n", ipv4_addr);
   }
   OAILOG_FUNC_RETURN(LOG_MME_APP, num_imsis);
 }
 
 void mme_app_remove_ue_ipv4_addr(uint32_t ipv4_addr, imsi64_t imsi64) {
   OAILOG_FUNC_IN(LOG_MME_APP);
-  char ipv4[INET_ADDRSTRLEN] = {0};
-  inet_ntop(AF_INET, (void*) &ipv4_addr, ipv4, INET_ADDRSTRLEN);
-  auto itr = ipv4map.find(ipv4);
+  std::lock_guard<std::mutex> lock(ipv4map_mutex);
+  auto itr = ipv4map.find(ipv4_addr);
   if (itr == ipv4map.end()) {
     OAILOG_ERROR_UE(
         LOG_MME_APP, imsi64, "No imsi found for ip:%x \n", ipv4_addr);
     OAILOG_FUNC_OUT(LOG_MME_APP);
-  } else {
-    auto vec_it = itr->second.begin();
-    for (; vec_it != itr->second.end(); ++vec_it) {
-      if (*vec_it == imsi64) {
-        OAILOG_DEBUG_UE(
-            LOG_MME_APP, imsi64, "Deleted ue ipv4:%x from ipv4_imsi map \n",
-            ipv4_addr);
-        itr->second.erase(vec_it);
-        vec_it--;
-        break;
-      }
-    }
-    if (vec_it == itr->second.end()) {
-      OAILOG_ERROR(
-          LOG_MME_APP,
-          "Failed to remove an entry for ue_ip:%x from ipv4_imsi map \n",
-          ipv4_addr);
-    }
   }
+  auto& imsis = itr->second;
+  auto vec_it = std::find(imsis.begin(), imsis.end(), imsi64);
+  if (vec_it == imsis.end()) {
+    OAILOG_ERROR(
+        LOG_MME_APP,
+        "Failed to remove an entry for ue_ip:%x from ipv4_imsi map \n",
+        ipv4_addr);
+    OAILOG_FUNC_OUT(LOG_MME_APP);
+  }
+  imsis.erase(vec_it);
+  if (imsis.empty()) {
+    ipv4map.erase(itr);
+  }
+  OAILOG_DEBUG_UE(
+      LOG_MME_APP, imsi64, "Deleted ue ipv4:%x from ipv4_imsi map \n",
+      ipv4_addr);
   OAILOG_FUNC_OUT(LOG_MME_APP);
 }
@@ -22,7 +22,10 @@ extern "C" {
 #include "common_types.h"
 void initialize_ipv4_map(void);
 int mme_app_insert_ue_ipv4_addr(uint32_t ipv4_addr, imsi64_t imsi64);
-int mme_app_get_imsi_from_ipv4(uint32_t ipv4_addr, imsi64_t** imsi_list);
+// Upper bound of the imsis sharing an ue ip address that are paged
+#define MME_APP_MAX_IMSIS_PER_UE_IP 8
+int mme_app_get_imsi_from_ipv4(
+    uint32_t ipv4_addr, imsi64_t* imsi_list, int max_imsis);
 void mme_app_remove_ue_ipv4_addr(uint32_t ipv4_addr, imsi64_t imsi64);
 #ifdef __cplusplus
 }
@@ -49,6 +49,8 @@
 #include "mme_app_desc.h"
 #include "s11_messages_types.h"
 #include "common_utility_funs.h"
+#include "nas_proc_span.h"
+#include "mem_arena.h"
 
 #if EMBEDDED_SGW
 #define TASK_SPGW TASK_SPGW_APP
@@ -391,6 +393,8 @@ status_code_e mme_app_send_s11_create_session_req(
       (ue_mm_context->emm_context.originating_tai.plmn));
 
   session_request_p->selection_mode = MS_O_N_P_APN_S_V;
+  nas_proc_span_leg_begin(
+      &ue_mm_context->emm_context, NAS_PROC_LEG_CREATE_SESSION);
   int mode =
       match_fed_mode_map((char*) session_request_p->imsi.digit, LOG_MME_APP);
   if (mode == S8_SUBSCRIBER) {
@@ -493,8 +497,9 @@ void nas_itti_sgsap_uplink_unitdata(
   memcpy(SGSAP_UPLINK_UNITDATA(message_p).imsi, imsi, imsi_len);
   SGSAP_UPLINK_UNITDATA(message_p).imsi[imsi_len]    = '\0';
   SGSAP_UPLINK_UNITDATA(message_p).imsi_length       = imsi_len;
-  SGSAP_UPLINK_UNITDATA(message_p).nas_msg_container = nas_msg;
-  nas_msg                                            = NULL;
+  SGSAP_UPLINK_UNITDATA(message_p).nas_msg_container =
+      mem_arena_bstr_persist(nas_msg);
+  nas_msg = NULL;
   /*
    * optional - UE Time Zone
    * update the ue time zone presence bitmask
@@ -56,6 +56,7 @@
 #include "emm_proc.h"
 #include "mme_app_timer.h"
 #include "dynamic_memory_check.h"
+#include "nas_proc_span.h"
 
 //------------------------------------------------------------------------------
 status_code_e mme_app_send_s6a_update_location_req(
@@ -144,6 +145,7 @@ status_code_e mme_app_send_s6a_update_location_req(
       "0 S6A_UPDATE_LOCATION_REQ imsi %s with length %d for (ue_id = %u)\n",
       s6a_ulr_p->imsi, s6a_ulr_p->imsi_length, ue_context_p->mme_ue_s1ap_id);
   rc = send_msg_to_task(&mme_app_task_zmq_ctx, TASK_S6A, message_p);
+  nas_proc_span_leg_begin(&ue_context_p->emm_context, NAS_PROC_LEG_S6A_ULR);
   /*
    * Do not start this timer in case we are sending ULR after receiving HSS
    * reset
@@ -221,6 +223,7 @@ status_code_e mme_app_handle_s6a_update_location_ans(
         imsi64);
     OAILOG_FUNC_RETURN(LOG_MME_APP, RETURNerror);
   }
+  nas_proc_span_leg_end(&ue_mm_context->emm_context, NAS_PROC_LEG_S6A_ULR);
   if (ula_pP->result.present == S6A_RESULT_BASE) {
     if (ula_pP->result.choice.base != DIAMETER_SUCCESS) {
       /*
@@ -28,10 +28,12 @@
 #include <stdint.h>
 #include <pthread.h>
 
+#include "assertions.h"
 #include "bstrlib.h"
 #include "log.h"
 #include "intertask_interface.h"
 #include "itti_free_defined_msg.h"
+#include "mem_arena.h"
 #include "mme_config.h"
 #include "nas_network.h"
 #include "timer.h"
@@ -39,6 +41,8 @@
 #include "mme_app_ue_context.h"
 #include "mme_app_defs.h"
 #include "mme_app_ha.h"
+#include "mme_app_overload.h"
+#include "mme_app_shard.h"
 #include "mme_app_statistics.h"
 #include "service303_message_utils.h"
 #include "common_defs.h"
@@ -60,26 +64,18 @@ static void start_stats_timer(void);
 bool mme_hss_associated = false;
 bool mme_sctp_bounded   = false;
 task_zmq_ctx_t mme_app_task_zmq_ctx;
-bool mme_congestion_control_enabled = true;
-long mme_app_last_msg_latency;
-long pre_mme_task_msg_latency;
 static long epc_stats_timer_id;
+static uint32_t mme_app_shards = MME_APP_SHARDS;
 
-mme_congestion_params_t mme_congestion_params;
-
-static int handle_message(zloop_t* loop, zsock_t* reader, void* arg) {
-  MessageDef* received_message_p = receive_msg(reader);
+// Called by the shard of the UE of the message, by the MME_APP thread when
+// not sharded
+static void mme_app_handle_message(MessageDef* received_message_p) {
   imsi64_t imsi64                = itti_get_associated_imsi(received_message_p);
   mme_app_desc_t* mme_app_desc_p = get_mme_nas_state(false);
 
   bool is_task_state_same = false;
 
-  mme_app_last_msg_latency =
-      ITTI_MSG_LATENCY(received_message_p);  // microseconds
-  pre_mme_task_msg_latency = ITTI_MSG_LASTHOP_LATENCY(received_message_p);
-
-  OAILOG_DEBUG(
-      LOG_MME_APP, "MME APP ZMQ latency: %ld.", mme_app_last_msg_latency);
+  mme_overload_observe(TASK_MME_APP, ITTI_MSG_LATENCY(received_message_p));
 
   switch (ITTI_MSG_ID(received_message_p)) {
     case MESSAGE_TEST: {
@@ -103,11 +99,14 @@ static int handle_message(zloop_t* loop, zsock_t* reader, void* arg) {
     } break;
 
     case MME_APP_UPLINK_DATA_IND: {
+      // NAS scratch copies of the PDU share the arena of the message
+      mem_arena_set_current(itti_get_msg_arena(received_message_p));
       nas_proc_ul_transfer_ind(
           MME_APP_UL_DATA_IND(received_message_p).ue_id,
           MME_APP_UL_DATA_IND(received_message_p).tai,
           MME_APP_UL_DATA_IND(received_message_p).cgi,
           &MME_APP_UL_DATA_IND(received_message_p).nas_msg);
+      mem_arena_set_current(NULL);
       is_task_state_same = true;
     } break;
 
@@ -216,8 +215,11 @@ static int handle_message(zloop_t* loop, zsock_t* reader, void* arg) {
     } break;
 
     case S1AP_INITIAL_UE_MESSAGE: {
+      // The initial NAS message is decoded on the arena of the message
+      mem_arena_set_current(itti_get_msg_arena(received_message_p));
       imsi64 = mme_app_handle_initial_ue_message(
           mme_app_desc_p, &S1AP_INITIAL_UE_MESSAGE(received_message_p));
+      mem_arena_set_current(NULL);
     } break;
 
     case S6A_UPDATE_LOCATION_ANS: {
@@ -239,6 +241,16 @@ static int handle_message(zloop_t* loop, zsock_t* reader, void* arg) {
 
     case S11_PAGING_REQUEST: {
       OAILOG_DEBUG(LOG_MME_APP, "MME handling paging request \n");
+      if (ITTI_MSG_ORIGIN_ID(received_message_p) == TASK_HA) {
+        // Checked and cleared upon connection re-establishment to send the
+        // offload request
+        ue_mm_context_t* ue_context_p = mme_ue_context_exists_imsi(
+            &mme_app_desc_p->mme_ue_contexts,
+            received_message_p->ittiMsgHeader.imsi);
+        if (ue_context_p) {
+          ue_context_p->ue_context_rel_cause = S1AP_NAS_MME_PENDING_OFFLOADING;
+        }
+      }
       imsi64 = mme_app_handle_initial_paging_request(
           mme_app_desc_p, &received_message_p->ittiMsg.s11_paging_request);
     } break;
@@ -478,12 +490,6 @@ static int handle_message(zloop_t* loop, zsock_t* reader, void* arg) {
           mme_app_desc_p, &S1AP_REMOVE_STALE_UE_CONTEXT(received_message_p));
     } break;
 
-    case TERMINATE_MESSAGE: {
-      itti_free_msg_content(received_message_p);
-      free(received_message_p);
-      mme_app_exit();
-    } break;
-
     case RECOVERY_MESSAGE: {
       OAILOG_INFO(LOG_MME_APP, "Received RECOVERY_MESSAGE \n");
       mme_app_recover_timers_for_all_ues();
@@ -499,11 +505,25 @@ static int handle_message(zloop_t* loop, zsock_t* reader, void* arg) {
   put_mme_ue_state(mme_app_desc_p, imsi64);
 
   if (!is_task_state_same) {
-    put_mme_nas_state();
+    // The MME state covers every UE, other shards are not to update it
+    // while it is serialized. They run again while it is written.
+    mme_app_shard_run_exclusive(snapshot_mme_nas_state);
+    mme_app_shard_run_unlocked(put_mme_nas_state);
   }
 
   itti_free_msg_content(received_message_p);
   free(received_message_p);
+}
+
+static int handle_message(zloop_t* loop, zsock_t* reader, void* arg) {
+  MessageDef* received_message_p = receive_msg(reader);
+
+  if (ITTI_MSG_ID(received_message_p) == TERMINATE_MESSAGE) {
+    itti_free_msg_content(received_message_p);
+    free(received_message_p);
+    mme_app_exit();
+  }
+  mme_app_shard_dispatch(received_message_p);
   return 0;
 }
 
@@ -515,6 +535,9 @@ static void* mme_app_thread(__attribute__((unused)) void* args) {
       (task_id_t[]){TASK_SPGW_APP, TASK_SGS, TASK_SMS_ORC8R, TASK_S11, TASK_S6A,
                     TASK_S1AP, TASK_SERVICE303, TASK_HA, TASK_SGW_S8},
       9, handle_message, &mme_app_task_zmq_ctx);
+  AssertFatal(
+      mme_app_shard_init(mme_app_shards, mme_app_handle_message) == RETURNok,
+      "Failed to start the MME_APP shards\n");
 
   // Service started, but not healthy yet
   send_app_health_to_service303(&mme_app_task_zmq_ctx, TASK_MME_APP, false);
@@ -525,17 +548,6 @@ static void* mme_app_thread(__attribute__((unused)) void* args) {
   return NULL;
 }
 
-static void mme_app_init_congestion_params(const mme_config_t* mme_config_p) {
-  mme_congestion_params.mme_app_zmq_congest_th =
-      (long) mme_config_p->mme_app_zmq_congest_th;
-  mme_congestion_params.mme_app_zmq_auth_th =
-      (long) mme_config_p->mme_app_zmq_auth_th;
-  mme_congestion_params.mme_app_zmq_ident_th =
-      (long) mme_config_p->mme_app_zmq_ident_th;
-  mme_congestion_params.mme_app_zmq_smc_th =
-      (long) mme_config_p->mme_app_zmq_smc_th;
-}
-
 //------------------------------------------------------------------------------
 status_code_e mme_app_init(const mme_config_t* mme_config_p) {
   OAILOG_FUNC_IN(LOG_MME_APP);
@@ -549,9 +561,9 @@ status_code_e mme_app_init(const mme_config_t* mme_config_p) {
   // Initialise NAS module
   nas_network_initialize(mme_config_p);
 
-  // Initialize task global congestion parameters
-  mme_congestion_control_enabled = mme_config_p->enable_congestion_control;
-  mme_app_init_congestion_params(mme_config_p);
+  // Shared with S1AP, before either task starts
+  mme_overload_init(mme_config_p);
+  mme_app_shards = mme_config_p->mme_app_shards;
 
   /*
    * Create the thread associated with MME applicative layer
@@ -572,6 +584,7 @@ static int handle_stats_timer(zloop_t* loop, int id, void* arg) {
   stats_msg.nb_ue_connected        = mme_app_desc_p->nb_ue_connected;
   stats_msg.nb_default_eps_bearers = mme_app_desc_p->nb_default_eps_bearers;
   stats_msg.nb_s1u_bearers         = mme_app_desc_p->nb_s1u_bearers;
+  mme_app_shard_report_stats();
   return send_mme_app_stats_to_service303(
       &mme_app_task_zmq_ctx, TASK_MME_APP, &stats_msg);
 }
@@ -595,6 +608,7 @@ static bool is_mme_app_healthy(void) {
 //------------------------------------------------------------------------------
 static void mme_app_exit(void) {
   stop_timer(&mme_app_task_zmq_ctx, epc_stats_timer_id);
+  mme_app_shard_exit();
   mme_app_edns_exit();
   clear_mme_nas_state();
   // Clean-up NAS module
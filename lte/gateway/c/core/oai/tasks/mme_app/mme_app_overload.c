@@ -0,0 +1,198 @@
+/**
+ * Copyright 2020 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <pthread.h>
+#include <string.h>
+#include <time.h>
+
+#include "mme_app_overload.h"
+#include "log.h"
+#include "service303.h"
+
+// Weight of a new delay in the smoothed delay, 1/N
+#define SMOOTHED_DELAY_WEIGHT 8
+// Intervals without messages after which the queue of a task is empty. A
+// task busy draining a backlog may take about an interval per message.
+#define IDLE_INTERVALS 2
+
+typedef struct mme_overload_task_s {
+  pthread_mutex_t lock;
+  // End of the interval the delay has to stay above (below) target for the
+  // level to be raised (lowered), 0 while it is below (above) target
+  uint64_t above_target_deadline;
+  uint64_t below_target_deadline;
+  // Read by other threads
+  uint64_t last_observed;
+  long smoothed_delay;
+  mme_overload_level_t level;
+} mme_overload_task_t;
+
+static bool overload_enabled      = false;
+static long overload_target_delay = OVERLOAD_TARGET_DELAY;
+static uint64_t overload_interval = OVERLOAD_INTERVAL;
+static mme_overload_task_t s1ap_overload;
+static mme_overload_task_t mme_app_overload;
+
+static mme_overload_task_t* get_overload_task(task_id_t task_id) {
+  switch (task_id) {
+    case TASK_S1AP:
+      return &s1ap_overload;
+    case TASK_MME_APP:
+      return &mme_app_overload;
+    default:
+      return NULL;
+  }
+}
+
+static uint64_t monotonic_usec(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t) ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static mme_overload_level_t task_level_at(
+    mme_overload_task_t* task, uint64_t now) {
+  uint64_t last_observed =
+      __atomic_load_n(&task->last_observed, __ATOMIC_RELAXED);
+
+  // Without messages for a while, the queue of the task is empty
+  if (last_observed == 0 ||
+      now - last_observed >= IDLE_INTERVALS * overload_interval) {
+    return MME_OVERLOAD_NONE;
+  }
+  return __atomic_load_n(&task->level, __ATOMIC_RELAXED);
+}
+
+static void set_task_level(
+    task_id_t task_id, mme_overload_task_t* task, mme_overload_level_t level,
+    long delay_usec) {
+  OAILOG_WARNING(
+      LOG_MME_APP,
+      "%s overload level %s -> %s, queueing delay %ld us (smoothed %ld us)\n",
+      itti_get_task_name(task_id), mme_overload_level2str(task->level),
+      mme_overload_level2str(level), delay_usec, task->smoothed_delay);
+  __atomic_store_n(&task->level, level, __ATOMIC_RELAXED);
+}
+
+void mme_overload_init(const mme_config_t* mme_config_p) {
+  overload_enabled      = mme_config_p->enable_congestion_control;
+  overload_target_delay = mme_config_p->overload_target_delay;
+  overload_interval     = (uint64_t) mme_config_p->overload_interval;
+  memset(&s1ap_overload, 0, sizeof(s1ap_overload));
+  memset(&mme_app_overload, 0, sizeof(mme_app_overload));
+  pthread_mutex_init(&s1ap_overload.lock, NULL);
+  pthread_mutex_init(&mme_app_overload.lock, NULL);
+}
+
+void mme_overload_observe_at(
+    task_id_t task_id, uint64_t now_usec, long delay_usec) {
+  mme_overload_task_t* task = get_overload_task(task_id);
+
+  if (task == NULL) {
+    return;
+  }
+  pthread_mutex_lock(&task->lock);
+  if (task_level_at(task, now_usec) == MME_OVERLOAD_NONE &&
+      task->level != MME_OVERLOAD_NONE) {
+    // The task was idle, start over
+    task->above_target_deadline = 0;
+    task->below_target_deadline = 0;
+    set_task_level(task_id, task, MME_OVERLOAD_NONE, delay_usec);
+  }
+  __atomic_store_n(
+      &task->smoothed_delay,
+      task->smoothed_delay +
+          (delay_usec - task->smoothed_delay) / SMOOTHED_DELAY_WEIGHT,
+      __ATOMIC_RELAXED);
+
+  if (delay_usec < overload_target_delay) {
+    task->above_target_deadline = 0;
+    if (task->level > MME_OVERLOAD_NONE) {
+      if (task->below_target_deadline == 0) {
+        task->below_target_deadline = now_usec + overload_interval;
+      } else if (now_usec >= task->below_target_deadline) {
+        set_task_level(task_id, task, task->level - 1, delay_usec);
+        task->below_target_deadline = now_usec + overload_interval;
+      }
+    }
+  } else {
+    task->below_target_deadline = 0;
+    if (task->above_target_deadline == 0) {
+      task->above_target_deadline = now_usec + overload_interval;
+    } else if (now_usec >= task->above_target_deadline) {
+      // Shedding at the current level did not drain the queue
+      if (task->level < MME_OVERLOAD_MAX) {
+        set_task_level(task_id, task, task->level + 1, delay_usec);
+      }
+      task->above_target_deadline = now_usec + overload_interval;
+    }
+  }
+  __atomic_store_n(&task->last_observed, now_usec, __ATOMIC_RELAXED);
+  pthread_mutex_unlock(&task->lock);
+}
+
+void mme_overload_observe(task_id_t task_id, long delay_usec) {
+  if (overload_enabled) {
+    mme_overload_observe_at(task_id, monotonic_usec(), delay_usec);
+  }
+}
+
+mme_overload_level_t mme_overload_level_at(uint64_t now_usec) {
+  mme_overload_level_t level = task_level_at(&s1ap_overload, now_usec);
+  mme_overload_level_t mme_app_level =
+      task_level_at(&mme_app_overload, now_usec);
+
+  return level > mme_app_level ? level : mme_app_level;
+}
+
+mme_overload_level_t mme_overload_level(void) {
+  if (!overload_enabled) {
+    return MME_OVERLOAD_NONE;
+  }
+  return mme_overload_level_at(monotonic_usec());
+}
+
+long mme_overload_smoothed_delay(task_id_t task_id) {
+  mme_overload_task_t* task = get_overload_task(task_id);
+
+  if (task == NULL) {
+    return 0;
+  }
+  return __atomic_load_n(&task->smoothed_delay, __ATOMIC_RELAXED);
+}
+
+bool mme_overload_admit(mme_admission_class_t admission_class) {
+  static const char* const admission_class_str[] = {
+      "new", "ongoing", "priority"};
+  // Each class is shed from the level following its own value
+  if (mme_overload_level() <= (mme_overload_level_t) admission_class) {
+    return true;
+  }
+  increment_counter(
+      "mme_overload_rejected", 1, 1, "class",
+      admission_class_str[admission_class]);
+  return false;
+}
+
+const char* mme_overload_level2str(mme_overload_level_t level) {
+  switch (level) {
+    case MME_OVERLOAD_NONE:
+      return "NONE";
+    case MME_OVERLOAD_REJECT_NEW:
+      return "REJECT_NEW";
+    case MME_OVERLOAD_SHED_ONGOING:
+      return "SHED_ONGOING";
+    default:
+      return "UNKNOWN";
+  }
+}
@@ -0,0 +1,99 @@
+/**
+ * Copyright 2020 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*! \file mme_app_overload.h
+  \brief Overload control of the MME, driven by the task backlogs.
+  S1AP and MME_APP report the queueing delay of every message they receive.
+  As in CoDel, a task has a backlog once that delay stayed above a target
+  for a whole interval, a burst the queue drains within an interval being
+  harmless. The overload level is raised for each interval the backlog of
+  a task persists and lowered for each interval all its messages are below
+  target. Load is shed by priority: new sessions are rejected first, then
+  procedures in progress are dropped, detaches and mobile terminated or
+  emergency access are always admitted.
+  The state of a task is updated under its lock, the shards of MME_APP all
+  reporting their delays, and the level can be read from any thread.
+*/
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "intertask_interface_types.h"
+#include "mme_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+  MME_OVERLOAD_NONE = 0,
+  // Attaches and TAUs are rejected, eNBs reject new MO data sessions
+  MME_OVERLOAD_REJECT_NEW,
+  // Procedures in progress are dropped, eNBs reject MO signalling too
+  MME_OVERLOAD_SHED_ONGOING,
+  MME_OVERLOAD_MAX = MME_OVERLOAD_SHED_ONGOING,
+} mme_overload_level_t;
+
+typedef enum {
+  // Mobile originated Initial UE Messages, attach and TAU requests
+  MME_ADMISSION_NEW = 0,
+  // Messages continuing a procedure, e.g. Authentication Response
+  MME_ADMISSION_ONGOING,
+  // Detaches, releases, emergency and mobile terminated access
+  MME_ADMISSION_PRIORITY,
+} mme_admission_class_t;
+
+/**
+ * Set the target delay and interval, enable the controller if congestion
+ * control is enabled and clear the task states. Called once before the
+ * tasks start.
+ */
+void mme_overload_init(const mme_config_t* mme_config_p);
+
+/**
+ * Report the queueing delay of a message received by task_id, S1AP or
+ * MME_APP. Called by the threads of the task.
+ */
+void mme_overload_observe(task_id_t task_id, long delay_usec);
+
+/**
+ * @return the highest overload level of the tasks
+ */
+mme_overload_level_t mme_overload_level(void);
+
+/**
+ * @return the queueing delay of task_id smoothed over its last messages
+ */
+long mme_overload_smoothed_delay(task_id_t task_id);
+
+/**
+ * Tell whether a message of the given class is to be processed at the
+ * current overload level, counting the rejections.
+ */
+bool mme_overload_admit(mme_admission_class_t admission_class);
+
+/**
+ * Same as mme_overload_observe() and mme_overload_level() at a given time
+ * on CLOCK_MONOTONIC, in microseconds, for the unit tests.
+ */
+void mme_overload_observe_at(
+    task_id_t task_id, uint64_t now_usec, long delay_usec);
+mme_overload_level_t mme_overload_level_at(uint64_t now_usec);
+
+const char* mme_overload_level2str(mme_overload_level_t level);
+
+#ifdef __cplusplus
+}
+#endif
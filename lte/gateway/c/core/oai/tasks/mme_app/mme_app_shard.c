@@ -0,0 +1,439 @@
+/**
+ * Copyright 2020 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define _GNU_SOURCE
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "mme_app_shard.h"
+#include "3gpp_24.007.h"
+#include "3gpp_24.301.h"
+#include "common_types.h"
+#include "conversions.h"
+#include "log.h"
+#include "mme_app_defs.h"
+#include "mme_app_desc.h"
+#include "mme_app_state.h"
+#include "mme_config.h"
+#include "nas_message.h"
+#include "service303.h"
+
+typedef struct mme_app_shard_s {
+  uint32_t index;
+  pthread_t thread;
+  // Written by the MME_APP thread only
+  zsock_t* push_sock;
+  // Read by the shard thread only, once started
+  zsock_t* pull_sock;
+  task_zmq_ctx_t task_zmq_ctx;
+  // Dispatched but not handled yet
+  uint64_t queued;
+} mme_app_shard_t;
+
+static uint32_t num_shards = 1;
+static mme_app_shard_t* shards;
+static mme_app_shard_handler_t shard_handler;
+// Shared for UE local messages, exclusive for the others
+static pthread_rwlock_t shard_rwlock;
+static __thread mme_app_shard_t* current_shard;
+static __thread bool current_shard_exclusive;
+
+//------------------------------------------------------------------------------
+static int shard_handle_message(zloop_t* loop, zsock_t* reader, void* arg) {
+  mme_app_shard_t* shard = (mme_app_shard_t*) arg;
+  MessageDef* message_p  = NULL;
+  int exclusive          = 0;
+
+  if (zsock_recv(reader, "pi", &message_p, &exclusive) != 0) {
+    return 0;
+  }
+  // No message asks the shard to stop
+  if (!message_p) {
+    return -1;
+  }
+  mme_app_shard_lock(exclusive);
+  shard_handler(message_p);
+  mme_app_shard_unlock();
+  __atomic_fetch_sub(&shard->queued, 1, __ATOMIC_RELAXED);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+static void* shard_thread(void* arg) {
+  mme_app_shard_t* shard = (mme_app_shard_t*) arg;
+  char name[16];
+
+  snprintf(name, sizeof(name), "MME_APP_%u", shard->index);
+  pthread_setname_np(pthread_self(), name);
+  current_shard = shard;
+
+  zloop_t* loop = zloop_new();
+  shard->task_zmq_ctx.event_loop = loop;
+  zloop_reader(loop, shard->pull_sock, shard_handle_message, shard);
+  zloop_start(loop);
+  zloop_destroy(&loop);
+  return NULL;
+}
+
+//------------------------------------------------------------------------------
+int mme_app_shard_init(uint32_t count, mme_app_shard_handler_t handler) {
+  pthread_rwlockattr_t attr;
+
+  shard_handler = handler;
+  num_shards    = count > 0 ? count : 1;
+  if (num_shards == 1) {
+    return RETURNok;
+  }
+  // Exclusive messages would otherwise wait for the shards to be idle
+  pthread_rwlockattr_init(&attr);
+  pthread_rwlockattr_setkind_np(
+      &attr, PTHREAD_RWLOCK_PREFER_WRITER_NONRECURSIVE_NP);
+  pthread_rwlock_init(&shard_rwlock, &attr);
+  pthread_rwlockattr_destroy(&attr);
+
+  shards = calloc(num_shards, sizeof(mme_app_shard_t));
+  if (!shards) {
+    OAILOG_CRITICAL(LOG_MME_APP, "Failed to allocate the MME_APP shards\n");
+    num_shards = 1;
+    return RETURNerror;
+  }
+  for (uint32_t i = 0; i < num_shards; i++) {
+    mme_app_shard_t* shard      = &shards[i];
+    shard->index                = i;
+    shard->task_zmq_ctx.task_id = TASK_MME_APP;
+    shard->task_zmq_ctx.ready   = true;
+    shard->pull_sock = zsock_new_pull("@inproc://mme_app_shard_%u", i);
+    shard->push_sock = zsock_new_push(">inproc://mme_app_shard_%u", i);
+    if (!shard->pull_sock || !shard->push_sock ||
+        pthread_create(&shard->thread, NULL, shard_thread, shard)) {
+      OAILOG_CRITICAL(LOG_MME_APP, "Failed to start MME_APP shard %u\n", i);
+      return RETURNerror;
+    }
+  }
+  OAILOG_INFO(LOG_MME_APP, "Started %u MME_APP shards\n", num_shards);
+  return RETURNok;
+}
+
+//------------------------------------------------------------------------------
+void mme_app_shard_exit(void) {
+  if (!shards) {
+    return;
+  }
+  for (uint32_t i = 0; i < num_shards; i++) {
+    if (shards[i].push_sock) {
+      zsock_send(shards[i].push_sock, "pi", NULL, 0);
+    }
+  }
+  for (uint32_t i = 0; i < num_shards; i++) {
+    if (shards[i].thread) {
+      pthread_join(shards[i].thread, NULL);
+    }
+    zsock_destroy(&shards[i].push_sock);
+    zsock_destroy(&shards[i].pull_sock);
+  }
+  free(shards);
+  shards     = NULL;
+  num_shards = 1;
+  pthread_rwlock_destroy(&shard_rwlock);
+}
+
+//------------------------------------------------------------------------------
+uint32_t mme_app_shard_count(void) {
+  return num_shards;
+}
+
+//------------------------------------------------------------------------------
+bool mme_app_shard_nas_is_ue_local(const uint8_t* pdu, size_t length) {
+  if (length < 2) {
+    return false;
+  }
+  uint8_t security_header_type = pdu[0] >> 4;
+  switch (security_header_type) {
+    case SECURITY_HEADER_TYPE_NOT_PROTECTED:
+      break;
+    case SECURITY_HEADER_TYPE_INTEGRITY_PROTECTED:
+    case SECURITY_HEADER_TYPE_INTEGRITY_PROTECTED_NEW:
+      // The plain message follows the security header
+      if (length < NAS_MESSAGE_SECURITY_HEADER_SIZE + 2) {
+        return false;
+      }
+      pdu += NAS_MESSAGE_SECURITY_HEADER_SIZE;
+      break;
+    case SECURITY_HEADER_TYPE_INTEGRITY_PROTECTED_CYPHERED_NEW:
+      // Only used by the Security Mode Complete
+      return true;
+    default:
+      // A ciphered message may be any procedure
+      return false;
+  }
+  if ((pdu[0] & 0x0f) == EPS_SESSION_MANAGEMENT_MESSAGE) {
+    return true;
+  }
+  if ((pdu[0] & 0x0f) != EPS_MOBILITY_MANAGEMENT_MESSAGE) {
+    return false;
+  }
+  switch (pdu[1]) {
+    case AUTHENTICATION_RESPONSE:
+    case AUTHENTICATION_FAILURE:
+    case SECURITY_MODE_COMPLETE:
+    case SECURITY_MODE_REJECT:
+    case ATTACH_COMPLETE:
+    case TRACKING_AREA_UPDATE_COMPLETE:
+    case UPLINK_NAS_TRANSPORT:
+    case EMM_STATUS:
+      return true;
+    default:
+      // Attach, TAU, Detach and Identity Response look for other contexts
+      // of the UE
+      return false;
+  }
+}
+
+//------------------------------------------------------------------------------
+static bool is_ue_local(const MessageDef* message_p) {
+  switch (ITTI_MSG_ID(message_p)) {
+    case MME_APP_INITIAL_CONTEXT_SETUP_RSP:
+    case MME_APP_DOWNLINK_DATA_CNF:
+    case MME_APP_DOWNLINK_DATA_REJ:
+    case S1AP_UE_CAPABILITIES_IND:
+    case S1AP_E_RAB_SETUP_RSP:
+    case S6A_AUTH_INFO_ANS:
+    case S6A_UPDATE_LOCATION_ANS:
+    case S11_CREATE_SESSION_RESPONSE:
+    case S11_MODIFY_BEARER_RESPONSE:
+      return true;
+    case MME_APP_UPLINK_DATA_IND: {
+      const_bstring nas_msg = MME_APP_UL_DATA_IND(message_p).nas_msg;
+      return nas_msg &&
+             mme_app_shard_nas_is_ue_local(
+                 (const uint8_t*) nas_msg->data, blength(nas_msg));
+    }
+    default:
+      return false;
+  }
+}
+
+//------------------------------------------------------------------------------
+// Only reads the thread safe hash tables of the state, which messages
+// carrying their mme_ue_s1ap_id never reach
+static mme_ue_context_t* ue_contexts(void) {
+  return &get_mme_nas_state(false)->mme_ue_contexts;
+}
+
+//------------------------------------------------------------------------------
+static mme_ue_s1ap_id_t imsi_ue_id(imsi64_t imsi64) {
+  uint64_t ue_id = INVALID_MME_UE_S1AP_ID;
+
+  if (imsi64 == INVALID_IMSI64 ||
+      hashtable_uint64_ts_get(
+          ue_contexts()->imsi_mme_ue_id_htbl, (const hash_key_t) imsi64,
+          &ue_id) != HASH_TABLE_OK) {
+    return INVALID_MME_UE_S1AP_ID;
+  }
+  return (mme_ue_s1ap_id_t) ue_id;
+}
+
+//------------------------------------------------------------------------------
+static mme_ue_s1ap_id_t imsi_str_ue_id(const char* imsi_str) {
+  imsi64_t imsi64 = INVALID_IMSI64;
+
+  IMSI_STRING_TO_IMSI64(imsi_str, &imsi64);
+  return imsi_ue_id(imsi64);
+}
+
+//------------------------------------------------------------------------------
+static mme_ue_s1ap_id_t s11_teid_ue_id(teid_t teid) {
+  uint64_t ue_id = INVALID_MME_UE_S1AP_ID;
+
+  if (hashtable_uint64_ts_get(
+          ue_contexts()->tun11_ue_context_htbl, (const hash_key_t) teid,
+          &ue_id) != HASH_TABLE_OK) {
+    return INVALID_MME_UE_S1AP_ID;
+  }
+  return (mme_ue_s1ap_id_t) ue_id;
+}
+
+//------------------------------------------------------------------------------
+static mme_ue_s1ap_id_t message_ue_id(const MessageDef* message_p) {
+  switch (ITTI_MSG_ID(message_p)) {
+    case MME_APP_INITIAL_CONTEXT_SETUP_RSP:
+      return MME_APP_INITIAL_CONTEXT_SETUP_RSP(message_p).ue_id;
+    case MME_APP_INITIAL_CONTEXT_SETUP_FAILURE:
+      return MME_APP_INITIAL_CONTEXT_SETUP_FAILURE(message_p).mme_ue_s1ap_id;
+    case MME_APP_UPLINK_DATA_IND:
+      return MME_APP_UL_DATA_IND(message_p).ue_id;
+    case MME_APP_DOWNLINK_DATA_CNF:
+      return MME_APP_DL_DATA_CNF(message_p).ue_id;
+    case MME_APP_DOWNLINK_DATA_REJ:
+      return MME_APP_DL_DATA_REJ(message_p).ue_id;
+    case S1AP_UE_CAPABILITIES_IND:
+      return message_p->ittiMsg.s1ap_ue_cap_ind.mme_ue_s1ap_id;
+    case S1AP_UE_CONTEXT_RELEASE_REQ:
+      return S1AP_UE_CONTEXT_RELEASE_REQ(message_p).mme_ue_s1ap_id;
+    case S1AP_UE_CONTEXT_RELEASE_COMPLETE:
+      return S1AP_UE_CONTEXT_RELEASE_COMPLETE(message_p).mme_ue_s1ap_id;
+    case S1AP_UE_CONTEXT_MODIFICATION_RESPONSE:
+      return S1AP_UE_CONTEXT_MODIFICATION_RESPONSE(message_p).mme_ue_s1ap_id;
+    case S1AP_UE_CONTEXT_MODIFICATION_FAILURE:
+      return S1AP_UE_CONTEXT_MODIFICATION_FAILURE(message_p).mme_ue_s1ap_id;
+    case S1AP_E_RAB_SETUP_RSP:
+      return S1AP_E_RAB_SETUP_RSP(message_p).mme_ue_s1ap_id;
+    case S1AP_E_RAB_REL_RSP:
+      return S1AP_E_RAB_REL_RSP(message_p).mme_ue_s1ap_id;
+    case S1AP_E_RAB_MODIFICATION_IND:
+      return S1AP_E_RAB_MODIFICATION_IND(message_p).mme_ue_s1ap_id;
+    case S1AP_INITIAL_UE_MESSAGE:
+      return S1AP_INITIAL_UE_MESSAGE(message_p).mme_ue_s1ap_id;
+    case S1AP_PATH_SWITCH_REQUEST:
+      return S1AP_PATH_SWITCH_REQUEST(message_p).mme_ue_s1ap_id;
+    case S1AP_HANDOVER_REQUIRED:
+      return S1AP_HANDOVER_REQUIRED(message_p).mme_ue_s1ap_id;
+    case S1AP_HANDOVER_REQUEST_ACK:
+      return S1AP_HANDOVER_REQUEST_ACK(message_p).mme_ue_s1ap_id;
+    case S1AP_HANDOVER_NOTIFY:
+      return S1AP_HANDOVER_NOTIFY(message_p).mme_ue_s1ap_id;
+    case S6A_AUTH_INFO_ANS:
+      return imsi_str_ue_id(S6A_AUTH_INFO_ANS(message_p).imsi);
+    case S6A_UPDATE_LOCATION_ANS:
+      return imsi_str_ue_id(S6A_UPDATE_LOCATION_ANS(message_p).imsi);
+    case S6A_CANCEL_LOCATION_REQ:
+      return imsi_str_ue_id(S6A_CANCEL_LOCATION_REQ(message_p).imsi);
+    case S6A_PURGE_UE_ANS:
+      return imsi_str_ue_id(S6A_PURGE_UE_ANS(message_p).imsi);
+    case S11_CREATE_SESSION_RESPONSE:
+      return s11_teid_ue_id(S11_CREATE_SESSION_RESPONSE(message_p).teid);
+    case S11_MODIFY_BEARER_RESPONSE:
+      return s11_teid_ue_id(S11_MODIFY_BEARER_RESPONSE(message_p).teid);
+    case S11_RELEASE_ACCESS_BEARERS_RESPONSE:
+      return s11_teid_ue_id(
+          S11_RELEASE_ACCESS_BEARERS_RESPONSE(message_p).teid);
+    case S11_DELETE_SESSION_RESPONSE:
+      return s11_teid_ue_id(S11_DELETE_SESSION_RESPONSE(message_p).teid);
+    case S11_SUSPEND_ACKNOWLEDGE:
+      return s11_teid_ue_id(S11_SUSPEND_ACKNOWLEDGE(message_p).teid);
+    // Timer signals, resets, deregistrations and health may involve any UE
+    case TIMER_HAS_EXPIRED:
+    case S6A_RESET_REQ:
+    case S1AP_ENB_INITIATED_RESET_REQ:
+    case S1AP_ENB_DEREGISTERED_IND:
+    case S1AP_REMOVE_STALE_UE_CONTEXT:
+    case SGSAP_VLR_RESET_INDICATION:
+    case RECOVERY_MESSAGE:
+      return INVALID_MME_UE_S1AP_ID;
+    default:
+      // S11 requests of the SGW and SGS messages carry the IMSI
+      return imsi_ue_id(message_p->ittiMsgHeader.imsi);
+  }
+}
+
+//------------------------------------------------------------------------------
+void mme_app_shard_dispatch(MessageDef* message_p) {
+  if (num_shards == 1) {
+    shard_handler(message_p);
+    return;
+  }
+  mme_ue_s1ap_id_t ue_id = message_ue_id(message_p);
+  bool exclusive         = true;
+  uint32_t index         = 0;
+
+  if (ue_id != INVALID_MME_UE_S1AP_ID) {
+    index     = ue_id % num_shards;
+    exclusive = !is_ue_local(message_p);
+  }
+  __atomic_fetch_add(&shards[index].queued, 1, __ATOMIC_RELAXED);
+  // The shard takes ownership of the message
+  zsock_send(shards[index].push_sock, "pi", message_p, (int) exclusive);
+}
+
+//------------------------------------------------------------------------------
+void mme_app_shard_lock(bool exclusive) {
+  if (num_shards == 1) {
+    return;
+  }
+  if (exclusive) {
+    pthread_rwlock_wrlock(&shard_rwlock);
+  } else {
+    pthread_rwlock_rdlock(&shard_rwlock);
+  }
+  current_shard_exclusive = exclusive;
+}
+
+//------------------------------------------------------------------------------
+void mme_app_shard_unlock(void) {
+  if (num_shards == 1) {
+    return;
+  }
+  current_shard_exclusive = false;
+  pthread_rwlock_unlock(&shard_rwlock);
+}
+
+//------------------------------------------------------------------------------
+void mme_app_shard_run_exclusive(void (*fn)(void)) {
+  if (num_shards == 1 || !current_shard || current_shard_exclusive) {
+    fn();
+    return;
+  }
+  mme_app_shard_unlock();
+  mme_app_shard_lock(true);
+  fn();
+  mme_app_shard_unlock();
+  mme_app_shard_lock(false);
+}
+
+//------------------------------------------------------------------------------
+void mme_app_shard_run_unlocked(void (*fn)(void)) {
+  if (num_shards == 1 || !current_shard) {
+    fn();
+    return;
+  }
+  bool exclusive = current_shard_exclusive;
+  mme_app_shard_unlock();
+  fn();
+  mme_app_shard_lock(exclusive);
+}
+
+//------------------------------------------------------------------------------
+task_zmq_ctx_t* mme_app_shard_task_ctx(void) {
+  return current_shard ? &current_shard->task_zmq_ctx : &mme_app_task_zmq_ctx;
+}
+
+//------------------------------------------------------------------------------
+int mme_app_shard_timer_id(int zloop_timer_id) {
+  uint32_t index = current_shard ? current_shard->index : 0;
+  return zloop_timer_id * (int) num_shards + (int) index;
+}
+
+//------------------------------------------------------------------------------
+int mme_app_shard_zloop_timer_id(int timer_id) {
+  return timer_id / (int) num_shards;
+}
+
+//------------------------------------------------------------------------------
+bool mme_app_shard_owns_timer(int timer_id) {
+  uint32_t index = current_shard ? current_shard->index : 0;
+  return (uint32_t) timer_id % num_shards == index;
+}
+
+//------------------------------------------------------------------------------
+void mme_app_shard_report_stats(void) {
+  char index[11];
+
+  for (uint32_t i = 0; shards && i < num_shards; i++) {
+    snprintf(index, sizeof(index), "%u", i);
+    set_gauge(
+        "mme_app_shard_queued",
+        __atomic_load_n(&shards[i].queued, __ATOMIC_RELAXED), 1, "shard",
+        index);
+  }
+}
@@ -0,0 +1,106 @@
+/**
+ * Copyright 2020 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*! \file mme_app_shard.h
+  \brief Spreads the messages of MME_APP over worker threads by UE.
+  With more than one shard, the MME_APP thread only dispatches: each message
+  is forwarded to the shard of its UE, mme_ue_s1ap_id modulo the number of
+  shards, found from the identifiers the message carries (MME UE S1AP id,
+  S11 TEID or IMSI). The messages of a UE are thus handled in order by a
+  single shard. Messages continuing a procedure of their UE only, e.g. an
+  Authentication Response or a Create Session Response, are handled under a
+  shared lock, shards running them in parallel. Any other message, those
+  that can reach the contexts of other UEs (attach, TAU, detach...) or of no
+  UE in particular (eNB and HSS resets, timer signals), is handled under the
+  exclusive lock. Messages without a known UE go to shard 0.
+  Each shard has its own event loop, the timers MME_APP starts run on the
+  loop of the shard starting them.
+  With a single shard, messages are handled on the MME_APP thread without
+  locking.
+*/
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "intertask_interface.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef void (*mme_app_shard_handler_t)(MessageDef* message_p);
+
+/**
+ * Start num_shards threads handling messages with handler, none when
+ * num_shards is 1. Called on the MME_APP thread.
+ */
+int mme_app_shard_init(uint32_t num_shards, mme_app_shard_handler_t handler);
+
+/**
+ * Stop and join the shard threads. Called on the MME_APP thread.
+ */
+void mme_app_shard_exit(void);
+
+uint32_t mme_app_shard_count(void);
+
+/**
+ * Hand message_p over to the shard of its UE, which frees it. Called on the
+ * MME_APP thread.
+ */
+void mme_app_shard_dispatch(MessageDef* message_p);
+
+/**
+ * Run fn under the exclusive lock, releasing the shared lock held by the
+ * calling shard meanwhile, if any.
+ */
+void mme_app_shard_run_exclusive(void (*fn)(void));
+
+/**
+ * Run fn without the lock held by the calling shard, if any, so that it may
+ * block without holding back the other shards.
+ */
+void mme_app_shard_run_unlocked(void (*fn)(void));
+
+void mme_app_shard_lock(bool exclusive);
+void mme_app_shard_unlock(void);
+
+/**
+ * @return the context of the calling shard, that of MME_APP when not called
+ * by a shard
+ */
+task_zmq_ctx_t* mme_app_shard_task_ctx(void);
+
+/**
+ * Timer ids are unique across shards: the id given by the event loop of the
+ * calling shard times the number of shards plus the shard index.
+ */
+int mme_app_shard_timer_id(int zloop_timer_id);
+int mme_app_shard_zloop_timer_id(int timer_id);
+bool mme_app_shard_owns_timer(int timer_id);
+
+/**
+ * Report the messages queued to each shard to service303
+ */
+void mme_app_shard_report_stats(void);
+
+/**
+ * Tell whether an uplink NAS PDU only continues a procedure of its UE
+ */
+bool mme_app_shard_nas_is_ue_local(const uint8_t* pdu, size_t length);
+
+#ifdef __cplusplus
+}
+#endif
@@ -15,12 +15,37 @@
  *      contact@openairinterface.org
  */
 
+#include <mutex>
+#include <string>
+
 #include "mme_app_state.h"
 #include "mme_app_state_manager.h"
 #include "mme_app_ip_imsi.h"
+#include "mme_app_auth_vector_cache.h"
 
 using magma::lte::MmeNasStateManager;
 
+#define UE_STATE_DB_MUTEXES 64
+
+// Guards the write of the MME_APP task state
+static std::mutex state_db_mutex;
+// Snapshots of the MME_APP task state are numbered in the order in which
+// they were taken, under the exclusive shard lock. A snapshot older than the
+// last one written is not written.
+static uint64_t state_snapshot_count;
+static uint64_t state_snapshot_written;
+// Snapshot taken by the calling shard, written by put_mme_nas_state()
+static thread_local std::string state_snapshot;
+static thread_local uint64_t state_snapshot_id;
+// The MME_APP shards write their UEs concurrently. A UE may be written by
+// two shards, e.g. while one handles a message of its IMSI and another one
+// a timer, so the writes of an IMSI are serialized by its mutex.
+static std::mutex ue_state_db_mutexes[UE_STATE_DB_MUTEXES];
+
+static std::mutex& ue_state_db_mutex(imsi64_t imsi64) {
+  return ue_state_db_mutexes[imsi64 % UE_STATE_DB_MUTEXES];
+}
+
 /**
  * When the process starts, initialize the in-memory MME+NAS state and, if
  * persist state flag is set, load it from the data store.
@@ -28,6 +53,9 @@ using magma::lte::MmeNasStateManager;
  */
 int mme_nas_state_init(const mme_config_t* mme_config_p) {
   initialize_ipv4_map();
+  mme_app_auth_vector_cache_init(
+      mme_config_p->auth_vector_cache_max_ues,
+      mme_config_p->auth_vector_cache_ttl, mme_config_p->use_stateless);
   return MmeNasStateManager::getInstance().initialize_state(mme_config_p);
 }
 
@@ -42,11 +70,33 @@ mme_app_desc_t* get_mme_nas_state(bool read_from_db) {
 }
 
 /**
- * Write the MME/NAS state to data store after processing any message. This is
- * a thread safe call
+ * Serialize the MME/NAS state for put_mme_nas_state() after processing any
+ * message. Called while no other shard runs.
+ */
+void snapshot_mme_nas_state() {
+  state_snapshot.clear();
+  state_snapshot_id = 0;
+  if (MmeNasStateManager::getInstance().serialize_state(state_snapshot)) {
+    state_snapshot_id = ++state_snapshot_count;
+  }
+}
+
+/**
+ * Write the MME/NAS state serialized by snapshot_mme_nas_state() on the
+ * calling thread to data store. This is a thread safe call, the other shards
+ * may run meanwhile.
  */
 void put_mme_nas_state() {
-  MmeNasStateManager::getInstance().write_state_to_db();
+  if (!state_snapshot_id) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(state_db_mutex);
+  if (state_snapshot_id > state_snapshot_written) {
+    MmeNasStateManager::getInstance().write_serialized_state_to_db(
+        state_snapshot);
+    state_snapshot_written = state_snapshot_id;
+  }
+  state_snapshot_id = 0;
 }
 
 /**
@@ -62,6 +112,7 @@ hash_table_ts_t* get_mme_ue_state() {
 }
 
 void put_mme_ue_state(mme_app_desc_t* mme_app_desc_p, imsi64_t imsi64) {
+  mme_app_auth_vector_cache_flush();
   if (MmeNasStateManager::getInstance().is_persist_state_enabled()) {
     if (imsi64 != INVALID_IMSI64) {
       ue_mm_context_t* ue_context = nullptr;
@@ -69,6 +120,7 @@ void put_mme_ue_state(mme_app_desc_t* mme_app_desc_p, imsi64_t imsi64) {
           mme_ue_context_exists_imsi(&mme_app_desc_p->mme_ue_contexts, imsi64);
       if (ue_context && ue_context->mm_state == UE_REGISTERED) {
         auto imsi_str = MmeNasStateManager::getInstance().get_imsi_str(imsi64);
+        std::lock_guard<std::mutex> lock(ue_state_db_mutex(imsi64));
         MmeNasStateManager::getInstance().write_ue_state_to_db(
             ue_context, imsi_str);
       }
@@ -78,5 +130,6 @@ void put_mme_ue_state(mme_app_desc_t* mme_app_desc_p, imsi64_t imsi64) {
 
 void delete_mme_ue_state(imsi64_t imsi64) {
   auto imsi_str = MmeNasStateManager::getInstance().get_imsi_str(imsi64);
+  std::lock_guard<std::mutex> lock(ue_state_db_mutex(imsi64));
   MmeNasStateManager::getInstance().clear_ue_state_db(imsi_str);
 }
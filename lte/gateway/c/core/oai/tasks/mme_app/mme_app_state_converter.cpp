@@ -20,6 +20,7 @@ extern "C" {
 #include "dynamic_memory_check.h"
 #include "ie_to_bytes.h"
 #include "log.h"
+#include "mme_app_ue_context_pool.h"
 #include "timer.h"
 }
 
@@ -91,6 +92,8 @@ void MmeNasStateConverter::proto_to_hashtable_ts(
           "error:"
           "%s\n",
           mme_ue_id, state_htbl->name->data, hashtable_rc_code2string(ht_rc));
+    } else {
+      mme_app_ue_context_pool_bind_ue_id(ue_context_p, mme_ue_id);
     }
     OAILOG_DEBUG(LOG_MME_APP, "Written one key into hashtable_ts");
   }
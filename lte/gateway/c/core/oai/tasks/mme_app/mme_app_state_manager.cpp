@@ -20,6 +20,7 @@ extern "C" {
 #include "dynamic_memory_check.h"
 #include "emm_proc.h"
 #include "log.h"
+#include "mme_app_ue_context_pool.h"
 #include "timer.h"
 }
 
@@ -70,7 +71,10 @@ int MmeNasStateManager::initialize_state(const mme_config_t* mme_config_p) {
   create_state();
 
   redis_client = std::make_unique<RedisClient>(persist_state_enabled);
-  int rc       = read_state_from_db();
+  open_ue_state_region(
+      bdata(mme_config_p->ue_state_region_dir),
+      mme_config_p->ue_state_region_max_ues);
+  int rc = read_state_from_db();
   read_ue_state_from_db();
   is_initialized = true;
   return rc;
@@ -176,6 +180,7 @@ void MmeNasStateManager::create_state() {
     return;
   }
   state_cache_p->mme_app_ue_s1ap_id_generator = 1;
+  mme_app_ue_context_pool_init(max_ue_htbl_lists_);
 
   create_hashtables();
   // Initialize the local timers, which are non-persistent
@@ -205,40 +210,56 @@ void MmeNasStateManager::free_state() {
     return;
   }
   clear_mme_nas_hashtables();
+  mme_app_ue_context_pool_destroy();
   timer_remove(state_cache_p->statistic_timer_id, nullptr);
   free(state_cache_p);
   state_cache_p = nullptr;
 }
 
 status_code_e MmeNasStateManager::read_ue_state_from_db() {
-  if (persist_state_enabled) {
-    auto keys = redis_client->get_keys("IMSI*" + task_name + "*");
-    for (const auto& key : keys) {
-      OAILOG_DEBUG(log_task, "Reading UE state from db for %s", key.c_str());
-      oai::UeContext ue_proto = oai::UeContext();
-      auto* ue_context =
-          (ue_mm_context_t*) (calloc(1, sizeof(ue_mm_context_t)));
-      if (redis_client->read_proto(key, ue_proto) != RETURNok) {
-        return RETURNerror;
-      }
-      MmeNasStateConverter::proto_to_ue(ue_proto, ue_context);
-
-      hashtable_rc_t h_rc = hashtable_ts_insert(
-          state_ue_ht, ue_context->mme_ue_s1ap_id, (void*) ue_context);
-      if (HASH_TABLE_OK != h_rc) {
-        OAILOG_ERROR(
-            log_task,
-            "Failed to insert UE state with key mme_ue_s1ap_id "
-            " " MME_UE_S1AP_ID_FMT " (Error Code: %s)\n",
-            ue_context->mme_ue_s1ap_id, hashtable_rc_code2string(h_rc));
-      } else {
-        OAILOG_DEBUG(
-            log_task,
-            "Inserted UE state with key mme_ue_s1ap_id " MME_UE_S1AP_ID_FMT,
-            ue_context->mme_ue_s1ap_id);
-      }
+  if (!persist_state_enabled) {
+    return RETURNok;
+  }
+  auto start = std::chrono::steady_clock::now();
+  std::vector<std::string> keys;
+  std::vector<oai::UeContext> ue_protos;
+  if (read_ue_protos_from_db(keys, ue_protos) != RETURNok) {
+    return RETURNerror;
+  }
+
+  // The pool is not thread safe: take the slots up front and let the
+  // workers only fill them
+  std::vector<ue_mm_context_t*> ue_contexts(keys.size(), nullptr);
+  for (size_t i = 0; i < keys.size(); i++) {
+    ue_contexts[i] = mme_app_ue_context_pool_alloc();
+    AssertFatal(ue_contexts[i], "Failed to allocate UE context");
+  }
+  run_restore_workers(keys.size(), [&](size_t i) {
+    MmeNasStateConverter::proto_to_ue(ue_protos[i], ue_contexts[i]);
+  });
+
+  for (size_t i = 0; i < keys.size(); i++) {
+    auto* ue_context = ue_contexts[i];
+    OAILOG_DEBUG(log_task, "Reading UE state from db for %s", keys[i].c_str());
+    hashtable_rc_t h_rc = hashtable_ts_insert(
+        state_ue_ht, ue_context->mme_ue_s1ap_id, (void*) ue_context);
+    if (HASH_TABLE_OK != h_rc) {
+      OAILOG_ERROR(
+          log_task,
+          "Failed to insert UE state with key mme_ue_s1ap_id "
+          " " MME_UE_S1AP_ID_FMT " (Error Code: %s)\n",
+          ue_context->mme_ue_s1ap_id, hashtable_rc_code2string(h_rc));
+      mme_app_ue_context_pool_free(ue_context);
+    } else {
+      mme_app_ue_context_pool_bind_ue_id(
+          ue_context, ue_context->mme_ue_s1ap_id);
+      OAILOG_DEBUG(
+          log_task,
+          "Inserted UE state with key mme_ue_s1ap_id " MME_UE_S1AP_ID_FMT,
+          ue_context->mme_ue_s1ap_id);
     }
   }
+  report_ue_state_restore(keys.size(), start);
   return RETURNok;
 }
 
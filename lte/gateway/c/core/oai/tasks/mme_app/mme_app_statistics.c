@@ -22,16 +22,29 @@
 /*********************************** Utility Functions to update
  * Statistics**************************************/
 
+// The MME_APP shards update the counters concurrently
+static void stats_add(uint32_t* counter) {
+  __atomic_fetch_add(counter, 1, __ATOMIC_RELAXED);
+}
+
+static void stats_sub(uint32_t* counter) {
+  uint32_t value = __atomic_load_n(counter, __ATOMIC_RELAXED);
+  while (value != 0 && !__atomic_compare_exchange_n(
+                           counter, &value, value - 1, true, __ATOMIC_RELAXED,
+                           __ATOMIC_RELAXED)) {
+  }
+}
+
 /*****************************************************/
 // Number of Connected UEs
 void update_mme_app_stats_connected_ue_add(void) {
   mme_app_desc_t* mme_app_desc_p = get_mme_nas_state(false);
-  (mme_app_desc_p->nb_ue_connected)++;
+  stats_add(&mme_app_desc_p->nb_ue_connected);
   return;
 }
 void update_mme_app_stats_connected_ue_sub(void) {
   mme_app_desc_t* mme_app_desc_p = get_mme_nas_state(false);
-  if (mme_app_desc_p->nb_ue_connected != 0) (mme_app_desc_p->nb_ue_connected)--;
+  stats_sub(&mme_app_desc_p->nb_ue_connected);
   return;
 }
 
@@ -39,12 +52,12 @@ void update_mme_app_stats_connected_ue_sub(void) {
 // Number of S1U Bearers
 void update_mme_app_stats_s1u_bearer_add(void) {
   mme_app_desc_t* mme_app_desc_p = get_mme_nas_state(false);
-  (mme_app_desc_p->nb_s1u_bearers)++;
+  stats_add(&mme_app_desc_p->nb_s1u_bearers);
   return;
 }
 void update_mme_app_stats_s1u_bearer_sub(void) {
   mme_app_desc_t* mme_app_desc_p = get_mme_nas_state(false);
-  if (mme_app_desc_p->nb_s1u_bearers != 0) (mme_app_desc_p->nb_s1u_bearers)--;
+  stats_sub(&mme_app_desc_p->nb_s1u_bearers);
   return;
 }
 
@@ -52,13 +65,12 @@ void update_mme_app_stats_s1u_bearer_sub(void) {
 // Number of Default EPS Bearers
 void update_mme_app_stats_default_bearer_add(void) {
   mme_app_desc_t* mme_app_desc_p = get_mme_nas_state(false);
-  (mme_app_desc_p->nb_default_eps_bearers)++;
+  stats_add(&mme_app_desc_p->nb_default_eps_bearers);
   return;
 }
 void update_mme_app_stats_default_bearer_sub(void) {
   mme_app_desc_t* mme_app_desc_p = get_mme_nas_state(false);
-  if (mme_app_desc_p->nb_default_eps_bearers != 0)
-    (mme_app_desc_p->nb_default_eps_bearers)--;
+  stats_sub(&mme_app_desc_p->nb_default_eps_bearers);
   return;
 }
 
@@ -66,12 +78,12 @@ void update_mme_app_stats_default_bearer_sub(void) {
 // Number of Attached UEs
 void update_mme_app_stats_attached_ue_add(void) {
   mme_app_desc_t* mme_app_desc_p = get_mme_nas_state(false);
-  (mme_app_desc_p->nb_ue_attached)++;
+  stats_add(&mme_app_desc_p->nb_ue_attached);
   return;
 }
 void update_mme_app_stats_attached_ue_sub(void) {
   mme_app_desc_t* mme_app_desc_p = get_mme_nas_state(false);
-  if (mme_app_desc_p->nb_ue_attached != 0) (mme_app_desc_p->nb_ue_attached)--;
+  stats_sub(&mme_app_desc_p->nb_ue_attached);
   return;
 }
 /*****************************************************/
@@ -17,6 +17,7 @@ extern "C" {
 #include "conversions.h"
 #include "intertask_interface.h"
 #include "common_types.h"
+#include "mme_app_shard.h"
 }
 #include "mme_app_timer_management.h"
 //--C++ includes ---------------------------------------------------------------
@@ -85,32 +86,72 @@ bool mme_app_get_timer_arg(int timer_id, timer_arg_t* arg) {
   return magma::lte::MmeUeContext::Instance().GetTimerArg(timer_id, arg);
 }
 
+//------------------------------------------------------------------------------
+// Runs the handlers of the timers of the MME_APP shards, which may touch any
+// UE, under the exclusive lock and with their unique timer id
+static int handle_shard_timer(zloop_t* loop, int zloop_timer_id, void* arg) {
+  int timer_id            = mme_app_shard_timer_id(zloop_timer_id);
+  zloop_timer_fn* handler = nullptr;
+  int rc                  = 0;
+
+  mme_app_shard_lock(true);
+  if (magma::lte::MmeUeContext::Instance().GetTimerHandler(
+          timer_id, &handler)) {
+    rc = handler(loop, timer_id, arg);
+  } else {
+    // Stopped by another shard, which could not end it
+    zloop_timer_end(loop, zloop_timer_id);
+  }
+  mme_app_shard_unlock();
+  return rc;
+}
+
 namespace magma {
 namespace lte {
 //------------------------------------------------------------------------------
 int MmeUeContext::StartTimer(
     size_t msec, timer_repeat_t repeat, zloop_timer_fn handler,
     TimerArgType arg) {
-  int timer_id = -1;
-  if ((timer_id = start_timer(
-           &mme_app_task_zmq_ctx, msec, repeat, handler, nullptr)) != -1) {
-    mme_app_timers.insert(std::pair<int, uint32_t>(timer_id, arg));
+  bool sharded = mme_app_shard_count() > 1;
+  int timer_id = start_timer(
+      mme_app_shard_task_ctx(), msec, repeat,
+      sharded ? handle_shard_timer : handler, nullptr);
+  if (timer_id != -1) {
+    timer_id = mme_app_shard_timer_id(timer_id);
+    std::lock_guard<std::mutex> lock(timers_mutex);
+    mme_app_timers[timer_id] = {handler, arg};
   }
   return timer_id;
 }
 //------------------------------------------------------------------------------
 void MmeUeContext::StopTimer(int timer_id) {
-  stop_timer(&mme_app_task_zmq_ctx, timer_id);
+  if (mme_app_shard_owns_timer(timer_id)) {
+    stop_timer(
+        mme_app_shard_task_ctx(), mme_app_shard_zloop_timer_id(timer_id));
+  }
+  std::lock_guard<std::mutex> lock(timers_mutex);
   mme_app_timers.erase(timer_id);
 }
 //------------------------------------------------------------------------------
 bool MmeUeContext::GetTimerArg(const int timer_id, TimerArgType* arg) const {
-  try {
-    *arg = mme_app_timers.at(timer_id);
-    return true;
-  } catch (std::out_of_range& e) {
+  std::lock_guard<std::mutex> lock(timers_mutex);
+  auto it = mme_app_timers.find(timer_id);
+  if (it == mme_app_timers.end()) {
+    return false;
+  }
+  *arg = it->second.arg;
+  return true;
+}
+//------------------------------------------------------------------------------
+bool MmeUeContext::GetTimerHandler(
+    const int timer_id, zloop_timer_fn** handler) const {
+  std::lock_guard<std::mutex> lock(timers_mutex);
+  auto it = mme_app_timers.find(timer_id);
+  if (it == mme_app_timers.end()) {
     return false;
   }
+  *handler = it->second.handler;
+  return true;
 }
 
 }  // namespace lte
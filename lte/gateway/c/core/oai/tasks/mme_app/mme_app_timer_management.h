@@ -22,6 +22,7 @@ extern "C" {
 ///-------------------------------------------------------------
 #include <czmq.h>
 #include <map>
+#include <mutex>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -30,9 +31,16 @@ namespace lte {
 
 typedef uint32_t TimerArgType;
 
+struct MmeAppTimer {
+  zloop_timer_fn* handler;
+  TimerArgType arg;
+};
+
 class MmeUeContext {
  private:
-  std::map<int, TimerArgType> mme_app_timers;
+  // Timers are started and stopped by every MME_APP shard
+  std::map<int, MmeAppTimer> mme_app_timers;
+  mutable std::mutex timers_mutex;
   MmeUeContext() : mme_app_timers(){};
 
  public:
@@ -50,6 +58,8 @@ class MmeUeContext {
   void StopTimer(int timer_id);
 
   bool GetTimerArg(const int timer_id, TimerArgType* arg) const;
+
+  bool GetTimerHandler(const int timer_id, zloop_timer_fn** handler) const;
 };
 
 }  // namespace lte
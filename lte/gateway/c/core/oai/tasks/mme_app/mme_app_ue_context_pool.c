@@ -0,0 +1,263 @@
+/**
+ * Copyright 2020 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "log.h"
+#include "mme_app_ue_context_pool.h"
+
+#define MME_APP_UE_CONTEXT_POOL_MIN_INDEX_SIZE 1024
+
+typedef struct ue_context_slot_s {
+  uint32_t generation;
+  uint32_t next_free;  // Slot index + 1 of the next free slot, 0 ends the list
+  bool in_use;
+} ue_context_slot_t;
+
+// Per slot book keeping comes first, so that scans over the pool only walk
+// the head of each chunk and not the (large) contexts
+typedef struct ue_context_chunk_s {
+  ue_context_slot_t slots[MME_APP_UE_CONTEXT_POOL_CHUNK_SIZE];
+  ue_mm_context_t contexts[MME_APP_UE_CONTEXT_POOL_CHUNK_SIZE];
+} ue_context_chunk_t;
+
+typedef struct mme_app_ue_context_pool_s {
+  // Fixed size so that lookups can run unlocked while the pool grows
+  ue_context_chunk_t* chunks[MME_APP_UE_CONTEXT_POOL_MAX_CHUNKS];
+  uint32_t num_slots;  // Published after the chunk holding the slots
+  uint32_t free_head;  // Slot index + 1, 0 when every slot is in use
+  uint32_t num_in_use;
+  mme_app_ue_context_handle_t* ue_id_index;
+  uint32_t ue_id_index_mask;
+} mme_app_ue_context_pool_t;
+
+static mme_app_ue_context_pool_t pool = {0};
+static pthread_mutex_t pool_mutex    = PTHREAD_MUTEX_INITIALIZER;
+
+//------------------------------------------------------------------------------
+static inline ue_context_slot_t* pool_slot(uint32_t slot) {
+  return &pool.chunks[slot / MME_APP_UE_CONTEXT_POOL_CHUNK_SIZE]
+              ->slots[slot % MME_APP_UE_CONTEXT_POOL_CHUNK_SIZE];
+}
+
+//------------------------------------------------------------------------------
+static inline ue_mm_context_t* pool_slot_context(uint32_t slot) {
+  return &pool.chunks[slot / MME_APP_UE_CONTEXT_POOL_CHUNK_SIZE]
+              ->contexts[slot % MME_APP_UE_CONTEXT_POOL_CHUNK_SIZE];
+}
+
+//------------------------------------------------------------------------------
+// @return slot index + 1 of ue_context_p, 0 if it does not belong to the pool
+static uint32_t pool_context_slot(const ue_mm_context_t* ue_context_p) {
+  uint32_t slot = ue_context_p->pool_slot;
+  // Contexts allocated elsewhere, or copied from a pooled one, do not match
+  // the context of the slot they claim
+  if (!slot || (slot > __atomic_load_n(&pool.num_slots, __ATOMIC_ACQUIRE)) ||
+      (pool_slot_context(slot - 1) != ue_context_p)) {
+    return 0;
+  }
+  return slot;
+}
+
+//------------------------------------------------------------------------------
+static status_code_e pool_grow(void) {
+  uint32_t c = pool.num_slots / MME_APP_UE_CONTEXT_POOL_CHUNK_SIZE;
+  if (c == MME_APP_UE_CONTEXT_POOL_MAX_CHUNKS) {
+    return RETURNerror;
+  }
+  ue_context_chunk_t* chunk = calloc(1, sizeof(ue_context_chunk_t));
+  if (!chunk) {
+    return RETURNerror;
+  }
+  pool.chunks[c] = chunk;
+
+  // Hand out the new slots in address order
+  uint32_t num_slots = pool.num_slots + MME_APP_UE_CONTEXT_POOL_CHUNK_SIZE;
+  for (uint32_t slot = num_slots; slot > pool.num_slots; slot--) {
+    pool_slot(slot - 1)->next_free = pool.free_head;
+    pool.free_head                 = slot;
+  }
+  __atomic_store_n(&pool.num_slots, num_slots, __ATOMIC_RELEASE);
+  return RETURNok;
+}
+
+//------------------------------------------------------------------------------
+status_code_e mme_app_ue_context_pool_init(uint32_t max_ues) {
+  if (pool.ue_id_index) {
+    return RETURNok;
+  }
+  // Twice the expected UEs keeps collisions between live ids rare
+  uint32_t index_size = MME_APP_UE_CONTEXT_POOL_MIN_INDEX_SIZE;
+  while ((index_size < 2 * (uint64_t) max_ues) && (index_size < (1u << 31))) {
+    index_size <<= 1;
+  }
+  pool.ue_id_index = calloc(index_size, sizeof(mme_app_ue_context_handle_t));
+  if (!pool.ue_id_index) {
+    OAILOG_CRITICAL(
+        LOG_MME_APP, "Failed to allocate the UE context index for %u UEs\n",
+        max_ues);
+    return RETURNerror;
+  }
+  pool.ue_id_index_mask = index_size - 1;
+  return RETURNok;
+}
+
+//------------------------------------------------------------------------------
+void mme_app_ue_context_pool_destroy(void) {
+  if (pool.num_in_use) {
+    OAILOG_ERROR(
+        LOG_MME_APP, "Not releasing UE context pool, %u contexts in use\n",
+        pool.num_in_use);
+    return;
+  }
+  for (uint32_t c = 0; c < pool.num_slots / MME_APP_UE_CONTEXT_POOL_CHUNK_SIZE;
+       c++) {
+    free(pool.chunks[c]);
+    pool.chunks[c] = NULL;
+  }
+  free(pool.ue_id_index);
+  pool.ue_id_index = NULL;
+  pool.num_slots   = 0;
+  pool.free_head   = 0;
+}
+
+//------------------------------------------------------------------------------
+ue_mm_context_t* mme_app_ue_context_pool_alloc(void) {
+  if (!pool.ue_id_index && (mme_app_ue_context_pool_init(0) != RETURNok)) {
+    return NULL;
+  }
+  pthread_mutex_lock(&pool_mutex);
+  if (!pool.free_head && (pool_grow() != RETURNok)) {
+    OAILOG_ERROR(
+        LOG_MME_APP, "Failed to grow UE context pool beyond %u contexts\n",
+        pool.num_slots);
+    pthread_mutex_unlock(&pool_mutex);
+    return NULL;
+  }
+  uint32_t slot             = pool.free_head - 1;
+  ue_context_slot_t* slot_p = pool_slot(slot);
+  pool.free_head            = slot_p->next_free;
+  slot_p->next_free         = 0;
+  slot_p->in_use            = true;
+  pool.num_in_use++;
+  pthread_mutex_unlock(&pool_mutex);
+
+  ue_mm_context_t* ue_context_p = pool_slot_context(slot);
+  memset(ue_context_p, 0, sizeof(*ue_context_p));
+  ue_context_p->pool_slot = slot + 1;
+  return ue_context_p;
+}
+
+//------------------------------------------------------------------------------
+void mme_app_ue_context_pool_free(ue_mm_context_t* ue_context_p) {
+  if (!ue_context_p) {
+    return;
+  }
+  uint32_t slot = pool_context_slot(ue_context_p);
+  if (!slot) {
+    free(ue_context_p);
+    return;
+  }
+  pthread_mutex_lock(&pool_mutex);
+  ue_context_slot_t* slot_p = pool_slot(slot - 1);
+  if (!slot_p->in_use) {
+    pthread_mutex_unlock(&pool_mutex);
+    OAILOG_ERROR(
+        LOG_MME_APP, "UE context %p released twice\n", (void*) ue_context_p);
+    return;
+  }
+  // Outstanding handles and index entries of the slot become stale
+  slot_p->generation++;
+  slot_p->in_use    = false;
+  slot_p->next_free = pool.free_head;
+  pool.free_head    = slot;
+  pool.num_in_use--;
+  pthread_mutex_unlock(&pool_mutex);
+}
+
+//------------------------------------------------------------------------------
+mme_app_ue_context_handle_t mme_app_ue_context_pool_get_handle(
+    const ue_mm_context_t* ue_context_p) {
+  uint32_t slot = ue_context_p ? pool_context_slot(ue_context_p) : 0;
+  if (!slot || !pool_slot(slot - 1)->in_use) {
+    return INVALID_MME_APP_UE_CONTEXT_HANDLE;
+  }
+  return ((mme_app_ue_context_handle_t) pool_slot(slot - 1)->generation
+          << 32) |
+         slot;
+}
+
+//------------------------------------------------------------------------------
+ue_mm_context_t* mme_app_ue_context_pool_get_by_handle(
+    mme_app_ue_context_handle_t handle) {
+  uint32_t slot = (uint32_t) handle;
+  if (!slot || (slot > __atomic_load_n(&pool.num_slots, __ATOMIC_ACQUIRE))) {
+    return NULL;
+  }
+  const ue_context_slot_t* slot_p = pool_slot(slot - 1);
+  if (!slot_p->in_use || (slot_p->generation != (uint32_t)(handle >> 32))) {
+    return NULL;
+  }
+  return pool_slot_context(slot - 1);
+}
+
+//------------------------------------------------------------------------------
+void mme_app_ue_context_pool_bind_ue_id(
+    const ue_mm_context_t* ue_context_p, mme_ue_s1ap_id_t mme_ue_s1ap_id) {
+  if (!pool.ue_id_index || (INVALID_MME_UE_S1AP_ID == mme_ue_s1ap_id)) {
+    return;
+  }
+  mme_app_ue_context_handle_t handle =
+      mme_app_ue_context_pool_get_handle(ue_context_p);
+  if (handle != INVALID_MME_APP_UE_CONTEXT_HANDLE) {
+    pool.ue_id_index[mme_ue_s1ap_id & pool.ue_id_index_mask] = handle;
+  }
+}
+
+//------------------------------------------------------------------------------
+ue_mm_context_t* mme_app_ue_context_pool_get_by_ue_id(
+    mme_ue_s1ap_id_t mme_ue_s1ap_id) {
+  if (!pool.ue_id_index) {
+    return NULL;
+  }
+  ue_mm_context_t* ue_context_p = mme_app_ue_context_pool_get_by_handle(
+      pool.ue_id_index[mme_ue_s1ap_id & pool.ue_id_index_mask]);
+  // The slot may have been rebound to another id sharing the same entry
+  if (ue_context_p && (ue_context_p->mme_ue_s1ap_id == mme_ue_s1ap_id)) {
+    return ue_context_p;
+  }
+  return NULL;
+}
+
+//------------------------------------------------------------------------------
+uint32_t mme_app_ue_context_pool_apply(
+    mme_app_ue_context_pool_cb_t cb, void* arg) {
+  uint32_t visited = 0;
+  for (uint32_t slot = 0; slot < pool.num_slots; slot++) {
+    if (!pool_slot(slot)->in_use) {
+      continue;
+    }
+    visited++;
+    if (cb(pool_slot_context(slot), arg)) {
+      break;
+    }
+  }
+  return visited;
+}
+
+//------------------------------------------------------------------------------
+uint32_t mme_app_ue_context_pool_size(void) {
+  return pool.num_in_use;
+}
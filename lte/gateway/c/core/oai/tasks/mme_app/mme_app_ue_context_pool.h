@@ -0,0 +1,120 @@
+/**
+ * Copyright 2020 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*! \file mme_app_ue_context_pool.h
+  \brief Slab storage for the UE contexts of MME_APP.
+  Contexts live in fixed size chunks, so their address never changes for as
+  long as they are in use, and freed slots are recycled through a free list.
+  A context records its own slot, so that it maps back to its slot in
+  constant time.
+  Each slot carries a generation number bumped on every free, so a
+  mme_app_ue_context_handle_t taken on a context can never resolve to the
+  context that later reuses its slot. The pool also keeps a direct mapped
+  index from mme_ue_s1ap_id to slot: ids are handed out sequentially, so
+  live UEs rarely collide and most lookups by id are a single array access.
+  Allocations and releases are serialized by the pool. Lookups do not lock:
+  the chunk table has a fixed size and a chunk is in place before its slots
+  are published, so the pool may grow while they run.
+*/
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "mme_app_ue_context.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MME_APP_UE_CONTEXT_POOL_CHUNK_SIZE 64
+// Up to 4M contexts
+#define MME_APP_UE_CONTEXT_POOL_MAX_CHUNKS (1 << 16)
+#define INVALID_MME_APP_UE_CONTEXT_HANDLE ((mme_app_ue_context_handle_t) 0)
+
+// Generation in the upper 32 bits, slot index + 1 in the lower 32 bits
+typedef uint64_t mme_app_ue_context_handle_t;
+
+/**
+ * Callback of mme_app_ue_context_pool_apply()
+ * @return true to stop the iteration
+ */
+typedef bool (*mme_app_ue_context_pool_cb_t)(
+    ue_mm_context_t* ue_context_p, void* arg);
+
+/**
+ * Size the mme_ue_s1ap_id index for max_ues. Called by the state manager;
+ * mme_app_ue_context_pool_alloc() initializes the pool with a default size
+ * if it was not done before.
+ */
+status_code_e mme_app_ue_context_pool_init(uint32_t max_ues);
+
+/**
+ * Release the pool memory. Every context must have been freed before.
+ */
+void mme_app_ue_context_pool_destroy(void);
+
+/**
+ * @return a zeroed UE context, NULL on allocation failure
+ */
+ue_mm_context_t* mme_app_ue_context_pool_alloc(void);
+
+/**
+ * Return a context to the pool, invalidating its handles and its entry in
+ * the mme_ue_s1ap_id index. Contexts that were not allocated from the pool
+ * are released with free().
+ */
+void mme_app_ue_context_pool_free(ue_mm_context_t* ue_context_p);
+
+/**
+ * Make ue_context_p reachable by mme_ue_s1ap_id through the pool index.
+ */
+void mme_app_ue_context_pool_bind_ue_id(
+    const ue_mm_context_t* ue_context_p, mme_ue_s1ap_id_t mme_ue_s1ap_id);
+
+/**
+ * @return the context bound to mme_ue_s1ap_id, NULL if the index does not
+ * know about it (never bound, freed or evicted by a colliding id)
+ */
+ue_mm_context_t* mme_app_ue_context_pool_get_by_ue_id(
+    mme_ue_s1ap_id_t mme_ue_s1ap_id);
+
+/**
+ * @return handle of a pooled context, INVALID_MME_APP_UE_CONTEXT_HANDLE for
+ * contexts allocated elsewhere
+ */
+mme_app_ue_context_handle_t mme_app_ue_context_pool_get_handle(
+    const ue_mm_context_t* ue_context_p);
+
+/**
+ * @return the context of handle, NULL if it has been freed since
+ */
+ue_mm_context_t* mme_app_ue_context_pool_get_by_handle(
+    mme_app_ue_context_handle_t handle);
+
+/**
+ * Call cb on every context in use, in slot order.
+ * @return number of contexts visited
+ */
+uint32_t mme_app_ue_context_pool_apply(
+    mme_app_ue_context_pool_cb_t cb, void* arg);
+
+/**
+ * @return number of contexts in use
+ */
+uint32_t mme_app_ue_context_pool_size(void);
+
+#ifdef __cplusplus
+}
+#endif
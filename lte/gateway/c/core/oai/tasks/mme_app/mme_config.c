@@ -247,14 +247,21 @@ void mme_config_init(mme_config_t* config) {
   config->config_file                    = NULL;
   config->max_enbs                       = 2;
   config->max_ues                        = 2;
+  config->max_s11_trxns                  = 256;
   config->unauthenticated_imsi_supported = 0;
   config->relative_capacity              = RELATIVE_CAPACITY;
   config->enable_congestion_control      = true;
-  config->s1ap_zmq_th                    = LONG_MAX;
-  config->mme_app_zmq_congest_th         = LONG_MAX;
-  config->mme_app_zmq_auth_th            = LONG_MAX;
-  config->mme_app_zmq_ident_th           = LONG_MAX;
-  config->mme_app_zmq_smc_th             = LONG_MAX;
+  config->overload_target_delay          = OVERLOAD_TARGET_DELAY;
+  config->overload_interval              = OVERLOAD_INTERVAL;
+  config->mme_app_shards                 = MME_APP_SHARDS;
+  config->ue_state_region_max_ues        = UE_STATE_REGION_MAX_UES;
+  config->auth_vector_cache_max_ues      = AUTH_VECTOR_CACHE_MAX_UES;
+  config->auth_vector_cache_ttl          = AUTH_VECTOR_CACHE_TTL;
+  config->eventd_max_queued_events       = EVENTD_MAX_QUEUED_EVENTS;
+  config->eventd_max_in_flight           = EVENTD_MAX_IN_FLIGHT;
+  config->eventd_max_batch_size          = EVENTD_MAX_BATCH_SIZE;
+  config->eventd_sample_rate             = EVENTD_SAMPLE_RATE;
+  config->grpc_cq_threads                = GRPC_CQ_THREADS;
 
   log_config_init(&config->log_config);
   eps_network_feature_config_init(&config->eps_network_feature_support);
@@ -277,6 +284,7 @@ void mme_config_exit(void) {
   bdestroy_wrapper(&mme_config.log_config.output);
   bdestroy_wrapper(&mme_config.realm);
   bdestroy_wrapper(&mme_config.config_file);
+  bdestroy_wrapper(&mme_config.ue_state_region_dir);
 
   /*
    * IP configuration
@@ -516,6 +524,11 @@ int mme_config_parse_file(mme_config_t* config_pP) {
       config_pP->max_ues = (uint32_t) aint;
     }
 
+    if ((config_setting_lookup_int(
+            setting_mme, MME_CONFIG_STRING_MAX_S11_TRANSACTIONS, &aint))) {
+      config_pP->max_s11_trxns = (uint32_t) aint;
+    }
+
     if ((config_setting_lookup_int(
             setting_mme, MME_CONFIG_STRING_RELATIVE_CAPACITY, &aint))) {
       config_pP->relative_capacity = (uint8_t) aint;
@@ -551,28 +564,88 @@ int mme_config_parse_file(mme_config_t* config_pP) {
     }
 
     if ((config_setting_lookup_int(
-            setting_mme, MME_CONFIG_STRING_S1AP_ZMQ_TH, &aint))) {
-      config_pP->s1ap_zmq_th = (long) aint;
+            setting_mme, MME_CONFIG_STRING_OVERLOAD_TARGET_DELAY, &aint))) {
+      config_pP->overload_target_delay = (long) aint;
+    }
+
+    if ((config_setting_lookup_int(
+            setting_mme, MME_CONFIG_STRING_OVERLOAD_INTERVAL, &aint))) {
+      config_pP->overload_interval = (long) aint;
+    }
+
+    if ((config_setting_lookup_string(
+            setting_mme, MME_CONFIG_STRING_ITTI_TRACING,
+            (const char**) &astring))) {
+      config_pP->itti_tracing = parse_bool(astring);
+    }
+
+    if ((config_setting_lookup_int(
+            setting_mme, MME_CONFIG_STRING_NAS_PROC_TRACE_SAMPLING, &aint))) {
+      config_pP->nas_proc_trace_sampling = (uint32_t) aint;
+    }
+
+    if ((config_setting_lookup_int(
+            setting_mme, MME_CONFIG_STRING_MME_APP_SHARDS, &aint))) {
+      if ((aint < 1) || (aint > MME_APP_SHARDS_MAX)) {
+        OAILOG_WARNING(
+            LOG_CONFIG, "%s %d out of range, using %d\n",
+            MME_CONFIG_STRING_MME_APP_SHARDS, aint,
+            aint < 1 ? 1 : MME_APP_SHARDS_MAX);
+        aint = aint < 1 ? 1 : MME_APP_SHARDS_MAX;
+      }
+      config_pP->mme_app_shards = (uint32_t) aint;
+    }
+
+    if ((config_setting_lookup_string(
+            setting_mme, MME_CONFIG_STRING_UE_STATE_REGION_DIR,
+            (const char**) &astring))) {
+      config_pP->ue_state_region_dir = bfromcstr(astring);
+    }
+
+    if ((config_setting_lookup_int(
+            setting_mme, MME_CONFIG_STRING_UE_STATE_REGION_MAX_UES, &aint))) {
+      config_pP->ue_state_region_max_ues = (uint32_t) aint;
+    }
+
+    if ((config_setting_lookup_int(
+            setting_mme, MME_CONFIG_STRING_AUTH_VECTOR_CACHE_MAX_UES, &aint))) {
+      config_pP->auth_vector_cache_max_ues = (uint32_t) aint;
+    }
+
+    if ((config_setting_lookup_int(
+            setting_mme, MME_CONFIG_STRING_AUTH_VECTOR_CACHE_TTL, &aint))) {
+      config_pP->auth_vector_cache_ttl = (uint32_t) aint;
     }
 
     if ((config_setting_lookup_int(
-            setting_mme, MME_CONFIG_STRING_MME_APP_ZMQ_CONGEST_TH, &aint))) {
-      config_pP->mme_app_zmq_congest_th = (long) aint;
+            setting_mme, MME_CONFIG_STRING_EVENTD_MAX_QUEUED_EVENTS, &aint))) {
+      config_pP->eventd_max_queued_events = (uint32_t) aint;
     }
 
     if ((config_setting_lookup_int(
-            setting_mme, MME_CONFIG_STRING_MME_APP_ZMQ_AUTH_TH, &aint))) {
-      config_pP->mme_app_zmq_auth_th = (long) aint;
+            setting_mme, MME_CONFIG_STRING_EVENTD_MAX_IN_FLIGHT, &aint))) {
+      config_pP->eventd_max_in_flight = (uint32_t) aint;
     }
 
     if ((config_setting_lookup_int(
-            setting_mme, MME_CONFIG_STRING_MME_APP_ZMQ_IDENT_TH, &aint))) {
-      config_pP->mme_app_zmq_ident_th = (long) aint;
+            setting_mme, MME_CONFIG_STRING_EVENTD_MAX_BATCH_SIZE, &aint))) {
+      config_pP->eventd_max_batch_size = (uint32_t) aint;
     }
 
     if ((config_setting_lookup_int(
-            setting_mme, MME_CONFIG_STRING_MME_APP_ZMQ_SMC_TH, &aint))) {
-      config_pP->mme_app_zmq_smc_th = (long) aint;
+            setting_mme, MME_CONFIG_STRING_EVENTD_SAMPLE_RATE, &aint))) {
+      config_pP->eventd_sample_rate = (uint32_t) aint;
+    }
+
+    if ((config_setting_lookup_int(
+            setting_mme, MME_CONFIG_STRING_GRPC_CQ_THREADS, &aint))) {
+      if (aint < 1) {
+        OAILOG_WARNING(
+            LOG_CONFIG, "%s %d out of range, using 1\n",
+            MME_CONFIG_STRING_GRPC_CQ_THREADS, aint);
+        aint = 1;
+      }
+      config_pP->grpc_cq_threads = (uint32_t) aint;
     }
 
     if ((config_setting_lookup_string(
@@ -1634,6 +1707,9 @@ void mme_config_display(mme_config_t* config_pP) {
   OAILOG_INFO(
       LOG_CONFIG, "- Max UEs ..............................: %u\n",
       config_pP->max_ues);
+  OAILOG_INFO(
+      LOG_CONFIG, "- Max S11 transactions .................: %u\n",
+      config_pP->max_s11_trxns);
   OAILOG_INFO(
       LOG_CONFIG, "- IMS voice over PS session in S1 ......: %s\n",
       config_pP->eps_network_feature_support.ims_voice_over_ps_session_in_s1 ==
@@ -1667,29 +1743,52 @@ void mme_config_display(mme_config_t* config_pP) {
       config_pP->enable_congestion_control ? "true" : "false");
   OAILOG_INFO(
       LOG_CONFIG,
-      "- S1AP ZMQ Threshold ...........................: %10ld "
+      "- Overload target delay ........................: %10ld "
       "(microseconds)\n",
-      config_pP->s1ap_zmq_th);
+      config_pP->overload_target_delay);
   OAILOG_INFO(
       LOG_CONFIG,
-      "- MME APP ZMQ Congestion Threshold .............: %10ld "
-      "(microseconds)\n",
-      config_pP->mme_app_zmq_congest_th);
+      "- Overload interval ............................: %10ld "
+      "(microseconds)\n\n",
+      config_pP->overload_interval);
   OAILOG_INFO(
-      LOG_CONFIG,
-      "- MME APP ZMQ Auth Complete Threshold...........: %10ld "
-      "(microseconds)\n",
-      config_pP->mme_app_zmq_auth_th);
+      LOG_CONFIG, "- ITTI tracing .........................: %s\n\n",
+      config_pP->itti_tracing ? "true" : "false");
   OAILOG_INFO(
-      LOG_CONFIG,
-      "- MME APP ZMQ Identity Complete Threshold.......: %10ld "
-      "(microseconds)\n",
-      config_pP->mme_app_zmq_ident_th);
+      LOG_CONFIG, "- NAS procedure trace sampling .........: %u\n\n",
+      config_pP->nas_proc_trace_sampling);
   OAILOG_INFO(
-      LOG_CONFIG,
-      "- MME APP ZMQ SMC Complete Threshold ...........: %10ld "
-      "(microseconds)\n\n",
-      config_pP->mme_app_zmq_smc_th);
+      LOG_CONFIG, "- MME_APP shards .......................: %u\n\n",
+      config_pP->mme_app_shards);
+  OAILOG_INFO(
+      LOG_CONFIG, "- UE state region directory ............: %s\n\n",
+      blength(config_pP->ue_state_region_dir) ?
+          bdata(config_pP->ue_state_region_dir) :
+          "disabled");
+  OAILOG_INFO(
+      LOG_CONFIG, "- UE state region max UEs ..............: %u\n\n",
+      config_pP->ue_state_region_max_ues);
+  OAILOG_INFO(
+      LOG_CONFIG, "- Auth vector cache max UEs ............: %u\n\n",
+      config_pP->auth_vector_cache_max_ues);
+  OAILOG_INFO(
+      LOG_CONFIG, "- Auth vector cache TTL ................: %u (seconds)\n\n",
+      config_pP->auth_vector_cache_ttl);
+  OAILOG_INFO(
+      LOG_CONFIG, "- Eventd max queued events .............: %u\n",
+      config_pP->eventd_max_queued_events);
+  OAILOG_INFO(
+      LOG_CONFIG, "- Eventd max RPCs in flight ............: %u\n",
+      config_pP->eventd_max_in_flight);
+  OAILOG_INFO(
+      LOG_CONFIG, "- Eventd max batch size ................: %u\n",
+      config_pP->eventd_max_batch_size);
+  OAILOG_INFO(
+      LOG_CONFIG, "- Eventd overload sample rate ..........: %u\n\n",
+      config_pP->eventd_sample_rate);
+  OAILOG_INFO(
+      LOG_CONFIG, "- gRPC completion queue threads ........: %u\n\n",
+      config_pP->grpc_cq_threads);
   OAILOG_INFO(
       LOG_CONFIG, "- Use Stateless ........................: %s\n\n",
       config_pP->use_stateless ? "true" : "false");
@@ -19,9 +19,7 @@
 
 #include <cstdlib>
 #include <iostream>
-#include <folly/Format.h>
-#include <folly/json.h>
-#include <folly/dynamic.h>
+#include <string>
 #include <grpcpp/support/status.h>
 
 #include "conversions.h"
@@ -31,8 +29,16 @@
 #include "orc8r/protos/eventd.pb.h"
 
 #include "EventClientAPI.h"
+#include "includes/EventJsonWriter.h"
+
+extern "C" {
+#include "mme_config.h"
+}
 
 using grpc::Status;
+using magma::EventdPipelineConfig;
+using magma::EventJsonWriter;
+using magma::EventOverloadPolicy;
 using magma::lte::init_eventd_client;
 using magma::lte::log_event;
 using magma::orc8r::Event;
@@ -46,7 +52,15 @@ constexpr char S1_SETUP_SUCCESS[] = "s1_setup_success";
 }  // namespace
 
 void event_client_init(void) {
-  init_eventd_client();
+  EventdPipelineConfig config;
+  config.max_queued_events = mme_config.eventd_max_queued_events;
+  config.max_in_flight     = mme_config.eventd_max_in_flight;
+  config.max_batch_size    = mme_config.eventd_max_batch_size;
+  if (mme_config.eventd_sample_rate) {
+    config.overload_policy = EventOverloadPolicy::SAMPLE;
+    config.sample_rate     = mme_config.eventd_sample_rate;
+  }
+  init_eventd_client(config);
 }
 
 /**
@@ -58,14 +72,13 @@ void event_client_init(void) {
  * @return response code
  */
 static int report_event(
-    folly::dynamic& event_value, const std::string& event_type,
+    EventJsonWriter& event_value, const std::string& event_type,
     const std::string& stream_name, const std::string& event_tag) {
   Event event_request = Event();
   event_request.set_event_type(event_type);
   event_request.set_stream_name(stream_name);
 
-  std::string event_value_string = folly::toJson(event_value);
-  event_request.set_value(event_value_string);
+  event_request.set_value(event_value.str());
   event_request.set_tag(event_tag);
   return log_event(event_request);
 }
@@ -74,8 +87,8 @@ int attach_success_event(imsi64_t imsi64) {
   char imsi_str[IMSI_BCD_DIGITS_MAX + 1];
   IMSI64_TO_STRING(imsi64, (char*) imsi_str, IMSI_BCD_DIGITS_MAX);
 
-  folly::dynamic event_value = folly::dynamic::object;
-  event_value["imsi"]        = imsi_str;
+  EventJsonWriter event_value;
+  event_value.add("imsi", imsi_str);
 
   return report_event(event_value, ATTACH_SUCCESS, MME_STREAM_NAME, imsi_str);
 }
@@ -84,25 +97,17 @@ int detach_success_event(imsi64_t imsi64, const char* action) {
   char imsi_str[IMSI_BCD_DIGITS_MAX + 1];
   IMSI64_TO_STRING(imsi64, (char*) imsi_str, IMSI_BCD_DIGITS_MAX);
 
-  folly::dynamic event_value = folly::dynamic::object;
-  event_value["imsi"]        = imsi_str;
-  event_value["action"]      = action;
+  EventJsonWriter event_value;
+  event_value.add("imsi", imsi_str).add("action", action);
 
   return report_event(event_value, DETACH_SUCCESS, MME_STREAM_NAME, imsi_str);
 }
 
 int s1_setup_success_event(const char* enb_name, uint32_t enb_id) {
-  folly::dynamic event_value = folly::dynamic::object;
-
-  if (enb_name) {
-    event_value["enb_name"] = enb_name;
-  } else {
-    event_value["enb_name"] = "";
-  }
-
-  event_value["enb_id"] = enb_id;
+  EventJsonWriter event_value;
+  // A null enb_name is written as ""
+  event_value.add("enb_name", enb_name).add("enb_id", enb_id);
 
   return report_event(
-      event_value, S1_SETUP_SUCCESS, MME_STREAM_NAME,
-      folly::to<std::string>(enb_id));
+      event_value, S1_SETUP_SUCCESS, MME_STREAM_NAME, std::to_string(enb_id));
 }
@@ -26,6 +26,7 @@
 #include "emm_data.h"
 #include "secu_defs.h"
 #include "dynamic_memory_check.h"
+#include "mem_arena.h"
 #include "3gpp_24.301.h"
 #include "KsiAndSequenceNumber.h"
 #include "NasSecurityAlgorithms.h"
@@ -815,7 +816,8 @@ static int nas_message_protected_decode(
     nas_message_decode_status_t* const status) {
   OAILOG_FUNC_IN(LOG_NAS);
   int bytes                      = TLV_BUFFER_TOO_SHORT;
-  unsigned char* const plain_msg = (unsigned char*) calloc(1, length);
+  unsigned char* const plain_msg =
+      (unsigned char*) mem_arena_current_calloc(1, length);
 
   if (plain_msg) {
     /*
@@ -829,7 +831,7 @@ static int nas_message_protected_decode(
      * Decode the decrypted message as plain NAS message
      */
     bytes = nas_message_plain_decode(plain_msg, header, msg, length);
-    free_wrapper((void**) &plain_msg);
+    mem_arena_current_free(plain_msg);
   }
 
   OAILOG_FUNC_RETURN(LOG_NAS, bytes);
@@ -98,6 +98,7 @@
 #include "EpsNetworkFeatureSupport.h"
 #include "TrackingAreaIdentity.h"
 #include "TrackingAreaIdentityList.h"
+#include "nas_proc_span.h"
 
 /****************************************************************************/
 /****************  E X T E R N A L    D E F I N I T I O N S  ****************/
@@ -741,6 +742,7 @@ status_code_e emm_proc_attach_complete(
         OAILOG_FUNC_RETURN(LOG_NAS_EMM, RETURNok);
       }
       emm_ctx = &ue_mm_context->emm_context;
+      nas_proc_span_leg_end(emm_ctx, NAS_PROC_LEG_COMPLETE);
       /*
        * Upon receiving an ATTACH COMPLETE message, the MME shall enter state
        * EMM-REGISTERED and consider the GUTI sent in the ATTACH ACCEPT message
@@ -830,6 +832,7 @@ status_code_e emm_proc_attach_complete(
      * Set the network attachment indicator
      */
     ue_mm_context->emm_context.is_attached = true;
+    attach_proc->attach_complete_received  = true;
     /*
      * Notify EMM that attach procedure has successfully completed
      */
@@ -1956,6 +1959,7 @@ static int emm_send_attach_accept(emm_context_t* emm_context) {
           attach_proc->emm_spec_proc.emm_proc.base_proc.time_out,
           (void*) emm_context);
       attach_proc->attach_accept_sent++;
+      nas_proc_span_accepted(emm_context);
     }
   } else {
     OAILOG_WARNING(LOG_NAS_EMM, "ue_mm_context NULL\n");
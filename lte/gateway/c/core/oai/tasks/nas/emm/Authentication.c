@@ -52,15 +52,13 @@
 #include "security_types.h"
 #include "intertask_interface.h"
 #include "nas_proc.h"
+#include "mme_app_overload.h"
+#include "mme_app_auth_vector_cache.h"
+#include "nas_proc_span.h"
 
 /****************************************************************************/
 /****************  E X T E R N A L    D E F I N I T I O N S  ****************/
 /****************************************************************************/
-extern long mme_app_last_msg_latency;
-extern long pre_mme_task_msg_latency;
-extern bool mme_congestion_control_enabled;
-extern mme_congestion_params_t mme_congestion_params;
-
 /****************************************************************************/
 /*******************  L O C A L    D E F I N I T I O N S  *******************/
 /****************************************************************************/
@@ -289,6 +287,19 @@ status_code_e emm_proc_authentication(
 
     bool run_auth_info_proc = false;
     if (!IS_EMM_CTXT_VALID_AUTH_VECTORS(emm_context)) {
+      // A vector spared by a previous AIA saves the S6a round trip
+      ksi_t eksi =
+          get_nas_cn_procedure_auth_info(emm_context) ?
+              KSI_NO_KEY_AVAILABLE :
+              emm_proc_authentication_load_cached_vector(emm_context);
+      if (eksi != KSI_NO_KEY_AVAILABLE) {
+        rc = emm_proc_authentication_ksi(
+            emm_context, emm_specific_proc, eksi,
+            emm_context->_vector[eksi % MAX_EPS_AUTH_VECTORS].rand,
+            emm_context->_vector[eksi % MAX_EPS_AUTH_VECTORS].autn, success,
+            failure);
+        OAILOG_FUNC_RETURN(LOG_NAS_EMM, rc);
+      }
       // Ask upper layer to fetch new security context
       nas_auth_info_proc_t* auth_info_proc =
           get_nas_cn_procedure_auth_info(emm_context);
@@ -368,14 +379,38 @@ static int start_authentication_information_procedure(
   nas_start_Ts6a_auth_info(
       auth_info_proc->ue_id, &auth_info_proc->timer_s6a,
       auth_info_proc->cn_proc.base_proc.time_out, emm_context);
+  nas_proc_span_leg_begin(emm_context, NAS_PROC_LEG_S6A_AIR);
 
   nas_itti_auth_info_req(
       ue_id, &emm_context->_imsi, is_initial_req, &visited_plmn,
-      MAX_EPS_AUTH_VECTORS, auts, emm_context->_ue_network_capability.dcnr);
+      mme_app_auth_vector_cache_vectors_per_air(), auts,
+      emm_context->_ue_network_capability.dcnr);
 
   OAILOG_FUNC_RETURN(LOG_NAS_EMM, RETURNok);
 }
 
+//------------------------------------------------------------------------------
+ksi_t emm_proc_authentication_load_cached_vector(
+    struct emm_context_s* emm_ctx) {
+  auth_vector_t vector = {0};
+
+  if (!mme_app_auth_vector_cache_take(emm_ctx->_imsi64, &vector)) {
+    return KSI_NO_KEY_AVAILABLE;
+  }
+  // Stored where auth_info_proc_success_cb stores the first vector of an AIA
+  ksi_t eksi = 0;
+  if (emm_ctx->_security.eksi < KSI_NO_KEY_AVAILABLE) {
+    REQUIREMENT_3GPP_24_301(R10_5_4_2_4__2);
+    eksi = (emm_ctx->_security.eksi + 1) % (EKSI_MAX_VALUE + 1);
+  }
+  int destination_index               = eksi % MAX_EPS_AUTH_VECTORS;
+  emm_ctx->_vector[destination_index] = vector;
+  emm_ctx_set_attribute_valid(
+      emm_ctx, EMM_CTXT_MEMBER_AUTH_VECTOR0 + destination_index);
+  emm_ctx_set_attribute_present(emm_ctx, EMM_CTXT_MEMBER_AUTH_VECTORS);
+  return eksi;
+}
+
 //------------------------------------------------------------------------------
 static int start_authentication_information_procedure_synch(
     struct emm_context_s* emm_context, nas_emm_auth_proc_t* const auth_proc,
@@ -626,6 +661,14 @@ status_code_e emm_proc_authentication_failure(
   nas_emm_auth_proc_t* auth_proc =
       get_nas_common_procedure_authentication(emm_ctx);
 
+  // The cached vectors of the IMSI are out of the SQN range of the USIM on a
+  // synchronisation failure, and may have been fetched for another IMSI on a
+  // MAC failure
+  if ((emm_cause == EMM_CAUSE_SYNCH_FAILURE) ||
+      (emm_cause == EMM_CAUSE_MAC_FAILURE)) {
+    mme_app_auth_vector_cache_remove(emm_ctx->_imsi64);
+  }
+
   if (auth_proc) {
     // Stop timer T3460
     REQUIREMENT_3GPP_24_301(R10_5_4_2_4__3);
@@ -905,18 +948,14 @@ status_code_e emm_proc_authentication_complete(
       OAILOG_FUNC_RETURN(LOG_NAS_EMM, RETURNok);
     }
 
-    /* If spent too much in ZMQ, then discard the packet.
-     * MME is congested and this would create some relief in processing.
+    /* If the MME is overloaded, then discard the packet.
+     * This would create some relief in processing.
      */
-    if (mme_congestion_control_enabled &&
-        (mme_app_last_msg_latency + pre_mme_task_msg_latency >
-         MME_APP_ZMQ_LATENCY_AUTH_TH)) {
+    if (!mme_overload_admit(MME_ADMISSION_ONGOING)) {
       OAILOG_WARNING_UE(
           LOG_NAS_EMM, emm_ctx->_imsi64,
-          "Discarding authentication complete as cumulative ZMQ latency "
-          "( %ld + %ld ) for ueid " MME_UE_S1AP_ID_FMT
-          " is higher than the threshold.",
-          mme_app_last_msg_latency, pre_mme_task_msg_latency, ue_id);
+          "Discarding authentication complete for ueid " MME_UE_S1AP_ID_FMT
+          " as the MME is overloaded.", ue_id);
       OAILOG_FUNC_RETURN(LOG_NAS_EMM, RETURNok);
     }
 
@@ -924,6 +963,7 @@ status_code_e emm_proc_authentication_complete(
     REQUIREMENT_3GPP_24_301(R10_5_4_2_4__1);
     void* callback_arg = NULL;
     nas_stop_T3460(ue_id, &auth_proc->T3460, callback_arg);
+    nas_proc_span_leg_end(emm_ctx, NAS_PROC_LEG_AUTH);
     REQUIREMENT_3GPP_24_301(R10_5_4_2_4__2);
     emm_ctx_set_security_eksi(emm_ctx, auth_proc->ksi);
 
@@ -1282,6 +1322,7 @@ static int authentication_request(
             auth_proc->ue_id, &auth_proc->T3460,
             auth_proc->emm_com_proc.emm_proc.base_proc.time_out,
             (void*) emm_ctx);
+        nas_proc_span_leg_begin(emm_ctx, NAS_PROC_LEG_AUTH);
       }
     }
   }
@@ -43,15 +43,11 @@
 #include "mme_app_state.h"
 #include "nas_procedures.h"
 #include "nas_proc.h"
+#include "mme_app_overload.h"
 
 /****************************************************************************/
 /****************  E X T E R N A L    D E F I N I T I O N S  ****************/
 /****************************************************************************/
-extern long mme_app_last_msg_latency;
-extern long pre_mme_task_msg_latency;
-extern bool mme_congestion_control_enabled;
-extern mme_congestion_params_t mme_congestion_params;
-
 extern int check_plmn_restriction(imsi_t imsi);
 extern int validate_imei(imeisv_t* imeisv);
 /****************************************************************************/
@@ -235,18 +231,14 @@ status_code_e emm_proc_identification_complete(
         OAILOG_FUNC_RETURN(LOG_NAS_EMM, RETURNok);
       }
 
-      /* If spent too much in ZMQ, then discard the packet.
-       * MME is congested and this would create some relief in processing.
+      /* If the MME is overloaded, then discard the packet.
+       * This would create some relief in processing.
        */
-      if (mme_congestion_control_enabled &&
-          (mme_app_last_msg_latency + pre_mme_task_msg_latency >
-           MME_APP_ZMQ_LATENCY_IDENT_TH)) {
+      if (!mme_overload_admit(MME_ADMISSION_ONGOING)) {
         OAILOG_WARNING_UE(
             LOG_NAS_EMM, emm_ctx->_imsi64,
-            "Discarding identification complete as cumulative ZMQ latency "
-            "( %ld + %ld ) for ueid " MME_UE_S1AP_ID_FMT
-            " is higher than the threshold.",
-            mme_app_last_msg_latency, pre_mme_task_msg_latency, ue_id);
+            "Discarding identification complete for ueid " MME_UE_S1AP_ID_FMT
+            " as the MME is overloaded.", ue_id);
         OAILOG_FUNC_RETURN(LOG_NAS_EMM, RETURNok);
       }
 
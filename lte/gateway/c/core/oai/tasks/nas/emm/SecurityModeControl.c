@@ -75,15 +75,12 @@
 #include "security_types.h"
 #include "mme_app_defs.h"
 #include "conversions.h"
+#include "mme_app_overload.h"
+#include "nas_proc_span.h"
 
 /****************************************************************************/
 /****************  E X T E R N A L    D E F I N I T I O N S  ****************/
 /****************************************************************************/
-extern long mme_app_last_msg_latency;
-extern long pre_mme_task_msg_latency;
-extern bool mme_congestion_control_enabled;
-extern mme_congestion_params_t mme_congestion_params;
-
 /****************************************************************************/
 /*******************  L O C A L    D E F I N I T I O N S  *******************/
 /****************************************************************************/
@@ -507,17 +504,14 @@ status_code_e emm_proc_security_mode_complete(
       OAILOG_FUNC_RETURN(LOG_NAS_EMM, RETURNok);
     }
 
-    /* If spent too much in ZMQ, then discard the packet.
-     * MME is congested and this would create some relief in processing.
+    /* If the MME is overloaded, then discard the packet.
+     * This would create some relief in processing.
      */
-    if (mme_congestion_control_enabled &&
-        (mme_app_last_msg_latency + pre_mme_task_msg_latency >
-         MME_APP_ZMQ_LATENCY_SMC_TH)) {
+    if (!mme_overload_admit(MME_ADMISSION_ONGOING)) {
       OAILOG_WARNING_UE(
           LOG_NAS_EMM, emm_ctx->_imsi64,
-          "Discarding SMC complete as cumulative ZMQ latency ( %ld + %ld ) for "
-          "ueid " MME_UE_S1AP_ID_FMT " is higher than the threshold.",
-          mme_app_last_msg_latency, pre_mme_task_msg_latency, ue_id);
+          "Discarding SMC complete for ueid " MME_UE_S1AP_ID_FMT
+          " as the MME is overloaded.", ue_id);
       OAILOG_FUNC_RETURN(LOG_NAS_EMM, RETURNok);
     }
 
@@ -528,6 +522,7 @@ status_code_e emm_proc_security_mode_complete(
 
     void* timer_callback_arg = NULL;
     nas_stop_T3460(ue_id, &smc_proc->T3460, timer_callback_arg);
+    nas_proc_span_leg_end(emm_ctx, NAS_PROC_LEG_SMC);
 
     /* If MME requested for imeisv in security mode cmd
      * and UE did not include the same in security mode complete,
@@ -882,6 +877,7 @@ static int security_request(nas_emm_smc_proc_t* const smc_proc) {
       nas_start_T3460(
           smc_proc->ue_id, &smc_proc->T3460,
           smc_proc->emm_com_proc.emm_proc.base_proc.time_out, emm_ctx);
+      nas_proc_span_leg_begin(emm_ctx, NAS_PROC_LEG_SMC);
     }
   }
   OAILOG_FUNC_RETURN(LOG_NAS_EMM, rc);
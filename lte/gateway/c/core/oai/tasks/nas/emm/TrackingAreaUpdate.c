@@ -52,6 +52,7 @@
 #include "nas_procedures.h"
 #include "mme_app_itti_messaging.h"
 #include "mme_app_defs.h"
+#include "nas_proc_span.h"
 
 /****************************************************************************/
 /****************  E X T E R N A L    D E F I N I T I O N S  ****************/
@@ -736,6 +737,7 @@ static int emm_tracking_area_update_accept(nas_emm_tau_proc_t* const tau_proc) {
 
       // Check if new TMSI is allocated as part of Combined TAU
       if (rc != RETURNerror) {
+        nas_proc_span_accepted(emm_context);
         if ((emm_sap.u.emm_as.u.establish.new_guti != NULL) ||
             (emm_context->csfbparams.newTmsiAllocated)) {
           /*
@@ -820,6 +822,9 @@ static int emm_tracking_area_update_accept(nas_emm_tau_proc_t* const tau_proc) {
       rc                = emm_sap_send(&emm_sap);
       increment_counter(
           "tracking_area_update", 1, 1, "action", "tau_accept_sent");
+      if (rc != RETURNerror) {
+        nas_proc_span_accepted(emm_context);
+      }
 
       // Start T3450 timer if new TMSI is allocated
       if (emm_context->csfbparams.newTmsiAllocated) {
@@ -926,6 +931,7 @@ void free_emm_tau_request_ies(emm_tau_request_ies_t** const ies) {
     free_wrapper((void**) &((*ies)->mobile_station_classmark3));
   }
   if ((*ies)->supported_codecs) {
+    bdestroy_wrapper((*ies)->supported_codecs);
     free_wrapper((void**) &((*ies)->supported_codecs));
   }
   if ((*ies)->additional_updatetype) {
@@ -987,6 +993,7 @@ status_code_e emm_proc_tau_complete(mme_ue_s1ap_id_t ue_id) {
           LOG_NAS_EMM,
           "EMM-PROC  - Stop timer T3450 for ue id " MME_UE_S1AP_ID_FMT "\n",
           ue_id);
+      nas_proc_span_leg_end(emm_ctx, NAS_PROC_LEG_COMPLETE);
       if (emm_ctx->csfbparams.newTmsiAllocated) {
         nas_delete_tau_procedure(emm_ctx);
       }
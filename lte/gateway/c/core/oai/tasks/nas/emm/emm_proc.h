@@ -274,6 +274,14 @@ status_code_e emm_proc_authentication(
     nas_emm_specific_proc_t* const emm_specific_proc, success_cb_t success,
     failure_cb_t failure);
 
+/*
+ * Takes a vector spared by a previous AIA of the IMSI from the auth vector
+ * cache, stored as the vector of the returned eKSI, KSI_NO_KEY_AVAILABLE when
+ * none is cached
+ */
+ksi_t emm_proc_authentication_load_cached_vector(
+    struct emm_context_s* emm_ctx);
+
 status_code_e emm_proc_authentication_failure(
     mme_ue_s1ap_id_t ue_id, int emm_cause, const_bstring auts);
 
@@ -52,6 +52,7 @@ int decode_attach_request(
 
   decoded++;
 
+  CHECK_LV_LENGTH_DECODER_FOR_MANDATORY_IE(buffer + decoded, len - decoded, 1)
   if ((decoded_result = decode_eps_mobile_identity(
            &attach_request->oldgutiorimsi, 0, buffer + decoded,
            len - decoded)) < 0) {
@@ -59,6 +60,7 @@ int decode_attach_request(
   } else
     decoded += decoded_result;
 
+  CHECK_LV_LENGTH_DECODER_FOR_MANDATORY_IE(buffer + decoded, len - decoded, 2)
   if ((decoded_result = decode_ue_network_capability(
            &attach_request->uenetworkcapability, 0, buffer + decoded,
            len - decoded)) < 0) {
@@ -68,6 +70,7 @@ int decode_attach_request(
   else
     decoded += decoded_result;
 
+  CHECK_LV_E_LENGTH_DECODER_FOR_MANDATORY_IE(buffer + decoded, len - decoded)
   if ((decoded_result = decode_esm_message_container(
            &attach_request->esmmessagecontainer, 0, buffer + decoded,
            len - decoded)) < 0) {
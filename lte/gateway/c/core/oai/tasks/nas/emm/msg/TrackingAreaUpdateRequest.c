@@ -50,6 +50,7 @@ int decode_tracking_area_update_request(
 
   decoded++;
 
+  CHECK_LV_LENGTH_DECODER_FOR_MANDATORY_IE(buffer + decoded, len - decoded, 1)
   if ((decoded_result = decode_eps_mobile_identity(
            &tracking_area_update_request->oldguti, 0, buffer + decoded,
            len - decoded)) < 0)
@@ -24,6 +24,7 @@
 #include "bstrlib.h"
 #include "dynamic_memory_check.h"
 #include "log.h"
+#include "mem_arena.h"
 #include "common_defs.h"
 #include "3gpp_requirements_24.301.h"
 #include "common_types.h"
@@ -637,7 +638,9 @@ static int emm_as_data_ind(emm_as_data_t* msg, int* emm_cause) {
       /*
        * Process the received NAS message
        */
-      bstring plain_msg = bstrcpy(msg->nas_msg);
+      mem_arena_t* arena = mem_arena_get_current();
+      bstring plain_msg  = arena ? mem_arena_bstrcpy(arena, msg->nas_msg) :
+                                  bstrcpy(msg->nas_msg);
 
       if (plain_msg) {
         nas_message_security_header_t header = {0};
@@ -48,17 +48,14 @@
 #include "emm_asDef.h"
 #include "emm_data.h"
 #include "mme_api.h"
+#include "mme_app_overload.h"
 #include "mme_app_ue_context.h"
+#include "mem_arena.h"
 #include "nas_procedures.h"
 
 /****************************************************************************/
 /****************  E X T E R N A L    D E F I N I T I O N S  ****************/
 /****************************************************************************/
-extern long mme_app_last_msg_latency;
-extern long pre_mme_task_msg_latency;
-extern bool mme_congestion_control_enabled;
-extern mme_congestion_params_t mme_congestion_params;
-
 /****************************************************************************/
 /*******************  L O C A L    D E F I N I T I O N S  *******************/
 /****************************************************************************/
@@ -211,19 +208,13 @@ status_code_e emm_recv_attach_request(
   }
 
   /*
-   * Handle MME congestion if it's enabled
+   * New sessions are the first ones rejected when the MME is overloaded
    */
-  // Currently a simple logic, when a more complex logic added
-  // refactor this part via helper functions is_mme_congested.
-  if (mme_congestion_control_enabled &&
-      (mme_app_last_msg_latency + pre_mme_task_msg_latency >
-       MME_APP_ZMQ_LATENCY_CONGEST_TH)) {
+  if (!mme_overload_admit(MME_ADMISSION_NEW)) {
     OAILOG_WARNING(
         LOG_NAS_EMM,
         "EMMAS-SAP - Sending Attach Reject for ue_id = (%08x), emm_cause = "
-        "(EMM_CAUSE_CONGESTION) last packet latency: %ld prev hop latency: "
-        "%ld\n",
-        ue_id, mme_app_last_msg_latency, pre_mme_task_msg_latency);
+        "(EMM_CAUSE_CONGESTION) as the MME is overloaded\n", ue_id);
     rc         = emm_proc_attach_reject(ue_id, EMM_CAUSE_CONGESTION);
     *emm_cause = EMM_CAUSE_SUCCESS;
     OAILOG_FUNC_RETURN(LOG_NAS_EMM, rc);
@@ -397,7 +388,8 @@ status_code_e emm_recv_attach_request(
   if (msg->presencemask & ATTACH_REQUEST_ADDITIONAL_UPDATE_TYPE_PRESENT) {
     params->additional_update_type = msg->additionalupdatetype;
   }
-  params->esm_msg          = msg->esmmessagecontainer;
+  // The ESM container is handled once the UE is authenticated
+  params->esm_msg          = mem_arena_bstr_persist(msg->esmmessagecontainer);
   msg->esmmessagecontainer = NULL;
 
   params->decode_status = *decode_status;
@@ -599,6 +591,20 @@ status_code_e emm_recv_tracking_area_update_request(
       (decode_status->integrity_protected_message) ? "yes" : "no",
       (decode_status->mac_matched) ? "yes" : "no",
       (decode_status->ciphered_message) ? "yes" : "no");
+  if (is_initial && !mme_overload_admit(MME_ADMISSION_NEW)) {
+    OAILOG_WARNING(
+        LOG_NAS_EMM,
+        "EMMAS-SAP - Sending Tracking Area Update Reject for ue_id = (%08x), "
+        "emm_cause = (EMM_CAUSE_CONGESTION) as the MME is overloaded\n",
+        ue_id);
+    rc = emm_proc_tracking_area_update_reject(ue_id, EMM_CAUSE_CONGESTION);
+    increment_counter(
+        "tracking_area_update", 1, 2, "result", "failure", "cause",
+        "congestion");
+    *emm_cause = EMM_CAUSE_SUCCESS;
+    OAILOG_FUNC_RETURN(LOG_NAS_EMM, rc);
+  }
+
   /* Basic Periodic TAU Request handling is supported. Only mandatory IEs are
    * supported
    * TODO - Add support for re-auth during TAU , Implicit GUTI Re-allocation &
@@ -695,10 +701,9 @@ status_code_e emm_recv_tracking_area_update_request(
   }
   if (msg->presencemask &
       TRACKING_AREA_UPDATE_REQUEST_SUPPORTED_CODECS_PRESENT) {
-    ies->supported_codecs = calloc(1, sizeof(*ies->supported_codecs));
-    memcpy(
-        ies->supported_codecs, &msg->supportedcodecs,
-        sizeof(*ies->supported_codecs));
+    ies->supported_codecs  = calloc(1, sizeof(*ies->supported_codecs));
+    *ies->supported_codecs = mem_arena_bstr_persist(msg->supportedcodecs);
+    msg->supportedcodecs   = NULL;
   }
   if (msg->presencemask &
       TRACKING_AREA_UPDATE_REQUEST_ADDITIONAL_UPDATE_TYPE_PRESENT) {
@@ -41,6 +41,7 @@
 #include "mme_app_apn_selection.h"
 #include "mme_app_itti_messaging.h"
 #include "mme_app_state.h"
+#include "mem_arena.h"
 
 /****************************************************************************/
 /****************  E X T E R N A L    D E F I N I T I O N S  ****************/
@@ -254,15 +255,15 @@ esm_cause_t esm_recv_pdn_connectivity_request(
   if (msg->presencemask & PDN_CONNECTIVITY_REQUEST_ACCESS_POINT_NAME_PRESENT) {
     if (esm_data->apn) bdestroy_wrapper(&esm_data->apn);
     if (mme_config.nas_config.enable_apn_correction) {
-      esm_data->apn = mme_app_process_apn_correction(
-          &(emm_context->_imsi), msg->accesspointname);
+      esm_data->apn = mem_arena_bstr_persist(mme_app_process_apn_correction(
+          &(emm_context->_imsi), msg->accesspointname));
       OAILOG_INFO(
           LOG_NAS_ESM,
           "ESM-SAP   - APN CORRECTION (apn = %s) for ue id " MME_UE_S1AP_ID_FMT
           "\n",
           (const char*) bdata(esm_data->apn), ue_id);
     } else {
-      esm_data->apn = msg->accesspointname;
+      esm_data->apn = mem_arena_bstr_persist(msg->accesspointname);
     }
   }
 
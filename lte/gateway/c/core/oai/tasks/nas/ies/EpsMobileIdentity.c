@@ -60,9 +60,11 @@ int decode_eps_mobile_identity(
     decoded_rc = decode_imsi_eps_mobile_identity(
         &epsmobileidentity->imsi, buffer, ielen);
   } else if (typeofidentity == EPS_MOBILE_IDENTITY_GUTI) {
+    CHECK_LENGTH_DECODER(ielen, EPS_MOBILE_IDENTITY_GUTI_LENGTH);
     decoded_rc = decode_guti_eps_mobile_identity(
         &epsmobileidentity->guti, buffer + decoded);
   } else if (typeofidentity == EPS_MOBILE_IDENTITY_IMEI) {
+    CHECK_LENGTH_DECODER(ielen, EPS_MOBILE_IDENTITY_IMEI_LENGTH);
     decoded_rc = decode_imei_eps_mobile_identity(
         &epsmobileidentity->imei, buffer + decoded);
   }
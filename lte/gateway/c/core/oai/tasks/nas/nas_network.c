@@ -20,6 +20,7 @@
 #include "nas_network.h"
 #include "nas_timer.h"
 #include "nas_proc.h"
+#include "nas_proc_span.h"
 
 /****************************************************************************/
 /****************  E X T E R N A L    D E F I N I T I O N S  ****************/
@@ -54,6 +55,7 @@ void nas_network_initialize(const mme_config_t* mme_config_p) {
    */
   nas_timer_init();
   nas_proc_initialize(mme_config_p);
+  nas_proc_span_init(mme_config_p->nas_proc_trace_sampling);
   OAILOG_FUNC_OUT(LOG_NAS);
 }
 
@@ -46,6 +46,7 @@
 #include "esm_main.h"
 #include "s6a_defs.h"
 #include "mme_app_ue_context.h"
+#include "mme_app_auth_vector_cache.h"
 #include "3gpp_24.008.h"
 #include "3gpp_33.401.h"
 #include "DetachRequest.h"
@@ -57,6 +58,7 @@
 #include "mme_api.h"
 #include "mme_app_state.h"
 #include "nas_procedures.h"
+#include "nas_proc_span.h"
 #include "service303.h"
 #include "sgs_messages_types.h"
 
@@ -367,24 +369,31 @@ status_code_e nas_proc_authentication_info_answer(
       "Received Authentication Information Answer from S6A for"
       " ue_id = " MME_UE_S1AP_ID_FMT "\n",
       mme_ue_s1ap_id);
+  nas_proc_span_leg_end(emm_ctxt_p, NAS_PROC_LEG_S6A_AIR);
   if ((aia->result.present == S6A_RESULT_BASE) &&
       (aia->result.choice.base == DIAMETER_SUCCESS)) {
     /*
-     * Check that list is not empty and contain at most MAX_EPS_AUTH_VECTORS
-     * elements
+     * Check that list is not empty and contain at most
+     * MAX_EPS_AUTH_VECTORS_PER_AIR elements
      */
     DevCheck(
-        aia->auth_info.nb_of_vectors <= MAX_EPS_AUTH_VECTORS,
-        aia->auth_info.nb_of_vectors, MAX_EPS_AUTH_VECTORS, 0);
+        aia->auth_info.nb_of_vectors <= MAX_EPS_AUTH_VECTORS_PER_AIR,
+        aia->auth_info.nb_of_vectors, MAX_EPS_AUTH_VECTORS_PER_AIR, 0);
     DevCheck(
         aia->auth_info.nb_of_vectors > 0, aia->auth_info.nb_of_vectors, 1, 0);
 
     OAILOG_DEBUG(
         LOG_NAS_EMM, "INFORMING NAS ABOUT AUTH RESP SUCCESS got %u vector(s)\n",
         aia->auth_info.nb_of_vectors);
+    // NAS takes the first vectors, the spare ones are cached
+    uint8_t nb_vectors = aia->auth_info.nb_of_vectors < MAX_EPS_AUTH_VECTORS ?
+                             aia->auth_info.nb_of_vectors :
+                             MAX_EPS_AUTH_VECTORS;
+    mme_app_auth_vector_cache_put(
+        imsi64, &aia->auth_info.eutran_vector[nb_vectors],
+        aia->auth_info.nb_of_vectors - nb_vectors);
     rc = nas_proc_auth_param_res(
-        mme_ue_s1ap_id, aia->auth_info.nb_of_vectors,
-        aia->auth_info.eutran_vector);
+        mme_ue_s1ap_id, nb_vectors, aia->auth_info.eutran_vector);
   } else {
     OAILOG_ERROR(LOG_NAS_EMM, "INFORMING NAS ABOUT AUTH RESP ERROR CODE\n");
     increment_counter(
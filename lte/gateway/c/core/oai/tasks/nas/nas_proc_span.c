@@ -0,0 +1,262 @@
+/**
+ * Copyright 2020 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define _GNU_SOURCE
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "nas_proc_span.h"
+#include "log.h"
+#include "mme_app_ue_context.h"
+#include "nas_procedures.h"
+#include "service303.h"
+
+#define PROC_LATENCY_METRIC "mme_procedure_latency_ms"
+#define PROC_LEG_LATENCY_METRIC "mme_procedure_leg_latency_ms"
+
+typedef struct nas_proc_trace_record_s {
+  uint64_t end_usec;
+  const char* proc;
+  mme_ue_s1ap_id_t ue_id;
+  imsi64_t imsi64;
+  bool success;
+  uint32_t usec;
+  uint32_t leg_usec[NAS_PROC_LEG_MAX];
+} nas_proc_trace_record_t;
+
+// Updated by all the MME_APP shards, hence atomically
+typedef struct nas_proc_totals_s {
+  uint64_t count;
+  uint64_t usec;
+  uint64_t leg_count[NAS_PROC_LEG_MAX];
+  uint64_t leg_usec[NAS_PROC_LEG_MAX];
+} nas_proc_totals_t;
+
+static uint32_t trace_sampling = 0;
+static nas_proc_totals_t totals;
+static uint64_t ended;
+static pthread_mutex_t trace_lock = PTHREAD_MUTEX_INITIALIZER;
+static uint64_t trace_recorded;
+static nas_proc_trace_record_t trace[NAS_PROC_SPAN_TRACE_SIZE];
+
+static uint64_t monotonic_usec(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t) ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static nas_proc_span_t* get_running_span(
+    struct emm_context_s* emm_context, const char** proc) {
+  nas_emm_attach_proc_t* attach_proc =
+      get_nas_specific_procedure_attach(emm_context);
+  if (attach_proc) {
+    *proc = "attach";
+    return &attach_proc->span;
+  }
+  nas_emm_tau_proc_t* tau_proc = get_nas_specific_procedure_tau(emm_context);
+  if (tau_proc) {
+    *proc = "tau";
+    return &tau_proc->span;
+  }
+  return NULL;
+}
+
+static void record_span(
+    struct emm_context_s* emm_context, const nas_proc_span_t* span,
+    const char* proc, bool success, uint64_t now) {
+  ue_mm_context_t* ue_mm_context =
+      PARENT_STRUCT(emm_context, struct ue_mm_context_s, emm_context);
+
+  pthread_mutex_lock(&trace_lock);
+  nas_proc_trace_record_t* record =
+      &trace[trace_recorded % NAS_PROC_SPAN_TRACE_SIZE];
+  record->end_usec = now;
+  record->proc     = proc;
+  record->ue_id    = ue_mm_context->mme_ue_s1ap_id;
+  record->imsi64   = emm_context->_imsi64;
+  record->success  = success;
+  record->usec     = (uint32_t)(now - span->start_usec);
+  for (int leg = 0; leg < NAS_PROC_LEG_MAX; leg++) {
+    record->leg_usec[leg] = (uint32_t) span->leg_usec[leg];
+  }
+  trace_recorded++;
+  pthread_mutex_unlock(&trace_lock);
+}
+
+void nas_proc_span_init(uint32_t sampling) {
+  trace_sampling = sampling;
+  memset(&totals, 0, sizeof(totals));
+  ended = 0;
+  pthread_mutex_lock(&trace_lock);
+  trace_recorded = 0;
+  pthread_mutex_unlock(&trace_lock);
+  if (trace_sampling > 0) {
+    service303_set_service_info_dump(
+        "nas_proc_trace", nas_proc_span_dump_to_string);
+  }
+}
+
+void nas_proc_span_start(nas_proc_span_t* span) {
+  memset(span, 0, sizeof(*span));
+  span->start_usec = monotonic_usec();
+}
+
+void nas_proc_span_end(
+    struct emm_context_s* emm_context, nas_proc_span_t* span, const char* proc,
+    bool success) {
+  if (span->start_usec == 0) {
+    return;
+  }
+  uint64_t now  = monotonic_usec();
+  uint64_t usec = now - span->start_usec;
+
+  observe_histogram(
+      PROC_LATENCY_METRIC, usec / 1000., 2, "proc", proc, "result",
+      success ? "success" : "failure", (size_t) 8, 10., 50., 100., 500.,
+      1000., 2000., 5000., 10000.);
+  // The share of the legs is taken over the completed procedures only
+  if (success) {
+    __atomic_fetch_add(&totals.count, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&totals.usec, usec, __ATOMIC_RELAXED);
+    for (int leg = 0; leg < NAS_PROC_LEG_MAX; leg++) {
+      if (span->leg_usec[leg] > 0) {
+        __atomic_fetch_add(&totals.leg_count[leg], 1, __ATOMIC_RELAXED);
+        __atomic_fetch_add(
+            &totals.leg_usec[leg], span->leg_usec[leg], __ATOMIC_RELAXED);
+      }
+    }
+  }
+  if (trace_sampling > 0 &&
+      __atomic_fetch_add(&ended, 1, __ATOMIC_RELAXED) % trace_sampling == 0) {
+    record_span(emm_context, span, proc, success, now);
+  }
+}
+
+void nas_proc_span_leg_begin(
+    struct emm_context_s* emm_context, nas_proc_leg_t leg) {
+  const char* proc      = NULL;
+  nas_proc_span_t* span = get_running_span(emm_context, &proc);
+
+  if (span && span->start_usec != 0 && span->leg_start_usec[leg] == 0) {
+    span->leg_start_usec[leg] = monotonic_usec();
+  }
+}
+
+void nas_proc_span_leg_end(
+    struct emm_context_s* emm_context, nas_proc_leg_t leg) {
+  const char* proc      = NULL;
+  nas_proc_span_t* span = get_running_span(emm_context, &proc);
+
+  if (span == NULL || span->leg_start_usec[leg] == 0) {
+    return;
+  }
+  uint64_t usec = monotonic_usec() - span->leg_start_usec[leg];
+
+  span->leg_start_usec[leg] = 0;
+  span->leg_usec[leg] += usec;
+  observe_histogram(
+      PROC_LEG_LATENCY_METRIC, usec / 1000., 2, "proc", proc, "leg",
+      nas_proc_leg2str(leg), (size_t) 8, 1., 5., 10., 50., 100., 500., 1000.,
+      5000.);
+}
+
+void nas_proc_span_accepted(struct emm_context_s* emm_context) {
+  const char* proc      = NULL;
+  nas_proc_span_t* span = get_running_span(emm_context, &proc);
+
+  if (span) {
+    span->accepted = true;
+    nas_proc_span_leg_begin(emm_context, NAS_PROC_LEG_COMPLETE);
+  }
+}
+
+static void dump_trace(FILE* stream) {
+  uint64_t count = __atomic_load_n(&totals.count, __ATOMIC_RELAXED);
+  uint64_t usec  = __atomic_load_n(&totals.usec, __ATOMIC_RELAXED);
+  uint64_t now   = monotonic_usec();
+
+  fprintf(
+      stream, "%lu completed procedures, %lu us on average\n", count,
+      count ? usec / count : 0);
+  for (int leg = 0; leg < NAS_PROC_LEG_MAX; leg++) {
+    uint64_t leg_count =
+        __atomic_load_n(&totals.leg_count[leg], __ATOMIC_RELAXED);
+    uint64_t leg_usec =
+        __atomic_load_n(&totals.leg_usec[leg], __ATOMIC_RELAXED);
+    fprintf(
+        stream, "  %s: %lu procedures, %lu us on average, %lu%% of the time\n",
+        nas_proc_leg2str(leg), leg_count, leg_count ? leg_usec / leg_count : 0,
+        usec ? leg_usec * 100 / usec : 0);
+  }
+
+  pthread_mutex_lock(&trace_lock);
+  uint64_t first = trace_recorded > NAS_PROC_SPAN_TRACE_SIZE ?
+                       trace_recorded - NAS_PROC_SPAN_TRACE_SIZE :
+                       0;
+  // Most recent first
+  for (uint64_t i = trace_recorded; i > first; i--) {
+    const nas_proc_trace_record_t* record =
+        &trace[(i - 1) % NAS_PROC_SPAN_TRACE_SIZE];
+    fprintf(
+        stream,
+        "-%lu us %s ue_id " MME_UE_S1AP_ID_FMT " imsi " IMSI_64_FMT
+        " %s in %u us:",
+        now - record->end_usec, record->proc, record->ue_id, record->imsi64,
+        record->success ? "success" : "failure", record->usec);
+    for (int leg = 0; leg < NAS_PROC_LEG_MAX; leg++) {
+      if (record->leg_usec[leg] > 0) {
+        fprintf(
+            stream, " %s %u us", nas_proc_leg2str(leg), record->leg_usec[leg]);
+      }
+    }
+    fprintf(stream, "\n");
+  }
+  pthread_mutex_unlock(&trace_lock);
+}
+
+char* nas_proc_span_dump_to_string(void) {
+  char* dump   = NULL;
+  size_t size  = 0;
+  FILE* stream = open_memstream(&dump, &size);
+
+  if (stream == NULL) {
+    return NULL;
+  }
+  dump_trace(stream);
+  fclose(stream);
+  return dump;
+}
+
+const char* nas_proc_leg2str(nas_proc_leg_t leg) {
+  switch (leg) {
+    case NAS_PROC_LEG_S6A_AIR:
+      return "s6a_air";
+    case NAS_PROC_LEG_AUTH:
+      return "authentication";
+    case NAS_PROC_LEG_SMC:
+      return "security_mode";
+    case NAS_PROC_LEG_S6A_ULR:
+      return "s6a_ulr";
+    case NAS_PROC_LEG_CREATE_SESSION:
+      return "create_session";
+    case NAS_PROC_LEG_ICS:
+      return "initial_context_setup";
+    case NAS_PROC_LEG_COMPLETE:
+      return "complete";
+    default:
+      return "unknown";
+  }
+}
@@ -0,0 +1,114 @@
+/**
+ * Copyright 2020 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*! \file nas_proc_span.h
+  \brief Latency breakdown of the attach and TAU procedures.
+  A span is kept in the attach and TAU procedures from the reception of the
+  request by NAS until the procedure is deleted. Each leg waiting for the
+  UE, the eNB, the HSS or the S/P-GW is timed from its request to its
+  answer, retransmissions included, and observed in the
+  mme_procedure_leg_latency_ms{proc,leg} histogram, the whole procedure in
+  mme_procedure_latency_ms{proc,result}. When sampling is enabled, 1 in N
+  procedures is kept in a trace reported in the service info, along with
+  the share of each leg in the total time of the procedures.
+  Spans are only updated by the thread handling the UE.
+*/
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Sampled procedures kept in the trace
+#define NAS_PROC_SPAN_TRACE_SIZE 64
+
+struct emm_context_s;
+
+typedef enum {
+  // S6a Authentication Information Request to Answer
+  NAS_PROC_LEG_S6A_AIR = 0,
+  // Authentication Request to Response
+  NAS_PROC_LEG_AUTH,
+  // Security Mode Command to Complete
+  NAS_PROC_LEG_SMC,
+  // S6a Update Location Request to Answer
+  NAS_PROC_LEG_S6A_ULR,
+  // S11 Create Session Request to Response
+  NAS_PROC_LEG_CREATE_SESSION,
+  // S1AP Initial Context Setup Request to Response
+  NAS_PROC_LEG_ICS,
+  // Attach or TAU Accept to Complete
+  NAS_PROC_LEG_COMPLETE,
+  NAS_PROC_LEG_MAX,
+} nas_proc_leg_t;
+
+typedef struct nas_proc_span_s {
+  // 0 for procedures restored from the state
+  uint64_t start_usec;
+  // Start of the legs in progress, 0 for the others
+  uint64_t leg_start_usec[NAS_PROC_LEG_MAX];
+  uint64_t leg_usec[NAS_PROC_LEG_MAX];
+  bool accepted;
+} nas_proc_span_t;
+
+/**
+ * Keep 1 in sampling procedures in the trace, none if 0, and report the
+ * trace in the service info. Clears the totals and the trace. Called once
+ * before the MME_APP task starts.
+ */
+void nas_proc_span_init(uint32_t sampling);
+
+/**
+ * Start the span of a new attach or TAU procedure
+ */
+void nas_proc_span_start(nas_proc_span_t* span);
+
+/**
+ * Observe the span of the attach or TAU procedure being deleted
+ * @param proc: "attach" or "tau"
+ * @param success: whether the procedure was completed
+ */
+void nas_proc_span_end(
+    struct emm_context_s* emm_context, nas_proc_span_t* span, const char* proc,
+    bool success);
+
+/**
+ * Start or end a leg of the attach or TAU procedure running for the UE, if
+ * any. A leg already started, e.g. by a retransmission, keeps its start.
+ */
+void nas_proc_span_leg_begin(
+    struct emm_context_s* emm_context, nas_proc_leg_t leg);
+void nas_proc_span_leg_end(
+    struct emm_context_s* emm_context, nas_proc_leg_t leg);
+
+/**
+ * Mark the procedure running for the UE as accepted, starting the wait for
+ * its completion
+ */
+void nas_proc_span_accepted(struct emm_context_s* emm_context);
+
+/**
+ * @return the share of each leg and the sampled spans in a string to free,
+ * NULL on error
+ */
+char* nas_proc_span_dump_to_string(void);
+
+const char* nas_proc_leg2str(nas_proc_leg_t leg);
+
+#ifdef __cplusplus
+}
+#endif
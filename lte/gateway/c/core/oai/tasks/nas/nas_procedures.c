@@ -419,6 +419,8 @@ static void nas_delete_common_procedures(struct emm_context_s* emm_context) {
 void nas_delete_attach_procedure(struct emm_context_s* emm_context) {
   nas_emm_attach_proc_t* proc = get_nas_specific_procedure_attach(emm_context);
   if (proc) {
+    nas_proc_span_end(
+        emm_context, &proc->span, "attach", proc->attach_complete_received);
     // free content
     mme_ue_s1ap_id_t ue_id =
         PARENT_STRUCT(emm_context, struct ue_mm_context_s, emm_context)
@@ -442,6 +444,7 @@ void nas_delete_attach_procedure(struct emm_context_s* emm_context) {
 void nas_delete_tau_procedure(struct emm_context_s* emm_context) {
   nas_emm_tau_proc_t* proc = get_nas_specific_procedure_tau(emm_context);
   if (proc) {
+    nas_proc_span_end(emm_context, &proc->span, "tau", proc->span.accepted);
     // free content
     mme_ue_s1ap_id_t ue_id =
         PARENT_STRUCT(emm_context, struct ue_mm_context_s, emm_context)
@@ -624,6 +627,7 @@ nas_emm_attach_proc_t* nas_new_attach_procedure(
 
   proc->T3450.sec = mme_config.nas_config.t3450_sec;
   proc->T3450.id  = NAS_TIMER_INACTIVE_ID;
+  nas_proc_span_start(&proc->span);
 
   OAILOG_TRACE(LOG_NAS_EMM, "New EMM_SPEC_PROC_TYPE_ATTACH\n");
   return proc;
@@ -660,6 +664,7 @@ nas_emm_tau_proc_t* nas_new_tau_procedure(
 
   proc->T3450.sec = mme_config.nas_config.t3450_sec;
   proc->T3450.id  = NAS_TIMER_INACTIVE_ID;
+  nas_proc_span_start(&proc->span);
 
   return proc;
 }
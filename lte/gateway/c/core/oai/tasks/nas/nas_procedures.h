@@ -39,6 +39,7 @@
 #include "nas_timer.h"
 #include "queue.h"
 #include "nas/securityDef.h"
+#include "nas_proc_span.h"
 #include "security_types.h"
 
 struct emm_context_s;
@@ -145,6 +146,7 @@ typedef struct nas_emm_attach_proc_s {
   mme_ue_s1ap_id_t ue_id;
   ksi_t ksi;
   int emm_cause;
+  nas_proc_span_t span;
 } nas_emm_attach_proc_t;
 
 struct emm_detach_request_ies_s;
@@ -166,6 +168,7 @@ typedef struct nas_emm_tau_proc_s {
   struct emm_tau_request_ies_s* ies;
   mme_ue_s1ap_id_t ue_id;
   int emm_cause;
+  nas_proc_span_t span;
 } nas_emm_tau_proc_t;
 
 //------------------------------------------------------------------------------
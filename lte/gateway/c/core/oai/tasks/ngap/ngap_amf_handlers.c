@@ -1989,19 +1989,27 @@ status_code_e ngap_handle_paging_request(
     OAILOG_FUNC_RETURN(LOG_NGAP, RETURNerror);
   }
 
-  for (int idx = 0; idx < gnb_array->num_elements; idx++) {
+  sctp_assoc_id_t* assoc_ids =
+      calloc(gnb_array->num_elements, sizeof(sctp_assoc_id_t));
+  uint16_t num_assoc = 0;
+  for (int idx = 0; idx < gnb_array->num_elements && assoc_ids; idx++) {
     gnb_ref_p = (gnb_description_t*) gnb_array->elements[idx];
     if (gnb_ref_p) {
-      bstring paging_msg_buffer = blk2bstr(buffer_p, length);
-
-      rc = ngap_amf_itti_send_sctp_request(
-          &paging_msg_buffer, gnb_ref_p->sctp_assoc_id,
-          0,   // Stream id 0 for non UE related
-               // NGAP message
-          0);  // amf_ue_ngap_id 0 because UE in idl
+      assoc_ids[num_assoc++] = gnb_ref_p->sctp_assoc_id;
     }
   }
 
+  // Encoded once, the same bytes are sent to every gNB
+  bstring paging_msg_buffer = blk2bstr(buffer_p, length);
+  if (paging_msg_buffer && assoc_ids) {
+    rc = ngap_amf_itti_send_sctp_batch_request(
+        &paging_msg_buffer, assoc_ids, num_assoc,
+        0);  // Stream id 0 for non UE related NGAP message
+  } else {
+    bdestroy_wrapper(&paging_msg_buffer);
+    rc = RETURNerror;
+  }
+  free_wrapper((void**) &assoc_ids);
   free(buffer_p);
   if (rc != RETURNok) {
     OAILOG_ERROR(LOG_NGAP, "Failed to send paging message over sctp \n");
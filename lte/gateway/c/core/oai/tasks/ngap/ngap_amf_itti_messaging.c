@@ -18,7 +18,10 @@
 #include "bstrlib.h"
 #include "log.h"
 #include "assertions.h"
+#include "dynamic_memory_check.h"
 #include "intertask_interface.h"
+#include "itti_free_defined_msg.h"
+#include "mem_arena.h"
 #include "Ngap_CauseRadioNetwork.h"
 #include "nas/as_message.h"
 #include "intertask_interface_types.h"
@@ -52,6 +55,44 @@ status_code_e ngap_amf_itti_send_sctp_request(
   return send_msg_to_task(&ngap_task_zmq_ctx, TASK_SCTP, message_p);
 }
 
+status_code_e ngap_amf_itti_send_sctp_batch_request(
+    STOLEN_REF bstring* payload, const sctp_assoc_id_t* assoc_ids,
+    uint16_t num_assoc, const sctp_stream_id_t stream) {
+  MessageDef* message_p = NULL;
+
+  if (num_assoc == 0) {
+    bdestroy_wrapper(payload);
+    return RETURNok;
+  }
+  message_p = itti_alloc_new_message(TASK_NGAP, SCTP_DATA_BATCH_REQ);
+  if (message_p == NULL) {
+    OAILOG_ERROR(
+        LOG_NGAP,
+        "itti_alloc_new_message Failed for"
+        " SCTP_DATA_BATCH_REQ \n");
+    bdestroy_wrapper(payload);
+    OAILOG_FUNC_RETURN(LOG_NGAP, RETURNerror);
+  }
+  sctp_data_batch_req_t* batch_req = &SCTP_DATA_BATCH_REQ(message_p);
+  batch_req->targets               = mem_arena_alloc(
+      itti_get_msg_arena(message_p), num_assoc * sizeof(sctp_data_target_t));
+  if (batch_req->targets == NULL) {
+    bdestroy_wrapper(payload);
+    itti_free_msg_content(message_p);
+    free(message_p);
+    OAILOG_FUNC_RETURN(LOG_NGAP, RETURNerror);
+  }
+  for (uint16_t i = 0; i < num_assoc; i++) {
+    batch_req->targets[i].assoc_id = assoc_ids[i];
+    batch_req->targets[i].stream   = stream;
+  }
+  batch_req->num_targets = num_assoc;
+  batch_req->payload     = *payload;
+  *payload               = NULL;
+  batch_req->ppid        = NGAP_SCTP_PPID;
+  return send_msg_to_task(&ngap_task_zmq_ctx, TASK_SCTP, message_p);
+}
+
 status_code_e ngap_amf_itti_nas_uplink_ind(
     const amf_ue_ngap_id_t ue_id, STOLEN_REF bstring* payload,
     const tai_t* const tai, const ecgi_t* const cgi) {
@@ -43,6 +43,18 @@ status_code_e ngap_amf_itti_send_sctp_request(
     STOLEN_REF bstring* payload, const uint32_t sctp_assoc_id_t,
     const sctp_stream_id_t stream, const amf_ue_ngap_id_t ue_id);
 
+/** \brief Send the same encoded PDU to several associations with a single
+ * ITTI message and a single copy of the bytes.
+ * \param payload Encoded PDU, owned by the message
+ * \param assoc_ids Destination associations
+ * \param num_assoc Number of entries in assoc_ids
+ * \param stream Stream used on every association
+ * @returns int
+ **/
+status_code_e ngap_amf_itti_send_sctp_batch_request(
+    STOLEN_REF bstring* payload, const sctp_assoc_id_t* assoc_ids,
+    uint16_t num_assoc, const sctp_stream_id_t stream);
+
 /** \brief pass NAS msg to AMF
  * \param amf_ue_ngap_id_t amf_ue_ngap_id
  * \param payload msg to transmit
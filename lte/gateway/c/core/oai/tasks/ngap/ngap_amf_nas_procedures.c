@@ -468,9 +468,7 @@ status_code_e ngap_generate_downlink_nas_transport(
      * We have fount the UE in the list.
      * * * * Create new IE list message and encode it.
      */
-    ngap_imsi_map_t* imsi_map = get_ngap_imsi_map();
-    hashtable_uint64_ts_insert(
-        imsi_map->amf_ue_id_imsi_htbl, (const hash_key_t) ue_id, imsi64);
+    ngap_imsi_map_insert(ue_id, imsi64);
 
     Ngap_DownlinkNASTransport_IEs_t* ie = NULL;
     Ngap_DownlinkNASTransport_t* out;
@@ -564,7 +562,8 @@ void ngap_handle_amf_ue_id_notification(
         ngap_state_get_ue_gnbid(gnb_ref->sctp_assoc_id, gnb_ue_ngap_id);
     if (ue_ref) {
       ue_ref->amf_ue_ngap_id = amf_ue_ngap_id;
-      hashtable_rc_t h_rc    = hashtable_ts_insert(
+      ngap_state_bind_ue_amfid(ue_ref);
+      hashtable_rc_t h_rc = hashtable_ts_insert(
           &state->amfid2associd, (const hash_key_t) amf_ue_ngap_id,
           (void*) (uintptr_t) sctp_assoc_id);
 
@@ -77,24 +77,52 @@ m5g_ue_description_t* ngap_state_get_ue_gnbid(
 
 m5g_ue_description_t* ngap_state_get_ue_amfid(amf_ue_ngap_id_t amf_ue_ngap_id) {
   m5g_ue_description_t* ue = nullptr;
-
+  uint64_t comp_ngap_id    = 0;
+
+  hash_table_uint64_ts_t* amf_ue_id_ht =
+      NgapStateManager::getInstance().get_amf_ue_id_ht();
+  if (hashtable_uint64_ts_get(
+          amf_ue_id_ht, (const hash_key_t) amf_ue_ngap_id, &comp_ngap_id) !=
+      HASH_TABLE_OK) {
+    return nullptr;
+  }
   hash_table_ts_t* state_ue_ht = get_ngap_ue_state();
-  hashtable_ts_apply_callback_on_elements(
-      (hash_table_ts_t* const) state_ue_ht, ngap_ue_compare_by_amf_ue_id_cb,
-      &amf_ue_ngap_id, (void**) &ue);
+  hashtable_ts_get(state_ue_ht, (const hash_key_t) comp_ngap_id, (void**) &ue);
+  if (ue && ue->amf_ue_ngap_id != amf_ue_ngap_id) {
+    OAILOG_ERROR(
+        LOG_NGAP,
+        "Stale index entry for amf_ue_ngap_id " AMF_UE_NGAP_ID_FMT
+        ", UE context has amf_ue_ngap_id " AMF_UE_NGAP_ID_FMT "\n",
+        amf_ue_ngap_id, ue->amf_ue_ngap_id);
+    return nullptr;
+  }
 
   return ue;
 }
 
 m5g_ue_description_t* ngap_state_get_ue_imsi(imsi64_t imsi64) {
-  m5g_ue_description_t* ue = nullptr;
+  uint64_t amf_ue_ngap_id = INVALID_AMF_UE_NGAP_ID;
 
-  hash_table_ts_t* state_ue_ht = get_ngap_ue_state();
-  hashtable_ts_apply_callback_on_elements(
-      (hash_table_ts_t* const) state_ue_ht, ngap_ue_compare_by_imsi, &imsi64,
-      (void**) &ue);
+  if (imsi64 == INVALID_IMSI64) {
+    return nullptr;
+  }
+  ngap_imsi_map_t* imsi_map = get_ngap_imsi_map();
+  if (hashtable_uint64_ts_get(
+          imsi_map->imsi_amf_ue_id_htbl, (const hash_key_t) imsi64,
+          &amf_ue_ngap_id) != HASH_TABLE_OK) {
+    return nullptr;
+  }
 
-  return ue;
+  return ngap_state_get_ue_amfid((amf_ue_ngap_id_t) amf_ue_ngap_id);
+}
+
+void ngap_state_bind_ue_amfid(const m5g_ue_description_t* ue_ref) {
+  if (ue_ref->amf_ue_ngap_id == INVALID_AMF_UE_NGAP_ID) {
+    return;
+  }
+  hashtable_uint64_ts_insert(
+      NgapStateManager::getInstance().get_amf_ue_id_ht(),
+      (const hash_key_t) ue_ref->amf_ue_ngap_id, ue_ref->comp_ngap_id);
 }
 
 uint64_t ngap_get_comp_ngap_id(
@@ -110,39 +138,35 @@ ngap_imsi_map_t* get_ngap_imsi_map() {
   return NgapStateManager::getInstance().get_ngap_imsi_map();
 }
 
-bool ngap_ue_compare_by_amf_ue_id_cb(
-    __attribute__((unused)) const hash_key_t keyP, void* const elementP,
-    void* parameterP, void** resultP) {
-  amf_ue_ngap_id_t* amf_ue_ngap_id_p = (amf_ue_ngap_id_t*) parameterP;
-  m5g_ue_description_t* ue_ref       = (m5g_ue_description_t*) elementP;
-  if (*amf_ue_ngap_id_p == ue_ref->amf_ue_ngap_id) {
-    *resultP = elementP;
-    OAILOG_TRACE(
-        LOG_NGAP, "Found ue_ref %p amf_ue_ngap_id " MME_UE_NGAP_ID_FMT "\n",
-        ue_ref, ue_ref->amf_ue_ngap_id);
-    return true;
-  }
-  return false;
-}
-
-bool ngap_ue_compare_by_imsi(
-    __attribute__((unused)) const hash_key_t keyP, void* const elementP,
-    void* parameterP, void** resultP) {
-  imsi64_t imsi64              = INVALID_IMSI64;
-  imsi64_t* target_imsi64      = (imsi64_t*) parameterP;
-  m5g_ue_description_t* ue_ref = (m5g_ue_description_t*) elementP;
-
+hashtable_rc_t ngap_imsi_map_insert(
+    amf_ue_ngap_id_t amf_ue_ngap_id, imsi64_t imsi64) {
+  imsi64_t old_imsi64       = INVALID_IMSI64;
+  uint64_t indexed_ue_id    = INVALID_AMF_UE_NGAP_ID;
   ngap_imsi_map_t* imsi_map = get_ngap_imsi_map();
-  hashtable_uint64_ts_get(
-      imsi_map->amf_ue_id_imsi_htbl, (const hash_key_t) ue_ref->amf_ue_ngap_id,
-      &imsi64);
 
-  if (*target_imsi64 != INVALID_IMSI64 && *target_imsi64 == imsi64) {
-    *resultP = elementP;
-    OAILOG_DEBUG_UE(LOG_NGAP, imsi64, "Found ue_ref\n");
-    return true;
+  hashtable_uint64_ts_get(
+      imsi_map->amf_ue_id_imsi_htbl, (const hash_key_t) amf_ue_ngap_id,
+      &old_imsi64);
+  hashtable_rc_t h_rc = hashtable_uint64_ts_insert(
+      imsi_map->amf_ue_id_imsi_htbl, (const hash_key_t) amf_ue_ngap_id,
+      imsi64);
+  if (h_rc == HASH_TABLE_SAME_KEY_VALUE_EXISTS) {
+    return h_rc;
+  }
+  // Drop the reverse entry of the IMSI previously held by amf_ue_ngap_id
+  if ((old_imsi64 != INVALID_IMSI64) &&
+      (hashtable_uint64_ts_get(
+           imsi_map->imsi_amf_ue_id_htbl, (const hash_key_t) old_imsi64,
+           &indexed_ue_id) == HASH_TABLE_OK) &&
+      (indexed_ue_id == amf_ue_ngap_id)) {
+    hashtable_uint64_ts_remove(
+        imsi_map->imsi_amf_ue_id_htbl, (const hash_key_t) old_imsi64);
   }
-  return false;
+  // A re-registration gets a new amf_ue_ngap_id, the latest one is the live UE
+  hashtable_uint64_ts_insert(
+      imsi_map->imsi_amf_ue_id_htbl, (const hash_key_t) imsi64,
+      amf_ue_ngap_id);
+  return h_rc;
 }
 
 hash_table_ts_t* get_ngap_ue_state(void) {
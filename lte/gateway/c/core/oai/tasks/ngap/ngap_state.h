@@ -47,6 +47,13 @@ m5g_ue_description_t* ngap_state_get_ue_amfid(amf_ue_ngap_id_t amf_ue_ngap_id);
 
 m5g_ue_description_t* ngap_state_get_ue_imsi(imsi64_t imsi64);
 
+/**
+ * Index ue_ref under its amf_ue_ngap_id for ngap_state_get_ue_amfid(), to be
+ * called whenever the AMF assigns the id to an NGAP UE context
+ * @param ue_ref UE context already inserted in the UE state hashtable
+ */
+void ngap_state_bind_ue_amfid(const m5g_ue_description_t* ue_ref);
+
 /**
  * Return unique composite id for NGAP UE context
  * @param sctp_assoc_id unique SCTP assoc id
@@ -66,6 +73,14 @@ void put_ngap_imsi_map(void);
  */
 ngap_imsi_map_t* get_ngap_imsi_map(void);
 
+/**
+ * Record the IMSI of amf_ue_ngap_id in ngap_imsi_map, keeping the reverse
+ * IMSI index used by ngap_state_get_ue_imsi() in sync
+ * @return result of the insertion in amf_ue_id_imsi_htbl
+ */
+hashtable_rc_t ngap_imsi_map_insert(
+    amf_ue_ngap_id_t amf_ue_ngap_id, imsi64_t imsi64);
+
 hash_table_ts_t* get_ngap_ue_state(void);
 
 int read_ngap_ue_state_db(void);
@@ -74,14 +89,6 @@ void put_ngap_ue_state(imsi64_t imsi64);
 
 void delete_ngap_ue_state(imsi64_t imsi64);
 
-bool ngap_ue_compare_by_amf_ue_id_cb(
-    __attribute__((unused)) hash_key_t keyP, void* elementP, void* parameterP,
-    void** resultP);
-
-bool ngap_ue_compare_by_imsi(
-    __attribute__((unused)) hash_key_t keyP, void* elementP, void* parameterP,
-    void** resultP);
-
 #ifdef __cplusplus
 }
 #endif
@@ -167,6 +167,9 @@ void NgapStateConverter::proto_to_ue(
   ue->sctp_stream_send              = proto.sctp_stream_send();
   ue->ngap_ue_context_rel_timer.id  = proto.ngap_ue_context_rel_timer().id();
   ue->ngap_ue_context_rel_timer.sec = proto.ngap_ue_context_rel_timer().sec();
+
+  ue->comp_ngap_id =
+      ngap_get_comp_ngap_id(ue->sctp_assoc_id, ue->gnb_ue_ngap_id);
 }
 
 void NgapStateConverter::ngap_imsi_map_to_proto(
@@ -179,6 +182,12 @@ void NgapStateConverter::proto_to_ngap_imsi_map(
     const oai::NgapImsiMap& ngap_imsi_proto, ngap_imsi_map_t* ngap_imsi_map) {
   proto_to_hashtable_uint64_ts(
       ngap_imsi_proto.amf_ue_id_imsi_map(), ngap_imsi_map->amf_ue_id_imsi_htbl);
+  // The reverse index is not persisted, rebuild it from the forward map
+  for (auto const& kv : ngap_imsi_proto.amf_ue_id_imsi_map()) {
+    hashtable_uint64_ts_insert(
+        ngap_imsi_map->imsi_amf_ue_id_htbl, (const hash_key_t) kv.second,
+        kv.first);
+  }
 }
 
 }  // namespace magma5g
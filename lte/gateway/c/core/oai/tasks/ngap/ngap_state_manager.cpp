@@ -28,6 +28,7 @@ namespace {
 constexpr char NGAP_GNB_COLL[]             = "ngap_gNB_coll";
 constexpr char NGAP_AMF_ID2ASSOC_ID_COLL[] = "ngap_amf_id2assoc_id_coll";
 constexpr char NGAP_IMSI_MAP_TABLE_NAME[]  = "ngap_imsi_map";
+constexpr char NGAP_AMF_UE_ID_COLL[]       = "ngap_amf_ue_id_coll";
 }  // namespace
 
 using magma::lte::oai::Ngap_UeDescription;
@@ -35,7 +36,10 @@ using magma::lte::oai::Ngap_UeDescription;
 namespace magma5g {
 
 NgapStateManager::NgapStateManager()
-    : max_ues_(0), max_gnbs_(0), ngap_imsi_map_hash_(0) {}
+    : max_ues_(0),
+      max_gnbs_(0),
+      ngap_imsi_map_hash_(0),
+      amf_ue_id_ht_(nullptr) {}
 
 NgapStateManager::~NgapStateManager() {
   free_state();
@@ -71,7 +75,12 @@ void NgapStateManager::create_state() {
   hashtable_ts_init(
       &state_cache_p->gnbs, max_gnbs_, nullptr, free_wrapper, ht_name);
 
-  state_ue_ht = hashtable_ts_create(max_ues_, nullptr, free_wrapper, ht_name);
+  state_ue_ht = hashtable_ts_create(
+      max_ues_, hash_key_pair_hashfunc, free_wrapper, ht_name);
+  bdestroy(ht_name);
+
+  ht_name       = bfromcstr(NGAP_AMF_UE_ID_COLL);
+  amf_ue_id_ht_ = hashtable_uint64_ts_create(max_ues_, nullptr, ht_name);
   bdestroy(ht_name);
 
   ht_name = bfromcstr(NGAP_AMF_ID2ASSOC_ID_COLL);
@@ -122,6 +131,8 @@ void NgapStateManager::free_state() {
   if (hashtable_ts_destroy(state_ue_ht) != HASH_TABLE_OK) {
     OAI_FPRINTF_ERR("An error occurred while destroying assoc_id hash table");
   }
+  hashtable_uint64_ts_destroy(amf_ue_id_ht_);
+  amf_ue_id_ht_ = nullptr;
   free_wrapper((void**) &state_cache_p);
 
   clear_ngap_imsi_map();
@@ -131,22 +142,29 @@ status_code_e NgapStateManager::read_ue_state_from_db() {
   if (!persist_state_enabled) {
     return RETURNok;
   }
-  auto keys = redis_client->get_keys("IMSI*" + task_name + "*");
+  auto start = std::chrono::steady_clock::now();
+  std::vector<std::string> keys;
+  std::vector<Ngap_UeDescription> ue_protos;
+  if (read_ue_protos_from_db(keys, ue_protos) != RETURNok) {
+    return RETURNerror;
+  }
 
-  for (const auto& key : keys) {
-    Ngap_UeDescription ue_proto = Ngap_UeDescription();
-    m5g_ue_description_t* ue_context =
+  std::vector<m5g_ue_description_t*> ue_contexts(keys.size(), nullptr);
+  run_restore_workers(keys.size(), [&](size_t i) {
+    ue_contexts[i] =
         (m5g_ue_description_t*) calloc(1, sizeof(m5g_ue_description_t));
-    if (redis_client->read_proto(key.c_str(), ue_proto) != RETURNok) {
-      return RETURNerror;
+    NgapStateConverter::proto_to_ue(ue_protos[i], ue_contexts[i]);
+  });
+
+  for (size_t i = 0; i < keys.size(); i++) {
+    if (hashtable_ts_insert(
+            state_ue_ht, ue_contexts[i]->comp_ngap_id,
+            (void*) ue_contexts[i]) == HASH_TABLE_OK) {
+      ngap_state_bind_ue_amfid(ue_contexts[i]);
     }
-
-    NgapStateConverter::proto_to_ue(ue_proto, ue_context);
-
-    hashtable_ts_insert(
-        state_ue_ht, ue_context->comp_ngap_id, (void*) ue_context);
-    OAILOG_DEBUG(log_task, "Reading UE state from db for %s", key.c_str());
+    OAILOG_DEBUG(log_task, "Reading UE state from db for %s", keys[i].c_str());
   }
+  report_ue_state_restore(keys.size(), start);
   return RETURNok;
 }
 
@@ -155,6 +173,8 @@ void NgapStateManager::create_ngap_imsi_map() {
 
   ngap_imsi_map_->amf_ue_id_imsi_htbl =
       hashtable_uint64_ts_create(max_ues_, nullptr, nullptr);
+  ngap_imsi_map_->imsi_amf_ue_id_htbl =
+      hashtable_uint64_ts_create(max_ues_, nullptr, nullptr);
   if (!persist_state_enabled) {
     return;
   }
@@ -169,6 +189,7 @@ void NgapStateManager::clear_ngap_imsi_map() {
     return;
   }
   hashtable_uint64_ts_destroy(ngap_imsi_map_->amf_ue_id_imsi_htbl);
+  hashtable_uint64_ts_destroy(ngap_imsi_map_->imsi_amf_ue_id_htbl);
 
   free_wrapper((void**) &ngap_imsi_map_);
 }
@@ -177,6 +198,10 @@ ngap_imsi_map_t* NgapStateManager::get_ngap_imsi_map() {
   return ngap_imsi_map_;
 }
 
+hash_table_uint64_ts_t* NgapStateManager::get_amf_ue_id_ht() {
+  return amf_ue_id_ht_;
+}
+
 void NgapStateManager::put_ngap_imsi_map() {
   if (!persist_state_enabled) {
     return;
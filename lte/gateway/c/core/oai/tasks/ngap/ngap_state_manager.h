@@ -92,6 +92,13 @@ class NgapStateManager
    */
   ngap_imsi_map_t* get_ngap_imsi_map();
 
+  /**
+   * Returns the amf_ue_ngap_id -> comp_ngap_id index of the UE state
+   * hashtable. It is derived from the UE states and rebuilt when they are
+   * read from db, so it is not persisted on its own.
+   */
+  hash_table_uint64_ts_t* get_amf_ue_id_ht();
+
  private:
   NgapStateManager();
   ~NgapStateManager();
@@ -112,5 +119,6 @@ class NgapStateManager
   uint32_t max_gnbs_;
   ngap_imsi_map_t* ngap_imsi_map_;
   std::size_t ngap_imsi_map_hash_;
+  hash_table_uint64_ts_t* amf_ue_id_ht_;
 };
 }  // namespace magma5g
@@ -108,6 +108,8 @@ typedef struct m5g_ue_description_s {
 /// typedef struct ngap_imsi_map_s {
 typedef struct ngap_imsi_map_s {
   hash_table_uint64_ts_t* amf_ue_id_imsi_htbl;
+  // Reverse of amf_ue_id_imsi_htbl, key is imsi64; rebuilt from it on restore
+  hash_table_uint64_ts_t* imsi_amf_ue_id_htbl;
 } ngap_imsi_map_t;
 
 enum n1_timer_class_s {
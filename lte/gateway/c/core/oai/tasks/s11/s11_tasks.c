@@ -392,6 +392,13 @@ status_code_e s11_mme_init(mme_config_t* mme_config_p) {
     goto fail;
   }
 
+  // One tunnel per UE, every outstanding transaction keeps its message
+  if (nwGtpv2cSetCapacity(
+          s11_mme_stack_handle, mme_config_p->max_ues,
+          mme_config_p->max_s11_trxns, mme_config_p->max_s11_trxns) != NW_OK) {
+    OAILOG_WARNING(LOG_S11, "Failed to preallocate gtpv2-c stack\n");
+  }
+
   if (itti_create_task(TASK_S11, &s11_mme_thread, mme_config_p) < 0) {
     OAILOG_ERROR(LOG_S11, "gtpv1u phtread_create: %s\n", strerror(errno));
     goto fail;
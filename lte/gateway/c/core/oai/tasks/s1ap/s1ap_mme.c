@@ -46,6 +46,7 @@
 #include "service303.h"
 #include "service303_message_utils.h"
 #include "dynamic_memory_check.h"
+#include "mem_arena.h"
 #include "mme_config.h"
 #include "timer.h"
 #include "itti_free_defined_msg.h"
@@ -76,15 +77,18 @@ bool s1ap_dump_ue_hash_cb(
     void** unused_res);
 static void start_stats_timer(void);
 static int handle_stats_timer(zloop_t* loop, int id, void* arg);
+static void start_overload_timer(void);
+static int handle_overload_timer(zloop_t* loop, int id, void* arg);
 static long epc_stats_timer_id;
+static long overload_timer_id;
+static size_t overload_timer_msec;
 
 bool hss_associated = false;
 static int indent   = 0;
 task_zmq_ctx_t s1ap_task_zmq_ctx;
 
-bool s1ap_congestion_control_enabled = true;
-long s1ap_last_msg_latency           = 0;
-long s1ap_zmq_th                     = LONG_MAX;
+long s1ap_last_msg_latency                = 0;
+mme_overload_level_t s1ap_overload_level = MME_OVERLOAD_NONE;
 
 //------------------------------------------------------------------------------
 static int s1ap_send_init_sctp(void) {
@@ -120,8 +124,7 @@ static int handle_message(zloop_t* loop, zsock_t* reader, void* arg) {
   bool is_ue_state_same   = false;
 
   s1ap_last_msg_latency = ITTI_MSG_LATENCY(received_message_p);  // microseconds
-
-  OAILOG_DEBUG(LOG_S1AP, "S1AP ZMQ latency: %ld.", s1ap_last_msg_latency);
+  mme_overload_observe(TASK_S1AP, s1ap_last_msg_latency);
 
   switch (ITTI_MSG_ID(received_message_p)) {
     case ACTIVATE_MESSAGE: {
@@ -143,9 +146,13 @@ static int handle_message(zloop_t* loop, zsock_t* reader, void* arg) {
        */
       S1ap_S1AP_PDU_t pdu = {0};
 
-      // Invoke S1AP message decoder
-      if (s1ap_mme_decode_pdu(&pdu, SCTP_DATA_IND(received_message_p).payload) <
-          0) {
+      // Invoke S1AP message decoder, the PDU is allocated on the arena of
+      // the message and released with it
+      mem_arena_set_current(itti_get_msg_arena(received_message_p));
+      status_code_e rc =
+          s1ap_mme_decode_pdu(&pdu, SCTP_DATA_IND(received_message_p).payload);
+      mem_arena_set_current(NULL);
+      if (rc < 0) {
         // TODO: Notify eNB of failure with right cause
         OAILOG_ERROR(LOG_S1AP, "Failed to decode new buffer\n");
       } else {
@@ -154,8 +161,6 @@ static int handle_message(zloop_t* loop, zsock_t* reader, void* arg) {
             SCTP_DATA_IND(received_message_p).stream, &pdu);
       }
 
-      // Free received PDU array
-      ASN_STRUCT_FREE_CONTENTS_ONLY(asn_DEF_S1ap_S1AP_PDU, &pdu);
       bdestroy_wrapper(&SCTP_DATA_IND(received_message_p).payload);
     } break;
 
@@ -372,6 +377,7 @@ static void* s1ap_mme_thread(__attribute__((unused)) void* args) {
     OAILOG_ERROR(LOG_S1AP, "Error while sendind SCTP_INIT_MSG to SCTP \n");
   }
   start_stats_timer();
+  start_overload_timer();
 
   zloop_start(s1ap_task_zmq_ctx.event_loop);
   s1ap_mme_exit();
@@ -391,8 +397,9 @@ status_code_e s1ap_mme_init(const mme_config_t* mme_config_p) {
 
   OAILOG_DEBUG(LOG_S1AP, "ASN1C version %d\n", get_asn1c_environment_version());
 
-  s1ap_congestion_control_enabled = mme_config_p->enable_congestion_control;
-  s1ap_zmq_th                     = mme_config_p->s1ap_zmq_th;
+  if (mme_config_p->enable_congestion_control) {
+    overload_timer_msec = mme_config_p->overload_interval / 1000;
+  }
 
   if (s1ap_state_init(
           mme_config_p->max_ues, mme_config_p->max_enbs,
@@ -414,6 +421,9 @@ status_code_e s1ap_mme_init(const mme_config_t* mme_config_p) {
 void s1ap_mme_exit(void) {
   OAILOG_DEBUG(LOG_S1AP, "Cleaning S1AP\n");
   stop_timer(&s1ap_task_zmq_ctx, epc_stats_timer_id);
+  if (overload_timer_msec > 0) {
+    stop_timer(&s1ap_task_zmq_ctx, overload_timer_id);
+  }
 
   put_s1ap_state();
   put_s1ap_imsi_map();
@@ -579,6 +589,7 @@ void s1ap_remove_ue(s1ap_state_t* state, ue_description_t* ue_ref) {
   ue_ref->s1_ue_state = S1AP_UE_INVALID_STATE;
 
   hash_table_ts_t* state_ue_ht = get_s1ap_ue_state();
+  s1ap_state_unbind_ue_mmeid(ue_ref);
   hashtable_ts_free(state_ue_ht, ue_ref->comp_s1ap_id);
   hashtable_ts_free(&state->mmeid2associd, mme_ue_s1ap_id);
   hashtable_uint64_ts_remove(&enb_ref->ue_id_coll, mme_ue_s1ap_id);
@@ -589,8 +600,7 @@ void s1ap_remove_ue(s1ap_state_t* state, ue_description_t* ue_ref) {
       s1ap_imsi_map->mme_ue_id_imsi_htbl, (const hash_key_t) mme_ue_s1ap_id,
       &imsi64);
   delete_s1ap_ue_state(imsi64);
-  hashtable_uint64_ts_remove(
-      s1ap_imsi_map->mme_ue_id_imsi_htbl, mme_ue_s1ap_id);
+  s1ap_imsi_map_remove(mme_ue_s1ap_id);
 
   OAILOG_DEBUG(
       LOG_S1AP, "Num UEs associated %u num ue_id_coll %zu",
@@ -633,3 +643,38 @@ static void start_stats_timer(void) {
       &s1ap_task_zmq_ctx, EPC_STATS_TIMER_MSEC, TIMER_REPEAT_FOREVER,
       handle_stats_timer, NULL);
 }
+
+// Signal the eNBs the changes of overload level and export the backlogs
+static int handle_overload_timer(zloop_t* loop, int id, void* arg) {
+  mme_overload_level_t level = mme_overload_level();
+
+  set_gauge("mme_overload_level", level, NO_LABELS);
+  set_gauge(
+      "itti_queue_delay_us", mme_overload_smoothed_delay(TASK_S1AP), 1, "task",
+      "s1ap");
+  set_gauge(
+      "itti_queue_delay_us", mme_overload_smoothed_delay(TASK_MME_APP), 1,
+      "task", "mme_app");
+
+  if (level != s1ap_overload_level) {
+    OAILOG_WARNING(
+        LOG_S1AP, "MME overload level %s -> %s, sending overload %s\n",
+        mme_overload_level2str(s1ap_overload_level),
+        mme_overload_level2str(level),
+        level == MME_OVERLOAD_NONE ? "stop" : "start");
+    s1ap_overload_level = level;
+    s1ap_mme_send_overload_to_enbs(get_s1ap_state(false), level);
+    increment_counter(
+        "s1ap_overload", 1, 1, "action",
+        level == MME_OVERLOAD_NONE ? "stop" : "start");
+  }
+  return 0;
+}
+
+static void start_overload_timer(void) {
+  if (overload_timer_msec > 0) {
+    overload_timer_id = start_timer(
+        &s1ap_task_zmq_ctx, overload_timer_msec, TIMER_REPEAT_FOREVER,
+        handle_overload_timer, NULL);
+  }
+}
@@ -32,11 +32,11 @@
 #include "common_defs.h"
 #include "s1ap_state.h"
 #include "s1ap_types.h"
-
-#define S1AP_ZMQ_LATENCY_TH                                                    \
-  s1ap_zmq_th  // absolute threshold to be used for initial UE messages
+#include "mme_app_overload.h"
 
 extern bool hss_associated;
+// Overload level last signalled to the eNBs
+extern mme_overload_level_t s1ap_overload_level;
 
 /** \brief S1AP layer top init
  * @returns -1 in case of failure
@@ -15,6 +15,7 @@
  *      contact@openairinterface.org
  */
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <string.h>
 
@@ -93,6 +94,8 @@ static inline int s1ap_mme_encode_initiating(
     case S1ap_ProcedureCode_id_Paging:
     case S1ap_ProcedureCode_id_MMEConfigurationTransfer:
     case S1ap_ProcedureCode_id_HandoverPreparation:
+    case S1ap_ProcedureCode_id_OverloadStart:
+    case S1ap_ProcedureCode_id_OverloadStop:
       break;
 
     default:
@@ -177,3 +180,198 @@ static inline int s1ap_mme_encode_unsuccessfull_outcome(
   *length = res.result.encoded;
   return RETURNok;
 }
+
+/*
+ * Direct APER encoding of the fixed-shape PDUs (X.691). All these PDUs are
+ * an InitiatingMessage whose value is a SEQUENCE { protocolIEs, ... } of
+ * mandatory IEs, so only the IE values and the open type lengths vary.
+ */
+
+// Lengths from 16K on are fragmented, X.691 10.9.3.8
+#define APER_MAX_LENGTH 16384
+
+typedef struct aper_buffer_s {
+  uint8_t* data;
+  uint32_t size;
+  uint32_t length;
+  bool overflow;
+} aper_buffer_t;
+
+// Number of values of the root of the Cause enumerations, by S1ap_Cause_PR
+static const struct {
+  long root_values;
+  int bits;
+} cause_enumerations[] = {
+    [S1ap_Cause_PR_radioNetwork] =
+        {S1ap_CauseRadioNetwork_x2_handover_triggered + 1, 6},
+    [S1ap_Cause_PR_transport] = {S1ap_CauseTransport_unspecified + 1, 1},
+    [S1ap_Cause_PR_nas]       = {S1ap_CauseNas_unspecified + 1, 2},
+    [S1ap_Cause_PR_protocol]  = {S1ap_CauseProtocol_unspecified + 1, 3},
+    [S1ap_Cause_PR_misc]      = {S1ap_CauseMisc_unknown_PLMN + 1, 3},
+};
+
+static void aper_put_octet(aper_buffer_t* buffer, uint8_t octet) {
+  if (buffer->length >= buffer->size) {
+    buffer->overflow = true;
+    return;
+  }
+  buffer->data[buffer->length++] = octet;
+}
+
+static void aper_put_octets(
+    aper_buffer_t* buffer, const uint8_t* octets, uint32_t length) {
+  if (length == 0) {
+    return;
+  }
+  if (buffer->size - buffer->length < length) {
+    buffer->overflow = true;
+    return;
+  }
+  memcpy(&buffer->data[buffer->length], octets, length);
+  buffer->length += length;
+}
+
+// Octets of an aligned length determinant below 16K, X.691 10.9.3.6-7
+static uint32_t aper_length_octets(uint32_t length) {
+  return length < 128 ? 1 : 2;
+}
+
+static void aper_put_length(aper_buffer_t* buffer, uint32_t length) {
+  if (length >= 128) {
+    aper_put_octet(buffer, 0x80 | (length >> 8));
+  }
+  aper_put_octet(buffer, length & 0xff);
+}
+
+static uint32_t aper_integer_octets(uint32_t value) {
+  uint32_t octets = 1;
+
+  while (value >>= 8) {
+    octets++;
+  }
+  return octets;
+}
+
+/*
+ * INTEGER (0..2^24-1) or (0..2^32-1), X.691 10.5.7.4: the number of octets
+ * minus one in the 2 bits from shift in the first octet, whose preceding
+ * bits are all 0 here, then the octets of the value
+ */
+static void aper_put_integer(aper_buffer_t* buffer, int shift, uint32_t value) {
+  uint32_t octets = aper_integer_octets(value);
+
+  aper_put_octet(buffer, (octets - 1) << shift);
+  for (int i = octets - 1; i >= 0; i--) {
+    aper_put_octet(buffer, (value >> (8 * i)) & 0xff);
+  }
+}
+
+// Length of a ProtocolIE-Field holding a value of value_length octets
+static uint32_t aper_ie_length(uint32_t value_length) {
+  return 3 + aper_length_octets(value_length) + value_length;
+}
+
+// InitiatingMessage then the preamble and IE count of its SEQUENCE value
+static void aper_put_initiating_message(
+    aper_buffer_t* buffer, S1ap_ProcedureCode_t procedure_code,
+    S1ap_Criticality_t criticality, uint32_t value_length, uint16_t ies) {
+  aper_put_octet(buffer, 0x00);
+  aper_put_octet(buffer, procedure_code);
+  aper_put_octet(buffer, criticality << 6);
+  aper_put_length(buffer, value_length);
+  // Extension bit and padding, then the IE count in 16 bits
+  aper_put_octet(buffer, 0x00);
+  aper_put_octet(buffer, ies >> 8);
+  aper_put_octet(buffer, ies & 0xff);
+}
+
+static void aper_put_ie_header(
+    aper_buffer_t* buffer, S1ap_ProtocolIE_ID_t id,
+    S1ap_Criticality_t criticality, uint32_t value_length) {
+  aper_put_octet(buffer, id >> 8);
+  aper_put_octet(buffer, id & 0xff);
+  aper_put_octet(buffer, criticality << 6);
+  aper_put_length(buffer, value_length);
+}
+
+//------------------------------------------------------------------------------
+int s1ap_mme_encode_downlink_nas_transport(
+    mme_ue_s1ap_id_t mme_ue_s1ap_id, enb_ue_s1ap_id_t enb_ue_s1ap_id,
+    const uint8_t* nas_pdu, uint32_t nas_pdu_length, uint8_t* buffer,
+    uint32_t size) {
+  aper_buffer_t aper = {buffer, size, 0, false};
+
+  if (enb_ue_s1ap_id > 0xffffff || nas_pdu_length >= APER_MAX_LENGTH) {
+    return -1;
+  }
+  uint32_t mme_id_length = 1 + aper_integer_octets(mme_ue_s1ap_id);
+  uint32_t enb_id_length = 1 + aper_integer_octets(enb_ue_s1ap_id);
+  uint32_t nas_length    = aper_length_octets(nas_pdu_length) + nas_pdu_length;
+  uint32_t value_length  = 3 + aper_ie_length(mme_id_length) +
+                          aper_ie_length(enb_id_length) +
+                          aper_ie_length(nas_length);
+  if (value_length >= APER_MAX_LENGTH) {
+    return -1;
+  }
+
+  aper_put_initiating_message(
+      &aper, S1ap_ProcedureCode_id_downlinkNASTransport,
+      S1ap_Criticality_ignore, value_length, 3);
+  aper_put_ie_header(
+      &aper, S1ap_ProtocolIE_ID_id_MME_UE_S1AP_ID, S1ap_Criticality_reject,
+      mme_id_length);
+  aper_put_integer(&aper, 6, mme_ue_s1ap_id);
+  aper_put_ie_header(
+      &aper, S1ap_ProtocolIE_ID_id_eNB_UE_S1AP_ID, S1ap_Criticality_reject,
+      enb_id_length);
+  aper_put_integer(&aper, 6, enb_ue_s1ap_id);
+  aper_put_ie_header(
+      &aper, S1ap_ProtocolIE_ID_id_NAS_PDU, S1ap_Criticality_reject,
+      nas_length);
+  aper_put_length(&aper, nas_pdu_length);
+  aper_put_octets(&aper, nas_pdu, nas_pdu_length);
+  return aper.overflow ? -1 : (int) aper.length;
+}
+
+//------------------------------------------------------------------------------
+int s1ap_mme_encode_ue_context_release_command(
+    mme_ue_s1ap_id_t mme_ue_s1ap_id, enb_ue_s1ap_id_t enb_ue_s1ap_id,
+    S1ap_Cause_PR cause_type, long cause_value, uint8_t* buffer,
+    uint32_t size) {
+  aper_buffer_t aper = {buffer, size, 0, false};
+
+  if (enb_ue_s1ap_id > 0xffffff || cause_type < S1ap_Cause_PR_radioNetwork ||
+      cause_type > S1ap_Cause_PR_misc || cause_value < 0 ||
+      cause_value >= cause_enumerations[cause_type].root_values) {
+    return -1;
+  }
+  // UE-S1AP-IDs choice and UE-S1AP-ID-pair preamble bits, then the IDs
+  uint32_t ids_length = 1 + aper_integer_octets(mme_ue_s1ap_id) + 1 +
+                        aper_integer_octets(enb_ue_s1ap_id);
+  // Cause choice extension bit and index in 3 bits, then enumeration
+  // extension bit and value, padded to octets
+  int value_bits        = cause_enumerations[cause_type].bits;
+  int cause_bits        = 5 + value_bits;
+  uint32_t cause_length = (cause_bits + 7) / 8;
+  uint32_t cause =
+      ((uint32_t)(cause_type - 1) << (1 + value_bits) | cause_value)
+      << (8 * cause_length - cause_bits);
+  uint32_t value_length =
+      3 + aper_ie_length(ids_length) + aper_ie_length(cause_length);
+
+  aper_put_initiating_message(
+      &aper, S1ap_ProcedureCode_id_UEContextRelease, S1ap_Criticality_reject,
+      value_length, 2);
+  aper_put_ie_header(
+      &aper, S1ap_ProtocolIE_ID_id_UE_S1AP_IDs, S1ap_Criticality_reject,
+      ids_length);
+  aper_put_integer(&aper, 2, mme_ue_s1ap_id);
+  aper_put_integer(&aper, 6, enb_ue_s1ap_id);
+  aper_put_ie_header(
+      &aper, S1ap_ProtocolIE_ID_id_Cause, S1ap_Criticality_ignore,
+      cause_length);
+  for (int i = cause_length - 1; i >= 0; i--) {
+    aper_put_octet(&aper, (cause >> (8 * i)) & 0xff);
+  }
+  return aper.overflow ? -1 : (int) aper.length;
+}
@@ -20,10 +20,36 @@
 #ifndef FILE_S1AP_MME_ENCODER_SEEN
 #define FILE_S1AP_MME_ENCODER_SEEN
 #include "common_defs.h"
+#include "3gpp_36.401.h"
+#include "S1ap_Cause.h"
 #include "S1ap_S1AP-PDU.h"
 
+// Bytes of a DownlinkNASTransport besides its NAS PDU, at most
+#define S1AP_DOWNLINK_NAS_TRANSPORT_OVERHEAD 32
+// Bytes of a UEContextReleaseCommand, at most
+#define S1AP_UE_CONTEXT_RELEASE_COMMAND_MAX_LENGTH 32
+
 status_code_e s1ap_mme_encode_pdu(
     S1ap_S1AP_PDU_t* message, uint8_t** buffer, uint32_t* len)
     __attribute__((warn_unused_result));
 
+/*
+ * The hot fixed-shape messages are encoded straight to APER from their few
+ * varying fields, without building and encoding their PDU with asn1c. The
+ * output is the same as asn1c's byte for byte. These encoders return the
+ * length of the PDU written to buffer, or -1 when it does not fit in size
+ * or when a field is out of their scope, in which case the PDU must be
+ * encoded with s1ap_mme_encode_pdu().
+ */
+int s1ap_mme_encode_downlink_nas_transport(
+    mme_ue_s1ap_id_t mme_ue_s1ap_id, enb_ue_s1ap_id_t enb_ue_s1ap_id,
+    const uint8_t* nas_pdu, uint32_t nas_pdu_length, uint8_t* buffer,
+    uint32_t size);
+
+// Only the causes of the root of their enumeration are in scope
+int s1ap_mme_encode_ue_context_release_command(
+    mme_ue_s1ap_id_t mme_ue_s1ap_id, enb_ue_s1ap_id_t enb_ue_s1ap_id,
+    S1ap_Cause_PR cause_type, long cause_value, uint8_t* buffer,
+    uint32_t size);
+
 #endif /* FILE_S1AP_MME_ENCODER_SEEN */
@@ -667,6 +667,11 @@ status_code_e s1ap_mme_handle_s1_setup_request(
     set_gauge("s1_connection", 1, 1, "enb_name", enb_association->enb_name);
     increment_counter("s1_setup", 1, 1, "result", "success");
     s1_setup_success_event(enb_name, enb_id);
+    // Let the new eNB know the MME is overloaded
+    if (s1ap_overload_level != MME_OVERLOAD_NONE) {
+      s1ap_mme_send_overload(
+          enb_association->sctp_assoc_id, s1ap_overload_level);
+    }
   }
   OAILOG_FUNC_RETURN(LOG_S1AP, rc);
 }
@@ -1243,21 +1248,30 @@ status_code_e s1ap_mme_handle_ue_context_release_request(
 }
 
 //------------------------------------------------------------------------------
-status_code_e s1ap_mme_generate_ue_context_release_command(
-    s1ap_state_t* state, ue_description_t* ue_ref_p, enum s1cause cause,
-    imsi64_t imsi64, const sctp_assoc_id_t assoc_id,
-    const sctp_stream_id_t stream, mme_ue_s1ap_id_t mme_ue_s1ap_id,
-    enb_ue_s1ap_id_t enb_ue_s1ap_id) {
+// Encoded straight to APER, or with asn1c when out of the direct encoder scope
+static bstring encode_ue_context_release_command(
+    mme_ue_s1ap_id_t mme_ue_s1ap_id, enb_ue_s1ap_id_t enb_ue_s1ap_id,
+    S1ap_Cause_PR cause_type, long cause_value) {
   uint8_t* buffer = NULL;
   uint32_t length = 0;
   S1ap_S1AP_PDU_t pdu;
   S1ap_UEContextReleaseCommand_t* out;
   S1ap_UEContextReleaseCommand_IEs_t* ie = NULL;
-  int rc                                 = RETURNok;
-  S1ap_Cause_PR cause_type;
-  long cause_value;
+  bstring b                              = NULL;
+  int encoded                            = 0;
+
+  b       = bfromcstralloc(S1AP_UE_CONTEXT_RELEASE_COMMAND_MAX_LENGTH + 1, "");
+  encoded = s1ap_mme_encode_ue_context_release_command(
+      mme_ue_s1ap_id, enb_ue_s1ap_id, cause_type, cause_value, b->data,
+      b->mlen - 1);
+
+  if (encoded >= 0) {
+    b->slen          = encoded;
+    b->data[encoded] = '\0';
+    return b;
+  }
+  bdestroy_wrapper(&b);
 
-  OAILOG_FUNC_IN(LOG_S1AP);
   memset(&pdu, 0, sizeof(pdu));
   pdu.present = S1ap_S1AP_PDU_PR_initiatingMessage;
   pdu.choice.initiatingMessage.procedureCode =
@@ -1287,6 +1301,29 @@ status_code_e s1ap_mme_generate_ue_context_release_command(
   ie->id            = S1ap_ProtocolIE_ID_id_Cause;
   ie->criticality   = S1ap_Criticality_ignore;
   ie->value.present = S1ap_UEContextReleaseCommand_IEs__value_PR_Cause;
+  s1ap_mme_set_cause(&ie->value.choice.Cause, cause_type, cause_value);
+  ASN_SEQUENCE_ADD(&out->protocolIEs.list, ie);
+
+  if (s1ap_mme_encode_pdu(&pdu, &buffer, &length) < 0) {
+    return NULL;
+  }
+  b = blk2bstr(buffer, length);
+  free(buffer);
+  return b;
+}
+
+//------------------------------------------------------------------------------
+status_code_e s1ap_mme_generate_ue_context_release_command(
+    s1ap_state_t* state, ue_description_t* ue_ref_p, enum s1cause cause,
+    imsi64_t imsi64, const sctp_assoc_id_t assoc_id,
+    const sctp_stream_id_t stream, mme_ue_s1ap_id_t mme_ue_s1ap_id,
+    enb_ue_s1ap_id_t enb_ue_s1ap_id) {
+  int rc = RETURNok;
+  S1ap_Cause_PR cause_type;
+  long cause_value;
+  bstring b = NULL;
+
+  OAILOG_FUNC_IN(LOG_S1AP);
   switch (cause) {
     case S1AP_NAS_DETACH:
       cause_type  = S1ap_Cause_PR_nas;
@@ -1328,15 +1365,11 @@ status_code_e s1ap_mme_generate_ue_context_release_command(
       OAILOG_ERROR_UE(LOG_S1AP, imsi64, "Unknown cause for context release");
       OAILOG_FUNC_RETURN(LOG_S1AP, RETURNerror);
   }
-  s1ap_mme_set_cause(&ie->value.choice.Cause, cause_type, cause_value);
-  ASN_SEQUENCE_ADD(&out->protocolIEs.list, ie);
-
-  if (s1ap_mme_encode_pdu(&pdu, &buffer, &length) < 0) {
+  b = encode_ue_context_release_command(
+      mme_ue_s1ap_id, enb_ue_s1ap_id, cause_type, cause_value);
+  if (b == NULL) {
     OAILOG_FUNC_RETURN(LOG_S1AP, RETURNerror);
   }
-
-  bstring b = blk2bstr(buffer, length);
-  free(buffer);
   rc = s1ap_mme_itti_send_sctp_request(&b, assoc_id, stream, mme_ue_s1ap_id);
   if (ue_ref_p != NULL) {
     ue_ref_p->s1_ue_state = S1AP_UE_WAITING_CRR;
@@ -3105,6 +3138,7 @@ status_code_e s1ap_mme_handle_handover_notify(
     s1ap_remove_ue(state, src_ue_ref_p);
 
     /* Mapping between mme_ue_s1ap_id, assoc_id and enb_ue_s1ap_id */
+    s1ap_state_bind_ue_mmeid(new_ue_ref_p);
     hashtable_rc_t h_rc = hashtable_ts_insert(
         &state->mmeid2associd, (const hash_key_t) new_ue_ref_p->mme_ue_s1ap_id,
         (void*) (uintptr_t) assoc_id);
@@ -3366,6 +3400,7 @@ status_code_e s1ap_mme_handle_path_switch_request(
     s1ap_remove_ue(state, ue_ref_p);
 
     /* Mapping between mme_ue_s1ap_id, assoc_id and enb_ue_s1ap_id */
+    s1ap_state_bind_ue_mmeid(new_ue_ref_p);
     hashtable_rc_t h_rc = hashtable_ts_insert(
         &state->mmeid2associd, (const hash_key_t) new_ue_ref_p->mme_ue_s1ap_id,
         (void*) (uintptr_t) assoc_id);
@@ -4555,22 +4590,31 @@ status_code_e s1ap_handle_paging_request(
     OAILOG_FUNC_RETURN(LOG_S1AP, RETURNerror);
   }
   const paging_tai_list_t* p_tai_list = paging_request->paging_tai_list;
-  for (idx = 0; idx < enb_array->num_elements; idx++) {
+  sctp_assoc_id_t* assoc_ids =
+      calloc(enb_array->num_elements, sizeof(sctp_assoc_id_t));
+  uint16_t num_assoc = 0;
+  for (idx = 0; idx < enb_array->num_elements && assoc_ids; idx++) {
     enb_ref_p = (enb_description_t*) enb_array->elements[idx];
     if (enb_ref_p->s1_state == S1AP_READY) {
       supported_ta_list_t* enb_ta_list = &enb_ref_p->supported_ta_list;
 
       if ((is_tai_found = s1ap_paging_compare_ta_lists(
                enb_ta_list, p_tai_list, paging_request->tai_list_count))) {
-        bstring paging_msg_buffer = blk2bstr(buffer_p, length);
-        rc                        = s1ap_mme_itti_send_sctp_request(
-            &paging_msg_buffer, enb_ref_p->sctp_assoc_id,
-            0,   // Stream id 0 for non UE related
-                 // S1AP message
-            0);  // mme_ue_s1ap_id 0 because UE in idle
+        assoc_ids[num_assoc++] = enb_ref_p->sctp_assoc_id;
       }
     }
   }
+  // Encoded once, the same bytes are sent to every matching eNB
+  bstring paging_msg_buffer = blk2bstr(buffer_p, length);
+  if (paging_msg_buffer && assoc_ids) {
+    rc = s1ap_mme_itti_send_sctp_batch_request(
+        &paging_msg_buffer, assoc_ids, num_assoc,
+        0);  // Stream id 0 for non UE related S1AP message
+  } else {
+    bdestroy_wrapper(&paging_msg_buffer);
+    rc = RETURNerror;
+  }
+  free_wrapper((void**) &assoc_ids);
   free_wrapper((void**) &enb_array->elements);
   free_wrapper((void**) &enb_array);
   free(buffer_p);
@@ -5343,3 +5387,106 @@ status_code_e s1ap_send_mme_ue_context_release(
   message_p->ittiMsgHeader.imsi = imsi64;
   return send_msg_to_task(&s1ap_task_zmq_ctx, TASK_MME_APP, message_p);
 }
+
+//------------------------------------------------------------------------------
+// Overload Start with the action of the level, Overload Stop for no overload
+static status_code_e s1ap_mme_encode_overload(
+    mme_overload_level_t level, uint8_t** buffer_p, uint32_t* length) {
+  S1ap_S1AP_PDU_t pdu         = {0};
+  S1ap_OverloadStart_t* out   = NULL;
+  S1ap_OverloadStartIEs_t* ie = NULL;
+
+  pdu.present = S1ap_S1AP_PDU_PR_initiatingMessage;
+  pdu.choice.initiatingMessage.criticality = S1ap_Criticality_ignore;
+  if (level == MME_OVERLOAD_NONE) {
+    pdu.choice.initiatingMessage.procedureCode =
+        S1ap_ProcedureCode_id_OverloadStop;
+    pdu.choice.initiatingMessage.value.present =
+        S1ap_InitiatingMessage__value_PR_OverloadStop;
+  } else {
+    pdu.choice.initiatingMessage.procedureCode =
+        S1ap_ProcedureCode_id_OverloadStart;
+    pdu.choice.initiatingMessage.value.present =
+        S1ap_InitiatingMessage__value_PR_OverloadStart;
+    out = &pdu.choice.initiatingMessage.value.choice.OverloadStart;
+
+    ie = (S1ap_OverloadStartIEs_t*) calloc(1, sizeof(S1ap_OverloadStartIEs_t));
+    ie->id            = S1ap_ProtocolIE_ID_id_OverloadResponse;
+    ie->criticality   = S1ap_Criticality_reject;
+    ie->value.present = S1ap_OverloadStartIEs__value_PR_OverloadResponse;
+    ie->value.choice.OverloadResponse.present =
+        S1ap_OverloadResponse_PR_overloadAction;
+    // MO signalling is only rejected once procedures in progress are shed
+    ie->value.choice.OverloadResponse.choice.overloadAction =
+        (level == MME_OVERLOAD_REJECT_NEW) ?
+            S1ap_OverloadAction_reject_non_emergency_mo_dt :
+            S1ap_OverloadAction_reject_rrc_cr_signalling;
+    ASN_SEQUENCE_ADD(&out->protocolIEs.list, ie);
+  }
+
+  if (s1ap_mme_encode_pdu(&pdu, buffer_p, length) < 0 || *length == 0) {
+    OAILOG_ERROR(
+        LOG_S1AP, "Failed to encode overload %s\n",
+        level == MME_OVERLOAD_NONE ? "stop" : "start");
+    return RETURNerror;
+  }
+  return RETURNok;
+}
+
+//------------------------------------------------------------------------------
+status_code_e s1ap_mme_send_overload(
+    const sctp_assoc_id_t assoc_id, mme_overload_level_t level) {
+  uint8_t* buffer_p = NULL;
+  uint32_t length   = 0;
+  int rc            = RETURNok;
+
+  OAILOG_FUNC_IN(LOG_S1AP);
+  if (s1ap_mme_encode_overload(level, &buffer_p, &length) != RETURNok) {
+    OAILOG_FUNC_RETURN(LOG_S1AP, RETURNerror);
+  }
+  bstring b = blk2bstr(buffer_p, length);
+  free(buffer_p);
+  rc = s1ap_mme_itti_send_sctp_request(&b, assoc_id, 0, INVALID_MME_UE_S1AP_ID);
+  OAILOG_FUNC_RETURN(LOG_S1AP, rc);
+}
+
+//------------------------------------------------------------------------------
+status_code_e s1ap_mme_send_overload_to_enbs(
+    s1ap_state_t* state, mme_overload_level_t level) {
+  uint8_t* buffer_p                    = NULL;
+  uint32_t length                      = 0;
+  hashtable_element_array_t* enb_array = NULL;
+  sctp_assoc_id_t* assoc_ids           = NULL;
+  uint16_t num_assoc                   = 0;
+  int rc                               = RETURNerror;
+
+  OAILOG_FUNC_IN(LOG_S1AP);
+  if ((enb_array = hashtable_ts_get_elements(&state->enbs)) == NULL) {
+    // No eNB connected
+    OAILOG_FUNC_RETURN(LOG_S1AP, RETURNok);
+  }
+  assoc_ids = calloc(enb_array->num_elements, sizeof(sctp_assoc_id_t));
+  for (uint32_t idx = 0; idx < enb_array->num_elements && assoc_ids; idx++) {
+    enb_description_t* enb_ref_p =
+        (enb_description_t*) enb_array->elements[idx];
+    if (enb_ref_p->s1_state == S1AP_READY) {
+      assoc_ids[num_assoc++] = enb_ref_p->sctp_assoc_id;
+    }
+  }
+  free_wrapper((void**) &enb_array->elements);
+  free_wrapper((void**) &enb_array);
+
+  if (num_assoc == 0) {
+    rc = RETURNok;
+  } else if (s1ap_mme_encode_overload(level, &buffer_p, &length) == RETURNok) {
+    // Encoded once, the same bytes are sent to every eNB
+    bstring overload_msg_buffer = blk2bstr(buffer_p, length);
+    if (overload_msg_buffer) {
+      rc = s1ap_mme_itti_send_sctp_batch_request(
+          &overload_msg_buffer, assoc_ids, num_assoc, 0);
+    }
+    free(buffer_p);
+  }
+  free_wrapper((void**) &assoc_ids);
+  OAILOG_FUNC_RETURN(LOG_S1AP, rc);
+}
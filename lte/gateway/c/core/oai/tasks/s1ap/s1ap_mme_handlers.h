@@ -210,4 +210,15 @@ status_code_e s1ap_mme_remove_stale_ue_context(
 status_code_e s1ap_send_mme_ue_context_release(
     s1ap_state_t* state, ue_description_t* ue_ref_p,
     enum s1cause s1_release_cause, S1ap_Cause_t ie_cause, imsi64_t imsi64);
+
+/** \brief Send Overload Start with the action of the level to an eNB, or
+ * Overload Stop for MME_OVERLOAD_NONE
+ **/
+status_code_e s1ap_mme_send_overload(
+    const sctp_assoc_id_t assoc_id, mme_overload_level_t level);
+
+/** \brief Same as s1ap_mme_send_overload() to every eNB set up
+ **/
+status_code_e s1ap_mme_send_overload_to_enbs(
+    s1ap_state_t* state, mme_overload_level_t level);
 #endif /* FILE_S1AP_MME_HANDLERS_SEEN */
@@ -30,7 +30,10 @@
 #include "bstrlib.h"
 #include "log.h"
 #include "assertions.h"
+#include "dynamic_memory_check.h"
 #include "intertask_interface.h"
+#include "itti_free_defined_msg.h"
+#include "mem_arena.h"
 #include "s1ap_mme_itti_messaging.h"
 #include "S1ap_CauseRadioNetwork.h"
 #include "nas/as_message.h"
@@ -62,10 +65,50 @@ status_code_e s1ap_mme_itti_send_sctp_request(
   return send_msg_to_task(&s1ap_task_zmq_ctx, TASK_SCTP, message_p);
 }
 
+//------------------------------------------------------------------------------
+status_code_e s1ap_mme_itti_send_sctp_batch_request(
+    STOLEN_REF bstring* payload, const sctp_assoc_id_t* assoc_ids,
+    uint16_t num_assoc, const sctp_stream_id_t stream) {
+  MessageDef* message_p = NULL;
+
+  if (num_assoc == 0) {
+    bdestroy_wrapper(payload);
+    return RETURNok;
+  }
+  message_p = itti_alloc_new_message(TASK_S1AP, SCTP_DATA_BATCH_REQ);
+  if (message_p == NULL) {
+    OAILOG_ERROR(
+        LOG_S1AP,
+        "itti_alloc_new_message Failed for"
+        " SCTP_DATA_BATCH_REQ \n");
+    bdestroy_wrapper(payload);
+    OAILOG_FUNC_RETURN(LOG_S1AP, RETURNerror);
+  }
+  sctp_data_batch_req_t* batch_req = &SCTP_DATA_BATCH_REQ(message_p);
+  batch_req->targets               = mem_arena_alloc(
+      itti_get_msg_arena(message_p), num_assoc * sizeof(sctp_data_target_t));
+  if (batch_req->targets == NULL) {
+    bdestroy_wrapper(payload);
+    itti_free_msg_content(message_p);
+    free(message_p);
+    OAILOG_FUNC_RETURN(LOG_S1AP, RETURNerror);
+  }
+  for (uint16_t i = 0; i < num_assoc; i++) {
+    batch_req->targets[i].assoc_id = assoc_ids[i];
+    batch_req->targets[i].stream   = stream;
+  }
+  batch_req->num_targets = num_assoc;
+  batch_req->payload     = *payload;
+  *payload               = NULL;
+  batch_req->ppid        = S1AP_SCTP_PPID;
+  return send_msg_to_task(&s1ap_task_zmq_ctx, TASK_SCTP, message_p);
+}
+
 //------------------------------------------------------------------------------
 status_code_e s1ap_mme_itti_nas_uplink_ind(
-    const mme_ue_s1ap_id_t ue_id, STOLEN_REF bstring* payload,
-    const tai_t* const tai, const ecgi_t* const cgi) {
+    const mme_ue_s1ap_id_t ue_id, const uint8_t* const nas_pdu,
+    const uint32_t nas_pdu_length, const tai_t* const tai,
+    const ecgi_t* const cgi) {
   MessageDef* message_p = NULL;
   imsi64_t imsi64       = INVALID_IMSI64;
 
@@ -86,11 +129,13 @@ status_code_e s1ap_mme_itti_nas_uplink_ind(
     OAILOG_FUNC_RETURN(LOG_S1AP, RETURNerror);
   }
   ITTI_MSG_LASTHOP_LATENCY(message_p)    = s1ap_last_msg_latency;
-  MME_APP_UL_DATA_IND(message_p).ue_id   = ue_id;
-  MME_APP_UL_DATA_IND(message_p).nas_msg = *payload;
-  *payload                               = NULL;
-  MME_APP_UL_DATA_IND(message_p).tai     = *tai;
-  MME_APP_UL_DATA_IND(message_p).cgi     = *cgi;
+  MME_APP_UL_DATA_IND(message_p).ue_id = ue_id;
+  // The NAS PDU is consumed while MME_APP handles the message, keep it in
+  // the message arena instead of a separate heap bstring
+  MME_APP_UL_DATA_IND(message_p).nas_msg = mem_arena_blk2bstr(
+      itti_get_msg_arena(message_p), nas_pdu, nas_pdu_length);
+  MME_APP_UL_DATA_IND(message_p).tai = *tai;
+  MME_APP_UL_DATA_IND(message_p).cgi = *cgi;
 
   message_p->ittiMsgHeader.imsi = imsi64;
   return send_msg_to_task(&s1ap_task_zmq_ctx, TASK_MME_APP, message_p);
@@ -179,7 +224,8 @@ void s1ap_mme_itti_s1ap_initial_ue_message(
   S1AP_INITIAL_UE_MESSAGE(message_p).enb_ue_s1ap_id = enb_ue_s1ap_id;
   S1AP_INITIAL_UE_MESSAGE(message_p).enb_id         = enb_id;
 
-  S1AP_INITIAL_UE_MESSAGE(message_p).nas = blk2bstr(nas_msg, nas_msg_length);
+  S1AP_INITIAL_UE_MESSAGE(message_p).nas = mem_arena_blk2bstr(
+      itti_get_msg_arena(message_p), nas_msg, nas_msg_length);
 
   S1AP_INITIAL_UE_MESSAGE(message_p).tai = *tai;
 
@@ -48,9 +48,21 @@ status_code_e s1ap_mme_itti_send_sctp_request(
     STOLEN_REF bstring* payload, const uint32_t sctp_assoc_id_t,
     const sctp_stream_id_t stream, const mme_ue_s1ap_id_t ue_id);
 
+/** \brief Send the same encoded PDU to several associations with a single
+ * ITTI message and a single copy of the bytes.
+ * \param payload Encoded PDU, owned by the message
+ * \param assoc_ids Destination associations
+ * \param num_assoc Number of entries in assoc_ids, must be > 0
+ * \param stream Stream used on every association
+ **/
+status_code_e s1ap_mme_itti_send_sctp_batch_request(
+    STOLEN_REF bstring* payload, const sctp_assoc_id_t* assoc_ids,
+    uint16_t num_assoc, const sctp_stream_id_t stream);
+
 status_code_e s1ap_mme_itti_nas_uplink_ind(
-    const mme_ue_s1ap_id_t ue_id, STOLEN_REF bstring* payload,
-    const tai_t* const tai, const ecgi_t* const cgi);
+    const mme_ue_s1ap_id_t ue_id, const uint8_t* const nas_pdu,
+    const uint32_t nas_pdu_length, const tai_t* const tai,
+    const ecgi_t* const cgi);
 
 status_code_e s1ap_mme_itti_nas_downlink_cnf(
     const mme_ue_s1ap_id_t ue_id, const bool is_success);
@@ -77,9 +77,22 @@
 #include "S1ap_ProtocolIE-Field.h"
 #include "s1ap_common.h"
 
-extern bool s1ap_congestion_control_enabled;
-extern long s1ap_last_msg_latency;
-extern long s1ap_zmq_th;
+/*
+ * An Initial UE Message starts a new procedure, an attach, a TAU or a service
+ * request: the mobile originated ones are shed first. Emergency, high
+ * priority and mobile terminated access are always admitted.
+ */
+static mme_admission_class_t s1ap_rrc_cause_admission_class(
+    S1ap_RRC_Establishment_Cause_t cause) {
+  switch (cause) {
+    case S1ap_RRC_Establishment_Cause_emergency:
+    case S1ap_RRC_Establishment_Cause_highPriorityAccess:
+    case S1ap_RRC_Establishment_Cause_mt_Access:
+      return MME_ADMISSION_PRIORITY;
+    default:
+      return MME_ADMISSION_NEW;
+  }
+}
 
 //------------------------------------------------------------------------------
 status_code_e s1ap_mme_handle_initial_ue_message(
@@ -105,14 +118,18 @@ status_code_e s1ap_mme_handle_initial_ue_message(
       " assoc-id:%d \n",
       (enb_ue_s1ap_id_t) ie->value.choice.ENB_UE_S1AP_ID, assoc_id);
 
-  if (s1ap_congestion_control_enabled &&
-      (s1ap_last_msg_latency > S1AP_ZMQ_LATENCY_TH)) {
+  S1AP_FIND_PROTOCOLIE_BY_ID(
+      S1ap_InitialUEMessage_IEs_t, ie_cause, container,
+      S1ap_ProtocolIE_ID_id_RRC_Establishment_Cause, true);
+  if (!mme_overload_admit(s1ap_rrc_cause_admission_class(
+          ie_cause->value.choice.RRC_Establishment_Cause))) {
     OAILOG_WARNING(
         LOG_S1AP,
         "Discarding S1AP INITIAL_UE_MESSAGE for "
-        "ENB_UE_S1AP_ID: " ENB_UE_S1AP_ID_FMT " ZMQ latency: %ld",
+        "ENB_UE_S1AP_ID: " ENB_UE_S1AP_ID_FMT
+        " RRC establishment cause: %ld as the MME is overloaded",
         (enb_ue_s1ap_id_t) ie->value.choice.ENB_UE_S1AP_ID,
-        s1ap_last_msg_latency);
+        ie_cause->value.choice.RRC_Establishment_Cause);
     OAILOG_FUNC_RETURN(LOG_S1AP, RETURNerror);
   }
 
@@ -245,9 +262,6 @@ status_code_e s1ap_mme_handle_initial_ue_message(
     S1AP_FIND_PROTOCOLIE_BY_ID(
         S1ap_InitialUEMessage_IEs_t, ie, container,
         S1ap_ProtocolIE_ID_id_NAS_PDU, true);
-    S1AP_FIND_PROTOCOLIE_BY_ID(
-        S1ap_InitialUEMessage_IEs_t, ie_cause, container,
-        S1ap_ProtocolIE_ID_id_RRC_Establishment_Cause, true);
     s1ap_mme_itti_s1ap_initial_ue_message(
         assoc_id, eNB_ref->enb_id, ue_ref->enb_ue_s1ap_id,
         ie->value.choice.NAS_PDU.buf, ie->value.choice.NAS_PDU.size, &tai,
@@ -393,10 +407,9 @@ status_code_e s1ap_mme_handle_uplink_nas_transport(
   ecgi.cell_identity.enb_id = enb_ref->enb_id;
   // TODO optional GW Transport Layer Address
 
-  bstring b = blk2bstr(
-      ie_nas_pdu->value.choice.NAS_PDU.buf,
-      ie_nas_pdu->value.choice.NAS_PDU.size);
-  s1ap_mme_itti_nas_uplink_ind(mme_ue_s1ap_id, &b, &tai, &ecgi);
+  s1ap_mme_itti_nas_uplink_ind(
+      mme_ue_s1ap_id, ie_nas_pdu->value.choice.NAS_PDU.buf,
+      ie_nas_pdu->value.choice.NAS_PDU.size, &tai, &ecgi);
   OAILOG_FUNC_RETURN(LOG_S1AP, RETURNok);
 }
 
@@ -489,16 +502,85 @@ status_code_e s1ap_mme_handle_nas_non_delivery(
   OAILOG_FUNC_RETURN(LOG_S1AP, RETURNok);
 }
 
+//------------------------------------------------------------------------------
+// Encoded straight to APER, or with asn1c when out of the direct encoder scope
+static bstring encode_downlink_nas_transport(
+    const ue_description_t* ue_ref, const_bstring payload) {
+  uint8_t* buffer_p = NULL;
+  uint32_t length   = 0;
+  bstring b         = bfromcstralloc(
+      blength(payload) + S1AP_DOWNLINK_NAS_TRANSPORT_OVERHEAD + 1, "");
+  int encoded = s1ap_mme_encode_downlink_nas_transport(
+      ue_ref->mme_ue_s1ap_id, ue_ref->enb_ue_s1ap_id, (uint8_t*) bdata(payload),
+      blength(payload), b->data, b->mlen - 1);
+
+  if (encoded >= 0) {
+    b->slen          = encoded;
+    b->data[encoded] = '\0';
+    return b;
+  }
+  bdestroy_wrapper(&b);
+
+  S1ap_DownlinkNASTransport_IEs_t* ie = NULL;
+  S1ap_DownlinkNASTransport_t* out    = NULL;
+  S1ap_S1AP_PDU_t pdu                 = {0};
+
+  pdu.present = S1ap_S1AP_PDU_PR_initiatingMessage;
+  pdu.choice.initiatingMessage.procedureCode =
+      S1ap_ProcedureCode_id_downlinkNASTransport;
+  pdu.choice.initiatingMessage.criticality = S1ap_Criticality_ignore;
+  pdu.choice.initiatingMessage.value.present =
+      S1ap_InitiatingMessage__value_PR_DownlinkNASTransport;
+
+  out = &pdu.choice.initiatingMessage.value.choice.DownlinkNASTransport;
+
+  /*
+   * Setting UE informations with the ones found in ue_ref
+   */
+  ie = (S1ap_DownlinkNASTransport_IEs_t*) calloc(
+      1, sizeof(S1ap_DownlinkNASTransport_IEs_t));
+  ie->id            = S1ap_ProtocolIE_ID_id_MME_UE_S1AP_ID;
+  ie->criticality   = S1ap_Criticality_reject;
+  ie->value.present = S1ap_DownlinkNASTransport_IEs__value_PR_MME_UE_S1AP_ID;
+  ie->value.choice.MME_UE_S1AP_ID = ue_ref->mme_ue_s1ap_id;
+  ASN_SEQUENCE_ADD(&out->protocolIEs.list, ie);
+
+  /* mandatory */
+  ie = (S1ap_DownlinkNASTransport_IEs_t*) calloc(
+      1, sizeof(S1ap_DownlinkNASTransport_IEs_t));
+  ie->id            = S1ap_ProtocolIE_ID_id_eNB_UE_S1AP_ID;
+  ie->criticality   = S1ap_Criticality_reject;
+  ie->value.present = S1ap_DownlinkNASTransport_IEs__value_PR_ENB_UE_S1AP_ID;
+  ie->value.choice.ENB_UE_S1AP_ID = ue_ref->enb_ue_s1ap_id;
+  ASN_SEQUENCE_ADD(&out->protocolIEs.list, ie);
+  /* mandatory */
+  ie = (S1ap_DownlinkNASTransport_IEs_t*) calloc(
+      1, sizeof(S1ap_DownlinkNASTransport_IEs_t));
+  ie->id            = S1ap_ProtocolIE_ID_id_NAS_PDU;
+  ie->criticality   = S1ap_Criticality_reject;
+  ie->value.present = S1ap_DownlinkNASTransport_IEs__value_PR_NAS_PDU;
+  /*eNB
+   * Fill in the NAS pdu
+   */
+  OCTET_STRING_fromBuf(
+      &ie->value.choice.NAS_PDU, (char*) bdata(payload), blength(payload));
+  ASN_SEQUENCE_ADD(&out->protocolIEs.list, ie);
+
+  if (s1ap_mme_encode_pdu(&pdu, &buffer_p, &length) < 0) {
+    return NULL;
+  }
+  b = blk2bstr(buffer_p, length);
+  free(buffer_p);
+  return b;
+}
+
 //------------------------------------------------------------------------------
 status_code_e s1ap_generate_downlink_nas_transport(
     s1ap_state_t* state, const enb_ue_s1ap_id_t enb_ue_s1ap_id,
     const mme_ue_s1ap_id_t ue_id, STOLEN_REF bstring* payload,
     const imsi64_t imsi64, bool* is_state_same) {
   ue_description_t* ue_ref = NULL;
-  uint8_t* buffer_p        = NULL;
-  uint32_t length          = 0;
   void* id                 = NULL;
-  uint8_t err              = 0;
 
   OAILOG_FUNC_IN(LOG_S1AP);
 
@@ -538,26 +620,11 @@ status_code_e s1ap_generate_downlink_nas_transport(
      * We have found the UE in the list.
      * * * * Create new IE list message and encode it.
      */
-    s1ap_imsi_map_t* imsi_map = get_s1ap_imsi_map();
-    if (hashtable_uint64_ts_insert(
-            imsi_map->mme_ue_id_imsi_htbl, (const hash_key_t) ue_id, imsi64) ==
+    if (s1ap_imsi_map_insert(ue_id, imsi64) ==
         HASH_TABLE_SAME_KEY_VALUE_EXISTS) {
       *is_state_same = true;
     }
 
-    S1ap_DownlinkNASTransport_IEs_t* ie = NULL;
-    S1ap_DownlinkNASTransport_t* out    = NULL;
-    S1ap_S1AP_PDU_t pdu                 = {0};
-
-    pdu.present = S1ap_S1AP_PDU_PR_initiatingMessage;
-    pdu.choice.initiatingMessage.procedureCode =
-        S1ap_ProcedureCode_id_downlinkNASTransport;
-    pdu.choice.initiatingMessage.criticality = S1ap_Criticality_ignore;
-    pdu.choice.initiatingMessage.value.present =
-        S1ap_InitiatingMessage__value_PR_DownlinkNASTransport;
-
-    out = &pdu.choice.initiatingMessage.value.choice.DownlinkNASTransport;
-
     if (ue_ref->s1_ue_state == S1AP_UE_WAITING_CRR) {
       OAILOG_ERROR_UE(
           LOG_S1AP, imsi64,
@@ -567,43 +634,8 @@ status_code_e s1ap_generate_downlink_nas_transport(
     } else {
       ue_ref->s1_ue_state = S1AP_UE_CONNECTED;
     }
-    /*
-     * Setting UE informations with the ones found in ue_ref
-     */
-    ie = (S1ap_DownlinkNASTransport_IEs_t*) calloc(
-        1, sizeof(S1ap_DownlinkNASTransport_IEs_t));
-    ie->id            = S1ap_ProtocolIE_ID_id_MME_UE_S1AP_ID;
-    ie->criticality   = S1ap_Criticality_reject;
-    ie->value.present = S1ap_DownlinkNASTransport_IEs__value_PR_MME_UE_S1AP_ID;
-    ie->value.choice.MME_UE_S1AP_ID = ue_ref->mme_ue_s1ap_id;
-    ASN_SEQUENCE_ADD(&out->protocolIEs.list, ie);
-
-    /* mandatory */
-    ie = (S1ap_DownlinkNASTransport_IEs_t*) calloc(
-        1, sizeof(S1ap_DownlinkNASTransport_IEs_t));
-    ie->id            = S1ap_ProtocolIE_ID_id_eNB_UE_S1AP_ID;
-    ie->criticality   = S1ap_Criticality_reject;
-    ie->value.present = S1ap_DownlinkNASTransport_IEs__value_PR_ENB_UE_S1AP_ID;
-    ie->value.choice.ENB_UE_S1AP_ID = ue_ref->enb_ue_s1ap_id;
-    ASN_SEQUENCE_ADD(&out->protocolIEs.list, ie);
-    /* mandatory */
-    ie = (S1ap_DownlinkNASTransport_IEs_t*) calloc(
-        1, sizeof(S1ap_DownlinkNASTransport_IEs_t));
-    ie->id            = S1ap_ProtocolIE_ID_id_NAS_PDU;
-    ie->criticality   = S1ap_Criticality_reject;
-    ie->value.present = S1ap_DownlinkNASTransport_IEs__value_PR_NAS_PDU;
-    /*eNB
-     * Fill in the NAS pdu
-     */
-    OCTET_STRING_fromBuf(
-        &ie->value.choice.NAS_PDU, (char*) bdata(*payload), blength(*payload));
-    ASN_SEQUENCE_ADD(&out->protocolIEs.list, ie);
-
-    if (s1ap_mme_encode_pdu(&pdu, &buffer_p, &length) < 0) {
-      err = 1;
-    }
-    ASN_STRUCT_FREE_CONTENTS_ONLY(asn_DEF_S1ap_DownlinkNASTransport, out);
-    if (err) {
+    bstring b = encode_downlink_nas_transport(ue_ref, *payload);
+    if (b == NULL) {
       OAILOG_FUNC_RETURN(LOG_S1AP, RETURNerror);
     }
 
@@ -613,8 +645,6 @@ status_code_e s1ap_generate_downlink_nas_transport(
         " MME_UE_S1AP_ID = " MME_UE_S1AP_ID_FMT
         " eNB_UE_S1AP_ID = " ENB_UE_S1AP_ID_FMT "\n",
         ue_id, ue_ref->mme_ue_s1ap_id, enb_ue_s1ap_id);
-    bstring b = blk2bstr(buffer_p, length);
-    free(buffer_p);
     s1ap_mme_itti_send_sctp_request(
         &b, ue_ref->sctp_assoc_id, ue_ref->sctp_stream_send,
         ue_ref->mme_ue_s1ap_id);
@@ -1169,7 +1199,8 @@ void s1ap_handle_mme_ue_id_notification(
         s1ap_state_get_ue_enbid(enb_ref->sctp_assoc_id, enb_ue_s1ap_id);
     if (ue_ref) {
       ue_ref->mme_ue_s1ap_id = mme_ue_s1ap_id;
-      hashtable_rc_t h_rc    = hashtable_ts_insert(
+      s1ap_state_bind_ue_mmeid(ue_ref);
+      hashtable_rc_t h_rc = hashtable_ts_insert(
           &state->mmeid2associd, (const hash_key_t) mme_ue_s1ap_id,
           (void*) (uintptr_t) sctp_assoc_id);
 
@@ -34,6 +34,21 @@ extern "C" {
 
 using magma::lte::S1apStateManager;
 
+// Remove imsi64 from the reverse IMSI index if it still points to
+// mme_ue_s1ap_id
+static void s1ap_imsi_map_remove_imsi(
+    s1ap_imsi_map_t* imsi_map, imsi64_t imsi64,
+    mme_ue_s1ap_id_t mme_ue_s1ap_id) {
+  uint64_t indexed_ue_id = INVALID_MME_UE_S1AP_ID;
+  if ((hashtable_uint64_ts_get(
+           imsi_map->imsi_mme_ue_id_htbl, (const hash_key_t) imsi64,
+           &indexed_ue_id) == HASH_TABLE_OK) &&
+      (indexed_ue_id == mme_ue_s1ap_id)) {
+    hashtable_uint64_ts_remove(
+        imsi_map->imsi_mme_ue_id_htbl, (const hash_key_t) imsi64);
+  }
+}
+
 int s1ap_state_init(uint32_t max_ues, uint32_t max_enbs, bool use_stateless) {
   S1apStateManager::getInstance().init(max_ues, max_enbs, use_stateless);
   // remove UEs with unknown IMSI from eNB state
@@ -75,25 +90,68 @@ ue_description_t* s1ap_state_get_ue_enbid(
 }
 
 ue_description_t* s1ap_state_get_ue_mmeid(mme_ue_s1ap_id_t mme_ue_s1ap_id) {
-  ue_description_t* ue = nullptr;
-
+  ue_description_t* ue  = nullptr;
+  uint64_t comp_s1ap_id = 0;
+
+  hash_table_uint64_ts_t* mme_ue_id_ht =
+      S1apStateManager::getInstance().get_mme_ue_id_ht();
+  if (hashtable_uint64_ts_get(
+          mme_ue_id_ht, (const hash_key_t) mme_ue_s1ap_id, &comp_s1ap_id) !=
+      HASH_TABLE_OK) {
+    return nullptr;
+  }
   hash_table_ts_t* state_ue_ht = get_s1ap_ue_state();
-  hashtable_ts_apply_callback_on_elements(
-      (hash_table_ts_t* const) state_ue_ht, s1ap_ue_compare_by_mme_ue_id_cb,
-      &mme_ue_s1ap_id, (void**) &ue);
+  hashtable_ts_get(state_ue_ht, (const hash_key_t) comp_s1ap_id, (void**) &ue);
+  if (ue && ue->mme_ue_s1ap_id != mme_ue_s1ap_id) {
+    OAILOG_ERROR(
+        LOG_S1AP,
+        "Stale index entry for mme_ue_s1ap_id " MME_UE_S1AP_ID_FMT
+        ", UE context has mme_ue_s1ap_id " MME_UE_S1AP_ID_FMT "\n",
+        mme_ue_s1ap_id, ue->mme_ue_s1ap_id);
+    return nullptr;
+  }
 
   return ue;
 }
 
 ue_description_t* s1ap_state_get_ue_imsi(imsi64_t imsi64) {
-  ue_description_t* ue = nullptr;
+  uint64_t mme_ue_s1ap_id = INVALID_MME_UE_S1AP_ID;
 
-  hash_table_ts_t* state_ue_ht = get_s1ap_ue_state();
-  hashtable_ts_apply_callback_on_elements(
-      (hash_table_ts_t* const) state_ue_ht, s1ap_ue_compare_by_imsi, &imsi64,
-      (void**) &ue);
+  if (imsi64 == INVALID_IMSI64) {
+    return nullptr;
+  }
+  s1ap_imsi_map_t* imsi_map = get_s1ap_imsi_map();
+  if (hashtable_uint64_ts_get(
+          imsi_map->imsi_mme_ue_id_htbl, (const hash_key_t) imsi64,
+          &mme_ue_s1ap_id) != HASH_TABLE_OK) {
+    return nullptr;
+  }
 
-  return ue;
+  return s1ap_state_get_ue_mmeid((mme_ue_s1ap_id_t) mme_ue_s1ap_id);
+}
+
+void s1ap_state_bind_ue_mmeid(const ue_description_t* ue_ref) {
+  if (ue_ref->mme_ue_s1ap_id == INVALID_MME_UE_S1AP_ID) {
+    return;
+  }
+  hashtable_uint64_ts_insert(
+      S1apStateManager::getInstance().get_mme_ue_id_ht(),
+      (const hash_key_t) ue_ref->mme_ue_s1ap_id, ue_ref->comp_s1ap_id);
+}
+
+void s1ap_state_unbind_ue_mmeid(const ue_description_t* ue_ref) {
+  uint64_t comp_s1ap_id = 0;
+
+  hash_table_uint64_ts_t* mme_ue_id_ht =
+      S1apStateManager::getInstance().get_mme_ue_id_ht();
+  // On handover the id moves to the UE context of the target eNB
+  if ((hashtable_uint64_ts_get(
+           mme_ue_id_ht, (const hash_key_t) ue_ref->mme_ue_s1ap_id,
+           &comp_s1ap_id) == HASH_TABLE_OK) &&
+      (comp_s1ap_id == ue_ref->comp_s1ap_id)) {
+    hashtable_uint64_ts_remove(
+        mme_ue_id_ht, (const hash_key_t) ue_ref->mme_ue_s1ap_id);
+  }
 }
 
 void put_s1ap_imsi_map() {
@@ -104,39 +162,42 @@ s1ap_imsi_map_t* get_s1ap_imsi_map() {
   return S1apStateManager::getInstance().get_s1ap_imsi_map();
 }
 
-bool s1ap_ue_compare_by_mme_ue_id_cb(
-    __attribute__((unused)) const hash_key_t keyP, void* const elementP,
-    void* parameterP, void** resultP) {
-  mme_ue_s1ap_id_t* mme_ue_s1ap_id_p = (mme_ue_s1ap_id_t*) parameterP;
-  ue_description_t* ue_ref           = (ue_description_t*) elementP;
-  if (*mme_ue_s1ap_id_p == ue_ref->mme_ue_s1ap_id) {
-    *resultP = elementP;
-    OAILOG_TRACE(
-        LOG_S1AP, "Found ue_ref %p mme_ue_s1ap_id " MME_UE_S1AP_ID_FMT "\n",
-        ue_ref, ue_ref->mme_ue_s1ap_id);
-    return true;
+hashtable_rc_t s1ap_imsi_map_insert(
+    mme_ue_s1ap_id_t mme_ue_s1ap_id, imsi64_t imsi64) {
+  imsi64_t old_imsi64       = INVALID_IMSI64;
+  s1ap_imsi_map_t* imsi_map = get_s1ap_imsi_map();
+
+  hashtable_uint64_ts_get(
+      imsi_map->mme_ue_id_imsi_htbl, (const hash_key_t) mme_ue_s1ap_id,
+      &old_imsi64);
+  hashtable_rc_t h_rc = hashtable_uint64_ts_insert(
+      imsi_map->mme_ue_id_imsi_htbl, (const hash_key_t) mme_ue_s1ap_id,
+      imsi64);
+  if (h_rc == HASH_TABLE_SAME_KEY_VALUE_EXISTS) {
+    return h_rc;
   }
-  return false;
+  if (old_imsi64 != INVALID_IMSI64) {
+    s1ap_imsi_map_remove_imsi(imsi_map, old_imsi64, mme_ue_s1ap_id);
+  }
+  // A re-attach gets a new mme_ue_s1ap_id, the latest one is the live UE
+  hashtable_uint64_ts_insert(
+      imsi_map->imsi_mme_ue_id_htbl, (const hash_key_t) imsi64,
+      mme_ue_s1ap_id);
+  return h_rc;
 }
 
-bool s1ap_ue_compare_by_imsi(
-    __attribute__((unused)) const hash_key_t keyP, void* const elementP,
-    void* parameterP, void** resultP) {
-  imsi64_t imsi64          = INVALID_IMSI64;
-  imsi64_t* target_imsi64  = (imsi64_t*) parameterP;
-  ue_description_t* ue_ref = (ue_description_t*) elementP;
-
+void s1ap_imsi_map_remove(mme_ue_s1ap_id_t mme_ue_s1ap_id) {
+  imsi64_t imsi64           = INVALID_IMSI64;
   s1ap_imsi_map_t* imsi_map = get_s1ap_imsi_map();
-  hashtable_uint64_ts_get(
-      imsi_map->mme_ue_id_imsi_htbl, (const hash_key_t) ue_ref->mme_ue_s1ap_id,
-      &imsi64);
 
-  if (*target_imsi64 != INVALID_IMSI64 && *target_imsi64 == imsi64) {
-    *resultP = elementP;
-    OAILOG_DEBUG_UE(LOG_S1AP, imsi64, "Found ue_ref\n");
-    return true;
+  if (hashtable_uint64_ts_get(
+          imsi_map->mme_ue_id_imsi_htbl, (const hash_key_t) mme_ue_s1ap_id,
+          &imsi64) != HASH_TABLE_OK) {
+    return;
   }
-  return false;
+  s1ap_imsi_map_remove_imsi(imsi_map, imsi64, mme_ue_s1ap_id);
+  hashtable_uint64_ts_remove(
+      imsi_map->mme_ue_id_imsi_htbl, (const hash_key_t) mme_ue_s1ap_id);
 }
 
 hash_table_ts_t* get_s1ap_ue_state(void) {
@@ -188,7 +249,6 @@ void remove_ues_without_imsi_from_ue_id_coll() {
 
   hashtable_rc_t ht_rc;
   hash_key_t* mme_ue_id_no_imsi_list;
-  s1ap_imsi_map_t* s1ap_imsi_map = get_s1ap_imsi_map();
   uint32_t num_ues_checked;
 
   // get each eNB in s1ap_state
@@ -218,8 +278,7 @@ void remove_ues_without_imsi_from_ue_id_coll() {
     for (uint32_t i = 0; i < num_ues_checked; i++) {
       hashtable_uint64_ts_remove(
           &enb_association_p->ue_id_coll, mme_ue_id_no_imsi_list[i]);
-      hashtable_uint64_ts_remove(
-          s1ap_imsi_map->mme_ue_id_imsi_htbl, mme_ue_id_no_imsi_list[i]);
+      s1ap_imsi_map_remove((mme_ue_s1ap_id_t) mme_ue_id_no_imsi_list[i]);
       enb_association_p->nb_ue_associated--;
 
       OAILOG_DEBUG(
@@ -227,6 +227,12 @@ void S1apStateConverter::proto_to_s1ap_imsi_map(
     const oai::S1apImsiMap& s1ap_imsi_proto, s1ap_imsi_map_t* s1ap_imsi_map) {
   proto_to_hashtable_uint64_ts(
       s1ap_imsi_proto.mme_ue_id_imsi_map(), s1ap_imsi_map->mme_ue_id_imsi_htbl);
+  // The reverse index is not persisted, rebuild it from the forward map
+  for (auto const& kv : s1ap_imsi_proto.mme_ue_id_imsi_map()) {
+    hashtable_uint64_ts_insert(
+        s1ap_imsi_map->imsi_mme_ue_id_htbl, (const hash_key_t) kv.second,
+        kv.first);
+  }
 }
 
 void S1apStateConverter::supported_ta_list_to_proto(
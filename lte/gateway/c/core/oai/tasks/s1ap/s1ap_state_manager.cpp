@@ -22,6 +22,7 @@ namespace {
 constexpr char S1AP_ENB_COLL[]             = "s1ap_eNB_coll";
 constexpr char S1AP_MME_ID2ASSOC_ID_COLL[] = "s1ap_mme_id2assoc_id_coll";
 constexpr char S1AP_IMSI_MAP_TABLE_NAME[]  = "s1ap_imsi_map";
+constexpr char S1AP_MME_UE_ID_COLL[]       = "s1ap_mme_ue_id_coll";
 }  // namespace
 
 using magma::lte::oai::UeDescription;
@@ -33,7 +34,8 @@ S1apStateManager::S1apStateManager()
     : max_ues_(0),
       max_enbs_(0),
       s1ap_imsi_map_hash_(0),
-      s1ap_imsi_map_(nullptr) {}
+      s1ap_imsi_map_(nullptr),
+      mme_ue_id_ht_(nullptr) {}
 
 S1apStateManager::~S1apStateManager() {
   free_state();
@@ -53,6 +55,9 @@ void S1apStateManager::init(
   max_ues_              = max_ues;
   max_enbs_             = max_enbs;
   redis_client          = std::make_unique<RedisClient>(persist_state);
+  open_ue_state_region(
+      bdata(mme_config.ue_state_region_dir),
+      mme_config.ue_state_region_max_ues);
   create_state();
   if (read_state_from_db() != RETURNok) {
     OAILOG_ERROR(LOG_S1AP, "Failed to read state from redis");
@@ -70,7 +75,12 @@ void S1apStateManager::create_state() {
   hashtable_ts_init(
       &state_cache_p->enbs, max_enbs_, nullptr, free_wrapper, ht_name);
 
-  state_ue_ht = hashtable_ts_create(max_ues_, nullptr, free_wrapper, ht_name);
+  state_ue_ht = hashtable_ts_create(
+      max_ues_, hash_key_pair_hashfunc, free_wrapper, ht_name);
+  bdestroy(ht_name);
+
+  ht_name       = bfromcstr(S1AP_MME_UE_ID_COLL);
+  mme_ue_id_ht_ = hashtable_uint64_ts_create(max_ues_, nullptr, ht_name);
   bdestroy(ht_name);
 
   ht_name = bfromcstr(S1AP_MME_ID2ASSOC_ID_COLL);
@@ -122,6 +132,8 @@ void S1apStateManager::free_state() {
   if (hashtable_ts_destroy(state_ue_ht) != HASH_TABLE_OK) {
     OAI_FPRINTF_ERR("An error occurred while destroying assoc_id hash table");
   }
+  hashtable_uint64_ts_destroy(mme_ue_id_ht_);
+  mme_ue_id_ht_ = nullptr;
   free_wrapper((void**) &state_cache_p);
 
   clear_s1ap_imsi_map();
@@ -131,18 +143,22 @@ status_code_e S1apStateManager::read_ue_state_from_db() {
   if (!persist_state_enabled) {
     return RETURNok;
   }
-  auto keys = redis_client->get_keys("IMSI*" + task_name + "*");
-
-  for (const auto& key : keys) {
-    OAILOG_DEBUG(log_task, "Reading UE state from db for %s", key.c_str());
-    UeDescription ue_proto = UeDescription();
-    auto* ue_context = (ue_description_t*) calloc(1, sizeof(ue_description_t));
-    if (redis_client->read_proto(key, ue_proto) != RETURNok) {
-      return RETURNerror;
-    }
+  auto start = std::chrono::steady_clock::now();
+  std::vector<std::string> keys;
+  std::vector<UeDescription> ue_protos;
+  if (read_ue_protos_from_db(keys, ue_protos) != RETURNok) {
+    return RETURNerror;
+  }
 
-    S1apStateConverter::proto_to_ue(ue_proto, ue_context);
+  std::vector<ue_description_t*> ue_contexts(keys.size(), nullptr);
+  run_restore_workers(keys.size(), [&](size_t i) {
+    ue_contexts[i] = (ue_description_t*) calloc(1, sizeof(ue_description_t));
+    S1apStateConverter::proto_to_ue(ue_protos[i], ue_contexts[i]);
+  });
 
+  for (size_t i = 0; i < keys.size(); i++) {
+    auto* ue_context = ue_contexts[i];
+    OAILOG_DEBUG(log_task, "Reading UE state from db for %s", keys[i].c_str());
     hashtable_rc_t h_rc = hashtable_ts_insert(
         state_ue_ht, ue_context->comp_s1ap_id, (void*) ue_context);
     if (HASH_TABLE_OK != h_rc) {
@@ -154,6 +170,7 @@ status_code_e S1apStateManager::read_ue_state_from_db() {
           ue_context->comp_s1ap_id, ue_context->enb_ue_s1ap_id,
           ue_context->mme_ue_s1ap_id, hashtable_rc_code2string(h_rc));
     } else {
+      s1ap_state_bind_ue_mmeid(ue_context);
       OAILOG_DEBUG(
           log_task,
           "Inserted UE state with key comp_s1ap_id " COMP_S1AP_ID_FMT
@@ -163,6 +180,7 @@ status_code_e S1apStateManager::read_ue_state_from_db() {
           ue_context->mme_ue_s1ap_id);
     }
   }
+  report_ue_state_restore(keys.size(), start);
   return RETURNok;
 }
 
@@ -171,6 +189,8 @@ void S1apStateManager::create_s1ap_imsi_map() {
 
   s1ap_imsi_map_->mme_ue_id_imsi_htbl =
       hashtable_uint64_ts_create(max_ues_, nullptr, nullptr);
+  s1ap_imsi_map_->imsi_mme_ue_id_htbl =
+      hashtable_uint64_ts_create(max_ues_, nullptr, nullptr);
 
   if (persist_state_enabled) {
     oai::S1apImsiMap imsi_proto = oai::S1apImsiMap();
@@ -185,6 +205,7 @@ void S1apStateManager::clear_s1ap_imsi_map() {
     return;
   }
   hashtable_uint64_ts_destroy(s1ap_imsi_map_->mme_ue_id_imsi_htbl);
+  hashtable_uint64_ts_destroy(s1ap_imsi_map_->imsi_mme_ue_id_htbl);
 
   free_wrapper((void**) &s1ap_imsi_map_);
 }
@@ -193,6 +214,10 @@ s1ap_imsi_map_t* S1apStateManager::get_s1ap_imsi_map() {
   return s1ap_imsi_map_;
 }
 
+hash_table_uint64_ts_t* S1apStateManager::get_mme_ue_id_ht() {
+  return mme_ue_id_ht_;
+}
+
 void S1apStateManager::write_s1ap_imsi_map_to_db() {
   if (!persist_state_enabled) {
     return;
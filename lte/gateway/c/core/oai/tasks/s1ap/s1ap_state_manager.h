@@ -90,6 +90,13 @@ class S1apStateManager
    */
   s1ap_imsi_map_t* get_s1ap_imsi_map();
 
+  /**
+   * Returns the mme_ue_s1ap_id -> comp_s1ap_id index of the UE state
+   * hashtable. It is derived from the UE states and rebuilt when they are
+   * read from db, so it is not persisted on its own.
+   */
+  hash_table_uint64_ts_t* get_mme_ue_id_ht();
+
  private:
   S1apStateManager();
   ~S1apStateManager() override;
@@ -106,6 +113,7 @@ class S1apStateManager
   uint32_t max_enbs_;
   std::size_t s1ap_imsi_map_hash_;
   s1ap_imsi_map_t* s1ap_imsi_map_;
+  hash_table_uint64_ts_t* mme_ue_id_ht_;
 };
 }  // namespace lte
 }  // namespace magma
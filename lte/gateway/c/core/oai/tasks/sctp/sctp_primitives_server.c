@@ -50,13 +50,20 @@
 #include "sctpd_downlink_client.h"
 #include "sctpd_uplink_server.h"
 
+// Most downlink packets queued behind each other sent with one sctpd call
+#define SCTP_MAX_DL_BATCH 64
+
 static void sctp_exit(void);
+static MessageDef* sctp_send_dl_data_reqs(
+    zsock_t* reader, MessageDef* first_message_p);
 
 sctp_config_t sctp_conf;
 task_zmq_ctx_t sctp_task_zmq_ctx;
 
-static int handle_message(zloop_t* loop, zsock_t* reader, void* arg) {
-  MessageDef* received_message_p    = receive_msg(reader);
+// Returns the next message to handle, when handling this one dequeued it
+static MessageDef* handle_received_message(
+    zsock_t* reader, MessageDef* received_message_p) {
+  MessageDef* next_message_p        = NULL;
   static bool UPLINK_SERVER_STARTED = false;
 
   switch (ITTI_MSG_ID(received_message_p)) {
@@ -96,15 +103,35 @@ static int handle_message(zloop_t* loop, zsock_t* reader, void* arg) {
     } break;
 
     case SCTP_DATA_REQ: {
-      uint32_t ppid     = SCTP_DATA_REQ(received_message_p).ppid;
-      uint32_t assoc_id = SCTP_DATA_REQ(received_message_p).assoc_id;
-      uint16_t stream   = SCTP_DATA_REQ(received_message_p).stream;
-      bstring payload   = SCTP_DATA_REQ(received_message_p).payload;
-
-      if (sctpd_send_dl(ppid, assoc_id, stream, payload) < 0) {
-        sctp_itti_send_lower_layer_conf(
-            received_message_p->ittiMsgHeader.originTaskId, ppid, assoc_id,
-            stream, SCTP_DATA_REQ(received_message_p).agw_ue_xap_id, false);
+      next_message_p = sctp_send_dl_data_reqs(reader, received_message_p);
+    } break;
+
+    case SCTP_DATA_BATCH_REQ: {
+      sctp_data_batch_req_t* batch_req =
+          &SCTP_DATA_BATCH_REQ(received_message_p);
+      if (batch_req->num_targets == 0) {
+        break;
+      }
+      bool is_success[batch_req->num_targets];
+      sctpd_dl_target_t targets[batch_req->num_targets];
+      for (int i = 0; i < batch_req->num_targets; i++) {
+        targets[i].assoc_id      = batch_req->targets[i].assoc_id;
+        targets[i].stream        = batch_req->targets[i].stream;
+        targets[i].payload_index = 0;
+      }
+
+      if (sctpd_send_dl_batch(
+              batch_req->ppid, &batch_req->payload, 1, targets,
+              batch_req->num_targets, is_success) < 0) {
+        memset(is_success, 0, sizeof(is_success));
+      }
+      for (int i = 0; i < batch_req->num_targets; i++) {
+        if (!is_success[i]) {
+          sctp_itti_send_lower_layer_conf(
+              received_message_p->ittiMsgHeader.originTaskId, batch_req->ppid,
+              batch_req->targets[i].assoc_id, batch_req->targets[i].stream, 0,
+              false);
+        }
       }
     } break;
 
@@ -126,9 +153,76 @@ static int handle_message(zloop_t* loop, zsock_t* reader, void* arg) {
 
   itti_free_msg_content(received_message_p);
   free(received_message_p);
+  return next_message_p;
+}
+
+static int handle_message(zloop_t* loop, zsock_t* reader, void* arg) {
+  MessageDef* received_message_p = receive_msg(reader);
+
+  while (received_message_p) {
+    received_message_p = handle_received_message(reader, received_message_p);
+  }
   return 0;
 }
 
+//------------------------------------------------------------------------------
+// Sends the SCTP_DATA_REQ first_message_p and the SCTP_DATA_REQs of the same
+// PPID already queued behind it with a single sctpd call. Returns the queued
+// message that ended the batch, NULL if none.
+static MessageDef* sctp_send_dl_data_reqs(
+    zsock_t* reader, MessageDef* first_message_p) {
+  MessageDef* reqs[SCTP_MAX_DL_BATCH];
+  MessageDef* next_message_p = NULL;
+  uint32_t ppid              = SCTP_DATA_REQ(first_message_p).ppid;
+  uint16_t num_reqs          = 0;
+
+  reqs[num_reqs++] = first_message_p;
+  while (num_reqs < SCTP_MAX_DL_BATCH && (zsock_events(reader) & ZMQ_POLLIN)) {
+    next_message_p = receive_msg(reader);
+    if (ITTI_MSG_ID(next_message_p) != SCTP_DATA_REQ ||
+        SCTP_DATA_REQ(next_message_p).ppid != ppid) {
+      break;
+    }
+    reqs[num_reqs++] = next_message_p;
+    next_message_p   = NULL;
+  }
+
+  bool is_success[num_reqs];
+  if (num_reqs == 1) {
+    sctp_data_req_t* req = &SCTP_DATA_REQ(first_message_p);
+    is_success[0] =
+        sctpd_send_dl(ppid, req->assoc_id, req->stream, req->payload) == 0;
+  } else {
+    bstring payloads[num_reqs];
+    sctpd_dl_target_t targets[num_reqs];
+    for (uint16_t i = 0; i < num_reqs; i++) {
+      payloads[i]              = SCTP_DATA_REQ(reqs[i]).payload;
+      targets[i].assoc_id      = SCTP_DATA_REQ(reqs[i]).assoc_id;
+      targets[i].stream        = SCTP_DATA_REQ(reqs[i]).stream;
+      targets[i].payload_index = i;
+    }
+    if (sctpd_send_dl_batch(
+            ppid, payloads, num_reqs, targets, num_reqs, is_success) < 0) {
+      memset(is_success, 0, sizeof(is_success));
+    }
+  }
+
+  for (uint16_t i = 0; i < num_reqs; i++) {
+    if (!is_success[i]) {
+      sctp_itti_send_lower_layer_conf(
+          reqs[i]->ittiMsgHeader.originTaskId, ppid,
+          SCTP_DATA_REQ(reqs[i]).assoc_id, SCTP_DATA_REQ(reqs[i]).stream,
+          SCTP_DATA_REQ(reqs[i]).agw_ue_xap_id, false);
+    }
+    // The first message is released by the caller
+    if (i > 0) {
+      itti_free_msg_content(reqs[i]);
+      free(reqs[i]);
+    }
+  }
+  return next_message_p;
+}
+
 //------------------------------------------------------------------------------
 static void* sctp_thread(__attribute__((unused)) void* args_p) {
   itti_mark_task_ready(TASK_SCTP);
@@ -42,6 +42,8 @@ using grpc::ClientContext;
 using magma::sctpd::InitReq;
 using magma::sctpd::InitRes;
 using magma::sctpd::SctpdDownlink;
+using magma::sctpd::SendDlBatchReq;
+using magma::sctpd::SendDlBatchRes;
 using magma::sctpd::SendDlReq;
 using magma::sctpd::SendDlRes;
 
@@ -52,6 +54,7 @@ class SctpdDownlinkClient {
 
   int init(InitReq& req, InitRes* res);
   int sendDl(SendDlReq& req, SendDlRes* res);
+  int sendDlBatch(SendDlBatchReq& req, SendDlBatchRes* res);
 
   bool should_force_restart = false;
 
@@ -95,12 +98,31 @@ int SctpdDownlinkClient::sendDl(SendDlReq& req, SendDlRes* res) {
   return status.ok() ? 0 : -1;
 }
 
+int SctpdDownlinkClient::sendDlBatch(
+    SendDlBatchReq& req, SendDlBatchRes* res) {
+  assert(res != nullptr);
+
+  ClientContext context;
+
+  auto status = _stub->SendDlBatch(&context, req, res);
+
+  if (!status.ok()) {
+    OAILOG_ERROR(
+        LOG_SCTP, "sctpdl.senddlbatch error = %s\n",
+        status.error_message().c_str());
+  }
+
+  return status.ok() ? 0 : -1;
+}
+
 }  // namespace lte
 }  // namespace magma
 
 using magma::lte::SctpdDownlinkClient;
 using magma::sctpd::InitReq;
 using magma::sctpd::InitRes;
+using magma::sctpd::SendDlBatchReq;
+using magma::sctpd::SendDlBatchRes;
 using magma::sctpd::SendDlReq;
 using magma::sctpd::SendDlRes;
 
@@ -202,3 +224,38 @@ int sctpd_send_dl(
 
   return rc == 0 && res.result() == SendDlRes::SEND_DL_OK ? 0 : -1;
 }
+
+// sendDlBatch
+int sctpd_send_dl_batch(
+    uint32_t ppid, const bstring* payloads, uint16_t num_payloads,
+    const sctpd_dl_target_t* targets, uint16_t num_targets, bool* is_success) {
+  SendDlBatchReq req;
+  SendDlBatchRes res;
+
+  req.set_ppid(ppid);
+  // Each payload is serialized once, targets only reference it
+  for (uint16_t i = 0; i < num_payloads; i++) {
+    req.add_payloads(bdata(payloads[i]), blength(payloads[i]));
+  }
+  for (uint16_t i = 0; i < num_targets; i++) {
+    auto* target = req.add_targets();
+    target->set_assoc_id(targets[i].assoc_id);
+    target->set_stream(targets[i].stream);
+    target->set_payload_index(targets[i].payload_index);
+  }
+
+  auto rc = client->sendDlBatch(req, &res);
+
+  if (rc != 0) {
+    OAILOG_ERROR(
+        LOG_SCTP, "batch of %u targets rc = %d\n", (uint32_t) num_targets,
+        rc);
+    return -1;
+  }
+
+  for (uint16_t i = 0; i < num_targets; i++) {
+    is_success[i] = i < res.results_size() &&
+                    res.results(i) == SendDlRes::SEND_DL_OK;
+  }
+  return 0;
+}
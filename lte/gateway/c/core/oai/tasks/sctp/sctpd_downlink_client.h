@@ -31,3 +31,17 @@ int sctpd_init(sctp_init_t* init);
 // sendDl
 int sctpd_send_dl(
     uint32_t ppid, uint32_t assoc_id, uint16_t stream, bstring payload);
+
+// Destination of a batched downlink packet, payload_index refers to the
+// payloads of the batch
+typedef struct sctpd_dl_target_s {
+  uint32_t assoc_id;
+  uint16_t stream;
+  uint16_t payload_index;
+} sctpd_dl_target_t;
+
+// sendDlBatch, each payload is carried once, is_success must hold num_targets
+// entries
+int sctpd_send_dl_batch(
+    uint32_t ppid, const bstring* payloads, uint16_t num_payloads,
+    const sctpd_dl_target_t* targets, uint16_t num_targets, bool* is_success);
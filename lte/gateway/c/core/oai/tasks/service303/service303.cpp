@@ -17,21 +17,60 @@
 #include <stdio.h>
 #include <assert.h>
 #include <stdarg.h>
+#include <stdlib.h>
+
+#include <map>
+#include <mutex>
+#include <string>
 
 #include "service303.h"
+#include "includes/GRPCRuntime.h"
 #include "includes/MagmaService.h"
 #include "includes/MetricsSingleton.h"
 #include "bstrlib.h"
 #include "orc8r/protos/service303.pb.h"
 
+using magma::GRPCRuntime;
 using magma::service303::MagmaService;
 using magma::service303::MetricsSingleton;
+using magma::service303::ServiceInfoMeta;
+
+#define GRPC_CLIENT_LATENCY_METRIC "grpc_client_latency_ms"
 
 static MagmaService* magma_service;
+// Meta key -> dump reported in the service info
+static std::mutex service_info_dumps_mutex;
+static std::map<std::string, char* (*)(void)> service_info_dumps;
+
+static void observe_grpc_latency(const std::string& rpc, double latency_ms) {
+  observe_histogram(
+      GRPC_CLIENT_LATENCY_METRIC, latency_ms, 1, "rpc", rpc.c_str(),
+      (size_t) 8, 1., 5., 10., 50., 100., 500., 1000., 5000.);
+}
+
+static ServiceInfoMeta get_service_info_meta() {
+  std::lock_guard<std::mutex> lock(service_info_dumps_mutex);
+  ServiceInfoMeta meta;
+  for (const auto& it : service_info_dumps) {
+    char* value = it.second();
+    if (value != NULL) {
+      meta[it.first] = value;
+      free(value);
+    }
+  }
+  return meta;
+}
 
 void start_service303_server(bstring name, bstring version) {
   magma_service = new MagmaService(bdata(name), bdata(version));
+  magma_service->SetServiceInfoCallback(get_service_info_meta);
   magma_service->Start();
+  // Export the latency of the RPCs of the gRPC clients of the MME
+  GRPCRuntime::get_instance().set_latency_observer(observe_grpc_latency);
+}
+
+void service303_set_grpc_threads(uint32_t num_threads) {
+  GRPCRuntime::get_instance().set_num_threads(num_threads);
 }
 
 void stop_service303_server(void) {
@@ -108,3 +147,8 @@ void service303_set_application_health(application_health_t health) {
   }
   magma_service->setApplicationHealth(appHealthEnum);
 }
+
+void service303_set_service_info_dump(const char* key, char* (*dump)(void)) {
+  std::lock_guard<std::mutex> lock(service_info_dumps_mutex);
+  service_info_dumps[key] = dump;
+}
@@ -27,6 +27,7 @@
 #include "intertask_interface_types.h"
 #include "itti_types.h"
 #include "itti_free_defined_msg.h"
+#include "itti_trace.h"
 
 static void service303_server_exit(void);
 static void service303_message_exit(void);
@@ -63,6 +64,9 @@ static void* service303_server_thread(__attribute__((unused)) void* args) {
   service303_data_t* service303_data = (service303_data_t*) args;
 
   start_service303_server(service303_data->name, service303_data->version);
+  if (itti_trace_enabled) {
+    service303_set_service_info_dump("itti_trace", itti_trace_dump_to_string);
+  }
 
   itti_mark_task_ready(TASK_SERVICE303_SERVER);
   init_task_context(
@@ -67,16 +67,14 @@ void pgw_config_init(pgw_config_t* config_pP) {
 //------------------------------------------------------------------------------
 status_code_e pgw_config_process(pgw_config_t* config_pP) {
 #if (!EMBEDDED_SGW)
-  async_system_command(
-      TASK_ASYNC_SYSTEM, PGW_ABORT_ON_ERROR, "iptables -t mangle -F OUTPUT");
-  async_system_command(
-      TASK_ASYNC_SYSTEM, PGW_ABORT_ON_ERROR,
-      "iptables -t mangle -F POSTROUTING");
-
+  // The PCEF emulation marking rules are programmed on top of empty chains
+  bstring flush = bfromcstr("*mangle\n-F OUTPUT\n-F POSTROUTING\nCOMMIT\n");
   if (config_pP->masquerade_SGI) {
-    async_system_command(
-        TASK_ASYNC_SYSTEM, PGW_ABORT_ON_ERROR, "iptables -t nat -F PREROUTING");
+    bcatcstr(flush, "*nat\n-F PREROUTING\nCOMMIT\n");
   }
+  async_system_command_with_input(
+      TASK_ASYNC_SYSTEM, PGW_ABORT_ON_ERROR, flush,
+      "iptables-restore --noflush");
 #endif
 
   // Get ipv4 address
@@ -167,11 +165,13 @@ status_code_e pgw_config_process(pgw_config_t* config_pP) {
     }
 
 #if (!EMBEDDED_SGW)
+    // NAT and MSS clamping rules are applied in a single transaction
+    bstring rules = bfromcstr("");
     if (config_pP->masquerade_SGI) {
-      async_system_command(
-          TASK_ASYNC_SYSTEM, PGW_ABORT_ON_ERROR,
-          "iptables -t nat -I POSTROUTING -s %s/%d -o %s  ! --protocol sctp -j "
-          "SNAT --to-source %s",
+      bformata(
+          rules,
+          "*nat\n-I POSTROUTING -s %s/%d -o %s ! --protocol sctp -j SNAT "
+          "--to-source %s\nCOMMIT\n",
           inet_ntoa(netaddr), netmask, bdata(config_pP->ipv4.if_name_SGI),
           str_sgi);
     }
@@ -182,19 +182,25 @@ status_code_e pgw_config_process(pgw_config_t* config_pP) {
       min_mtu = config_pP->ipv4.mtu_S5_S8 - 36;
     }
     if (config_pP->ue_tcp_mss_clamp) {
-      async_system_command(
-          TASK_ASYNC_SYSTEM, PGW_ABORT_ON_ERROR,
-          "iptables -t mangle -I FORWARD -s %s/%d   -p tcp --tcp-flags SYN,RST "
-          "SYN -j TCPMSS --set-mss %u",
+      bformata(
+          rules,
+          "*mangle\n"
+          "-I FORWARD -s %s/%d -p tcp --tcp-flags SYN,RST SYN -j TCPMSS "
+          "--set-mss %u\n",
           inet_ntoa(netaddr), netmask, min_mtu - 40);
-
-      async_system_command(
-          TASK_ASYNC_SYSTEM, PGW_ABORT_ON_ERROR,
-          "iptables -t mangle -I FORWARD -d %s/%d -p tcp --tcp-flags SYN,RST "
-          "SYN "
-          "-j TCPMSS --set-mss %u",
+      bformata(
+          rules,
+          "-I FORWARD -d %s/%d -p tcp --tcp-flags SYN,RST SYN -j TCPMSS "
+          "--set-mss %u\nCOMMIT\n",
           inet_ntoa(netaddr), netmask, min_mtu - 40);
     }
+    if (blength(rules)) {
+      async_system_command_with_input(
+          TASK_ASYNC_SYSTEM, PGW_ABORT_ON_ERROR, rules,
+          "iptables-restore --noflush");
+    } else {
+      bdestroy_wrapper(&rules);
+    }
 #endif
   } else {
     OAILOG_DEBUG(LOG_SPGW_APP, "Nat is OFF");
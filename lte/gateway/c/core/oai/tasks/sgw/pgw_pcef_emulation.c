@@ -46,6 +46,64 @@
 #include "pgw_types.h"
 #include "spgw_config.h"
 
+/*
+ * SDF filters are marked by iptables rules of the mangle table. Activating a
+ * PCC rule only updates the activated rules, the kernel is updated by
+ * pgw_pcef_emulation_commit() with a single iptables-restore transaction
+ * inserting the activated rules that are not programmed yet. Rules are kept
+ * as iptables-restore rule specifications without the -I command.
+ *
+ * A transaction is all or nothing, so when one fails its rules are retried in
+ * transactions of one rule each. A rule failing on its own is rejected and
+ * not retried, the other rules are programmed.
+ */
+static struct {
+  struct bstrList* activated;
+  struct bstrList* programmed;
+  struct bstrList* rejected;
+  // Rules inserted by the transaction in flight, NULL if none
+  struct bstrList* in_flight;
+  // Set after a failed transaction until its rules were retried one by one
+  bool one_by_one;
+} pcef_rules = {NULL, NULL, NULL, NULL, false};
+
+static void pgw_pcef_emulation_sdf_filter_rules(
+    sdf_filter_t* sdf_f, sdf_id_t sdf_id, const pgw_config_t* pgw_config_p,
+    struct bstrList* rules);
+
+//------------------------------------------------------------------------------
+static void pcef_rules_init(void) {
+  if (!pcef_rules.activated) {
+    pcef_rules.activated  = bstrListCreate();
+    pcef_rules.programmed = bstrListCreate();
+    pcef_rules.rejected   = bstrListCreate();
+  }
+}
+
+//------------------------------------------------------------------------------
+static int pcef_rule_list_find(struct bstrList* list, const_bstring rule) {
+  for (int i = 0; i < list->qty; i++) {
+    if (biseq(list->entry[i], rule) == 1) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+//------------------------------------------------------------------------------
+// Takes the ownership of rule, rules already in the list are not duplicated
+static void pcef_rule_list_append(struct bstrList* list, bstring rule) {
+  if (pcef_rule_list_find(list, rule) >= 0) {
+    bdestroy_wrapper(&rule);
+    return;
+  }
+  if (BSTR_OK != bstrListAllocMin(list, list->qty + 1)) {
+    bdestroy_wrapper(&rule);
+    return;
+  }
+  list->entry[list->qty++] = rule;
+}
+
 /*
  * Function that adds predefined PCC rules to PGW struct,
  * it returns an error or success code after adding rules.
@@ -354,6 +412,10 @@ status_code_e pgw_pcef_emulation_init(
         pgw_config_p->pcef.automatic_push_dedicated_bearer_sdf_identifier,
         pgw_config_p);
   }
+  // Program the marking rules of all the preloaded PCC rules at once
+  if (RETURNok != pgw_pcef_emulation_commit()) {
+    rc = RETURNerror;
+  }
   return rc;
 }
 
@@ -384,53 +446,132 @@ void pgw_pcef_emulation_apply_rule(
 void pgw_pcef_emulation_apply_sdf_filter(
     sdf_filter_t* const sdf_f, const sdf_id_t sdf_id,
     const pgw_config_t* const pgw_config_p) {
-  if ((TRAFFIC_FLOW_TEMPLATE_BIDIRECTIONAL == sdf_f->direction) ||
-      (TRAFFIC_FLOW_TEMPLATE_DOWNLINK_ONLY == sdf_f->direction)) {
-    bstring filter = pgw_pcef_emulation_packet_filter_2_iptable_string(
-        &sdf_f->packetfiltercontents, sdf_f->direction);
+  pcef_rules_init();
+  pgw_pcef_emulation_sdf_filter_rules(
+      sdf_f, sdf_id, pgw_config_p, pcef_rules.activated);
+}
 
-    bstring marking_command = NULL;
-    if ((TRAFFIC_FLOW_TEMPLATE_IPV4_REMOTE_ADDR_FLAG |
-         TRAFFIC_FLOW_TEMPLATE_IPV6_REMOTE_ADDR_FLAG) &
-        sdf_f->packetfiltercontents.flags) {
-      marking_command = bformat(
-          "iptables -I POSTROUTING -t mangle  %s -j MARK --set-mark %d",
-          bdata(filter), sdf_id);
-    } else {
-      // marking_command = bformat("iptables -I PREROUTING -t mangle
-      // --in-interface %s --dest %"PRIu8".%"PRIu8".%"PRIu8".%"PRIu8"/%"PRIu8"
-      // %s -j MARK --set-mark %d",
-      marking_command = bformat(
-          "iptables -I POSTROUTING -t mangle  --dest %" PRIu8 ".%" PRIu8
-          ".%" PRIu8 ".%" PRIu8 "/%" PRIu8 " %s -j MARK --set-mark %d",
-          NIPADDR(pgw_config_p->ue_pool_addr[0].s_addr),
-          pgw_config_p->ue_pool_mask[0], bdata(filter), sdf_id);
+//------------------------------------------------------------------------------
+bstring pgw_pcef_emulation_prepare_commit(void) {
+  pcef_rules_init();
+  if (pcef_rules.in_flight) {
+    return NULL;
+  }
+  struct bstrList* changes = bstrListCreate();
+
+  // Rules are inserted in the order in which they were activated
+  for (int i = 0; i < pcef_rules.activated->qty; i++) {
+    bstring rule = pcef_rules.activated->entry[i];
+    if ((pcef_rule_list_find(pcef_rules.programmed, rule) < 0) &&
+        (pcef_rule_list_find(pcef_rules.rejected, rule) < 0)) {
+      pcef_rule_list_append(changes, bstrcpy(rule));
+      if (pcef_rules.one_by_one) {
+        break;
+      }
     }
-    bdestroy_wrapper(&filter);
-    async_system_command(TASK_ASYNC_SYSTEM, false, bdata(marking_command));
-    bdestroy_wrapper(&marking_command);
+  }
+  if (!changes->qty) {
+    bstrListDestroy(changes);
+    pcef_rules.one_by_one = false;
+    return NULL;
+  }
+  bstring transaction = bfromcstr("*mangle\n");
+  for (int i = 0; i < changes->qty; i++) {
+    bformata(transaction, "-I %s\n", bdata(changes->entry[i]));
+  }
+  bcatcstr(transaction, "COMMIT\n");
+  OAILOG_DEBUG(
+      LOG_SPGW_APP, "Programming %d PCEF marking rule changes\n",
+      changes->qty);
+  pcef_rules.in_flight = changes;
+  return transaction;
+}
 
-    // for UE <-> PGW traffic
-    filter = pgw_pcef_emulation_packet_filter_2_iptable_string(
-        &sdf_f->packetfiltercontents, sdf_f->direction);
+//------------------------------------------------------------------------------
+status_code_e pgw_pcef_emulation_commit_result(int exit_status) {
+  if (!pcef_rules.in_flight) {
+    return RETURNerror;
+  }
+  // An iptables-restore transaction is applied atomically, none of its rules
+  // were inserted if it failed
+  if (!exit_status) {
+    for (int i = 0; i < pcef_rules.in_flight->qty; i++) {
+      pcef_rule_list_append(
+          pcef_rules.programmed, bstrcpy(pcef_rules.in_flight->entry[i]));
+    }
+  } else if (pcef_rules.in_flight->qty > 1) {
+    OAILOG_ERROR(
+        LOG_SPGW_APP,
+        "Programming %d PCEF marking rules failed: %d, retrying one by one\n",
+        pcef_rules.in_flight->qty, exit_status);
+    pcef_rules.one_by_one = true;
+  } else {
+    OAILOG_ERROR(
+        LOG_SPGW_APP, "Programming PCEF marking rule %s failed: %d\n",
+        bdata(pcef_rules.in_flight->entry[0]), exit_status);
+    pcef_rule_list_append(
+        pcef_rules.rejected, bstrcpy(pcef_rules.in_flight->entry[0]));
+  }
+  bstrListDestroy(pcef_rules.in_flight);
+  pcef_rules.in_flight = NULL;
+  return exit_status ? RETURNerror : RETURNok;
+}
+
+//------------------------------------------------------------------------------
+status_code_e pgw_pcef_emulation_commit(void) {
+  bstring transaction = pgw_pcef_emulation_prepare_commit();
+  if (!transaction) {
+    return RETURNok;
+  }
+  return async_system_command_with_result(
+      TASK_SPGW_APP, transaction, "iptables-restore --noflush");
+}
+
+//------------------------------------------------------------------------------
+void pgw_pcef_emulation_exit(void) {
+  bstrListDestroy(pcef_rules.activated);
+  bstrListDestroy(pcef_rules.programmed);
+  bstrListDestroy(pcef_rules.rejected);
+  bstrListDestroy(pcef_rules.in_flight);
+  pcef_rules.activated  = NULL;
+  pcef_rules.programmed = NULL;
+  pcef_rules.rejected   = NULL;
+  pcef_rules.in_flight  = NULL;
+  pcef_rules.one_by_one = false;
+}
 
-    marking_command = NULL;
+//------------------------------------------------------------------------------
+static void pgw_pcef_emulation_sdf_filter_rules(
+    sdf_filter_t* const sdf_f, const sdf_id_t sdf_id,
+    const pgw_config_t* const pgw_config_p, struct bstrList* rules) {
+  if ((TRAFFIC_FLOW_TEMPLATE_BIDIRECTIONAL == sdf_f->direction) ||
+      (TRAFFIC_FLOW_TEMPLATE_DOWNLINK_ONLY == sdf_f->direction)) {
+    bstring filter = pgw_pcef_emulation_packet_filter_2_iptable_string(
+        &sdf_f->packetfiltercontents, sdf_f->direction);
+    bstring destination = NULL;
     if ((TRAFFIC_FLOW_TEMPLATE_IPV4_REMOTE_ADDR_FLAG |
          TRAFFIC_FLOW_TEMPLATE_IPV6_REMOTE_ADDR_FLAG) &
         sdf_f->packetfiltercontents.flags) {
-      marking_command = bformat(
-          "iptables -I OUTPUT -t mangle  %s -j MARK --set-mark %d",
-          bdata(filter), sdf_id);
+      destination = bfromcstr("");
     } else {
-      marking_command = bformat(
-          "iptables -I OUTPUT -t mangle  --dest %" PRIu8 ".%" PRIu8 ".%" PRIu8
-          ".%" PRIu8 "/%" PRIu8 " %s -j MARK --set-mark %d",
+      destination = bformat(
+          " --dest %" PRIu8 ".%" PRIu8 ".%" PRIu8 ".%" PRIu8 "/%" PRIu8,
           NIPADDR(pgw_config_p->ue_pool_addr[0].s_addr),
-          pgw_config_p->ue_pool_mask[0], bdata(filter), sdf_id);
+          pgw_config_p->ue_pool_mask[0]);
     }
+    // POSTROUTING for the traffic to the UEs, OUTPUT for UE <-> PGW traffic
+    pcef_rule_list_append(
+        rules,
+        bformat(
+            "POSTROUTING%s %s -j MARK --set-mark %d", bdata(destination),
+            bdata(filter), sdf_id));
+    pcef_rule_list_append(
+        rules,
+        bformat(
+            "OUTPUT%s %s -j MARK --set-mark %d", bdata(destination),
+            bdata(filter), sdf_id));
+    bdestroy_wrapper(&destination);
     bdestroy_wrapper(&filter);
-    async_system_command(TASK_ASYNC_SYSTEM, false, bdata(marking_command));
-    bdestroy_wrapper(&marking_command);
   }
 }
 
@@ -37,10 +37,28 @@
 
 status_code_e pgw_pcef_emulation_init(
     spgw_state_t* state_p, const pgw_config_t* pgw_config_p);
+/*
+ * Activating PCC rules only stages their marking rules, they are programmed by
+ * pgw_pcef_emulation_commit() in a single iptables-restore transaction holding
+ * what changed since the last successful commit. The exit status of the
+ * transaction, received in an ASYNC_SYSTEM_COMMAND_RESULT message, is passed to
+ * pgw_pcef_emulation_commit_result(). Rules staged while a transaction is in
+ * flight, and the rules of a failed transaction, are programmed by the next
+ * commit. After a failure they are retried one rule per transaction so that
+ * a rule iptables rejects does not hold back the others.
+ */
 void pgw_pcef_emulation_apply_rule(
     spgw_state_t* state_p, sdf_id_t sdf_id, const pgw_config_t* pgw_config_p);
 void pgw_pcef_emulation_apply_sdf_filter(
     sdf_filter_t* sdf_f, sdf_id_t sdf_id, const pgw_config_t* pgw_config_p);
+status_code_e pgw_pcef_emulation_commit(void);
+// Returns the transaction to program, NULL if none is needed or one is in
+// flight. Used by pgw_pcef_emulation_commit().
+bstring pgw_pcef_emulation_prepare_commit(void);
+// Returns RETURNok if the transaction in flight was programmed. Call
+// pgw_pcef_emulation_commit() afterwards to program what is left.
+status_code_e pgw_pcef_emulation_commit_result(int exit_status);
+void pgw_pcef_emulation_exit(void);
 bstring pgw_pcef_emulation_packet_filter_2_iptable_string(
     packet_filter_contents_t* packetfiltercontents, uint8_t direction);
 status_code_e pgw_pcef_get_sdf_parameters(
@@ -376,6 +376,24 @@ status_code_e sgw_config_parse_file(sgw_config_t* config_pP)
     } else {
       Fatal("Couldn't find all ovs settings in spgw config\n");
     }
+
+    // Optional, tunnel updates are not batched by default
+    libconfig_int pipelined_batch_size  = 1;
+    libconfig_int pipelined_batch_delay = 0;
+    config_setting_lookup_int(
+        ovs_settings, SGW_CONFIG_STRING_OVS_PIPELINED_BATCH_SIZE,
+        &pipelined_batch_size);
+    config_setting_lookup_int(
+        ovs_settings, SGW_CONFIG_STRING_OVS_PIPELINED_BATCH_DELAY,
+        &pipelined_batch_delay);
+    config_pP->ovs_config.pipelined_batch_size =
+        pipelined_batch_size > 1 ? pipelined_batch_size : 1;
+    config_pP->ovs_config.pipelined_batch_delay_usec =
+        pipelined_batch_delay > 0 ? pipelined_batch_delay : 0;
+    OAILOG_INFO(
+        LOG_SPGW_APP, "Pipelined batch size: %u, delay: %u us\n",
+        config_pP->ovs_config.pipelined_batch_size,
+        config_pP->ovs_config.pipelined_batch_delay_usec);
 #endif
   }
   config_destroy(&cfg);
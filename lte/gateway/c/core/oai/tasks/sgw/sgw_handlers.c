@@ -491,11 +491,13 @@ void sgw_populate_mbr_bearer_contexts_removed(
 
 //------------------------------------------------------------------------------
 /* Helper function to add gtp tunnels for default and
- * dedicated bearers
+ * dedicated bearers. The tunnels of a bearer restored from the persisted
+ * state are added again as they were, without notifying sessiond.
  */
 static void sgw_add_gtp_tunnel(
     imsi64_t imsi64, sgw_eps_bearer_ctxt_t* eps_bearer_ctxt_p,
-    s_plus_p_gw_eps_bearer_context_information_t* new_bearer_ctxt_info_p) {
+    s_plus_p_gw_eps_bearer_context_information_t* new_bearer_ctxt_info_p,
+    bool restored) {
   int rv             = RETURNok;
   struct in_addr enb = {.s_addr = 0};
   enb.s_addr =
@@ -522,7 +524,8 @@ static void sgw_add_gtp_tunnel(
    * If Modify bearer Request is received in UE suspended mode, Resume PS
    * data
    */
-  if (new_bearer_ctxt_info_p->sgw_eps_bearer_context_information.pdn_connection
+  if (!restored &&
+      new_bearer_ctxt_info_p->sgw_eps_bearer_context_information.pdn_connection
           .ue_suspended_for_ps_handover) {
     rv = gtp_tunnel_ops->forward_data_on_tunnel(
         ue_ipv4, ue_ipv6, eps_bearer_ctxt_p->s_gw_teid_S1u_S12_S4_up, NULL,
@@ -556,7 +559,7 @@ static void sgw_add_gtp_tunnel(
       if (rv < 0) {
         OAILOG_ERROR_UE(
             LOG_SPGW_APP, imsi64, "ERROR in setting up TUNNEL err=%d\n", rv);
-      } else {
+      } else if (!restored) {
         pcef_update_teids(
             (char*) imsi.digit, eps_bearer_ctxt_p->eps_bearer_id,
             eps_bearer_ctxt_p->enb_teid_S1u,
@@ -634,7 +637,8 @@ static void sgw_populate_mbr_bearer_contexts_modified(
       //#pragma message  "TODO define constant for default eps_bearer id"
 
       // setup GTPv1-U tunnel
-      sgw_add_gtp_tunnel(imsi64, eps_bearer_ctxt_p, new_bearer_ctxt_info_p);
+      sgw_add_gtp_tunnel(
+          imsi64, eps_bearer_ctxt_p, new_bearer_ctxt_info_p, false);
       // may be removed
       if (TRAFFIC_FLOW_TEMPLATE_NB_PACKET_FILTERS_MAX >
           eps_bearer_ctxt_p->num_sdf) {
@@ -652,6 +656,128 @@ static void sgw_populate_mbr_bearer_contexts_modified(
   }
   OAILOG_FUNC_OUT(LOG_SPGW_APP);
 }
+
+//------------------------------------------------------------------------------
+static bool sgw_replay_context_gtp_tunnels(
+    __attribute__((unused)) const hash_key_t keyP, void* const elementP,
+    void* parameterP, __attribute__((unused)) void** resultP) {
+  s_plus_p_gw_eps_bearer_context_information_t* bearer_ctxt_info_p =
+      (s_plus_p_gw_eps_bearer_context_information_t*) elementP;
+  sgw_eps_bearer_context_information_t* sgw_context_p =
+      &bearer_ctxt_info_p->sgw_eps_bearer_context_information;
+  uint32_t* num_bearers = (uint32_t*) parameterP;
+
+  for (int ebix = 0; ebix < BEARERS_PER_UE; ebix++) {
+    sgw_eps_bearer_ctxt_t* eps_bearer_ctxt_p =
+        sgw_context_p->pdn_connection.sgw_eps_bearers_array[ebix];
+    // Bearers of idle UEs have no tunnel
+    if (eps_bearer_ctxt_p == NULL || eps_bearer_ctxt_p->enb_teid_S1u == 0 ||
+        eps_bearer_ctxt_p->s_gw_teid_S1u_S12_S4_up == 0) {
+      continue;
+    }
+    sgw_add_gtp_tunnel(
+        sgw_context_p->imsi64, eps_bearer_ctxt_p, bearer_ctxt_info_p, true);
+    (*num_bearers)++;
+  }
+  return false;
+}
+
+//------------------------------------------------------------------------------
+void sgw_reconcile_gtp_tunnels(void) {
+  OAILOG_FUNC_IN(LOG_SPGW_APP);
+  uint32_t num_bearers = 0;
+
+  if (gtp_tunnel_ops->reconcile_tunnels == NULL) {
+    OAILOG_FUNC_OUT(LOG_SPGW_APP);
+  }
+  hashtable_ts_apply_callback_on_elements(
+      get_spgw_teid_state(), sgw_replay_context_gtp_tunnels, &num_bearers,
+      NULL);
+  OAILOG_INFO(
+      LOG_SPGW_APP, "Replayed the GTP tunnels of %u restored bearers\n",
+      num_bearers);
+  if (gtp_tunnel_ops->reconcile_tunnels() < 0) {
+    OAILOG_ERROR(LOG_SPGW_APP, "Failed to reconcile the GTP tunnels\n");
+  }
+  OAILOG_FUNC_OUT(LOG_SPGW_APP);
+}
+
+//------------------------------------------------------------------------------
+void sgw_notify_gtp_tunnel_failure(
+    bool is_add, uint32_t i_tei, uint32_t o_tei, int error) {
+  // Called from the thread of the GTP device, the failure is handled by the
+  // SPGW task
+  MessageDef* message_p =
+      itti_alloc_new_message(TASK_SPGW_APP, GTPV1U_TUNNEL_FAILURE_IND);
+  if (message_p == NULL) {
+    OAILOG_ERROR(
+        LOG_SPGW_APP,
+        "Failed to allocate GTPV1U_TUNNEL_FAILURE_IND for tunnel " TEID_FMT
+        "\n",
+        i_tei);
+    return;
+  }
+  Gtpv1uTunnelFailureInd* failure = &message_p->ittiMsg.gtpv1uTunnelFailureInd;
+  failure->is_add                 = is_add;
+  failure->sgw_S1u_teid           = i_tei;
+  failure->enb_S1u_teid           = o_tei;
+  failure->error                  = error;
+  send_msg_to_task(&spgw_app_task_zmq_ctx, TASK_SPGW_APP, message_p);
+}
+
+//------------------------------------------------------------------------------
+static bool sgw_find_bearer_by_s1u_teid(
+    __attribute__((unused)) const hash_key_t keyP, void* const elementP,
+    void* parameterP, void** resultP) {
+  s_plus_p_gw_eps_bearer_context_information_t* bearer_ctxt_info_p =
+      (s_plus_p_gw_eps_bearer_context_information_t*) elementP;
+  sgw_eps_bearer_context_information_t* sgw_context_p =
+      &bearer_ctxt_info_p->sgw_eps_bearer_context_information;
+  teid_t teid = *(teid_t*) parameterP;
+
+  for (int ebix = 0; ebix < BEARERS_PER_UE; ebix++) {
+    sgw_eps_bearer_ctxt_t* eps_bearer_ctxt_p =
+        sgw_context_p->pdn_connection.sgw_eps_bearers_array[ebix];
+    if (eps_bearer_ctxt_p != NULL &&
+        eps_bearer_ctxt_p->s_gw_teid_S1u_S12_S4_up == teid) {
+      *resultP = sgw_context_p;
+      return true;
+    }
+  }
+  return false;
+}
+
+//------------------------------------------------------------------------------
+void sgw_handle_gtp_tunnel_failure(const Gtpv1uTunnelFailureInd* failure) {
+  OAILOG_FUNC_IN(LOG_SPGW_APP);
+  sgw_eps_bearer_context_information_t* sgw_context_p = NULL;
+  teid_t teid                                         = failure->sgw_S1u_teid;
+
+  increment_counter(
+      "spgw_gtp_tunnel_failure", 1, 1, "op", failure->is_add ? "add" : "del");
+  hashtable_ts_apply_callback_on_elements(
+      get_spgw_teid_state(), sgw_find_bearer_by_s1u_teid, &teid,
+      (void**) &sgw_context_p);
+  if (sgw_context_p == NULL) {
+    // Deleted tunnels usually belong to bearers already released
+    OAILOG_WARNING(
+        LOG_SPGW_APP,
+        "Failed to %s GTP tunnel " TEID_FMT " <-> " TEID_FMT
+        " of no bearer: %s\n",
+        failure->is_add ? "add" : "delete", failure->sgw_S1u_teid,
+        failure->enb_S1u_teid, strerror(failure->error));
+    OAILOG_FUNC_OUT(LOG_SPGW_APP);
+  }
+  OAILOG_ERROR_UE(
+      LOG_SPGW_APP, sgw_context_p->imsi64,
+      "Failed to %s GTP tunnel " TEID_FMT " <-> " TEID_FMT
+      ", the user plane of the bearer is %s: %s\n",
+      failure->is_add ? "add" : "delete", failure->sgw_S1u_teid,
+      failure->enb_S1u_teid, failure->is_add ? "down" : "stale",
+      strerror(failure->error));
+  OAILOG_FUNC_OUT(LOG_SPGW_APP);
+}
+
 //------------------------------------------------------------------------------
 void sgw_handle_sgi_endpoint_updated(
     const itti_sgi_update_end_point_response_t* const resp_pP,
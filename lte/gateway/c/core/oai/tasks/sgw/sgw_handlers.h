@@ -69,6 +69,16 @@ status_code_e sgw_handle_ip_allocation_rsp(
     const itti_ip_allocation_response_t* ip_allocation_rsp, imsi64_t imsi64);
 bool is_enb_ip_address_same(const fteid_t* fte_p, ip_address_t* ip_p);
 uint32_t spgw_get_new_s1u_teid(spgw_state_t* state);
+/*
+ * Add again the GTP tunnels of the bearers restored from the persisted state
+ * and let the GTP device check that it has them all.
+ * Does nothing if the device cannot reconcile its tunnels.
+ */
+void sgw_reconcile_gtp_tunnels(void);
+// Called by the GTP device when a tunnel op failed asynchronously
+void sgw_notify_gtp_tunnel_failure(
+    bool is_add, uint32_t i_tei, uint32_t o_tei, int error);
+void sgw_handle_gtp_tunnel_failure(const Gtpv1uTunnelFailureInd* failure);
 status_code_e send_mbr_failure(
     log_proto_t module,
     const itti_s11_modify_bearer_request_t* const modify_bearer_pP,
@@ -34,6 +34,7 @@
 #include "log.h"
 #include "common_defs.h"
 #include "gtpv1_u_messages_types.h"
+#include "gtpv1u.h"
 #include "gtpv1u_sgw_defs.h"
 #include "intertask_interface.h"
 #include "intertask_interface_types.h"
@@ -51,6 +52,7 @@ static void spgw_app_exit(void);
 
 spgw_config_t spgw_config;
 task_zmq_ctx_t spgw_app_task_zmq_ctx;
+extern struct gtp_tunnel_ops* gtp_tunnel_ops;
 extern __pid_t g_pid;
 
 static int handle_message(zloop_t* loop, zsock_t* reader, void* arg) {
@@ -189,6 +191,21 @@ static int handle_message(zloop_t* loop, zsock_t* reader, void* arg) {
       }
     } break;
 
+    case ASYNC_SYSTEM_COMMAND_RESULT: {
+      pgw_pcef_emulation_commit_result(
+          ASYNC_SYSTEM_COMMAND_RESULT(received_message_p).exit_status);
+      // Program the rules activated while the transaction was in flight, or
+      // retry the rules of a failed transaction one by one
+      pgw_pcef_emulation_commit();
+      is_state_same = true;  // task state is not changed
+    } break;
+
+    case GTPV1U_TUNNEL_FAILURE_IND: {
+      sgw_handle_gtp_tunnel_failure(
+          &received_message_p->ittiMsg.gtpv1uTunnelFailureInd);
+      is_state_same = true;  // task state is not changed
+    } break;
+
     case TERMINATE_MESSAGE: {
       itti_free_msg_content(received_message_p);
       free(received_message_p);
@@ -216,8 +233,8 @@ static int handle_message(zloop_t* loop, zsock_t* reader, void* arg) {
 static void* spgw_app_thread(__attribute__((unused)) void* args) {
   itti_mark_task_ready(TASK_SPGW_APP);
   init_task_context(
-      TASK_SPGW_APP, (task_id_t[]){TASK_MME_APP}, 1, handle_message,
-      &spgw_app_task_zmq_ctx);
+      TASK_SPGW_APP, (task_id_t[]){TASK_MME_APP, TASK_SPGW_APP}, 2,
+      handle_message, &spgw_app_task_zmq_ctx);
 
   zloop_start(spgw_app_task_zmq_ctx.event_loop);
   spgw_app_exit();
@@ -243,6 +260,13 @@ status_code_e spgw_app_init(spgw_config_t* spgw_config_pP, bool persist_state) {
     return RETURNerror;
   }
 
+  if (gtp_tunnel_ops->set_failure_cb) {
+    gtp_tunnel_ops->set_failure_cb(sgw_notify_gtp_tunnel_failure);
+  }
+  if (persist_state) {
+    sgw_reconcile_gtp_tunnels();
+  }
+
   if (RETURNerror ==
       pgw_pcef_emulation_init(spgw_state_p, &spgw_config_pP->pgw_config)) {
     return RETURNerror;
@@ -262,6 +286,7 @@ status_code_e spgw_app_init(spgw_config_t* spgw_config_pP, bool persist_state) {
 static void spgw_app_exit(void) {
   OAILOG_DEBUG(LOG_SPGW_APP, "Cleaning SGW\n");
   put_spgw_state();
+  pgw_pcef_emulation_exit();
   gtpv1u_exit();
   spgw_state_exit();
   destroy_task_context(&spgw_app_task_zmq_ctx);
@@ -20,6 +20,7 @@
 extern "C" {
 #include <dynamic_memory_check.h>
 #include "common_defs.h"
+#include "mme_config.h"
 }
 
 namespace magma {
@@ -43,6 +44,9 @@ void SpgwStateManager::init(bool persist_state, const spgw_config_t* config) {
   persist_state_enabled = persist_state;
   config_               = config;
   redis_client          = std::make_unique<RedisClient>(persist_state);
+  open_ue_state_region(
+      bdata(mme_config.ue_state_region_dir),
+      mme_config.ue_state_region_max_ues);
   create_state();
   if (read_state_from_db() != RETURNok) {
     OAILOG_ERROR(LOG_SPGW_APP, "Failed to read state from redis");
@@ -112,17 +116,22 @@ status_code_e SpgwStateManager::read_ue_state_from_db() {
   if (!persist_state_enabled) {
     return RETURNok;
   }
-  auto keys = redis_client->get_keys("IMSI*" + task_name + "*");
-  for (const auto& key : keys) {
-    oai::SpgwUeContext ue_proto = oai::SpgwUeContext();
-    if (redis_client->read_proto(key, ue_proto) != RETURNok) {
-      return RETURNerror;
-    }
-    OAILOG_DEBUG(log_task, "Reading UE state from db for key %s", key.c_str());
+  auto start = std::chrono::steady_clock::now();
+  std::vector<std::string> keys;
+  std::vector<oai::SpgwUeContext> ue_protos;
+  if (read_ue_protos_from_db(keys, ue_protos) != RETURNok) {
+    return RETURNerror;
+  }
+  // proto_to_ue inserts into the shared teid and imsi tables itself, keep
+  // the conversion on this thread
+  for (size_t i = 0; i < keys.size(); i++) {
+    OAILOG_DEBUG(
+        log_task, "Reading UE state from db for key %s", keys[i].c_str());
     spgw_ue_context_t* ue_context_p =
         (spgw_ue_context_t*) calloc(1, sizeof(spgw_ue_context_t));
-    SpgwStateConverter::proto_to_ue(ue_proto, ue_context_p);
+    SpgwStateConverter::proto_to_ue(ue_protos[i], ue_context_p);
   }
+  report_ue_state_restore(keys.size(), start);
   return RETURNok;
 }
 
@@ -0,0 +1,400 @@
+/**
+ * Copyright 2021 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+extern "C" {
+#include <linux/genetlink.h>
+#include <linux/gtp.h>
+#include <libmnl/libmnl.h>
+#include "gtpv1u.h"
+}
+
+namespace magma {
+namespace lte {
+
+/*
+ * The GTP genetlink family of the kernel, faked by the netlink socket calls
+ * below. Requests are applied as they are sent and their acks are queued,
+ * to be received in reverse order to check the correlation by sequence.
+ */
+struct FakeGtpKernel {
+  std::mutex mutex;
+  std::map<uint32_t, uint32_t> tunnels;  // i_tei -> o_tei
+  std::vector<std::vector<char>> acks;
+  std::vector<int> msgs_per_send;
+  // Tunnels whose add is acked without being applied
+  std::set<uint32_t> lost_teis;
+  int send_errno = 0;
+  // Receives failing once recv_budget acks were received
+  int recv_errno       = 0;
+  size_t recv_budget   = 0;
+  size_t acks_per_recv = SIZE_MAX;
+
+  void reset() {
+    std::lock_guard<std::mutex> lock(mutex);
+    tunnels.clear();
+    acks.clear();
+    msgs_per_send.clear();
+    lost_teis.clear();
+    send_errno    = 0;
+    recv_errno    = 0;
+    recv_budget   = 0;
+    acks_per_recv = SIZE_MAX;
+  }
+
+  void queue_ack(const struct nlmsghdr* request, int error) {
+    std::vector<char> ack(
+        MNL_ALIGN(sizeof(struct nlmsghdr)) + sizeof(struct nlmsgerr));
+    struct nlmsghdr* nlh = (struct nlmsghdr*) ack.data();
+    nlh->nlmsg_len       = ack.size();
+    nlh->nlmsg_type      = NLMSG_ERROR;
+    nlh->nlmsg_seq       = request->nlmsg_seq;
+    struct nlmsgerr* err = (struct nlmsgerr*) mnl_nlmsg_get_payload(nlh);
+    err->error           = -error;
+    err->msg             = *request;
+    acks.push_back(ack);
+  }
+
+  static int attr_cb(const struct nlattr* attr, void* data) {
+    const struct nlattr** tb = (const struct nlattr**) data;
+    if (mnl_attr_type_valid(attr, GTPA_MAX) >= 0) {
+      tb[mnl_attr_get_type(attr)] = attr;
+    }
+    return MNL_CB_OK;
+  }
+
+  int apply(const struct nlmsghdr* nlh) {
+    const struct nlattr* tb[GTPA_MAX + 1] = {};
+    const struct genlmsghdr* genl =
+        (const struct genlmsghdr*) mnl_nlmsg_get_payload(nlh);
+    mnl_attr_parse(nlh, sizeof(struct genlmsghdr), attr_cb, tb);
+    uint32_t i_tei = mnl_attr_get_u32(tb[GTPA_I_TEI]);
+    if (genl->cmd == GTP_CMD_NEWPDP) {
+      if (tunnels.count(i_tei)) return EEXIST;
+      if (!lost_teis.count(i_tei)) {
+        tunnels[i_tei] = mnl_attr_get_u32(tb[GTPA_O_TEI]);
+      }
+      return 0;
+    }
+    return tunnels.erase(i_tei) ? 0 : ENOENT;
+  }
+
+  ssize_t send(const void* buf, size_t len) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (send_errno) {
+      errno = send_errno;
+      return -1;
+    }
+    int num_msgs               = 0;
+    int remaining              = len;
+    const struct nlmsghdr* nlh = (const struct nlmsghdr*) buf;
+    for (; mnl_nlmsg_ok(nlh, remaining);
+         nlh = mnl_nlmsg_next(nlh, &remaining)) {
+      queue_ack(nlh, apply(nlh));
+      num_msgs++;
+    }
+    msgs_per_send.push_back(num_msgs);
+    return len;
+  }
+
+  ssize_t recv(void* buf, size_t size) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (recv_errno && recv_budget == 0) {
+      errno = recv_errno;
+      return -1;
+    }
+    size_t len = 0;
+    for (size_t n = 0; !acks.empty() && n < acks_per_recv; n++) {
+      if (recv_errno && recv_budget == 0) break;
+      // Latest first
+      const std::vector<char>& ack = acks.back();
+      if (len + ack.size() > size) break;
+      memcpy((char*) buf + len, ack.data(), ack.size());
+      len += ack.size();
+      acks.pop_back();
+      if (recv_errno) recv_budget--;
+    }
+    return len;
+  }
+
+  int dump(mnl_cb_t cb, void* data) {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (const auto& tunnel : tunnels) {
+      char buf[MNL_SOCKET_BUFFER_SIZE];
+      struct nlmsghdr* nlh = mnl_nlmsg_put_header(buf);
+      struct genlmsghdr* genl =
+          (struct genlmsghdr*) mnl_nlmsg_put_extra_header(
+              nlh, sizeof(struct genlmsghdr));
+      genl->cmd = GTP_CMD_NEWPDP;
+      mnl_attr_put_u32(nlh, GTPA_I_TEI, tunnel.first);
+      mnl_attr_put_u32(nlh, GTPA_O_TEI, tunnel.second);
+      if (cb(nlh, data) < 0) return -1;
+    }
+    return 0;
+  }
+};
+
+static FakeGtpKernel kernel;
+
+extern "C" {
+ssize_t mnl_socket_sendto(
+    const struct mnl_socket*, const void* buf, size_t len) {
+  return kernel.send(buf, len);
+}
+
+ssize_t mnl_socket_recvfrom(const struct mnl_socket*, void* buf, size_t size) {
+  return kernel.recv(buf, size);
+}
+
+unsigned int mnl_socket_get_portid(const struct mnl_socket*) {
+  return 0;
+}
+
+int genl_socket_talk(
+    struct mnl_socket*, struct nlmsghdr*, uint32_t,
+    int (*cb)(const struct nlmsghdr*, void*), void* data) {
+  return kernel.dump(cb, data);
+}
+}
+
+struct TunnelFailure {
+  bool is_add;
+  uint32_t i_tei;
+  uint32_t o_tei;
+  int error;
+};
+
+static std::mutex failures_mutex;
+static std::vector<TunnelFailure> failures;
+
+static void record_failure(
+    bool is_add, uint32_t i_tei, uint32_t o_tei, int error) {
+  std::lock_guard<std::mutex> lock(failures_mutex);
+  failures.push_back({is_add, i_tei, o_tei, error});
+}
+
+class GtpTunnelLibgtpnlTest : public ::testing::Test {
+ protected:
+  virtual void SetUp() {
+    kernel.reset();
+    failures.clear();
+    ops = gtp_tunnel_ops_init_libgtpnl();
+  }
+
+  virtual void TearDown() { libgtpnl_stop(); }
+
+  void start(bool persist_state) {
+    // The socket is only handed to the fake calls
+    ASSERT_EQ(
+        0, libgtpnl_start((struct mnl_socket*) &kernel, 1, 1, persist_state));
+    ops->set_failure_cb(record_failure);
+  }
+
+  void add(uint32_t i_tei) {
+    struct in_addr ue  = {.s_addr = htonl(0xC0A88000 + i_tei)};
+    struct in_addr enb = {.s_addr = htonl(0x0A000001)};
+    Imsi_t imsi        = {};
+    EXPECT_EQ(
+        0, ops->add_tunnel(
+               ue, NULL, 0, enb, i_tei, i_tei + 1000, imsi, NULL, 0, NULL));
+  }
+
+  void del(uint32_t i_tei) {
+    struct in_addr ue  = {.s_addr = htonl(0xC0A88000 + i_tei)};
+    struct in_addr enb = {.s_addr = htonl(0x0A000001)};
+    EXPECT_EQ(0, ops->del_tunnel(enb, ue, NULL, i_tei, i_tei + 1000, NULL));
+  }
+
+  // Waits for the flush thread to send the pending requests
+  bool wait_tunnels(size_t num_tunnels) {
+    for (int i = 0; i < 1000; i++) {
+      {
+        std::lock_guard<std::mutex> lock(kernel.mutex);
+        if (kernel.tunnels.size() == num_tunnels) return true;
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return false;
+  }
+
+  std::vector<TunnelFailure> get_failures() {
+    std::lock_guard<std::mutex> lock(failures_mutex);
+    return failures;
+  }
+
+  const struct gtp_tunnel_ops* ops;
+};
+
+TEST_F(GtpTunnelLibgtpnlTest, TestFlushOnSize) {
+  start(false);
+  for (uint32_t teid = 1; teid <= 64; teid++) {
+    add(teid);
+  }
+  // The 64th request sent the batch without waiting for the flush thread
+  std::lock_guard<std::mutex> lock(kernel.mutex);
+  ASSERT_EQ(1, kernel.msgs_per_send.size());
+  EXPECT_EQ(64, kernel.msgs_per_send[0]);
+  EXPECT_EQ(64, kernel.tunnels.size());
+  EXPECT_EQ(1064, kernel.tunnels[64]);
+  EXPECT_TRUE(get_failures().empty());
+}
+
+TEST_F(GtpTunnelLibgtpnlTest, TestFlushOnDelay) {
+  start(false);
+  add(1);
+  add(2);
+  add(3);
+  ASSERT_TRUE(wait_tunnels(3));
+
+  del(2);
+  ASSERT_TRUE(wait_tunnels(2));
+  std::lock_guard<std::mutex> lock(kernel.mutex);
+  EXPECT_EQ(0, kernel.tunnels.count(2));
+  EXPECT_EQ(1, kernel.tunnels.count(3));
+}
+
+TEST_F(GtpTunnelLibgtpnlTest, TestAcksCorrelated) {
+  start(false);
+  {
+    std::lock_guard<std::mutex> lock(kernel.mutex);
+    kernel.tunnels[3] = 3;
+    // One ack per receive, in reverse order
+    kernel.acks_per_recv = 1;
+  }
+  add(1);
+  add(2);
+  add(3);
+  add(4);
+  del(5);
+  ASSERT_TRUE(wait_tunnels(4));
+  libgtpnl_stop();
+
+  // Only the requests the kernel failed are reported, with their TEIDs
+  std::vector<TunnelFailure> reported = get_failures();
+  ASSERT_EQ(2, reported.size());
+  EXPECT_FALSE(reported[0].is_add);
+  EXPECT_EQ(5, reported[0].i_tei);
+  EXPECT_EQ(1005, reported[0].o_tei);
+  EXPECT_EQ(ENOENT, reported[0].error);
+  EXPECT_TRUE(reported[1].is_add);
+  EXPECT_EQ(3, reported[1].i_tei);
+  EXPECT_EQ(1003, reported[1].o_tei);
+  EXPECT_EQ(EEXIST, reported[1].error);
+}
+
+TEST_F(GtpTunnelLibgtpnlTest, TestRecvFailure) {
+  start(false);
+  {
+    std::lock_guard<std::mutex> lock(kernel.mutex);
+    kernel.recv_errno  = EIO;
+    kernel.recv_budget = 1;
+  }
+  add(1);
+  add(2);
+  add(3);
+  ASSERT_TRUE(wait_tunnels(3));
+  // The lock is held until the acks were handled
+  libgtpnl_stop();
+
+  // The acks not received are reported as failures
+  std::vector<TunnelFailure> reported = get_failures();
+  ASSERT_EQ(2, reported.size());
+  EXPECT_EQ(1, reported[0].i_tei);
+  EXPECT_EQ(EIO, reported[0].error);
+  EXPECT_EQ(2, reported[1].i_tei);
+  EXPECT_EQ(EIO, reported[1].error);
+
+  // The late acks of that batch are not taken for the ones of the next batch
+  failures.clear();
+  {
+    std::lock_guard<std::mutex> lock(kernel.mutex);
+    ASSERT_EQ(2, kernel.acks.size());
+    kernel.recv_errno = 0;
+    kernel.tunnels[4] = 4;
+  }
+  start(false);
+  add(4);
+  add(5);
+  libgtpnl_stop();
+  {
+    std::lock_guard<std::mutex> lock(kernel.mutex);
+    ASSERT_TRUE(kernel.acks.empty());
+  }
+  reported = get_failures();
+  ASSERT_EQ(1, reported.size());
+  EXPECT_EQ(4, reported[0].i_tei);
+  EXPECT_EQ(EEXIST, reported[0].error);
+}
+
+TEST_F(GtpTunnelLibgtpnlTest, TestSendFailure) {
+  start(false);
+  {
+    std::lock_guard<std::mutex> lock(kernel.mutex);
+    kernel.send_errno = ENOBUFS;
+  }
+  add(1);
+  del(2);
+  libgtpnl_stop();
+
+  std::vector<TunnelFailure> reported = get_failures();
+  ASSERT_EQ(2, reported.size());
+  EXPECT_TRUE(reported[0].is_add);
+  EXPECT_EQ(1, reported[0].i_tei);
+  EXPECT_EQ(ENOBUFS, reported[0].error);
+  EXPECT_FALSE(reported[1].is_add);
+  EXPECT_EQ(2, reported[1].i_tei);
+  EXPECT_EQ(ENOBUFS, reported[1].error);
+}
+
+TEST_F(GtpTunnelLibgtpnlTest, TestReconcileAddsMissingTunnels) {
+  start(true);
+  {
+    std::lock_guard<std::mutex> lock(kernel.mutex);
+    // Tunnels not in the restored state are left alone
+    kernel.tunnels[99] = 99;
+    kernel.lost_teis.insert(2);
+  }
+  add(1);
+  add(2);
+  add(3);
+  ASSERT_TRUE(wait_tunnels(3));
+  {
+    std::lock_guard<std::mutex> lock(kernel.mutex);
+    kernel.lost_teis.clear();
+  }
+
+  EXPECT_EQ(0, ops->reconcile_tunnels());
+  ASSERT_TRUE(wait_tunnels(4));
+  std::lock_guard<std::mutex> lock(kernel.mutex);
+  EXPECT_EQ(1002, kernel.tunnels[2]);
+  EXPECT_EQ(99, kernel.tunnels[99]);
+  EXPECT_TRUE(get_failures().empty());
+}
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
+
+}  // namespace lte
+}  // namespace magma
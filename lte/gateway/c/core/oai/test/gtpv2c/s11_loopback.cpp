@@ -0,0 +1,285 @@
+/**
+ * Copyright 2020 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "s11_loopback.h"
+
+#include <arpa/inet.h>
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+namespace magma {
+
+namespace {
+constexpr uint16_t GTPV2C_PORT = 2123;
+
+nw_rc_t send_udp(
+    nw_gtpv2c_udp_handle_t hUdp, uint8_t* buf, uint32_t len,
+    uint16_t localPort, struct sockaddr* peerIp, uint16_t peerPort) {
+  S11Node* node = (S11Node*) hUdp;
+  node->wire.push_back(
+      Datagram{std::vector<uint8_t>(buf, buf + len), localPort, peerPort});
+  return NW_OK;
+}
+
+nw_rc_t start_timer(
+    nw_gtpv2c_timer_mgr_handle_t hTmrMgr, uint32_t sec, uint32_t usec,
+    uint32_t type, void* arg, nw_gtpv2c_timer_handle_t* phTimer) {
+  // The stack only runs the timer at the head of its min-heap
+  ((S11Node*) hTmrMgr)->active_timer = arg;
+  *phTimer                           = (nw_gtpv2c_timer_handle_t) arg;
+  return NW_OK;
+}
+
+nw_rc_t stop_timer(
+    nw_gtpv2c_timer_mgr_handle_t hTmrMgr, nw_gtpv2c_timer_handle_t hTimer) {
+  S11Node* node = (S11Node*) hTmrMgr;
+  if (node->active_timer == (void*) hTimer) {
+    node->active_timer = nullptr;
+  }
+  return NW_OK;
+}
+
+nw_rc_t send_triggered_rsp(
+    S11Node* sgw, nw_gtpv2c_ulp_api_t* pUlpApi,
+    nw_gtpv2c_ulp_api_type_t api_type, uint8_t msg_type, uint32_t ue) {
+  uint8_t cause[2] = {NW_GTPV2C_CAUSE_REQUEST_ACCEPTED, 0};
+  nw_gtpv2c_ulp_api_t ulp_rsp;
+
+  memset(&ulp_rsp, 0, sizeof(ulp_rsp));
+  ulp_rsp.apiType = api_type;
+  ulp_rsp.u_api_info.triggeredRspInfo.hTrxn =
+      pUlpApi->u_api_info.initialReqIndInfo.hTrxn;
+  ulp_rsp.u_api_info.triggeredRspInfo.teidLocal = SGW_TEID_BASE + ue;
+  nwGtpv2cMsgNew(
+      sgw->stack, true, msg_type, MME_TEID_BASE + ue,
+      nwGtpv2cMsgGetSeqNumber(pUlpApi->hMsg), &ulp_rsp.hMsg);
+  nwGtpv2cMsgAddIe(ulp_rsp.hMsg, NW_GTPV2C_IE_CAUSE, 2, 0, cause);
+  nwGtpv2cMsgDelete(sgw->stack, pUlpApi->hMsg);
+  nw_rc_t rc = nwGtpv2cProcessUlpReq(sgw->stack, &ulp_rsp);
+  if (api_type & NW_GTPV2C_ULP_API_FLAG_CREATE_LOCAL_TUNNEL) {
+    sgw->tunnels[ue] = ulp_rsp.u_api_info.triggeredRspInfo.hTunnel;
+  }
+  return rc;
+}
+
+nw_rc_t delete_local_tunnel(S11Node* node, uint32_t ue) {
+  nw_gtpv2c_ulp_api_t ulp_req;
+
+  memset(&ulp_req, 0, sizeof(ulp_req));
+  ulp_req.apiType = NW_GTPV2C_ULP_DELETE_LOCAL_TUNNEL;
+  ulp_req.u_api_info.deleteLocalTunnelInfo.hTunnel = node->tunnels[ue];
+  node->tunnels[ue]                                = 0;
+  return nwGtpv2cProcessUlpReq(node->stack, &ulp_req);
+}
+
+// The SGW opens its end of the tunnel with the Create Session Response, the
+// MME learns the SGW TEID from the UE index instead of an F-TEID IE. The
+// requests only carry the IEs the loopback needs, the missing mandatory IEs
+// reported by the parser are ignored.
+nw_rc_t sgw_ulp(nw_gtpv2c_ulp_handle_t hUlp, nw_gtpv2c_ulp_api_t* pUlpApi) {
+  S11Node* sgw = (S11Node*) hUlp;
+  uint8_t if_type;
+  uint32_t teid = 0;
+  struct in_addr ipv4;
+
+  if (pUlpApi->apiType != NW_GTPV2C_ULP_API_INITIAL_REQ_IND) {
+    return NW_FAILURE;
+  }
+  switch (pUlpApi->u_api_info.initialReqIndInfo.msgType) {
+    case NW_GTP_CREATE_SESSION_REQ:
+      nwGtpv2cMsgGetIeFteid(
+          pUlpApi->hMsg, NW_GTPV2C_IE_INSTANCE_ZERO, &if_type, &teid, &ipv4,
+          NULL);
+      return send_triggered_rsp(
+          sgw, pUlpApi,
+          (nw_gtpv2c_ulp_api_type_t)(
+              NW_GTPV2C_ULP_API_TRIGGERED_RSP |
+              NW_GTPV2C_ULP_API_FLAG_CREATE_LOCAL_TUNNEL),
+          NW_GTP_CREATE_SESSION_RSP, teid - MME_TEID_BASE);
+    case NW_GTP_DELETE_SESSION_REQ: {
+      uint32_t ue = nwGtpv2cMsgGetTeid(pUlpApi->hMsg) - SGW_TEID_BASE;
+      nw_rc_t rc  = send_triggered_rsp(
+          sgw, pUlpApi, NW_GTPV2C_ULP_API_TRIGGERED_RSP,
+          NW_GTP_DELETE_SESSION_RSP, ue);
+      delete_local_tunnel(sgw, ue);
+      return rc;
+    }
+    default:
+      nwGtpv2cMsgDelete(sgw->stack, pUlpApi->hMsg);
+      return NW_FAILURE;
+  }
+}
+
+// Counts the responses and deletes the tunnel once the session is gone, as
+// s11_mme_handle_delete_session_response() does
+nw_rc_t mme_ulp(nw_gtpv2c_ulp_handle_t hUlp, nw_gtpv2c_ulp_api_t* pUlpApi) {
+  S11Node* mme = (S11Node*) hUlp;
+  if (pUlpApi->apiType != NW_GTPV2C_ULP_API_TRIGGERED_RSP_IND) {
+    return NW_FAILURE;
+  }
+  uint32_t teid = nwGtpv2cMsgGetTeid(pUlpApi->hMsg);
+  nwGtpv2cMsgDelete(mme->stack, pUlpApi->hMsg);
+  if (pUlpApi->u_api_info.triggeredRspIndInfo.msgType ==
+      NW_GTP_CREATE_SESSION_RSP) {
+    mme->create_rsps++;
+    return NW_OK;
+  }
+  mme->delete_rsps++;
+  return delete_local_tunnel(mme, teid - MME_TEID_BASE);
+}
+
+nw_rc_t init_node(
+    S11Node& node, const char* ip,
+    nw_rc_t (*ulp_cb)(nw_gtpv2c_ulp_handle_t, nw_gtpv2c_ulp_api_t*)) {
+  struct sockaddr_in* addr = (struct sockaddr_in*) &node.addr;
+  addr->sin_family         = AF_INET;
+  inet_pton(AF_INET, ip, &addr->sin_addr);
+
+  nw_gtpv2c_ulp_entity_t ulp;
+  nw_gtpv2c_udp_entity_t udp;
+  nw_gtpv2c_timer_mgr_entity_t tmrMgr;
+
+  if (nwGtpv2cInitialize(&node.stack) != NW_OK) {
+    return NW_FAILURE;
+  }
+  ulp.hUlp           = (nw_gtpv2c_ulp_handle_t) &node;
+  ulp.ulpReqCallback = ulp_cb;
+
+  udp.hUdp               = (nw_gtpv2c_udp_handle_t) &node;
+  udp.gtpv2cStandardPort = GTPV2C_PORT;
+  udp.udpDataReqCallback = send_udp;
+
+  tmrMgr.tmrMgrHandle     = (nw_gtpv2c_timer_mgr_handle_t) &node;
+  tmrMgr.tmrStartCallback = start_timer;
+  tmrMgr.tmrStopCallback  = stop_timer;
+  if (nwGtpv2cSetUlpEntity(node.stack, &ulp) != NW_OK ||
+      nwGtpv2cSetUdpEntity(node.stack, &udp) != NW_OK ||
+      nwGtpv2cSetTimerMgrEntity(node.stack, &tmrMgr) != NW_OK) {
+    return NW_FAILURE;
+  }
+  return NW_OK;
+}
+}  // namespace
+
+nw_rc_t S11Loopback::init() {
+  mme.peer = &sgw;
+  sgw.peer = &mme;
+  if (init_node(mme, "127.0.0.1", mme_ulp) != NW_OK) {
+    return NW_FAILURE;
+  }
+  return init_node(sgw, "127.0.0.2", sgw_ulp);
+}
+
+void S11Loopback::finalize() {
+  if (mme.stack) {
+    nwGtpv2cFinalize(mme.stack);
+  }
+  if (sgw.stack) {
+    nwGtpv2cFinalize(sgw.stack);
+  }
+  mme.stack = 0;
+  sgw.stack = 0;
+}
+
+void S11Loopback::pump() {
+  bool delivered = true;
+  while (delivered) {
+    delivered = false;
+    for (S11Node* node : {&mme, &sgw}) {
+      while (!node->wire.empty()) {
+        Datagram datagram = std::move(node->wire.front());
+        node->wire.pop_front();
+        nwGtpv2cProcessUdpReq(
+            node->peer->stack, datagram.buf.data(), datagram.buf.size(),
+            datagram.dst_port, datagram.src_port,
+            (struct sockaddr*) &node->addr);
+        delivered = true;
+      }
+    }
+  }
+}
+
+void S11Loopback::expire_timers(S11Node& node) {
+  while (node.active_timer) {
+    void* timer       = node.active_timer;
+    node.active_timer = nullptr;
+    nwGtpv2cProcessTimeout(timer);
+  }
+}
+
+nw_rc_t S11Loopback::send_initial_req(
+    uint8_t msg_type, uint32_t ue, nw_gtpv2c_tunnel_handle_t hTunnel) {
+  nw_gtpv2c_ulp_api_t ulp_req;
+  memset(&ulp_req, 0, sizeof(ulp_req));
+  ulp_req.apiType = NW_GTPV2C_ULP_API_INITIAL_REQ;
+  // A new session is not known to the SGW yet
+  uint32_t sgw_teid =
+      (msg_type == NW_GTP_CREATE_SESSION_REQ) ? 0 : SGW_TEID_BASE + ue;
+  if (nwGtpv2cMsgNew(mme.stack, true, msg_type, sgw_teid, 0, &ulp_req.hMsg) !=
+      NW_OK) {
+    return NW_FAILURE;
+  }
+  if (msg_type == NW_GTP_CREATE_SESSION_REQ) {
+    struct in_addr ipv4 = ((struct sockaddr_in*) &mme.addr)->sin_addr;
+    nwGtpv2cMsgAddIeFteid(
+        ulp_req.hMsg, NW_GTPV2C_IE_INSTANCE_ZERO, S11_MME_GTP_C,
+        MME_TEID_BASE + ue, &ipv4, NULL);
+  }
+  ulp_req.u_api_info.initialReqInfo.edns_peer_ip =
+      (struct sockaddr*) &sgw.addr;
+  ulp_req.u_api_info.initialReqInfo.teidLocal = MME_TEID_BASE + ue;
+  ulp_req.u_api_info.initialReqInfo.hTunnel   = hTunnel;
+  nw_rc_t rc      = nwGtpv2cProcessUlpReq(mme.stack, &ulp_req);
+  mme.tunnels[ue] = ulp_req.u_api_info.initialReqInfo.hTunnel;
+  return rc;
+}
+
+nw_rc_t S11Loopback::run_bursts(
+    uint8_t msg_type, uint32_t num_ues, uint32_t burst_size) {
+  for (uint32_t first = 0; first < num_ues; first += burst_size) {
+    uint32_t last = std::min(first + burst_size, num_ues);
+    for (uint32_t ue = first; ue < last; ue++) {
+      nw_gtpv2c_tunnel_handle_t hTunnel =
+          (msg_type == NW_GTP_CREATE_SESSION_REQ) ? 0 : mme.tunnels[ue];
+      if (send_initial_req(msg_type, ue, hTunnel) != NW_OK) {
+        return NW_FAILURE;
+      }
+    }
+    pump();
+    expire_timers(sgw);
+  }
+  return NW_OK;
+}
+
+nw_rc_t S11Loopback::create_sessions(uint32_t num_ues, uint32_t burst_size) {
+  mme.tunnels.assign(num_ues, 0);
+  sgw.tunnels.assign(num_ues, 0);
+  return run_bursts(NW_GTP_CREATE_SESSION_REQ, num_ues, burst_size);
+}
+
+nw_rc_t S11Loopback::delete_sessions(uint32_t num_ues, uint32_t burst_size) {
+  return run_bursts(NW_GTP_DELETE_SESSION_REQ, num_ues, burst_size);
+}
+
+bool S11Loopback::has_tunnel(uint32_t ue) {
+  nw_gtpv2c_ulp_api_t ulp_req;
+  memset(&ulp_req, 0, sizeof(ulp_req));
+  ulp_req.apiType = NW_GTPV2C_ULP_FIND_LOCAL_TUNNEL;
+  ulp_req.u_api_info.findLocalTunnelInfo.teidLocal = MME_TEID_BASE + ue;
+  ulp_req.u_api_info.findLocalTunnelInfo.edns_peer_ip =
+      (struct sockaddr*) &sgw.addr;
+  nwGtpv2cProcessUlpReq(mme.stack, &ulp_req);
+  return ulp_req.u_api_info.findLocalTunnelInfo.hTunnel != 0;
+}
+
+}  // namespace magma
@@ -0,0 +1,87 @@
+/**
+ * Copyright 2020 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <sys/socket.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <vector>
+
+extern "C" {
+#include "NwGtpv2c.h"
+#include "NwGtpv2cIe.h"
+#include "NwGtpv2cMsg.h"
+}
+
+namespace magma {
+
+constexpr uint32_t MME_TEID_BASE = 0x1000;
+constexpr uint32_t SGW_TEID_BASE = 0x8000000;
+
+struct Datagram {
+  std::vector<uint8_t> buf;
+  uint16_t src_port;
+  uint16_t dst_port;
+};
+
+// One GTPv2-C stack on its own loopback address. Datagrams sent by the stack
+// are queued for the peer node, timers are kept until they are fired by hand.
+struct S11Node {
+  nw_gtpv2c_stack_handle_t stack = 0;
+  struct sockaddr_storage addr   = {};
+  S11Node* peer                  = nullptr;
+  std::deque<Datagram> wire;
+  void* active_timer = nullptr;
+
+  // Responses seen by the MME
+  uint32_t create_rsps = 0;
+  uint32_t delete_rsps = 0;
+  std::vector<nw_gtpv2c_tunnel_handle_t> tunnels;
+};
+
+// An MME and an SGW stack talking S11 to each other in process. The SGW
+// accepts every Create Session and Delete Session Request.
+class S11Loopback {
+ public:
+  // @return NW_OK once both stacks are up
+  nw_rc_t init();
+  void finalize();
+
+  // Delivers the queued datagrams of both nodes until the wire is quiet
+  void pump();
+
+  // Fires every pending timer, as if the retransmission and duplicate
+  // request windows had all elapsed
+  void expire_timers(S11Node& node);
+
+  nw_rc_t send_initial_req(
+      uint8_t msg_type, uint32_t ue, nw_gtpv2c_tunnel_handle_t hTunnel);
+
+  // Attaches or detaches UEs [0, num_ues), burst_size sessions at a time.
+  // The SGW lets go of its responses after every burst, the MME keeps a
+  // tunnel per attached UE.
+  nw_rc_t create_sessions(uint32_t num_ues, uint32_t burst_size);
+  nw_rc_t delete_sessions(uint32_t num_ues, uint32_t burst_size);
+
+  bool has_tunnel(uint32_t ue);
+
+  S11Node mme;
+  S11Node sgw;
+
+ private:
+  nw_rc_t run_bursts(uint8_t msg_type, uint32_t num_ues, uint32_t burst_size);
+};
+
+}  // namespace magma
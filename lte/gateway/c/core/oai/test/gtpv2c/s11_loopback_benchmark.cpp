@@ -0,0 +1,79 @@
+/**
+ * Copyright 2020 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * S11 Create Session / Delete Session throughput of the GTPv2-C stack
+ * against an in process SGW.
+ *
+ *   s11_loopback_benchmark [burst size]
+ *
+ * 1k, 10k and 100k UEs are attached then detached, burst size sessions at a
+ * time, with the stacks sized for them. The time per session (create and
+ * delete) and the sessions per second are printed for each size.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+#include "s11_loopback.h"
+
+extern "C" {
+#include "log.h"
+}
+
+using magma::S11Loopback;
+
+int main(int argc, char** argv) {
+  long burst_size = argc > 1 ? atol(argv[1]) : 256;
+  if (burst_size <= 0) {
+    fprintf(stderr, "usage: %s [burst size]\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+  OAILOG_INIT("MME", OAILOG_LEVEL_INFO, MAX_LOG_PROTOS);
+
+  for (uint32_t num_ues : {1000, 10000, 100000}) {
+    S11Loopback loopback;
+    if (loopback.init() != NW_OK ||
+        nwGtpv2cSetCapacity(
+            loopback.mme.stack, num_ues, burst_size, burst_size) != NW_OK ||
+        nwGtpv2cSetCapacity(
+            loopback.sgw.stack, num_ues, burst_size, burst_size) != NW_OK) {
+      fprintf(stderr, "Failed to set the stacks up for %u UEs\n", num_ues);
+      return EXIT_FAILURE;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    nw_rc_t rc = loopback.create_sessions(num_ues, burst_size);
+    if (rc == NW_OK) {
+      rc = loopback.delete_sessions(num_ues, burst_size);
+    }
+    long elapsed_ns =
+        (long) std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start)
+            .count();
+    loopback.finalize();
+
+    if (rc != NW_OK || loopback.mme.create_rsps != num_ues ||
+        loopback.mme.delete_rsps != num_ues) {
+      fprintf(
+          stderr, "%u UEs: %u sessions created, %u deleted\n", num_ues,
+          loopback.mme.create_rsps, loopback.mme.delete_rsps);
+      return EXIT_FAILURE;
+    }
+    printf(
+        "%u UEs: %ld ns/session (create + delete), %.0f sessions/s\n",
+        num_ues, elapsed_ns / num_ues, num_ues * 1e9 / (double) elapsed_ns);
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,99 @@
+/**
+ * Copyright 2020 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "s11_loopback.h"
+
+extern "C" {
+#include "log.h"
+}
+
+namespace magma {
+
+class Gtpv2cS11LoopbackTest : public ::testing::Test, public S11Loopback {
+ protected:
+  virtual void SetUp() { ASSERT_EQ(init(), NW_OK); }
+
+  virtual void TearDown() { finalize(); }
+
+  void set_capacity(uint32_t num_ues, uint32_t burst_size) {
+    ASSERT_EQ(
+        nwGtpv2cSetCapacity(mme.stack, num_ues, burst_size, burst_size),
+        NW_OK);
+    ASSERT_EQ(
+        nwGtpv2cSetCapacity(sgw.stack, num_ues, burst_size, burst_size),
+        NW_OK);
+  }
+};
+
+TEST_F(Gtpv2cS11LoopbackTest, TestCreateDeleteSession) {
+  mme.tunnels.assign(2, 0);
+  sgw.tunnels.assign(2, 0);
+  ASSERT_EQ(send_initial_req(NW_GTP_CREATE_SESSION_REQ, 1, 0), NW_OK);
+  ASSERT_NE(mme.tunnels[1], 0u);
+  EXPECT_TRUE(has_tunnel(1));
+  EXPECT_FALSE(has_tunnel(0));
+  pump();
+  EXPECT_EQ(mme.create_rsps, 1u);
+  // The response stopped the retransmission timer
+  EXPECT_EQ(mme.active_timer, nullptr);
+
+  ASSERT_EQ(
+      send_initial_req(NW_GTP_DELETE_SESSION_REQ, 1, mme.tunnels[1]), NW_OK);
+  pump();
+  EXPECT_EQ(mme.delete_rsps, 1u);
+  EXPECT_FALSE(has_tunnel(1));
+
+  // The SGW keeps its responses for duplicate requests until they expire
+  EXPECT_NE(sgw.active_timer, nullptr);
+  expire_timers(sgw);
+  EXPECT_EQ(sgw.active_timer, nullptr);
+}
+
+TEST_F(Gtpv2cS11LoopbackTest, TestSessionBursts) {
+  // More UEs than the pools hold, with a partial last burst
+  const uint32_t num_ues    = 1000;
+  const uint32_t burst_size = 64;
+  set_capacity(num_ues / 4, burst_size);
+
+  ASSERT_EQ(create_sessions(num_ues, burst_size), NW_OK);
+  EXPECT_EQ(mme.create_rsps, num_ues);
+  EXPECT_EQ(mme.active_timer, nullptr);
+  for (uint32_t ue = 0; ue < num_ues; ue++) {
+    ASSERT_TRUE(has_tunnel(ue)) << "UE " << ue;
+    ASSERT_NE(sgw.tunnels[ue], 0u) << "UE " << ue;
+  }
+
+  ASSERT_EQ(delete_sessions(num_ues, burst_size), NW_OK);
+  EXPECT_EQ(mme.delete_rsps, num_ues);
+  EXPECT_EQ(mme.active_timer, nullptr);
+  EXPECT_EQ(sgw.active_timer, nullptr);
+  for (uint32_t ue = 0; ue < num_ues; ue++) {
+    ASSERT_FALSE(has_tunnel(ue)) << "UE " << ue;
+    ASSERT_EQ(sgw.tunnels[ue], 0u) << "UE " << ue;
+  }
+
+  // The released tunnels and transactions are reused by the next attach
+  mme.create_rsps = 0;
+  ASSERT_EQ(create_sessions(num_ues, burst_size), NW_OK);
+  EXPECT_EQ(mme.create_rsps, num_ues);
+  ASSERT_EQ(delete_sessions(num_ues, burst_size), NW_OK);
+}
+
+}  // namespace magma
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  OAILOG_INIT("MME", OAILOG_LEVEL_INFO, MAX_LOG_PROTOS);
+  return RUN_ALL_TESTS();
+}
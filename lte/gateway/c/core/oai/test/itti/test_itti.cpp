@@ -22,6 +22,7 @@ extern "C" {
 #include "intertask_interface.h"
 #include "intertask_interface_types.h"
 #include "itti_free_defined_msg.h"
+#include "itti_trace.h"
 }
 
 const task_info_t tasks_info[] = {
@@ -126,6 +127,7 @@ class ITTIApiTest : public ::testing::Test {
 
 TEST_F(ITTIApiTest, TestMessageLatency) {
   MessageDef* test_message_p;
+  itti_trace_enable(true);
   test_message_p = DEPRECATEDitti_alloc_new_message_fatal(
       task_zmq_ctx_test1.task_id, TEST_MESSAGE);
   send_msg_to_task(&task_zmq_ctx_test1, TASK_TEST_2, test_message_p);
@@ -136,9 +138,20 @@ TEST_F(ITTIApiTest, TestMessageLatency) {
   test_message_p = DEPRECATEDitti_alloc_new_message_fatal(
       task_zmq_ctx_test1.task_id, TEST_MESSAGE);
   send_msg_to_task(&task_zmq_ctx_test1, TASK_TEST_2, test_message_p);
+  // TASK_TEST_2 is still busy with the first message
+  EXPECT_EQ(itti_get_task_queue_depth(TASK_TEST_2), 1u);
   // Sleep 2 seconds to allow message to be received and processed
   std::this_thread::sleep_for(std::chrono::seconds(2));
   ASSERT_GE(msg_latency, 1000000);
+  EXPECT_EQ(itti_get_task_queue_depth(TASK_TEST_2), 0u);
+
+  // The first message was handled, the second one is still sleeping
+  char* trace = itti_trace_dump_to_string();
+  ASSERT_NE(trace, nullptr);
+  EXPECT_NE(strstr(trace, "TASK_TEST_2: 1 messages"), nullptr);
+  EXPECT_NE(strstr(trace, "TEST_MESSAGE: 1 messages"), nullptr);
+  free(trace);
+  itti_trace_enable(false);
 }
 
 int main(int argc, char** argv) {
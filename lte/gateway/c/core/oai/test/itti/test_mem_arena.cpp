@@ -0,0 +1,235 @@
+/**
+ * Copyright 2020 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+#include <string.h>
+
+#include <vector>
+
+extern "C" {
+#include "bstrlib.h"
+#include "dynamic_memory_check.h"
+#include "mem_arena.h"
+#include "nas_message.h"
+
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t nmemb, size_t size);
+void* __libc_realloc(void* ptr, size_t size);
+}
+
+// Heap allocations of the test thread are counted while count_mallocs is set
+static __thread bool count_mallocs = false;
+static __thread int num_mallocs    = 0;
+
+extern "C" void* malloc(size_t size) {
+  num_mallocs += count_mallocs;
+  return __libc_malloc(size);
+}
+
+extern "C" void* calloc(size_t nmemb, size_t size) {
+  num_mallocs += count_mallocs;
+  return __libc_calloc(nmemb, size);
+}
+
+extern "C" void* realloc(void* ptr, size_t size) {
+  num_mallocs += count_mallocs;
+  return __libc_realloc(ptr, size);
+}
+
+// Uplink NAS PDU (attach request from s1ap tester)
+static const uint8_t nas_pdu[] = {
+    0x07, 0x41, 0x72, 0x08, 0x09, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x02, 0xe0, 0xe0, 0x00, 0x04, 0x02, 0x01, 0xd0, 0x11, 0x40,
+    0x08, 0x04, 0x02, 0x60, 0x04, 0x00, 0x02, 0x1c, 0x00};
+
+// Plain combined Attach Request from a Pixel 4, with a PDN Connectivity
+// Request carrying 9 PCO containers, 2 of them not empty
+static const std::vector<uint8_t> attach_request = {
+    0x07, 0x41, 0x72, 0x08, 0x39, 0x51, 0x10, 0x00, 0x30, 0x09, 0x01, 0x07,
+    0x07, 0xf0, 0x70, 0xc0, 0x40, 0x19, 0x00, 0x80, 0x00, 0x34, 0x02, 0x0c,
+    0xd0, 0x11, 0xd1, 0x27, 0x2d, 0x80, 0x80, 0x21, 0x10, 0x01, 0x00, 0x00,
+    0x10, 0x81, 0x06, 0x00, 0x00, 0x00, 0x00, 0x83, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0d, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x05, 0x00, 0x00, 0x10,
+    0x00, 0x00, 0x11, 0x00, 0x00, 0x1a, 0x01, 0x01, 0x00, 0x23, 0x00, 0x00,
+    0x24, 0x00, 0x5c, 0x0a, 0x01, 0x31, 0x04, 0x65, 0xe0, 0x3e, 0x00, 0x90,
+    0x11, 0x03, 0x57, 0x58, 0xa6, 0x20, 0x0d, 0x60, 0x14, 0x04, 0xef, 0x65,
+    0x23, 0x3b, 0x88, 0x00, 0x92, 0xf2, 0x00, 0x00, 0x40, 0x08, 0x04, 0x02,
+    0x60, 0x04, 0x00, 0x02, 0x1f, 0x00, 0x5d, 0x01, 0x03, 0xc1};
+#define ATTACH_REQUEST_NUM_PCO 9
+// ESM container, supported codecs and the 2 PCO contents
+#define ATTACH_REQUEST_NUM_BSTRINGS 4
+
+// Decodes the Attach Request and its ESM container like EMM and ESM do
+// @return the number of heap allocations made by the decoders
+static int decode_attach_request(nas_message_t* nas_msg, ESM_msg* esm_msg) {
+  nas_message_decode_status_t status = {};
+  memset(nas_msg, 0, sizeof(*nas_msg));
+  memset(esm_msg, 0, sizeof(*esm_msg));
+
+  num_mallocs   = 0;
+  count_mallocs = true;
+  int rc        = nas_message_decode(
+      attach_request.data(), nas_msg, attach_request.size(), NULL, &status);
+  bstring esm_container = nas_msg->plain.emm.attach_request.esmmessagecontainer;
+  int esm_rc            = RETURNerror;
+  if (esm_container) {
+    esm_rc =
+        esm_msg_decode(esm_msg, esm_container->data, blength(esm_container));
+  }
+  count_mallocs = false;
+
+  EXPECT_EQ(rc, (int) attach_request.size());
+  EXPECT_EQ(esm_rc, blength(esm_container));
+  return num_mallocs;
+}
+
+static void check_attach_request(nas_message_t* nas_msg, ESM_msg* esm_msg) {
+  attach_request_msg* attach = &nas_msg->plain.emm.attach_request;
+  EXPECT_EQ(attach->epsattachtype, 2);
+  EXPECT_EQ(attach->naskeysetidentifier.naskeysetidentifier, 7);
+  EXPECT_EQ(blength(attach->esmmessagecontainer), 0x34);
+  EXPECT_EQ(blength(attach->supportedcodecs), 8);
+
+  pdn_connectivity_request_msg* pdn_req = &esm_msg->pdn_connectivity_request;
+  EXPECT_EQ(pdn_req->messagetype, PDN_CONNECTIVITY_REQUEST);
+  EXPECT_EQ(
+      pdn_req->protocolconfigurationoptions.num_protocol_or_container_id,
+      ATTACH_REQUEST_NUM_PCO);
+  pco_protocol_or_container_id_t* ipcp =
+      &pdn_req->protocolconfigurationoptions.protocol_or_container_ids[0];
+  EXPECT_EQ(ipcp->id, PCO_PI_IPCP);
+  EXPECT_EQ(blength(ipcp->contents), 0x10);
+}
+
+TEST(MemArenaTest, TestBstrIsReleasedWithArena) {
+  mem_arena_t* arena = mem_arena_create(0);
+  ASSERT_NE(arena, nullptr);
+
+  bstring b = mem_arena_blk2bstr(arena, nas_pdu, sizeof(nas_pdu));
+  ASSERT_NE(b, nullptr);
+  EXPECT_EQ(blength(b), sizeof(nas_pdu));
+  EXPECT_EQ(memcmp(b->data, nas_pdu, sizeof(nas_pdu)), 0);
+  EXPECT_TRUE(mem_arena_bstr_is_arena(b));
+
+  // Owners written for heap bstrings must not free arena memory
+  EXPECT_EQ(bdestroy(b), BSTR_ERR);
+  EXPECT_EQ(bconcat(b, b), BSTR_ERR);
+  bdestroy_wrapper(&b);
+  EXPECT_EQ(b, nullptr);
+
+  mem_arena_destroy(&arena);
+  EXPECT_EQ(arena, nullptr);
+}
+
+TEST(MemArenaTest, TestPersistDetachesFromArena) {
+  mem_arena_t* arena = mem_arena_create(0);
+  bstring b          = mem_arena_blk2bstr(arena, nas_pdu, sizeof(nas_pdu));
+  bstring kept       = mem_arena_bstr_persist(b);
+  mem_arena_destroy(&arena);
+
+  ASSERT_NE(kept, nullptr);
+  EXPECT_FALSE(mem_arena_bstr_is_arena(kept));
+  EXPECT_EQ(blength(kept), sizeof(nas_pdu));
+  EXPECT_EQ(memcmp(kept->data, nas_pdu, sizeof(nas_pdu)), 0);
+
+  // Heap bstrings are returned as is
+  EXPECT_EQ(mem_arena_bstr_persist(kept), kept);
+  bdestroy_wrapper(&kept);
+}
+
+TEST(MemArenaTest, TestAttachDecodeOnHeap) {
+  nas_message_t nas_msg;
+  ESM_msg esm_msg;
+  int mallocs = decode_attach_request(&nas_msg, &esm_msg);
+  check_attach_request(&nas_msg, &esm_msg);
+
+  // blk2bstr() allocates the header and the data of each bstring
+  EXPECT_EQ(mallocs, 2 * ATTACH_REQUEST_NUM_BSTRINGS);
+
+  bdestroy_wrapper(&nas_msg.plain.emm.attach_request.esmmessagecontainer);
+  bdestroy_wrapper(&nas_msg.plain.emm.attach_request.supportedcodecs);
+  clear_protocol_configuration_options(
+      &esm_msg.pdn_connectivity_request.protocolconfigurationoptions);
+}
+
+TEST(MemArenaTest, TestAttachDecodeOnArena) {
+  mem_arena_t* arena = mem_arena_create(0);
+  nas_message_t nas_msg;
+  ESM_msg esm_msg;
+  mem_arena_set_current(arena);
+  int mallocs = decode_attach_request(&nas_msg, &esm_msg);
+  mem_arena_set_current(NULL);
+  check_attach_request(&nas_msg, &esm_msg);
+
+  // The only heap allocations left are the chunks of the arena
+  EXPECT_EQ(mallocs, (int) arena->num_chunks);
+  EXPECT_EQ(arena->num_chunks, 1u);
+  EXPECT_EQ(arena->num_allocs, (uint32_t) ATTACH_REQUEST_NUM_BSTRINGS);
+  EXPECT_TRUE(mem_arena_bstr_is_arena(
+      nas_msg.plain.emm.attach_request.esmmessagecontainer));
+
+  // What EMM keeps is copied out before the message goes away
+  bstring esm_container = mem_arena_bstr_persist(
+      nas_msg.plain.emm.attach_request.esmmessagecontainer);
+  clear_protocol_configuration_options(
+      &esm_msg.pdn_connectivity_request.protocolconfigurationoptions);
+  mem_arena_destroy(&arena);
+  EXPECT_EQ(blength(esm_container), 0x34);
+  bdestroy_wrapper(&esm_container);
+}
+
+TEST(MemArenaTest, TestAsnAllocators) {
+  // Without a current arena the heap is used
+  void* heap = mem_arena_asn_malloc(8);
+  ASSERT_NE(heap, nullptr);
+  heap = mem_arena_asn_realloc(heap, 64);
+  mem_arena_asn_free(heap);
+
+  mem_arena_t* arena = mem_arena_create(0);
+  mem_arena_set_current(arena);
+  uint8_t* buf = (uint8_t*) mem_arena_asn_calloc(4, 4);
+  ASSERT_NE(buf, nullptr);
+  EXPECT_TRUE(mem_arena_owns(arena, buf));
+  memset(buf, 0xab, 16);
+
+  // Shrinking keeps the block, growing copies it within the arena
+  EXPECT_EQ(mem_arena_asn_realloc(buf, 8), buf);
+  uint8_t* grown = (uint8_t*) mem_arena_asn_realloc(buf, 32);
+  ASSERT_NE(grown, nullptr);
+  EXPECT_TRUE(mem_arena_owns(arena, grown));
+  EXPECT_EQ(grown[15], 0xab);
+  EXPECT_EQ(grown[16], 0);
+
+  // Arena memory is released with the arena only
+  uint32_t num_allocs = arena->num_allocs;
+  mem_arena_asn_free(grown);
+  mem_arena_current_free(buf);
+  EXPECT_EQ(arena->num_allocs, num_allocs);
+  mem_arena_set_current(NULL);
+
+  EXPECT_FALSE(mem_arena_owns(NULL, grown));
+  mem_arena_destroy(&arena);
+}
+
+TEST(MemArenaTest, TestCurrentArena) {
+  EXPECT_EQ(mem_arena_get_current(), nullptr);
+  mem_arena_t* arena = mem_arena_create(0);
+  mem_arena_set_current(arena);
+  EXPECT_EQ(mem_arena_get_current(), arena);
+  mem_arena_destroy(&arena);
+  EXPECT_EQ(mem_arena_get_current(), nullptr);
+}
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
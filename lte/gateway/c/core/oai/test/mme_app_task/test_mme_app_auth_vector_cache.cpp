@@ -0,0 +1,100 @@
+/**
+ * Copyright 2020 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+#include <string.h>
+
+#include "mme_app_auth_vector_cache.h"
+
+#define IMSI_1 1010000000001
+#define IMSI_2 1010000000002
+#define MAX_UES 2
+#define TTL_SEC 60
+
+class MmeAppAuthVectorCacheTest : public ::testing::Test {
+ protected:
+  virtual void SetUp() {
+    mme_app_auth_vector_cache_init(MAX_UES, TTL_SEC, false);
+    memset(vectors, 0, sizeof(vectors));
+    for (int i = 0; i < MAX_EPS_AUTH_VECTORS_PER_AIR; i++) {
+      vectors[i].rand[0]   = i;
+      vectors[i].xres.size = 8;
+    }
+  }
+
+  eutran_vector_t vectors[MAX_EPS_AUTH_VECTORS_PER_AIR];
+  auth_vector_t vector;
+};
+
+TEST_F(MmeAppAuthVectorCacheTest, TestTakeInOrder) {
+  EXPECT_EQ(
+      mme_app_auth_vector_cache_vectors_per_air(),
+      MAX_EPS_AUTH_VECTORS_PER_AIR);
+  mme_app_auth_vector_cache_put(IMSI_1, vectors, 2);
+
+  EXPECT_TRUE(mme_app_auth_vector_cache_take(IMSI_1, &vector));
+  EXPECT_EQ(vector.rand[0], 0);
+  EXPECT_EQ(vector.xres_size, 8);
+  EXPECT_TRUE(mme_app_auth_vector_cache_take(IMSI_1, &vector));
+  EXPECT_EQ(vector.rand[0], 1);
+  EXPECT_FALSE(mme_app_auth_vector_cache_take(IMSI_1, &vector));
+  EXPECT_FALSE(mme_app_auth_vector_cache_take(IMSI_2, &vector));
+}
+
+TEST_F(MmeAppAuthVectorCacheTest, TestPutReplaces) {
+  mme_app_auth_vector_cache_put(IMSI_1, vectors, 2);
+  // The vectors of a newer AIA have higher SQNs
+  mme_app_auth_vector_cache_put(IMSI_1, &vectors[3], 1);
+
+  EXPECT_TRUE(mme_app_auth_vector_cache_take(IMSI_1, &vector));
+  EXPECT_EQ(vector.rand[0], 3);
+  EXPECT_FALSE(mme_app_auth_vector_cache_take(IMSI_1, &vector));
+
+  mme_app_auth_vector_cache_put(IMSI_1, vectors, 2);
+  mme_app_auth_vector_cache_put(IMSI_1, vectors, 0);
+  EXPECT_FALSE(mme_app_auth_vector_cache_take(IMSI_1, &vector));
+}
+
+TEST_F(MmeAppAuthVectorCacheTest, TestRemove) {
+  mme_app_auth_vector_cache_put(IMSI_1, vectors, 2);
+  mme_app_auth_vector_cache_put(IMSI_2, vectors, 2);
+  mme_app_auth_vector_cache_remove(IMSI_1);
+
+  EXPECT_FALSE(mme_app_auth_vector_cache_take(IMSI_1, &vector));
+  EXPECT_TRUE(mme_app_auth_vector_cache_take(IMSI_2, &vector));
+}
+
+TEST_F(MmeAppAuthVectorCacheTest, TestEvictOldest) {
+  mme_app_auth_vector_cache_put(IMSI_1, vectors, 1);
+  mme_app_auth_vector_cache_put(IMSI_2, vectors, 1);
+  mme_app_auth_vector_cache_put(IMSI_1 + 2, vectors, 1);
+
+  EXPECT_FALSE(mme_app_auth_vector_cache_take(IMSI_1, &vector));
+  EXPECT_TRUE(mme_app_auth_vector_cache_take(IMSI_2, &vector));
+  EXPECT_TRUE(mme_app_auth_vector_cache_take(IMSI_1 + 2, &vector));
+}
+
+TEST_F(MmeAppAuthVectorCacheTest, TestExpiry) {
+  mme_app_auth_vector_cache_init(MAX_UES, 0, false);
+  mme_app_auth_vector_cache_put(IMSI_1, vectors, 2);
+
+  EXPECT_FALSE(mme_app_auth_vector_cache_take(IMSI_1, &vector));
+}
+
+TEST_F(MmeAppAuthVectorCacheTest, TestDisabled) {
+  mme_app_auth_vector_cache_init(0, TTL_SEC, false);
+  mme_app_auth_vector_cache_put(IMSI_1, vectors, 2);
+
+  EXPECT_EQ(
+      mme_app_auth_vector_cache_vectors_per_air(), MAX_EPS_AUTH_VECTORS);
+  EXPECT_FALSE(mme_app_auth_vector_cache_take(IMSI_1, &vector));
+}
@@ -0,0 +1,115 @@
+/**
+ * Copyright 2020 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+#include <string.h>
+
+extern "C" {
+#include "emm_data.h"
+#include "emm_proc.h"
+#include "log.h"
+#include "mme_app_auth_vector_cache.h"
+#include "mme_app_ue_context_pool.h"
+}
+
+#define IMSI_1 1010000000001
+#define UE_ID 7
+#define MAX_UES 16
+#define TTL_SEC 60
+
+// Drives the NAS authentication hooks of the cache on a UE context found
+// by its mme_ue_s1ap_id, with no authentication procedure running
+class NasAuthVectorCacheTest : public ::testing::Test {
+ protected:
+  virtual void SetUp() {
+    mme_app_auth_vector_cache_init(MAX_UES, TTL_SEC, false);
+    mme_app_ue_context_pool_init(MAX_UES);
+    ue_context_p                      = mme_app_ue_context_pool_alloc();
+    ue_context_p->mme_ue_s1ap_id      = UE_ID;
+    ue_context_p->emm_context._imsi64 = IMSI_1;
+    mme_app_ue_context_pool_bind_ue_id(ue_context_p, UE_ID);
+    ue_context_p->emm_context._security.eksi = KSI_NO_KEY_AVAILABLE;
+
+    memset(vectors, 0, sizeof(vectors));
+    for (int i = 0; i < MAX_EPS_AUTH_VECTORS_PER_AIR; i++) {
+      vectors[i].rand[0]   = i;
+      vectors[i].autn[0]   = i;
+      vectors[i].xres.size = 8;
+    }
+  }
+
+  virtual void TearDown() {
+    mme_app_ue_context_pool_free(ue_context_p);
+    mme_app_ue_context_pool_destroy();
+  }
+
+  bool cached() {
+    auth_vector_t vector;
+    return mme_app_auth_vector_cache_take(IMSI_1, &vector);
+  }
+
+  ue_mm_context_t* ue_context_p;
+  eutran_vector_t vectors[MAX_EPS_AUTH_VECTORS_PER_AIR];
+};
+
+TEST_F(NasAuthVectorCacheTest, TestLoadCachedVector) {
+  emm_context_t* emm_ctx = &ue_context_p->emm_context;
+  mme_app_auth_vector_cache_put(IMSI_1, vectors, 2);
+
+  // Without a security context the vector comes with eKSI 0
+  EXPECT_EQ(emm_proc_authentication_load_cached_vector(emm_ctx), 0);
+  EXPECT_TRUE(IS_EMM_CTXT_PRESENT_AUTH_VECTORS(emm_ctx));
+  EXPECT_TRUE(emm_ctx->member_valid_mask & EMM_CTXT_MEMBER_AUTH_VECTOR0);
+  EXPECT_EQ(emm_ctx->_vector[0].rand[0], 0);
+  EXPECT_EQ(emm_ctx->_vector[0].xres_size, 8);
+
+  // Then the next eKSI, wrapping after EKSI_MAX_VALUE
+  emm_ctx->_security.eksi = EKSI_MAX_VALUE;
+  ksi_t eksi = emm_proc_authentication_load_cached_vector(emm_ctx);
+  EXPECT_EQ(eksi, 0);
+  EXPECT_EQ(emm_ctx->_vector[eksi % MAX_EPS_AUTH_VECTORS].rand[0], 1);
+  EXPECT_EQ(emm_ctx->_vector[eksi % MAX_EPS_AUTH_VECTORS].autn[0], 1);
+
+  // Each vector is used once
+  EXPECT_EQ(
+      emm_proc_authentication_load_cached_vector(emm_ctx),
+      KSI_NO_KEY_AVAILABLE);
+  EXPECT_EQ(emm_ctx->_vector[0].rand[0], 1);
+}
+
+TEST_F(NasAuthVectorCacheTest, TestDropOnSynchFailure) {
+  mme_app_auth_vector_cache_put(IMSI_1, vectors, 2);
+  emm_proc_authentication_failure(UE_ID, EMM_CAUSE_SYNCH_FAILURE, NULL);
+
+  EXPECT_FALSE(cached());
+}
+
+TEST_F(NasAuthVectorCacheTest, TestDropOnMacFailure) {
+  mme_app_auth_vector_cache_put(IMSI_1, vectors, 2);
+  emm_proc_authentication_failure(UE_ID, EMM_CAUSE_MAC_FAILURE, NULL);
+
+  EXPECT_FALSE(cached());
+}
+
+TEST_F(NasAuthVectorCacheTest, TestKeptOnOtherFailure) {
+  mme_app_auth_vector_cache_put(IMSI_1, vectors, 2);
+  emm_proc_authentication_failure(
+      UE_ID, EMM_CAUSE_NON_EPS_AUTH_UNACCEPTABLE, NULL);
+
+  EXPECT_TRUE(cached());
+}
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  OAILOG_INIT("MME", OAILOG_LEVEL_DEBUG, MAX_LOG_PROTOS);
+  return RUN_ALL_TESTS();
+}
@@ -14,6 +14,8 @@
 
 extern "C" {
 #include "AttachRequest.h"
+#include "TrackingAreaUpdateRequest.h"
+#include "common_defs.h"
 #include "dynamic_memory_check.h"
 #include "log.h"
 }
@@ -67,6 +69,39 @@ TEST_F(EMMDecodeTest, TestDecodeAttachRequest2) {
   bdestroy_wrapper(&attach_request.esmmessagecontainer);
 }
 
+TEST_F(EMMDecodeTest, TestDecodeAttachRequestTruncatedMandatoryIe) {
+  //   UE network capability with an empty value at the end of the PDU
+  uint8_t buffer[] = {0x72, 0x08, 0x09, 0x10, 0x10, 0x00, 0x00, 0x00,
+                      0x00, 0x10, 0x00};
+  attach_request_msg attach_request;
+
+  int rc = decode_attach_request(&attach_request, buffer, sizeof(buffer));
+  ASSERT_EQ(rc, TLV_MANDATORY_FIELD_NOT_PRESENT);
+
+  //   ESM message container cut after two of its four octets
+  uint8_t buffer2[] = {0x72, 0x08, 0x09, 0x10, 0x10, 0x00, 0x00, 0x00,
+                       0x00, 0x10, 0x02, 0xe0, 0xe0, 0x00, 0x04, 0x02,
+                       0x01};
+  rc = decode_attach_request(&attach_request, buffer2, sizeof(buffer2));
+  ASSERT_EQ(rc, TLV_MANDATORY_FIELD_NOT_PRESENT);
+}
+
+TEST_F(EMMDecodeTest, TestDecodeTrackingAreaUpdateRequestTruncatedGuti) {
+  //   Old GUTI length indicator runs past the end of the PDU
+  uint8_t buffer[] = {0x01, 0x0b, 0xf6, 0x00, 0xf1, 0x10, 0x00, 0x01};
+  tracking_area_update_request_msg tau_request;
+
+  int rc = decode_tracking_area_update_request(
+      &tau_request, buffer, sizeof(buffer));
+  ASSERT_EQ(rc, TLV_MANDATORY_FIELD_NOT_PRESENT);
+
+  //   Old GUTI length indicator shorter than a GUTI
+  buffer[1] = 0x01;
+  rc        = decode_tracking_area_update_request(
+      &tau_request, buffer, sizeof(buffer));
+  ASSERT_EQ(rc, TLV_BUFFER_TOO_SHORT);
+}
+
 int main(int argc, char** argv) {
   ::testing::InitGoogleTest(&argc, argv);
   OAILOG_INIT("MME", OAILOG_LEVEL_DEBUG, MAX_LOG_PROTOS);
@@ -0,0 +1,91 @@
+/**
+ * Copyright 2020 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "mme_app_ip_imsi.h"
+
+#define UE_IP_1 0x0b80a8c0  // 192.168.128.11
+#define UE_IP_2 0x0c80a8c0  // 192.168.128.12
+#define IMSI_1 1010000000001
+#define IMSI_2 1010000000002
+
+class MmeAppIpImsiTest : public ::testing::Test {
+ protected:
+  virtual void SetUp() { initialize_ipv4_map(); }
+
+  imsi64_t imsi_list[MME_APP_MAX_IMSIS_PER_UE_IP];
+};
+
+TEST_F(MmeAppIpImsiTest, TestLookup) {
+  mme_app_insert_ue_ipv4_addr(UE_IP_1, IMSI_1);
+  mme_app_insert_ue_ipv4_addr(UE_IP_2, IMSI_2);
+
+  EXPECT_EQ(
+      mme_app_get_imsi_from_ipv4(
+          UE_IP_1, imsi_list, MME_APP_MAX_IMSIS_PER_UE_IP),
+      1);
+  EXPECT_EQ(imsi_list[0], IMSI_1);
+  EXPECT_EQ(
+      mme_app_get_imsi_from_ipv4(
+          UE_IP_2, imsi_list, MME_APP_MAX_IMSIS_PER_UE_IP),
+      1);
+  EXPECT_EQ(imsi_list[0], IMSI_2);
+  EXPECT_EQ(
+      mme_app_get_imsi_from_ipv4(
+          0x0d80a8c0, imsi_list, MME_APP_MAX_IMSIS_PER_UE_IP),
+      0);
+}
+
+TEST_F(MmeAppIpImsiTest, TestSharedAddress) {
+  mme_app_insert_ue_ipv4_addr(UE_IP_1, IMSI_1);
+  mme_app_insert_ue_ipv4_addr(UE_IP_1, IMSI_2);
+
+  EXPECT_EQ(
+      mme_app_get_imsi_from_ipv4(
+          UE_IP_1, imsi_list, MME_APP_MAX_IMSIS_PER_UE_IP),
+      2);
+  EXPECT_EQ(imsi_list[0], IMSI_1);
+  EXPECT_EQ(imsi_list[1], IMSI_2);
+
+  // Only the first imsis are copied, the count is still the total
+  imsi_list[1] = 0;
+  EXPECT_EQ(mme_app_get_imsi_from_ipv4(UE_IP_1, imsi_list, 1), 2);
+  EXPECT_EQ(imsi_list[0], IMSI_1);
+  EXPECT_EQ(imsi_list[1], 0);
+}
+
+TEST_F(MmeAppIpImsiTest, TestRemove) {
+  mme_app_insert_ue_ipv4_addr(UE_IP_1, IMSI_1);
+  mme_app_insert_ue_ipv4_addr(UE_IP_1, IMSI_2);
+
+  mme_app_remove_ue_ipv4_addr(UE_IP_1, IMSI_1);
+  EXPECT_EQ(
+      mme_app_get_imsi_from_ipv4(
+          UE_IP_1, imsi_list, MME_APP_MAX_IMSIS_PER_UE_IP),
+      1);
+  EXPECT_EQ(imsi_list[0], IMSI_2);
+
+  // Unknown imsi and address are ignored
+  mme_app_remove_ue_ipv4_addr(UE_IP_1, IMSI_1);
+  mme_app_remove_ue_ipv4_addr(UE_IP_2, IMSI_2);
+  EXPECT_EQ(
+      mme_app_get_imsi_from_ipv4(
+          UE_IP_1, imsi_list, MME_APP_MAX_IMSIS_PER_UE_IP),
+      1);
+
+  mme_app_remove_ue_ipv4_addr(UE_IP_1, IMSI_2);
+  EXPECT_EQ(
+      mme_app_get_imsi_from_ipv4(
+          UE_IP_1, imsi_list, MME_APP_MAX_IMSIS_PER_UE_IP),
+      0);
+}
@@ -0,0 +1,133 @@
+/**
+ * Copyright 2020 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include <time.h>
+
+extern "C" {
+#include "mme_app_overload.h"
+}
+
+#define TARGET_DELAY 5000
+#define INTERVAL 100000
+#define ABOVE_TARGET (2 * TARGET_DELAY)
+#define BELOW_TARGET (TARGET_DELAY / 2)
+
+class MmeOverloadTest : public ::testing::Test {
+ protected:
+  virtual void SetUp() {
+    static mme_config_t config;
+    config.enable_congestion_control = true;
+    config.overload_target_delay     = TARGET_DELAY;
+    config.overload_interval         = INTERVAL;
+    mme_overload_init(&config);
+    // The times are relative to now for mme_overload_admit() to see them
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    now = (uint64_t) ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+  }
+
+  uint64_t now;
+};
+
+TEST_F(MmeOverloadTest, TestBurstIsAbsorbed) {
+  mme_overload_observe_at(TASK_S1AP, now - INTERVAL / 2, ABOVE_TARGET);
+  mme_overload_observe_at(TASK_S1AP, now - INTERVAL / 4, ABOVE_TARGET);
+  mme_overload_observe_at(TASK_S1AP, now, BELOW_TARGET);
+  EXPECT_EQ(mme_overload_level_at(now), MME_OVERLOAD_NONE);
+  EXPECT_TRUE(mme_overload_admit(MME_ADMISSION_NEW));
+}
+
+TEST_F(MmeOverloadTest, TestStandingQueueRejectsNew) {
+  mme_overload_observe_at(TASK_MME_APP, now - INTERVAL - 1, ABOVE_TARGET);
+  EXPECT_EQ(mme_overload_level_at(now - INTERVAL - 1), MME_OVERLOAD_NONE);
+  mme_overload_observe_at(TASK_MME_APP, now, ABOVE_TARGET);
+  EXPECT_EQ(mme_overload_level_at(now), MME_OVERLOAD_REJECT_NEW);
+  EXPECT_FALSE(mme_overload_admit(MME_ADMISSION_NEW));
+  EXPECT_TRUE(mme_overload_admit(MME_ADMISSION_ONGOING));
+  EXPECT_TRUE(mme_overload_admit(MME_ADMISSION_PRIORITY));
+}
+
+TEST_F(MmeOverloadTest, TestPersistentQueueShedsOngoing) {
+  mme_overload_observe_at(TASK_S1AP, now - 2 * INTERVAL - 2, ABOVE_TARGET);
+  mme_overload_observe_at(TASK_S1AP, now - INTERVAL - 1, ABOVE_TARGET);
+  mme_overload_observe_at(TASK_S1AP, now, ABOVE_TARGET);
+  EXPECT_EQ(mme_overload_level_at(now), MME_OVERLOAD_SHED_ONGOING);
+  EXPECT_FALSE(mme_overload_admit(MME_ADMISSION_NEW));
+  EXPECT_FALSE(mme_overload_admit(MME_ADMISSION_ONGOING));
+  EXPECT_TRUE(mme_overload_admit(MME_ADMISSION_PRIORITY));
+}
+
+TEST_F(MmeOverloadTest, TestRecoveryStepByStep) {
+  uint64_t t = now - 5 * INTERVAL;
+
+  mme_overload_observe_at(TASK_S1AP, t, ABOVE_TARGET);
+  mme_overload_observe_at(TASK_S1AP, t + INTERVAL, ABOVE_TARGET);
+  mme_overload_observe_at(TASK_S1AP, t + 2 * INTERVAL, ABOVE_TARGET);
+  EXPECT_EQ(
+      mme_overload_level_at(t + 2 * INTERVAL), MME_OVERLOAD_SHED_ONGOING);
+
+  // A single message below target does not end the overload
+  mme_overload_observe_at(TASK_S1AP, t + 3 * INTERVAL, BELOW_TARGET);
+  EXPECT_EQ(
+      mme_overload_level_at(t + 3 * INTERVAL), MME_OVERLOAD_SHED_ONGOING);
+  mme_overload_observe_at(TASK_S1AP, t + 4 * INTERVAL, BELOW_TARGET);
+  EXPECT_EQ(mme_overload_level_at(t + 4 * INTERVAL), MME_OVERLOAD_REJECT_NEW);
+  mme_overload_observe_at(TASK_S1AP, now, BELOW_TARGET);
+  EXPECT_EQ(mme_overload_level_at(now), MME_OVERLOAD_NONE);
+  EXPECT_TRUE(mme_overload_admit(MME_ADMISSION_NEW));
+}
+
+TEST_F(MmeOverloadTest, TestIdleTaskIsNotOverloaded) {
+  uint64_t t = now - 3 * INTERVAL;
+
+  mme_overload_observe_at(TASK_MME_APP, t, ABOVE_TARGET);
+  mme_overload_observe_at(TASK_MME_APP, t + INTERVAL, ABOVE_TARGET);
+  EXPECT_EQ(mme_overload_level_at(t + INTERVAL), MME_OVERLOAD_REJECT_NEW);
+  EXPECT_EQ(mme_overload_level_at(now), MME_OVERLOAD_NONE);
+  EXPECT_TRUE(mme_overload_admit(MME_ADMISSION_NEW));
+
+  // The backlog has to build up again
+  mme_overload_observe_at(TASK_MME_APP, now, ABOVE_TARGET);
+  EXPECT_EQ(mme_overload_level_at(now), MME_OVERLOAD_NONE);
+}
+
+TEST_F(MmeOverloadTest, TestHighestTaskLevel) {
+  mme_overload_observe_at(TASK_S1AP, now - INTERVAL, ABOVE_TARGET);
+  mme_overload_observe_at(TASK_S1AP, now, ABOVE_TARGET);
+  mme_overload_observe_at(TASK_MME_APP, now - INTERVAL, BELOW_TARGET);
+  mme_overload_observe_at(TASK_MME_APP, now, BELOW_TARGET);
+  EXPECT_EQ(mme_overload_level_at(now), MME_OVERLOAD_REJECT_NEW);
+}
+
+TEST_F(MmeOverloadTest, TestSmoothedDelay) {
+  for (int i = 0; i < 100; i++) {
+    mme_overload_observe_at(TASK_S1AP, now - 100 + i, ABOVE_TARGET);
+  }
+  EXPECT_GT(mme_overload_smoothed_delay(TASK_S1AP), TARGET_DELAY);
+  EXPECT_LE(mme_overload_smoothed_delay(TASK_S1AP), ABOVE_TARGET);
+  EXPECT_EQ(mme_overload_smoothed_delay(TASK_MME_APP), 0);
+}
+
+TEST_F(MmeOverloadTest, TestDisabled) {
+  static mme_config_t config;
+  config.enable_congestion_control = false;
+  config.overload_target_delay     = TARGET_DELAY;
+  config.overload_interval         = INTERVAL;
+  mme_overload_init(&config);
+
+  mme_overload_observe(TASK_S1AP, ABOVE_TARGET);
+  EXPECT_EQ(mme_overload_smoothed_delay(TASK_S1AP), 0);
+  EXPECT_EQ(mme_overload_level(), MME_OVERLOAD_NONE);
+  EXPECT_TRUE(mme_overload_admit(MME_ADMISSION_NEW));
+}
@@ -0,0 +1,262 @@
+/**
+ * Copyright 2020 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+extern "C" {
+#include "log.h"
+#include "mme_app_shard.h"
+}
+
+#define NUM_SHARDS 4
+#define NUM_UES 16
+#define MESSAGES_PER_UE 200
+// One message of a UE in EXCLUSIVE_EVERY is handled under the exclusive lock
+#define EXCLUSIVE_EVERY 10
+
+#define IS_UE_LOCAL(pdu) mme_app_shard_nas_is_ue_local(pdu, sizeof(pdu))
+
+TEST(MmeAppShardTest, TestPlainEmmMessages) {
+  const uint8_t attach_request[]    = {0x07, 0x41, 0x71, 0x08, 0x09};
+  const uint8_t identity_response[] = {0x07, 0x56, 0x08, 0x09, 0x10};
+  const uint8_t auth_response[]     = {0x07, 0x53, 0x08, 0x01, 0x02};
+  const uint8_t auth_failure[]      = {0x07, 0x5c, 0x15};
+
+  EXPECT_FALSE(IS_UE_LOCAL(attach_request));
+  EXPECT_FALSE(IS_UE_LOCAL(identity_response));
+  EXPECT_TRUE(IS_UE_LOCAL(auth_response));
+  EXPECT_TRUE(IS_UE_LOCAL(auth_failure));
+}
+
+TEST(MmeAppShardTest, TestIntegrityProtectedMessages) {
+  // Security header, MAC and sequence number, then the plain message
+  const uint8_t attach_complete[] = {0x17, 0x11, 0x22, 0x33, 0x44, 0x01,
+                                     0x07, 0x43, 0x00, 0x03};
+  const uint8_t detach_request[]  = {0x17, 0x11, 0x22, 0x33, 0x44, 0x02,
+                                     0x07, 0x45, 0x09, 0x0b};
+  const uint8_t tau_request[]     = {0x37, 0x11, 0x22, 0x33, 0x44, 0x00,
+                                     0x07, 0x48, 0x01, 0x0b};
+
+  EXPECT_TRUE(IS_UE_LOCAL(attach_complete));
+  EXPECT_FALSE(IS_UE_LOCAL(detach_request));
+  EXPECT_FALSE(IS_UE_LOCAL(tau_request));
+}
+
+TEST(MmeAppShardTest, TestCipheredMessages) {
+  const uint8_t smc_complete[]    = {0x47, 0x11, 0x22, 0x33, 0x44, 0x00, 0xa5};
+  const uint8_t ciphered[]        = {0x27, 0x11, 0x22, 0x33, 0x44, 0x05, 0xa5};
+  const uint8_t service_request[] = {0xc7, 0x01, 0x11, 0x22};
+
+  EXPECT_TRUE(IS_UE_LOCAL(smc_complete));
+  EXPECT_FALSE(IS_UE_LOCAL(ciphered));
+  EXPECT_FALSE(IS_UE_LOCAL(service_request));
+}
+
+TEST(MmeAppShardTest, TestEsmMessages) {
+  const uint8_t pdn_connectivity_request[] = {0x02, 0x01, 0xd0, 0x11};
+
+  EXPECT_TRUE(IS_UE_LOCAL(pdn_connectivity_request));
+}
+
+TEST(MmeAppShardTest, TestTruncatedMessages) {
+  const uint8_t empty[]            = {0x07};
+  const uint8_t truncated_header[] = {0x17, 0x11, 0x22, 0x33, 0x44, 0x01};
+
+  EXPECT_FALSE(IS_UE_LOCAL(empty));
+  EXPECT_FALSE(IS_UE_LOCAL(truncated_header));
+  EXPECT_FALSE(mme_app_shard_nas_is_ue_local(NULL, 0));
+}
+
+TEST(MmeAppShardTest, TestSingleShardTimerIds) {
+  EXPECT_EQ(mme_app_shard_count(), 1u);
+  EXPECT_EQ(mme_app_shard_timer_id(42), 42);
+  EXPECT_EQ(mme_app_shard_zloop_timer_id(42), 42);
+  EXPECT_TRUE(mme_app_shard_owns_timer(42));
+}
+
+// What the shards handled by UE, mme_ue_s1ap_id - 1. The sequence number of
+// the messages of a UE is carried in the instance of their header.
+static struct {
+  std::mutex mutex;
+  std::condition_variable cv;
+  int num_handled;
+  std::vector<int> seqs[NUM_UES];
+  task_zmq_ctx_t* task_ctxs[NUM_UES];
+  int resets_off_shard_0;
+} handled;
+static std::atomic<int> running_shared(0);
+static std::atomic<int> running_exclusive(0);
+static std::atomic<int> overlaps(0);
+static std::atomic<int> bad_timer_ids(0);
+
+static void handle_message(MessageDef* message_p) {
+  mme_ue_s1ap_id_t ue_id = INVALID_MME_UE_S1AP_ID;
+  bool exclusive         = true;
+
+  switch (ITTI_MSG_ID(message_p)) {
+    case MME_APP_INITIAL_CONTEXT_SETUP_RSP:
+      ue_id     = MME_APP_INITIAL_CONTEXT_SETUP_RSP(message_p).ue_id;
+      exclusive = false;
+      break;
+    case S1AP_UE_CONTEXT_RELEASE_REQ:
+      ue_id = S1AP_UE_CONTEXT_RELEASE_REQ(message_p).mme_ue_s1ap_id;
+      break;
+    default:
+      break;
+  }
+  if (exclusive) {
+    if (running_exclusive++ || running_shared) {
+      overlaps++;
+    }
+  } else {
+    running_shared++;
+    if (running_exclusive) {
+      overlaps++;
+    }
+  }
+  // Gives the other shards a chance to run meanwhile
+  usleep(10);
+
+  // The timers started by the shard of a UE come back to it
+  int timer_id = mme_app_shard_timer_id(5);
+  if ((ue_id && timer_id % NUM_SHARDS != ue_id % NUM_SHARDS) ||
+      !mme_app_shard_owns_timer(timer_id) ||
+      mme_app_shard_zloop_timer_id(timer_id) != 5) {
+    bad_timer_ids++;
+  }
+  if (exclusive) {
+    running_exclusive--;
+  } else {
+    running_shared--;
+  }
+
+  std::lock_guard<std::mutex> lock(handled.mutex);
+  if (ue_id) {
+    handled.seqs[ue_id - 1].push_back(message_p->ittiMsgHeader.instance);
+    handled.task_ctxs[ue_id - 1] = mme_app_shard_task_ctx();
+  } else if (mme_app_shard_timer_id(0) != 0) {
+    handled.resets_off_shard_0++;
+  }
+  handled.num_handled++;
+  handled.cv.notify_one();
+  free(message_p);
+}
+
+static MessageDef* ue_message(mme_ue_s1ap_id_t ue_id, int seq) {
+  MessageDef* message_p = (MessageDef*) calloc(1, sizeof(MessageDef));
+  message_p->ittiMsgHeader.instance = seq;
+  if (seq % EXCLUSIVE_EVERY == EXCLUSIVE_EVERY - 1) {
+    message_p->ittiMsgHeader.messageId = S1AP_UE_CONTEXT_RELEASE_REQ;
+    S1AP_UE_CONTEXT_RELEASE_REQ(message_p).mme_ue_s1ap_id = ue_id;
+  } else {
+    message_p->ittiMsgHeader.messageId = MME_APP_INITIAL_CONTEXT_SETUP_RSP;
+    MME_APP_INITIAL_CONTEXT_SETUP_RSP(message_p).ue_id = ue_id;
+  }
+  return message_p;
+}
+
+TEST(MmeAppShardTest, TestDispatch) {
+  const int num_resets   = 10;
+  const int num_messages = NUM_UES * MESSAGES_PER_UE + num_resets;
+  ASSERT_EQ(mme_app_shard_init(NUM_SHARDS, handle_message), RETURNok);
+  EXPECT_EQ(mme_app_shard_count(), (uint32_t) NUM_SHARDS);
+
+  // The messages of the UEs are interleaved, with a few resets of no UE
+  for (int seq = 0; seq < MESSAGES_PER_UE; seq++) {
+    for (int ue = 0; ue < NUM_UES; ue++) {
+      mme_app_shard_dispatch(ue_message(ue + 1, seq));
+    }
+    if (seq % (MESSAGES_PER_UE / num_resets) == 0) {
+      MessageDef* message_p = (MessageDef*) calloc(1, sizeof(MessageDef));
+      message_p->ittiMsgHeader.messageId = S1AP_ENB_INITIATED_RESET_REQ;
+      mme_app_shard_dispatch(message_p);
+    }
+  }
+  {
+    std::unique_lock<std::mutex> lock(handled.mutex);
+    ASSERT_TRUE(handled.cv.wait_for(lock, std::chrono::seconds(30), [&]() {
+      return handled.num_handled == num_messages;
+    }));
+  }
+  mme_app_shard_exit();
+  EXPECT_EQ(mme_app_shard_count(), 1u);
+
+  EXPECT_EQ(overlaps, 0);
+  EXPECT_EQ(bad_timer_ids, 0);
+  EXPECT_EQ(handled.resets_off_shard_0, 0);
+  for (int ue = 0; ue < NUM_UES; ue++) {
+    // In order, on the shard of the UE
+    std::vector<int>& seqs = handled.seqs[ue];
+    ASSERT_EQ(seqs.size(), (size_t) MESSAGES_PER_UE);
+    for (int seq = 0; seq < MESSAGES_PER_UE; seq++) {
+      EXPECT_EQ(seqs[seq], seq) << "UE " << ue + 1;
+    }
+    for (int other = 0; other < ue; other++) {
+      EXPECT_EQ(
+          handled.task_ctxs[ue] == handled.task_ctxs[other],
+          ue % NUM_SHARDS == other % NUM_SHARDS);
+    }
+  }
+}
+
+static std::atomic<bool> shared_started(false);
+static std::atomic<bool> exclusive_done(false);
+static std::atomic<bool> exclusive_ran_meanwhile(false);
+
+static void wait_for_exclusive(void) {
+  for (int i = 0; i < 1000 && !exclusive_done; i++) {
+    usleep(1000);
+  }
+  exclusive_ran_meanwhile = exclusive_done.load();
+}
+
+static void handle_unlocking_message(MessageDef* message_p) {
+  if (ITTI_MSG_ID(message_p) == MME_APP_INITIAL_CONTEXT_SETUP_RSP) {
+    shared_started = true;
+    mme_app_shard_run_unlocked(wait_for_exclusive);
+  } else {
+    exclusive_done = true;
+  }
+  free(message_p);
+}
+
+TEST(MmeAppShardTest, TestRunUnlocked) {
+  ASSERT_EQ(
+      mme_app_shard_init(NUM_SHARDS, handle_unlocking_message), RETURNok);
+  mme_app_shard_dispatch(ue_message(1, 0));
+  while (!shared_started) {
+    usleep(100);
+  }
+  // Only runs once the shared message released its lock
+  MessageDef* message_p = (MessageDef*) calloc(1, sizeof(MessageDef));
+  message_p->ittiMsgHeader.messageId = S1AP_ENB_INITIATED_RESET_REQ;
+  mme_app_shard_dispatch(message_p);
+  for (int i = 0; i < 2000 && !exclusive_ran_meanwhile; i++) {
+    usleep(1000);
+  }
+  mme_app_shard_exit();
+  EXPECT_TRUE(exclusive_ran_meanwhile);
+}
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  OAILOG_INIT("MME", OAILOG_LEVEL_DEBUG, MAX_LOG_PROTOS);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,171 @@
+/**
+ * Copyright 2020 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+extern "C" {
+#include "mme_app_ue_context_pool.h"
+}
+
+class UeContextPoolTest : public ::testing::Test {
+ protected:
+  virtual void SetUp() { mme_app_ue_context_pool_init(num_ues); }
+  virtual void TearDown() { mme_app_ue_context_pool_destroy(); }
+
+  static const uint32_t num_ues = 1000;
+};
+
+static bool count_ues(ue_mm_context_t* ue_context_p, void* arg) {
+  (*(uint32_t*) arg)++;
+  return false;
+}
+
+TEST_F(UeContextPoolTest, TestAllocFree) {
+  std::vector<ue_mm_context_t*> ue_contexts;
+  for (uint32_t i = 0; i < 3 * MME_APP_UE_CONTEXT_POOL_CHUNK_SIZE; i++) {
+    ue_mm_context_t* ue_context_p = mme_app_ue_context_pool_alloc();
+    ASSERT_NE(ue_context_p, nullptr);
+    EXPECT_EQ(ue_context_p->mme_ue_s1ap_id, 0u);
+    ue_context_p->mme_ue_s1ap_id = i + 1;
+    ue_contexts.push_back(ue_context_p);
+  }
+  EXPECT_EQ(mme_app_ue_context_pool_size(), ue_contexts.size());
+
+  // Growing the pool does not move contexts already handed out
+  for (uint32_t i = 0; i < ue_contexts.size(); i++) {
+    EXPECT_EQ(ue_contexts[i]->mme_ue_s1ap_id, i + 1);
+  }
+
+  // Freed slots are recycled before the pool grows again
+  ue_mm_context_t* freed = ue_contexts[10];
+  mme_app_ue_context_pool_free(freed);
+  EXPECT_EQ(mme_app_ue_context_pool_alloc(), freed);
+  EXPECT_EQ(freed->mme_ue_s1ap_id, 0u);
+
+  for (auto* ue_context_p : ue_contexts) {
+    mme_app_ue_context_pool_free(ue_context_p);
+  }
+  EXPECT_EQ(mme_app_ue_context_pool_size(), 0u);
+}
+
+TEST_F(UeContextPoolTest, TestStaleHandle) {
+  ue_mm_context_t* ue_context_p = mme_app_ue_context_pool_alloc();
+  mme_app_ue_context_handle_t handle =
+      mme_app_ue_context_pool_get_handle(ue_context_p);
+  ASSERT_NE(handle, INVALID_MME_APP_UE_CONTEXT_HANDLE);
+  EXPECT_EQ(mme_app_ue_context_pool_get_by_handle(handle), ue_context_p);
+
+  // The slot is reused by the next allocation, the old handle must not see it
+  mme_app_ue_context_pool_free(ue_context_p);
+  EXPECT_EQ(mme_app_ue_context_pool_get_by_handle(handle), nullptr);
+  ue_mm_context_t* reused = mme_app_ue_context_pool_alloc();
+  ASSERT_EQ(reused, ue_context_p);
+  EXPECT_EQ(mme_app_ue_context_pool_get_by_handle(handle), nullptr);
+  EXPECT_NE(mme_app_ue_context_pool_get_handle(reused), handle);
+  mme_app_ue_context_pool_free(reused);
+
+  // Contexts that were not allocated from the pool have no handle
+  ue_mm_context_t* foreign =
+      (ue_mm_context_t*) calloc(1, sizeof(ue_mm_context_t));
+  EXPECT_EQ(
+      mme_app_ue_context_pool_get_handle(foreign),
+      INVALID_MME_APP_UE_CONTEXT_HANDLE);
+  mme_app_ue_context_pool_free(foreign);
+
+  // Nor have copies of pooled contexts
+  ue_context_p = mme_app_ue_context_pool_alloc();
+  foreign      = (ue_mm_context_t*) malloc(sizeof(ue_mm_context_t));
+  memcpy(foreign, ue_context_p, sizeof(ue_mm_context_t));
+  EXPECT_EQ(
+      mme_app_ue_context_pool_get_handle(foreign),
+      INVALID_MME_APP_UE_CONTEXT_HANDLE);
+  mme_app_ue_context_pool_free(foreign);
+  EXPECT_EQ(mme_app_ue_context_pool_size(), 1u);
+  mme_app_ue_context_pool_free(ue_context_p);
+  EXPECT_EQ(mme_app_ue_context_pool_size(), 0u);
+}
+
+TEST_F(UeContextPoolTest, TestLookupByUeId) {
+  std::vector<ue_mm_context_t*> ue_contexts;
+  for (mme_ue_s1ap_id_t ue_id = 1; ue_id <= num_ues; ue_id++) {
+    ue_mm_context_t* ue_context_p = mme_app_ue_context_pool_alloc();
+    ue_context_p->mme_ue_s1ap_id  = ue_id;
+    mme_app_ue_context_pool_bind_ue_id(ue_context_p, ue_id);
+    ue_contexts.push_back(ue_context_p);
+  }
+  for (mme_ue_s1ap_id_t ue_id = 1; ue_id <= num_ues; ue_id++) {
+    EXPECT_EQ(
+        mme_app_ue_context_pool_get_by_ue_id(ue_id), ue_contexts[ue_id - 1]);
+  }
+  EXPECT_EQ(mme_app_ue_context_pool_get_by_ue_id(num_ues + 1), nullptr);
+
+  // A context renumbered by the MME is no longer found under its old id
+  ue_contexts[0]->mme_ue_s1ap_id = num_ues + 1;
+  mme_app_ue_context_pool_bind_ue_id(ue_contexts[0], num_ues + 1);
+  EXPECT_EQ(mme_app_ue_context_pool_get_by_ue_id(1), nullptr);
+  EXPECT_EQ(
+      mme_app_ue_context_pool_get_by_ue_id(num_ues + 1), ue_contexts[0]);
+
+  // Released contexts are no longer found, even before their slot is reused
+  mme_app_ue_context_pool_free(ue_contexts[1]);
+  EXPECT_EQ(mme_app_ue_context_pool_get_by_ue_id(2), nullptr);
+  ue_mm_context_t* reused = mme_app_ue_context_pool_alloc();
+  EXPECT_EQ(mme_app_ue_context_pool_get_by_ue_id(2), nullptr);
+  mme_app_ue_context_pool_free(reused);
+
+  // Dense iteration only visits contexts in use
+  uint32_t num_visited = 0;
+  EXPECT_EQ(
+      mme_app_ue_context_pool_apply(count_ues, &num_visited), num_ues - 1);
+  EXPECT_EQ(num_visited, num_ues - 1);
+
+  for (uint32_t i = 0; i < ue_contexts.size(); i++) {
+    if (i != 1) {
+      mme_app_ue_context_pool_free(ue_contexts[i]);
+    }
+  }
+}
+
+TEST_F(UeContextPoolTest, TestUeIdCollision) {
+  // Ids a power of two apart end up sharing an index entry once the stride
+  // reaches the index size: the latest binding wins and callers have to find
+  // the other context through the mme_ue_s1ap_id hashtable
+  const mme_ue_s1ap_id_t first_id = 5;
+  ue_mm_context_t* ue_context_p   = mme_app_ue_context_pool_alloc();
+  ue_context_p->mme_ue_s1ap_id    = first_id;
+  bool evicted                    = false;
+
+  for (uint32_t stride = 1; stride && !evicted; stride <<= 1) {
+    mme_app_ue_context_pool_bind_ue_id(ue_context_p, first_id);
+    ASSERT_EQ(mme_app_ue_context_pool_get_by_ue_id(first_id), ue_context_p);
+
+    ue_mm_context_t* other_p = mme_app_ue_context_pool_alloc();
+    other_p->mme_ue_s1ap_id  = first_id + stride;
+    mme_app_ue_context_pool_bind_ue_id(other_p, first_id + stride);
+    EXPECT_EQ(
+        mme_app_ue_context_pool_get_by_ue_id(first_id + stride), other_p);
+
+    evicted = (mme_app_ue_context_pool_get_by_ue_id(first_id) == nullptr);
+    mme_app_ue_context_pool_free(other_p);
+  }
+  EXPECT_TRUE(evicted);
+  mme_app_ue_context_pool_free(ue_context_p);
+}
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
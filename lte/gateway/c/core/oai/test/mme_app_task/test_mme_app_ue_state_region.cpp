@@ -0,0 +1,393 @@
+/**
+ * Copyright 2020 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ue_state_region.h"
+#include "state_manager.h"
+#include "lte/protos/oai/mme_nas_state.pb.h"
+
+using magma::lte::RedisClient;
+using magma::lte::StateManager;
+using magma::lte::UeStateRegion;
+using magma::lte::oai::UeContext;
+
+#define IMSI_1 "001010000000001"
+#define IMSI_2 "001010000000002"
+#define NUM_SLOTS 8
+#define RECORD_SIZE 4096
+
+class UeStateRegionTest : public ::testing::Test {
+ protected:
+  virtual void SetUp() {
+    char dir[] = "/tmp/ue_state_region_XXXXXX";
+    ASSERT_NE(mkdtemp(dir), nullptr);
+    path = std::string(dir) + "/MME.ue_state";
+  }
+
+  virtual void TearDown() {
+    unlink(path.c_str());
+    rmdir(path.substr(0, path.rfind('/')).c_str());
+  }
+
+  // Makes the slot header of imsi look like a crash interrupted its write.
+  // The sequence number is the first field of the header, 32 bytes before
+  // the IMSI (see SlotHeader in ue_state_region.cpp).
+  void tear_slot(const char* imsi) {
+    int fd = open(path.c_str(), O_RDWR);
+    ASSERT_GE(fd, 0);
+    struct stat st;
+    ASSERT_EQ(fstat(fd, &st), 0);
+    void* base =
+        mmap(nullptr, st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ASSERT_NE(base, MAP_FAILED);
+    uint8_t* found = (uint8_t*) memmem(base, st.st_size, imsi, strlen(imsi));
+    ASSERT_NE(found, nullptr);
+    uint32_t* seq = (uint32_t*) (found - 32);
+    *seq |= 1;
+    munmap(base, st.st_size);
+    close(fd);
+  }
+
+  std::string path;
+  std::string record;
+  uint64_t version = 0;
+};
+
+// The UE state region helpers do not convert any state
+struct TestStateConverter {
+  static void proto_to_state(const UeContext&, int*) {}
+  static void state_to_proto(const int*, UeContext*) {}
+  static void proto_to_ue(const UeContext&, int*) {}
+  static void ue_to_proto(const int*, UeContext*) {}
+};
+
+// Only exercises the UE state region helpers, redis is not connected
+class TestStateManager : public StateManager<
+                             int, int, UeContext, UeContext,
+                             TestStateConverter> {
+ public:
+  explicit TestStateManager(const std::string& dir) {
+    redis_client          = std::make_unique<RedisClient>(false);
+    persist_state_enabled = true;
+    task_name             = "MME";
+    log_task              = LOG_MME_APP;
+    open_ue_state_region(dir.c_str(), NUM_SLOTS / 2);
+  }
+
+  using StateManager::read_ue_protos_from_region;
+  using StateManager::run_restore_workers;
+
+  void create_state() override {}
+  void free_state() override {}
+
+  UeStateRegion* region() { return ue_state_region.get(); }
+  uint64_t version_of(const std::string& imsi) {
+    return ue_state_version[imsi];
+  }
+};
+
+TEST_F(UeStateRegionTest, TestReadWrite) {
+  UeStateRegion region(path, NUM_SLOTS, RECORD_SIZE);
+  ASSERT_TRUE(region.open());
+
+  region.write(IMSI_1, "first", 3);
+  region.write(IMSI_2, "second", 7);
+  EXPECT_EQ(region.size(), 2);
+  EXPECT_EQ(
+      region.read(IMSI_1, &record, &version),
+      UeStateRegion::ReadResult::FOUND);
+  EXPECT_EQ(record, "first");
+  EXPECT_EQ(version, 3);
+
+  // Records too large for their slot are only in redis
+  region.write(IMSI_1, std::string(RECORD_SIZE + 1, 'x'), 4);
+  EXPECT_EQ(
+      region.read(IMSI_1, &record, &version),
+      UeStateRegion::ReadResult::SPILLED);
+  EXPECT_EQ(version, 4);
+  EXPECT_EQ(region.size(), 2);
+
+  region.remove(IMSI_1);
+  EXPECT_EQ(
+      region.read(IMSI_1, &record, &version),
+      UeStateRegion::ReadResult::NOT_FOUND);
+  EXPECT_EQ(
+      region.read(IMSI_2, &record, &version),
+      UeStateRegion::ReadResult::FOUND);
+  EXPECT_EQ(record, "second");
+  EXPECT_EQ(region.size(), 1);
+}
+
+TEST_F(UeStateRegionTest, TestReopen) {
+  {
+    UeStateRegion region(path, NUM_SLOTS, RECORD_SIZE);
+    ASSERT_TRUE(region.open());
+    region.write(IMSI_1, "first", 3);
+  }
+  UeStateRegion region(path, NUM_SLOTS, RECORD_SIZE);
+  ASSERT_TRUE(region.open());
+  EXPECT_EQ(region.size(), 1);
+  EXPECT_EQ(
+      region.read(IMSI_1, &record, &version),
+      UeStateRegion::ReadResult::FOUND);
+  EXPECT_EQ(record, "first");
+  EXPECT_EQ(version, 3);
+}
+
+TEST_F(UeStateRegionTest, TestReopenOtherLayout) {
+  {
+    UeStateRegion region(path, NUM_SLOTS, RECORD_SIZE);
+    ASSERT_TRUE(region.open());
+    region.write(IMSI_1, "first", 3);
+  }
+  UeStateRegion region(path, 2 * NUM_SLOTS, RECORD_SIZE);
+  ASSERT_TRUE(region.open());
+  EXPECT_EQ(region.size(), 0);
+  EXPECT_EQ(
+      region.read(IMSI_1, &record, &version),
+      UeStateRegion::ReadResult::NOT_FOUND);
+}
+
+TEST_F(UeStateRegionTest, TestFull) {
+  UeStateRegion region(path, NUM_SLOTS, RECORD_SIZE);
+  ASSERT_TRUE(region.open());
+
+  for (int i = 0; i < NUM_SLOTS + 2; i++) {
+    region.write(std::to_string(1010000000000 + i), "record", i);
+  }
+  EXPECT_EQ(region.size(), NUM_SLOTS);
+
+  // The slots left as tombstones are reused
+  for (int i = 0; i < NUM_SLOTS + 2; i++) {
+    region.remove(std::to_string(1010000000000 + i));
+  }
+  EXPECT_EQ(region.size(), 0);
+  region.write(IMSI_1, "first", 3);
+  EXPECT_EQ(
+      region.read(IMSI_1, &record, &version),
+      UeStateRegion::ReadResult::FOUND);
+  // Records were lost while it was full
+  EXPECT_FALSE(region.holds_all_records());
+  region.clear();
+  EXPECT_TRUE(region.holds_all_records());
+  EXPECT_EQ(region.size(), 0);
+}
+
+TEST_F(UeStateRegionTest, TestTornSlot) {
+  {
+    UeStateRegion region(path, NUM_SLOTS, RECORD_SIZE);
+    ASSERT_TRUE(region.open());
+    region.write(IMSI_1, "first", 3);
+    region.write(IMSI_2, "second", 7);
+  }
+  tear_slot(IMSI_1);
+
+  UeStateRegion region(path, NUM_SLOTS, RECORD_SIZE);
+  ASSERT_TRUE(region.open());
+  // The torn record is taken from redis, the other one is intact
+  EXPECT_EQ(region.size(), 2);
+  EXPECT_EQ(
+      region.read(IMSI_1, &record, &version),
+      UeStateRegion::ReadResult::SPILLED);
+  EXPECT_EQ(
+      region.read(IMSI_2, &record, &version),
+      UeStateRegion::ReadResult::FOUND);
+  EXPECT_EQ(record, "second");
+  EXPECT_FALSE(region.holds_all_records());
+
+  // Written again, the slot is whole
+  region.write(IMSI_1, "first", 4);
+  EXPECT_EQ(
+      region.read(IMSI_1, &record, &version),
+      UeStateRegion::ReadResult::FOUND);
+  EXPECT_EQ(record, "first");
+  EXPECT_TRUE(region.holds_all_records());
+}
+
+TEST_F(UeStateRegionTest, TestForEach) {
+  UeStateRegion region(path, NUM_SLOTS, RECORD_SIZE);
+  ASSERT_TRUE(region.open());
+  region.write(IMSI_1, "first", 3);
+  region.write(IMSI_2, "second", 7);
+
+  std::map<std::string, std::string> records;
+  region.for_each([&](const std::string& imsi, const std::string& record) {
+    records[imsi] = record;
+    return false;
+  });
+  EXPECT_EQ(
+      records, (std::map<std::string, std::string>{{IMSI_1, "first"},
+                                                   {IMSI_2, "second"}}));
+
+  int visited = 0;
+  region.for_each([&](const std::string&, const std::string&) {
+    visited++;
+    return true;
+  });
+  EXPECT_EQ(visited, 1);
+}
+
+TEST_F(UeStateRegionTest, TestConcurrentReads) {
+  UeStateRegion region(path, NUM_SLOTS, RECORD_SIZE);
+  ASSERT_TRUE(region.open());
+  region.write(IMSI_1, "a", 0);
+
+  // Record i is made of 1 + i % 1000 times the letter of i
+  std::atomic<bool> done(false);
+  std::atomic<int> torn(0);
+  std::vector<std::thread> readers;
+  for (int r = 0; r < 2; r++) {
+    readers.emplace_back([&]() {
+      std::string copy;
+      uint64_t copy_version = 0;
+      while (!done) {
+        if (region.read(IMSI_1, &copy, &copy_version) !=
+                UeStateRegion::ReadResult::FOUND ||
+            copy != std::string(
+                        1 + copy_version % 1000, 'a' + copy_version % 26)) {
+          torn++;
+        }
+      }
+    });
+  }
+  for (uint64_t i = 1; i < 20000; i++) {
+    region.write(IMSI_1, std::string(1 + i % 1000, 'a' + i % 26), i);
+  }
+  done = true;
+  for (auto& reader : readers) {
+    reader.join();
+  }
+  EXPECT_EQ(torn, 0);
+}
+
+TEST_F(UeStateRegionTest, TestConcurrentWrites) {
+  UeStateRegion region(path, NUM_SLOTS, RECORD_SIZE);
+  ASSERT_TRUE(region.open());
+
+  // Like the MME_APP shards, each writer persists its own UEs
+  const int num_writers = NUM_SLOTS / 2;
+  std::vector<std::thread> writers;
+  for (int w = 0; w < num_writers; w++) {
+    writers.emplace_back([&region, w]() {
+      std::string imsi = "00101000000000" + std::to_string(w);
+      for (uint64_t i = 1; i <= 2000; i++) {
+        if (i % 10 == 0) {
+          region.remove(imsi);
+        } else {
+          region.write(imsi, std::string(1 + i % 100, 'a' + w), i);
+        }
+      }
+    });
+  }
+  for (auto& writer : writers) {
+    writer.join();
+  }
+
+  EXPECT_EQ(region.size(), 0);
+  EXPECT_TRUE(region.holds_all_records());
+  for (int w = 0; w < num_writers; w++) {
+    std::string imsi = "00101000000000" + std::to_string(w);
+    region.write(imsi, std::string(1, 'a' + w), w);
+  }
+  for (int w = 0; w < num_writers; w++) {
+    std::string imsi = "00101000000000" + std::to_string(w);
+    ASSERT_EQ(
+        region.read(imsi, &record, &version),
+        UeStateRegion::ReadResult::FOUND);
+    EXPECT_EQ(record, std::string(1, 'a' + w));
+    EXPECT_EQ(version, (uint64_t) w);
+  }
+  EXPECT_EQ(region.size(), num_writers);
+}
+
+TEST_F(UeStateRegionTest, TestStateManagerRegion) {
+  std::string dir = path.substr(0, path.rfind('/'));
+  TestStateManager manager(dir);
+  ASSERT_NE(manager.region(), nullptr);
+  std::vector<std::string> keys = {"IMSI" IMSI_1 ":MME",
+                                   "IMSI" IMSI_2 ":MME"};
+  std::vector<UeContext> ue_protos;
+  std::string proto_str;
+  UeContext ue;
+
+  ue.set_mme_ue_s1ap_id(1);
+  ue.SerializeToString(&proto_str);
+  manager.region()->write(IMSI_1, proto_str, 5);
+  // Missing from the region, the UE state is read from redis
+  EXPECT_EQ(manager.read_ue_protos_from_region(keys, ue_protos), RETURNerror);
+
+  ue.set_mme_ue_s1ap_id(2);
+  ue.SerializeToString(&proto_str);
+  manager.region()->write(IMSI_2, proto_str, 9);
+  ASSERT_EQ(manager.read_ue_protos_from_region(keys, ue_protos), RETURNok);
+  ASSERT_EQ(ue_protos.size(), 2);
+  EXPECT_EQ(ue_protos[0].mme_ue_s1ap_id(), 1);
+  EXPECT_EQ(ue_protos[1].mme_ue_s1ap_id(), 2);
+  // The next writes continue from the versions of the region
+  EXPECT_EQ(manager.version_of(IMSI_1), 5);
+  EXPECT_EQ(manager.version_of(IMSI_2), 9);
+
+  std::vector<uint32_t> ue_ids;
+  EXPECT_TRUE(manager.for_each_ue_proto_in_region(
+      [&](const std::string&, const UeContext& ue_proto) {
+        ue_ids.push_back(ue_proto.mme_ue_s1ap_id());
+        return false;
+      }));
+  EXPECT_EQ(ue_ids.size(), 2);
+
+  // A spilled record is fetched from redis, which is not reachable here
+  manager.region()->write(IMSI_2, std::string(RECORD_SIZE + 1, 'x'), 10);
+  EXPECT_EQ(manager.read_ue_protos_from_region(keys, ue_protos), RETURNerror);
+  // Other tasks cannot rely on the region any more
+  EXPECT_FALSE(manager.for_each_ue_proto_in_region(
+      [](const std::string&, const UeContext&) { return false; }));
+}
+
+TEST_F(UeStateRegionTest, TestRestoreWorkers) {
+  std::string dir = path.substr(0, path.rfind('/'));
+  TestStateManager manager(dir);
+  const size_t num_ues = 10 * RESTORE_MIN_UES_PER_WORKER + 7;
+
+  // Concurrent restores share the pool, each index is processed once
+  std::vector<std::vector<std::atomic<int>>> hits(2);
+  std::vector<std::thread> restores;
+  for (auto& restore_hits : hits) {
+    restore_hits = std::vector<std::atomic<int>>(num_ues);
+    restores.emplace_back([&manager, &restore_hits, num_ues]() {
+      for (int run = 0; run < 3; run++) {
+        manager.run_restore_workers(
+            num_ues, [&](size_t i) { restore_hits[i]++; });
+      }
+    });
+  }
+  for (auto& restore : restores) {
+    restore.join();
+  }
+  for (const auto& restore_hits : hits) {
+    for (size_t i = 0; i < num_ues; i++) {
+      ASSERT_EQ(restore_hits[i], 3) << "UE " << i;
+    }
+  }
+}
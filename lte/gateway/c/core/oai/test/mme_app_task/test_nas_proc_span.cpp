@@ -0,0 +1,192 @@
+/**
+ * Copyright 2020 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <string>
+
+extern "C" {
+#include "mme_app_ue_context.h"
+#include "nas_proc_span.h"
+#include "nas_procedures.h"
+}
+
+#define IMSI_1 1010000000001
+
+static uint64_t monotonic_usec() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t) ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+// Runs the spans of an attach procedure of a fake UE context
+class NasProcSpanTest : public ::testing::Test {
+ protected:
+  virtual void SetUp() {
+    nas_proc_span_init(1);
+    memset(&ue_context, 0, sizeof(ue_context));
+    memset(&procedures, 0, sizeof(procedures));
+    memset(&attach_proc, 0, sizeof(attach_proc));
+    attach_proc.emm_spec_proc.type = EMM_SPEC_PROC_TYPE_ATTACH;
+    procedures.emm_specific_proc   = &attach_proc.emm_spec_proc;
+    ue_context.mme_ue_s1ap_id      = 1;
+    ue_context.emm_context._imsi64 = IMSI_1;
+    emm_context                    = &ue_context.emm_context;
+    emm_context->emm_procedures    = &procedures;
+    span                           = &attach_proc.span;
+    nas_proc_span_start(span);
+  }
+
+  std::string dump() {
+    char* dump = nas_proc_span_dump_to_string();
+    std::string dump_str(dump ? dump : "");
+    free(dump);
+    return dump_str;
+  }
+
+  // @return the number of procedures in the trace of dump_str
+  size_t num_records(const std::string& dump_str) {
+    size_t count = 0;
+    for (size_t pos = dump_str.find(" ue_id "); pos != std::string::npos;
+         pos        = dump_str.find(" ue_id ", pos + 1)) {
+      count++;
+    }
+    return count;
+  }
+
+  ue_mm_context_t ue_context;
+  emm_procedures_t procedures;
+  nas_emm_attach_proc_t attach_proc;
+  emm_context_t* emm_context;
+  nas_proc_span_t* span;
+};
+
+TEST_F(NasProcSpanTest, TestRetransmissionKeepsStart) {
+  nas_proc_span_leg_begin(emm_context, NAS_PROC_LEG_AUTH);
+  uint64_t leg_start = span->leg_start_usec[NAS_PROC_LEG_AUTH];
+  ASSERT_NE(leg_start, 0u);
+
+  // The Authentication Request is sent again on T3460 expiry
+  usleep(2000);
+  nas_proc_span_leg_begin(emm_context, NAS_PROC_LEG_AUTH);
+  EXPECT_EQ(span->leg_start_usec[NAS_PROC_LEG_AUTH], leg_start);
+
+  nas_proc_span_leg_end(emm_context, NAS_PROC_LEG_AUTH);
+  EXPECT_GE(span->leg_usec[NAS_PROC_LEG_AUTH], 2000u);
+}
+
+TEST_F(NasProcSpanTest, TestLegEndsOnce) {
+  nas_proc_span_leg_begin(emm_context, NAS_PROC_LEG_SMC);
+  usleep(1000);
+  nas_proc_span_leg_end(emm_context, NAS_PROC_LEG_SMC);
+  uint64_t leg_usec = span->leg_usec[NAS_PROC_LEG_SMC];
+  EXPECT_GE(leg_usec, 1000u);
+  EXPECT_EQ(span->leg_start_usec[NAS_PROC_LEG_SMC], 0u);
+
+  // A duplicate Security Mode Complete does not count twice
+  usleep(1000);
+  nas_proc_span_leg_end(emm_context, NAS_PROC_LEG_SMC);
+  EXPECT_EQ(span->leg_usec[NAS_PROC_LEG_SMC], leg_usec);
+
+  // Nor does an answer to a leg that was never started
+  nas_proc_span_leg_end(emm_context, NAS_PROC_LEG_S6A_ULR);
+  EXPECT_EQ(span->leg_usec[NAS_PROC_LEG_S6A_ULR], 0u);
+
+  // A leg started again adds up
+  nas_proc_span_leg_begin(emm_context, NAS_PROC_LEG_SMC);
+  nas_proc_span_leg_end(emm_context, NAS_PROC_LEG_SMC);
+  EXPECT_GE(span->leg_usec[NAS_PROC_LEG_SMC], leg_usec);
+}
+
+TEST_F(NasProcSpanTest, TestNoRunningProcedure) {
+  procedures.emm_specific_proc = NULL;
+  nas_proc_span_leg_begin(emm_context, NAS_PROC_LEG_AUTH);
+  nas_proc_span_accepted(emm_context);
+  EXPECT_EQ(span->leg_start_usec[NAS_PROC_LEG_AUTH], 0u);
+  EXPECT_FALSE(span->accepted);
+
+  // Procedures restored from the state have no start to time from
+  procedures.emm_specific_proc = &attach_proc.emm_spec_proc;
+  span->start_usec             = 0;
+  nas_proc_span_leg_begin(emm_context, NAS_PROC_LEG_AUTH);
+  EXPECT_EQ(span->leg_start_usec[NAS_PROC_LEG_AUTH], 0u);
+  nas_proc_span_end(emm_context, span, "attach", true);
+  EXPECT_NE(dump().find("0 completed procedures"), std::string::npos);
+}
+
+TEST_F(NasProcSpanTest, TestDumpShare) {
+  span->start_usec                     = monotonic_usec() - 1000000;
+  span->leg_usec[NAS_PROC_LEG_S6A_AIR] = 500000;
+  span->leg_usec[NAS_PROC_LEG_AUTH]    = 250000;
+  nas_proc_span_end(emm_context, span, "attach", true);
+
+  // Failed procedures are left out of the share
+  nas_proc_span_start(span);
+  span->leg_usec[NAS_PROC_LEG_S6A_AIR] = 500000;
+  nas_proc_span_end(emm_context, span, "attach", false);
+
+  std::string dump_str = dump();
+  EXPECT_NE(dump_str.find("1 completed procedures"), std::string::npos);
+  const struct {
+    const char* line;
+    int share;
+  } legs[] = {
+      {"s6a_air: 1 procedures, 500000 us on average, ", 50},
+      {"authentication: 1 procedures, 250000 us on average, ", 25},
+      {"s6a_ulr: 0 procedures, 0 us on average, ", 0},
+  };
+  for (const auto& leg : legs) {
+    size_t pos = dump_str.find(leg.line);
+    ASSERT_NE(pos, std::string::npos) << leg.line;
+    // The procedure took slightly more than 1 s, the share is rounded down
+    int share = atoi(dump_str.c_str() + pos + strlen(leg.line));
+    EXPECT_LE(share, leg.share);
+    EXPECT_GE(share, leg.share ? leg.share - 1 : 0);
+  }
+}
+
+TEST_F(NasProcSpanTest, TestTraceWraps) {
+  const uint32_t num_procs = NAS_PROC_SPAN_TRACE_SIZE + 10;
+  for (uint32_t ue_id = 1; ue_id <= num_procs; ue_id++) {
+    ue_context.mme_ue_s1ap_id = ue_id;
+    nas_proc_span_start(span);
+    nas_proc_span_end(emm_context, span, "attach", true);
+  }
+
+  std::string dump_str = dump();
+  EXPECT_EQ(num_records(dump_str), (size_t) NAS_PROC_SPAN_TRACE_SIZE);
+
+  // Most recent first, the oldest ones were overwritten
+  size_t newest = dump_str.find(" ue_id " + std::to_string(num_procs) + " ");
+  size_t oldest = dump_str.find(" ue_id 11 ");
+  ASSERT_NE(newest, std::string::npos);
+  ASSERT_NE(oldest, std::string::npos);
+  EXPECT_LT(newest, oldest);
+  EXPECT_EQ(dump_str.find(" ue_id 10 "), std::string::npos);
+}
+
+TEST_F(NasProcSpanTest, TestTraceSampling) {
+  nas_proc_span_init(4);
+  for (int i = 0; i < 8; i++) {
+    nas_proc_span_start(span);
+    nas_proc_span_end(emm_context, span, "attach", i % 2);
+  }
+
+  std::string dump_str = dump();
+  // Failed procedures are sampled too
+  EXPECT_EQ(num_records(dump_str), 2u);
+  EXPECT_NE(dump_str.find("4 completed procedures"), std::string::npos);
+}
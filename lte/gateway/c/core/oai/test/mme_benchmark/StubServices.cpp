@@ -0,0 +1,268 @@
+/**
+ * Copyright 2020 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+extern "C" {
+#include "benchmark_nas.h"
+}
+#include "stub_services.h"
+
+#include <arpa/inet.h>
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <grpcpp/grpcpp.h>
+
+#include "feg/protos/s6a_proxy.grpc.pb.h"
+#include "includes/ServiceRegistrySingleton.h"
+#include "lte/protos/mobilityd.grpc.pb.h"
+#include "lte/protos/pipelined.grpc.pb.h"
+#include "lte/protos/session_manager.grpc.pb.h"
+#include "orc8r/protos/directoryd.grpc.pb.h"
+#include "orc8r/protos/eventd.grpc.pb.h"
+
+namespace magma {
+namespace mme {
+
+using grpc::ServerContext;
+using grpc::Status;
+
+namespace {
+
+// UE addresses are handed out from 10.128.0.0/9
+constexpr uint32_t UE_IP_BLOCK      = 0x0a800000;
+constexpr uint32_t UE_IP_PREFIX_LEN = 9;
+
+constexpr uint32_t AMBR_BPS = 200000000;
+
+// Answers every subscriber with vectors the virtual UEs can derive too
+class SubscriberdbStub final : public feg::S6aProxy::Service {
+ public:
+  Status AuthenticationInformation(
+      ServerContext* context, const feg::AuthenticationInformationRequest* req,
+      feg::AuthenticationInformationAnswer* res) override {
+    benchmark_auth_vector_t vector;
+
+    benchmark_auth_vector(
+        std::strtoull(req->user_name().c_str(), nullptr, 10), &vector);
+    auto eutran_vector = res->add_eutran_vectors();
+    eutran_vector->set_rand(vector.rand, sizeof(vector.rand));
+    eutran_vector->set_xres(vector.xres, sizeof(vector.xres));
+    eutran_vector->set_autn(vector.autn, sizeof(vector.autn));
+    eutran_vector->set_kasme(vector.kasme, sizeof(vector.kasme));
+    res->set_error_code(feg::SUCCESS);
+    return Status::OK;
+  }
+
+  Status UpdateLocation(
+      ServerContext* context, const feg::UpdateLocationRequest* req,
+      feg::UpdateLocationAnswer* res) override {
+    res->set_error_code(feg::SUCCESS);
+    res->set_default_context_id(0);
+    res->set_all_apns_included(true);
+    res->set_network_access_mode(feg::UpdateLocationAnswer::ONLY_PACKET);
+    res->mutable_total_ambr()->set_max_bandwidth_ul(AMBR_BPS);
+    res->mutable_total_ambr()->set_max_bandwidth_dl(AMBR_BPS);
+
+    auto apn = res->add_apn();
+    apn->set_context_id(0);
+    apn->set_service_selection("internet");
+    apn->set_pdn(feg::UpdateLocationAnswer::APNConfiguration::IPV4);
+    apn->mutable_qos_profile()->set_class_id(9);
+    apn->mutable_qos_profile()->set_priority_level(15);
+    apn->mutable_ambr()->set_max_bandwidth_ul(AMBR_BPS);
+    apn->mutable_ambr()->set_max_bandwidth_dl(AMBR_BPS);
+    return Status::OK;
+  }
+
+  Status PurgeUE(
+      ServerContext* context, const feg::PurgeUERequest* req,
+      feg::PurgeUEAnswer* res) override {
+    res->set_error_code(feg::SUCCESS);
+    return Status::OK;
+  }
+};
+
+class MobilitydStub final : public lte::MobilityService::Service {
+ public:
+  MobilitydStub() : next_ip_(1) {}
+
+  Status ListAddedIPv4Blocks(
+      ServerContext* context, const orc8r::Void* req,
+      lte::ListAddedIPBlocksResponse* res) override {
+    uint32_t block = htonl(UE_IP_BLOCK);
+    auto ip_block  = res->add_ip_block_list();
+
+    ip_block->set_version(lte::IPBlock::IPV4);
+    ip_block->set_net_address(&block, sizeof(block));
+    ip_block->set_prefix_len(UE_IP_PREFIX_LEN);
+    return Status::OK;
+  }
+
+  Status AllocateIPAddress(
+      ServerContext* context, const lte::AllocateIPRequest* req,
+      lte::AllocateIPAddressResponse* res) override {
+    uint32_t ip  = htonl(UE_IP_BLOCK + next_ip_++);
+    auto address = res->add_ip_list();
+
+    address->set_version(lte::IPAddress::IPV4);
+    address->set_address(&ip, sizeof(ip));
+    return Status::OK;
+  }
+
+  Status ReleaseIPAddress(
+      ServerContext* context, const lte::ReleaseIPRequest* req,
+      orc8r::Void* res) override {
+    return Status::OK;
+  }
+
+ private:
+  std::atomic<uint32_t> next_ip_;
+};
+
+class PipelinedStub final : public lte::Pipelined::Service {
+ public:
+  Status UpdateUEState(
+      ServerContext* context, const lte::UESessionSet* req,
+      lte::UESessionContextResponse* res) override {
+    *res->mutable_ue_ipv4_address() = req->ue_ipv4_address();
+    res->mutable_cause_info()->set_cause_ie(lte::CauseIE::REQUEST_ACCEPTED);
+    return Status::OK;
+  }
+
+  Status UpdateUEStateBatch(
+      ServerContext* context, const lte::UESessionSetBatch* req,
+      lte::UESessionContextResponseBatch* res) override {
+    for (const auto& session : req->sessions()) {
+      UpdateUEState(context, &session, res->add_responses());
+    }
+    return Status::OK;
+  }
+};
+
+class SessiondStub final : public lte::LocalSessionManager::Service {
+ public:
+  Status CreateSession(
+      ServerContext* context, const lte::LocalCreateSessionRequest* req,
+      lte::LocalCreateSessionResponse* res) override {
+    return Status::OK;
+  }
+
+  Status EndSession(
+      ServerContext* context, const lte::LocalEndSessionRequest* req,
+      lte::LocalEndSessionResponse* res) override {
+    return Status::OK;
+  }
+
+  Status BindPolicy2Bearer(
+      ServerContext* context, const lte::PolicyBearerBindingRequest* req,
+      lte::PolicyBearerBindingResponse* res) override {
+    return Status::OK;
+  }
+
+  Status UpdateTunnelIds(
+      ServerContext* context, const lte::UpdateTunnelIdsRequest* req,
+      lte::UpdateTunnelIdsResponse* res) override {
+    return Status::OK;
+  }
+};
+
+class DirectorydStub final : public orc8r::GatewayDirectoryService::Service {
+ public:
+  Status UpdateRecord(
+      ServerContext* context, const orc8r::UpdateRecordRequest* req,
+      orc8r::Void* res) override {
+    return Status::OK;
+  }
+
+  Status DeleteRecord(
+      ServerContext* context, const orc8r::DeleteRecordRequest* req,
+      orc8r::Void* res) override {
+    return Status::OK;
+  }
+};
+
+class EventdStub final : public orc8r::EventService::Service {
+ public:
+  Status LogEvent(
+      ServerContext* context, const orc8r::Event* req,
+      orc8r::Void* res) override {
+    return Status::OK;
+  }
+};
+
+struct StubService {
+  const char* name;
+  std::unique_ptr<grpc::Service> service;
+  std::unique_ptr<grpc::Server> server;
+};
+
+std::vector<StubService> stubs;
+
+void add_stub(const char* name, grpc::Service* service) {
+  stubs.push_back(
+      StubService{name, std::unique_ptr<grpc::Service>(service), nullptr});
+}
+
+}  // namespace
+
+int start_stub_services() {
+  add_stub("subscriberdb", new SubscriberdbStub());
+  add_stub("mobilityd", new MobilitydStub());
+  add_stub("pipelined", new PipelinedStub());
+  add_stub("sessiond", new SessiondStub());
+  add_stub("directoryd", new DirectorydStub());
+  add_stub("eventd", new EventdStub());
+
+  for (auto& stub : stubs) {
+    const std::string address =
+        ServiceRegistrySingleton::Instance()->GetServiceAddrString(stub.name);
+    grpc::ServerBuilder builder;
+
+    builder.AddListeningPort(address, grpc::InsecureServerCredentials());
+    builder.RegisterService(stub.service.get());
+    stub.server = builder.BuildAndStart();
+    if (stub.server == nullptr) {
+      std::fprintf(
+          stderr, "Could not serve %s on %s, is it running?\n", stub.name,
+          address.c_str());
+      return -1;
+    }
+  }
+  return 0;
+}
+
+void stop_stub_services() {
+  for (auto& stub : stubs) {
+    if (stub.server != nullptr) {
+      stub.server->Shutdown();
+      stub.server->Wait();
+    }
+  }
+  stubs.clear();
+}
+
+}  // namespace mme
+}  // namespace magma
+
+int stub_services_start(void) {
+  return magma::mme::start_stub_services();
+}
+
+void stub_services_stop(void) {
+  magma::mme::stop_stub_services();
+}
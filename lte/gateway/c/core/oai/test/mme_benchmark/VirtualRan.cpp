@@ -0,0 +1,861 @@
+/**
+ * Copyright 2020 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+extern "C" {
+#include "benchmark_nas.h"
+#include "benchmark_s1ap.h"
+#include "bstrlib.h"
+#include "common_defs.h"
+#include "intertask_interface.h"
+#include "mme_app_overload.h"
+#include "sctp_defs.h"
+}
+#include "virtual_ran.h"
+
+#include <arpa/inet.h>
+#include <signal.h>
+#include <sys/resource.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <grpcpp/grpcpp.h>
+
+#include <lte/protos/sctpd.grpc.pb.h>
+
+namespace magma {
+namespace mme {
+
+using grpc::ClientContext;
+using grpc::ServerContext;
+using grpc::Status;
+
+using magma::sctpd::InitReq;
+using magma::sctpd::InitRes;
+using magma::sctpd::NewAssocReq;
+using magma::sctpd::NewAssocRes;
+using magma::sctpd::SctpdDownlink;
+using magma::sctpd::SctpdUplink;
+using magma::sctpd::SendDlBatchReq;
+using magma::sctpd::SendDlBatchRes;
+using magma::sctpd::SendDlReq;
+using magma::sctpd::SendDlRes;
+using magma::sctpd::SendUlReq;
+using magma::sctpd::SendUlRes;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// SCTP payload protocol identifier of S1AP
+constexpr uint32_t S1AP_PPID   = 18;
+constexpr uint32_t ENB_STREAMS = 8;
+// S1 Setup goes on stream 0, the UE associated signalling on another one
+constexpr uint32_t UE_STREAM = 1;
+// First eNB S1-U address, 10.10.0.1
+constexpr uint32_t ENB_IP_BASE = 0x0a0a0001;
+// eNB UE S1AP ids are 24 bits
+constexpr uint32_t MAX_ENB_UE_S1AP_ID = 0x00ffffff;
+
+constexpr auto QUEUE_SAMPLE_PERIOD = std::chrono::milliseconds(100);
+
+const task_id_t SAMPLED_TASKS[] = {
+    TASK_SCTP, TASK_S1AP, TASK_MME_APP, TASK_S6A, TASK_SPGW_APP};
+constexpr size_t NB_SAMPLED_TASKS =
+    sizeof(SAMPLED_TASKS) / sizeof(SAMPLED_TASKS[0]);
+
+// Steps of the attach procedure, each one ends with a downlink message
+enum AttachStep {
+  STEP_AUTHENTICATION = 0,  // Attach Request to Authentication Request
+  STEP_SECURITY_MODE,       // Authentication Response to SMC
+  STEP_ATTACH_ACCEPT,       // SMC Complete to Attach Accept
+  STEP_ATTACH,              // Attach Request to Attach Accept
+  NB_ATTACH_STEPS,
+};
+
+const char* const ATTACH_STEP_NAMES[NB_ATTACH_STEPS] = {
+    "authentication", "security mode", "attach accept", "attach"};
+
+enum class UeState { IDLE, ATTACHING, ATTACHED, FAILED };
+
+struct VirtualUe {
+  benchmark_ue_nas_t nas;
+  uint32_t enb_index;
+  uint32_t enb_ue_s1ap_id;
+  uint32_t mme_ue_s1ap_id;
+  UeState state;
+  // A downlink NAS PDU was received since the attach started
+  bool answered;
+  Clock::time_point attach_start;
+  Clock::time_point step_start;
+};
+
+struct Downlink {
+  uint32_t assoc_id;
+  std::string payload;
+};
+
+struct QueueStats {
+  uint64_t max;
+  uint64_t sum;
+};
+
+double to_ms(Clock::duration duration) {
+  return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+double percentile(std::vector<double>& samples, double p) {
+  if (samples.empty()) {
+    return 0;
+  }
+  size_t rank = std::min(
+      samples.size() - 1, static_cast<size_t>(p * samples.size()));
+  std::nth_element(samples.begin(), samples.begin() + rank, samples.end());
+  return samples[rank];
+}
+
+// CPU time of the whole process, MME tasks and stub services included
+double process_cpu_sec() {
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  return usage.ru_utime.tv_sec + usage.ru_stime.tv_sec +
+         (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1e6;
+}
+
+double thread_cpu_sec() {
+  struct timespec ts;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+}  // namespace
+
+/*
+ * Plays sctpd towards the MME: downlink S1AP PDUs are received on the sctpd
+ * downlink service and queued, a single driver thread owns the eNBs and UEs,
+ * answers the downlink PDUs and sends the uplink ones over the sctpd uplink
+ * service of the MME. The MME tasks thus run unchanged, over the same
+ * process boundary as in production.
+ */
+class VirtualRan final : public SctpdDownlink::Service {
+ public:
+  explicit VirtualRan(const benchmark_config_t& config);
+
+  Status Init(
+      ServerContext* context, const InitReq* req, InitRes* res) override;
+  Status SendDl(
+      ServerContext* context, const SendDlReq* req, SendDlRes* res) override;
+  Status SendDlBatch(
+      ServerContext* context, const SendDlBatchReq* req,
+      SendDlBatchRes* res) override;
+
+  // Set up the eNBs, run the attach storm and print the report
+  bool run();
+  void stop();
+
+ private:
+  bool stopped();
+  bool setup_enbs(Clock::time_point deadline);
+  bool storm(Clock::time_point deadline);
+  void process_downlinks(Clock::time_point until);
+  void on_downlink(const Downlink& downlink);
+  void on_nas(VirtualUe& ue, const benchmark_s1ap_dl_t& s1ap);
+  VirtualUe* next_attach(uint32_t* next_ue);
+  void start_attach(VirtualUe& ue);
+  void shed(VirtualUe& ue);
+  void expire_attaches(Clock::time_point now);
+  void on_overload(const Downlink& downlink, bool start);
+  void end_step(VirtualUe& ue, AttachStep step);
+  void finish(VirtualUe& ue, bool attached);
+  bool send_ul(uint32_t assoc_id, uint32_t stream, const_bstring payload);
+  bool send_nas(VirtualUe& ue, bstring nas_pdu);
+  VirtualUe* find_ue(uint32_t enb_ue_s1ap_id);
+  void sample_queues();
+  void report(Clock::duration elapsed, double cpu_sec, double ran_cpu_sec);
+  void report_overload();
+
+  benchmark_config_t config_;
+  std::unique_ptr<SctpdUplink::Stub> uplink_;
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  bool initialized_;
+  bool stopping_;
+  std::deque<Downlink> downlinks_;
+
+  // Owned by the driver thread
+  std::vector<benchmark_enb_t> enbs_;
+  std::vector<VirtualUe> ues_;
+  uint32_t enbs_ready_;
+  uint32_t enb_failures_;
+  uint32_t in_flight_;
+  uint32_t attached_;
+  uint32_t failed_;
+  uint32_t decode_errors_;
+  std::vector<double> latencies_[NB_ATTACH_STEPS];
+  QueueStats queue_stats_[NB_SAMPLED_TASKS];
+  uint64_t queue_samples_;
+  // Overload mode
+  std::vector<bool> enb_overloaded_;
+  uint32_t enbs_in_overload_;
+  uint32_t overload_starts_;
+  uint32_t overload_stops_;
+  // Indexes of the UEs whose attach was shed, to retry first
+  std::deque<uint32_t> retries_;
+  uint32_t shed_;
+  uint64_t level_samples_[MME_OVERLOAD_MAX + 1];
+};
+
+VirtualRan::VirtualRan(const benchmark_config_t& config)
+    : config_(config),
+      initialized_(false),
+      stopping_(false),
+      enbs_(config.nb_enbs),
+      ues_(config.nb_ues),
+      enbs_ready_(0),
+      enb_failures_(0),
+      in_flight_(0),
+      attached_(0),
+      failed_(0),
+      decode_errors_(0),
+      queue_stats_(),
+      queue_samples_(0),
+      enb_overloaded_(config.nb_enbs, false),
+      enbs_in_overload_(0),
+      overload_starts_(0),
+      overload_stops_(0),
+      shed_(0),
+      level_samples_() {
+  for (uint32_t i = 0; i < config.nb_enbs; i++) {
+    enbs_[i].enb_id  = i + 1;
+    enbs_[i].mcc     = config.mcc;
+    enbs_[i].mnc     = config.mnc;
+    enbs_[i].mnc_len = config.mnc_len;
+    enbs_[i].tac     = config.tac;
+    enbs_[i].ip      = htonl(ENB_IP_BASE + i);
+  }
+  for (uint32_t i = 0; i < config.nb_ues; i++) {
+    benchmark_nas_ue_init(&ues_[i].nas, config.imsi_base + i);
+    ues_[i].enb_index      = i % config.nb_enbs;
+    ues_[i].enb_ue_s1ap_id = i + 1;
+    ues_[i].mme_ue_s1ap_id = 0;
+    ues_[i].state          = UeState::IDLE;
+    ues_[i].answered       = false;
+  }
+  for (auto& latencies : latencies_) {
+    latencies.reserve(config.nb_ues);
+  }
+}
+
+Status VirtualRan::Init(
+    ServerContext* context, const InitReq* req, InitRes* res) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    initialized_ = true;
+  }
+  cv_.notify_one();
+  res->set_result(InitRes::INIT_OK);
+  return Status::OK;
+}
+
+Status VirtualRan::SendDl(
+    ServerContext* context, const SendDlReq* req, SendDlRes* res) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    downlinks_.push_back(Downlink{req->assoc_id(), req->payload()});
+  }
+  cv_.notify_one();
+  res->set_result(SendDlRes::SEND_DL_OK);
+  return Status::OK;
+}
+
+Status VirtualRan::SendDlBatch(
+    ServerContext* context, const SendDlBatchReq* req, SendDlBatchRes* res) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& target : req->targets()) {
+      if (target.payload_index() >=
+          static_cast<uint32_t>(req->payloads_size())) {
+        res->add_results(SendDlRes::SEND_DL_FAIL);
+        continue;
+      }
+      downlinks_.push_back(
+          Downlink{target.assoc_id(), req->payloads(target.payload_index())});
+      res->add_results(SendDlRes::SEND_DL_OK);
+    }
+  }
+  cv_.notify_one();
+  return Status::OK;
+}
+
+bool VirtualRan::run() {
+  const auto timeout               = std::chrono::seconds(config_.timeout_sec);
+  const Clock::time_point deadline = Clock::now() + timeout;
+
+  // The MME connects to sctpd once its SCTP task is up
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!cv_.wait_until(
+            lock, deadline, [this] { return initialized_ || stopping_; }) ||
+        stopping_) {
+      std::fprintf(stderr, "The MME did not initialize sctpd\n");
+      return false;
+    }
+  }
+  auto channel = grpc::CreateChannel(
+      UPSTREAM_SOCK, grpc::InsecureChannelCredentials());
+  if (!channel->WaitForConnected(std::chrono::system_clock::now() + timeout)) {
+    std::fprintf(stderr, "Could not connect to %s\n", UPSTREAM_SOCK);
+    return false;
+  }
+  uplink_ = SctpdUplink::NewStub(channel);
+
+  if (!setup_enbs(deadline)) {
+    return false;
+  }
+  return storm(deadline);
+}
+
+void VirtualRan::stop() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  cv_.notify_one();
+}
+
+bool VirtualRan::stopped() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return stopping_;
+}
+
+bool VirtualRan::setup_enbs(Clock::time_point deadline) {
+  for (uint32_t i = 0; i < enbs_.size(); i++) {
+    NewAssocReq req;
+    NewAssocRes res;
+    ClientContext context;
+
+    req.set_assoc_id(i + 1);
+    req.set_instreams(ENB_STREAMS);
+    req.set_outstreams(ENB_STREAMS);
+    req.set_ran_cp_ipaddr(
+        reinterpret_cast<const char*>(&enbs_[i].ip), sizeof(enbs_[i].ip));
+    req.set_ppid(S1AP_PPID);
+    if (!uplink_->NewAssoc(&context, req, &res).ok()) {
+      std::fprintf(stderr, "Could not open the association of eNB %u\n", i);
+      return false;
+    }
+
+    bstring s1_setup = benchmark_s1ap_s1_setup_request(&enbs_[i]);
+    bool sent        = send_ul(i + 1, 0, s1_setup);
+    bdestroy(s1_setup);
+    if (!sent) {
+      std::fprintf(stderr, "Could not send the S1 Setup of eNB %u\n", i);
+      return false;
+    }
+  }
+
+  while (enbs_ready_ < enbs_.size()) {
+    if (enb_failures_) {
+      std::fprintf(
+          stderr,
+          "%u eNBs failed S1 Setup, check the served TAI of the MME "
+          "configuration\n",
+          enb_failures_);
+      return false;
+    }
+    if ((Clock::now() >= deadline) || stopped()) {
+      std::fprintf(
+          stderr, "Only %u of %zu eNBs are set up\n", enbs_ready_,
+          enbs_.size());
+      return false;
+    }
+    process_downlinks(deadline);
+  }
+  return true;
+}
+
+bool VirtualRan::storm(Clock::time_point deadline) {
+  const double cpu_start        = process_cpu_sec();
+  const double ran_cpu_start    = thread_cpu_sec();
+  const Clock::time_point start = Clock::now();
+
+  const Clock::duration start_period =
+      config_.attach_rate ?
+          std::chrono::duration_cast<Clock::duration>(
+              std::chrono::duration<double>(1.0 / config_.attach_rate)) :
+          Clock::duration::zero();
+  Clock::time_point next_start  = start;
+  Clock::time_point next_sample = start;
+  uint32_t next_ue              = 0;
+
+  while ((attached_ + failed_ < ues_.size()) && !stopped()) {
+    const Clock::time_point now = Clock::now();
+    if (now >= deadline) {
+      break;
+    }
+    // Do not make up with a burst for the time the window was full
+    if (now - next_start > start_period) {
+      next_start = now;
+    }
+    while ((in_flight_ < config_.max_in_flight) && (now >= next_start)) {
+      VirtualUe* ue = next_attach(&next_ue);
+      if (!ue) {
+        break;
+      }
+      start_attach(*ue);
+      next_start += start_period;
+    }
+    if (now >= next_sample) {
+      sample_queues();
+      if (config_.overload) {
+        expire_attaches(now);
+      }
+      next_sample = now + QUEUE_SAMPLE_PERIOD;
+    }
+
+    Clock::time_point wake = std::min(deadline, next_sample);
+    if (((next_ue < ues_.size()) || !retries_.empty()) &&
+        (in_flight_ < config_.max_in_flight) && (enbs_in_overload_ == 0)) {
+      wake = std::min(wake, next_start);
+    }
+    process_downlinks(wake);
+  }
+  const Clock::duration elapsed = Clock::now() - start;
+  const double cpu_sec          = process_cpu_sec() - cpu_start;
+  const double ran_cpu_sec      = thread_cpu_sec() - ran_cpu_start;
+
+  if (!config_.overload) {
+    report(elapsed, cpu_sec, ran_cpu_sec);
+    return attached_ == ues_.size();
+  }
+  // The eNBs are told once the MME is no longer overloaded
+  while ((enbs_in_overload_ > 0) && (Clock::now() < deadline) && !stopped()) {
+    process_downlinks(deadline);
+  }
+  report(elapsed, cpu_sec, ran_cpu_sec);
+  report_overload();
+  return (attached_ == ues_.size()) && (overload_starts_ > 0) &&
+         (enbs_in_overload_ == 0);
+}
+
+void VirtualRan::process_downlinks(Clock::time_point until) {
+  std::deque<Downlink> downlinks;
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait_until(
+        lock, until, [this] { return !downlinks_.empty() || stopping_; });
+    downlinks.swap(downlinks_);
+  }
+  for (const auto& downlink : downlinks) {
+    on_downlink(downlink);
+  }
+}
+
+void VirtualRan::on_downlink(const Downlink& downlink) {
+  benchmark_s1ap_dl_t s1ap;
+  bstring raw = blk2bstr(downlink.payload.data(), downlink.payload.size());
+  int rc      = benchmark_s1ap_decode_downlink(raw, &s1ap);
+
+  bdestroy(raw);
+  if (rc != RETURNok) {
+    decode_errors_++;
+    return;
+  }
+
+  VirtualUe* ue = nullptr;
+  switch (s1ap.type) {
+    case BENCHMARK_S1AP_S1_SETUP_RESPONSE:
+      enbs_ready_++;
+      break;
+
+    case BENCHMARK_S1AP_S1_SETUP_FAILURE:
+      enb_failures_++;
+      break;
+
+    case BENCHMARK_S1AP_DOWNLINK_NAS_TRANSPORT:
+    case BENCHMARK_S1AP_INITIAL_CONTEXT_SETUP_REQUEST:
+      ue = find_ue(s1ap.enb_ue_s1ap_id);
+      if (ue && (ue->state == UeState::ATTACHING)) {
+        ue->mme_ue_s1ap_id = s1ap.mme_ue_s1ap_id;
+        ue->answered       = true;
+        on_nas(*ue, s1ap);
+      }
+      break;
+
+    case BENCHMARK_S1AP_UE_CONTEXT_RELEASE_COMMAND:
+      // The UE may already be attaching again under another eNB UE S1AP id
+      if (s1ap.enb_ue_s1ap_id) {
+        bstring complete = benchmark_s1ap_ue_context_release_complete(
+            s1ap.mme_ue_s1ap_id, s1ap.enb_ue_s1ap_id);
+        send_ul(downlink.assoc_id, UE_STREAM, complete);
+        bdestroy(complete);
+      }
+      ue = find_ue(s1ap.enb_ue_s1ap_id);
+      if (ue && (ue->state == UeState::ATTACHING)) {
+        finish(*ue, false);
+      }
+      break;
+
+    case BENCHMARK_S1AP_OVERLOAD_START:
+      on_overload(downlink, true);
+      break;
+
+    case BENCHMARK_S1AP_OVERLOAD_STOP:
+      on_overload(downlink, false);
+      break;
+
+    default:
+      break;
+  }
+  bdestroy(s1ap.nas_pdu);
+}
+
+void VirtualRan::on_nas(VirtualUe& ue, const benchmark_s1ap_dl_t& s1ap) {
+  const benchmark_enb_t& enb = enbs_[ue.enb_index];
+
+  if (!s1ap.nas_pdu) {
+    return;
+  }
+  switch (benchmark_nas_decode_downlink(&ue.nas, s1ap.nas_pdu)) {
+    case BENCHMARK_NAS_AUTHENTICATION_REQUEST:
+      end_step(ue, STEP_AUTHENTICATION);
+      send_nas(ue, benchmark_nas_authentication_response(&ue.nas));
+      break;
+
+    case BENCHMARK_NAS_SECURITY_MODE_COMMAND:
+      end_step(ue, STEP_SECURITY_MODE);
+      send_nas(ue, benchmark_nas_security_mode_complete(&ue.nas));
+      break;
+
+    case BENCHMARK_NAS_ATTACH_ACCEPT: {
+      bool sent = true;
+
+      end_step(ue, STEP_ATTACH_ACCEPT);
+      latencies_[STEP_ATTACH].push_back(
+          to_ms(Clock::now() - ue.attach_start));
+      if (s1ap.type == BENCHMARK_S1AP_INITIAL_CONTEXT_SETUP_REQUEST) {
+        bstring response = benchmark_s1ap_initial_context_setup_response(
+            &enb, ue.mme_ue_s1ap_id, ue.enb_ue_s1ap_id, s1ap.e_rab_ids,
+            s1ap.nb_e_rabs, ue.enb_ue_s1ap_id);
+        sent = send_ul(ue.enb_index + 1, UE_STREAM, response);
+        bdestroy(response);
+      }
+      if (!sent) {
+        finish(ue, false);
+      } else if (send_nas(ue, benchmark_nas_attach_complete(&ue.nas))) {
+        finish(ue, true);
+      }
+    } break;
+
+    // Rejected for congestion, the UE tries again
+    case BENCHMARK_NAS_ATTACH_REJECT:
+      if (config_.overload) {
+        shed(ue);
+      } else {
+        finish(ue, false);
+      }
+      break;
+
+    // The virtual UEs always identify with their IMSI and never cipher
+    case BENCHMARK_NAS_IDENTITY_REQUEST:
+    case BENCHMARK_NAS_AUTHENTICATION_REJECT:
+    case BENCHMARK_NAS_INVALID:
+      finish(ue, false);
+      break;
+
+    default:
+      break;
+  }
+}
+
+// The eNBs in overload hold back the attaches, as they reject the RRC
+// connections of mobile originated signalling
+VirtualUe* VirtualRan::next_attach(uint32_t* next_ue) {
+  if (enbs_in_overload_ > 0) {
+    return nullptr;
+  }
+  if (!retries_.empty()) {
+    VirtualUe* ue = &ues_[retries_.front()];
+    retries_.pop_front();
+    return ue;
+  }
+  if (*next_ue < ues_.size()) {
+    return &ues_[(*next_ue)++];
+  }
+  return nullptr;
+}
+
+void VirtualRan::start_attach(VirtualUe& ue) {
+  const benchmark_enb_t& enb = enbs_[ue.enb_index];
+
+  ue.state        = UeState::ATTACHING;
+  ue.answered     = false;
+  ue.attach_start = Clock::now();
+  ue.step_start   = ue.attach_start;
+  in_flight_++;
+
+  bstring nas_pdu = benchmark_nas_attach_request(&ue.nas);
+  bstring initial_ue_message =
+      benchmark_s1ap_initial_ue_message(&enb, ue.enb_ue_s1ap_id, nas_pdu);
+  bool sent = send_ul(ue.enb_index + 1, UE_STREAM, initial_ue_message);
+  bdestroy(initial_ue_message);
+  bdestroy(nas_pdu);
+  if (!sent) {
+    finish(ue, false);
+  }
+}
+
+void VirtualRan::end_step(VirtualUe& ue, AttachStep step) {
+  const Clock::time_point now = Clock::now();
+
+  latencies_[step].push_back(to_ms(now - ue.step_start));
+  ue.step_start = now;
+}
+
+// The attach is retried later on, under a new eNB UE S1AP id as the MME may
+// still hold a context for the current one
+void VirtualRan::shed(VirtualUe& ue) {
+  const uint32_t index = static_cast<uint32_t>(&ue - &ues_[0]);
+
+  ue.state = UeState::IDLE;
+  in_flight_--;
+  shed_++;
+  ue.enb_ue_s1ap_id += ues_.size();
+  if (ue.enb_ue_s1ap_id > MAX_ENB_UE_S1AP_ID) {
+    ue.enb_ue_s1ap_id = index + 1;
+  }
+  retries_.push_back(index);
+}
+
+// Attaches without an answer were shed by the MME, the others were dropped
+// while in progress
+void VirtualRan::expire_attaches(Clock::time_point now) {
+  const auto timeout = std::chrono::seconds(config_.attach_timeout_sec);
+
+  for (auto& ue : ues_) {
+    if ((ue.state != UeState::ATTACHING) || (now - ue.attach_start < timeout)) {
+      continue;
+    }
+    if (ue.answered) {
+      finish(ue, false);
+    } else {
+      shed(ue);
+    }
+  }
+}
+
+void VirtualRan::on_overload(const Downlink& downlink, bool start) {
+  if ((downlink.assoc_id == 0) || (downlink.assoc_id > enbs_.size())) {
+    return;
+  }
+  // Overload Start is sent again as the level is raised
+  if (start) {
+    overload_starts_++;
+    if (!enb_overloaded_[downlink.assoc_id - 1]) {
+      enb_overloaded_[downlink.assoc_id - 1] = true;
+      enbs_in_overload_++;
+    }
+  } else {
+    overload_stops_++;
+    if (enb_overloaded_[downlink.assoc_id - 1]) {
+      enb_overloaded_[downlink.assoc_id - 1] = false;
+      enbs_in_overload_--;
+    }
+  }
+}
+
+void VirtualRan::finish(VirtualUe& ue, bool attached) {
+  ue.state = attached ? UeState::ATTACHED : UeState::FAILED;
+  in_flight_--;
+  if (attached) {
+    attached_++;
+  } else {
+    failed_++;
+  }
+}
+
+bool VirtualRan::send_ul(
+    uint32_t assoc_id, uint32_t stream, const_bstring payload) {
+  SendUlReq req;
+  SendUlRes res;
+  ClientContext context;
+
+  if (!payload) {
+    return false;
+  }
+  req.set_assoc_id(assoc_id);
+  req.set_stream(stream);
+  req.set_payload(payload->data, blength(payload));
+  req.set_ppid(S1AP_PPID);
+  return uplink_->SendUl(&context, req, &res).ok();
+}
+
+// Send and free the NAS PDU, the UE has failed if it could not be sent
+bool VirtualRan::send_nas(VirtualUe& ue, bstring nas_pdu) {
+  bool sent = false;
+
+  if (nas_pdu) {
+    bstring uplink = benchmark_s1ap_uplink_nas_transport(
+        &enbs_[ue.enb_index], ue.mme_ue_s1ap_id, ue.enb_ue_s1ap_id, nas_pdu);
+    sent = send_ul(ue.enb_index + 1, UE_STREAM, uplink);
+    bdestroy(uplink);
+    bdestroy(nas_pdu);
+  }
+  ue.step_start = Clock::now();
+  if (!sent) {
+    finish(ue, false);
+  }
+  return sent;
+}
+
+// The eNB UE S1AP ids of a UE are its index + 1 modulo the number of UEs
+VirtualUe* VirtualRan::find_ue(uint32_t enb_ue_s1ap_id) {
+  if (enb_ue_s1ap_id == 0) {
+    return nullptr;
+  }
+  VirtualUe* ue = &ues_[(enb_ue_s1ap_id - 1) % ues_.size()];
+  return ue->enb_ue_s1ap_id == enb_ue_s1ap_id ? ue : nullptr;
+}
+
+void VirtualRan::sample_queues() {
+  for (size_t i = 0; i < NB_SAMPLED_TASKS; i++) {
+    uint64_t depth = itti_get_task_queue_depth(SAMPLED_TASKS[i]);
+
+    queue_stats_[i].max = std::max(queue_stats_[i].max, depth);
+    queue_stats_[i].sum += depth;
+  }
+  level_samples_[mme_overload_level()]++;
+  queue_samples_++;
+}
+
+void VirtualRan::report(
+    Clock::duration elapsed, double cpu_sec, double ran_cpu_sec) {
+  const double elapsed_sec = to_ms(elapsed) / 1000;
+  uint32_t started         = 0;
+
+  for (const auto& ue : ues_) {
+    started += (ue.state != UeState::IDLE);
+  }
+
+  std::printf(
+      "Attach storm of %zu UEs over %zu eNBs, %u attaches in flight at most\n",
+      ues_.size(), enbs_.size(), config_.max_in_flight);
+  std::printf(
+      "  attached %u, failed %u, timed out %u, not started %zu in %.3f s\n",
+      attached_, failed_, started - attached_ - failed_,
+      ues_.size() - started, elapsed_sec);
+  std::printf("  attach rate %.1f attaches/s\n", attached_ / elapsed_sec);
+  std::printf("  %-16s %10s %10s\n", "latency (ms)", "p50", "p99");
+  for (int step = 0; step < NB_ATTACH_STEPS; step++) {
+    std::printf(
+        "  %-16s %10.3f %10.3f\n", ATTACH_STEP_NAMES[step],
+        percentile(latencies_[step], 0.5), percentile(latencies_[step], 0.99));
+  }
+  if (attached_) {
+    // The process CPU includes the stub services and the virtual RAN
+    std::printf(
+        "  CPU per attach %.1f us, virtual RAN driver %.1f us\n",
+        cpu_sec * 1e6 / attached_, ran_cpu_sec * 1e6 / attached_);
+  }
+  std::printf("  %-16s %10s %10s\n", "queue depth", "mean", "max");
+  for (size_t i = 0; i < NB_SAMPLED_TASKS; i++) {
+    std::printf(
+        "  %-16s %10.1f %10" PRIu64 "\n", itti_get_task_name(SAMPLED_TASKS[i]),
+        queue_samples_ ?
+            static_cast<double>(queue_stats_[i].sum) / queue_samples_ :
+            0.0,
+        queue_stats_[i].max);
+  }
+  if (decode_errors_) {
+    std::printf("  %u downlink PDUs could not be decoded\n", decode_errors_);
+  }
+  std::fflush(stdout);
+}
+
+void VirtualRan::report_overload() {
+  std::printf(
+      "  overload start %u, stop %u, eNBs still in overload %u\n",
+      overload_starts_, overload_stops_, enbs_in_overload_);
+  std::printf("  attaches shed and retried %u\n", shed_);
+  std::printf("  %-16s %10s\n", "overload level", "time (%)");
+  for (int level = MME_OVERLOAD_NONE; level <= MME_OVERLOAD_MAX; level++) {
+    std::printf(
+        "  %-16s %10.1f\n",
+        mme_overload_level2str(static_cast<mme_overload_level_t>(level)),
+        queue_samples_ ? 100.0 * level_samples_[level] / queue_samples_ : 0.0);
+  }
+  if (overload_starts_ == 0) {
+    std::printf("  the MME was not overloaded, raise --rate or --in-flight\n");
+  }
+  std::fflush(stdout);
+}
+
+}  // namespace mme
+}  // namespace magma
+
+using grpc::Server;
+using grpc::ServerBuilder;
+
+using magma::mme::VirtualRan;
+
+static std::unique_ptr<VirtualRan> virtual_ran = nullptr;
+static std::unique_ptr<Server> server          = nullptr;
+static std::thread driver;
+static bool succeeded = false;
+
+int virtual_ran_start(const benchmark_config_t* config) {
+  virtual_ran.reset(new VirtualRan(*config));
+
+  ServerBuilder builder;
+  builder.AddListeningPort(DOWNSTREAM_SOCK, grpc::InsecureServerCredentials());
+  builder.RegisterService(virtual_ran.get());
+  server = builder.BuildAndStart();
+  if (server == nullptr) {
+    return -1;
+  }
+
+  driver = std::thread([] {
+    succeeded = virtual_ran->run();
+    // Ends itti_wait_tasks_end on the main thread
+    kill(getpid(), SIGTERM);
+  });
+  return 0;
+}
+
+int virtual_ran_stop(void) {
+  if (virtual_ran != nullptr) {
+    virtual_ran->stop();
+  }
+  if (driver.joinable()) {
+    driver.join();
+  }
+  if (server != nullptr) {
+    server->Shutdown();
+    server->Wait();
+    server = nullptr;
+  }
+  virtual_ran = nullptr;
+  return succeeded ? 0 : -1;
+}
@@ -0,0 +1,267 @@
+/**
+ * Copyright 2020 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*! \file benchmark_nas.c
+  \brief UE side EMM messages of the attach procedure, for the MME benchmark
+*/
+
+#include <string.h>
+
+#include "benchmark_nas.h"
+#include "secu_defs.h"
+
+#define BENCHMARK_NAS_EMM_PD 0x07
+#define BENCHMARK_NAS_ESM_PD 0x02
+
+#define BENCHMARK_NAS_ATTACH_REQUEST 0x41
+#define BENCHMARK_NAS_ATTACH_ACCEPT_TYPE 0x42
+#define BENCHMARK_NAS_ATTACH_COMPLETE 0x43
+#define BENCHMARK_NAS_ATTACH_REJECT_TYPE 0x44
+#define BENCHMARK_NAS_AUTHENTICATION_REQUEST_TYPE 0x52
+#define BENCHMARK_NAS_AUTHENTICATION_RESPONSE 0x53
+#define BENCHMARK_NAS_AUTHENTICATION_REJECT_TYPE 0x54
+#define BENCHMARK_NAS_IDENTITY_REQUEST_TYPE 0x55
+#define BENCHMARK_NAS_SECURITY_MODE_COMMAND_TYPE 0x5d
+#define BENCHMARK_NAS_SECURITY_MODE_COMPLETE 0x5e
+#define BENCHMARK_NAS_EMM_INFORMATION_TYPE 0x61
+#define BENCHMARK_NAS_ACTIVATE_DEFAULT_BEARER_COMPLETE 0xc2
+
+// Security header types of TS 24.301 9.3.1
+#define BENCHMARK_NAS_INTEGRITY_PROTECTED_CIPHERED 2
+#define BENCHMARK_NAS_INTEGRITY_PROTECTED_CIPHERED_NEW 4
+
+// Security header, MAC and sequence number
+#define BENCHMARK_NAS_SECURITY_HEADER_SIZE 6
+#define BENCHMARK_NAS_MAX_PLAIN_SIZE 64
+#define BENCHMARK_NAS_MAX_SIZE                                                 \
+  (BENCHMARK_NAS_SECURITY_HEADER_SIZE + BENCHMARK_NAS_MAX_PLAIN_SIZE)
+
+//------------------------------------------------------------------------------
+static uint64_t benchmark_splitmix64(uint64_t* state) {
+  uint64_t z = (*state += 0x9e3779b97f4a7c15ULL);
+  z          = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  z          = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+  return z ^ (z >> 31);
+}
+
+//------------------------------------------------------------------------------
+static void benchmark_fill(uint64_t* state, uint8_t* buf, size_t size) {
+  for (size_t i = 0; i < size; i += sizeof(uint64_t)) {
+    uint64_t r = benchmark_splitmix64(state);
+    size_t n   = (size - i) < sizeof(r) ? (size - i) : sizeof(r);
+    memcpy(buf + i, &r, n);
+  }
+}
+
+//------------------------------------------------------------------------------
+void benchmark_auth_vector(uint64_t imsi, benchmark_auth_vector_t* vector) {
+  uint64_t state = imsi;
+
+  benchmark_fill(&state, vector->rand, sizeof(vector->rand));
+  benchmark_fill(&state, vector->xres, sizeof(vector->xres));
+  benchmark_fill(&state, vector->autn, sizeof(vector->autn));
+  benchmark_fill(&state, vector->kasme, sizeof(vector->kasme));
+}
+
+//------------------------------------------------------------------------------
+void benchmark_nas_ue_init(benchmark_ue_nas_t* ue, uint64_t imsi) {
+  memset(ue, 0, sizeof(*ue));
+  ue->imsi = imsi;
+}
+
+//------------------------------------------------------------------------------
+bstring benchmark_nas_attach_request(const benchmark_ue_nas_t* ue) {
+  uint8_t buf[BENCHMARK_NAS_MAX_PLAIN_SIZE];
+  uint8_t digits[15];
+  int size      = 0;
+  uint64_t imsi = ue->imsi;
+
+  for (int i = 14; i >= 0; i--) {
+    digits[i] = imsi % 10;
+    imsi /= 10;
+  }
+  buf[size++] = BENCHMARK_NAS_EMM_PD;
+  buf[size++] = BENCHMARK_NAS_ATTACH_REQUEST;
+  // No native NAS key set identifier, EPS attach
+  buf[size++] = 0x71;
+  // EPS mobile identity: odd number of digits, IMSI
+  buf[size++] = 8;
+  buf[size++] = (digits[0] << 4) | 0x09;
+  for (int i = 1; i < 15; i += 2) {
+    buf[size++] = (digits[i + 1] << 4) | digits[i];
+  }
+  // UE network capability: EEA0, EIA1 and EIA2
+  buf[size++] = 2;
+  buf[size++] = 0x80;
+  buf[size++] = 0x60;
+  // ESM message container: PDN Connectivity Request, initial request, IPv4
+  buf[size++] = 0;
+  buf[size++] = 4;
+  buf[size++] = BENCHMARK_NAS_ESM_PD;
+  buf[size++] = 1;
+  buf[size++] = 0xd0;
+  buf[size++] = 0x11;
+  return blk2bstr(buf, size);
+}
+
+//------------------------------------------------------------------------------
+bstring benchmark_nas_authentication_response(const benchmark_ue_nas_t* ue) {
+  uint8_t buf[3 + BENCHMARK_AUTH_XRES_SIZE];
+  benchmark_auth_vector_t vector;
+
+  benchmark_auth_vector(ue->imsi, &vector);
+  buf[0] = BENCHMARK_NAS_EMM_PD;
+  buf[1] = BENCHMARK_NAS_AUTHENTICATION_RESPONSE;
+  buf[2] = BENCHMARK_AUTH_XRES_SIZE;
+  memcpy(&buf[3], vector.xres, BENCHMARK_AUTH_XRES_SIZE);
+  return blk2bstr(buf, sizeof(buf));
+}
+
+//------------------------------------------------------------------------------
+static bstring benchmark_nas_protect(
+    benchmark_ue_nas_t* ue, uint8_t header_type, const uint8_t* plain,
+    int size) {
+  uint8_t buf[BENCHMARK_NAS_MAX_SIZE];
+  uint8_t mac[4]             = {0};
+  nas_stream_cipher_t stream = {0};
+
+  buf[0] = (header_type << 4) | BENCHMARK_NAS_EMM_PD;
+  buf[5] = ue->ul_count & 0xff;
+  memcpy(&buf[BENCHMARK_NAS_SECURITY_HEADER_SIZE], plain, size);
+
+  // The MAC covers the sequence number and the plain message
+  stream.key        = ue->knas_int;
+  stream.key_length = sizeof(ue->knas_int);
+  stream.count      = ue->ul_count;
+  stream.bearer     = 0;
+  stream.direction  = SECU_DIRECTION_UPLINK;
+  stream.message    = &buf[5];
+  stream.blength    = (size + 1) << 3;
+  if (ue->integrity_alg == 1) {
+    nas_stream_encrypt_eia1(&stream, mac);
+  } else if (ue->integrity_alg == 2) {
+    nas_stream_encrypt_eia2(&stream, mac);
+  }
+  memcpy(&buf[1], mac, sizeof(mac));
+  ue->ul_count++;
+  return blk2bstr(buf, BENCHMARK_NAS_SECURITY_HEADER_SIZE + size);
+}
+
+//------------------------------------------------------------------------------
+bstring benchmark_nas_security_mode_complete(benchmark_ue_nas_t* ue) {
+  const uint8_t plain[] = {
+      BENCHMARK_NAS_EMM_PD, BENCHMARK_NAS_SECURITY_MODE_COMPLETE};
+
+  ue->ul_count = 0;
+  return benchmark_nas_protect(
+      ue, BENCHMARK_NAS_INTEGRITY_PROTECTED_CIPHERED_NEW, plain,
+      sizeof(plain));
+}
+
+//------------------------------------------------------------------------------
+bstring benchmark_nas_attach_complete(benchmark_ue_nas_t* ue) {
+  // Carries the Activate Default EPS Bearer Context Accept
+  const uint8_t plain[] = {
+      BENCHMARK_NAS_EMM_PD,
+      BENCHMARK_NAS_ATTACH_COMPLETE,
+      0,
+      3,
+      (uint8_t)((ue->ebi << 4) | BENCHMARK_NAS_ESM_PD),
+      0,
+      BENCHMARK_NAS_ACTIVATE_DEFAULT_BEARER_COMPLETE};
+
+  return benchmark_nas_protect(
+      ue, BENCHMARK_NAS_INTEGRITY_PROTECTED_CIPHERED, plain, sizeof(plain));
+}
+
+//------------------------------------------------------------------------------
+static benchmark_nas_dl_type_t benchmark_nas_decode_smc(
+    benchmark_ue_nas_t* ue, const uint8_t* plain, int size) {
+  benchmark_auth_vector_t vector;
+
+  if (size < 3) {
+    return BENCHMARK_NAS_INVALID;
+  }
+  // The virtual UEs do not cipher
+  if ((plain[2] >> 4) & 0x07) {
+    return BENCHMARK_NAS_INVALID;
+  }
+  ue->integrity_alg = plain[2] & 0x07;
+  if ((ue->integrity_alg != 1) && (ue->integrity_alg != 2)) {
+    return BENCHMARK_NAS_INVALID;
+  }
+  benchmark_auth_vector(ue->imsi, &vector);
+  derive_key_nas(NAS_INT_ALG, ue->integrity_alg, vector.kasme, ue->knas_int);
+  ue->secured = true;
+  return BENCHMARK_NAS_SECURITY_MODE_COMMAND;
+}
+
+//------------------------------------------------------------------------------
+static benchmark_nas_dl_type_t benchmark_nas_decode_attach_accept(
+    benchmark_ue_nas_t* ue, const uint8_t* plain, int size) {
+  int tai_list_size = 0;
+  int esm           = 0;
+
+  // Attach result, T3412 and TAI list, then the ESM message container
+  if (size < 5) {
+    return BENCHMARK_NAS_INVALID;
+  }
+  tai_list_size = plain[4];
+  esm           = 5 + tai_list_size + 2;
+  if (size < esm + 2) {
+    return BENCHMARK_NAS_INVALID;
+  }
+  ue->ebi = plain[esm] >> 4;
+  ue->pti = plain[esm + 1];
+  return BENCHMARK_NAS_ATTACH_ACCEPT;
+}
+
+//------------------------------------------------------------------------------
+benchmark_nas_dl_type_t benchmark_nas_decode_downlink(
+    benchmark_ue_nas_t* ue, const_bstring nas_pdu) {
+  const uint8_t* plain = nas_pdu->data;
+  int size             = blength(nas_pdu);
+
+  if (size < 2) {
+    return BENCHMARK_NAS_INVALID;
+  }
+  if (plain[0] >> 4) {
+    if (size < BENCHMARK_NAS_SECURITY_HEADER_SIZE + 2) {
+      return BENCHMARK_NAS_INVALID;
+    }
+    plain += BENCHMARK_NAS_SECURITY_HEADER_SIZE;
+    size -= BENCHMARK_NAS_SECURITY_HEADER_SIZE;
+  }
+  if ((plain[0] & 0x0f) != BENCHMARK_NAS_EMM_PD) {
+    return BENCHMARK_NAS_UNKNOWN;
+  }
+
+  switch (plain[1]) {
+    case BENCHMARK_NAS_AUTHENTICATION_REQUEST_TYPE:
+      return BENCHMARK_NAS_AUTHENTICATION_REQUEST;
+    case BENCHMARK_NAS_AUTHENTICATION_REJECT_TYPE:
+      return BENCHMARK_NAS_AUTHENTICATION_REJECT;
+    case BENCHMARK_NAS_SECURITY_MODE_COMMAND_TYPE:
+      return benchmark_nas_decode_smc(ue, plain, size);
+    case BENCHMARK_NAS_ATTACH_ACCEPT_TYPE:
+      return benchmark_nas_decode_attach_accept(ue, plain, size);
+    case BENCHMARK_NAS_ATTACH_REJECT_TYPE:
+      return BENCHMARK_NAS_ATTACH_REJECT;
+    case BENCHMARK_NAS_IDENTITY_REQUEST_TYPE:
+      return BENCHMARK_NAS_IDENTITY_REQUEST;
+    case BENCHMARK_NAS_EMM_INFORMATION_TYPE:
+      return BENCHMARK_NAS_EMM_INFORMATION;
+    default:
+      return BENCHMARK_NAS_UNKNOWN;
+  }
+}
@@ -0,0 +1,88 @@
+/**
+ * Copyright 2020 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*! \file benchmark_nas.h
+  \brief UE side EMM messages of the attach procedure, for the MME benchmark
+*/
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "bstrlib.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define BENCHMARK_AUTH_XRES_SIZE 8
+
+// Authentication vector the stub HSS hands out for an IMSI
+typedef struct benchmark_auth_vector_s {
+  uint8_t rand[16];
+  uint8_t xres[BENCHMARK_AUTH_XRES_SIZE];
+  uint8_t autn[16];
+  uint8_t kasme[32];
+} benchmark_auth_vector_t;
+
+typedef struct benchmark_ue_nas_s {
+  uint64_t imsi;
+  uint8_t knas_int[16];
+  uint8_t integrity_alg;  // EIA selected by the Security Mode Command
+  bool secured;
+  uint32_t ul_count;
+  uint8_t ebi;  // Default bearer of the Attach Accept
+  uint8_t pti;
+} benchmark_ue_nas_t;
+
+typedef enum {
+  BENCHMARK_NAS_INVALID = -1,  // Malformed or not supported by the UE
+  BENCHMARK_NAS_UNKNOWN = 0,
+  BENCHMARK_NAS_AUTHENTICATION_REQUEST,
+  BENCHMARK_NAS_AUTHENTICATION_REJECT,
+  BENCHMARK_NAS_SECURITY_MODE_COMMAND,
+  BENCHMARK_NAS_ATTACH_ACCEPT,
+  BENCHMARK_NAS_ATTACH_REJECT,
+  BENCHMARK_NAS_IDENTITY_REQUEST,
+  BENCHMARK_NAS_EMM_INFORMATION,
+} benchmark_nas_dl_type_t;
+
+/*
+ * Vectors are derived from the IMSI, so that the virtual UEs and the stub
+ * HSS agree on them without sharing state.
+ */
+void benchmark_auth_vector(uint64_t imsi, benchmark_auth_vector_t* vector);
+
+void benchmark_nas_ue_init(benchmark_ue_nas_t* ue, uint64_t imsi);
+
+// Plain Attach Request with a PDN Connectivity Request for IPv4
+bstring benchmark_nas_attach_request(const benchmark_ue_nas_t* ue);
+
+bstring benchmark_nas_authentication_response(const benchmark_ue_nas_t* ue);
+
+// Protected with the new security context, the UE only supports EEA0
+bstring benchmark_nas_security_mode_complete(benchmark_ue_nas_t* ue);
+
+bstring benchmark_nas_attach_complete(benchmark_ue_nas_t* ue);
+
+/*
+ * Decode a downlink EMM message and update the UE security context and
+ * bearer from it. The integrity of downlink messages is not verified.
+ */
+benchmark_nas_dl_type_t benchmark_nas_decode_downlink(
+    benchmark_ue_nas_t* ue, const_bstring nas_pdu);
+
+#ifdef __cplusplus
+}
+#endif
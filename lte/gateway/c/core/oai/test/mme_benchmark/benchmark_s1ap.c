@@ -0,0 +1,447 @@
+/**
+ * Copyright 2020 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*! \file benchmark_s1ap.c
+  \brief eNB side S1AP messages of the attach procedure, for the MME benchmark
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "benchmark_s1ap.h"
+#include "common_defs.h"
+#include "conversions.h"
+#include "log.h"
+#include "s1ap_common.h"
+#include "s1ap_mme_decoder.h"
+
+#define BENCHMARK_S1AP_IE(IE_TYPE, CONTAINER, IE_ID, CRITICALITY, PRESENT)     \
+  ({                                                                           \
+    IE_TYPE* _ie       = calloc(1, sizeof(IE_TYPE));                           \
+    _ie->id            = (IE_ID);                                              \
+    _ie->criticality   = (CRITICALITY);                                        \
+    _ie->value.present = (PRESENT);                                            \
+    ASN_SEQUENCE_ADD(&(CONTAINER)->protocolIEs.list, _ie);                     \
+    _ie;                                                                       \
+  })
+
+//------------------------------------------------------------------------------
+// Encode and free the PDU
+static bstring benchmark_s1ap_encode(S1ap_S1AP_PDU_t* pdu) {
+  bstring raw                           = NULL;
+  asn_encode_to_new_buffer_result_t res = {NULL, {0, NULL, NULL}};
+
+  res = asn_encode_to_new_buffer(
+      NULL, ATS_ALIGNED_CANONICAL_PER, &asn_DEF_S1ap_S1AP_PDU, pdu);
+  ASN_STRUCT_FREE_CONTENTS_ONLY(asn_DEF_S1ap_S1AP_PDU, pdu);
+  if (res.buffer) {
+    raw = blk2bstr(res.buffer, res.result.encoded);
+    free(res.buffer);
+  }
+  return raw;
+}
+
+//------------------------------------------------------------------------------
+static void benchmark_s1ap_set_tai(
+    const benchmark_enb_t* enb, S1ap_TAI_t* tai) {
+  MCC_MNC_TO_PLMNID(enb->mcc, enb->mnc, enb->mnc_len, &tai->pLMNidentity);
+  TAC_TO_ASN1(enb->tac, &tai->tAC);
+}
+
+//------------------------------------------------------------------------------
+static void benchmark_s1ap_set_cgi(
+    const benchmark_enb_t* enb, S1ap_EUTRAN_CGI_t* cgi) {
+  MCC_MNC_TO_PLMNID(enb->mcc, enb->mnc, enb->mnc_len, &cgi->pLMNidentity);
+  MACRO_ENB_ID_TO_CELL_IDENTITY(enb->enb_id, 0, &cgi->cell_ID);
+}
+
+//------------------------------------------------------------------------------
+bstring benchmark_s1ap_s1_setup_request(const benchmark_enb_t* enb) {
+  S1ap_S1AP_PDU_t pdu;
+  S1ap_S1SetupRequest_t* out   = NULL;
+  S1ap_S1SetupRequestIEs_t* ie = NULL;
+  S1ap_SupportedTAs_Item_t* ta = NULL;
+  S1ap_PLMNidentity_t* plmn    = NULL;
+  char enb_name[32]            = {0};
+
+  memset(&pdu, 0, sizeof(pdu));
+  pdu.present = S1ap_S1AP_PDU_PR_initiatingMessage;
+  pdu.choice.initiatingMessage.procedureCode = S1ap_ProcedureCode_id_S1Setup;
+  pdu.choice.initiatingMessage.criticality   = S1ap_Criticality_reject;
+  pdu.choice.initiatingMessage.value.present =
+      S1ap_InitiatingMessage__value_PR_S1SetupRequest;
+  out = &pdu.choice.initiatingMessage.value.choice.S1SetupRequest;
+
+  ie = BENCHMARK_S1AP_IE(
+      S1ap_S1SetupRequestIEs_t, out, S1ap_ProtocolIE_ID_id_Global_ENB_ID,
+      S1ap_Criticality_reject, S1ap_S1SetupRequestIEs__value_PR_Global_ENB_ID);
+  MCC_MNC_TO_PLMNID(
+      enb->mcc, enb->mnc, enb->mnc_len,
+      &ie->value.choice.Global_ENB_ID.pLMNidentity);
+  ie->value.choice.Global_ENB_ID.eNB_ID.present = S1ap_ENB_ID_PR_macroENB_ID;
+  MACRO_ENB_ID_TO_BIT_STRING(
+      enb->enb_id, &ie->value.choice.Global_ENB_ID.eNB_ID.choice.macroENB_ID);
+
+  ie = BENCHMARK_S1AP_IE(
+      S1ap_S1SetupRequestIEs_t, out, S1ap_ProtocolIE_ID_id_eNBname,
+      S1ap_Criticality_ignore, S1ap_S1SetupRequestIEs__value_PR_ENBname);
+  snprintf(enb_name, sizeof(enb_name), "benchmark-enb-%u", enb->enb_id);
+  OCTET_STRING_fromBuf(&ie->value.choice.ENBname, enb_name, strlen(enb_name));
+
+  ie = BENCHMARK_S1AP_IE(
+      S1ap_S1SetupRequestIEs_t, out, S1ap_ProtocolIE_ID_id_SupportedTAs,
+      S1ap_Criticality_reject, S1ap_S1SetupRequestIEs__value_PR_SupportedTAs);
+  ta = calloc(1, sizeof(*ta));
+  TAC_TO_ASN1(enb->tac, &ta->tAC);
+  plmn = calloc(1, sizeof(*plmn));
+  MCC_MNC_TO_PLMNID(enb->mcc, enb->mnc, enb->mnc_len, plmn);
+  ASN_SEQUENCE_ADD(&ta->broadcastPLMNs.list, plmn);
+  ASN_SEQUENCE_ADD(&ie->value.choice.SupportedTAs.list, ta);
+
+  ie = BENCHMARK_S1AP_IE(
+      S1ap_S1SetupRequestIEs_t, out, S1ap_ProtocolIE_ID_id_DefaultPagingDRX,
+      S1ap_Criticality_ignore, S1ap_S1SetupRequestIEs__value_PR_PagingDRX);
+  ie->value.choice.PagingDRX = S1ap_PagingDRX_v64;
+
+  return benchmark_s1ap_encode(&pdu);
+}
+
+//------------------------------------------------------------------------------
+bstring benchmark_s1ap_initial_ue_message(
+    const benchmark_enb_t* enb, uint32_t enb_ue_s1ap_id,
+    const_bstring nas_pdu) {
+  S1ap_S1AP_PDU_t pdu;
+  S1ap_InitialUEMessage_t* out    = NULL;
+  S1ap_InitialUEMessage_IEs_t* ie = NULL;
+
+  memset(&pdu, 0, sizeof(pdu));
+  pdu.present = S1ap_S1AP_PDU_PR_initiatingMessage;
+  pdu.choice.initiatingMessage.procedureCode =
+      S1ap_ProcedureCode_id_initialUEMessage;
+  pdu.choice.initiatingMessage.criticality = S1ap_Criticality_ignore;
+  pdu.choice.initiatingMessage.value.present =
+      S1ap_InitiatingMessage__value_PR_InitialUEMessage;
+  out = &pdu.choice.initiatingMessage.value.choice.InitialUEMessage;
+
+  ie = BENCHMARK_S1AP_IE(
+      S1ap_InitialUEMessage_IEs_t, out, S1ap_ProtocolIE_ID_id_eNB_UE_S1AP_ID,
+      S1ap_Criticality_reject,
+      S1ap_InitialUEMessage_IEs__value_PR_ENB_UE_S1AP_ID);
+  ie->value.choice.ENB_UE_S1AP_ID = enb_ue_s1ap_id;
+
+  ie = BENCHMARK_S1AP_IE(
+      S1ap_InitialUEMessage_IEs_t, out, S1ap_ProtocolIE_ID_id_NAS_PDU,
+      S1ap_Criticality_reject, S1ap_InitialUEMessage_IEs__value_PR_NAS_PDU);
+  OCTET_STRING_fromBuf(
+      &ie->value.choice.NAS_PDU, (const char*) nas_pdu->data,
+      blength(nas_pdu));
+
+  ie = BENCHMARK_S1AP_IE(
+      S1ap_InitialUEMessage_IEs_t, out, S1ap_ProtocolIE_ID_id_TAI,
+      S1ap_Criticality_reject, S1ap_InitialUEMessage_IEs__value_PR_TAI);
+  benchmark_s1ap_set_tai(enb, &ie->value.choice.TAI);
+
+  ie = BENCHMARK_S1AP_IE(
+      S1ap_InitialUEMessage_IEs_t, out, S1ap_ProtocolIE_ID_id_EUTRAN_CGI,
+      S1ap_Criticality_ignore, S1ap_InitialUEMessage_IEs__value_PR_EUTRAN_CGI);
+  benchmark_s1ap_set_cgi(enb, &ie->value.choice.EUTRAN_CGI);
+
+  ie = BENCHMARK_S1AP_IE(
+      S1ap_InitialUEMessage_IEs_t, out,
+      S1ap_ProtocolIE_ID_id_RRC_Establishment_Cause, S1ap_Criticality_ignore,
+      S1ap_InitialUEMessage_IEs__value_PR_RRC_Establishment_Cause);
+  ie->value.choice.RRC_Establishment_Cause =
+      S1ap_RRC_Establishment_Cause_mo_Signalling;
+
+  return benchmark_s1ap_encode(&pdu);
+}
+
+//------------------------------------------------------------------------------
+bstring benchmark_s1ap_uplink_nas_transport(
+    const benchmark_enb_t* enb, uint32_t mme_ue_s1ap_id,
+    uint32_t enb_ue_s1ap_id, const_bstring nas_pdu) {
+  S1ap_S1AP_PDU_t pdu;
+  S1ap_UplinkNASTransport_t* out    = NULL;
+  S1ap_UplinkNASTransport_IEs_t* ie = NULL;
+
+  memset(&pdu, 0, sizeof(pdu));
+  pdu.present = S1ap_S1AP_PDU_PR_initiatingMessage;
+  pdu.choice.initiatingMessage.procedureCode =
+      S1ap_ProcedureCode_id_uplinkNASTransport;
+  pdu.choice.initiatingMessage.criticality = S1ap_Criticality_ignore;
+  pdu.choice.initiatingMessage.value.present =
+      S1ap_InitiatingMessage__value_PR_UplinkNASTransport;
+  out = &pdu.choice.initiatingMessage.value.choice.UplinkNASTransport;
+
+  ie = BENCHMARK_S1AP_IE(
+      S1ap_UplinkNASTransport_IEs_t, out, S1ap_ProtocolIE_ID_id_MME_UE_S1AP_ID,
+      S1ap_Criticality_reject,
+      S1ap_UplinkNASTransport_IEs__value_PR_MME_UE_S1AP_ID);
+  ie->value.choice.MME_UE_S1AP_ID = mme_ue_s1ap_id;
+
+  ie = BENCHMARK_S1AP_IE(
+      S1ap_UplinkNASTransport_IEs_t, out, S1ap_ProtocolIE_ID_id_eNB_UE_S1AP_ID,
+      S1ap_Criticality_reject,
+      S1ap_UplinkNASTransport_IEs__value_PR_ENB_UE_S1AP_ID);
+  ie->value.choice.ENB_UE_S1AP_ID = enb_ue_s1ap_id;
+
+  ie = BENCHMARK_S1AP_IE(
+      S1ap_UplinkNASTransport_IEs_t, out, S1ap_ProtocolIE_ID_id_NAS_PDU,
+      S1ap_Criticality_reject, S1ap_UplinkNASTransport_IEs__value_PR_NAS_PDU);
+  OCTET_STRING_fromBuf(
+      &ie->value.choice.NAS_PDU, (const char*) nas_pdu->data,
+      blength(nas_pdu));
+
+  ie = BENCHMARK_S1AP_IE(
+      S1ap_UplinkNASTransport_IEs_t, out, S1ap_ProtocolIE_ID_id_EUTRAN_CGI,
+      S1ap_Criticality_ignore,
+      S1ap_UplinkNASTransport_IEs__value_PR_EUTRAN_CGI);
+  benchmark_s1ap_set_cgi(enb, &ie->value.choice.EUTRAN_CGI);
+
+  ie = BENCHMARK_S1AP_IE(
+      S1ap_UplinkNASTransport_IEs_t, out, S1ap_ProtocolIE_ID_id_TAI,
+      S1ap_Criticality_ignore, S1ap_UplinkNASTransport_IEs__value_PR_TAI);
+  benchmark_s1ap_set_tai(enb, &ie->value.choice.TAI);
+
+  return benchmark_s1ap_encode(&pdu);
+}
+
+//------------------------------------------------------------------------------
+bstring benchmark_s1ap_initial_context_setup_response(
+    const benchmark_enb_t* enb, uint32_t mme_ue_s1ap_id,
+    uint32_t enb_ue_s1ap_id, const uint8_t* e_rab_ids, int nb_e_rabs,
+    uint32_t teid) {
+  S1ap_S1AP_PDU_t pdu;
+  S1ap_InitialContextSetupResponse_t* out   = NULL;
+  S1ap_InitialContextSetupResponseIEs_t* ie = NULL;
+
+  memset(&pdu, 0, sizeof(pdu));
+  pdu.present = S1ap_S1AP_PDU_PR_successfulOutcome;
+  pdu.choice.successfulOutcome.procedureCode =
+      S1ap_ProcedureCode_id_InitialContextSetup;
+  pdu.choice.successfulOutcome.criticality = S1ap_Criticality_reject;
+  pdu.choice.successfulOutcome.value.present =
+      S1ap_SuccessfulOutcome__value_PR_InitialContextSetupResponse;
+  out = &pdu.choice.successfulOutcome.value.choice.InitialContextSetupResponse;
+
+  ie = BENCHMARK_S1AP_IE(
+      S1ap_InitialContextSetupResponseIEs_t, out,
+      S1ap_ProtocolIE_ID_id_MME_UE_S1AP_ID, S1ap_Criticality_ignore,
+      S1ap_InitialContextSetupResponseIEs__value_PR_MME_UE_S1AP_ID);
+  ie->value.choice.MME_UE_S1AP_ID = mme_ue_s1ap_id;
+
+  ie = BENCHMARK_S1AP_IE(
+      S1ap_InitialContextSetupResponseIEs_t, out,
+      S1ap_ProtocolIE_ID_id_eNB_UE_S1AP_ID, S1ap_Criticality_ignore,
+      S1ap_InitialContextSetupResponseIEs__value_PR_ENB_UE_S1AP_ID);
+  ie->value.choice.ENB_UE_S1AP_ID = enb_ue_s1ap_id;
+
+  ie = BENCHMARK_S1AP_IE(
+      S1ap_InitialContextSetupResponseIEs_t, out,
+      S1ap_ProtocolIE_ID_id_E_RABSetupListCtxtSURes, S1ap_Criticality_ignore,
+      S1ap_InitialContextSetupResponseIEs__value_PR_E_RABSetupListCtxtSURes);
+  for (int i = 0; i < nb_e_rabs; i++) {
+    S1ap_E_RABSetupItemCtxtSUResIEs_t* item = calloc(1, sizeof(*item));
+    S1ap_E_RABSetupItemCtxtSURes_t* e_rab   = NULL;
+
+    item->id          = S1ap_ProtocolIE_ID_id_E_RABSetupItemCtxtSURes;
+    item->criticality = S1ap_Criticality_ignore;
+    item->value.present =
+        S1ap_E_RABSetupItemCtxtSUResIEs__value_PR_E_RABSetupItemCtxtSURes;
+    e_rab = &item->value.choice.E_RABSetupItemCtxtSURes;
+
+    e_rab->e_RAB_ID                          = e_rab_ids[i];
+    e_rab->transportLayerAddress.buf         = calloc(4, sizeof(uint8_t));
+    e_rab->transportLayerAddress.size        = 4;
+    e_rab->transportLayerAddress.bits_unused = 0;
+    memcpy(e_rab->transportLayerAddress.buf, &enb->ip, 4);
+    INT32_TO_OCTET_STRING(teid + i, &e_rab->gTP_TEID);
+    ASN_SEQUENCE_ADD(&ie->value.choice.E_RABSetupListCtxtSURes.list, item);
+  }
+
+  return benchmark_s1ap_encode(&pdu);
+}
+
+//------------------------------------------------------------------------------
+bstring benchmark_s1ap_ue_context_release_complete(
+    uint32_t mme_ue_s1ap_id, uint32_t enb_ue_s1ap_id) {
+  S1ap_S1AP_PDU_t pdu;
+  S1ap_UEContextReleaseComplete_t* out    = NULL;
+  S1ap_UEContextReleaseComplete_IEs_t* ie = NULL;
+
+  memset(&pdu, 0, sizeof(pdu));
+  pdu.present = S1ap_S1AP_PDU_PR_successfulOutcome;
+  pdu.choice.successfulOutcome.procedureCode =
+      S1ap_ProcedureCode_id_UEContextRelease;
+  pdu.choice.successfulOutcome.criticality = S1ap_Criticality_reject;
+  pdu.choice.successfulOutcome.value.present =
+      S1ap_SuccessfulOutcome__value_PR_UEContextReleaseComplete;
+  out = &pdu.choice.successfulOutcome.value.choice.UEContextReleaseComplete;
+
+  ie = BENCHMARK_S1AP_IE(
+      S1ap_UEContextReleaseComplete_IEs_t, out,
+      S1ap_ProtocolIE_ID_id_MME_UE_S1AP_ID, S1ap_Criticality_ignore,
+      S1ap_UEContextReleaseComplete_IEs__value_PR_MME_UE_S1AP_ID);
+  ie->value.choice.MME_UE_S1AP_ID = mme_ue_s1ap_id;
+
+  ie = BENCHMARK_S1AP_IE(
+      S1ap_UEContextReleaseComplete_IEs_t, out,
+      S1ap_ProtocolIE_ID_id_eNB_UE_S1AP_ID, S1ap_Criticality_ignore,
+      S1ap_UEContextReleaseComplete_IEs__value_PR_ENB_UE_S1AP_ID);
+  ie->value.choice.ENB_UE_S1AP_ID = enb_ue_s1ap_id;
+
+  return benchmark_s1ap_encode(&pdu);
+}
+
+//------------------------------------------------------------------------------
+static void benchmark_s1ap_decode_downlink_nas(
+    S1ap_DownlinkNASTransport_t* container, benchmark_s1ap_dl_t* dl) {
+  S1ap_DownlinkNASTransport_IEs_t* ie = NULL;
+
+  dl->type = BENCHMARK_S1AP_DOWNLINK_NAS_TRANSPORT;
+  S1AP_FIND_PROTOCOLIE_BY_ID(
+      S1ap_DownlinkNASTransport_IEs_t, ie, container,
+      S1ap_ProtocolIE_ID_id_MME_UE_S1AP_ID, true);
+  if (ie) {
+    dl->mme_ue_s1ap_id = ie->value.choice.MME_UE_S1AP_ID;
+  }
+  S1AP_FIND_PROTOCOLIE_BY_ID(
+      S1ap_DownlinkNASTransport_IEs_t, ie, container,
+      S1ap_ProtocolIE_ID_id_eNB_UE_S1AP_ID, true);
+  if (ie) {
+    dl->enb_ue_s1ap_id = ie->value.choice.ENB_UE_S1AP_ID;
+  }
+  S1AP_FIND_PROTOCOLIE_BY_ID(
+      S1ap_DownlinkNASTransport_IEs_t, ie, container,
+      S1ap_ProtocolIE_ID_id_NAS_PDU, true);
+  if (ie) {
+    dl->nas_pdu = blk2bstr(
+        ie->value.choice.NAS_PDU.buf, ie->value.choice.NAS_PDU.size);
+  }
+}
+
+//------------------------------------------------------------------------------
+static void benchmark_s1ap_decode_ics_request(
+    S1ap_InitialContextSetupRequest_t* container, benchmark_s1ap_dl_t* dl) {
+  S1ap_InitialContextSetupRequestIEs_t* ie = NULL;
+
+  dl->type = BENCHMARK_S1AP_INITIAL_CONTEXT_SETUP_REQUEST;
+  S1AP_FIND_PROTOCOLIE_BY_ID(
+      S1ap_InitialContextSetupRequestIEs_t, ie, container,
+      S1ap_ProtocolIE_ID_id_MME_UE_S1AP_ID, true);
+  if (ie) {
+    dl->mme_ue_s1ap_id = ie->value.choice.MME_UE_S1AP_ID;
+  }
+  S1AP_FIND_PROTOCOLIE_BY_ID(
+      S1ap_InitialContextSetupRequestIEs_t, ie, container,
+      S1ap_ProtocolIE_ID_id_eNB_UE_S1AP_ID, true);
+  if (ie) {
+    dl->enb_ue_s1ap_id = ie->value.choice.ENB_UE_S1AP_ID;
+  }
+  S1AP_FIND_PROTOCOLIE_BY_ID(
+      S1ap_InitialContextSetupRequestIEs_t, ie, container,
+      S1ap_ProtocolIE_ID_id_E_RABToBeSetupListCtxtSUReq, true);
+  if (!ie) {
+    return;
+  }
+  S1ap_E_RABToBeSetupListCtxtSUReq_t* list =
+      &ie->value.choice.E_RABToBeSetupListCtxtSUReq;
+  for (int i = 0; i < list->list.count; i++) {
+    S1ap_E_RABToBeSetupItemCtxtSUReq_t* e_rab =
+        &((S1ap_E_RABToBeSetupItemCtxtSUReqIEs_t*) list->list.array[i])
+             ->value.choice.E_RABToBeSetupItemCtxtSUReq;
+
+    if (dl->nb_e_rabs < BENCHMARK_S1AP_MAX_E_RABS) {
+      dl->e_rab_ids[dl->nb_e_rabs++] = e_rab->e_RAB_ID;
+    }
+    // The Attach Accept rides on the default bearer
+    if (e_rab->nAS_PDU && !dl->nas_pdu) {
+      dl->nas_pdu = blk2bstr(e_rab->nAS_PDU->buf, e_rab->nAS_PDU->size);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+static void benchmark_s1ap_decode_release_command(
+    S1ap_UEContextReleaseCommand_t* container, benchmark_s1ap_dl_t* dl) {
+  S1ap_UEContextReleaseCommand_IEs_t* ie = NULL;
+
+  dl->type = BENCHMARK_S1AP_UE_CONTEXT_RELEASE_COMMAND;
+  S1AP_FIND_PROTOCOLIE_BY_ID(
+      S1ap_UEContextReleaseCommand_IEs_t, ie, container,
+      S1ap_ProtocolIE_ID_id_UE_S1AP_IDs, true);
+  if (!ie) {
+    return;
+  }
+  if (ie->value.choice.UE_S1AP_IDs.present ==
+      S1ap_UE_S1AP_IDs_PR_uE_S1AP_ID_pair) {
+    dl->mme_ue_s1ap_id =
+        ie->value.choice.UE_S1AP_IDs.choice.uE_S1AP_ID_pair.mME_UE_S1AP_ID;
+    dl->enb_ue_s1ap_id =
+        ie->value.choice.UE_S1AP_IDs.choice.uE_S1AP_ID_pair.eNB_UE_S1AP_ID;
+  } else {
+    dl->mme_ue_s1ap_id = ie->value.choice.UE_S1AP_IDs.choice.mME_UE_S1AP_ID;
+  }
+}
+
+//------------------------------------------------------------------------------
+int benchmark_s1ap_decode_downlink(const_bstring raw, benchmark_s1ap_dl_t* dl) {
+  S1ap_S1AP_PDU_t pdu = {0};
+
+  memset(dl, 0, sizeof(*dl));
+  if (s1ap_mme_decode_pdu(&pdu, raw) != RETURNok) {
+    ASN_STRUCT_FREE_CONTENTS_ONLY(asn_DEF_S1ap_S1AP_PDU, &pdu);
+    return RETURNerror;
+  }
+
+  switch (pdu.present) {
+    case S1ap_S1AP_PDU_PR_initiatingMessage: {
+      S1ap_InitiatingMessage_t* msg = &pdu.choice.initiatingMessage;
+      if (msg->procedureCode == S1ap_ProcedureCode_id_downlinkNASTransport) {
+        benchmark_s1ap_decode_downlink_nas(
+            &msg->value.choice.DownlinkNASTransport, dl);
+      } else if (
+          msg->procedureCode == S1ap_ProcedureCode_id_InitialContextSetup) {
+        benchmark_s1ap_decode_ics_request(
+            &msg->value.choice.InitialContextSetupRequest, dl);
+      } else if (
+          msg->procedureCode == S1ap_ProcedureCode_id_UEContextRelease) {
+        benchmark_s1ap_decode_release_command(
+            &msg->value.choice.UEContextReleaseCommand, dl);
+      } else if (msg->procedureCode == S1ap_ProcedureCode_id_OverloadStart) {
+        dl->type = BENCHMARK_S1AP_OVERLOAD_START;
+      } else if (msg->procedureCode == S1ap_ProcedureCode_id_OverloadStop) {
+        dl->type = BENCHMARK_S1AP_OVERLOAD_STOP;
+      }
+    } break;
+
+    case S1ap_S1AP_PDU_PR_successfulOutcome:
+      if (pdu.choice.successfulOutcome.procedureCode ==
+          S1ap_ProcedureCode_id_S1Setup) {
+        dl->type = BENCHMARK_S1AP_S1_SETUP_RESPONSE;
+      }
+      break;
+
+    case S1ap_S1AP_PDU_PR_unsuccessfulOutcome:
+      if (pdu.choice.unsuccessfulOutcome.procedureCode ==
+          S1ap_ProcedureCode_id_S1Setup) {
+        dl->type = BENCHMARK_S1AP_S1_SETUP_FAILURE;
+      }
+      break;
+
+    default:
+      break;
+  }
+  ASN_STRUCT_FREE_CONTENTS_ONLY(asn_DEF_S1ap_S1AP_PDU, &pdu);
+  return RETURNok;
+}
@@ -0,0 +1,91 @@
+/**
+ * Copyright 2020 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*! \file benchmark_s1ap.h
+  \brief eNB side S1AP messages of the attach procedure, for the MME benchmark
+*/
+
+#pragma once
+
+#include <stdint.h>
+
+#include "bstrlib.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define BENCHMARK_S1AP_MAX_E_RABS 8
+
+typedef struct benchmark_enb_s {
+  uint32_t enb_id;  // Macro eNB id, 20 bits
+  uint16_t mcc;
+  uint16_t mnc;
+  uint8_t mnc_len;
+  uint16_t tac;
+  uint32_t ip;  // S1-U address, network byte order
+} benchmark_enb_t;
+
+typedef enum {
+  BENCHMARK_S1AP_UNKNOWN = 0,
+  BENCHMARK_S1AP_S1_SETUP_RESPONSE,
+  BENCHMARK_S1AP_S1_SETUP_FAILURE,
+  BENCHMARK_S1AP_DOWNLINK_NAS_TRANSPORT,
+  BENCHMARK_S1AP_INITIAL_CONTEXT_SETUP_REQUEST,
+  BENCHMARK_S1AP_UE_CONTEXT_RELEASE_COMMAND,
+  BENCHMARK_S1AP_OVERLOAD_START,
+  BENCHMARK_S1AP_OVERLOAD_STOP,
+} benchmark_s1ap_dl_type_t;
+
+// What the virtual RAN needs from a downlink S1AP PDU
+typedef struct benchmark_s1ap_dl_s {
+  benchmark_s1ap_dl_type_t type;
+  uint32_t mme_ue_s1ap_id;
+  uint32_t enb_ue_s1ap_id;
+  bstring nas_pdu;  // Owned by the caller, NULL if there is none
+  uint8_t e_rab_ids[BENCHMARK_S1AP_MAX_E_RABS];
+  int nb_e_rabs;
+} benchmark_s1ap_dl_t;
+
+/*
+ * The builders return the aligned PER encoding of the PDU, NULL if it could
+ * not be encoded.
+ */
+bstring benchmark_s1ap_s1_setup_request(const benchmark_enb_t* enb);
+
+bstring benchmark_s1ap_initial_ue_message(
+    const benchmark_enb_t* enb, uint32_t enb_ue_s1ap_id, const_bstring nas_pdu);
+
+bstring benchmark_s1ap_uplink_nas_transport(
+    const benchmark_enb_t* enb, uint32_t mme_ue_s1ap_id,
+    uint32_t enb_ue_s1ap_id, const_bstring nas_pdu);
+
+// Every E-RAB is set up with the eNB address and teid as S1-U F-TEID
+bstring benchmark_s1ap_initial_context_setup_response(
+    const benchmark_enb_t* enb, uint32_t mme_ue_s1ap_id,
+    uint32_t enb_ue_s1ap_id, const uint8_t* e_rab_ids, int nb_e_rabs,
+    uint32_t teid);
+
+bstring benchmark_s1ap_ue_context_release_complete(
+    uint32_t mme_ue_s1ap_id, uint32_t enb_ue_s1ap_id);
+
+/*
+ * Decode a PDU sent by the MME. Procedures the virtual RAN does not take part
+ * in are returned as BENCHMARK_S1AP_UNKNOWN.
+ * @return RETURNok, RETURNerror if the PDU could not be decoded
+ */
+int benchmark_s1ap_decode_downlink(const_bstring raw, benchmark_s1ap_dl_t* dl);
+
+#ifdef __cplusplus
+}
+#endif
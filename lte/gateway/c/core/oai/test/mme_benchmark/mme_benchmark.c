@@ -0,0 +1,227 @@
+/**
+ * Copyright 2020 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Attach storm against the MME tasks running as in oai_mme, with sctpd
+ * replaced by virtual eNBs and the local services answered by stubs.
+ *
+ *   mme_benchmark -c mme.conf -s spgw.conf [--enbs N] [--ues N]
+ *                 [--in-flight N] [--rate N] [--imsi-base N] [--timeout S]
+ *                 [--overload] [--attach-timeout S]
+ *
+ * sctpd, subscriberdb, mobilityd, pipelined, sessiond, directoryd and eventd
+ * have to be stopped first as their sockets are taken over. The report is
+ * printed to stdout and the exit status is 0 only if every UE attached.
+ *
+ * With --overload, congestion control is enabled and the storm, which has to
+ * exceed the capacity of the MME, validates the overload control: the MME
+ * has to shed attaches, signal its overload to the eNBs and recover, while
+ * the attaches shed are retried until every UE is attached.
+ */
+
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "log.h"
+#include "mme_config.h"
+#include "shared_ts_log.h"
+#include "common_defs.h"
+
+#include "intertask_interface_init.h"
+#include "sctp_primitives_server.h"
+#include "s1ap_mme.h"
+#include "mme_app_extern.h"
+#include "s6a_defs.h"
+#include "mme_app_embedded_spgw.h"
+#include "spgw_config.h"
+#include "sgw_defs.h"
+#include "sgw_s8_defs.h"
+#include "service303.h"
+#include "grpc_service.h"
+#include "intertask_interface.h"
+#include "timer.h"
+
+#include "stub_services.h"
+#include "virtual_ran.h"
+
+#define DEFAULT_NB_ENBS 8
+#define DEFAULT_NB_UES 1000
+#define DEFAULT_MAX_IN_FLIGHT 100
+#define DEFAULT_IMSI_BASE 1010000000000ULL
+#define DEFAULT_TIMEOUT_SEC 300
+// T3410
+#define DEFAULT_ATTACH_TIMEOUT_SEC 15
+
+enum {
+  OPT_ENBS = 256,
+  OPT_UES,
+  OPT_IN_FLIGHT,
+  OPT_RATE,
+  OPT_IMSI_BASE,
+  OPT_TIMEOUT,
+  OPT_OVERLOAD,
+  OPT_ATTACH_TIMEOUT,
+};
+
+static const struct option long_options[] = {
+    {"enbs", required_argument, NULL, OPT_ENBS},
+    {"ues", required_argument, NULL, OPT_UES},
+    {"in-flight", required_argument, NULL, OPT_IN_FLIGHT},
+    {"rate", required_argument, NULL, OPT_RATE},
+    {"imsi-base", required_argument, NULL, OPT_IMSI_BASE},
+    {"timeout", required_argument, NULL, OPT_TIMEOUT},
+    {"overload", no_argument, NULL, OPT_OVERLOAD},
+    {"attach-timeout", required_argument, NULL, OPT_ATTACH_TIMEOUT},
+    {NULL, 0, NULL, 0},
+};
+
+task_zmq_ctx_t main_zmq_ctx;
+
+static void usage(const char* name) {
+  fprintf(
+      stderr,
+      "Usage: %s -c mme.conf -s spgw.conf [--enbs N] [--ues N]\n"
+      "          [--in-flight N] [--rate N] [--imsi-base N] [--timeout S]\n"
+      "          [--overload] [--attach-timeout S]\n",
+      name);
+}
+
+/*
+ * Split the benchmark options from the MME ones, which are handed over to
+ * the parser of oai_mme.
+ */
+static int parse_opt_line(int argc, char* argv[], benchmark_config_t* config) {
+  char* mme_argv[5] = {argv[0]};
+  int mme_argc      = 1;
+  int c;
+
+  while ((c = getopt_long(argc, argv, "c:s:", long_options, NULL)) != -1) {
+    switch (c) {
+      case 'c':
+      case 's':
+        if (mme_argc > 3) {
+          usage(argv[0]);
+          return RETURNerror;
+        }
+        mme_argv[mme_argc++] = c == 'c' ? "-c" : "-s";
+        mme_argv[mme_argc++] = optarg;
+        break;
+      case OPT_ENBS:
+        config->nb_enbs = strtoul(optarg, NULL, 10);
+        break;
+      case OPT_UES:
+        config->nb_ues = strtoul(optarg, NULL, 10);
+        break;
+      case OPT_IN_FLIGHT:
+        config->max_in_flight = strtoul(optarg, NULL, 10);
+        break;
+      case OPT_RATE:
+        config->attach_rate = strtoul(optarg, NULL, 10);
+        break;
+      case OPT_IMSI_BASE:
+        config->imsi_base = strtoull(optarg, NULL, 10);
+        break;
+      case OPT_TIMEOUT:
+        config->timeout_sec = strtoul(optarg, NULL, 10);
+        break;
+      case OPT_OVERLOAD:
+        config->overload = true;
+        break;
+      case OPT_ATTACH_TIMEOUT:
+        config->attach_timeout_sec = strtoul(optarg, NULL, 10);
+        break;
+      default:
+        usage(argv[0]);
+        return RETURNerror;
+    }
+  }
+  if (config->nb_enbs == 0 || config->nb_ues == 0 ||
+      config->max_in_flight == 0 || config->attach_timeout_sec == 0) {
+    usage(argv[0]);
+    return RETURNerror;
+  }
+
+  // Restart getopt for the second parser
+  optind = 0;
+  return mme_config_embedded_spgw_parse_opt_line(
+      mme_argc, mme_argv, &mme_config, &spgw_config);
+}
+
+int main(int argc, char* argv[]) {
+  benchmark_config_t config = {
+      .nb_enbs            = DEFAULT_NB_ENBS,
+      .nb_ues             = DEFAULT_NB_UES,
+      .max_in_flight      = DEFAULT_MAX_IN_FLIGHT,
+      .imsi_base          = DEFAULT_IMSI_BASE,
+      .timeout_sec        = DEFAULT_TIMEOUT_SEC,
+      .attach_timeout_sec = DEFAULT_ATTACH_TIMEOUT_SEC,
+  };
+  int rc;
+
+  CHECK_INIT_RETURN(OAILOG_INIT(
+      MME_CONFIG_STRING_MME_CONFIG, OAILOG_LEVEL_ERROR, MAX_LOG_PROTOS));
+  CHECK_INIT_RETURN(shared_log_init(MAX_LOG_PROTOS));
+  CHECK_INIT_RETURN(itti_init(
+      TASK_MAX, THREAD_MAX, MESSAGES_ID_MAX, tasks_info, messages_info, NULL,
+      NULL));
+  CHECK_INIT_RETURN(timer_init());
+  shared_log_itti_connect();
+  OAILOG_ITTI_CONNECT();
+  init_task_context(
+      TASK_MAIN,
+      (task_id_t[]){TASK_MME_APP, TASK_SERVICE303, TASK_SERVICE303_SERVER,
+                    TASK_S6A, TASK_S1AP, TASK_SCTP, TASK_SPGW_APP, TASK_SGW_S8,
+                    TASK_GRPC_SERVICE, TASK_LOG, TASK_SHARED_TS_LOG},
+      11, NULL, &main_zmq_ctx);
+
+  CHECK_INIT_RETURN(parse_opt_line(argc, argv, &config));
+
+  // Stateful, without redis, with the data path behind the pipelined stub
+  mme_config.use_stateless                                 = false;
+  mme_config.enable_converged_core                         = false;
+  spgw_config.sgw_config.ovs_config.pipelined_managed_tbl0 = true;
+  if (config.overload) {
+    mme_config.enable_congestion_control = true;
+  }
+
+  config.mcc     = mme_config.served_tai.plmn_mcc[0];
+  config.mnc     = mme_config.served_tai.plmn_mnc[0];
+  config.mnc_len = mme_config.served_tai.plmn_mnc_len[0];
+  config.tac     = mme_config.served_tai.tac[0];
+
+  // Serve the MME peers before its tasks try to reach them
+  CHECK_INIT_RETURN(stub_services_start());
+  CHECK_INIT_RETURN(virtual_ran_start(&config));
+
+  OAILOG_LOG_CONFIGURE(&mme_config.log_config);
+  CHECK_INIT_RETURN(service303_init(&(mme_config.service303_config)));
+  event_client_init();
+  CHECK_INIT_RETURN(mme_app_init(&mme_config));
+  CHECK_INIT_RETURN(sctp_init(&mme_config));
+  CHECK_INIT_RETURN(spgw_app_init(&spgw_config, mme_config.use_stateless));
+  CHECK_INIT_RETURN(sgw_s8_init(&spgw_config.sgw_config));
+  CHECK_INIT_RETURN(s1ap_mme_init(&mme_config));
+  CHECK_INIT_RETURN(s6a_init(&mme_config));
+  CHECK_INIT_RETURN(grpc_service_init());
+
+  // SIGTERM is raised by the virtual RAN once the storm is over
+  itti_wait_tasks_end(&main_zmq_ctx);
+
+  stub_services_stop();
+  rc = virtual_ran_stop();
+  free_spgw_config(&spgw_config);
+  destroy_task_context(&main_zmq_ctx);
+  return rc == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
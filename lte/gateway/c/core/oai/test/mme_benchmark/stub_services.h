@@ -0,0 +1,36 @@
+/**
+ * Copyright 2020 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*! \file stub_services.h
+  \brief Local services the MME talks to, answering right away
+*/
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Serve subscriberdb, mobilityd, pipelined, sessiond, directoryd and eventd
+ * on their addresses of the service registry. Subscribers are all known and
+ * get the authentication vectors of benchmark_auth_vector.
+ * @return 0, -1 if a service could not be started
+ */
+int stub_services_start(void);
+
+void stub_services_stop(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,61 @@
+/**
+ * Copyright 2020 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*! \file virtual_ran.h
+  \brief Virtual eNBs and UEs attaching to the MME, in place of sctpd
+*/
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct benchmark_config_s {
+  uint32_t nb_enbs;
+  uint32_t nb_ues;         // Spread over the eNBs round robin
+  uint32_t max_in_flight;  // Attach procedures running at once
+  uint32_t attach_rate;    // Attach procedures started per second, 0 for max
+  uint64_t imsi_base;      // IMSI of the first UE, the others follow
+  uint32_t timeout_sec;    // Of the whole run, eNB setup included
+  // Attach storm overloading the MME: the eNBs hold back new attaches while
+  // in overload and the attaches not answered within attach_timeout_sec are
+  // retried, as by T3410
+  bool overload;
+  uint32_t attach_timeout_sec;
+  uint16_t mcc;
+  uint16_t mnc;
+  uint8_t mnc_len;
+  uint16_t tac;
+} benchmark_config_t;
+
+/*
+ * Serve the sctpd downlink socket and start the thread driving the attach
+ * storm once the MME has connected. When the storm is over the report is
+ * printed to stdout and SIGTERM is raised to end the ITTI tasks.
+ */
+int virtual_ran_start(const benchmark_config_t* config);
+
+/*
+ * Stop the virtual RAN.
+ * @return 0 if every UE attached, and in overload mode if the MME signalled
+ * its overload and recovered from it, -1 otherwise
+ */
+int virtual_ran_stop(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -59,7 +59,7 @@ class GTPApplicationTest : public ::testing::Test {
   virtual void SetUp() {
     gtp_app = new GTPApplication(
         TEST_GTP_MAC, TEST_GTP_PORT, TEST_MTR_PORT, TEST_INTERNAL_SAMPLING_POR,
-        TEST_INTERNAL_SAMPLING_FWD_TBL, TEST_UPLINK_PORT);
+        TEST_INTERNAL_SAMPLING_FWD_TBL, TEST_UPLINK_PORT, false);
     messenger = std::shared_ptr<MockMessenger>(new MockMessenger());
 
     controller = std::unique_ptr<OpenflowController>(
@@ -132,6 +132,11 @@ MATCHER_P(CheckEthType, eth_type, "") {
   return eth_type_field->value() == eth_type;
 }
 
+MATCHER_P(CheckCookie, cookie, "") {
+  auto msg = static_cast<of13::FlowMod*>(&arg);
+  return msg->cookie() == cookie;
+}
+
 MATCHER_P(CheckCommandType, command_type, "") {
   auto msg = static_cast<of13::FlowMod*>(&arg);
   return msg->command() == command_type;
@@ -1014,6 +1019,175 @@ TEST_F(GTPApplicationTest, TestDeleteTunnelS8) {
   controller->dispatch_event(del_tunnel);
 }
 
+// Adds a table 0 flow found on the switch to reply, an uplink flow when
+// in_tei is not 0
+static void add_flow_stats(
+    of13::MultipartReplyFlow& reply, uint64_t cookie, uint32_t in_port,
+    uint16_t eth_type, uint32_t in_tei) {
+  of13::FlowStats stats(0, 0, 0, 10, 0, 0, 0, cookie, 0, 0);
+  of13::InPort in_port_match(in_port);
+  stats.add_oxm_field(in_port_match);
+  if (in_tei != 0) {
+    of13::TUNNELId tunnel_id_match(in_tei);
+    stats.add_oxm_field(tunnel_id_match);
+  } else {
+    of13::EthType eth_type_match(eth_type);
+    stats.add_oxm_field(eth_type_match);
+  }
+  reply.add_flow_stats(stats);
+}
+
+// Adds every flow of an IPv4 S1 tunnel to reply
+static void add_tunnel_flow_stats(
+    of13::MultipartReplyFlow& reply, uint32_t in_tei, uint32_t gtp_port,
+    uint32_t uplink_port, uint32_t mtr_port) {
+  uint64_t cookie = (uint64_t) in_tei << 32;
+  add_flow_stats(reply, cookie, gtp_port, 0, in_tei);
+  for (uint32_t port : {uplink_port, mtr_port}) {
+    add_flow_stats(reply, cookie, port, 0x0800, 0);
+    add_flow_stats(reply, cookie, port, 0x0806, 0);
+  }
+}
+
+/*
+ * Test fixture reconciling the tunnels restored from the persisted state
+ */
+class GTPApplicationReconcileTest : public GTPApplicationTest {
+ protected:
+  virtual void SetUp() {
+    GTPApplicationTest::SetUp();
+    reconcile_app = new GTPApplication(
+        TEST_GTP_MAC, TEST_GTP_PORT, TEST_MTR_PORT, TEST_INTERNAL_SAMPLING_POR,
+        TEST_INTERNAL_SAMPLING_FWD_TBL, TEST_UPLINK_PORT, true);
+    reconcile_ctrl = std::unique_ptr<OpenflowController>(
+        new OpenflowController("127.0.0.1", 6666, 2, false, messenger));
+    for (auto event_type :
+         {openflow::EVENT_ADD_GTP_TUNNEL, openflow::EVENT_DELETE_GTP_TUNNEL,
+          openflow::EVENT_FLOW_STATS_REPLY,
+          openflow::EVENT_RECONCILE_GTP_TUNNELS}) {
+      reconcile_ctrl->register_for_event(reconcile_app, event_type);
+    }
+    ue_ip.s_addr  = inet_addr("0.0.0.1");
+    enb_ip.s_addr = inet_addr("0.0.0.2");
+  }
+
+  virtual void TearDown() {
+    reconcile_ctrl = NULL;
+    delete reconcile_app;
+    GTPApplicationTest::TearDown();
+  }
+
+  void dispatch_reply(of13::MultipartReplyFlow& reply) {
+    uint8_t* data = reply.pack();
+    reconcile_ctrl->dispatch_event(
+        FlowStatsReplyEvent(NULL, *reconcile_ctrl, data, reply.length()));
+  }
+
+  void replay_tunnel(uint32_t in_tei) {
+    AddGTPTunnelEvent add_tunnel(
+        ue_ip, NULL, 0, enb_ip, in_tei, in_tei + 100, imsi, 0);
+    reconcile_ctrl->dispatch_event(add_tunnel);
+  }
+
+  std::unique_ptr<OpenflowController> reconcile_ctrl;
+  GTPApplication* reconcile_app;
+  struct in_addr ue_ip;
+  struct in_addr enb_ip;
+  char imsi[16] = "001010000000013";
+};
+
+/*
+ * Test that with the persisted state, the restored tunnels found on the
+ * switch with all their flows are not added again, the others are, and the
+ * tunnels found on the switch that were not restored are deleted
+ */
+TEST_F(GTPApplicationReconcileTest, TestReconcileTunnels) {
+  uint32_t kept_tei    = 1;
+  uint32_t added_tei   = 2;
+  uint32_t stale_tei   = 3;
+  uint32_t partial_tei = 4;
+
+  // Flows found on the switch
+  of13::MultipartReplyFlow reply(1, 0);
+  add_tunnel_flow_stats(
+      reply, kept_tei, TEST_GTP_PORT, TEST_UPLINK_PORT, TEST_MTR_PORT);
+  add_flow_stats(
+      reply, (uint64_t) stale_tei << 32, TEST_GTP_PORT, 0, stale_tei);
+  add_flow_stats(
+      reply, (uint64_t) partial_tei << 32, TEST_GTP_PORT, 0, partial_tei);
+  reply.add_flow_stats(of13::FlowStats(0, 0, 0, 0, 0, 0, 0, 0, 0, 0));
+  dispatch_reply(reply);
+
+  // Only the flows of the tunnels missing some on the switch are added
+  EXPECT_CALL(
+      *messenger,
+      send_of_msg(
+          AllOf(
+              CheckCookie((uint64_t) added_tei << 32),
+              CheckCommandType(of13::OFPFC_ADD)),
+          _))
+      .Times(5);
+  EXPECT_CALL(
+      *messenger,
+      send_of_msg(
+          AllOf(
+              CheckCookie((uint64_t) partial_tei << 32),
+              CheckCommandType(of13::OFPFC_ADD)),
+          _))
+      .Times(5);
+  // All the flows of the stale tunnel are deleted at once
+  EXPECT_CALL(
+      *messenger,
+      send_of_msg(
+          AllOf(
+              CheckCookie((uint64_t) stale_tei << 32),
+              CheckCommandType(of13::OFPFC_DELETE)),
+          _))
+      .Times(1);
+
+  replay_tunnel(kept_tei);
+  replay_tunnel(added_tei);
+  replay_tunnel(partial_tei);
+  reconcile_ctrl->dispatch_event(
+      ExternalEvent(openflow::EVENT_RECONCILE_GTP_TUNNELS));
+}
+
+/*
+ * Test that when the switch has flows with the legacy cookie, e.g. discarding
+ * data of a suspended UE, the deletes of a tunnel also match the legacy
+ * cookie
+ */
+TEST_F(GTPApplicationReconcileTest, TestDeleteLegacyTunnelFlows) {
+  uint32_t in_tei = 1;
+
+  of13::MultipartReplyFlow reply(1, 0);
+  add_tunnel_flow_stats(
+      reply, in_tei, TEST_GTP_PORT, TEST_UPLINK_PORT, TEST_MTR_PORT);
+  add_flow_stats(reply, 1, TEST_GTP_PORT, 0, in_tei);
+  dispatch_reply(reply);
+  replay_tunnel(in_tei);
+  reconcile_ctrl->dispatch_event(
+      ExternalEvent(openflow::EVENT_RECONCILE_GTP_TUNNELS));
+
+  // Uplink, downlink and ARP flows from both ports
+  EXPECT_CALL(
+      *messenger,
+      send_of_msg(
+          AllOf(
+              CheckCookie((uint64_t) in_tei << 32),
+              CheckCommandType(of13::OFPFC_DELETE)),
+          _))
+      .Times(5);
+  EXPECT_CALL(
+      *messenger,
+      send_of_msg(
+          AllOf(CheckCookie(0), CheckCommandType(of13::OFPFC_DELETE)), _))
+      .Times(5);
+
+  DeleteGTPTunnelEvent del_tunnel(ue_ip, NULL, in_tei, 0);
+  reconcile_ctrl->dispatch_event(del_tunnel);
+}
+
 int main(int argc, char** argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
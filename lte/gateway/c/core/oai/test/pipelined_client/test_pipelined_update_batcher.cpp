@@ -0,0 +1,252 @@
+/**
+ * Copyright 2021 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "PipelinedUpdateBatcher.h"
+
+using grpc::Status;
+using ::testing::Test;
+
+namespace magma {
+namespace lte {
+
+// Records the RPCs issued by the batcher, the test completes them
+class PipelinedUpdateBatcherTest : public Test {
+ protected:
+  struct SentUpdate {
+    UESessionSet request;
+    PipelinedUpdateBatcher::UpdateCallback callback;
+  };
+  struct SentBatch {
+    UESessionSetBatch batch;
+    PipelinedUpdateBatcher::BatchCallback callback;
+  };
+
+  PipelinedUpdateBatcherTest()
+      : batcher_(
+            [this](
+                const UESessionSet& request,
+                PipelinedUpdateBatcher::UpdateCallback callback) {
+              std::lock_guard<std::mutex> lock(sent_mutex_);
+              updates_.push_back({request, std::move(callback)});
+              sent_cv_.notify_all();
+            },
+            [this](
+                const UESessionSetBatch& batch,
+                PipelinedUpdateBatcher::BatchCallback callback) {
+              std::lock_guard<std::mutex> lock(sent_mutex_);
+              batches_.push_back({batch, std::move(callback)});
+              sent_cv_.notify_all();
+            }) {}
+
+  // Queues the update of in_teid, its response is recorded in responses_
+  void update(uint32_t in_teid) {
+    UESessionSet request;
+    request.set_in_teid(in_teid);
+    batcher_.update_ue_state(
+        request, [this, in_teid](
+                     Status status, UESessionContextResponse response) {
+          std::lock_guard<std::mutex> lock(sent_mutex_);
+          responses_.push_back(
+              {in_teid, status.error_code(), response.operation_type()});
+        });
+  }
+
+  // Waits for the number of batches sent to reach num_batches
+  bool wait_batches(size_t num_batches, std::chrono::milliseconds timeout) {
+    std::unique_lock<std::mutex> lock(sent_mutex_);
+    return sent_cv_.wait_for(lock, timeout, [this, num_batches]() {
+      return batches_.size() >= num_batches;
+    });
+  }
+
+  size_t num_updates() {
+    std::lock_guard<std::mutex> lock(sent_mutex_);
+    return updates_.size();
+  }
+
+  size_t num_batches() {
+    std::lock_guard<std::mutex> lock(sent_mutex_);
+    return batches_.size();
+  }
+
+  // Completes a batch the way the RPC response loop does, outside of the
+  // batcher's locks
+  void complete_batch(
+      size_t i, const Status& status,
+      const UESessionContextResponseBatch& response) {
+    PipelinedUpdateBatcher::BatchCallback callback;
+    {
+      std::lock_guard<std::mutex> lock(sent_mutex_);
+      callback = batches_[i].callback;
+    }
+    callback(status, response);
+  }
+
+  void complete_update(size_t i, const Status& status) {
+    PipelinedUpdateBatcher::UpdateCallback callback;
+    {
+      std::lock_guard<std::mutex> lock(sent_mutex_);
+      callback = updates_[i].callback;
+    }
+    callback(status, UESessionContextResponse());
+  }
+
+  struct Response {
+    uint32_t in_teid;
+    grpc::StatusCode code;
+    uint32_t operation_type;
+  };
+
+  std::mutex sent_mutex_;
+  std::condition_variable sent_cv_;
+  std::vector<SentUpdate> updates_;
+  std::vector<SentBatch> batches_;
+  std::vector<Response> responses_;
+  // Last, destroyed first
+  PipelinedUpdateBatcher batcher_;
+};
+
+TEST_F(PipelinedUpdateBatcherTest, TestUnbatchedByDefault) {
+  update(1);
+  update(2);
+
+  EXPECT_EQ(2, num_updates());
+  EXPECT_EQ(0, num_batches());
+  EXPECT_EQ(1, updates_[0].request.in_teid());
+  EXPECT_EQ(2, updates_[1].request.in_teid());
+}
+
+TEST_F(PipelinedUpdateBatcherTest, TestFlushOnSize) {
+  // The window is long enough for the size to end the batch
+  batcher_.set_batching(4, 10000000);
+  for (uint32_t teid = 1; teid <= 3; teid++) {
+    update(teid);
+  }
+  EXPECT_EQ(0, num_batches());
+
+  update(4);
+  ASSERT_EQ(1, num_batches());
+  EXPECT_EQ(0, num_updates());
+  ASSERT_EQ(4, batches_[0].batch.sessions_size());
+  // Updates keep their order in the batch
+  for (int i = 0; i < 4; i++) {
+    EXPECT_EQ(i + 1, batches_[0].batch.sessions(i).in_teid());
+  }
+}
+
+TEST_F(PipelinedUpdateBatcherTest, TestFlushOnTimer) {
+  batcher_.set_batching(32, 2000);
+  update(1);
+  update(2);
+  update(3);
+
+  ASSERT_TRUE(wait_batches(1, std::chrono::seconds(5)));
+  EXPECT_EQ(0, num_updates());
+  EXPECT_EQ(3, batches_[0].batch.sessions_size());
+
+  // A lone update is sent as a single UpdateUEState once its window ends
+  update(4);
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  EXPECT_EQ(1, num_batches());
+  ASSERT_EQ(1, num_updates());
+  EXPECT_EQ(4, updates_[0].request.in_teid());
+}
+
+TEST_F(PipelinedUpdateBatcherTest, TestResponsesRouted) {
+  batcher_.set_batching(3, 10000000);
+  update(1);
+  update(2);
+  update(3);
+  ASSERT_EQ(1, num_batches());
+
+  // The batch lacks the response of the last update
+  UESessionContextResponseBatch response;
+  response.add_responses()->set_operation_type(10);
+  response.add_responses()->set_operation_type(20);
+  complete_batch(0, Status::OK, response);
+
+  ASSERT_EQ(3, responses_.size());
+  EXPECT_EQ(1, responses_[0].in_teid);
+  EXPECT_EQ(grpc::StatusCode::OK, responses_[0].code);
+  EXPECT_EQ(10, responses_[0].operation_type);
+  EXPECT_EQ(2, responses_[1].in_teid);
+  EXPECT_EQ(20, responses_[1].operation_type);
+  EXPECT_EQ(3, responses_[2].in_teid);
+  EXPECT_EQ(grpc::StatusCode::INTERNAL, responses_[2].code);
+}
+
+TEST_F(PipelinedUpdateBatcherTest, TestFailedBatch) {
+  batcher_.set_batching(2, 10000000);
+  update(1);
+  update(2);
+  ASSERT_EQ(1, num_batches());
+
+  complete_batch(
+      0, Status(grpc::StatusCode::DEADLINE_EXCEEDED, "timeout"),
+      UESessionContextResponseBatch());
+  ASSERT_EQ(2, responses_.size());
+  EXPECT_EQ(grpc::StatusCode::DEADLINE_EXCEEDED, responses_[0].code);
+  EXPECT_EQ(grpc::StatusCode::DEADLINE_EXCEEDED, responses_[1].code);
+
+  // Batching goes on
+  update(3);
+  update(4);
+  EXPECT_EQ(2, num_batches());
+  EXPECT_EQ(0, num_updates());
+}
+
+TEST_F(PipelinedUpdateBatcherTest, TestUnimplementedFallback) {
+  batcher_.set_batching(2, 10000000);
+  update(1);
+  update(2);
+  ASSERT_EQ(1, num_batches());
+  // Queued while the batch is in flight
+  update(3);
+
+  complete_batch(
+      0, Status(grpc::StatusCode::UNIMPLEMENTED, "unknown method"),
+      UESessionContextResponseBatch());
+  // The updates of the batch are resent one by one, followed by the queued
+  // one
+  ASSERT_EQ(3, num_updates());
+  for (int i = 0; i < 3; i++) {
+    EXPECT_EQ(i + 1, updates_[i].request.in_teid());
+  }
+  EXPECT_EQ(0, responses_.size());
+
+  // Each resent update answers its own callback
+  complete_update(1, Status::OK);
+  ASSERT_EQ(1, responses_.size());
+  EXPECT_EQ(2, responses_[0].in_teid);
+
+  // Later updates are no longer batched
+  update(4);
+  update(5);
+  EXPECT_EQ(1, num_batches());
+  EXPECT_EQ(5, num_updates());
+}
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
+
+}  // namespace lte
+}  // namespace magma
@@ -0,0 +1,98 @@
+/**
+ * Copyright 2020 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Lookup latency of the S1AP UE state by mme_ue_s1ap_id and by IMSI.
+ *
+ *   s1ap_state_lookup_benchmark [lookups]
+ *
+ * The state is filled with 1k, 10k and 100k UEs of a single eNB and the
+ * average time per lookup is printed for each size; it should stay flat as
+ * the number of UEs grows.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+extern "C" {
+#include "log.h"
+#include "s1ap_state.h"
+}
+
+namespace {
+constexpr sctp_assoc_id_t BENCH_ASSOC_ID = 7;
+constexpr imsi64_t BENCH_IMSI64_BASE     = 1010000000000;
+
+// Mimics s1ap_new_ue() followed by the MME UE ID and IMSI notifications
+void populate(uint32_t num_ues) {
+  for (uint32_t i = 1; i <= num_ues; i++) {
+    ue_description_t* ue_ref =
+        (ue_description_t*) calloc(1, sizeof(ue_description_t));
+    ue_ref->sctp_assoc_id  = BENCH_ASSOC_ID;
+    ue_ref->enb_ue_s1ap_id = i;
+    ue_ref->mme_ue_s1ap_id = i;
+    ue_ref->comp_s1ap_id   = S1AP_GENERATE_COMP_S1AP_ID(BENCH_ASSOC_ID, i);
+    hashtable_ts_insert(
+        get_s1ap_ue_state(), (const hash_key_t) ue_ref->comp_s1ap_id,
+        (void*) ue_ref);
+    s1ap_state_bind_ue_mmeid(ue_ref);
+    s1ap_imsi_map_insert(i, BENCH_IMSI64_BASE + i);
+  }
+}
+
+long elapsed_ns(std::chrono::steady_clock::time_point start) {
+  return (long) std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now() - start)
+      .count();
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  long lookups = argc > 1 ? atol(argv[1]) : 100000;
+  if (lookups <= 0) {
+    fprintf(stderr, "usage: %s [lookups]\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+  OAILOG_INIT("MME", OAILOG_LEVEL_INFO, MAX_LOG_PROTOS);
+
+  for (uint32_t num_ues : {1000, 10000, 100000}) {
+    s1ap_state_init(num_ues, 1, false);
+    populate(num_ues);
+
+    int misses = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (long i = 0; i < lookups; i++) {
+      mme_ue_s1ap_id_t ue_id = (i % num_ues) + 1;
+      misses += s1ap_state_get_ue_mmeid(ue_id) == nullptr;
+    }
+    long mmeid_ns = elapsed_ns(start);
+
+    start = std::chrono::steady_clock::now();
+    for (long i = 0; i < lookups; i++) {
+      imsi64_t imsi64 = BENCH_IMSI64_BASE + (i % num_ues) + 1;
+      misses += s1ap_state_get_ue_imsi(imsi64) == nullptr;
+    }
+    long imsi_ns = elapsed_ns(start);
+
+    printf(
+        "%u UEs: %ld ns/lookup by mme_ue_s1ap_id, %ld ns/lookup by IMSI\n",
+        num_ues, mmeid_ns / lookups, imsi_ns / lookups);
+    s1ap_state_exit();
+    if (misses) {
+      fprintf(stderr, "%d lookups missed with %u UEs\n", misses, num_ues);
+      return EXIT_FAILURE;
+    }
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,230 @@
+/**
+ * Copyright 2020 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+extern "C" {
+#include "s1ap_common.h"
+#include "s1ap_mme_encoder.h"
+#include "s1ap_mme_handlers.h"
+}
+
+namespace {
+constexpr int FUZZ_ITERATIONS = 20000;
+}  // namespace
+
+// The direct APER encoders are checked byte for byte against asn1c on
+// random fields
+class S1apMmeEncoderTest : public ::testing::Test {
+ protected:
+  std::mt19937 rng{1234};
+
+  // Random IDs of every octet count
+  uint32_t random_id(uint32_t max) {
+    uint32_t bits = std::uniform_int_distribution<uint32_t>(1, 32)(rng);
+    uint32_t id   = std::uniform_int_distribution<uint32_t>(0, max)(rng);
+    return bits == 32 ? id : id & ((1u << bits) - 1);
+  }
+
+  std::vector<uint8_t> asn1c_encode(S1ap_S1AP_PDU_t* pdu) {
+    uint8_t* buffer = NULL;
+    uint32_t length = 0;
+
+    EXPECT_EQ(s1ap_mme_encode_pdu(pdu, &buffer, &length), RETURNok);
+    std::vector<uint8_t> encoded(buffer, buffer + length);
+    free(buffer);
+    return encoded;
+  }
+
+  std::vector<uint8_t> asn1c_downlink_nas_transport(
+      mme_ue_s1ap_id_t mme_ue_s1ap_id, enb_ue_s1ap_id_t enb_ue_s1ap_id,
+      const std::vector<uint8_t>& nas_pdu) {
+    S1ap_S1AP_PDU_t pdu = {};
+    S1ap_DownlinkNASTransport_IEs_t* ie;
+
+    pdu.present = S1ap_S1AP_PDU_PR_initiatingMessage;
+    pdu.choice.initiatingMessage.procedureCode =
+        S1ap_ProcedureCode_id_downlinkNASTransport;
+    pdu.choice.initiatingMessage.criticality = S1ap_Criticality_ignore;
+    pdu.choice.initiatingMessage.value.present =
+        S1ap_InitiatingMessage__value_PR_DownlinkNASTransport;
+    S1ap_DownlinkNASTransport_t* out =
+        &pdu.choice.initiatingMessage.value.choice.DownlinkNASTransport;
+
+    ie = (S1ap_DownlinkNASTransport_IEs_t*) calloc(1, sizeof(*ie));
+    ie->id            = S1ap_ProtocolIE_ID_id_MME_UE_S1AP_ID;
+    ie->criticality   = S1ap_Criticality_reject;
+    ie->value.present = S1ap_DownlinkNASTransport_IEs__value_PR_MME_UE_S1AP_ID;
+    ie->value.choice.MME_UE_S1AP_ID = mme_ue_s1ap_id;
+    ASN_SEQUENCE_ADD(&out->protocolIEs.list, ie);
+
+    ie = (S1ap_DownlinkNASTransport_IEs_t*) calloc(1, sizeof(*ie));
+    ie->id            = S1ap_ProtocolIE_ID_id_eNB_UE_S1AP_ID;
+    ie->criticality   = S1ap_Criticality_reject;
+    ie->value.present = S1ap_DownlinkNASTransport_IEs__value_PR_ENB_UE_S1AP_ID;
+    ie->value.choice.ENB_UE_S1AP_ID = enb_ue_s1ap_id;
+    ASN_SEQUENCE_ADD(&out->protocolIEs.list, ie);
+
+    ie = (S1ap_DownlinkNASTransport_IEs_t*) calloc(1, sizeof(*ie));
+    ie->id            = S1ap_ProtocolIE_ID_id_NAS_PDU;
+    ie->criticality   = S1ap_Criticality_reject;
+    ie->value.present = S1ap_DownlinkNASTransport_IEs__value_PR_NAS_PDU;
+    OCTET_STRING_fromBuf(
+        &ie->value.choice.NAS_PDU, (const char*) nas_pdu.data(),
+        nas_pdu.size());
+    ASN_SEQUENCE_ADD(&out->protocolIEs.list, ie);
+    return asn1c_encode(&pdu);
+  }
+
+  std::vector<uint8_t> asn1c_ue_context_release_command(
+      mme_ue_s1ap_id_t mme_ue_s1ap_id, enb_ue_s1ap_id_t enb_ue_s1ap_id,
+      S1ap_Cause_PR cause_type, long cause_value) {
+    S1ap_S1AP_PDU_t pdu = {};
+    S1ap_UEContextReleaseCommand_IEs_t* ie;
+
+    pdu.present = S1ap_S1AP_PDU_PR_initiatingMessage;
+    pdu.choice.initiatingMessage.procedureCode =
+        S1ap_ProcedureCode_id_UEContextRelease;
+    pdu.choice.initiatingMessage.criticality = S1ap_Criticality_reject;
+    pdu.choice.initiatingMessage.value.present =
+        S1ap_InitiatingMessage__value_PR_UEContextReleaseCommand;
+    S1ap_UEContextReleaseCommand_t* out =
+        &pdu.choice.initiatingMessage.value.choice.UEContextReleaseCommand;
+
+    ie = (S1ap_UEContextReleaseCommand_IEs_t*) calloc(1, sizeof(*ie));
+    ie->id            = S1ap_ProtocolIE_ID_id_UE_S1AP_IDs;
+    ie->criticality   = S1ap_Criticality_reject;
+    ie->value.present = S1ap_UEContextReleaseCommand_IEs__value_PR_UE_S1AP_IDs;
+    ie->value.choice.UE_S1AP_IDs.present = S1ap_UE_S1AP_IDs_PR_uE_S1AP_ID_pair;
+    ie->value.choice.UE_S1AP_IDs.choice.uE_S1AP_ID_pair.mME_UE_S1AP_ID =
+        mme_ue_s1ap_id;
+    ie->value.choice.UE_S1AP_IDs.choice.uE_S1AP_ID_pair.eNB_UE_S1AP_ID =
+        enb_ue_s1ap_id;
+    ASN_SEQUENCE_ADD(&out->protocolIEs.list, ie);
+
+    ie = (S1ap_UEContextReleaseCommand_IEs_t*) calloc(1, sizeof(*ie));
+    ie->id            = S1ap_ProtocolIE_ID_id_Cause;
+    ie->criticality   = S1ap_Criticality_ignore;
+    ie->value.present = S1ap_UEContextReleaseCommand_IEs__value_PR_Cause;
+    s1ap_mme_set_cause(&ie->value.choice.Cause, cause_type, cause_value);
+    ASN_SEQUENCE_ADD(&out->protocolIEs.list, ie);
+    return asn1c_encode(&pdu);
+  }
+};
+
+TEST_F(S1apMmeEncoderTest, TestDownlinkNasTransportMatchesAsn1c) {
+  std::vector<uint8_t> buffer(16384 + S1AP_DOWNLINK_NAS_TRANSPORT_OVERHEAD, 0);
+
+  for (int i = 0; i < FUZZ_ITERATIONS; i++) {
+    mme_ue_s1ap_id_t mme_ue_s1ap_id = random_id(0xffffffff);
+    enb_ue_s1ap_id_t enb_ue_s1ap_id = random_id(0xffffff);
+    // Mostly short NAS PDUs, with lengths around the 128 octet length
+    // determinant boundary and up to close to the 16K fragmentation one
+    uint32_t max_length = i % 10 == 0 ? 16000 : i % 2 ? 255 : 64;
+    std::vector<uint8_t> nas_pdu(
+        std::uniform_int_distribution<uint32_t>(0, max_length)(rng));
+    for (auto& octet : nas_pdu) {
+      octet = rng();
+    }
+
+    int length = s1ap_mme_encode_downlink_nas_transport(
+        mme_ue_s1ap_id, enb_ue_s1ap_id, nas_pdu.data(), nas_pdu.size(),
+        buffer.data(), buffer.size());
+    std::vector<uint8_t> expected =
+        asn1c_downlink_nas_transport(mme_ue_s1ap_id, enb_ue_s1ap_id, nas_pdu);
+    ASSERT_GT(length, 0);
+    ASSERT_LE(
+        (size_t) length, nas_pdu.size() + S1AP_DOWNLINK_NAS_TRANSPORT_OVERHEAD);
+    ASSERT_EQ(
+        std::vector<uint8_t>(buffer.begin(), buffer.begin() + length),
+        expected)
+        << "MME UE S1AP ID " << mme_ue_s1ap_id << " eNB UE S1AP ID "
+        << enb_ue_s1ap_id << " NAS PDU length " << nas_pdu.size();
+  }
+}
+
+TEST_F(S1apMmeEncoderTest, TestDownlinkNasTransportOutOfScope) {
+  std::vector<uint8_t> nas_pdu(16384, 0);
+  std::vector<uint8_t> buffer(
+      nas_pdu.size() + S1AP_DOWNLINK_NAS_TRANSPORT_OVERHEAD, 0);
+
+  // Fragmented NAS PDU
+  EXPECT_EQ(
+      s1ap_mme_encode_downlink_nas_transport(
+          1, 1, nas_pdu.data(), nas_pdu.size(), buffer.data(), buffer.size()),
+      -1);
+  // eNB UE S1AP ID out of range
+  EXPECT_EQ(
+      s1ap_mme_encode_downlink_nas_transport(
+          1, 0x1000000, nas_pdu.data(), 10, buffer.data(), buffer.size()),
+      -1);
+  // Buffer too short
+  EXPECT_EQ(
+      s1ap_mme_encode_downlink_nas_transport(
+          1, 1, nas_pdu.data(), 10, buffer.data(), 20),
+      -1);
+}
+
+TEST_F(S1apMmeEncoderTest, TestUeContextReleaseCommandMatchesAsn1c) {
+  // Values of the root of each Cause enumeration
+  const std::vector<std::pair<S1ap_Cause_PR, long>> causes = {
+      {S1ap_Cause_PR_radioNetwork,
+       S1ap_CauseRadioNetwork_x2_handover_triggered + 1},
+      {S1ap_Cause_PR_transport, S1ap_CauseTransport_unspecified + 1},
+      {S1ap_Cause_PR_nas, S1ap_CauseNas_unspecified + 1},
+      {S1ap_Cause_PR_protocol, S1ap_CauseProtocol_unspecified + 1},
+      {S1ap_Cause_PR_misc, S1ap_CauseMisc_unknown_PLMN + 1},
+  };
+  uint8_t buffer[S1AP_UE_CONTEXT_RELEASE_COMMAND_MAX_LENGTH];
+
+  for (int i = 0; i < FUZZ_ITERATIONS; i++) {
+    mme_ue_s1ap_id_t mme_ue_s1ap_id = random_id(0xffffffff);
+    enb_ue_s1ap_id_t enb_ue_s1ap_id = random_id(0xffffff);
+    const auto& cause               = causes[rng() % causes.size()];
+    long cause_value =
+        std::uniform_int_distribution<long>(0, cause.second - 1)(rng);
+
+    int length = s1ap_mme_encode_ue_context_release_command(
+        mme_ue_s1ap_id, enb_ue_s1ap_id, cause.first, cause_value, buffer,
+        sizeof(buffer));
+    std::vector<uint8_t> expected = asn1c_ue_context_release_command(
+        mme_ue_s1ap_id, enb_ue_s1ap_id, cause.first, cause_value);
+    ASSERT_GT(length, 0);
+    ASSERT_EQ(std::vector<uint8_t>(buffer, buffer + length), expected)
+        << "MME UE S1AP ID " << mme_ue_s1ap_id << " eNB UE S1AP ID "
+        << enb_ue_s1ap_id << " cause " << cause.first << "/" << cause_value;
+  }
+}
+
+TEST_F(S1apMmeEncoderTest, TestUeContextReleaseCommandOutOfScope) {
+  uint8_t buffer[S1AP_UE_CONTEXT_RELEASE_COMMAND_MAX_LENGTH];
+
+  // Extension of the CauseRadioNetwork enumeration
+  EXPECT_EQ(
+      s1ap_mme_encode_ue_context_release_command(
+          1, 1, S1ap_Cause_PR_radioNetwork,
+          S1ap_CauseRadioNetwork_redirection_towards_1xRTT, buffer,
+          sizeof(buffer)),
+      -1);
+  EXPECT_EQ(
+      s1ap_mme_encode_ue_context_release_command(
+          1, 1, S1ap_Cause_PR_NOTHING, 0, buffer, sizeof(buffer)),
+      -1);
+  EXPECT_EQ(
+      s1ap_mme_encode_ue_context_release_command(
+          1, 1, S1ap_Cause_PR_nas, S1ap_CauseNas_detach, buffer, 10),
+      -1);
+}
@@ -0,0 +1,125 @@
+/**
+ * Copyright 2020 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+
+extern "C" {
+#include "log.h"
+#include "s1ap_state.h"
+}
+
+namespace {
+constexpr sctp_assoc_id_t TEST_ASSOC_ID = 7;
+constexpr imsi64_t TEST_IMSI64_BASE     = 1010000000000;
+}  // namespace
+
+class S1apStateLookupTest : public ::testing::Test {
+ protected:
+  void init_state(uint32_t max_ues) { s1ap_state_init(max_ues, 1, false); }
+
+  virtual void TearDown() { s1ap_state_exit(); }
+
+  // Mimics s1ap_new_ue() followed by the MME UE ID notification
+  ue_description_t* add_ue(
+      sctp_assoc_id_t assoc_id, enb_ue_s1ap_id_t enb_ue_s1ap_id,
+      mme_ue_s1ap_id_t mme_ue_s1ap_id) {
+    ue_description_t* ue_ref =
+        (ue_description_t*) calloc(1, sizeof(ue_description_t));
+    ue_ref->sctp_assoc_id  = assoc_id;
+    ue_ref->enb_ue_s1ap_id = enb_ue_s1ap_id;
+    ue_ref->mme_ue_s1ap_id = mme_ue_s1ap_id;
+    ue_ref->comp_s1ap_id =
+        S1AP_GENERATE_COMP_S1AP_ID(assoc_id, enb_ue_s1ap_id);
+    EXPECT_EQ(
+        hashtable_ts_insert(
+            get_s1ap_ue_state(), (const hash_key_t) ue_ref->comp_s1ap_id,
+            (void*) ue_ref),
+        HASH_TABLE_OK);
+    s1ap_state_bind_ue_mmeid(ue_ref);
+    return ue_ref;
+  }
+
+  // Mimics s1ap_remove_ue()
+  void remove_ue(ue_description_t* ue_ref) {
+    mme_ue_s1ap_id_t mme_ue_s1ap_id = ue_ref->mme_ue_s1ap_id;
+    s1ap_state_unbind_ue_mmeid(ue_ref);
+    hashtable_ts_free(get_s1ap_ue_state(), ue_ref->comp_s1ap_id);
+    s1ap_imsi_map_remove(mme_ue_s1ap_id);
+  }
+
+  void populate(uint32_t num_ues) {
+    for (uint32_t i = 1; i <= num_ues; i++) {
+      add_ue(TEST_ASSOC_ID, i, i);
+      s1ap_imsi_map_insert(i, TEST_IMSI64_BASE + i);
+    }
+  }
+};
+
+TEST_F(S1apStateLookupTest, TestLookupByMmeUeIdAndImsi) {
+  init_state(100);
+  populate(10);
+
+  for (mme_ue_s1ap_id_t ue_id = 1; ue_id <= 10; ue_id++) {
+    ue_description_t* ue_ref = s1ap_state_get_ue_mmeid(ue_id);
+    ASSERT_NE(ue_ref, nullptr);
+    EXPECT_EQ(ue_ref->enb_ue_s1ap_id, ue_id);
+    EXPECT_EQ(s1ap_state_get_ue_imsi(TEST_IMSI64_BASE + ue_id), ue_ref);
+  }
+  EXPECT_EQ(s1ap_state_get_ue_mmeid(11), nullptr);
+  EXPECT_EQ(s1ap_state_get_ue_imsi(TEST_IMSI64_BASE + 11), nullptr);
+  EXPECT_EQ(s1ap_state_get_ue_imsi(INVALID_IMSI64), nullptr);
+
+  // Re-inserting the same IMSI reports it so that state is not re-written
+  EXPECT_EQ(
+      s1ap_imsi_map_insert(1, TEST_IMSI64_BASE + 1),
+      HASH_TABLE_SAME_KEY_VALUE_EXISTS);
+
+  // A re-attach under a new mme_ue_s1ap_id takes over the IMSI; releasing
+  // the old context does not hide the new one
+  ue_description_t* old_ue_ref = s1ap_state_get_ue_mmeid(2);
+  ue_description_t* new_ue_ref = add_ue(TEST_ASSOC_ID, 20, 20);
+  s1ap_imsi_map_insert(20, TEST_IMSI64_BASE + 2);
+  EXPECT_EQ(s1ap_state_get_ue_imsi(TEST_IMSI64_BASE + 2), new_ue_ref);
+  remove_ue(old_ue_ref);
+  EXPECT_EQ(s1ap_state_get_ue_mmeid(2), nullptr);
+  EXPECT_EQ(s1ap_state_get_ue_imsi(TEST_IMSI64_BASE + 2), new_ue_ref);
+
+  remove_ue(new_ue_ref);
+  EXPECT_EQ(s1ap_state_get_ue_mmeid(20), nullptr);
+  EXPECT_EQ(s1ap_state_get_ue_imsi(TEST_IMSI64_BASE + 2), nullptr);
+}
+
+TEST_F(S1apStateLookupTest, TestHandover) {
+  init_state(100);
+  populate(1);
+  ue_description_t* src_ue_ref = s1ap_state_get_ue_mmeid(1);
+  ASSERT_NE(src_ue_ref, nullptr);
+
+  // The target eNB context takes the mme_ue_s1ap_id over while the source
+  // context still exists
+  ue_description_t* tgt_ue_ref = add_ue(TEST_ASSOC_ID + 1, 5, 1);
+  EXPECT_EQ(s1ap_state_get_ue_mmeid(1), tgt_ue_ref);
+
+  // Removing the source context must keep the target one reachable
+  s1ap_state_unbind_ue_mmeid(src_ue_ref);
+  hashtable_ts_free(get_s1ap_ue_state(), src_ue_ref->comp_s1ap_id);
+  EXPECT_EQ(s1ap_state_get_ue_mmeid(1), tgt_ue_ref);
+  EXPECT_EQ(s1ap_state_get_ue_imsi(TEST_IMSI64_BASE + 1), tgt_ue_ref);
+}
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  OAILOG_INIT("MME", OAILOG_LEVEL_INFO, MAX_LOG_PROTOS);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,180 @@
+/**
+ * Copyright 2021 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <string.h>
+#include <string>
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "bstrlib.h"
+#include "dynamic_memory_check.h"
+#include "pgw_pcef_emulation.h"
+}
+
+namespace magma {
+namespace lte {
+
+class PgwPcefEmulationTest : public ::testing::Test {
+ protected:
+  virtual void SetUp() {
+    memset(&pgw_config, 0, sizeof(pgw_config));
+    pgw_config.ue_pool_addr[0].s_addr = htonl(0xC0A88000);  // 192.168.128.0
+    pgw_config.ue_pool_mask[0]        = 24;
+  }
+
+  virtual void TearDown() { pgw_pcef_emulation_exit(); }
+
+  // Stages the marking rules of an SDF filter matching an IP protocol
+  void stage_filter(sdf_id_t sdf_id, uint8_t protocol) {
+    sdf_filter_t filter = {};
+    filter.direction    = TRAFFIC_FLOW_TEMPLATE_BIDIRECTIONAL;
+    filter.packetfiltercontents.flags =
+        TRAFFIC_FLOW_TEMPLATE_PROTOCOL_NEXT_HEADER_FLAG;
+    filter.packetfiltercontents.protocolidentifier_nextheader = protocol;
+    pgw_pcef_emulation_apply_sdf_filter(&filter, sdf_id, &pgw_config);
+  }
+
+  // Returns the pending transaction, empty if there is none
+  std::string prepare_commit() {
+    bstring transaction = pgw_pcef_emulation_prepare_commit();
+    if (!transaction) {
+      return "";
+    }
+    std::string result(bdata(transaction), blength(transaction));
+    bdestroy_wrapper(&transaction);
+    return result;
+  }
+
+  static int count(const std::string& transaction, const std::string& what) {
+    int n = 0;
+    for (size_t pos = transaction.find(what); pos != std::string::npos;
+         pos    = transaction.find(what, pos + 1)) {
+      n++;
+    }
+    return n;
+  }
+
+  static std::string mark(sdf_id_t sdf_id) {
+    return "--set-mark " + std::to_string(sdf_id) + "\n";
+  }
+
+  pgw_config_t pgw_config;
+};
+
+TEST_F(PgwPcefEmulationTest, TestSingleTransaction) {
+  stage_filter(SDF_ID_TEST_PING, IPPROTO_ICMP);
+  stage_filter(SDF_ID_GBR_VOLTE_40K, IPPROTO_UDP);
+  // Staging the same filter twice does not duplicate its rules
+  stage_filter(SDF_ID_TEST_PING, IPPROTO_ICMP);
+
+  std::string transaction = prepare_commit();
+  EXPECT_EQ(0, transaction.find("*mangle\n"));
+  EXPECT_EQ(transaction.size() - 7, transaction.rfind("COMMIT\n"));
+  // POSTROUTING and OUTPUT rules for each filter
+  EXPECT_EQ(4, count(transaction, "-I "));
+  EXPECT_EQ(2, count(transaction, mark(SDF_ID_TEST_PING)));
+  EXPECT_EQ(2, count(transaction, mark(SDF_ID_GBR_VOLTE_40K)));
+  EXPECT_EQ(RETURNok, pgw_pcef_emulation_commit_result(0));
+
+  // Everything is programmed
+  EXPECT_EQ("", prepare_commit());
+}
+
+TEST_F(PgwPcefEmulationTest, TestOnlyChangesProgrammed) {
+  stage_filter(SDF_ID_TEST_PING, IPPROTO_ICMP);
+  prepare_commit();
+  EXPECT_EQ(RETURNok, pgw_pcef_emulation_commit_result(0));
+
+  stage_filter(SDF_ID_GBR_VOLTE_40K, IPPROTO_UDP);
+  std::string transaction = prepare_commit();
+  EXPECT_EQ(2, count(transaction, "-I "));
+  EXPECT_EQ(0, count(transaction, mark(SDF_ID_TEST_PING)));
+  EXPECT_EQ(2, count(transaction, mark(SDF_ID_GBR_VOLTE_40K)));
+  EXPECT_EQ(RETURNok, pgw_pcef_emulation_commit_result(0));
+}
+
+TEST_F(PgwPcefEmulationTest, TestFailedTransactionRetried) {
+  stage_filter(SDF_ID_TEST_PING, IPPROTO_ICMP);
+  std::string transaction = prepare_commit();
+  ASSERT_EQ(2, count(transaction, "-I "));
+  EXPECT_EQ(RETURNerror, pgw_pcef_emulation_commit_result(1));
+
+  // The rules of the failed transaction are retried one by one
+  for (int i = 0; i < 2; i++) {
+    transaction = prepare_commit();
+    EXPECT_EQ(1, count(transaction, "-I "));
+    EXPECT_EQ(1, count(transaction, mark(SDF_ID_TEST_PING)));
+    EXPECT_EQ(RETURNok, pgw_pcef_emulation_commit_result(0));
+  }
+  EXPECT_EQ("", prepare_commit());
+
+  // Rules are batched again once the retry is done
+  stage_filter(SDF_ID_GBR_VOLTE_40K, IPPROTO_UDP);
+  EXPECT_EQ(2, count(prepare_commit(), "-I "));
+  EXPECT_EQ(RETURNok, pgw_pcef_emulation_commit_result(0));
+}
+
+TEST_F(PgwPcefEmulationTest, TestRejectedRuleIsolated) {
+  stage_filter(SDF_ID_TEST_PING, IPPROTO_ICMP);
+  stage_filter(SDF_ID_GBR_VOLTE_40K, IPPROTO_UDP);
+  prepare_commit();
+  EXPECT_EQ(RETURNerror, pgw_pcef_emulation_commit_result(1));
+
+  // Only the first rule is rejected, the others are still programmed
+  std::string transaction = prepare_commit();
+  EXPECT_EQ(RETURNerror, pgw_pcef_emulation_commit_result(1));
+  int programmed = 0;
+  for (transaction = prepare_commit(); transaction != "";
+       transaction = prepare_commit()) {
+    EXPECT_EQ(1, count(transaction, "-I "));
+    EXPECT_EQ(RETURNok, pgw_pcef_emulation_commit_result(0));
+    programmed++;
+  }
+  EXPECT_EQ(3, programmed);
+
+  // The rejected rule is not retried
+  stage_filter(SDF_ID_TEST_PING, IPPROTO_ICMP);
+  EXPECT_EQ("", prepare_commit());
+}
+
+TEST_F(PgwPcefEmulationTest, TestStagedWhileInFlight) {
+  stage_filter(SDF_ID_TEST_PING, IPPROTO_ICMP);
+  std::string first = prepare_commit();
+  ASSERT_NE("", first);
+
+  // Only one transaction is in flight at a time
+  stage_filter(SDF_ID_GBR_VOLTE_40K, IPPROTO_UDP);
+  EXPECT_EQ("", prepare_commit());
+  EXPECT_EQ(0, count(first, mark(SDF_ID_GBR_VOLTE_40K)));
+
+  EXPECT_EQ(RETURNok, pgw_pcef_emulation_commit_result(0));
+  std::string second = prepare_commit();
+  EXPECT_EQ(2, count(second, "-I "));
+  EXPECT_EQ(2, count(second, mark(SDF_ID_GBR_VOLTE_40K)));
+  EXPECT_EQ(RETURNok, pgw_pcef_emulation_commit_result(0));
+}
+
+TEST_F(PgwPcefEmulationTest, TestUnexpectedResult) {
+  // Results of transactions not in flight are ignored
+  EXPECT_EQ(RETURNerror, pgw_pcef_emulation_commit_result(0));
+  stage_filter(SDF_ID_TEST_PING, IPPROTO_ICMP);
+  EXPECT_NE("", prepare_commit());
+}
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
+}  // namespace lte
+}  // namespace magma
@@ -50,7 +50,8 @@ void AsyncMobilitydClient::get_subscriber_id_from_ip_rpc(
     const IPAddress& request,
     std::function<void(Status, SubscriberID)> callback) {
   auto local_resp = new AsyncLocalResponse<SubscriberID>(
-      std::move(callback), RESPONSE_TIMEOUT_SECONDS);
+      std::move(callback), RESPONSE_TIMEOUT_SECONDS,
+      "MobilityService/GetSubscriberIDFromIP");
   local_resp->set_response_reader(std::move(stub_->AsyncGetSubscriberIDFromIP(
       local_resp->get_context(), request, &queue_)));
 }
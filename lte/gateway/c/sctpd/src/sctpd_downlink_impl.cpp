@@ -90,6 +90,34 @@ Status SctpdDownlinkImpl::SendDl(
   return Status::OK;
 }
 
+Status SctpdDownlinkImpl::SendDlBatch(
+    ServerContext* context, const SendDlBatchReq* req, SendDlBatchRes* res) {
+  MLOG(MDEBUG) << "SctpdDownlinkImpl::SendDlBatch starting, "
+               << std::to_string(req->targets_size()) << " targets";
+
+  auto& connection =
+      req->ppid() == S1AP ? _sctp_4G_connection : _sctp_5G_connection;
+
+  for (const auto& target : req->targets()) {
+    auto result = SendDlRes::SEND_DL_FAIL;
+    if (connection != nullptr &&
+        target.payload_index() < (uint32_t) req->payloads_size()) {
+      try {
+        connection->Send(
+            target.assoc_id(), target.stream(),
+            req->payloads(target.payload_index()));
+        result = SendDlRes::SEND_DL_OK;
+      } catch (...) {
+        MLOG(MERROR) << "SctpdDownlinkImpl::SendDlBatch failed for assoc "
+                     << std::to_string(target.assoc_id());
+      }
+    }
+    res->add_results(result);
+  }
+
+  return Status::OK;
+}
+
 void SctpdDownlinkImpl::stop() {
   if (_sctp_4G_connection != nullptr) {
     _sctp_4G_connection->Close();
@@ -48,6 +48,12 @@ class SctpdDownlinkImpl final : public SctpdDownlink::Service {
       ServerContext* context, const SendDlReq* request,
       SendDlRes* response) override;
 
+  // Implementation of SctpdDownlink.SendDlBatch method (see sctpd.proto for
+  // more info)
+  Status SendDlBatch(
+      ServerContext* context, const SendDlBatchReq* request,
+      SendDlBatchRes* response) override;
+
   // Implementation of SctpdDownlink.create_sctp_connection method
   //(creates 4G/5G sctp connection)
   Status create_sctp_connection(
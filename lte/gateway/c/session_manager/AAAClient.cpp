@@ -67,10 +67,15 @@ namespace aaa {
 AsyncAAAClient::AsyncAAAClient(std::shared_ptr<grpc::Channel> channel)
     : stub_(accounting::NewStub(channel)) {}
 
+AsyncAAAClient::AsyncAAAClient(
+    std::shared_ptr<grpc::Channel> channel, magma::GRPCRuntime& runtime)
+    : magma::GRPCReceiver(runtime), stub_(accounting::NewStub(channel)) {}
+
 AsyncAAAClient::AsyncAAAClient()
     : AsyncAAAClient(
           magma::ServiceRegistrySingleton::Instance()->GetGrpcChannel(
-              "aaa_server", magma::ServiceRegistrySingleton::LOCAL)) {}
+              "aaa_server", magma::ServiceRegistrySingleton::LOCAL),
+          magma::GRPCRuntime::get_instance()) {}
 
 bool AsyncAAAClient::terminate_session(
     const std::string& radius_session_id, const std::string& imsi) {
@@ -111,7 +116,7 @@ void AsyncAAAClient::add_sessions_rpc(
     const add_sessions_request& request,
     std::function<void(Status, acct_resp)> callback) {
   auto local_resp = new magma::AsyncLocalResponse<acct_resp>(
-      std::move(callback), RESPONSE_TIMEOUT);
+      std::move(callback), RESPONSE_TIMEOUT, "accounting/add_sessions");
   local_resp->set_response_reader(std::move(
       stub_->Asyncadd_sessions(local_resp->get_context(), request, &queue_)));
 }
@@ -120,7 +125,7 @@ void AsyncAAAClient::terminate_session_rpc(
     const terminate_session_request& request,
     std::function<void(Status, acct_resp)> callback) {
   auto local_resp = new magma::AsyncLocalResponse<acct_resp>(
-      std::move(callback), RESPONSE_TIMEOUT);
+      std::move(callback), RESPONSE_TIMEOUT, "accounting/terminate_session");
   local_resp->set_response_reader(std::move(stub_->Asyncterminate_session(
       local_resp->get_context(), request, &queue_)));
 }
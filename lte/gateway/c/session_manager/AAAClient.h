@@ -49,6 +49,13 @@ class AsyncAAAClient : public magma::GRPCReceiver, public AAAClient {
 
   explicit AsyncAAAClient(std::shared_ptr<grpc::Channel> aaa_channel);
 
+  /**
+   * Responses are served by a queue of runtime, rpc_response_loop does not
+   * have to be run. The default constructor uses the shared runtime.
+   */
+  AsyncAAAClient(
+      std::shared_ptr<grpc::Channel> aaa_channel, magma::GRPCRuntime& runtime);
+
   bool terminate_session(
       const std::string& radius_session_id, const std::string& imsi);
 
@@ -20,16 +20,23 @@ AsyncAmfServiceClient::AsyncAmfServiceClient(
     std::shared_ptr<grpc::Channel> channel)
     : stub_(SmfPduSessionSmContext::NewStub(channel)) {}
 
+AsyncAmfServiceClient::AsyncAmfServiceClient(
+    std::shared_ptr<grpc::Channel> channel, GRPCRuntime& runtime)
+    : GRPCReceiver(runtime),
+      stub_(SmfPduSessionSmContext::NewStub(channel)) {}
+
 AsyncAmfServiceClient::AsyncAmfServiceClient()
     : AsyncAmfServiceClient(
           ServiceRegistrySingleton::Instance()->GetGrpcChannel(
-              "amf_service", ServiceRegistrySingleton::LOCAL)) {}
+              "amf_service", ServiceRegistrySingleton::LOCAL),
+          GRPCRuntime::get_instance()) {}
 
 bool AsyncAmfServiceClient::handle_response_to_access(
     const magma::SetSMSessionContextAccess& response) {
   MLOG(MDEBUG) << "Sending Set SM Session Response from SMF ";
   auto local_resp = new AsyncLocalResponse<SmContextVoid>(
-      std::move(callback), RESPONSE_TIMEOUT);
+      std::move(callback), RESPONSE_TIMEOUT,
+      "SmfPduSessionSmContext/SetSmfSessionContext");
   local_resp->set_response_reader(std::move(stub_->AsyncSetSmfSessionContext(
       local_resp->get_context(), response, &queue_)));
   return true;
@@ -39,7 +46,8 @@ bool AsyncAmfServiceClient::handle_notification_to_access(
     const magma::SetSmNotificationContext& notif) {
   MLOG(MDEBUG) << "Sending Set SM Session Notification from SMF ";
   auto local_resp = new AsyncLocalResponse<SmContextVoid>(
-      std::move(callback), RESPONSE_TIMEOUT);
+      std::move(callback), RESPONSE_TIMEOUT,
+      "SmfPduSessionSmContext/SetAmfNotification");
   local_resp->set_response_reader(std::move(stub_->AsyncSetAmfNotification(
       local_resp->get_context(), notif, &queue_)));
   return true;
@@ -43,6 +43,13 @@ class AsyncAmfServiceClient : public GRPCReceiver, public AmfServiceClient {
   AsyncAmfServiceClient();
   AsyncAmfServiceClient(std::shared_ptr<grpc::Channel> amf_srv_channel);
 
+  /**
+   * Responses are served by a queue of runtime, rpc_response_loop does not
+   * have to be run. The default constructor uses the shared runtime.
+   */
+  AsyncAmfServiceClient(
+      std::shared_ptr<grpc::Channel> amf_srv_channel, GRPCRuntime& runtime);
+
   /* This will send response back to AMF for all three request messages
    * i.e. establish, modification and release messages
    */
@@ -26,16 +26,22 @@ AsyncDirectorydClient::AsyncDirectorydClient(
     std::shared_ptr<grpc::Channel> channel)
     : stub_(GatewayDirectoryService::NewStub(channel)) {}
 
+AsyncDirectorydClient::AsyncDirectorydClient(
+    std::shared_ptr<grpc::Channel> channel, GRPCRuntime& runtime)
+    : GRPCReceiver(runtime), stub_(GatewayDirectoryService::NewStub(channel)) {}
+
 AsyncDirectorydClient::AsyncDirectorydClient()
     : AsyncDirectorydClient(
           ServiceRegistrySingleton::Instance()->GetGrpcChannel(
-              "directoryd", ServiceRegistrySingleton::LOCAL)) {}
+              "directoryd", ServiceRegistrySingleton::LOCAL),
+          GRPCRuntime::get_instance()) {}
 
 void AsyncDirectorydClient::update_directoryd_record(
     const UpdateRecordRequest& request,
     std::function<void(Status status, Void)> callback) {
-  auto local_response =
-      new AsyncLocalResponse<Void>(std::move(callback), RESPONSE_TIMEOUT);
+  auto local_response = new AsyncLocalResponse<Void>(
+      std::move(callback), RESPONSE_TIMEOUT,
+      "GatewayDirectoryService/UpdateRecord");
   local_response->set_response_reader(std::move(stub_->AsyncUpdateRecord(
       local_response->get_context(), request, &queue_)));
 }
@@ -43,8 +49,9 @@ void AsyncDirectorydClient::update_directoryd_record(
 void AsyncDirectorydClient::delete_directoryd_record(
     const DeleteRecordRequest& request,
     std::function<void(Status status, Void)> callback) {
-  auto local_response =
-      new AsyncLocalResponse<Void>(std::move(callback), RESPONSE_TIMEOUT);
+  auto local_response = new AsyncLocalResponse<Void>(
+      std::move(callback), RESPONSE_TIMEOUT,
+      "GatewayDirectoryService/DeleteRecord");
   local_response->set_response_reader(std::move(stub_->AsyncDeleteRecord(
       local_response->get_context(), request, &queue_)));
 }
@@ -53,7 +60,8 @@ void AsyncDirectorydClient::get_all_directoryd_records(
     std::function<void(Status status, AllDirectoryRecords)> callback) {
   magma::Void request;
   auto local_resp = new AsyncLocalResponse<AllDirectoryRecords>(
-      std::move(callback), RESPONSE_TIMEOUT);
+      std::move(callback), RESPONSE_TIMEOUT,
+      "GatewayDirectoryService/GetAllDirectoryRecords");
   local_resp->set_response_reader(std::move(stub_->AsyncGetAllDirectoryRecords(
       local_resp->get_context(), request, &queue_)));
 }
@@ -64,6 +64,13 @@ class AsyncDirectorydClient : public GRPCReceiver, public DirectorydClient {
 
   AsyncDirectorydClient(std::shared_ptr<grpc::Channel> directoryd_channel);
 
+  /**
+   * Responses are served by a queue of runtime, rpc_response_loop does not
+   * have to be run. The default constructor uses the shared runtime.
+   */
+  AsyncDirectorydClient(
+      std::shared_ptr<grpc::Channel> directoryd_channel, GRPCRuntime& runtime);
+
   /**
    * Update the DirectoryD record
    * @param update_request - request used to update the record
@@ -84,8 +84,11 @@ void LocalEnforcer::start() {
   evb_->loopForever();
 }
 
-void LocalEnforcer::attachEventBase(folly::EventBase* evb) {
-  evb_ = evb;
+void LocalEnforcer::attachEventBase(
+    folly::EventBase* evb, uint32_t num_shards) {
+  evb_    = evb;
+  shards_ = std::make_unique<SessionShards>(evb, num_shards);
+  session_store_.set_num_shards(shards_->size());
 }
 
 void LocalEnforcer::stop() {
@@ -96,6 +99,41 @@ folly::EventBase& LocalEnforcer::get_event_base() {
   return *evb_;
 }
 
+folly::EventBase& LocalEnforcer::get_event_base(const std::string& imsi) {
+  return shards_->get_event_base(shards_->get_shard(imsi));
+}
+
+void LocalEnforcer::run_in_shard(const std::string& imsi, folly::Func fn) {
+  shards_->run_in_shard(shards_->get_shard(imsi), std::move(fn));
+}
+
+void LocalEnforcer::run_in_all_shards(std::function<void(uint32_t)> fn) {
+  for (uint32_t shard = 0; shard < shards_->size(); shard++) {
+    shards_->run_in_shard(shard, [fn, shard]() { fn(shard); });
+  }
+}
+
+SessionMap LocalEnforcer::read_shard_sessions(uint32_t shard) {
+  return session_store_.read_shard_sessions(shard);
+}
+
+std::vector<RuleRecordTable> LocalEnforcer::split_records_by_shard(
+    const RuleRecordTable& records) const {
+  std::vector<RuleRecordTable> shard_records(shards_->size());
+  if (shards_->size() == 1) {
+    shard_records[0] = records;
+    return shard_records;
+  }
+  for (auto& table : shard_records) {
+    table.set_epoch(records.epoch());
+  }
+  for (const RuleRecord& record : records.records()) {
+    shard_records[shards_->get_shard(record.sid())].add_records()->CopyFrom(
+        record);
+  }
+  return shard_records;
+}
+
 void LocalEnforcer::setup(
     SessionMap& session_map, const std::uint64_t& epoch,
     std::function<void(Status status, SetupFlowsResult)> callback) {
@@ -251,15 +289,21 @@ void LocalEnforcer::handle_pipelined_response(
   if (!status.ok()) {
     MLOG(MERROR) << "Could not successfully poll stats: "
                  << status.error_message();
-  } else {
-    auto session_map = session_store_.read_all_sessions();
+    return;
+  }
+  MLOG(MDEBUG) << "Aggregating " << resp.records_size() << " records";
+  // Every shard aggregates the records of its sessions, those without records
+  // included, as their termination may complete
+  auto shard_records = std::make_shared<std::vector<RuleRecordTable>>(
+      split_records_by_shard(resp));
+  run_in_all_shards([this, shard_records](uint32_t shard) {
+    auto session_map = read_shard_sessions(shard);
     SessionUpdate update =
         SessionStore::get_default_session_update(session_map);
-    MLOG(MDEBUG) << "Aggregating " << resp.records_size() << " records";
-    aggregate_records(session_map, resp, update);
+    aggregate_records(session_map, (*shard_records)[shard], update);
 
     check_usage_for_reporting(session_map, update);
-  }
+  });
 }
 
 void LocalEnforcer::poll_stats_enforcer(int cookie, int cookie_mask) {
@@ -272,7 +316,17 @@ void LocalEnforcer::poll_stats_enforcer(int cookie, int cookie_mask) {
 }
 
 void LocalEnforcer::sync_sessions_on_restart(std::time_t current_time) {
-  auto session_map    = session_store_.read_all_sessions();
+  for (uint32_t shard = 1; shard < shards_->size(); shard++) {
+    shards_->run_in_shard(shard, [this, shard, current_time]() {
+      sync_shard_sessions_on_restart(shard, current_time);
+    });
+  }
+  sync_shard_sessions_on_restart(0, current_time);
+}
+
+void LocalEnforcer::sync_shard_sessions_on_restart(
+    uint32_t shard, std::time_t current_time) {
+  auto session_map    = read_shard_sessions(shard);
   auto session_update = SessionStore::get_default_session_update(session_map);
   // Update the sessions so that their rules match the current timestamp
   for (auto& it : session_map) {
@@ -533,7 +587,7 @@ void LocalEnforcer::start_session_termination(
   // terminate the session.
   MLOG(MDEBUG) << "Scheduling a force termination timeout for " << session_id
                << " in " << session_force_termination_timeout_ms_ << "ms";
-  evb_->runAfterDelay(
+  get_event_base(imsi).runAfterDelay(
       [this, imsi, session_id] {
         handle_force_termination_timeout(imsi, session_id);
       },
@@ -737,7 +791,7 @@ void LocalEnforcer::schedule_static_rule_activation(
   MLOG(MDEBUG) << "Scheduling " << session_id << " static rule " << rule_id
                << " activation in " << (delta.count() / 1000) << " secs";
 
-  evb_->runAfterDelay(
+  get_event_base(imsi).runAfterDelay(
       [=] {
         auto session_map = session_store_.read_sessions(SessionRead{imsi});
         auto session_update =
@@ -795,7 +849,7 @@ void LocalEnforcer::schedule_dynamic_rule_activation(
   auto delta = magma::time_difference_from_now(activation_time);
   MLOG(MDEBUG) << "Scheduling " << session_id << " dynamic rule " << rule_id
                << " activation in " << (delta.count() / 1000) << " secs";
-  evb_->runAfterDelay(
+  get_event_base(imsi).runAfterDelay(
       [=] {
         auto session_map = session_store_.read_sessions(SessionRead{imsi});
         auto session_update =
@@ -855,7 +909,7 @@ void LocalEnforcer::schedule_static_rule_deactivation(
   auto delta = magma::time_difference_from_now(deactivation_time);
   MLOG(MDEBUG) << "Scheduling " << session_id << " static rule " << rule_id
                << " deactivation in " << (delta.count() / 1000) << " secs";
-  evb_->runAfterDelay(
+  get_event_base(imsi).runAfterDelay(
       [=] {
         auto session_map = session_store_.read_sessions(SessionRead{imsi});
         auto session_update =
@@ -906,7 +960,7 @@ void LocalEnforcer::schedule_dynamic_rule_deactivation(
   auto delta = magma::time_difference_from_now(deactivation_time);
   MLOG(MDEBUG) << "Scheduling " << session_id << " dynamic rule " << rule_id
                << " deactivation in " << (delta.count() / 1000) << " secs";
-  evb_->runAfterDelay(
+  get_event_base(imsi).runAfterDelay(
       [=] {
         auto session_map = session_store_.read_sessions(SessionRead{imsi});
         auto session_update =
@@ -1075,7 +1129,7 @@ bool LocalEnforcer::update_tunnel_ids(
 
       // schedule the removal of rules to avoid problems with install-unistall
       // order
-      evb_->runAfterDelay(
+      get_event_base(imsi).runAfterDelay(
           [this, imsi, session_id, credit] {
             auto session_map = session_store_.read_sessions({imsi});
             SessionSearchCriteria criteria(
@@ -1152,7 +1206,8 @@ void LocalEnforcer::handle_session_activate_subscriber_quota_state(
 
 void LocalEnforcer::schedule_termination(
     std::unordered_set<ImsiAndSessionID>& sessions) {
-  evb_->runAfterDelay(
+  // The sessions all belong to the calling shard
+  get_event_base(sessions.begin()->first).runAfterDelay(
       [this, sessions] {
         SessionRead req;
         for (auto& imsi_and_session_id : sessions) {
@@ -1678,6 +1733,40 @@ void LocalEnforcer::init_policy_reauth(
   answer_out.set_result(ReAuthResult::UPDATE_INITIATED);
 }
 
+void LocalEnforcer::handle_static_rule_updates(
+    const std::vector<std::string>& rule_ids) {
+  run_in_all_shards([this, rule_ids](uint32_t shard) {
+    auto session_map = read_shard_sessions(shard);
+    auto update      = SessionStore::get_default_session_update(session_map);
+    for (auto& it : session_map) {
+      for (auto& session : it.second) {
+        auto& uc = update[it.first][session->get_session_id()];
+        RulesToProcess pending_activation;
+        for (const std::string& rule_id : rule_ids) {
+          if (!session->is_static_rule_installed(rule_id)) {
+            continue;
+          }
+          // Activating the rule again bumps its version
+          pending_activation.push_back(session->activate_static_rule(
+              rule_id, session->get_rule_lifetime(rule_id), &uc));
+        }
+        if (pending_activation.empty()) {
+          continue;
+        }
+        MLOG(MINFO) << "Installing " << pending_activation.size()
+                    << " modified static rules again for "
+                    << session->get_session_id();
+        propagate_rule_updates_to_pipelined(
+            session->get_config(), pending_activation, RulesToProcess{},
+            false);
+      }
+    }
+    if (!session_store_.update_sessions(update)) {
+      MLOG(MERROR) << "Failed to update sessions after static rule updates";
+    }
+  });
+}
+
 void LocalEnforcer::init_policy_reauth_for_session(
     const PolicyReAuthRequest& request,
     const std::unique_ptr<SessionState>& session,
@@ -1835,7 +1924,7 @@ void LocalEnforcer::schedule_revalidation(
   auto delta = magma::time_difference_from_now(revalidation_time);
   MLOG(MINFO) << "Scheduling revalidation in " << delta.count() << "ms for "
               << session_id;
-  evb_->runAfterDelay(
+  get_event_base(imsi).runAfterDelay(
       [=] {
         MLOG(MINFO) << "Revalidation timeout! for " << session_id;
         auto session_map = session_store_.read_sessions(req);
@@ -1880,7 +1969,7 @@ void LocalEnforcer::handle_activate_ue_flows_callback(
   const std::string session_id = session->get_session_id();
 
   // start_session_termination
-  evb_->runInEventBaseThread([this, imsi, session_id] {
+  run_in_shard(imsi, [this, imsi, session_id] {
     auto session_map = session_store_.read_sessions({imsi});
     auto update      = SessionStore::get_default_session_update(session_map);
     bool success =
@@ -1909,7 +1998,7 @@ void LocalEnforcer::handle_add_ue_mac_flow_callback(
     MLOG(MWARNING) << "Pipelined add ue mac flow failed, retrying...";
   }
 
-  evb_->runAfterDelay(
+  get_event_base(sid.id()).runAfterDelay(
       [=] {
         MLOG(MERROR) << "Could not activate ue mac flows for subscriber "
                      << sid.id() << ": " << status.error_message()
@@ -32,6 +32,7 @@
 #include "RuleStore.h"
 #include "SessionEvents.h"
 #include "SessionReporter.h"
+#include "SessionShards.h"
 #include "SessionState.h"
 #include "SessionStore.h"
 #include "SpgwServiceClient.h"
@@ -122,15 +123,52 @@ class LocalEnforcer {
       long quota_exhaustion_termination_on_init_ms,
       magma::mconfig::SessionD mconfig);
 
-  void attachEventBase(folly::EventBase* evb);
+  /**
+   * Shard the sessions across num_shards event bases, evb being the one of
+   * shard 0, run by the caller of start()
+   */
+  void attachEventBase(folly::EventBase* evb, uint32_t num_shards = 1);
 
   // blocks
   void start();
 
   void stop();
 
+  /**
+   * @return the event base of shard 0, handling the operations not tied to
+   * sessions, e.g. the setup of PipelineD
+   */
   folly::EventBase& get_event_base();
 
+  uint32_t get_num_shards() const { return shards_->size(); }
+
+  uint32_t get_shard(const std::string& imsi) const {
+    return shards_->get_shard(imsi);
+  }
+
+  /**
+   * Run fn on the shard owning the sessions of imsi
+   */
+  void run_in_shard(const std::string& imsi, folly::Func fn);
+
+  /**
+   * Run fn(shard) on every shard, for the operations on the sessions of all
+   * subscribers, each shard handling the sessions it owns
+   */
+  void run_in_all_shards(std::function<void(uint32_t)> fn);
+
+  /**
+   * Read the sessions of the subscribers owned by shard
+   */
+  SessionMap read_shard_sessions(uint32_t shard);
+
+  /**
+   * Split records by the shard owning their subscriber, the table of each
+   * shard being indexed by its number
+   */
+  std::vector<RuleRecordTable> split_records_by_shard(
+      const RuleRecordTable& records) const;
+
   /**
    * Setup rules for all sessions in pipelined, used whenever pipelined
    * restarts and needs to recover state
@@ -142,7 +180,8 @@ class LocalEnforcer {
   /**
    * Updates rules to be activated/deactivated based on the current time.
    * Also schedules future rule activation and deactivation callbacks to run
-   * on the event loop.
+   * on the event loop. Called on shard 0, which syncs its sessions right
+   * away, the other shards syncing theirs on their own event base.
    */
   void sync_sessions_on_restart(std::time_t current_time);
 
@@ -254,6 +293,13 @@ class LocalEnforcer {
       SessionMap& session_map, PolicyReAuthRequest request,
       PolicyReAuthAnswer& answer_out, SessionUpdate& session_update);
 
+  /**
+   * Install again the static rules modified in policydb for the sessions
+   * they are installed for, so that PipelineD enforces their new definition.
+   * Each shard handles its own sessions.
+   */
+  void handle_static_rule_updates(const std::vector<std::string>& rule_ids);
+
   /**
    * Set session config for the IMSI.
    * Should be only used for WIFI as it will apply it to all sessions with the
@@ -347,6 +393,7 @@ class LocalEnforcer {
   std::shared_ptr<aaa::AAAClient> aaa_client_;
   SessionStore& session_store_;
   folly::EventBase* evb_;
+  std::unique_ptr<SessionShards> shards_;
   long session_force_termination_timeout_ms_;
   // [CWF-ONLY] This configures how long we should wait before terminating a
   // session after it is created without any monitoring quota
@@ -371,6 +418,15 @@ class LocalEnforcer {
       std::unordered_set<ImsiAndSessionID> sessions_with_active_flows,
       SessionUpdate& session_update);
 
+  /**
+   * @return the event base of the shard owning imsi, which the timers of its
+   * sessions run on
+   */
+  folly::EventBase& get_event_base(const std::string& imsi);
+
+  void sync_shard_sessions_on_restart(
+      uint32_t shard, std::time_t current_time);
+
   void filter_rule_installs(
       bool online, std::vector<StaticRuleInstall>& static_installs,
       std::vector<DynamicRuleInstall>& dynamic_installs,
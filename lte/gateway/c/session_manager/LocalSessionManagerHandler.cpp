@@ -53,7 +53,12 @@ void LocalSessionManagerHandlerImpl::ReportRuleStats(
     PrintGrpcMessage(
         static_cast<const google::protobuf::Message&>(request_cpy));
   }
-  enforcer_->get_event_base().runInEventBaseThread([this, request_cpy]() {
+  // Every shard aggregates the records of its sessions, those without records
+  // included, as their termination may complete
+  auto shard_records = std::make_shared<std::vector<RuleRecordTable>>(
+      enforcer_->split_records_by_shard(request_cpy));
+  enforcer_->run_in_all_shards([this, shard_records](uint32_t shard) {
+    const auto& records = (*shard_records)[shard];
     if (!session_store_.is_ready()) {
       // Since PipelineD reports a delta value for usage, this could lead to
       // SessionD missing some usage if Redis becomes unavailable. However,
@@ -64,11 +69,11 @@ void LocalSessionManagerHandlerImpl::ReportRuleStats(
                      "RuleRecordTable";
       return;
     }
-    auto session_map = session_store_.read_all_sessions();
+    auto session_map = enforcer_->read_shard_sessions(shard);
     SessionUpdate update =
         SessionStore::get_default_session_update(session_map);
-    MLOG(MDEBUG) << "Aggregating " << request_cpy.records_size() << " records";
-    enforcer_->aggregate_records(session_map, request_cpy, update);
+    MLOG(MDEBUG) << "Aggregating " << records.records_size() << " records";
+    enforcer_->aggregate_records(session_map, records, update);
     check_usage_for_reporting(std::move(session_map), update);
   });
 
@@ -250,9 +255,9 @@ void LocalSessionManagerHandlerImpl::CreateSession(
   set_sentry_transaction("CreateSession");
   auto& request_cpy = *request;
   PrintGrpcMessage(static_cast<const google::protobuf::Message&>(request_cpy));
-  enforcer_->get_event_base().runInEventBaseThread([this, context,
-                                                    response_callback,
-                                                    request_cpy]() {
+  const auto& sid = request_cpy.common_context().sid().id();
+  enforcer_->run_in_shard(sid, [this, context, response_callback,
+                                request_cpy]() {
     SessionConfig cfg(request_cpy);
     const std::string& imsi           = cfg.get_imsi();
     const CommonSessionContext common = cfg.common_context;
@@ -486,13 +491,12 @@ void LocalSessionManagerHandlerImpl::EndSession(
   auto& sid         = request->sid();
   auto& apn         = request->apn();
   PrintGrpcMessage(static_cast<const google::protobuf::Message&>(request_cpy));
-  enforcer_->get_event_base().runInEventBaseThread(
-      [this, sid, apn, response_callback]() {
-        auto session_map = session_store_.read_sessions({sid.id()});
-        MLOG(MINFO) << "Received a termination request from Access for "
-                    << sid.id() << " apn " << apn;
-        end_session(session_map, sid, apn, response_callback);
-      });
+  enforcer_->run_in_shard(sid.id(), [this, sid, apn, response_callback]() {
+    auto session_map = session_store_.read_sessions({sid.id()});
+    MLOG(MINFO) << "Received a termination request from Access for "
+                << sid.id() << " apn " << apn;
+    end_session(session_map, sid, apn, response_callback);
+  });
 }
 
 void LocalSessionManagerHandlerImpl::end_session(
@@ -535,7 +539,7 @@ void LocalSessionManagerHandlerImpl::BindPolicy2Bearer(
               << " created dedicated bearerID: " << request->bearer_id()
               << " agw TEID: " << request->teids().agw_teid()
               << " eNB TEID: " << request->teids().enb_teid();
-  enforcer_->get_event_base().runInEventBaseThread([this, request_cpy]() {
+  enforcer_->run_in_shard(request_cpy.sid().id(), [this, request_cpy]() {
     auto session_map = session_store_.read_sessions({request_cpy.sid().id()});
     SessionUpdate update =
         SessionStore::get_default_session_update(session_map);
@@ -568,8 +572,8 @@ void LocalSessionManagerHandlerImpl::UpdateTunnelIds(
               << " with default bearer id: " << request->bearer_id()
               << " enb_teid= " << request->enb_teid()
               << " agw_teid= " << request->agw_teid();
-  enforcer_->get_event_base().runInEventBaseThread([this, request_cpy, imsi,
-                                                    response_callback]() {
+  enforcer_->run_in_shard(imsi, [this, request_cpy, imsi,
+                                 response_callback]() {
     auto session_map = session_store_.read_sessions({imsi});
     auto success     = enforcer_->update_tunnel_ids(session_map, request_cpy);
     if (!success) {
@@ -600,24 +604,34 @@ void LocalSessionManagerHandlerImpl::SetSessionRules(
   PrintGrpcMessage(static_cast<const google::protobuf::Message&>(request_cpy));
   MLOG(MDEBUG) << "Received session <-> rule associations";
 
-  enforcer_->get_event_base().runInEventBaseThread([this, request_cpy]() {
-    SessionRead req = {};
-    for (const auto& rule_sets : request_cpy.rules_per_subscriber()) {
-      req.insert(rule_sets.imsi());
-    }
-    auto session_map = session_store_.read_sessions(req);
-    SessionUpdate update =
-        SessionStore::get_default_session_update(session_map);
-    enforcer_->handle_set_session_rules(session_map, request_cpy, update);
-    auto update_success = session_store_.update_sessions(update);
-    if (update_success) {
-      MLOG(MDEBUG) << "Succeeded in updating SessionStore after processing "
-                      "session rules set";
-    } else {
-      MLOG(MERROR) << "Failed in updating SessionStore after processing "
-                      "session rules set";
-    }
-  });
+  // Each shard sets the rules of the subscribers it owns
+  std::unordered_map<uint32_t, SessionRules> rules_by_shard;
+  for (const auto& rule_sets : request_cpy.rules_per_subscriber()) {
+    rules_by_shard[enforcer_->get_shard(rule_sets.imsi())]
+        .add_rules_per_subscriber()
+        ->CopyFrom(rule_sets);
+  }
+  for (auto& it : rules_by_shard) {
+    const auto& imsi = it.second.rules_per_subscriber(0).imsi();
+    enforcer_->run_in_shard(imsi, [this, rules = std::move(it.second)]() {
+      SessionRead req = {};
+      for (const auto& rule_sets : rules.rules_per_subscriber()) {
+        req.insert(rule_sets.imsi());
+      }
+      auto session_map = session_store_.read_sessions(req);
+      SessionUpdate update =
+          SessionStore::get_default_session_update(session_map);
+      enforcer_->handle_set_session_rules(session_map, rules, update);
+      auto update_success = session_store_.update_sessions(update);
+      if (update_success) {
+        MLOG(MDEBUG) << "Succeeded in updating SessionStore after processing "
+                        "session rules set";
+      } else {
+        MLOG(MERROR) << "Failed in updating SessionStore after processing "
+                        "session rules set";
+      }
+    });
+  }
   response_callback(Status::OK, Void());
 }
 
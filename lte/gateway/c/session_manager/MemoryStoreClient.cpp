@@ -29,14 +29,23 @@ MemoryStoreClient::MemoryStoreClient(
 
 SessionMap MemoryStoreClient::read_sessions(
     std::set<std::string> subscriber_ids) {
+  auto stored_map =
+      std::unordered_map<std::string, std::vector<StoredSessionState>>{};
+  {
+    std::lock_guard<std::mutex> lock(map_mutex_);
+    for (const auto& subscriber_id : subscriber_ids) {
+      auto it = session_map_.find(subscriber_id);
+      if (it != session_map_.end()) {
+        stored_map[subscriber_id] = it->second;
+      }
+    }
+  }
   auto session_map = SessionMap{};
   for (const auto& subscriber_id : subscriber_ids) {
     auto sessions = SessionVector{};
-    if (session_map_.find(subscriber_id) != session_map_.end()) {
-      for (auto& stored_session : session_map_[subscriber_id]) {
-        auto session = SessionState::unmarshal(stored_session, *rule_store_);
-        sessions.push_back(std::move(session));
-      }
+    for (auto& stored_session : stored_map[subscriber_id]) {
+      auto session = SessionState::unmarshal(stored_session, *rule_store_);
+      sessions.push_back(std::move(session));
     }
     session_map[subscriber_id] = std::move(sessions);
   }
@@ -44,8 +53,14 @@ SessionMap MemoryStoreClient::read_sessions(
 }
 
 SessionMap MemoryStoreClient::read_all_sessions() {
+  auto stored_map =
+      std::unordered_map<std::string, std::vector<StoredSessionState>>{};
+  {
+    std::lock_guard<std::mutex> lock(map_mutex_);
+    stored_map = session_map_;
+  }
   auto session_map = SessionMap{};
-  for (auto& it : session_map_) {
+  for (auto& it : stored_map) {
     auto sessions = SessionVector{};
     for (auto& stored_session : it.second) {
       auto session = SessionState::unmarshal(stored_session, *rule_store_);
@@ -56,19 +71,34 @@ SessionMap MemoryStoreClient::read_all_sessions() {
   return session_map;
 }
 
+std::set<std::string> MemoryStoreClient::read_subscriber_ids() {
+  std::lock_guard<std::mutex> lock(map_mutex_);
+  auto subscriber_ids = std::set<std::string>{};
+  for (const auto& it : session_map_) {
+    subscriber_ids.insert(it.first);
+  }
+  return subscriber_ids;
+}
+
 bool MemoryStoreClient::write_sessions(SessionMap session_map) {
+  auto stored_map =
+      std::unordered_map<std::string, std::vector<StoredSessionState>>{};
   for (auto& it : session_map) {
     auto sessions = std::vector<StoredSessionState>{};
     for (auto const& session : it.second) {
       auto stored_session = session->marshal();
       sessions.push_back(stored_session);
     }
-    if (sessions.empty()) {
+    stored_map[it.first] = std::move(sessions);
+  }
+  std::lock_guard<std::mutex> lock(map_mutex_);
+  for (auto& it : stored_map) {
+    if (it.second.empty()) {
       // if session is empty that means subs should be deleted from the map
       session_map_.erase(it.first);
       continue;
     }
-    session_map_[it.first] = std::move(sessions);
+    session_map_[it.first] = std::move(it.second);
   }
   return true;
 }
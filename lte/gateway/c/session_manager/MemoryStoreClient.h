@@ -15,6 +15,7 @@
 #include <lte/protos/session_manager.grpc.pb.h>
 
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 #include <unordered_map>
@@ -33,7 +34,6 @@ class MemoryStoreClient final : public StoreClient {
  public:
   MemoryStoreClient(std::shared_ptr<StaticRuleStore> rule_store);
   MemoryStoreClient(MemoryStoreClient const&) = delete;
-  MemoryStoreClient(MemoryStoreClient&&)      = default;
   ~MemoryStoreClient()                        = default;
 
   bool is_ready() { return true; }
@@ -42,9 +42,13 @@ class MemoryStoreClient final : public StoreClient {
 
   SessionMap read_all_sessions();
 
+  std::set<std::string> read_subscriber_ids();
+
   bool write_sessions(SessionMap session_map);
 
  private:
+  // Held while the map is accessed, sessions are (un)marshaled outside of it
+  std::mutex map_mutex_;
   std::unordered_map<std::string, std::vector<StoredSessionState>> session_map_;
   std::shared_ptr<StaticRuleStore> rule_store_;
 };
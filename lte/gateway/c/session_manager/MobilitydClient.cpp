@@ -25,15 +25,22 @@ AsyncMobilitydClient::AsyncMobilitydClient(
     std::shared_ptr<grpc::Channel> channel)
     : stub_(MobilityService::NewStub(channel)) {}
 
+AsyncMobilitydClient::AsyncMobilitydClient(
+    std::shared_ptr<grpc::Channel> channel, GRPCRuntime& runtime)
+    : GRPCReceiver(runtime), stub_(MobilityService::NewStub(channel)) {}
+
 AsyncMobilitydClient::AsyncMobilitydClient()
-    : AsyncMobilitydClient(ServiceRegistrySingleton::Instance()->GetGrpcChannel(
-          "mobilityd", ServiceRegistrySingleton::LOCAL)) {}
+    : AsyncMobilitydClient(
+          ServiceRegistrySingleton::Instance()->GetGrpcChannel(
+              "mobilityd", ServiceRegistrySingleton::LOCAL),
+          GRPCRuntime::get_instance()) {}
 
 void AsyncMobilitydClient::get_subscriberid_from_ipv4(
     const IPAddress& ue_ip_addr,
     std::function<void(Status status, SubscriberID)> callback) {
   auto local_resp = new AsyncLocalResponse<SubscriberID>(
-      std::move(callback), RESPONSE_TIMEOUT);
+      std::move(callback), RESPONSE_TIMEOUT,
+      "MobilityService/GetSubscriberIDFromIP");
   local_resp->set_response_reader(std::move(stub_->AsyncGetSubscriberIDFromIP(
       local_resp->get_context(), ue_ip_addr, &queue_)));
 }
@@ -52,6 +52,13 @@ class AsyncMobilitydClient : public GRPCReceiver, public MobilitydClient {
   explicit AsyncMobilitydClient(
       std::shared_ptr<grpc::Channel> mobilityd_channel);
 
+  /**
+   * Responses are served by a queue of runtime, rpc_response_loop does not
+   * have to be run. The default constructor uses the shared runtime.
+   */
+  AsyncMobilitydClient(
+      std::shared_ptr<grpc::Channel> mobilityd_channel, GRPCRuntime& runtime);
+
   /**
    * Get SubscriberID for correspoding of UE_IP
    */
@@ -281,9 +281,17 @@ AsyncPipelinedClient::AsyncPipelinedClient(
   teid = M5G_MIN_TEID;
 }
 
+AsyncPipelinedClient::AsyncPipelinedClient(
+    std::shared_ptr<grpc::Channel> channel, GRPCRuntime& runtime)
+    : GRPCReceiver(runtime), stub_(Pipelined::NewStub(channel)) {
+  teid = M5G_MIN_TEID;
+}
+
 AsyncPipelinedClient::AsyncPipelinedClient()
-    : AsyncPipelinedClient(ServiceRegistrySingleton::Instance()->GetGrpcChannel(
-          "pipelined", ServiceRegistrySingleton::LOCAL)) {}
+    : AsyncPipelinedClient(
+          ServiceRegistrySingleton::Instance()->GetGrpcChannel(
+              "pipelined", ServiceRegistrySingleton::LOCAL),
+          GRPCRuntime::get_instance()) {}
 
 void AsyncPipelinedClient::setup_cwf(
     const std::vector<SessionState::SessionInfo>& infos,
@@ -467,7 +475,7 @@ void AsyncPipelinedClient::set_upf_session_rpc(
     const SessionSet& request,
     std::function<void(Status, UPFSessionContextState)> callback) {
   auto local_resp = new AsyncLocalResponse<UPFSessionContextState>(
-      std::move(callback), RESPONSE_TIMEOUT);
+      std::move(callback), RESPONSE_TIMEOUT, "Pipelined/SetSMFSessions");
   PrintGrpcMessage(static_cast<const google::protobuf::Message&>(request));
   local_resp->set_response_reader(std::move(
       stub_->AsyncSetSMFSessions(local_resp->get_context(), request, &queue_)));
@@ -477,7 +485,8 @@ void AsyncPipelinedClient::setup_default_controllers_rpc(
     const SetupDefaultRequest& request,
     std::function<void(Status, SetupFlowsResult)> callback) {
   auto local_resp = new AsyncLocalResponse<SetupFlowsResult>(
-      std::move(callback), RESPONSE_TIMEOUT);
+      std::move(callback), RESPONSE_TIMEOUT,
+      "Pipelined/SetupDefaultControllers");
   PrintGrpcMessage(static_cast<const google::protobuf::Message&>(request));
   local_resp->set_response_reader(std::move(stub_->AsyncSetupDefaultControllers(
       local_resp->get_context(), request, &queue_)));
@@ -487,7 +496,7 @@ void AsyncPipelinedClient::setup_policy_rpc(
     const SetupPolicyRequest& request,
     std::function<void(Status, SetupFlowsResult)> callback) {
   auto local_resp = new AsyncLocalResponse<SetupFlowsResult>(
-      std::move(callback), RESPONSE_TIMEOUT);
+      std::move(callback), RESPONSE_TIMEOUT, "Pipelined/SetupPolicyFlows");
   PrintGrpcMessage(static_cast<const google::protobuf::Message&>(request));
   local_resp->set_response_reader(std::move(stub_->AsyncSetupPolicyFlows(
       local_resp->get_context(), request, &queue_)));
@@ -497,7 +506,7 @@ void AsyncPipelinedClient::setup_ue_mac_rpc(
     const SetupUEMacRequest& request,
     std::function<void(Status, SetupFlowsResult)> callback) {
   auto local_resp = new AsyncLocalResponse<SetupFlowsResult>(
-      std::move(callback), RESPONSE_TIMEOUT);
+      std::move(callback), RESPONSE_TIMEOUT, "Pipelined/SetupUEMacFlows");
   PrintGrpcMessage(static_cast<const google::protobuf::Message&>(request));
   local_resp->set_response_reader(std::move(stub_->AsyncSetupUEMacFlows(
       local_resp->get_context(), request, &queue_)));
@@ -507,7 +516,7 @@ void AsyncPipelinedClient::deactivate_flows_rpc(
     const DeactivateFlowsRequest& request,
     std::function<void(Status, DeactivateFlowsResult)> callback) {
   auto local_resp = new AsyncLocalResponse<DeactivateFlowsResult>(
-      std::move(callback), RESPONSE_TIMEOUT);
+      std::move(callback), RESPONSE_TIMEOUT, "Pipelined/DeactivateFlows");
   PrintGrpcMessage(static_cast<const google::protobuf::Message&>(request));
   local_resp->set_response_reader(std::move(stub_->AsyncDeactivateFlows(
       local_resp->get_context(), request, &queue_)));
@@ -517,7 +526,7 @@ void AsyncPipelinedClient::activate_flows_rpc(
     const ActivateFlowsRequest& request,
     std::function<void(Status, ActivateFlowsResult)> callback) {
   auto local_resp = new AsyncLocalResponse<ActivateFlowsResult>(
-      std::move(callback), RESPONSE_TIMEOUT);
+      std::move(callback), RESPONSE_TIMEOUT, "Pipelined/ActivateFlows");
   PrintGrpcMessage(static_cast<const google::protobuf::Message&>(request));
   local_resp->set_response_reader(std::move(
       stub_->AsyncActivateFlows(local_resp->get_context(), request, &queue_)));
@@ -527,7 +536,7 @@ void AsyncPipelinedClient::add_ue_mac_flow_rpc(
     const UEMacFlowRequest& request,
     std::function<void(Status, FlowResponse)> callback) {
   auto local_resp = new AsyncLocalResponse<FlowResponse>(
-      std::move(callback), RESPONSE_TIMEOUT);
+      std::move(callback), RESPONSE_TIMEOUT, "Pipelined/AddUEMacFlow");
   PrintGrpcMessage(static_cast<const google::protobuf::Message&>(request));
   local_resp->set_response_reader(std::move(
       stub_->AsyncAddUEMacFlow(local_resp->get_context(), request, &queue_)));
@@ -537,7 +546,7 @@ void AsyncPipelinedClient::update_ipfix_flow_rpc(
     const UEMacFlowRequest& request,
     std::function<void(Status, FlowResponse)> callback) {
   auto local_resp = new AsyncLocalResponse<FlowResponse>(
-      std::move(callback), RESPONSE_TIMEOUT);
+      std::move(callback), RESPONSE_TIMEOUT, "Pipelined/UpdateIPFIXFlow");
   PrintGrpcMessage(static_cast<const google::protobuf::Message&>(request));
   local_resp->set_response_reader(std::move(stub_->AsyncUpdateIPFIXFlow(
       local_resp->get_context(), request, &queue_)));
@@ -547,7 +556,7 @@ void AsyncPipelinedClient::delete_ue_mac_flow_rpc(
     const UEMacFlowRequest& request,
     std::function<void(Status, FlowResponse)> callback) {
   auto local_resp = new AsyncLocalResponse<FlowResponse>(
-      std::move(callback), RESPONSE_TIMEOUT);
+      std::move(callback), RESPONSE_TIMEOUT, "Pipelined/DeleteUEMacFlow");
   PrintGrpcMessage(static_cast<const google::protobuf::Message&>(request));
   local_resp->set_response_reader(std::move(stub_->AsyncDeleteUEMacFlow(
       local_resp->get_context(), request, &queue_)));
@@ -557,7 +566,8 @@ void AsyncPipelinedClient::update_subscriber_quota_state_rpc(
     const UpdateSubscriberQuotaStateRequest& request,
     std::function<void(Status, FlowResponse)> callback) {
   auto local_resp = new AsyncLocalResponse<FlowResponse>(
-      std::move(callback), RESPONSE_TIMEOUT);
+      std::move(callback), RESPONSE_TIMEOUT,
+      "Pipelined/UpdateSubscriberQuotaState");
   PrintGrpcMessage(static_cast<const google::protobuf::Message&>(request));
   local_resp->set_response_reader(
       std::move(stub_->AsyncUpdateSubscriberQuotaState(
@@ -568,7 +578,7 @@ void AsyncPipelinedClient::poll_stats_rpc(
     const magma::GetStatsRequest& request,
     std::function<void(Status, RuleRecordTable)> callback) {
   auto local_resp = new AsyncLocalResponse<RuleRecordTable>(
-      std::move(callback), RESPONSE_TIMEOUT);
+      std::move(callback), RESPONSE_TIMEOUT, "Pipelined/GetStats");
   PrintGrpcMessage(static_cast<const google::protobuf::Message&>(request));
   local_resp->set_response_reader(std::move(
       stub_->AsyncGetStats(local_resp->get_context(), request, &queue_)));
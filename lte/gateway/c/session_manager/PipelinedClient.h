@@ -226,6 +226,13 @@ class AsyncPipelinedClient : public GRPCReceiver, public PipelinedClient {
   explicit AsyncPipelinedClient(
       std::shared_ptr<grpc::Channel> pipelined_channel);
 
+  /**
+   * Responses are served by a queue of runtime, rpc_response_loop does not
+   * have to be run. The default constructor uses the shared runtime.
+   */
+  AsyncPipelinedClient(
+      std::shared_ptr<grpc::Channel> pipelined_channel, GRPCRuntime& runtime);
+
   void setup_cwf(
       const std::vector<SessionState::SessionInfo>& infos,
       const std::vector<SubscriberQuotaUpdate>& quota_updates,
@@ -25,6 +25,7 @@
 #include <cpp_redis/core/reply.hpp>   // for reply
 #include <cpp_redis/misc/error.hpp>   // for redis_error
 #include <future>                     // for future
+#include <mutex>                      // for mutex, lock_guard
 #include <ostream>                    // for operator<<, basic_ostream, size_t
 #include <unordered_map>              // for _Node_iterator, unordered_map
 #include <utility>                    // for move, pair
@@ -68,24 +69,25 @@ bool RedisStoreClient::try_redis_connect() {
 
 SessionMap RedisStoreClient::read_sessions(
     std::set<std::string> subscriber_ids) {
-  // The approach here is made assuming that the SessionStore only has one
-  // call being processed at a time, and that the writes it makes are done
-  // atomically. Based on that, reads can be done without using Redis
+  // The approach here is made assuming that SessionStore does not process
+  // two calls on the same subscriber at a time, and that the writes it makes
+  // are done atomically. Based on that, reads can be done without using Redis
   // transactions, or EVAL.
-  if (!client_->is_connected()) {
-    auto connected = try_redis_connect();
-    if (!connected) {
-      throw RedisReadFailed();
-    }
-  }
-
   std::unordered_map<std::string, std::future<cpp_redis::reply>> futures;
-  for (const std::string& key : subscriber_ids) {
-    futures[key] = client_->hget(redis_table_, key);
+  {
+    std::lock_guard<std::mutex> lock(client_mutex_);
+    if (!client_->is_connected()) {
+      auto connected = try_redis_connect();
+      if (!connected) {
+        throw RedisReadFailed();
+      }
+    }
+    for (const std::string& key : subscriber_ids) {
+      futures[key] = client_->hget(redis_table_, key);
+    }
+    client_->sync_commit();
   }
 
-  client_->sync_commit();
-
   SessionMap session_map;
   for (const std::string& key : subscriber_ids) {
     auto reply = futures[key].get();
@@ -104,16 +106,20 @@ SessionMap RedisStoreClient::read_sessions(
 }
 
 SessionMap RedisStoreClient::read_all_sessions() {
-  if (!client_->is_connected()) {
-    auto connected = try_redis_connect();
-    if (!connected) {
-      throw RedisReadFailed();
+  std::future<cpp_redis::reply> hgetall_future;
+  {
+    std::lock_guard<std::mutex> lock(client_mutex_);
+    if (!client_->is_connected()) {
+      auto connected = try_redis_connect();
+      if (!connected) {
+        throw RedisReadFailed();
+      }
     }
+    hgetall_future = client_->hgetall(redis_table_);
+    client_->sync_commit();
   }
-  SessionMap session_map;
-  auto hgetall_future = client_->hgetall(redis_table_);
-  client_->sync_commit();
 
+  SessionMap session_map;
   auto reply = hgetall_future.get();
   if (reply.is_error()) {
     MLOG(MERROR) << "unable to read all sessions from redis";
@@ -139,47 +145,88 @@ SessionMap RedisStoreClient::read_all_sessions() {
   return session_map;
 }
 
-bool RedisStoreClient::write_sessions(SessionMap session_map) {
-  // Writes should happen via a transaction, otherwise the state inside in
-  // Redis may not be recoverable or consistent.
-  // For reference, see https://redis.io/topics/transactions
-
-  // First we need to watch the keys that we intend to write to.
-  // If we don't, then one HSET might succeed but another will fail.
-  if (!client_->is_connected()) {
-    auto connected = try_redis_connect();
-    if (!connected) {
-      throw RedisWriteFailed();
+std::set<std::string> RedisStoreClient::read_subscriber_ids() {
+  std::future<cpp_redis::reply> hkeys_future;
+  {
+    std::lock_guard<std::mutex> lock(client_mutex_);
+    if (!client_->is_connected()) {
+      auto connected = try_redis_connect();
+      if (!connected) {
+        throw RedisReadFailed();
+      }
     }
+    hkeys_future = client_->hkeys(redis_table_);
+    client_->sync_commit();
   }
-  std::vector<std::string> keys;
-  for (auto& it : session_map) {
-    keys.push_back(it.first);
-  }
-  client_->watch(keys);
 
-  // Set MULTI command.
-  // Subsequent commands end up being queued for atomic execution with EXEC.
-  // Together with WATCH, if one of the keys we intend to set are modified, then
-  // the entire EXEC does not execute.
-  client_->multi();
+  std::set<std::string> subscriber_ids;
+  auto reply = hkeys_future.get();
+  if (reply.is_error()) {
+    MLOG(MERROR) << "unable to read subscriber ids from redis";
+    throw RedisReadFailed();
+  }
+  for (const auto& key_reply : reply.as_array()) {
+    if (!key_reply.is_string()) {
+      MLOG(MERROR) << "Non string key found in sessions from redis";
+      continue;
+    }
+    subscriber_ids.insert(key_reply.as_string());
+  }
+  return subscriber_ids;
+}
 
-  // Queue up HSET commands after we've set up some sort of safety
-  // guarantees.
+bool RedisStoreClient::write_sessions(SessionMap session_map) {
+  // Serialize before taking the connection, the other shards keep using it
+  // meanwhile
+  std::vector<std::string> keys;
+  std::vector<std::pair<std::string, std::string>> serialized_sessions;
   std::vector<std::string> keys_to_delete;
   for (auto& it : session_map) {
+    keys.push_back(it.first);
     if (it.second.empty()) {
       // if session is empty we shouldn't write back this subs anymore
       keys_to_delete.push_back(it.first);
       continue;
     }
-    client_->hset(redis_table_, it.first, serialize_session_vec(it.second));
+    serialized_sessions.emplace_back(
+        it.first, serialize_session_vec(it.second));
   }
-  if (!keys_to_delete.empty()) {
-    client_->hdel(redis_table_, keys_to_delete);
+
+  // Writes should happen via a transaction, otherwise the state inside in
+  // Redis may not be recoverable or consistent.
+  // For reference, see https://redis.io/topics/transactions
+  // WATCH, MULTI and EXEC apply to the connection, so the whole transaction
+  // is sent under the lock.
+  std::future<cpp_redis::reply> exec_future;
+  {
+    std::lock_guard<std::mutex> lock(client_mutex_);
+    if (!client_->is_connected()) {
+      auto connected = try_redis_connect();
+      if (!connected) {
+        throw RedisWriteFailed();
+      }
+    }
+    // First we need to watch the keys that we intend to write to.
+    // If we don't, then one HSET might succeed but another will fail.
+    client_->watch(keys);
+
+    // Set MULTI command.
+    // Subsequent commands end up being queued for atomic execution with EXEC.
+    // Together with WATCH, if one of the keys we intend to set are modified,
+    // then the entire EXEC does not execute.
+    client_->multi();
+
+    // Queue up HSET commands after we've set up some sort of safety
+    // guarantees.
+    for (const auto& it : serialized_sessions) {
+      client_->hset(redis_table_, it.first, it.second);
+    }
+    if (!keys_to_delete.empty()) {
+      client_->hdel(redis_table_, keys_to_delete);
+    }
+    exec_future = client_->exec();
+    client_->sync_commit();
   }
-  auto exec_future = client_->exec();
-  client_->sync_commit();
 
   auto reply = exec_future.get();
   if (!reply.ok()) {
@@ -16,6 +16,7 @@
 #include <cpp_redis/cpp_redis>
 #include <exception>      // IWYU pragma: keep
 #include <memory>         // for shared_ptr
+#include <mutex>          // for mutex
 #include <set>            // for set
 #include <string>         // for string
 #include "StoreClient.h"  // for SessionMap, SessionVector, StoreClient
@@ -46,7 +47,6 @@ class RedisStoreClient final : public StoreClient {
       std::shared_ptr<StaticRuleStore> rule_store);
 
   RedisStoreClient(RedisStoreClient const&) = delete;
-  RedisStoreClient(RedisStoreClient&&)      = default;
   ~RedisStoreClient()                       = default;
 
   bool try_redis_connect();
@@ -57,9 +57,15 @@ class RedisStoreClient final : public StoreClient {
 
   SessionMap read_all_sessions();
 
+  std::set<std::string> read_subscriber_ids();
+
   bool write_sessions(SessionMap session_map);
 
  private:
+  // The connection is shared by the shards of sessiond, each pipeline of
+  // commands is sent and committed under the lock. Sessions are
+  // (de)serialized outside of it.
+  std::mutex client_mutex_;
   std::shared_ptr<cpp_redis::client> client_;
   std::string redis_table_;
   std::shared_ptr<StaticRuleStore> rule_store_;
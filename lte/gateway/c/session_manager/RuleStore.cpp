@@ -116,9 +116,27 @@ void PolicyRuleBiMap::sync_rules(const std::vector<PolicyRule>& rules) {
   }
 }
 
+void PolicyRuleBiMap::update_rules(
+    const std::vector<PolicyRule>& rules,
+    const std::vector<std::string>& removed_rule_ids) {
+  std::lock_guard<std::mutex> lock(map_mutex_);
+  for (const auto& rule_id : removed_rule_ids) {
+    remove_rule_locked(rule_id, NULL);
+  }
+  for (const auto& rule : rules) {
+    // The previous definition is dropped from the key maps too
+    remove_rule_locked(rule.id(), NULL);
+    insert_rule_locked(rule);
+  }
+}
+
 void PolicyRuleBiMap::insert_rule(const PolicyRule& rule) {
-  auto rule_p = std::make_shared<PolicyRule>(rule);
   std::lock_guard<std::mutex> lock(map_mutex_);
+  insert_rule_locked(rule);
+}
+
+void PolicyRuleBiMap::insert_rule_locked(const PolicyRule& rule) {
+  auto rule_p                  = std::make_shared<PolicyRule>(rule);
   rules_by_rule_id_[rule.id()] = rule_p;
   if (should_track_charging_key(rule.tracking_type())) {
     rules_by_charging_key_.insert(CreditKey(rule), rule_p);
@@ -158,6 +176,11 @@ bool PolicyRuleBiMap::get_rules_by_ids(
 bool PolicyRuleBiMap::remove_rule(
     const std::string& rule_id, PolicyRule* rule_out) {
   std::lock_guard<std::mutex> lock(map_mutex_);
+  return remove_rule_locked(rule_id, rule_out);
+}
+
+bool PolicyRuleBiMap::remove_rule_locked(
+    const std::string& rule_id, PolicyRule* rule_out) {
   auto it = rules_by_rule_id_.find(rule_id);
   if (it == rules_by_rule_id_.end()) {
     return false;
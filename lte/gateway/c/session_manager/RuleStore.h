@@ -70,6 +70,14 @@ class PolicyRuleBiMap {
    */
   virtual void sync_rules(const std::vector<PolicyRule>& rules);
 
+  /**
+   * Insert or replace the given rules and remove the rules of the given ids,
+   * at once
+   */
+  virtual void update_rules(
+      const std::vector<PolicyRule>& rules,
+      const std::vector<std::string>& removed_rule_ids);
+
   virtual void insert_rule(const PolicyRule& rule);
 
   // Get the rule definition associated with the given rule_id
@@ -120,6 +128,10 @@ class PolicyRuleBiMap {
   virtual bool get_rules(std::vector<PolicyRule>& rules_out);
 
  protected:
+  // insert_rule() and remove_rule() with map_mutex_ held
+  void insert_rule_locked(const PolicyRule& rule);
+  bool remove_rule_locked(const std::string& rule_id, PolicyRule* rule_out);
+
   // guards all three maps below
   std::mutex map_mutex_;
   // rule_id -> PolicyRule
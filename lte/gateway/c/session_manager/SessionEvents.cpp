@@ -87,24 +87,25 @@ void EventsReporterImpl::session_created(
   event.set_event_type(SESSION_CREATED_EV);
   event.set_tag(imsi);
 
-  folly::dynamic event_value  = folly::dynamic::object;
-  event_value[IMSI]           = imsi;
-  event_value[IP_ADDR]        = session_context.common_context.ue_ipv4();
-  event_value[IPV6_ADDR]      = session_context.common_context.ue_ipv6();
-  event_value[MSISDN]         = session_context.common_context.msisdn();
-  event_value[APN]            = session_context.common_context.apn();
-  event_value[SESSION_ID]     = session_id;
-  event_value[PDP_START_TIME] = session->get_pdp_start_time();
+  EventJsonWriter event_value;
+  event_value.add(IMSI, imsi)
+      .add(IP_ADDR, session_context.common_context.ue_ipv4())
+      .add(IPV6_ADDR, session_context.common_context.ue_ipv6())
+      .add(MSISDN, session_context.common_context.msisdn())
+      .add(APN, session_context.common_context.apn())
+      .add(SESSION_ID, session_id)
+      .add(PDP_START_TIME, session->get_pdp_start_time());
   // LTE specific
-  event_value[IMEI]          = get_imei(session_context);
-  event_value[SPGW_IP]       = get_spgw_ipv4(session_context);
-  event_value[USER_LOCATION] = get_user_location(session_context);
-  event_value[CHARGING_CHARACTERISTICS] =
-      get_charging_characteristics(session_context);
+  event_value.add(IMEI, get_imei(session_context))
+      .add(SPGW_IP, get_spgw_ipv4(session_context))
+      .add(USER_LOCATION, get_user_location(session_context))
+      .add(
+          CHARGING_CHARACTERISTICS,
+          get_charging_characteristics(session_context));
   // CWF specific
-  event_value[MAC_ADDR] = get_mac_addr(session_context);
+  event_value.add(MAC_ADDR, get_mac_addr(session_context));
 
-  std::string event_value_string = folly::toJson(event_value);
+  std::string event_value_string = event_value.str();
   event.set_value(event_value_string);
 
   eventd_client_.log_event(event, [=](Status status, Void v) {
@@ -124,13 +125,13 @@ void EventsReporterImpl::session_create_failure(
   event.set_event_type(SESSION_CREATE_FAILURE_EV);
   event.set_tag(imsi);
 
-  folly::dynamic event_value  = folly::dynamic::object;
-  event_value[IMSI]           = imsi;
-  event_value[APN]            = session_context.common_context.apn();
-  event_value[FAILURE_REASON] = failure_reason;
-  event_value[MAC_ADDR]       = get_mac_addr(session_context);
+  EventJsonWriter event_value;
+  event_value.add(IMSI, imsi)
+      .add(APN, session_context.common_context.apn())
+      .add(FAILURE_REASON, failure_reason)
+      .add(MAC_ADDR, get_mac_addr(session_context));
 
-  std::string event_value_string = folly::toJson(event_value);
+  std::string event_value_string = event_value.str();
   event.set_value(event_value_string);
 
   eventd_client_.log_event(event, [=](Status status, Void v) {
@@ -152,16 +153,16 @@ void EventsReporterImpl::session_updated(
   event.set_event_type(SESSION_UPDATED_EV);
   event.set_tag(imsi);
 
-  folly::dynamic event_value   = folly::dynamic::object;
-  event_value[IMSI]            = imsi;
-  event_value[SESSION_ID]      = session_id;
-  event_value[IP_ADDR]         = session_context.common_context.ue_ipv4();
-  event_value[IPV6_ADDR]       = session_context.common_context.ue_ipv6();
-  event_value[APN]             = session_context.common_context.apn();
-  event_value[MAC_ADDR]        = get_mac_addr(session_context);
-  event_value[SERVICE_UPDATES] = get_update_summary(update_request);
+  EventJsonWriter event_value;
+  event_value.add(IMSI, imsi)
+      .add(SESSION_ID, session_id)
+      .add(IP_ADDR, session_context.common_context.ue_ipv4())
+      .add(IPV6_ADDR, session_context.common_context.ue_ipv6())
+      .add(APN, session_context.common_context.apn())
+      .add(MAC_ADDR, get_mac_addr(session_context));
+  add_update_summary(event_value, update_request);
 
-  std::string event_value_string = folly::toJson(event_value);
+  std::string event_value_string = event_value.str();
   event.set_value(event_value_string);
 
   eventd_client_.log_event(event, [=](Status status, Void v) {
@@ -182,17 +183,17 @@ void EventsReporterImpl::session_update_failure(
   event.set_stream_name(SESSIOND_SERVICE_EV);
   event.set_event_type(SESSION_UPDATE_FAILURE_EV);
 
-  folly::dynamic event_value   = folly::dynamic::object;
-  event_value[IMSI]            = imsi;
-  event_value[SESSION_ID]      = session_id;
-  event_value[IP_ADDR]         = session_context.common_context.ue_ipv4();
-  event_value[IPV6_ADDR]       = session_context.common_context.ue_ipv6();
-  event_value[MAC_ADDR]        = get_mac_addr(session_context);
-  event_value[APN]             = session_context.common_context.apn();
-  event_value[FAILURE_REASON]  = failure_reason;
-  event_value[SERVICE_UPDATES] = get_update_summary(failed_request);
-
-  std::string event_value_string = folly::toJson(event_value);
+  EventJsonWriter event_value;
+  event_value.add(IMSI, imsi)
+      .add(SESSION_ID, session_id)
+      .add(IP_ADDR, session_context.common_context.ue_ipv4())
+      .add(IPV6_ADDR, session_context.common_context.ue_ipv6())
+      .add(MAC_ADDR, get_mac_addr(session_context))
+      .add(APN, session_context.common_context.apn())
+      .add(FAILURE_REASON, failure_reason);
+  add_update_summary(event_value, failed_request);
+
+  std::string event_value_string = event_value.str();
   event.set_value(event_value_string);
 
   eventd_client_.log_event(event, [=](Status status, Void v) {
@@ -213,58 +214,57 @@ void EventsReporterImpl::session_terminated(
   event.set_event_type(SESSION_TERMINATED_EV);
   event.set_tag(imsi);
 
-  folly::dynamic event_value = folly::dynamic::object;
-  event_value[IMSI]          = imsi;
-  event_value[IP_ADDR]       = session_cfg.common_context.ue_ipv4();
-  event_value[IPV6_ADDR]     = session_cfg.common_context.ue_ipv6();
-  event_value[MSISDN]        = session_cfg.common_context.msisdn();
-  event_value[APN]           = session_cfg.common_context.apn();
-  event_value[SESSION_ID]    = session->get_session_id();
-
-  TotalCreditUsage usage      = session->get_total_credit_usage();
-  event_value[TOTAL_TX]       = usage.charging_tx + usage.monitoring_tx;
-  event_value[TOTAL_RX]       = usage.charging_rx + usage.monitoring_rx;
-  event_value[CHARGING_TX]    = usage.charging_tx;
-  event_value[CHARGING_RX]    = usage.charging_rx;
-  event_value[MONITORING_TX]  = usage.monitoring_tx;
-  event_value[MONITORING_RX]  = usage.monitoring_rx;
-  const auto start_time       = session->get_pdp_start_time();
-  const auto end_time         = session->get_pdp_end_time();
-  event_value[PDP_START_TIME] = start_time;
-  event_value[PDP_END_TIME]   = end_time;
+  EventJsonWriter event_value;
+  event_value.add(IMSI, imsi)
+      .add(IP_ADDR, session_cfg.common_context.ue_ipv4())
+      .add(IPV6_ADDR, session_cfg.common_context.ue_ipv6())
+      .add(MSISDN, session_cfg.common_context.msisdn())
+      .add(APN, session_cfg.common_context.apn())
+      .add(SESSION_ID, session->get_session_id());
+
+  TotalCreditUsage usage = session->get_total_credit_usage();
+  event_value.add(TOTAL_TX, usage.charging_tx + usage.monitoring_tx)
+      .add(TOTAL_RX, usage.charging_rx + usage.monitoring_rx)
+      .add(CHARGING_TX, usage.charging_tx)
+      .add(CHARGING_RX, usage.charging_rx)
+      .add(MONITORING_TX, usage.monitoring_tx)
+      .add(MONITORING_RX, usage.monitoring_rx);
+  const auto start_time = session->get_pdp_start_time();
+  const auto end_time   = session->get_pdp_end_time();
+  event_value.add(PDP_START_TIME, start_time).add(PDP_END_TIME, end_time);
   // TODO these fields below should be handled by a CDR processor script
-  event_value[DURATION]                 = end_time - start_time;
-  event_value[CAUSE_FOR_RECORD_CLOSING] = int(NORMAL_RELEASE);
-  event_value[RECORD_SEQUENCE_NUMBER]   = 1;
+  event_value.add(DURATION, end_time - start_time)
+      .add(CAUSE_FOR_RECORD_CLOSING, int(NORMAL_RELEASE))
+      .add(RECORD_SEQUENCE_NUMBER, 1);
   // LTE specific
-  event_value[IMEI]          = get_imei(session_cfg);
-  event_value[SPGW_IP]       = get_spgw_ipv4(session_cfg);
-  event_value[USER_LOCATION] = get_user_location(session_cfg);
-  event_value[CHARGING_CHARACTERISTICS] =
-      get_charging_characteristics(session_cfg);
+  event_value.add(IMEI, get_imei(session_cfg))
+      .add(SPGW_IP, get_spgw_ipv4(session_cfg))
+      .add(USER_LOCATION, get_user_location(session_cfg))
+      .add(CHARGING_CHARACTERISTICS, get_charging_characteristics(session_cfg));
   // CWF specific
-  event_value[MAC_ADDR] = get_mac_addr(session_cfg);
+  event_value.add(MAC_ADDR, get_mac_addr(session_cfg));
 
   // Add Gy tracked credits
-  auto credit_summaries            = session->get_charging_credit_summaries();
-  folly::dynamic service_data_list = folly::dynamic::array;
-  for (auto summary_pair : credit_summaries) {
-    folly::dynamic service_data = folly::dynamic::object;
-    auto summary                = summary_pair.second;
-    service_data[RATING_GROUP]  = summary_pair.first.rating_group;
+  auto credit_summaries = session->get_charging_credit_summaries();
+  event_value.begin_array(SERVICE_DATA);
+  for (const auto& summary_pair : credit_summaries) {
+    const auto& summary = summary_pair.second;
+    event_value.begin_object().add(
+        RATING_GROUP, summary_pair.first.rating_group);
     if (summary_pair.first.service_identifier) {
-      service_data[SERVICE_IDENTIFIER] = summary_pair.first.service_identifier;
+      event_value.add(
+          SERVICE_IDENTIFIER, summary_pair.first.service_identifier);
     }
-    service_data[DATA_UPLINK]              = summary.usage.bytes_tx;
-    service_data[DATA_DOWNLINK]            = summary.usage.bytes_rx;
-    service_data[TIME_OF_FIRST_USAGE]      = summary.time_of_first_usage;
-    service_data[TIME_OF_LAST_USAGE]       = summary.time_of_last_usage;
-    service_data[SERVICE_CONDITION_CHANGE] = int(SERVICE_STOP);
-    service_data_list.push_back(service_data);
+    event_value.add(DATA_UPLINK, summary.usage.bytes_tx)
+        .add(DATA_DOWNLINK, summary.usage.bytes_rx)
+        .add(TIME_OF_FIRST_USAGE, summary.time_of_first_usage)
+        .add(TIME_OF_LAST_USAGE, summary.time_of_last_usage)
+        .add(SERVICE_CONDITION_CHANGE, int(SERVICE_STOP))
+        .end_object();
   }
-  event_value[SERVICE_DATA] = service_data_list;
+  event_value.end_array();
 
-  std::string event_value_string = folly::toJson(event_value);
+  std::string event_value_string = event_value.str();
   event.set_value(event_value_string);
 
   eventd_client_.log_event(event, [=](Status status, Void v) {
@@ -276,27 +276,29 @@ void EventsReporterImpl::session_terminated(
   });
 }
 
-folly::dynamic EventsReporterImpl::get_update_summary(
-    const UpdateRequests& updates) {
-  folly::dynamic update_array = folly::dynamic::array;
+void EventsReporterImpl::add_update_summary(
+    EventJsonWriter& event_value, const UpdateRequests& updates) {
+  event_value.begin_array(SERVICE_UPDATES);
   for (const auto& charging : updates.charging_requests) {
-    folly::dynamic data = folly::dynamic::object;
-    data[RATING_GROUP]  = charging.usage().charging_key();
+    event_value.begin_object().add(
+        RATING_GROUP, charging.usage().charging_key());
     if (charging.usage().has_service_identifier()) {
-      data[SERVICE_IDENTIFIER] = charging.usage().service_identifier().value();
+      event_value.add(
+          SERVICE_IDENTIFIER, charging.usage().service_identifier().value());
     }
-    data[UPDATE_REASON] = credit_update_type_to_str(charging.usage().type());
-    update_array.push_back(data);
+    event_value
+        .add(UPDATE_REASON, credit_update_type_to_str(charging.usage().type()))
+        .end_object();
   }
   for (const auto& monitor : updates.monitor_requests) {
-    folly::dynamic data = folly::dynamic::object;
-    data[UPDATE_REASON] = event_trigger_to_str(monitor.event_trigger());
+    event_value.begin_object().add(
+        UPDATE_REASON, event_trigger_to_str(monitor.event_trigger()));
     if (monitor.has_update()) {
-      data[MONITORING_KEY] = monitor.update().monitoring_key();
+      event_value.add(MONITORING_KEY, monitor.update().monitoring_key());
     }
-    update_array.push_back(data);
+    event_value.end_object();
   }
-  return update_array;
+  event_value.end_array();
 }
 
 std::string EventsReporterImpl::get_mac_addr(const SessionConfig& config) {
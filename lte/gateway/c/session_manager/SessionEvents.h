@@ -11,15 +11,13 @@
  * limitations under the License.
  */
 
-#include <folly/dynamic.h>
-#include <folly/Format.h>
-#include <folly/json.h>
 #include <orc8r/protos/eventd.pb.h>
 
 #include <memory>
 #include <string>
 #include <utility>
 
+#include "includes/EventJsonWriter.h"
 #include "includes/EventdClient.h"
 #include "magma_logging.h"
 #include "SessionState.h"
@@ -86,7 +84,8 @@ class EventsReporterImpl : public EventsReporter {
   std::string get_spgw_ipv4(const SessionConfig& config);
   std::string get_user_location(const SessionConfig& config);
   std::string get_charging_characteristics(const SessionConfig& config);
-  folly::dynamic get_update_summary(const UpdateRequests& updates);
+  void add_update_summary(
+      EventJsonWriter& event_value, const UpdateRequests& updates);
 
  private:
   EventdClient& eventd_client_;
@@ -36,8 +36,8 @@ void SessionProxyResponderHandlerImpl::ChargingReAuth(
   MLOG(MDEBUG) << "Received a Gy (Charging) ReAuthRequest for "
                << request->session_id() << " and charging_key "
                << request->charging_key();
-  enforcer_->get_event_base().runInEventBaseThread([this, request_cpy,
-                                                    response_callback]() {
+  enforcer_->run_in_shard(request_cpy.sid(), [this, request_cpy,
+                                              response_callback]() {
     auto session_map = session_store_.read_sessions({request_cpy.sid()});
     SessionUpdate update =
         SessionStore::get_default_session_update(session_map);
@@ -77,8 +77,8 @@ void SessionProxyResponderHandlerImpl::PolicyReAuth(
   PrintGrpcMessage(static_cast<const google::protobuf::Message&>(request_cpy));
   MLOG(MDEBUG) << "Received a Gx (Policy) ReAuthRequest for session_id "
                << request->session_id();
-  enforcer_->get_event_base().runInEventBaseThread([this, request_cpy,
-                                                    response_callback]() {
+  enforcer_->run_in_shard(request_cpy.imsi(), [this, request_cpy,
+                                               response_callback]() {
     PolicyReAuthAnswer ans;
     auto session_map = session_store_.read_sessions({request_cpy.imsi()});
     SessionUpdate update =
@@ -120,8 +120,8 @@ void SessionProxyResponderHandlerImpl::AbortSession(
   }
   const auto session_id = request->session_id();
   MLOG(MINFO) << "Received an ASR for session_id " << session_id;
-  enforcer_->get_event_base().runInEventBaseThread([this, imsi, session_id,
-                                                    response_callback]() {
+  enforcer_->run_in_shard(imsi, [this, imsi, session_id,
+                                 response_callback]() {
     grpc::Status status = Status::OK;
     AbortSessionResult answer;
     auto session_map = session_store_.read_sessions({imsi});
@@ -10,6 +10,7 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <folly/io/async/EventBaseManager.h>
 #include <glog/logging.h>
 
 #include <iostream>
@@ -26,8 +27,9 @@ template<class ResponseType>
 AsyncEvbResponse<ResponseType>::AsyncEvbResponse(
     folly::EventBase* base,
     std::function<void(grpc::Status, ResponseType)> callback,
-    uint32_t timeout_sec)
-    : AsyncGRPCResponse<ResponseType>(callback, timeout_sec), base_(base) {}
+    uint32_t timeout_sec, const char* rpc)
+    : AsyncGRPCResponse<ResponseType>(callback, timeout_sec, rpc),
+      base_(base) {}
 
 template<class ResponseType>
 void AsyncEvbResponse<ResponseType>::handle_response() {
@@ -51,17 +53,30 @@ SessionReporter::get_terminate_logging_cb(
   };
 }
 
+folly::EventBase* SessionReporterImpl::get_response_event_base() {
+  auto evb = folly::EventBaseManager::get()->getExistingEventBase();
+  return evb != nullptr ? evb : base_;
+}
+
 SessionReporterImpl::SessionReporterImpl(
     folly::EventBase* base, std::shared_ptr<grpc::Channel> channel)
     : base_(base), stub_(CentralSessionController::NewStub(channel)) {}
 
+SessionReporterImpl::SessionReporterImpl(
+    folly::EventBase* base, std::shared_ptr<grpc::Channel> channel,
+    GRPCRuntime& runtime)
+    : SessionReporter(runtime),
+      base_(base),
+      stub_(CentralSessionController::NewStub(channel)) {}
+
 void SessionReporterImpl::report_updates(
     const UpdateSessionRequest& request,
     ReporterCallbackFn<UpdateSessionResponse> callback) {
   PrintGrpcMessage(static_cast<const google::protobuf::Message&>(request));
 
   auto controller_response = new AsyncEvbResponse<UpdateSessionResponse>(
-      base_, callback, RESPONSE_TIMEOUT);
+      get_response_event_base(), callback, RESPONSE_TIMEOUT,
+      "CentralSessionController/UpdateSession");
   controller_response->set_response_reader(std::move(stub_->AsyncUpdateSession(
       controller_response->get_context(), request, &queue_)));
 }
@@ -71,7 +86,8 @@ void SessionReporterImpl::report_create_session(
     ReporterCallbackFn<CreateSessionResponse> callback) {
   PrintGrpcMessage(static_cast<const google::protobuf::Message&>(request));
   auto controller_response = new AsyncEvbResponse<CreateSessionResponse>(
-      base_, callback, RESPONSE_TIMEOUT);
+      get_response_event_base(), callback, RESPONSE_TIMEOUT,
+      "CentralSessionController/CreateSession");
   controller_response->set_response_reader(std::move(stub_->AsyncCreateSession(
       controller_response->get_context(), request, &queue_)));
 }
@@ -81,7 +97,8 @@ void SessionReporterImpl::report_terminate_session(
     ReporterCallbackFn<SessionTerminateResponse> callback) {
   PrintGrpcMessage(static_cast<const google::protobuf::Message&>(request));
   auto controller_response = new AsyncEvbResponse<SessionTerminateResponse>(
-      base_, callback, RESPONSE_TIMEOUT);
+      get_response_event_base(), callback, RESPONSE_TIMEOUT,
+      "CentralSessionController/TerminateSession");
   controller_response->set_response_reader(
       std::move(stub_->AsyncTerminateSession(
           controller_response->get_context(), request, &queue_)));
@@ -41,7 +41,7 @@ class AsyncEvbResponse : public AsyncGRPCResponse<ResponseType> {
  public:
   AsyncEvbResponse(
       folly::EventBase* base, ReporterCallbackFn<ResponseType> callback,
-      uint32_t timeout_sec);
+      uint32_t timeout_sec, const char* rpc);
 
   void handle_response() override;
 
@@ -51,6 +51,8 @@ class AsyncEvbResponse : public AsyncGRPCResponse<ResponseType> {
 
 class SessionReporter : public GRPCReceiver {
  public:
+  SessionReporter() = default;
+  explicit SessionReporter(GRPCRuntime& runtime) : GRPCReceiver(runtime) {}
   virtual ~SessionReporter() = default;
 
   /**
@@ -90,6 +92,14 @@ class SessionReporterImpl : public SessionReporter {
   SessionReporterImpl(
       folly::EventBase* base, std::shared_ptr<grpc::Channel> channel);
 
+  /**
+   * Responses are served by a queue of runtime, rpc_response_loop does not
+   * have to be run
+   */
+  SessionReporterImpl(
+      folly::EventBase* base, std::shared_ptr<grpc::Channel> channel,
+      GRPCRuntime& runtime);
+
   void report_updates(
       const UpdateSessionRequest& request,
       std::function<void(grpc::Status, UpdateSessionResponse)> callback);
@@ -103,6 +113,12 @@ class SessionReporterImpl : public SessionReporter {
       std::function<void(grpc::Status, SessionTerminateResponse)> callback);
 
  private:
+  /**
+   * Responses are handled on the event base of the thread sending the
+   * request, the shard of its sessions, or on base_ for other threads
+   */
+  folly::EventBase* get_response_event_base();
+
   folly::EventBase* base_;
   std::unique_ptr<CentralSessionController::Stub> stub_;
   static const uint32_t RESPONSE_TIMEOUT = 6;  // seconds
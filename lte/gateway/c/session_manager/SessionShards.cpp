@@ -0,0 +1,59 @@
+/**
+ * Copyright 2020 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <functional>
+#include <utility>
+
+#include "includes/MetricsHelpers.h"
+#include "magma_logging.h"
+#include "SessionShards.h"
+
+#define SHARD_QUEUE_DELAY_METRIC "sessiond_shard_queue_delay_ms"
+
+namespace magma {
+
+SessionShards::SessionShards(folly::EventBase* main_evb, uint32_t num_shards) {
+  evbs_.push_back(main_evb);
+  for (uint32_t shard = 1; shard < num_shards; shard++) {
+    threads_.push_back(std::make_unique<folly::ScopedEventBaseThread>(
+        "sessiond_shard" + std::to_string(shard)));
+    evbs_.push_back(threads_.back()->getEventBase());
+  }
+  MLOG(MINFO) << "Sessions are sharded by IMSI across " << evbs_.size()
+              << " event base threads";
+}
+
+uint32_t SessionShards::shard_of(
+    const std::string& imsi, uint32_t num_shards) {
+  if (num_shards <= 1) {
+    return 0;
+  }
+  return std::hash<std::string>()(imsi) % num_shards;
+}
+
+void SessionShards::run_in_shard(uint32_t shard, folly::Func fn) {
+  auto queued = std::chrono::steady_clock::now();
+  evbs_[shard]->runInEventBaseThread(
+      [shard, queued, fn = std::move(fn)]() mutable {
+        std::chrono::duration<double, std::milli> delay =
+            std::chrono::steady_clock::now() - queued;
+        magma::service303::observe_histogram(
+            SHARD_QUEUE_DELAY_METRIC, delay.count(), 1, "shard",
+            std::to_string(shard).c_str(), (size_t) 8, 0.1, 0.5, 1., 5., 10.,
+            50., 100., 500.);
+        fn();
+      });
+}
+
+}  // namespace magma
@@ -0,0 +1,59 @@
+/**
+ * Copyright 2020 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <folly/io/async/EventBase.h>
+#include <folly/io/async/ScopedEventBaseThread.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace magma {
+
+/**
+ * SessionShards partitions the sessions by IMSI hash across event base
+ * threads. The shard owning an IMSI is the only one reading, modifying and
+ * writing its sessions and running their timers, so shards never contend on
+ * a session. Shard 0 is the event base of the main thread, each other shard
+ * runs its own thread. With a single shard, everything runs on the main
+ * event base as before.
+ */
+class SessionShards {
+ public:
+  SessionShards(folly::EventBase* main_evb, uint32_t num_shards);
+
+  uint32_t size() const { return evbs_.size(); }
+
+  uint32_t get_shard(const std::string& imsi) const {
+    return shard_of(imsi, evbs_.size());
+  }
+
+  // The shard owning imsi out of num_shards, also used to lock SessionStore
+  static uint32_t shard_of(const std::string& imsi, uint32_t num_shards);
+
+  folly::EventBase& get_event_base(uint32_t shard) { return *evbs_[shard]; }
+
+  /**
+   * Run fn on the event base of shard. The time fn waited in the queue of
+   * the shard is observed in the sessiond_shard_queue_delay_ms histogram.
+   */
+  void run_in_shard(uint32_t shard, folly::Func fn);
+
+ private:
+  std::vector<folly::EventBase*> evbs_;
+  // Stopped and joined on destruction
+  std::vector<std::unique_ptr<folly::ScopedEventBaseThread>> threads_;
+};
+
+}  // namespace magma
@@ -11,6 +11,7 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <utility>
 
 #include "magma_logging.h"
@@ -26,7 +27,8 @@ SessionStore::SessionStore(
     std::shared_ptr<magma::MeteringReporter> metering_reporter)
     : rule_store_(rule_store),
       store_client_(std::make_shared<MemoryStoreClient>(rule_store)),
-      metering_reporter_(metering_reporter) {}
+      metering_reporter_(metering_reporter),
+      shard_mutexes_(1) {}
 
 SessionStore::SessionStore(
     std::shared_ptr<StaticRuleStore> rule_store,
@@ -34,26 +36,93 @@ SessionStore::SessionStore(
     std::shared_ptr<RedisStoreClient> store_client)
     : rule_store_(rule_store),
       store_client_(store_client),
-      metering_reporter_(metering_reporter) {}
+      metering_reporter_(metering_reporter),
+      shard_mutexes_(1) {}
+
+bool SessionStore::is_ready() {
+  return store_client_->is_ready();
+}
+
+void SessionStore::set_num_shards(uint32_t num_shards) {
+  shard_mutexes_ = std::vector<std::mutex>(std::max(num_shards, 1u));
+}
+
+SessionStore::ShardLocks SessionStore::lock_shards(
+    const std::set<std::string>& subscriber_ids) {
+  std::set<uint32_t> shards;
+  for (const auto& subscriber_id : subscriber_ids) {
+    shards.insert(
+        SessionShards::shard_of(subscriber_id, shard_mutexes_.size()));
+  }
+  // In increasing order, so that concurrent callers do not deadlock
+  ShardLocks locks;
+  for (uint32_t shard : shards) {
+    locks.emplace_back(shard_mutexes_[shard]);
+  }
+  return locks;
+}
+
+SessionStore::ShardLocks SessionStore::lock_all_shards() {
+  ShardLocks locks;
+  for (auto& shard_mutex : shard_mutexes_) {
+    locks.emplace_back(shard_mutex);
+  }
+  return locks;
+}
 
 bool SessionStore::raw_write_sessions(SessionMap session_map) {
-  // return true;
+  auto subscriber_ids = std::set<std::string>{};
+  for (const auto& it : session_map) {
+    subscriber_ids.insert(it.first);
+  }
+  auto locks = lock_shards(subscriber_ids);
   return store_client_->write_sessions(std::move(session_map));
 }
 
 SessionMap SessionStore::read_sessions(const SessionRead& req) {
+  auto locks = lock_shards(req);
   return store_client_->read_sessions(req);
 }
 
 SessionMap SessionStore::read_all_sessions() {
+  auto locks = lock_all_shards();
   return store_client_->read_all_sessions();
 }
 
+SessionMap SessionStore::read_shard_sessions(uint32_t shard) {
+  if (shard_mutexes_.size() == 1) {
+    return read_all_sessions();
+  }
+  std::lock_guard<std::mutex> lock(shard_mutexes_[shard]);
+  // Only the subscribers of the shard are read and deserialized
+  auto subscriber_ids = store_client_->read_subscriber_ids();
+  for (auto it = subscriber_ids.begin(); it != subscriber_ids.end();) {
+    if (SessionShards::shard_of(*it, shard_mutexes_.size()) != shard) {
+      it = subscriber_ids.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  return store_client_->read_sessions(subscriber_ids);
+}
+
 void SessionStore::set_and_save_reporting_flag(
     bool value, const UpdateSessionRequest& update_session_request,
     SessionUpdate& session_uc) {
   MLOG(MDEBUG) << "saving flag is_reporting = " << value << " on session store";
-  auto session_map = store_client_->read_all_sessions();
+  // Only the subscribers of the request are read and written back, those of
+  // other shards being left alone
+  auto subscriber_ids = std::set<std::string>{};
+  for (const CreditUsageUpdate& credit_update :
+       update_session_request.updates()) {
+    subscriber_ids.insert(credit_update.common_context().sid().id());
+  }
+  for (const UsageMonitoringUpdateRequest& monitor_update :
+       update_session_request.usage_monitors()) {
+    subscriber_ids.insert(monitor_update.sid());
+  }
+  auto locks       = lock_shards(subscriber_ids);
+  auto session_map = store_client_->read_sessions(subscriber_ids);
 
   for (const CreditUsageUpdate& credit_update :
        update_session_request.updates()) {
@@ -114,6 +183,7 @@ void SessionStore::sync_request_numbers(const SessionUpdate& update_criteria) {
   for (const auto& it : update_criteria) {
     subscriber_ids.insert(it.first);
   }
+  auto locks       = lock_shards(subscriber_ids);
   auto session_map = store_client_->read_sessions(subscriber_ids);
 
   // Sync stored state so that subsequent reads have the right request_number
@@ -136,6 +206,7 @@ void SessionStore::sync_request_numbers(const SessionUpdate& update_criteria) {
 }
 
 SessionMap SessionStore::read_sessions_for_deletion(const SessionRead& req) {
+  auto locks         = lock_shards(req);
   auto session_map   = store_client_->read_sessions(req);
   auto session_map_2 = store_client_->read_sessions(req);
   // For all sessions of the subscriber, increment the request numbers
@@ -152,6 +223,8 @@ bool SessionStore::create_sessions(
     const std::string& subscriber_id, SessionVector sessions) {
   auto session_map           = SessionMap{};
   session_map[subscriber_id] = std::move(sessions);
+  std::lock_guard<std::mutex> lock(shard_mutexes_[SessionShards::shard_of(
+      subscriber_id, shard_mutexes_.size())]);
   store_client_->write_sessions(std::move(session_map));
   return true;
 }
@@ -162,6 +235,7 @@ bool SessionStore::update_sessions(const SessionUpdate& update_criteria) {
   for (const auto& it : update_criteria) {
     subscriber_ids.insert(it.first);
   }
+  auto locks       = lock_shards(subscriber_ids);
   auto session_map = store_client_->read_sessions(subscriber_ids);
   // Now attempt to modify the state
   for (auto& it : session_map) {
@@ -198,7 +272,7 @@ bool SessionStore::update_sessions(const SessionUpdate& update_criteria) {
 }
 
 void SessionStore::initialize_metering_counter() {
-  auto session_map = store_client_->read_all_sessions();
+  auto session_map = read_all_sessions();
   for (auto& sessions_by_imsi : session_map) {
     const std::string imsi = sessions_by_imsi.first;
     for (auto& session : sessions_by_imsi.second) {
@@ -17,14 +17,17 @@
 #include <lte/protos/session_manager.grpc.pb.h>
 
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "MemoryStoreClient.h"
 #include "MeteringReporter.h"
 #include "RedisStoreClient.h"
 #include "RuleStore.h"
+#include "SessionShards.h"
 #include "SessionState.h"
 #include "StoredState.h"
 
@@ -96,7 +99,15 @@ class SessionStore {
    * @brief Return a boolean to indicate whether the storage client is ready to
    * accept requests
    */
-  bool is_ready() { return store_client_->is_ready(); };
+  bool is_ready();
+
+  /**
+   * Lock the store by shard of LocalEnforcer, rather than as a whole, so that
+   * the shards read, modify and write the sessions they own concurrently.
+   * Called before the shards start.
+   * @param num_shards
+   */
+  void set_num_shards(uint32_t num_shards);
 
   /**
    * Writes the session map directly to the store. Note that the existing map
@@ -123,6 +134,14 @@ class SessionStore {
    */
   SessionMap read_all_sessions();
 
+  /**
+   * Read the last written values for the sessions of the subscribers owned
+   * by shard. The sessions of the other subscribers are not read.
+   * @param shard
+   * @return Last written values for the sessions of the shard
+   */
+  SessionMap read_shard_sessions(uint32_t shard);
+
   /**
    * Modify the SessionMap in SessionStore to match the current state in
    * the callback.
@@ -210,6 +229,14 @@ class SessionStore {
   std::shared_ptr<StaticRuleStore> rule_store_;
   std::shared_ptr<StoreClient> store_client_;
   std::shared_ptr<MeteringReporter> metering_reporter_;
+  // Each read-modify-write of the store is done under the locks of the shards
+  // of its subscribers, taken in order. The sessions of a subscriber are only
+  // written by the shard owning it, so the shards rarely wait on each other.
+  std::vector<std::mutex> shard_mutexes_;
+
+  using ShardLocks = std::vector<std::unique_lock<std::mutex>>;
+  ShardLocks lock_shards(const std::set<std::string>& subscriber_ids);
+  ShardLocks lock_all_shards();
 };
 
 }  // namespace lte
@@ -78,10 +78,15 @@ AsyncSpgwServiceClient::AsyncSpgwServiceClient(
     std::shared_ptr<grpc::Channel> channel)
     : stub_(SpgwService::NewStub(channel)) {}
 
+AsyncSpgwServiceClient::AsyncSpgwServiceClient(
+    std::shared_ptr<grpc::Channel> channel, GRPCRuntime& runtime)
+    : GRPCReceiver(runtime), stub_(SpgwService::NewStub(channel)) {}
+
 AsyncSpgwServiceClient::AsyncSpgwServiceClient()
     : AsyncSpgwServiceClient(
           ServiceRegistrySingleton::Instance()->GetGrpcChannel(
-              "spgw_service", ServiceRegistrySingleton::LOCAL)) {}
+              "spgw_service", ServiceRegistrySingleton::LOCAL),
+          GRPCRuntime::get_instance()) {}
 
 bool AsyncSpgwServiceClient::delete_default_bearer(
     const std::string& imsi, const std::string& apn_ip_addr,
@@ -156,7 +161,7 @@ void AsyncSpgwServiceClient::delete_bearer_rpc(
     const DeleteBearerRequest& request,
     std::function<void(Status, DeleteBearerResult)> callback) {
   auto local_resp = new AsyncLocalResponse<DeleteBearerResult>(
-      std::move(callback), RESPONSE_TIMEOUT);
+      std::move(callback), RESPONSE_TIMEOUT, "SpgwService/DeleteBearer");
   local_resp->set_response_reader(std::move(
       stub_->AsyncDeleteBearer(local_resp->get_context(), request, &queue_)));
 }
@@ -165,7 +170,7 @@ void AsyncSpgwServiceClient::create_dedicated_bearer_rpc(
     const CreateBearerRequest& request,
     std::function<void(Status, CreateBearerResult)> callback) {
   auto local_resp = new AsyncLocalResponse<CreateBearerResult>(
-      std::move(callback), RESPONSE_TIMEOUT);
+      std::move(callback), RESPONSE_TIMEOUT, "SpgwService/CreateBearer");
   local_resp->set_response_reader(std::move(
       stub_->AsyncCreateBearer(local_resp->get_context(), request, &queue_)));
 }
@@ -103,6 +103,14 @@ class AsyncSpgwServiceClient : public GRPCReceiver, public SpgwServiceClient {
   AsyncSpgwServiceClient();
 
   explicit AsyncSpgwServiceClient(std::shared_ptr<grpc::Channel> pgw_channel);
+
+  /**
+   * Responses are served by a queue of runtime, rpc_response_loop does not
+   * have to be run. The default constructor uses the shared runtime.
+   */
+  AsyncSpgwServiceClient(
+      std::shared_ptr<grpc::Channel> pgw_channel, GRPCRuntime& runtime);
+
   /**
    * Delete a default bearer (all session bearers)
    * @param imsi - msi to identify a UE
@@ -30,6 +30,8 @@ using SessionMap    = std::unordered_map<std::string, SessionVector>;
 
 /**
  * StoreClient is responsible for reading/writing sessions to/from storage.
+ * Calls on distinct subscribers can be made concurrently, SessionStore
+ * serializes those on the same subscriber.
  */
 class StoreClient {
  public:
@@ -60,6 +62,13 @@ class StoreClient {
    */
   virtual SessionMap read_all_sessions() = 0;
 
+  /**
+   * Read the ids of the subscribers with sessions in storage, without reading
+   * their sessions
+   * @return All subscribers with sessions
+   */
+  virtual std::set<std::string> read_subscriber_ids() = 0;
+
   /**
    * Directly write the subscriber sessions into storage, overwriting previous
    * values.
@@ -16,6 +16,10 @@
 #include "magma_logging.h"
 #include <orc8r/protos/redis.pb.h>
 
+#include <functional>
+#include <unordered_map>
+#include <utility>
+
 using magma::orc8r::RedisState;
 
 namespace magma {
@@ -141,6 +145,138 @@ public:
     return SUCCESS;
   }
 
+  /**
+   * getall_changed returns the values whose version changed since the
+   * versions were taken, and the keys no longer in the hash. versions maps
+   * the keys to the version of their value and is updated. Only the values
+   * whose version changed are deserialized, which requires the writer to only
+   * write a value when it changes. modified_keys_out are the keys of the
+   * values that changed, as opposed to the ones added.
+   */
+  ObjectMapResult getall_changed(
+    std::unordered_map<std::string, uint64_t>& versions,
+    std::vector<ObjectType>& values_out,
+    std::vector<std::string>& modified_keys_out,
+    std::vector<std::string>& removed_keys_out) {
+    auto hgetall_future = client_->hgetall(hash_);
+    client_->sync_commit();
+    auto reply = hgetall_future.get();
+    if (reply.is_error()) {
+      MLOG(MERROR) << "unable to perform hgetall command";
+      return CLIENT_ERROR;
+    }
+    std::vector<std::pair<std::string, cpp_redis::reply>> entries;
+    auto array = reply.is_null() ? std::vector<cpp_redis::reply>() :
+                                   reply.as_array();
+    for (unsigned int i = 0; i + 1 < array.size(); i += 2) {
+      if (!array[i].is_string()) {
+        MLOG(MERROR) << "Non string key found";
+        continue;
+      }
+      entries.emplace_back(array[i].as_string(), array[i+1]);
+    }
+    collect_changed(
+        entries, true, versions, values_out, modified_keys_out,
+        removed_keys_out);
+    return SUCCESS;
+  }
+
+  /**
+   * get_changed is getall_changed for the given keys only, the other values
+   * being neither read nor compared
+   */
+  ObjectMapResult get_changed(
+    const std::vector<std::string>& keys,
+    std::unordered_map<std::string, uint64_t>& versions,
+    std::vector<ObjectType>& values_out,
+    std::vector<std::string>& modified_keys_out,
+    std::vector<std::string>& removed_keys_out) {
+    if (keys.empty()) {
+      return SUCCESS;
+    }
+    auto hmget_future = client_->hmget(hash_, keys);
+    client_->sync_commit();
+    auto reply = hmget_future.get();
+    if (reply.is_error() || !reply.is_array() ||
+        reply.as_array().size() != keys.size()) {
+      MLOG(MERROR) << "unable to perform hmget command";
+      return CLIENT_ERROR;
+    }
+    std::vector<std::pair<std::string, cpp_redis::reply>> entries;
+    auto array = reply.as_array();
+    for (unsigned int i = 0; i < keys.size(); i++) {
+      entries.emplace_back(keys[i], array[i]);
+    }
+    collect_changed(
+        entries, false, versions, values_out, modified_keys_out,
+        removed_keys_out);
+    return SUCCESS;
+  }
+
+  /**
+   * collect_changed compares the values read from the hash, by key, to
+   * versions. A null value is a key removed from the hash, as is a key of
+   * versions missing from entries when entries has the whole hash.
+   */
+  void collect_changed(
+    const std::vector<std::pair<std::string, cpp_redis::reply>>& entries,
+    bool is_whole_hash,
+    std::unordered_map<std::string, uint64_t>& versions,
+    std::vector<ObjectType>& values_out,
+    std::vector<std::string>& modified_keys_out,
+    std::vector<std::string>& removed_keys_out) {
+    std::unordered_map<std::string, uint64_t> read_versions;
+    for (const auto& entry : entries) {
+      const auto& key = entry.first;
+      const auto& value_reply = entry.second;
+      auto it = versions.find(key);
+      if (value_reply.is_null()) {
+        if (it != versions.end()) {
+          removed_keys_out.push_back(key);
+          versions.erase(it);
+        }
+        continue;
+      }
+      if (!value_reply.is_string()) {
+        MLOG(MERROR) << "Non string value found for key " << key;
+        continue;
+      }
+      // The version is read from the envelope, the object is only
+      // deserialized when it changed
+      auto redis_state = RedisState();
+      if (!redis_state.ParseFromString(value_reply.as_string())) {
+        MLOG(MERROR) << "Unable to deserialize value in map for key " << key;
+        continue;
+      }
+      read_versions[key] = redis_state.version();
+      if (it != versions.end() && it->second == redis_state.version()) {
+        continue;
+      }
+      ObjectType obj;
+      if (!deserializer_(value_reply.as_string(), obj)) {
+        MLOG(MERROR) << "Unable to deserialize value in map for key " << key;
+        read_versions.erase(key);
+        continue;
+      }
+      if (it != versions.end()) {
+        modified_keys_out.push_back(key);
+      }
+      versions[key] = redis_state.version();
+      values_out.push_back(obj);
+    }
+    if (!is_whole_hash) {
+      return;
+    }
+    for (auto it = versions.begin(); it != versions.end();) {
+      if (read_versions.find(it->first) == read_versions.end()) {
+        removed_keys_out.push_back(it->first);
+        it = versions.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+
 private:
   /*
    * Return the version of the value for key *key*. Returns 0 if
@@ -15,22 +15,28 @@
 #include <yaml-cpp/yaml.h>            // IWYU pragma: keep
 #include <chrono>                     // for seconds
 #include <cpp_redis/core/client.hpp>  // for client, client::connect_state
-#include <cpp_redis/misc/error.hpp>   // for redis_error
-#include <cstdint>                    // for uint32_t
-#include <memory>                     // for make_shared, __shared_ptr, ...
-#include <ostream>                    // for operator<<, basic_ostream, ...
-#include <string>                     // for string, char_traits, operator<<
-#include <thread>                     // for sleep_for
-#include "ObjectMap.h"                // for SUCCESS
-#include "includes/RedisMap.hpp"      // for RedisMap
-#include "includes/Serializers.h"     // for get_proto_deserializer, get_pro
+#include <cpp_redis/core/subscriber.hpp>  // for subscriber
+#include <cpp_redis/misc/error.hpp>       // for redis_error
+#include <cstdint>                        // for uint32_t
+#include <memory>                         // for make_shared, __shared_ptr, ...
+#include <ostream>                        // for operator<<, basic_ostream, ...
+#include <string>                         // for string, char_traits, ...
+#include <vector>                         // for vector
+#include "ObjectMap.h"                    // for SUCCESS
+#include "includes/RedisMap.hpp"          // for RedisMap
+#include "includes/Serializers.h"  // for get_proto_deserializer, get_pro
 #include "includes/ServiceConfigLoader.h"  // for ServiceConfigLoader
 #include "lte/protos/policydb.pb.h"        // for PolicyRule
 #include "magma_logging.h"                 // for MLOG, MERROR, MDEBUG, MINFO
 
+#define POLICY_RULES_HASH "policydb:rules"
+// Published by policydb once it is done updating the rules
+#define POLICY_RULES_UPDATE_CHANNEL "policydb:rules:stream_update"
+
 namespace magma {
 
-bool try_redis_connect(cpp_redis::client& client) {
+template<typename RedisClient>
+bool try_redis_connect(RedisClient& client) {
   ServiceConfigLoader loader;
   auto config = loader.load_service_config("redis");
   auto port   = config["port"].as<uint32_t>();
@@ -39,8 +45,8 @@ bool try_redis_connect(cpp_redis::client& client) {
     client.connect(
         addr, port,
         [](const std::string& host, std::size_t port,
-           cpp_redis::client::connect_state status) {
-          if (status == cpp_redis::client::connect_state::dropped) {
+           typename RedisClient::connect_state status) {
+          if (status == RedisClient::connect_state::dropped) {
             MLOG(MERROR) << "Client disconnected from " << host << ":" << port;
           }
         });
@@ -53,39 +59,123 @@ bool try_redis_connect(cpp_redis::client& client) {
 
 bool do_loop(
     cpp_redis::client& client, RedisMap<PolicyRule>& policy_map,
-    const std::function<void(std::vector<PolicyRule>)>& processor) {
+    std::unordered_map<std::string, uint64_t>& rule_versions,
+    bool full_resync, const std::vector<std::string>& rule_ids,
+    const std::function<void(const PolicyRuleChanges&)>& processor) {
   if (!client.is_connected()) {
     if (!try_redis_connect(client)) {
       return false;
     }
     MLOG(MINFO) << "Connected to redis server";
   }
-  std::vector<PolicyRule> rules;
-  auto result = policy_map.getall(rules);
+  PolicyRuleChanges changes;
+  auto result = full_resync ?
+                    policy_map.getall_changed(
+                        rule_versions, changes.updated_rules,
+                        changes.modified_rule_ids, changes.removed_rule_ids) :
+                    policy_map.get_changed(
+                        rule_ids, rule_versions, changes.updated_rules,
+                        changes.modified_rule_ids, changes.removed_rule_ids);
   if (result != SUCCESS) {
     MLOG(MERROR) << "Failed to get rules from map because map error " << result;
     return false;
   }
-  processor(rules);
+  if (changes.empty()) {
+    return true;
+  }
+  MLOG(MINFO) << "Syncing " << changes.updated_rules.size()
+              << " updated rules, " << changes.modified_rule_ids.size()
+              << " of them modified, and " << changes.removed_rule_ids.size()
+              << " removed rules";
+  processor(changes);
   return true;
 }
 
 void PolicyLoader::start_loop(
-    std::function<void(std::vector<PolicyRule>)> processor,
-    uint32_t loop_interval_seconds) {
-  is_running_     = true;
-  auto client     = std::make_shared<cpp_redis::client>();
-  auto policy_map = RedisMap<PolicyRule>(
-      client, "policydb:rules", get_proto_serializer(),
+    std::function<void(const PolicyRuleChanges&)> processor,
+    uint32_t loop_interval_seconds, uint32_t resync_interval_seconds) {
+  is_running_      = true;
+  update_notified_ = false;
+  full_resync_     = true;
+  auto client      = std::make_shared<cpp_redis::client>();
+  auto policy_map  = RedisMap<PolicyRule>(
+      client, POLICY_RULES_HASH, get_proto_serializer(),
       get_proto_deserializer());
+  cpp_redis::subscriber subscriber;
+  auto next_resync = std::chrono::steady_clock::now();
   while (is_running_) {
-    do_loop(*client, policy_map, processor);
-    std::this_thread::sleep_for(std::chrono::seconds(loop_interval_seconds));
+    if (!subscriber.is_connected() && try_redis_connect(subscriber)) {
+      subscriber.subscribe(
+          POLICY_RULES_UPDATE_CHANNEL,
+          [this](const std::string& channel, const std::string& message) {
+            notify_update(message);
+          });
+      subscriber.commit();
+      MLOG(MINFO) << "Subscribed to " << POLICY_RULES_UPDATE_CHANNEL;
+    }
+    // Without the notifications, the rules are polled
+    bool is_subscribed = subscriber.is_connected();
+    bool full_resync;
+    std::vector<std::string> rule_ids;
+    {
+      std::lock_guard<std::mutex> lock(update_mutex_);
+      full_resync = full_resync_ || !is_subscribed ||
+                    std::chrono::steady_clock::now() >= next_resync;
+      rule_ids.assign(notified_rule_ids_.begin(), notified_rule_ids_.end());
+      notified_rule_ids_.clear();
+      full_resync_ = false;
+    }
+    if (full_resync || !rule_ids.empty()) {
+      if (!do_loop(
+              *client, policy_map, rule_versions_, full_resync, rule_ids,
+              processor)) {
+        // The notified rules are read again by the next resync
+        std::lock_guard<std::mutex> lock(update_mutex_);
+        full_resync_ = true;
+      } else if (full_resync) {
+        next_resync = std::chrono::steady_clock::now() +
+                      std::chrono::seconds(resync_interval_seconds);
+      }
+    }
+
+    std::unique_lock<std::mutex> lock(update_mutex_);
+    auto deadline =
+        is_subscribed ?
+            next_resync :
+            std::chrono::steady_clock::now() +
+                std::chrono::seconds(loop_interval_seconds);
+    update_cv_.wait_until(lock, deadline, [this] {
+      return update_notified_ || !is_running_;
+    });
+    update_notified_ = false;
+  }
+}
+
+void PolicyLoader::notify_update(const std::string& message) {
+  std::lock_guard<std::mutex> lock(update_mutex_);
+  // policydb lists the ids of the rules it changed, one per line after the
+  // first. Without them, any rule may have changed.
+  auto pos = message.find('\n');
+  if (pos == std::string::npos) {
+    full_resync_ = true;
+  }
+  while (pos != std::string::npos) {
+    auto end = message.find('\n', pos + 1);
+    auto rule_id =
+        message.substr(pos + 1, end == std::string::npos ? end : end - pos - 1);
+    if (!rule_id.empty()) {
+      notified_rule_ids_.insert(rule_id);
+    }
+    pos = end;
   }
+  update_notified_ = true;
+  update_cv_.notify_one();
 }
 
 void PolicyLoader::stop() {
   is_running_ = false;
+  std::lock_guard<std::mutex> lock(update_mutex_);
+  update_cv_.notify_one();
 }
 
 }  // namespace magma
@@ -12,30 +12,53 @@
  */
 #include <stdint.h>                      // for uint32_t
 #include <atomic>                        // for atomic
+#include <condition_variable>            // for condition_variable
 #include <functional>                    // for function
+#include <mutex>                         // for mutex
+#include <set>                           // for set
+#include <string>                        // for string
+#include <unordered_map>                 // for unordered_map
 #include <vector>                        // for vector
+#include "lte/protos/policydb.pb.h"      // for PolicyRule
 #include "lte/protos/subscriberdb.pb.h"  // for lte
-namespace magma {
-namespace lte {
-class PolicyRule;
-}
-}  // namespace magma
 
 namespace magma {
 using namespace lte;
+
 /**
- * PolicyLoader is used to sync policies with Redis every so often
+ * PolicyRuleChanges are the changes made to the rules of policydb since the
+ * last sync
+ */
+struct PolicyRuleChanges {
+  // Rules added or modified
+  std::vector<PolicyRule> updated_rules;
+  // Ids of the rules of updated_rules that were modified
+  std::vector<std::string> modified_rule_ids;
+  std::vector<std::string> removed_rule_ids;
+
+  bool empty() const {
+    return updated_rules.empty() && removed_rule_ids.empty();
+  }
+};
+
+/**
+ * PolicyLoader is used to sync policies with Redis as they change
  */
 class PolicyLoader {
  public:
   /**
-   * start_loop is the main function to call to initiate a load loop. Based on
-   * the given loop interval length, this function will load the policies from
-   * redis, and call the processor callback.
+   * start_loop is the main function to call to initiate a load loop. The
+   * policies are synced from redis when policydb notifies an update of its
+   * rules, and every resync_interval_seconds in case a notification was
+   * missed, or every loop_interval_seconds while the notifications cannot
+   * be received. A notification listing the rules policydb changed only
+   * reads those. Only the rules that changed since the last sync are
+   * deserialized and handed to the processor callback, which is not called
+   * when nothing changed.
    */
   void start_loop(
-      std::function<void(std::vector<PolicyRule>)> processor,
-      uint32_t loop_interval_seconds);
+      std::function<void(const PolicyRuleChanges&)> processor,
+      uint32_t loop_interval_seconds, uint32_t resync_interval_seconds);
 
   /**
    * Stop the config loop on the next loop
@@ -43,6 +66,17 @@ class PolicyLoader {
   void stop();
 
  private:
+  void notify_update(const std::string& message);
+
   std::atomic<bool> is_running_;
+  std::mutex update_mutex_;
+  std::condition_variable update_cv_;
+  bool update_notified_;
+  // Ids of the rules notified since the last sync
+  std::set<std::string> notified_rule_ids_;
+  // Whether every rule is read on the next sync
+  bool full_resync_;
+  // rule id -> version of the rule at the last sync
+  std::unordered_map<std::string, uint64_t> rule_versions_;
 };
 }  // namespace magma
@@ -13,6 +13,7 @@
 
 #include <lte/protos/mconfig/mconfigs.pb.h>
 
+#include <algorithm>
 #include <cstdlib>
 #include <iostream>
 
@@ -21,7 +22,10 @@
 #include "LocalEnforcer.h"
 #include "magma_logging_init.h"
 #include "includes/MagmaService.h"
+#include "includes/EventdPipeline.h"
+#include "includes/GRPCRuntime.h"
 #include "includes/MConfigLoader.h"
+#include "includes/MetricsHelpers.h"
 #include "OperationalStatesHandler.h"
 #include "includes/PolicyLoader.h"
 #include "RedisStoreClient.h"
@@ -44,6 +48,8 @@
 #define DEFAULT_QUOTA_EXHAUSTION_TERMINATION_MS 30000  // 30sec
 #define DEFAULT_SESSION_MAX_RTX_COUNT 3
 #define DEFAULT_POLL_INTERVAL_TIME 5
+#define DEFAULT_RULE_RESYNC_INTERVAL_SEC 60
+#define GRPC_CLIENT_LATENCY_METRIC "grpc_client_latency_ms"
 
 #ifdef DEBUG
 extern "C" void __gcov_flush(void);
@@ -68,6 +74,36 @@ static magma::mconfig::SessionD load_mconfig() {
   return mconfig;
 }
 
+static void observe_grpc_latency(const std::string& rpc, double latency_ms) {
+  magma::service303::observe_histogram(
+      GRPC_CLIENT_LATENCY_METRIC, latency_ms, 1, "rpc", rpc.c_str(),
+      (size_t) 8, 1., 5., 10., 50., 100., 500., 1000., 5000.);
+}
+
+static magma::EventdPipelineConfig get_eventd_pipeline_config(
+    const YAML::Node& config) {
+  magma::EventdPipelineConfig pipeline_config;
+  if (config["eventd_max_queued_events"].IsDefined()) {
+    pipeline_config.max_queued_events =
+        config["eventd_max_queued_events"].as<size_t>();
+  }
+  if (config["eventd_max_in_flight"].IsDefined()) {
+    pipeline_config.max_in_flight =
+        config["eventd_max_in_flight"].as<uint32_t>();
+  }
+  if (config["eventd_max_batch_size"].IsDefined()) {
+    pipeline_config.max_batch_size =
+        config["eventd_max_batch_size"].as<uint32_t>();
+  }
+  if (config["eventd_overload_sample_rate"].IsDefined()) {
+    // Sample instead of dropping the oldest events
+    pipeline_config.overload_policy = magma::EventOverloadPolicy::SAMPLE;
+    pipeline_config.sample_rate =
+        config["eventd_overload_sample_rate"].as<uint32_t>();
+  }
+  return pipeline_config;
+}
+
 static const std::shared_ptr<grpc::Channel> get_controller_channel(
     const YAML::Node& config, const bool gx_gy_relay_enabled) {
   if (gx_gy_relay_enabled) {
@@ -227,44 +263,28 @@ int main(int argc, char* argv[]) {
   MLOG(MINFO) << "Starting Session Manager";
   folly::EventBase* evb = folly::EventBaseManager::get()->getEventBase();
 
-  // Start off a thread to periodically load policy definitions from Redis into
-  // RuleStore
   auto rule_store = std::make_shared<magma::StaticRuleStore>();
-  magma::PolicyLoader policy_loader;
-  std::thread policy_loader_thread([&]() {
-    policy_loader.start_loop(
-        [&](std::vector<magma::PolicyRule> rules) {
-          rule_store->sync_rules(rules);
-        },
-        config["rule_update_inteval_sec"].as<uint32_t>());
-    policy_loader.stop();
-  });
 
-  auto pipelined_client = std::make_shared<magma::AsyncPipelinedClient>();
-  std::thread pipelined_response_handling_thread([&]() {
-    MLOG(MINFO) << "Started PipelineD response thread";
-    pipelined_client->rpc_response_loop();
-  });
+  // The responses of every gRPC client below are handled by the threads of
+  // the shared runtime
+  auto& grpc_runtime = magma::GRPCRuntime::get_instance();
+  if (config["grpc_cq_threads"].IsDefined()) {
+    grpc_runtime.set_num_threads(config["grpc_cq_threads"].as<uint32_t>());
+  }
+  grpc_runtime.set_latency_observer(observe_grpc_latency);
 
+  auto pipelined_client  = std::make_shared<magma::AsyncPipelinedClient>();
   auto directoryd_client = std::make_shared<magma::AsyncDirectorydClient>();
-  std::thread directoryd_response_handling_thread([&]() {
-    MLOG(MINFO) << "Started DirectoryD response thread";
-    directoryd_client->rpc_response_loop();
-  });
 
-  auto& eventd_client = magma::AsyncEventdClient::getInstance();
+  // Session events go through a bounded queue so that a burst of sessions
+  // does not turn into a burst of eventd RPCs
+  magma::EventdPipeline eventd_pipeline(
+      magma::AsyncEventdClient::getInstance(),
+      get_eventd_pipeline_config(config));
   auto events_reporter =
-      std::make_shared<magma::lte::EventsReporterImpl>(eventd_client);
-  std::thread eventd_response_handling_thread([&]() {
-    MLOG(MINFO) << "Started EventD response thread";
-    eventd_client.rpc_response_loop();
-  });
+      std::make_shared<magma::lte::EventsReporterImpl>(eventd_pipeline);
 
   auto mobilityd_client = std::make_shared<magma::AsyncMobilitydClient>();
-  std::thread mobilityd_response_handling_thread([&]() {
-    MLOG(MINFO) << "Started MobilityD response thread";
-    mobilityd_client->rpc_response_loop();
-  });
 
   std::shared_ptr<magma::AsyncSpgwServiceClient> spgw_client;
   std::shared_ptr<aaa::AsyncAAAClient> aaa_client;
@@ -277,33 +297,20 @@ int main(int argc, char* argv[]) {
     aaa_client     = nullptr;
   }
   // Case on config, setup the appropriate client for the access component
-  std::thread access_response_handling_thread;
   if (config["support_carrier_wifi"].as<bool>()) {
-    aaa_client                      = std::make_shared<aaa::AsyncAAAClient>();
-    access_response_handling_thread = std::thread([&]() {
-      MLOG(MINFO) << "Started AAA Client response thread";
-      aaa_client->rpc_response_loop();
-    });
-    spgw_client                     = nullptr;
-    amf_srv_client                  = nullptr;
+    aaa_client     = std::make_shared<aaa::AsyncAAAClient>();
+    spgw_client    = nullptr;
+    amf_srv_client = nullptr;
   } else {
     spgw_client = std::make_shared<magma::AsyncSpgwServiceClient>();
-    access_response_handling_thread = std::thread([&]() {
-      MLOG(MINFO) << "Started SPGW response thread";
-      spgw_client->rpc_response_loop();
-    });
-    aaa_client                      = nullptr;
+    aaa_client  = nullptr;
   }
 
   // Setup SessionReporter which talks to the policy component
   // (FeG+PCRF/PolicyDB).
   bool gx_gy_relay_enabled = mconfig.gx_gy_relay_enabled();
   auto reporter            = std::make_shared<magma::SessionReporterImpl>(
-      evb, get_controller_channel(config, gx_gy_relay_enabled));
-  std::thread policy_response_handler([&]() {
-    MLOG(MINFO) << "Started reporter thread";
-    reporter->rpc_response_loop();
-  });
+      evb, get_controller_channel(config, gx_gy_relay_enabled), grpc_runtime);
 
   // Case on stateless config, setup the appropriate store client
   auto metering_reporter = std::make_shared<magma::MeteringReporter>();
@@ -321,6 +328,35 @@ int main(int argc, char* argv[]) {
       spgw_client, aaa_client,
       config["session_force_termination_timeout_ms"].as<long>(),
       get_quota_exhaust_termination_time(config), mconfig);
+  // The sessions are sharded by IMSI across event bases, shard 0 being evb,
+  // run by this thread
+  uint32_t session_shards = 1;
+  if (config["session_shards"].IsDefined()) {
+    session_shards = std::max(config["session_shards"].as<uint32_t>(), 1u);
+  }
+  local_enforcer->attachEventBase(evb, session_shards);
+
+  // Start off a thread to load policy definitions from Redis into RuleStore
+  // as they change
+  uint32_t rule_resync_interval = DEFAULT_RULE_RESYNC_INTERVAL_SEC;
+  if (config["rule_resync_interval_sec"].IsDefined()) {
+    rule_resync_interval = config["rule_resync_interval_sec"].as<uint32_t>();
+  }
+  magma::PolicyLoader policy_loader;
+  std::thread policy_loader_thread([&]() {
+    policy_loader.start_loop(
+        [&](const magma::PolicyRuleChanges& changes) {
+          rule_store->update_rules(
+              changes.updated_rules, changes.removed_rule_ids);
+          // Sessions enforce the rules they were installed with until then
+          if (!changes.modified_rule_ids.empty()) {
+            local_enforcer->handle_static_rule_updates(
+                changes.modified_rule_ids);
+          }
+        },
+        config["rule_update_inteval_sec"].as<uint32_t>(),
+        rule_resync_interval);
+  });
 
   // RestartHandler will cleanup sessions from previous SessionD run. We do not
   // care about the return value of this thread.
@@ -341,10 +377,10 @@ int main(int argc, char* argv[]) {
   // Start off a thread to periodically poll stats from Pipelined
   // every fixed interval of time
   std::thread periodic_stats_requester_thread;
+  auto periodic_stats_requester = std::make_shared<magma::StatsPoller>();
   uint32_t interval;
   if (config["enable_pull_stats"].IsDefined() &&
       config["enable_pull_stats"].as<bool>()) {
-    auto periodic_stats_requester   = std::make_shared<magma::StatsPoller>();
     periodic_stats_requester_thread = std::thread([&]() {
       // random value assigned for interval period, the value will be loaded
       // from a config field later
@@ -478,8 +514,6 @@ int main(int argc, char* argv[]) {
   }
 
   // Block on main local_enforcer (to keep evb in this thread)
-  local_enforcer->attachEventBase(evb);
-  MLOG(MDEBUG) << "local enforcer Attached EventBase to evb";
   local_enforcer->sync_sessions_on_restart(time(NULL));
   MLOG(MDEBUG) << "Synced session on restart";
   evb->loopForever();
@@ -487,30 +521,35 @@ int main(int argc, char* argv[]) {
 
   server.Stop();
 
-  // Clean up threads & resources
-  policy_response_handler.join();
+  // Clean up threads & resources. The handlers and the stats poller start
+  // RPCs on the runtime's queues, so they are done before it is stopped.
+  periodic_stats_requester->stop();
   if (periodic_stats_requester_thread.joinable()) {
     periodic_stats_requester_thread.join();
   }
   local_thread.join();
   proxy_thread.join();
-  pipelined_response_handling_thread.join();
-  directoryd_response_handling_thread.join();
   restart_handler_thread.join();
+  policy_loader.stop();
   policy_loader_thread.join();
   if (abort_session_service != nullptr) {
     abort_session_thread.join();
-    free(abort_session_service);
   }
-  access_response_handling_thread.join();
   if (converged_access) {
     // 5G related thread join
     access_common_message_thread.join();
     conv_upf_message_thread.join();
+  }
+  // Client callbacks run on the runtime's threads and may still reach the
+  // handlers, which are freed below
+  grpc_runtime.stop();
+  if (abort_session_service != nullptr) {
+    free(abort_session_service);
+  }
+  if (converged_access) {
     free(conv_set_message_service);
     free(conv_upf_message_service);
   }
-  mobilityd_response_handling_thread.join();
   delete session_store;
 
   shutdown_sentry();
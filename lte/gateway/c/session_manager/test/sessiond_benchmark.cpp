@@ -0,0 +1,639 @@
+/**
+ * Copyright 2020 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Throughput benchmark of the sessiond handlers, with the PCRF/OCS and
+ * pipelined answered in process.
+ *
+ *   sessiond_benchmark [--subscribers N] [--rules N] [--rounds N]
+ *                      [--grant-bytes N] [--bytes-per-round N] [--redis]
+ *                      [--output FILE] [--baseline FILE] [--tolerance R]
+ *
+ * Sessions are created one at a time, then pipelined reports usage for every
+ * rule of every subscriber each round, which triggers credit updates as the
+ * grants run out. Per operation latency, allocations and Redis bytes written
+ * are printed. --output appends the results as a JSON line so runs can be
+ * tracked over time, --baseline fails the run if an operation got slower or
+ * allocates more than the last line of FILE by more than the tolerance.
+ */
+
+#include <cpp_redis/core/client.hpp>
+#include <folly/dynamic.h>
+#include <folly/io/async/EventBase.h>
+#include <folly/io/async/EventBaseManager.h>
+#include <folly/json.h>
+#include <getopt.h>
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <future>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "includes/ServiceConfigLoader.h"
+#include "LocalEnforcer.h"
+#include "LocalSessionManagerHandler.h"
+#include "ProtobufCreators.h"
+#include "RedisStoreClient.h"
+#include "SessiondMocks.h"
+#include "SessionReporter.h"
+#include "SessionStore.h"
+
+namespace {
+
+std::atomic<uint64_t> allocations{0};
+
+}  // namespace
+
+void* operator new(std::size_t size) {
+  allocations.fetch_add(1, std::memory_order_relaxed);
+  void* ptr = std::malloc(size == 0 ? 1 : size);
+  if (ptr == nullptr) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+void operator delete(void* ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t size) noexcept {
+  std::free(ptr);
+}
+
+namespace magma {
+
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+
+namespace {
+
+const char* APN             = "internet";
+const char* MONITORING_KEY  = "session_mkey";
+const char* BENCHMARK_TABLE = "sessiond_benchmark";
+
+struct BenchmarkConfig {
+  uint32_t subscribers     = 1000;
+  uint32_t rules           = 4;
+  uint32_t rounds          = 20;
+  uint64_t grant_bytes     = 8 * 1024 * 1024;
+  uint64_t bytes_per_round = 1024 * 1024;
+  bool redis               = false;
+  std::string output;
+  std::string baseline;
+  double tolerance = 0.2;
+};
+
+std::string imsi_of(uint32_t subscriber) {
+  char imsi[32];
+  std::snprintf(imsi, sizeof(imsi), "IMSI%015u", subscriber + 1);
+  return imsi;
+}
+
+std::string ue_ipv4_of(uint32_t subscriber) {
+  char ue_ipv4[16];
+  std::snprintf(
+      ue_ipv4, sizeof(ue_ipv4), "10.%u.%u.%u", (subscriber >> 16) & 0xff,
+      (subscriber >> 8) & 0xff, subscriber & 0xff);
+  return ue_ipv4;
+}
+
+std::string rule_id_of(uint32_t rule) {
+  return "benchmark_rule_" + std::to_string(rule);
+}
+
+uint32_t rating_group_of(uint32_t rule) {
+  return rule + 1;
+}
+
+/**
+ * Latency, allocations and Redis bytes written of one kind of operation
+ */
+class OperationStats {
+ public:
+  explicit OperationStats(const std::string& name) : name_(name) {}
+
+  struct Sample {
+    std::chrono::steady_clock::time_point start;
+    uint64_t allocations;
+  };
+
+  Sample start() const {
+    return Sample{std::chrono::steady_clock::now(), allocations.load()};
+  }
+
+  void stop(const Sample& sample) {
+    auto elapsed = std::chrono::steady_clock::now() - sample.start;
+    latencies_ns_.push_back(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    allocations_ += allocations.load() - sample.allocations;
+  }
+
+  void add_redis_bytes(uint64_t bytes) { redis_bytes_ += bytes; }
+
+  const std::string& name() const { return name_; }
+
+  folly::dynamic to_dynamic() {
+    const size_t count = latencies_ns_.size();
+    std::sort(latencies_ns_.begin(), latencies_ns_.end());
+    return folly::dynamic::object("count", static_cast<int64_t>(count))(
+        "p50_us", percentile_us(50))("p99_us", percentile_us(99))(
+        "allocs_per_op", count > 0 ? double(allocations_) / count : 0.0)(
+        "redis_bytes_per_op", count > 0 ? double(redis_bytes_) / count : 0.0);
+  }
+
+ private:
+  double percentile_us(uint32_t percentile) const {
+    if (latencies_ns_.empty()) {
+      return 0;
+    }
+    size_t index = (latencies_ns_.size() - 1) * percentile / 100;
+    return latencies_ns_[index] / 1000.0;
+  }
+
+  std::string name_;
+  std::vector<uint64_t> latencies_ns_;
+  uint64_t allocations_ = 0;
+  uint64_t redis_bytes_ = 0;
+};
+
+/**
+ * PCRF/OCS stand-in granting every rating group and monitor it is asked for.
+ * Answers are delivered on the event base as SessionReporterImpl does.
+ */
+class CoreStandIn final : public SessionReporter {
+ public:
+  CoreStandIn(
+      folly::EventBase* evb, const BenchmarkConfig& config,
+      OperationStats& credit_updates)
+      : evb_(evb),
+        config_(config),
+        credit_updates_(credit_updates),
+        in_flight_(0) {}
+
+  void report_updates(
+      const UpdateSessionRequest& request,
+      ReporterCallbackFn<UpdateSessionResponse> callback) override {
+    UpdateSessionResponse response;
+    for (const auto& update : request.updates()) {
+      create_credit_update_response(
+          update.common_context().sid().id(), update.session_id(),
+          update.usage().charging_key(), config_.grant_bytes,
+          response.add_responses());
+    }
+    for (const auto& monitor : request.usage_monitors()) {
+      create_monitor_update_response(
+          monitor.sid(), monitor.session_id(),
+          monitor.update().monitoring_key(), monitor.update().level(),
+          config_.grant_bytes, response.add_usage_monitor_responses());
+    }
+    in_flight_++;
+    evb_->runInEventBaseThread([this, callback, response]() {
+      auto sample = credit_updates_.start();
+      callback(grpc::Status::OK, response);
+      credit_updates_.stop(sample);
+      in_flight_--;
+    });
+  }
+
+  void report_create_session(
+      const CreateSessionRequest& request,
+      ReporterCallbackFn<CreateSessionResponse> callback) override {
+    const std::string& imsi = request.common_context().sid().id();
+    CreateSessionResponse response;
+
+    for (uint32_t rule = 0; rule < config_.rules; rule++) {
+      response.add_static_rules()->set_rule_id(rule_id_of(rule));
+      create_credit_update_response(
+          imsi, request.session_id(), rating_group_of(rule),
+          config_.grant_bytes, response.add_credits());
+    }
+    create_monitor_update_response(
+        imsi, request.session_id(), MONITORING_KEY, SESSION_LEVEL,
+        config_.grant_bytes, response.add_usage_monitors());
+    evb_->runInEventBaseThread([callback, response]() {
+      callback(grpc::Status::OK, response);
+    });
+  }
+
+  void report_terminate_session(
+      const SessionTerminateRequest& request,
+      ReporterCallbackFn<SessionTerminateResponse> callback) override {
+    SessionTerminateResponse response;
+    response.set_sid(request.common_context().sid().id());
+    response.set_session_id(request.session_id());
+    evb_->runInEventBaseThread([callback, response]() {
+      callback(grpc::Status::OK, response);
+    });
+  }
+
+  uint32_t in_flight() const { return in_flight_; }
+
+ private:
+  folly::EventBase* evb_;
+  const BenchmarkConfig& config_;
+  OperationStats& credit_updates_;
+  std::atomic<uint32_t> in_flight_;
+};
+
+/**
+ * Reads the bytes Redis received so far, for the writes of each operation
+ */
+class RedisMeter {
+ public:
+  bool connect() {
+    ServiceConfigLoader loader;
+    auto config = loader.load_service_config("redis");
+    try {
+      client_.connect(
+          config["bind"].as<std::string>(), config["port"].as<uint32_t>());
+    } catch (const cpp_redis::redis_error& e) {
+      std::fprintf(stderr, "Could not connect to redis: %s\n", e.what());
+      return false;
+    }
+    client_.del({BENCHMARK_TABLE});
+    client_.sync_commit();
+    return true;
+  }
+
+  uint64_t bytes_received() {
+    if (!client_.is_connected()) {
+      return 0;
+    }
+    auto future = client_.info("stats");
+    client_.sync_commit();
+    const std::string stats          = future.get().as_string();
+    const std::string field          = "total_net_input_bytes:";
+    const std::string::size_type pos = stats.find(field);
+    if (pos == std::string::npos) {
+      return 0;
+    }
+    return std::strtoull(stats.c_str() + pos + field.size(), nullptr, 10);
+  }
+
+ private:
+  cpp_redis::client client_;
+};
+
+class SessiondBenchmark {
+ public:
+  explicit SessiondBenchmark(const BenchmarkConfig& config)
+      : config_(config),
+        create_session_("create_session"),
+        report_rule_stats_("report_rule_stats"),
+        credit_update_("credit_update") {}
+
+  bool setup() {
+    evb_        = new folly::EventBase();
+    rule_store_ = std::make_shared<StaticRuleStore>();
+    for (uint32_t rule = 0; rule < config_.rules; rule++) {
+      rule_store_->insert_rule(
+          create_policy_rule(rule_id_of(rule), "", rating_group_of(rule)));
+    }
+
+    if (config_.redis) {
+      if (!redis_meter_.connect()) {
+        return false;
+      }
+      auto store_client = std::make_shared<lte::RedisStoreClient>(
+          std::make_shared<cpp_redis::client>(), BENCHMARK_TABLE, rule_store_);
+      if (!store_client->try_redis_connect()) {
+        return false;
+      }
+      session_store_ = std::make_unique<SessionStore>(
+          rule_store_, std::make_shared<MeteringReporter>(), store_client);
+    } else {
+      session_store_ = std::make_unique<SessionStore>(
+          rule_store_, std::make_shared<MeteringReporter>());
+    }
+
+    core_ = std::make_shared<CoreStandIn>(evb_, config_, credit_update_);
+    pipelined_client_ = std::make_shared<NiceMock<MockPipelinedClient>>();
+    ON_CALL(*pipelined_client_, setup_lte(_, _, _))
+        .WillByDefault(Invoke(
+            [](const std::vector<SessionState::SessionInfo>& infos,
+               const std::uint64_t& epoch,
+               std::function<void(Status, SetupFlowsResult)> callback) {
+              SetupFlowsResult result;
+              result.set_result(SetupFlowsResult::SUCCESS);
+              callback(Status::OK, result);
+            }));
+    auto events_reporter = std::make_shared<NiceMock<MockEventsReporter>>();
+
+    enforcer_ = std::make_shared<LocalEnforcer>(
+        core_, rule_store_, *session_store_, pipelined_client_,
+        events_reporter, std::make_shared<NiceMock<MockSpgwServiceClient>>(),
+        nullptr, 0, 0, get_default_mconfig());
+    handler_ = std::make_unique<LocalSessionManagerHandlerImpl>(
+        enforcer_, core_.get(),
+        std::make_shared<NiceMock<MockDirectorydClient>>(), events_reporter,
+        *session_store_);
+
+    evb_thread_ = std::thread([this]() {
+      folly::EventBaseManager::get()->setEventBase(evb_, 0);
+      enforcer_->attachEventBase(evb_);
+      enforcer_->start();
+    });
+    evb_->waitUntilRunning();
+
+    // The first report sets up pipelined, which lets sessions be created
+    RuleRecordTable empty;
+    empty.set_epoch(1);
+    handler_->ReportRuleStats(nullptr, &empty, [](Status, Void) {});
+    drain();
+    return true;
+  }
+
+  void teardown() {
+    enforcer_->stop();
+    evb_thread_.join();
+    handler_.reset();
+    enforcer_.reset();
+    delete evb_;
+  }
+
+  void run() {
+    uint64_t redis_bytes = redis_meter_.bytes_received();
+
+    for (uint32_t subscriber = 0; subscriber < config_.subscribers;
+         subscriber++) {
+      create_session(subscriber);
+    }
+    create_session_.add_redis_bytes(
+        redis_meter_.bytes_received() - redis_bytes);
+
+    for (uint32_t round = 1; round <= config_.rounds; round++) {
+      RuleRecordTable table = make_rule_record_table(round);
+
+      redis_bytes = redis_meter_.bytes_received();
+      auto sample = report_rule_stats_.start();
+      handler_->ReportRuleStats(nullptr, &table, [](Status, Void) {});
+      // The report is processed once the event base got past it
+      evb_->runInEventBaseThreadAndWait([]() {});
+      report_rule_stats_.stop(sample);
+      report_rule_stats_.add_redis_bytes(
+          redis_meter_.bytes_received() - redis_bytes);
+
+      redis_bytes = redis_meter_.bytes_received();
+      drain();
+      credit_update_.add_redis_bytes(
+          redis_meter_.bytes_received() - redis_bytes);
+    }
+  }
+
+  folly::dynamic results() {
+    folly::dynamic operations = folly::dynamic::object;
+    for (auto* stats :
+         {&create_session_, &report_rule_stats_, &credit_update_}) {
+      operations[stats->name()] = stats->to_dynamic();
+    }
+    return folly::dynamic::object(
+        "timestamp", static_cast<int64_t>(std::time(nullptr)))(
+        "store", config_.redis ? "redis" : "memory")(
+        "subscribers", config_.subscribers)("rules", config_.rules)(
+        "rounds", config_.rounds)("operations", operations);
+  }
+
+ private:
+  void create_session(uint32_t subscriber) {
+    LocalCreateSessionRequest request;
+    Teids teids;
+    teids.set_agw_teid(2 * subscriber + 1);
+    teids.set_enb_teid(2 * subscriber + 2);
+
+    request.mutable_common_context()->CopyFrom(
+        build_common_context(
+            imsi_of(subscriber), ue_ipv4_of(subscriber), "", teids, APN, "",
+            TGPP_LTE));
+    request.mutable_rat_specific_context()->mutable_lte_context()->CopyFrom(
+        build_lte_context("127.0.0.1", "", "", "", "", 5, nullptr));
+
+    std::promise<void> done;
+    auto sample = create_session_.start();
+    handler_->CreateSession(
+        nullptr, &request,
+        [&done](Status status, LocalCreateSessionResponse response) {
+          if (!status.ok()) {
+            std::fprintf(
+                stderr, "CreateSession failed: %s\n",
+                status.error_message().c_str());
+          }
+          done.set_value();
+        });
+    done.get_future().wait();
+    create_session_.stop(sample);
+  }
+
+  // Usage is cumulative, every rule grows by the same amount each round
+  RuleRecordTable make_rule_record_table(uint32_t round) {
+    RuleRecordTable table;
+    const uint64_t bytes = round * config_.bytes_per_round / 2;
+
+    table.set_epoch(1);
+    for (uint32_t subscriber = 0; subscriber < config_.subscribers;
+         subscriber++) {
+      const std::string imsi    = imsi_of(subscriber);
+      const std::string ue_ipv4 = ue_ipv4_of(subscriber);
+      for (uint32_t rule = 0; rule < config_.rules; rule++) {
+        create_rule_record(
+            imsi, ue_ipv4, rule_id_of(rule), bytes, bytes,
+            table.add_records());
+      }
+    }
+    return table;
+  }
+
+  // Wait for the event base to handle the answers of the PCRF/OCS stand-in
+  void drain() {
+    do {
+      evb_->runInEventBaseThreadAndWait([]() {});
+    } while (core_->in_flight() > 0);
+  }
+
+  const BenchmarkConfig& config_;
+  OperationStats create_session_;
+  OperationStats report_rule_stats_;
+  OperationStats credit_update_;
+  RedisMeter redis_meter_;
+  folly::EventBase* evb_;
+  std::thread evb_thread_;
+  std::shared_ptr<StaticRuleStore> rule_store_;
+  std::unique_ptr<SessionStore> session_store_;
+  std::shared_ptr<CoreStandIn> core_;
+  std::shared_ptr<NiceMock<MockPipelinedClient>> pipelined_client_;
+  std::shared_ptr<LocalEnforcer> enforcer_;
+  std::unique_ptr<LocalSessionManagerHandlerImpl> handler_;
+};
+
+void print_results(const folly::dynamic& results) {
+  std::printf(
+      "%-20s %10s %12s %12s %14s %18s\n", "operation", "count", "p50 (us)",
+      "p99 (us)", "allocs/op", "redis bytes/op");
+  for (const auto& operation : results["operations"].items()) {
+    const auto& stats = operation.second;
+    std::printf(
+        "%-20s %10lld %12.1f %12.1f %14.1f %18.1f\n",
+        operation.first.asString().c_str(),
+        static_cast<long long>(stats["count"].asInt()),
+        stats["p50_us"].asDouble(), stats["p99_us"].asDouble(),
+        stats["allocs_per_op"].asDouble(),
+        stats["redis_bytes_per_op"].asDouble());
+  }
+}
+
+/**
+ * Compare with the last run recorded in the baseline file
+ * @return false if any operation regressed by more than the tolerance
+ */
+bool check_baseline(
+    const folly::dynamic& results, const std::string& path, double tolerance) {
+  std::ifstream file(path);
+  std::string line, last;
+  while (std::getline(file, line)) {
+    if (!line.empty()) {
+      last = line;
+    }
+  }
+  if (last.empty()) {
+    std::fprintf(stderr, "No baseline in %s\n", path.c_str());
+    return true;
+  }
+
+  const folly::dynamic baseline = folly::parseJson(last);
+  bool ok                       = true;
+  for (const auto& operation : results["operations"].items()) {
+    const auto* previous = baseline["operations"].get_ptr(operation.first);
+    if (previous == nullptr) {
+      continue;
+    }
+    for (const char* metric : {"p50_us", "allocs_per_op"}) {
+      const double before = (*previous)[metric].asDouble();
+      const double now    = operation.second[metric].asDouble();
+      if (before > 0 && now > before * (1 + tolerance)) {
+        std::printf(
+            "REGRESSION %s %s: %.1f -> %.1f\n",
+            operation.first.asString().c_str(), metric, before, now);
+        ok = false;
+      }
+    }
+  }
+  return ok;
+}
+
+bool parse_opt_line(int argc, char* argv[], BenchmarkConfig& config) {
+  enum {
+    OPT_SUBSCRIBERS = 256,
+    OPT_RULES,
+    OPT_ROUNDS,
+    OPT_GRANT_BYTES,
+    OPT_BYTES_PER_ROUND,
+    OPT_REDIS,
+    OPT_OUTPUT,
+    OPT_BASELINE,
+    OPT_TOLERANCE,
+  };
+  const struct option long_options[] = {
+      {"subscribers", required_argument, nullptr, OPT_SUBSCRIBERS},
+      {"rules", required_argument, nullptr, OPT_RULES},
+      {"rounds", required_argument, nullptr, OPT_ROUNDS},
+      {"grant-bytes", required_argument, nullptr, OPT_GRANT_BYTES},
+      {"bytes-per-round", required_argument, nullptr, OPT_BYTES_PER_ROUND},
+      {"redis", no_argument, nullptr, OPT_REDIS},
+      {"output", required_argument, nullptr, OPT_OUTPUT},
+      {"baseline", required_argument, nullptr, OPT_BASELINE},
+      {"tolerance", required_argument, nullptr, OPT_TOLERANCE},
+      {nullptr, 0, nullptr, 0},
+  };
+  int c;
+
+  while ((c = getopt_long(argc, argv, "", long_options, nullptr)) != -1) {
+    switch (c) {
+      case OPT_SUBSCRIBERS:
+        config.subscribers = std::strtoul(optarg, nullptr, 10);
+        break;
+      case OPT_RULES:
+        config.rules = std::strtoul(optarg, nullptr, 10);
+        break;
+      case OPT_ROUNDS:
+        config.rounds = std::strtoul(optarg, nullptr, 10);
+        break;
+      case OPT_GRANT_BYTES:
+        config.grant_bytes = std::strtoull(optarg, nullptr, 10);
+        break;
+      case OPT_BYTES_PER_ROUND:
+        config.bytes_per_round = std::strtoull(optarg, nullptr, 10);
+        break;
+      case OPT_REDIS:
+        config.redis = true;
+        break;
+      case OPT_OUTPUT:
+        config.output = optarg;
+        break;
+      case OPT_BASELINE:
+        config.baseline = optarg;
+        break;
+      case OPT_TOLERANCE:
+        config.tolerance = std::strtod(optarg, nullptr);
+        break;
+      default:
+        return false;
+    }
+  }
+  return config.subscribers > 0 && config.rules > 0;
+}
+
+}  // namespace
+}  // namespace magma
+
+int main(int argc, char* argv[]) {
+  magma::BenchmarkConfig config;
+
+  if (!magma::parse_opt_line(argc, argv, config)) {
+    std::fprintf(
+        stderr,
+        "Usage: %s [--subscribers N] [--rules N] [--rounds N]\n"
+        "          [--grant-bytes N] [--bytes-per-round N] [--redis]\n"
+        "          [--output FILE] [--baseline FILE] [--tolerance R]\n",
+        argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  magma::SessiondBenchmark benchmark(config);
+  if (!benchmark.setup()) {
+    return EXIT_FAILURE;
+  }
+  benchmark.run();
+  benchmark.teardown();
+
+  const folly::dynamic results = benchmark.results();
+  magma::print_results(results);
+  // Compared before appending, the output may well be the baseline
+  const bool ok =
+      config.baseline.empty() ||
+      magma::check_baseline(results, config.baseline, config.tolerance);
+  if (!config.output.empty()) {
+    std::ofstream output(config.output, std::ios::app);
+    output << folly::toJson(results) << std::endl;
+  }
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -3561,6 +3561,64 @@ TEST_F(LocalEnforcerTest, test_receiving_stats_for_subset_of_rules) {
   EXPECT_EQ(1, session_map[IMSI1][0]->get_current_rule_version("rule2"));
 }
 
+// Only the installed static rules among the modified ones are installed
+// again, with a new version
+TEST_F(LocalEnforcerTest, test_handle_static_rule_updates) {
+  insert_static_rule(1, "", "rule1");
+  insert_static_rule(1, "", "rule2");
+  insert_static_rule(1, "", "rule3");
+
+  CreateSessionResponse response;
+  response.mutable_static_rules()->Add()->set_rule_id("rule1");
+  response.mutable_static_rules()->Add()->set_rule_id("rule2");
+  local_enforcer->init_session(
+      session_map, IMSI1, SESSION_ID_1, test_cfg_, response);
+  local_enforcer->update_tunnel_ids(
+      session_map,
+      create_update_tunnel_ids_request(IMSI1, BEARER_ID_1, teids1));
+  session_store->create_sessions(IMSI1, std::move(session_map[IMSI1]));
+
+  RulesToProcess to_process;
+  to_process.push_back(make_rule_to_process("rule1", TEID_1_UL, TEID_1_DL));
+  EXPECT_CALL(
+      *pipelined_client,
+      activate_flows_for_rules(
+          IMSI1, testing::_, testing::_, testing::_, testing::_, testing::_,
+          CheckRulesToProcess(to_process), testing::_))
+      .Times(1);
+  local_enforcer->handle_static_rule_updates({"rule1", "rule3"});
+  run_evb();
+
+  session_map = session_store->read_sessions(SessionRead{IMSI1});
+  EXPECT_EQ(2, session_map[IMSI1][0]->get_current_rule_version("rule1"));
+  EXPECT_EQ(1, session_map[IMSI1][0]->get_current_rule_version("rule2"));
+  EXPECT_FALSE(session_map[IMSI1][0]->is_static_rule_installed("rule3"));
+}
+
+TEST_F(LocalEnforcerTest, test_split_records_by_shard) {
+  local_enforcer->attachEventBase(evb, 4);
+  EXPECT_EQ(local_enforcer->get_num_shards(), 4);
+
+  RuleRecordTable table;
+  table.set_epoch(42);
+  for (const auto& imsi : {IMSI1, IMSI2, IMSI3}) {
+    create_rule_record(imsi, "rule1", 16, 32, table.mutable_records()->Add());
+  }
+  auto shard_records = local_enforcer->split_records_by_shard(table);
+  EXPECT_EQ(shard_records.size(), 4);
+
+  // Every shard gets a table, with the records of its subscribers only
+  int num_records = 0;
+  for (uint32_t shard = 0; shard < shard_records.size(); shard++) {
+    EXPECT_EQ(shard_records[shard].epoch(), 42);
+    for (const auto& record : shard_records[shard].records()) {
+      EXPECT_EQ(local_enforcer->get_shard(record.sid()), shard);
+      num_records++;
+    }
+  }
+  EXPECT_EQ(num_records, 3);
+}
+
 int main(int argc, char** argv) {
   ::testing::InitGoogleTest(&argc, argv);
   FLAGS_logtostderr = 1;
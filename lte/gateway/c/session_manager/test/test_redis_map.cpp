@@ -0,0 +1,157 @@
+/**
+ * Copyright 2020 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "includes/RedisMap.hpp"
+#include "includes/Serializers.h"
+#include "lte/protos/policydb.pb.h"
+#include "ProtobufCreators.h"
+
+using ::testing::Test;
+
+namespace magma {
+
+using Entries = std::vector<std::pair<std::string, cpp_redis::reply>>;
+
+// The replies of the hash are given to collect_changed, as read by
+// getall_changed and get_changed, so that no redis server is needed
+class RedisMapTest : public ::testing::Test {
+ protected:
+  RedisMapTest()
+      : policy_map_(
+            std::make_shared<cpp_redis::client>(), "policydb:rules",
+            get_proto_serializer(), get_proto_deserializer()) {}
+
+  // The value policydb writes for rule, at version
+  static cpp_redis::reply value(const PolicyRule& rule, uint64_t version) {
+    std::string serialized;
+    EXPECT_TRUE(get_proto_serializer()(rule, serialized, version));
+    return cpp_redis::reply(
+        serialized, cpp_redis::reply::string_type::bulk_string);
+  }
+
+  void collect_changed(const Entries& entries, bool is_whole_hash) {
+    values_.clear();
+    modified_.clear();
+    removed_.clear();
+    policy_map_.collect_changed(
+        entries, is_whole_hash, versions_, values_, modified_, removed_);
+  }
+
+  RedisMap<PolicyRule> policy_map_;
+  std::unordered_map<std::string, uint64_t> versions_;
+  std::vector<PolicyRule> values_;
+  std::vector<std::string> modified_;
+  std::vector<std::string> removed_;
+};
+
+TEST_F(RedisMapTest, test_first_sync) {
+  collect_changed(
+      {{"rule1", value(create_policy_rule("rule1", "m1", 1), 1)},
+       {"rule2", value(create_policy_rule("rule2", "m2", 2), 3)}},
+      true);
+
+  // Every rule is added
+  ASSERT_EQ(values_.size(), 2);
+  EXPECT_EQ(values_[0].id(), "rule1");
+  EXPECT_EQ(values_[0].rating_group(), 1);
+  EXPECT_EQ(values_[1].id(), "rule2");
+  EXPECT_TRUE(modified_.empty());
+  EXPECT_TRUE(removed_.empty());
+  EXPECT_EQ(versions_["rule1"], 1);
+  EXPECT_EQ(versions_["rule2"], 3);
+}
+
+TEST_F(RedisMapTest, test_whole_hash_changes) {
+  collect_changed(
+      {{"rule1", value(create_policy_rule("rule1", "m1", 1), 1)},
+       {"rule2", value(create_policy_rule("rule2", "m2", 2), 1)},
+       {"rule3", value(create_policy_rule("rule3", "m3", 3), 1)}},
+      true);
+
+  // Nothing changed
+  collect_changed(
+      {{"rule1", value(create_policy_rule("rule1", "m1", 1), 1)},
+       {"rule2", value(create_policy_rule("rule2", "m2", 2), 1)},
+       {"rule3", value(create_policy_rule("rule3", "m3", 3), 1)}},
+      true);
+  EXPECT_TRUE(values_.empty());
+  EXPECT_TRUE(modified_.empty());
+  EXPECT_TRUE(removed_.empty());
+
+  // rule2 is modified, rule3 removed and rule4 added
+  collect_changed(
+      {{"rule1", value(create_policy_rule("rule1", "m1", 1), 1)},
+       {"rule2", value(create_policy_rule("rule2", "m2", 20), 2)},
+       {"rule4", value(create_policy_rule("rule4", "m4", 4), 1)}},
+      true);
+  ASSERT_EQ(values_.size(), 2);
+  EXPECT_EQ(values_[0].id(), "rule2");
+  EXPECT_EQ(values_[0].rating_group(), 20);
+  EXPECT_EQ(values_[1].id(), "rule4");
+  EXPECT_EQ(modified_, std::vector<std::string>{"rule2"});
+  EXPECT_EQ(removed_, std::vector<std::string>{"rule3"});
+  EXPECT_EQ(versions_.size(), 3);
+  EXPECT_EQ(versions_["rule2"], 2);
+}
+
+TEST_F(RedisMapTest, test_changed_keys_only) {
+  collect_changed(
+      {{"rule1", value(create_policy_rule("rule1", "m1", 1), 1)},
+       {"rule2", value(create_policy_rule("rule2", "m2", 2), 1)},
+       {"rule3", value(create_policy_rule("rule3", "m3", 3), 1)}},
+      true);
+
+  // Only the keys read are compared, rule3 is not removed for being absent.
+  // A null value is a removed key.
+  collect_changed(
+      {{"rule1", value(create_policy_rule("rule1", "m1", 10), 2)},
+       {"rule2", cpp_redis::reply()}},
+      false);
+  ASSERT_EQ(values_.size(), 1);
+  EXPECT_EQ(values_[0].rating_group(), 10);
+  EXPECT_EQ(modified_, std::vector<std::string>{"rule1"});
+  EXPECT_EQ(removed_, std::vector<std::string>{"rule2"});
+  EXPECT_EQ(versions_.size(), 2);
+  EXPECT_EQ(versions_.count("rule3"), 1);
+
+  // Removing a key never synced is not reported
+  collect_changed({{"rule5", cpp_redis::reply()}}, false);
+  EXPECT_TRUE(removed_.empty());
+}
+
+TEST_F(RedisMapTest, test_invalid_value) {
+  collect_changed(
+      {{"rule1", cpp_redis::reply(
+                     "garbage", cpp_redis::reply::string_type::bulk_string)},
+       {"rule2", value(create_policy_rule("rule2", "m2", 2), 1)}},
+      true);
+
+  // The invalid value is skipped, and read again on the next sync
+  ASSERT_EQ(values_.size(), 1);
+  EXPECT_EQ(values_[0].id(), "rule2");
+  EXPECT_EQ(versions_.count("rule1"), 0);
+}
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
+
+}  // namespace magma
@@ -0,0 +1,67 @@
+/**
+ * Copyright 2020 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "ProtobufCreators.h"
+#include "RuleStore.h"
+
+using ::testing::Test;
+
+namespace magma {
+
+TEST(PolicyRuleBiMapTest, test_update_rules) {
+  PolicyRuleBiMap rule_map;
+  rule_map.sync_rules(
+      {create_policy_rule("rule1", "m1", 1),
+       create_policy_rule("rule2", "m2", 2),
+       create_policy_rule("rule3", "m3", 3)});
+
+  // rule1 moves to another rating group, rule2 is removed and rule4 added
+  rule_map.update_rules(
+      {create_policy_rule("rule1", "m1", 10),
+       create_policy_rule("rule4", "m4", 4)},
+      {"rule2"});
+
+  PolicyRule rule;
+  EXPECT_TRUE(rule_map.get_rule("rule1", &rule));
+  EXPECT_EQ(rule.rating_group(), 10);
+  EXPECT_FALSE(rule_map.get_rule("rule2", nullptr));
+  EXPECT_TRUE(rule_map.get_rule("rule3", nullptr));
+  EXPECT_TRUE(rule_map.get_rule("rule4", nullptr));
+
+  // The key maps follow the new definition of rule1
+  CreditKey charging_key;
+  EXPECT_TRUE(rule_map.get_charging_key_for_rule_id("rule1", &charging_key));
+  EXPECT_EQ(charging_key.rating_group, 10);
+  std::vector<std::string> rule_ids;
+  rule_map.get_rule_ids_for_charging_key(CreditKey(10), rule_ids);
+  EXPECT_EQ(rule_ids, std::vector<std::string>{"rule1"});
+  // Nor are the previous definition and the removed rule left in them
+  rule_ids.clear();
+  rule_map.get_rule_ids_for_charging_key(CreditKey(1), rule_ids);
+  rule_map.get_rule_ids_for_charging_key(CreditKey(2), rule_ids);
+  EXPECT_TRUE(rule_ids.empty());
+  std::string m_key;
+  EXPECT_FALSE(rule_map.get_monitoring_key_for_rule_id("rule2", &m_key));
+  EXPECT_EQ(rule_map.monitored_rules_count(), 3);
+}
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
+
+}  // namespace magma
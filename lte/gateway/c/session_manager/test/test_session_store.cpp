@@ -15,6 +15,10 @@
 #include <gtest/gtest.h>
 
 #include <memory>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
 
 #include "Consts.h"
 #include "magma_logging.h"
@@ -628,6 +632,94 @@ TEST_F(SessionStoreTest, test_get_session) {
   EXPECT_FALSE(optional_it7);
 }
 
+// Subscribers spread over the shards, with one session each
+static std::vector<std::string> get_sharded_imsis() {
+  std::vector<std::string> imsis;
+  for (int i = 0; i < 32; i++) {
+    imsis.push_back("IMSI0010100000000" + std::to_string(10 + i));
+  }
+  return imsis;
+}
+
+TEST_F(SessionStoreTest, test_read_shard_sessions) {
+  const uint32_t num_shards = 4;
+  session_store->set_num_shards(num_shards);
+  auto imsis = get_sharded_imsis();
+  for (const auto& imsi : imsis) {
+    auto sessions = SessionVector{};
+    sessions.push_back(get_session(imsi, id_gen_.gen_session_id(imsi)));
+    session_store->create_sessions(imsi, std::move(sessions));
+  }
+
+  // Every subscriber is read by its shard, and by its shard only
+  std::set<std::string> read_imsis;
+  for (uint32_t shard = 0; shard < num_shards; shard++) {
+    auto session_map = session_store->read_shard_sessions(shard);
+    for (const auto& it : session_map) {
+      EXPECT_EQ(SessionShards::shard_of(it.first, num_shards), shard);
+      EXPECT_EQ(it.second.size(), 1);
+      EXPECT_TRUE(read_imsis.insert(it.first).second);
+    }
+  }
+  EXPECT_EQ(read_imsis, std::set<std::string>(imsis.begin(), imsis.end()));
+}
+
+TEST_F(SessionStoreTest, test_concurrent_shard_updates) {
+  const uint32_t num_shards = 4;
+  const int num_updates     = 50;
+  session_store->set_num_shards(num_shards);
+  auto imsis = get_sharded_imsis();
+  std::vector<std::set<std::string>> shard_imsis(num_shards);
+  for (const auto& imsi : imsis) {
+    auto sessions = SessionVector{};
+    sessions.push_back(get_session(imsi, id_gen_.gen_session_id(imsi)));
+    session_store->create_sessions(imsi, std::move(sessions));
+    shard_imsis[SessionShards::shard_of(imsi, num_shards)].insert(imsi);
+  }
+
+  // Each shard increments the request numbers of its sessions, by a
+  // read-modify-write of the store, while reads span every shard
+  std::vector<std::thread> threads;
+  for (uint32_t shard = 0; shard < num_shards; shard++) {
+    threads.emplace_back([this, shard, num_updates]() {
+      for (int i = 0; i < num_updates; i++) {
+        auto session_map = session_store->read_shard_sessions(shard);
+
+        auto update = SessionStore::get_default_session_update(session_map);
+        for (auto& it : update) {
+          for (auto& criteria : it.second) {
+            criteria.second.request_number_increment = 1;
+          }
+        }
+        session_store->sync_request_numbers(update);
+      }
+    });
+  }
+  threads.emplace_back([this, &imsis, num_updates]() {
+    for (int i = 0; i < num_updates; i++) {
+      auto session_map = session_store->read_sessions(
+          SessionRead(imsis.begin(), imsis.end()));
+      EXPECT_EQ(session_map.size(), imsis.size());
+    }
+  });
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  // No update was lost
+  auto session_map = session_store->read_all_sessions();
+  EXPECT_EQ(session_map.size(), imsis.size());
+  for (const auto& it : session_map) {
+    ASSERT_EQ(it.second.size(), 1);
+    EXPECT_EQ(it.second.front()->get_request_number(), 1 + num_updates);
+  }
+  for (uint32_t shard = 0; shard < num_shards; shard++) {
+    EXPECT_EQ(
+        session_store->read_shard_sessions(shard).size(),
+        shard_imsis[shard].size());
+  }
+}
+
 int main(int argc, char** argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -67,7 +67,7 @@ TEST_F(StoreClientTest, test_read_and_write) {
   auto tgpp_context   = TgppContext{};
   auto pdp_start_time = 12345;
 
-  auto store_client = MemoryStoreClient(rule_store);
+  MemoryStoreClient store_client(rule_store);
 
   // Emulate CreateSession, which needs to create a new session for a subscriber
   std::set<std::string> requested_ids{imsi, imsi2};
@@ -145,6 +145,10 @@ TEST_F(StoreClientTest, test_read_and_write) {
   EXPECT_EQ(
       all_sessions[imsi3].front()->get_create_session_response().DebugString(),
       response3.DebugString());
+
+  // Only the subscribers with sessions are listed
+  auto subscriber_ids = store_client.read_subscriber_ids();
+  EXPECT_EQ(subscriber_ids, std::set<std::string>({imsi, imsi2, imsi3}));
 }
 
 TEST_F(StoreClientTest, test_lambdas) {
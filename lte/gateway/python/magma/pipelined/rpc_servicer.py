@@ -40,7 +40,9 @@ from lte.protos.pipelined_pb2 import (
     SetupUEMacRequest,
     TableAssignment,
     UESessionContextResponse,
+    UESessionContextResponseBatch,
     UESessionSet,
+    UESessionSetBatch,
     UPFSessionContextState,
     VersionedPolicy,
     VersionedPolicyID,
@@ -560,6 +562,48 @@ class PipelinedRpcServicer(pipelined_pb2_grpc.PipelinedServicer):
         res = self._classifier_app.process_mme_tunnel_request(request)
         fut.set_result(res)
 
+    def UpdateUEStateBatch(self, request, context):
+        """
+        Apply the tunnel updates coalesced by the MME in a single loop
+        iteration, in order
+        """
+        self._log_grpc_payload(request)
+        if not self._service_manager.is_app_enabled(
+              Classifier.APP_NAME,
+        ):
+            context.set_code(grpc.StatusCode.UNAVAILABLE)
+            context.set_details('Service not enabled!')
+            return None
+
+        fut = Future()
+        self._loop.call_soon_threadsafe(
+            self._setup_pg_tunnel_updates, request, fut,
+        )
+        try:
+            return fut.result(timeout=self._call_timeout)
+        except concurrent.futures.TimeoutError:
+            logging.error("UpdateUEStateBatch processing timed out")
+            return UESessionContextResponseBatch(
+                responses=[
+                    UESessionContextResponse(
+                        operation_type=s.ue_session_state.ue_config_state,
+                        cause_info=CauseIE(
+                            cause_ie=CauseIE.REQUEST_REJECTED_NO_REASON,
+                        ),
+                    ) for s in request.sessions
+                ],
+            )
+
+    def _setup_pg_tunnel_updates(
+        self, request: UESessionSetBatch,
+        fut: 'Future(UESessionContextResponseBatch)',
+    ):
+        responses = [
+            self._classifier_app.process_mme_tunnel_request(session)
+            for session in request.sessions
+        ]
+        fut.set_result(UESessionContextResponseBatch(responses=responses))
+
     # --------------------------
     # IPFIX App
     # --------------------------
@@ -38,12 +38,15 @@ class PolicyRuleDict(RedisHashDict):
             get_proto_deserializer(PolicyRule),
         )
 
-    def send_update_notification(self):
+    def send_update_notification(self, rule_ids=None):
         """
         Use Redis pub/sub channels to send notifications. Subscribers can listen
-        to this channel to know when an update is done to the policy store
+        to this channel to know when an update is done to the policy store.
+        The ids of the rules added, modified or removed follow, one per line,
+        when known.
         """
-        self.redis.publish(self._NOTIFY_CHANNEL, "Stream Update")
+        message = "\n".join(["Stream Update"] + list(rule_ids or []))
+        self.redis.publish(self._NOTIFY_CHANNEL, message)
 
     def __missing__(self, key):
         """Instead of throwing a key error, return None when key not found"""
@@ -57,28 +57,40 @@ class PolicyDBStreamerCallback(StreamerClient.Callback):
         )
         if resync:
             policy_ids = set()
+            changed_ids = []
             for update in updates:
                 policy = PolicyRule()
                 policy.ParseFromString(update.value)
-                self._store_policy_rule(policy)
+                if self._store_policy_rule(policy):
+                    changed_ids.append(policy.id)
                 policy_ids.add(policy.id)
             logging.debug("Resync with policies: %s", ','.join(policy_ids))
-            self._remove_old_policies(policy_ids)
-            self._policy_dict.send_update_notification()
+            changed_ids += self._remove_old_policies(policy_ids)
+            if changed_ids:
+                self._policy_dict.send_update_notification(changed_ids)
         else:
             pass
 
     def _store_policy_rule(self, policy):
+        """
+        Store the rule unless it is unchanged, so that its version only
+        changes with it. Returns whether the rule was stored
+        """
+        if self._policy_dict[policy.id] == policy:
+            return False
         self._policy_dict[policy.id] = policy
+        return True
 
     def _remove_old_policies(self, id_set):
         """
         Scan the set of ids passes in the streaming update to see which have
-        been deleted and delete them in the policy dictionary
+        been deleted and delete them in the policy dictionary. Returns the ids
+        of the deleted rules
         """
         missing_rules = set(self._policy_dict.keys()) - id_set
         for rule in missing_rules:
             del self._policy_dict[rule]
+        return list(missing_rules)
 
 
 class BaseNamesStreamerCallback(StreamerClient.Callback):
@@ -17,7 +17,30 @@
 
 namespace magma {
 
+GRPCReceiver::GRPCReceiver()
+    : own_queue_(new grpc::CompletionQueue()),
+      queue_(*own_queue_),
+      running_(false) {}
+
+GRPCReceiver::GRPCReceiver(GRPCRuntime& runtime)
+    : queue_(runtime.assign_queue()), running_(false) {}
+
+void AsyncResponse::complete(void* tag, bool ok) {
+  auto response = static_cast<AsyncResponse*>(tag);
+  if (!ok) {
+    MLOG(MINFO) << "gRPC receiver encountered error while processing request";
+    response->handle_failure();
+    return;
+  }
+  response->record_latency();
+  response->handle_response();
+}
+
 void GRPCReceiver::rpc_response_loop() {
+  if (!own_queue_) {
+    MLOG(MDEBUG) << "gRPC receiver is served by the shared runtime";
+    return;
+  }
   running_ = true;
   void* tag;
   bool ok = false;
@@ -25,16 +48,16 @@ void GRPCReceiver::rpc_response_loop() {
     if (!queue_.Next(&tag, &ok)) {
       return;
     }
-    if (!ok) {
-      MLOG(MINFO) << "gRPC receiver encountered error while processing request";
-      continue;
-    }
-    static_cast<AsyncResponse*>(tag)->handle_response();
+    AsyncResponse::complete(tag, ok);
   }
 }
 
 void GRPCReceiver::stop() {
   running_ = false;
+  if (!own_queue_) {
+    // The shared queue belongs to the runtime
+    return;
+  }
   queue_.Shutdown();
   // Pop all items in the queue until it is empty
   // https://github.com/grpc/grpc/issues/8610
@@ -0,0 +1,232 @@
+/**
+ * Copyright 2020 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "includes/GRPCRuntime.h"
+#include <algorithm>                  // for min
+#include <new>                        // for operator new
+#include <ostream>                    // for operator<<, char_traits
+#include "includes/GRPCReceiver.h"    // for AsyncResponse
+#include "magma_logging.h"            // for MLOG
+
+namespace magma {
+
+namespace {
+
+// Tags are recycled by size class of TAG_POOL_GRANULARITY bytes, larger tags
+// go straight to the heap
+const size_t TAG_POOL_GRANULARITY = 64;
+const size_t TAG_POOL_NUM_CLASSES = 32;
+// Bounds the memory kept after a burst of outstanding calls
+const size_t TAG_POOL_MAX_FREE = 1024;
+
+class TagPool {
+ public:
+  void* allocate(size_t size) {
+    size_t size_class = get_size_class(size);
+    if (size_class < TAG_POOL_NUM_CLASSES) {
+      std::lock_guard<std::mutex> lock(mutexes_[size_class]);
+      auto& free_list = free_lists_[size_class];
+      if (!free_list.empty()) {
+        void* ptr = free_list.back();
+        free_list.pop_back();
+        return ptr;
+      }
+      size = (size_class + 1) * TAG_POOL_GRANULARITY;
+    }
+    return ::operator new(size);
+  }
+
+  void release(void* ptr, size_t size) {
+    size_t size_class = get_size_class(size);
+    if (size_class < TAG_POOL_NUM_CLASSES) {
+      std::lock_guard<std::mutex> lock(mutexes_[size_class]);
+      auto& free_list = free_lists_[size_class];
+      if (free_list.size() < TAG_POOL_MAX_FREE) {
+        free_list.push_back(ptr);
+        return;
+      }
+    }
+    ::operator delete(ptr);
+  }
+
+ private:
+  static size_t get_size_class(size_t size) {
+    return (size - 1) / TAG_POOL_GRANULARITY;
+  }
+
+  std::array<std::mutex, TAG_POOL_NUM_CLASSES> mutexes_;
+  std::array<std::vector<void*>, TAG_POOL_NUM_CLASSES> free_lists_;
+};
+
+// Never destroyed, tags may still be released while the process exits
+TagPool& get_tag_pool() {
+  static TagPool* pool = new TagPool();
+  return *pool;
+}
+
+thread_local std::chrono::system_clock::time_point current_deadline =
+    std::chrono::system_clock::time_point::max();
+
+}  // namespace
+
+void* AsyncResponse::operator new(size_t size) {
+  return get_tag_pool().allocate(size);
+}
+
+void AsyncResponse::operator delete(void* ptr, size_t size) {
+  if (ptr) {
+    get_tag_pool().release(ptr, size);
+  }
+}
+
+GRPCLatencyHistogram::GRPCLatencyHistogram(const std::string& name)
+    : name_(name), count_(0), sum_us_(0) {
+  for (auto& bucket : buckets_) {
+    bucket = 0;
+  }
+}
+
+void GRPCLatencyHistogram::observe(std::chrono::microseconds latency) {
+  uint64_t latency_us = latency.count() > 0 ? latency.count() : 0;
+  uint32_t bucket     = 0;
+  while ((bucket < NUM_BUCKETS - 1) && (latency_us >> bucket)) {
+    bucket++;
+  }
+  buckets_[bucket].fetch_add(1, std::memory_order_relaxed);
+  sum_us_.fetch_add(latency_us, std::memory_order_relaxed);
+  count_.fetch_add(1, std::memory_order_relaxed);
+}
+
+GRPCLatencyHistogram::Snapshot GRPCLatencyHistogram::snapshot() const {
+  Snapshot snapshot;
+  snapshot.count  = count_.load(std::memory_order_relaxed);
+  snapshot.sum_us = sum_us_.load(std::memory_order_relaxed);
+  for (uint32_t i = 0; i < NUM_BUCKETS; i++) {
+    snapshot.buckets[i] = buckets_[i].load(std::memory_order_relaxed);
+  }
+  return snapshot;
+}
+
+GRPCDeadlineScope::GRPCDeadlineScope(
+    std::chrono::system_clock::time_point deadline)
+    : previous_(current_deadline) {
+  current_deadline = std::min(previous_, deadline);
+}
+
+GRPCDeadlineScope::~GRPCDeadlineScope() {
+  current_deadline = previous_;
+}
+
+std::chrono::system_clock::time_point GRPCDeadlineScope::current() {
+  return current_deadline;
+}
+
+GRPCRuntime& GRPCRuntime::get_instance() {
+  // Never destroyed, clients outliving main() may still hold its queues
+  static GRPCRuntime* runtime = new GRPCRuntime();
+  return *runtime;
+}
+
+GRPCRuntime::GRPCRuntime()
+    : num_threads_(DEFAULT_NUM_THREADS), next_queue_(0) {}
+
+GRPCRuntime::~GRPCRuntime() {
+  stop();
+}
+
+void GRPCRuntime::set_num_threads(uint32_t num_threads) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!queues_.empty()) {
+    MLOG(MWARNING) << "gRPC runtime already running with " << queues_.size()
+                   << " threads, ignoring new thread count " << num_threads;
+    return;
+  }
+  num_threads_ = num_threads ? num_threads : 1;
+}
+
+void GRPCRuntime::start() {
+  for (uint32_t i = 0; i < num_threads_; i++) {
+    queues_.emplace_back(new grpc::CompletionQueue());
+  }
+  for (auto& queue : queues_) {
+    threads_.emplace_back(queue_loop, queue.get());
+  }
+  MLOG(MINFO) << "Started gRPC runtime with " << num_threads_ << " threads";
+}
+
+grpc::CompletionQueue& GRPCRuntime::assign_queue() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (queues_.empty()) {
+    start();
+  }
+  return *queues_[next_queue_++ % queues_.size()];
+}
+
+void GRPCRuntime::queue_loop(grpc::CompletionQueue* queue) {
+  void* tag;
+  bool ok = false;
+  while (queue->Next(&tag, &ok)) {
+    AsyncResponse::complete(tag, ok);
+  }
+}
+
+void GRPCRuntime::stop() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  // Queues are kept, clients still hold references to them
+  for (auto& queue : queues_) {
+    queue->Shutdown();
+  }
+  for (auto& thread : threads_) {
+    if (thread.joinable()) {
+      thread.join();
+    }
+  }
+}
+
+GRPCLatencyHistogram& GRPCRuntime::latency_histogram(const std::string& rpc) {
+  std::lock_guard<std::mutex> lock(histograms_mutex_);
+  auto& histogram = histograms_[rpc];
+  if (!histogram) {
+    histogram.reset(new GRPCLatencyHistogram(rpc));
+  }
+  return *histogram;
+}
+
+void GRPCRuntime::observe_latency(
+    GRPCLatencyHistogram& histogram, std::chrono::microseconds latency) {
+  histogram.observe(latency);
+  auto observer = std::atomic_load(&latency_observer_);
+  if (observer) {
+    (*observer)(histogram.name(), latency.count() / 1000.0);
+  }
+}
+
+std::map<std::string, GRPCLatencyHistogram::Snapshot>
+GRPCRuntime::latency_snapshot() {
+  std::map<std::string, GRPCLatencyHistogram::Snapshot> snapshots;
+  std::lock_guard<std::mutex> lock(histograms_mutex_);
+  for (const auto& it : histograms_) {
+    snapshots[it.first] = it.second->snapshot();
+  }
+  return snapshots;
+}
+
+void GRPCRuntime::set_latency_observer(LatencyObserver observer) {
+  std::shared_ptr<const LatencyObserver> ptr;
+  if (observer) {
+    ptr = std::make_shared<const LatencyObserver>(std::move(observer));
+  }
+  std::atomic_store(&latency_observer_, ptr);
+}
+
+}  // namespace magma
@@ -16,10 +16,13 @@
 #include <grpcpp/impl/codegen/completion_queue.h>  // for CompletionQueue
 #include <grpcpp/impl/codegen/status.h>            // for Status
 #include <stdint.h>                                // for uint32_t
+#include <stddef.h>                                // for size_t
+#include <algorithm>                               // for min
 #include <atomic>                                  // for atomic
 #include <chrono>                                  // for operator+, seconds
 #include <functional>                              // for function
 #include <memory>                                  // for unique_ptr
+#include "includes/GRPCRuntime.h"                  // for GRPCRuntime
 namespace grpc {
 template<class R>
 class ClientAsyncResponseReader;
@@ -30,12 +33,20 @@ namespace magma {
 /**
  * GRPCReceiver is the base class for receiving responses asynchronously from
  * the cloud. It uses a completion queue to wait for new responses, and call
- * the virtual handle_response callback on them
+ * the virtual handle_response callback on them.
+ * By default the receiver owns its queue and rpc_response_loop has to be run
+ * from a thread of the caller. Receivers built on a GRPCRuntime share one of
+ * the runtime queues instead and need no thread of their own.
  */
 class GRPCReceiver {
  public:
+  GRPCReceiver();
+  explicit GRPCReceiver(GRPCRuntime& runtime);
+  virtual ~GRPCReceiver() = default;
+
   /**
-   * Begin the receiver loop, blocks
+   * Begin the receiver loop, blocks. Returns immediately for receivers on a
+   * shared queue.
    */
   void rpc_response_loop();
 
@@ -44,8 +55,12 @@ class GRPCReceiver {
    */
   void stop();
 
+ private:
+  // Declared before queue_, which may refer to it
+  std::unique_ptr<grpc::CompletionQueue> own_queue_;
+
  protected:
-  grpc::CompletionQueue queue_;
+  grpc::CompletionQueue& queue_;
 
  private:
   std::atomic<bool> running_;
@@ -62,6 +77,30 @@ class AsyncResponse {
    * Override handle_response to be called when a response comes into the queue
    */
   virtual void handle_response() = 0;
+
+  /**
+   * Called right before handle_response, to account for the RPC latency
+   */
+  virtual void record_latency() {}
+
+  /**
+   * Called instead of handle_response when the tag completes with an error,
+   * e.g. the RPC was cancelled. By default the response is handled as is, so
+   * that it still runs its callback and releases itself.
+   */
+  virtual void handle_failure() { handle_response(); }
+
+  /**
+   * Handle a tag popped from a completion queue
+   */
+  static void complete(void* tag, bool ok);
+
+  /**
+   * Tags are allocated for every RPC, recycle their memory instead of going
+   * through the heap each time
+   */
+  static void* operator new(size_t size);
+  static void operator delete(void* ptr, size_t size);
 };
 
 /**
@@ -76,17 +115,54 @@ class AsyncResponse {
 template<typename ResponseType>
 class AsyncGRPCResponse : public AsyncResponse {
  public:
+  /**
+   * rpc names the method called, as "Service/Method", to account for its
+   * latency. It must outlive the response, typically a string literal.
+   */
   AsyncGRPCResponse(
       std::function<void(grpc::Status, ResponseType)> callback,
-      uint32_t timeout_sec)
-      : callback_(callback) {
-    context_.set_deadline(
-        std::chrono::system_clock::now() + std::chrono::seconds(timeout_sec));
+      uint32_t timeout_sec, const char* rpc)
+      : AsyncGRPCResponse(
+            callback,
+            std::chrono::system_clock::now() +
+                std::chrono::seconds(timeout_sec),
+            rpc) {}
+
+  /**
+   * The deadline is shortened to the one of the enclosing GRPCDeadlineScope,
+   * if any
+   */
+  AsyncGRPCResponse(
+      std::function<void(grpc::Status, ResponseType)> callback,
+      std::chrono::system_clock::time_point deadline, const char* rpc)
+      : callback_(callback),
+        rpc_(rpc),
+        start_(std::chrono::steady_clock::now()) {
+    context_.set_deadline(std::min(deadline, GRPCDeadlineScope::current()));
   }
   virtual ~AsyncGRPCResponse() = default;
 
   virtual void handle_response() {}
 
+  /**
+   * Latencies are accounted by RPC method
+   */
+  void record_latency() override {
+    GRPCRuntime& runtime = GRPCRuntime::get_instance();
+    runtime.observe_latency(
+        runtime.latency_histogram(rpc_),
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start_));
+  }
+
+  /**
+   * The callback gets an error status, the response never arrived
+   */
+  void handle_failure() override {
+    status_ = grpc::Status(grpc::CANCELLED, "RPC completed with an error");
+    handle_response();
+  }
+
   /**
    * Set the response reader which waits for the response back from the gRPC
    * call
@@ -110,6 +186,10 @@ class AsyncGRPCResponse : public AsyncResponse {
   grpc::Status status_;
   std::unique_ptr<grpc::ClientAsyncResponseReader<ResponseType>>
       response_reader_;
+
+ private:
+  const char* rpc_;
+  std::chrono::steady_clock::time_point start_;
 };
 
 /**
@@ -119,7 +199,7 @@ class AsyncGRPCResponse : public AsyncResponse {
  * because it blocks the response queue.
  * Here is an example usage:
  * auto response = new AsyncLocalResponse<YourRPCResponseValue>(
- *   callback, RESPONSE_TIMEOUT);
+ *   callback, RESPONSE_TIMEOUT, "YourService/YourRPCCall");
  * auto response_reader = stub_->AsyncYourRPCCall(
  *   local_response->get_context(), request_val, &completion_queue);
  * local_response->set_response_reader(std::move(response_reader));
@@ -129,8 +209,13 @@ class AsyncLocalResponse : public AsyncGRPCResponse<ResponseType> {
  public:
   AsyncLocalResponse(
       std::function<void(grpc::Status, ResponseType)> callback,
-      uint32_t timeout_sec)
-      : AsyncGRPCResponse<ResponseType>(callback, timeout_sec) {}
+      uint32_t timeout_sec, const char* rpc)
+      : AsyncGRPCResponse<ResponseType>(callback, timeout_sec, rpc) {}
+
+  AsyncLocalResponse(
+      std::function<void(grpc::Status, ResponseType)> callback,
+      std::chrono::system_clock::time_point deadline, const char* rpc)
+      : AsyncGRPCResponse<ResponseType>(callback, deadline, rpc) {}
 
   void handle_response() {
     this->callback_(this->status_, this->response_);
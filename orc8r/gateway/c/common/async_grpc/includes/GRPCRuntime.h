@@ -0,0 +1,159 @@
+/**
+ * Copyright 2020 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <grpcpp/impl/codegen/completion_queue.h>  // for CompletionQueue
+#include <stdint.h>                                // for uint32_t, uint64_t
+#include <array>                                   // for array
+#include <atomic>                                  // for atomic
+#include <chrono>                                  // for microseconds
+#include <functional>                              // for function
+#include <map>                                     // for map
+#include <memory>                                  // for unique_ptr
+#include <mutex>                                   // for mutex
+#include <string>                                  // for string
+#include <thread>                                  // for thread
+#include <vector>                                  // for vector
+
+namespace magma {
+
+/**
+ * GRPCLatencyHistogram counts the completion latency of client RPCs in
+ * power of two microsecond buckets. It is updated lock free from the
+ * completion queue threads.
+ */
+class GRPCLatencyHistogram {
+ public:
+  // Bucket i counts latencies below 2^i us, the last one everything above
+  static const uint32_t NUM_BUCKETS = 24;
+
+  struct Snapshot {
+    uint64_t count;
+    uint64_t sum_us;
+    std::array<uint64_t, NUM_BUCKETS> buckets;
+  };
+
+  explicit GRPCLatencyHistogram(const std::string& name);
+
+  const std::string& name() const { return name_; }
+
+  void observe(std::chrono::microseconds latency);
+
+  Snapshot snapshot() const;
+
+ private:
+  const std::string name_;
+  std::atomic<uint64_t> count_;
+  std::atomic<uint64_t> sum_us_;
+  std::array<std::atomic<uint64_t>, NUM_BUCKETS> buckets_;
+};
+
+/**
+ * GRPCDeadlineScope bounds the deadline of every RPC started from the current
+ * thread while it is alive, so that a request handler can hand its own
+ * deadline down to the calls it makes. Scopes nest, the earliest deadline
+ * wins.
+ */
+class GRPCDeadlineScope {
+ public:
+  explicit GRPCDeadlineScope(std::chrono::system_clock::time_point deadline);
+  ~GRPCDeadlineScope();
+
+  GRPCDeadlineScope(const GRPCDeadlineScope&) = delete;
+  GRPCDeadlineScope& operator=(const GRPCDeadlineScope&) = delete;
+
+  /**
+   * @return the deadline of the innermost scope, time_point::max() if none
+   */
+  static std::chrono::system_clock::time_point current();
+
+ private:
+  std::chrono::system_clock::time_point previous_;
+};
+
+/**
+ * GRPCRuntime is a process wide pool of completion queues, each drained by
+ * its own thread, shared by the async clients of a service instead of every
+ * client running a response loop thread of its own. A client is pinned to a
+ * single queue, so its callbacks are still run one at a time, in completion
+ * order. The runtime also keeps the latency histograms of the RPCs made
+ * through GRPCReceiver, whether they use a shared queue or not.
+ */
+class GRPCRuntime {
+ public:
+  using LatencyObserver =
+      std::function<void(const std::string& rpc, double latency_ms)>;
+
+  static GRPCRuntime& get_instance();
+
+  GRPCRuntime(const GRPCRuntime&) = delete;
+  GRPCRuntime& operator=(const GRPCRuntime&) = delete;
+
+  /**
+   * Set the number of completion queue threads. Only effective before the
+   * first client is assigned a queue.
+   */
+  void set_num_threads(uint32_t num_threads);
+
+  /**
+   * Pick the queue of a new client, round robin, starting the queue threads
+   * on first use
+   */
+  grpc::CompletionQueue& assign_queue();
+
+  /**
+   * Shut the queues down and join their threads. Outstanding calls are
+   * dropped.
+   */
+  void stop();
+
+  /**
+   * @return the histogram of rpc, created on first use. The reference stays
+   * valid for the lifetime of the process.
+   */
+  GRPCLatencyHistogram& latency_histogram(const std::string& rpc);
+
+  void observe_latency(
+      GRPCLatencyHistogram& histogram, std::chrono::microseconds latency);
+
+  /**
+   * @return a copy of every latency histogram, by RPC
+   */
+  std::map<std::string, GRPCLatencyHistogram::Snapshot> latency_snapshot();
+
+  /**
+   * Register a callback run on the queue thread after every completed RPC,
+   * typically to export the latency as a service303 metric
+   */
+  void set_latency_observer(LatencyObserver observer);
+
+ private:
+  static const uint32_t DEFAULT_NUM_THREADS = 2;
+
+  GRPCRuntime();
+  ~GRPCRuntime();
+
+  void start();
+  static void queue_loop(grpc::CompletionQueue* queue);
+
+  std::mutex mutex_;
+  uint32_t num_threads_;
+  uint32_t next_queue_;
+  std::vector<std::unique_ptr<grpc::CompletionQueue>> queues_;
+  std::vector<std::thread> threads_;
+  std::mutex histograms_mutex_;
+  std::map<std::string, std::unique_ptr<GRPCLatencyHistogram>> histograms_;
+  std::shared_ptr<const LatencyObserver> latency_observer_;
+};
+
+}  // namespace magma
@@ -0,0 +1,181 @@
+/**
+ * Copyright 2020 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <google/protobuf/empty.pb.h>
+#include <grpcpp/alarm.h>
+#include <grpcpp/impl/codegen/async_unary_call.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <future>
+#include <thread>
+
+#include "includes/GRPCReceiver.h"
+#include "includes/GRPCRuntime.h"
+
+using google::protobuf::Empty;
+
+namespace magma {
+
+namespace {
+
+// Completes on the queue it is armed on, like the reader of a finished RPC
+class AlarmResponse : public AsyncResponse {
+ public:
+  AlarmResponse(
+      grpc::CompletionQueue* queue, std::promise<std::thread::id>* done)
+      : done_(done) {
+    alarm_.Set(queue, std::chrono::system_clock::now(), this);
+  }
+
+  void handle_response() override {
+    done_->set_value(std::this_thread::get_id());
+    delete this;
+  }
+
+ private:
+  grpc::Alarm alarm_;
+  std::promise<std::thread::id>* done_;
+};
+
+class TestClient : public GRPCReceiver {
+ public:
+  TestClient() : GRPCReceiver() {}
+  explicit TestClient(GRPCRuntime& runtime) : GRPCReceiver(runtime) {}
+
+  std::thread::id complete_one() {
+    std::promise<std::thread::id> done;
+    new AlarmResponse(&queue_, &done);
+    return done.get_future().get();
+  }
+};
+
+}  // namespace
+
+TEST(GRPCRuntimeTest, test_shared_queue) {
+  GRPCRuntime::get_instance().set_num_threads(2);
+  TestClient client1(GRPCRuntime::get_instance());
+  TestClient client2(GRPCRuntime::get_instance());
+
+  // No thread of its own to run
+  client1.rpc_response_loop();
+
+  std::thread::id thread1 = client1.complete_one();
+  std::thread::id thread2 = client2.complete_one();
+  EXPECT_NE(thread1, std::this_thread::get_id());
+  EXPECT_NE(thread2, std::this_thread::get_id());
+  // Clients are spread over the queues and stay on theirs
+  EXPECT_NE(thread1, thread2);
+  EXPECT_EQ(client1.complete_one(), thread1);
+}
+
+TEST(GRPCRuntimeTest, test_own_queue) {
+  TestClient client;
+  std::thread loop([&]() { client.rpc_response_loop(); });
+  EXPECT_EQ(client.complete_one(), loop.get_id());
+  client.stop();
+  loop.join();
+}
+
+TEST(GRPCRuntimeTest, test_tag_reuse) {
+  auto response = new AsyncLocalResponse<Empty>(
+      [](grpc::Status, Empty) {}, 10, "test.Service/Rpc");
+  void* ptr = response;
+  delete response;
+  response = new AsyncLocalResponse<Empty>(
+      [](grpc::Status, Empty) {}, 10, "test.Service/Rpc");
+  EXPECT_EQ(ptr, (void*) response);
+  delete response;
+}
+
+TEST(GRPCRuntimeTest, test_failed_tag) {
+  // A tag completing with an error still runs the callback, which releases
+  // whatever the caller holds for the RPC
+  grpc::StatusCode code = grpc::OK;
+  auto response         = new AsyncLocalResponse<Empty>(
+      [&](grpc::Status status, Empty) { code = status.error_code(); }, 10,
+      "test.Service/Rpc");
+  AsyncResponse::complete(response, false);
+  EXPECT_EQ(code, grpc::CANCELLED);
+}
+
+TEST(GRPCRuntimeTest, test_deadline_scope) {
+  auto now = std::chrono::system_clock::now();
+  EXPECT_EQ(
+      GRPCDeadlineScope::current(),
+      std::chrono::system_clock::time_point::max());
+  {
+    GRPCDeadlineScope outer(now + std::chrono::seconds(2));
+    {
+      // The enclosing deadline is earlier, it is kept
+      GRPCDeadlineScope inner(now + std::chrono::seconds(5));
+      EXPECT_EQ(GRPCDeadlineScope::current(), now + std::chrono::seconds(2));
+    }
+    AsyncLocalResponse<Empty> response(
+        [](grpc::Status, Empty) {}, 60, "test.Service/Rpc");
+    EXPECT_EQ(
+        response.get_context()->deadline(), now + std::chrono::seconds(2));
+  }
+  AsyncLocalResponse<Empty> response(
+      [](grpc::Status, Empty) {}, 60, "test.Service/Rpc");
+  EXPECT_GT(response.get_context()->deadline(), now + std::chrono::seconds(2));
+}
+
+TEST(GRPCRuntimeTest, test_latency_histogram) {
+  auto& runtime   = GRPCRuntime::get_instance();
+  auto& histogram = runtime.latency_histogram("test.Rpc");
+  EXPECT_EQ(&histogram, &runtime.latency_histogram("test.Rpc"));
+
+  std::string observed_rpc;
+  double observed_ms = 0;
+  runtime.set_latency_observer([&](const std::string& rpc, double ms) {
+    observed_rpc = rpc;
+    observed_ms  = ms;
+  });
+  runtime.observe_latency(histogram, std::chrono::microseconds(0));
+  runtime.observe_latency(histogram, std::chrono::microseconds(3));
+  runtime.observe_latency(histogram, std::chrono::microseconds(1500));
+  runtime.set_latency_observer(nullptr);
+  EXPECT_EQ(observed_rpc, "test.Rpc");
+  EXPECT_DOUBLE_EQ(observed_ms, 1.5);
+
+  auto snapshot = runtime.latency_snapshot()["test.Rpc"];
+  EXPECT_EQ(snapshot.count, 3u);
+  EXPECT_EQ(snapshot.sum_us, 1503u);
+  EXPECT_EQ(snapshot.buckets[0], 1u);   // < 1us
+  EXPECT_EQ(snapshot.buckets[2], 1u);   // < 4us
+  EXPECT_EQ(snapshot.buckets[11], 1u);  // < 2048us
+}
+
+TEST(GRPCRuntimeTest, test_latency_by_rpc) {
+  auto& runtime     = GRPCRuntime::get_instance();
+  int num_callbacks = 0;
+  auto callback     = [&](grpc::Status, Empty) { num_callbacks++; };
+
+  // Methods answering the same message type are accounted apart
+  AsyncResponse::complete(
+      new AsyncLocalResponse<Empty>(callback, 10, "test.Service/First"), true);
+  AsyncResponse::complete(
+      new AsyncLocalResponse<Empty>(callback, 10, "test.Service/Second"),
+      true);
+  AsyncResponse::complete(
+      new AsyncLocalResponse<Empty>(callback, 10, "test.Service/Second"),
+      true);
+  EXPECT_EQ(num_callbacks, 3);
+
+  auto snapshots = runtime.latency_snapshot();
+  EXPECT_EQ(snapshots["test.Service/First"].count, 1u);
+  EXPECT_EQ(snapshots["test.Service/Second"].count, 2u);
+  EXPECT_EQ(snapshots.count(Empty::descriptor()->full_name()), 0u);
+}
+
+}  // namespace magma
@@ -0,0 +1,127 @@
+/**
+ * Copyright 2020 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "includes/EventJsonWriter.h"
+#include <stdio.h>  // for snprintf
+
+namespace magma {
+
+EventJsonWriter::EventJsonWriter() : json_("{"), closers_("}") {
+  has_element_.push_back(false);
+}
+
+EventJsonWriter& EventJsonWriter::add(
+    const std::string& key, const std::string& value) {
+  add_key(key);
+  add_string(value);
+  return *this;
+}
+
+EventJsonWriter& EventJsonWriter::add(
+    const std::string& key, const char* value) {
+  add_key(key);
+  add_string(value ? value : "");
+  return *this;
+}
+
+EventJsonWriter& EventJsonWriter::begin_array(const std::string& key) {
+  add_key(key);
+  json_ += '[';
+  closers_ += ']';
+  has_element_.push_back(false);
+  return *this;
+}
+
+EventJsonWriter& EventJsonWriter::begin_object() {
+  add_separator();
+  json_ += '{';
+  closers_ += '}';
+  has_element_.push_back(false);
+  return *this;
+}
+
+EventJsonWriter& EventJsonWriter::end_array() {
+  return end_object();
+}
+
+EventJsonWriter& EventJsonWriter::end_object() {
+  // The root object is only closed by str()
+  if (closers_.size() > 1) {
+    json_ += closers_.back();
+    closers_.pop_back();
+    has_element_.pop_back();
+  }
+  return *this;
+}
+
+std::string EventJsonWriter::str() {
+  while (!closers_.empty()) {
+    json_ += closers_.back();
+    closers_.pop_back();
+  }
+  has_element_.clear();
+  return std::move(json_);
+}
+
+void EventJsonWriter::add_separator() {
+  if (has_element_.back()) {
+    json_ += ',';
+  }
+  has_element_.back() = true;
+}
+
+void EventJsonWriter::add_key(const std::string& key) {
+  add_separator();
+  add_string(key);
+  json_ += ':';
+}
+
+void EventJsonWriter::add_string(const std::string& value) {
+  json_ += '"';
+  for (char c : value) {
+    switch (c) {
+      case '"':
+        json_ += "\\\"";
+        break;
+      case '\\':
+        json_ += "\\\\";
+        break;
+      case '\b':
+        json_ += "\\b";
+        break;
+      case '\f':
+        json_ += "\\f";
+        break;
+      case '\n':
+        json_ += "\\n";
+        break;
+      case '\r':
+        json_ += "\\r";
+        break;
+      case '\t':
+        json_ += "\\t";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          char escaped[7];
+          snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+          json_ += escaped;
+        } else {
+          json_ += c;
+        }
+    }
+  }
+  json_ += '"';
+}
+
+}  // namespace magma
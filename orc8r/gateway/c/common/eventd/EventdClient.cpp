@@ -26,21 +26,30 @@ class Status;
 namespace magma {
 namespace orc8r {
 class Event;
-}
+class Events;
+}  // namespace orc8r
 }  // namespace magma
 
 namespace magma {
 
 using orc8r::Event;
+using orc8r::Events;
 using orc8r::EventService;
 using orc8r::Void;
 
+void EventdClient::log_events(
+    const Events& request, std::function<void(Status status, Void)> callback) {
+  callback(
+      Status(grpc::UNIMPLEMENTED, "Event batches are not supported"), Void());
+}
+
 AsyncEventdClient& AsyncEventdClient::getInstance() {
   static AsyncEventdClient instance;
   return instance;
 }
 
-AsyncEventdClient::AsyncEventdClient() {
+AsyncEventdClient::AsyncEventdClient()
+    : GRPCReceiver(GRPCRuntime::get_instance()) {
   std::shared_ptr<Channel> channel;
   channel = ServiceRegistrySingleton::Instance()->GetGrpcChannel(
       "eventd", ServiceRegistrySingleton::LOCAL);
@@ -49,10 +58,18 @@ AsyncEventdClient::AsyncEventdClient() {
 
 void AsyncEventdClient::log_event(
     const Event& request, std::function<void(Status status, Void)> callback) {
-  auto local_response =
-      new AsyncLocalResponse<Void>(std::move(callback), RESPONSE_TIMEOUT_SEC);
+  auto local_response = new AsyncLocalResponse<Void>(
+      std::move(callback), RESPONSE_TIMEOUT_SEC, "EventService/LogEvent");
   local_response->set_response_reader(std::move(
       stub_->AsyncLogEvent(local_response->get_context(), request, &queue_)));
 }
 
+void AsyncEventdClient::log_events(
+    const Events& request, std::function<void(Status status, Void)> callback) {
+  auto local_response = new AsyncLocalResponse<Void>(
+      std::move(callback), RESPONSE_TIMEOUT_SEC, "EventService/LogEvents");
+  local_response->set_response_reader(std::move(
+      stub_->AsyncLogEvents(local_response->get_context(), request, &queue_)));
+}
+
 }  // namespace magma
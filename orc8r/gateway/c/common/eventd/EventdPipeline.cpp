@@ -0,0 +1,240 @@
+/**
+ * Copyright 2020 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "includes/EventdPipeline.h"
+#include <grpcpp/impl/codegen/status.h>  // for Status
+#include <utility>                       // for move
+#include "includes/MetricsHelpers.h"     // for increment_counter
+
+using magma::orc8r::Event;
+using magma::orc8r::Events;
+using magma::orc8r::Void;
+
+namespace {
+const char EVENTS_COUNTER[] = "eventd_client_events";
+
+void count_events(const char* outcome, uint64_t count) {
+  if (count) {
+    magma::service303::increment_counter(
+        EVENTS_COUNTER, count, 1, "outcome", outcome);
+  }
+}
+}  // namespace
+
+namespace magma {
+
+/**
+ * Events of an RPC in flight. Copies of the RPC callback share it; when the
+ * last copy goes away without the callback having run, the RPC is accounted
+ * as failed and its slot released.
+ */
+class EventdPipeline::InFlight {
+ public:
+  InFlight(EventdPipeline& pipeline, Batch batch)
+      : pipeline_(pipeline), batch_(std::move(batch)), done_(false) {}
+
+  ~InFlight() {
+    if (!done_) {
+      pipeline_.on_sent(
+          batch_, Status(grpc::ABORTED, "Event RPC lost without a response"));
+    }
+  }
+
+  void complete(const Status& status) {
+    done_ = true;
+    pipeline_.on_sent(batch_, status);
+  }
+
+  const Batch& get_batch() const { return batch_; }
+
+ private:
+  EventdPipeline& pipeline_;
+  Batch batch_;
+  bool done_;
+};
+
+EventdPipeline::EventdPipeline(
+    EventdClient& client, const EventdPipelineConfig& config)
+    : client_(client),
+      config_(config),
+      in_flight_(0),
+      batching_(config.max_batch_size > 1),
+      sample_count_(0),
+      stats_{0, 0, 0, 0, 0} {}
+
+void EventdPipeline::log_event(
+    const Event& request, std::function<void(Status status, Void)> callback) {
+  const std::string coalescing_key = get_coalescing_key(request);
+  Evicted evicted;
+  std::vector<Batch> to_send;
+  const char* outcome = "queued";
+  uint64_t dropped    = 0;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    dropped = stats_.dropped;
+    auto it = coalescable_.find(coalescing_key);
+    if (it != coalescable_.end()) {
+      // Take the place of the older event, it is not sent any more
+      evicted.emplace_back(
+          std::move(it->second->callback),
+          Status(grpc::ABORTED, "Event superseded by a newer one"));
+      it->second->event    = request;
+      it->second->callback = std::move(callback);
+      stats_.coalesced++;
+      outcome = "coalesced";
+    } else if (admit(evicted)) {
+      queue_.push_back(
+          QueuedEvent{request, std::move(callback), coalescing_key});
+      if (!coalescing_key.empty()) {
+        coalescable_[coalescing_key] = &queue_.back();
+      }
+      stats_.queued++;
+    } else {
+      evicted.emplace_back(
+          std::move(callback),
+          Status(grpc::RESOURCE_EXHAUSTED, "Event queue overloaded"));
+      stats_.dropped++;
+      outcome = nullptr;
+    }
+    dropped = stats_.dropped - dropped;
+    pop_front(to_send);
+  }
+  count_events("dropped", dropped);
+  if (outcome) {
+    count_events(outcome, 1);
+  }
+  run_evicted(evicted);
+  send(to_send);
+}
+
+EventdPipeline::Stats EventdPipeline::get_stats() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return stats_;
+}
+
+size_t EventdPipeline::get_queue_size() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return queue_.size();
+}
+
+std::string EventdPipeline::get_coalescing_key(const Event& event) const {
+  if (!config_.coalesced_event_types.count(event.event_type())) {
+    return "";
+  }
+  return event.stream_name() + '\n' + event.event_type() + '\n' + event.tag();
+}
+
+bool EventdPipeline::admit(Evicted& evicted) {
+  if (queue_.size() < config_.max_queued_events) {
+    if ((config_.overload_policy == EventOverloadPolicy::SAMPLE) &&
+        (queue_.size() >= config_.max_queued_events / 2) &&
+        (config_.sample_rate > 1)) {
+      return (sample_count_++ % config_.sample_rate) == 0;
+    }
+    return true;
+  }
+  if ((config_.overload_policy != EventOverloadPolicy::DROP_OLDEST) ||
+      queue_.empty()) {
+    return false;
+  }
+  QueuedEvent& oldest = queue_.front();
+  if (!oldest.coalescing_key.empty()) {
+    coalescable_.erase(oldest.coalescing_key);
+  }
+  evicted.emplace_back(
+      std::move(oldest.callback),
+      Status(grpc::RESOURCE_EXHAUSTED, "Event dropped from overloaded queue"));
+  queue_.pop_front();
+  stats_.dropped++;
+  return true;
+}
+
+void EventdPipeline::pop_front(std::vector<Batch>& to_send) {
+  const uint32_t batch_size = batching_ ? config_.max_batch_size : 1;
+  while ((in_flight_ < config_.max_in_flight) && !queue_.empty()) {
+    Batch batch;
+    while ((batch.size() < batch_size) && !queue_.empty()) {
+      QueuedEvent& event = queue_.front();
+      if (!event.coalescing_key.empty()) {
+        coalescable_.erase(event.coalescing_key);
+      }
+      batch.push_back(std::move(event));
+      queue_.pop_front();
+    }
+    to_send.push_back(std::move(batch));
+    in_flight_++;
+  }
+}
+
+void EventdPipeline::send(std::vector<Batch>& to_send) {
+  for (auto& batch : to_send) {
+    auto in_flight = std::make_shared<InFlight>(*this, std::move(batch));
+    auto callback  = [in_flight](Status status, Void) {
+      in_flight->complete(status);
+    };
+    const Batch& events = in_flight->get_batch();
+    if (events.size() == 1) {
+      client_.log_event(events.front().event, std::move(callback));
+      continue;
+    }
+    Events request;
+    for (const auto& queued : events) {
+      *request.add_events() = queued.event;
+    }
+    client_.log_events(request, std::move(callback));
+  }
+}
+
+void EventdPipeline::on_sent(Batch& batch, const Status& status) {
+  // Older eventd only logs events one by one, requeue the batch for that
+  const bool resend =
+      (status.error_code() == grpc::UNIMPLEMENTED) && (batch.size() > 1);
+  std::vector<Batch> to_send;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    in_flight_--;
+    if (resend) {
+      batching_ = false;
+      for (auto it = batch.rbegin(); it != batch.rend(); ++it) {
+        queue_.push_front(std::move(*it));
+        if (!queue_.front().coalescing_key.empty()) {
+          coalescable_.emplace(queue_.front().coalescing_key, &queue_.front());
+        }
+      }
+    } else if (status.ok()) {
+      stats_.sent += batch.size();
+    } else {
+      stats_.failed += batch.size();
+    }
+    pop_front(to_send);
+  }
+  if (!resend) {
+    for (const auto& queued : batch) {
+      if (queued.callback) {
+        queued.callback(status, Void());
+      }
+    }
+    count_events(status.ok() ? "sent" : "failed", batch.size());
+  }
+  send(to_send);
+}
+
+void EventdPipeline::run_evicted(const Evicted& evicted) {
+  for (const auto& it : evicted) {
+    if (it.first) {
+      it.first(it.second, Void());
+    }
+  }
+}
+
+}  // namespace magma
@@ -0,0 +1,75 @@
+/**
+ * Copyright 2020 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <string>       // for string, to_string
+#include <type_traits>  // for enable_if, is_integral
+#include <vector>       // for vector
+
+namespace magma {
+
+/**
+ * EventJsonWriter serializes the value of an event straight into a JSON
+ * string, without building an intermediate document. The root object is
+ * opened on construction and closed by str().
+ * Example:
+ *   EventJsonWriter writer;
+ *   writer.add("imsi", imsi).add("enb_id", enb_id);
+ *   writer.begin_array("list").begin_object().add("id", 1).end_object();
+ *   writer.end_array();
+ *   event.set_value(writer.str());
+ */
+class EventJsonWriter {
+ public:
+  EventJsonWriter();
+
+  EventJsonWriter& add(const std::string& key, const std::string& value);
+  EventJsonWriter& add(const std::string& key, const char* value);
+
+  template<
+      typename T,
+      typename = typename std::enable_if<std::is_integral<T>::value>::type>
+  EventJsonWriter& add(const std::string& key, T value) {
+    add_key(key);
+    json_ += std::to_string(value);
+    return *this;
+  }
+
+  EventJsonWriter& begin_array(const std::string& key);
+  EventJsonWriter& end_array();
+
+  /**
+   * Open an object element of the current array
+   */
+  EventJsonWriter& begin_object();
+  EventJsonWriter& end_object();
+
+  /**
+   * Close whatever is still open and return the document. The writer can not
+   * be used afterwards.
+   */
+  std::string str();
+
+ private:
+  void add_separator();
+  void add_key(const std::string& key);
+  void add_string(const std::string& value);
+
+  std::string json_;
+  // Closing character of every open object/array, innermost last
+  std::string closers_;
+  // Whether the innermost object/array already has an element
+  std::vector<bool> has_element_;
+};
+
+}  // namespace magma
@@ -23,7 +23,8 @@ class Status;
 namespace magma {
 namespace orc8r {
 class Event;
-}
+class Events;
+}  // namespace orc8r
 }  // namespace magma
 namespace magma {
 namespace orc8r {
@@ -44,11 +45,18 @@ class EventdClient {
   virtual void log_event(
       const orc8r::Event& request,
       std::function<void(Status status, orc8r::Void)> callback) = 0;
+  /**
+   * Log a batch of events in one RPC. Clients without batch support answer
+   * UNIMPLEMENTED, the events are then to be logged one by one.
+   */
+  virtual void log_events(
+      const orc8r::Events& request,
+      std::function<void(Status status, orc8r::Void)> callback);
 };
 
 /**
  * AsyncEventdClient sends asynchronous calls to EventD
- * to log events
+ * to log events. Responses are handled by the shared GRPCRuntime.
  */
 class AsyncEventdClient : public GRPCReceiver, public EventdClient {
  public:
@@ -61,6 +69,10 @@ class AsyncEventdClient : public GRPCReceiver, public EventdClient {
       const orc8r::Event& request,
       std::function<void(Status status, orc8r::Void)> callback);
 
+  void log_events(
+      const orc8r::Events& request,
+      std::function<void(Status status, orc8r::Void)> callback);
+
  private:
   AsyncEventdClient();
   static const uint32_t RESPONSE_TIMEOUT_SEC = 6;
@@ -0,0 +1,124 @@
+/**
+ * Copyright 2020 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <orc8r/protos/common.pb.h>  // for Void
+#include <orc8r/protos/eventd.pb.h>  // for Event
+#include <stddef.h>                  // for size_t
+#include <stdint.h>                  // for uint32_t, uint64_t
+#include <deque>                     // for deque
+#include <functional>                // for function
+#include <memory>                    // for shared_ptr
+#include <mutex>                     // for mutex
+#include <string>                    // for string
+#include <unordered_map>             // for unordered_map
+#include <unordered_set>             // for unordered_set
+#include <vector>                    // for vector
+#include "includes/EventdClient.h"   // for EventdClient
+
+namespace magma {
+
+enum class EventOverloadPolicy {
+  // Make room for new events by dropping the oldest queued ones
+  DROP_OLDEST = 0,
+  // Keep 1 in sample_rate new events once the queue is half full, drop new
+  // events once it is full
+  SAMPLE = 1,
+};
+
+struct EventdPipelineConfig {
+  // Events waiting for an RPC slot beyond which the overload policy applies
+  size_t max_queued_events = 4096;
+  // LogEvent(s) RPCs outstanding at once
+  uint32_t max_in_flight = 16;
+  // Queued events sent together in one LogEvents RPC
+  uint32_t max_batch_size = 64;
+  EventOverloadPolicy overload_policy = EventOverloadPolicy::DROP_OLDEST;
+  uint32_t sample_rate = 10;
+  // Event types of which a queued event is replaced by a newer event with the
+  // same stream and tag
+  std::unordered_set<std::string> coalesced_event_types;
+};
+
+/**
+ * EventdPipeline stands between the event reporters and eventd. Events are
+ * queued in process and sent in batches with a bounded number of RPCs in
+ * flight, so a burst of events (e.g. an attach storm) does not turn into as
+ * many concurrent RPCs. If eventd does not support batches, events are sent
+ * one by one instead. Once the queue is full the overload policy decides
+ * which events are lost; the callback of a dropped or coalesced event gets
+ * an error status. Events are accounted in the eventd_client_events counter,
+ * labeled by outcome.
+ * An RPC slot is released when the client completes the RPC, or when it
+ * drops the RPC callback without running it.
+ * The pipeline is thread safe.
+ */
+class EventdPipeline : public EventdClient {
+ public:
+  struct Stats {
+    uint64_t queued;
+    uint64_t sent;
+    uint64_t failed;
+    uint64_t dropped;
+    uint64_t coalesced;
+  };
+
+  EventdPipeline(EventdClient& client, const EventdPipelineConfig& config);
+
+  void log_event(
+      const orc8r::Event& request,
+      std::function<void(Status status, orc8r::Void)> callback) override;
+
+  Stats get_stats();
+
+  size_t get_queue_size();
+
+ private:
+  using Callback = std::function<void(Status status, orc8r::Void)>;
+
+  struct QueuedEvent {
+    orc8r::Event event;
+    Callback callback;
+    std::string coalescing_key;  // empty if the event type is not coalesced
+  };
+
+  // Events sent in one RPC
+  using Batch = std::vector<QueuedEvent>;
+
+  class InFlight;
+
+  // Callbacks of events evicted from the queue, run outside of the lock
+  using Evicted = std::vector<std::pair<Callback, Status>>;
+
+  std::string get_coalescing_key(const orc8r::Event& event) const;
+  bool admit(Evicted& evicted);
+  void pop_front(std::vector<Batch>& to_send);
+  void send(std::vector<Batch>& to_send);
+  void on_sent(Batch& batch, const Status& status);
+  static void run_evicted(const Evicted& evicted);
+
+  EventdClient& client_;
+  const EventdPipelineConfig config_;
+  std::mutex mutex_;
+  std::deque<QueuedEvent> queue_;
+  // Queued events by coalescing key. Elements of a deque keep their address
+  // when other elements are pushed or popped at either end.
+  std::unordered_map<std::string, QueuedEvent*> coalescable_;
+  uint32_t in_flight_;
+  // Cleared once eventd answers a batch with UNIMPLEMENTED
+  bool batching_;
+  uint64_t sample_count_;
+  Stats stats_;
+};
+
+}  // namespace magma
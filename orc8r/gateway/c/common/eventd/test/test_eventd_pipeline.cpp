@@ -0,0 +1,290 @@
+/**
+ * Copyright 2020 The Magma Authors.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include <deque>
+#include <string>
+#include <vector>
+
+#include "includes/EventJsonWriter.h"
+#include "includes/EventdPipeline.h"
+
+using grpc::Status;
+using magma::orc8r::Event;
+using magma::orc8r::Events;
+using magma::orc8r::Void;
+
+namespace magma {
+
+namespace {
+
+// Holds on to the RPCs until the test completes them. The tags of a batch
+// are recorded joined by commas.
+class PendingEventdClient : public EventdClient {
+ public:
+  void log_event(
+      const Event& request,
+      std::function<void(Status status, Void)> callback) override {
+    sent.push_back(request.tag());
+    callbacks.push_back(callback);
+  }
+
+  void log_events(
+      const Events& request,
+      std::function<void(Status status, Void)> callback) override {
+    if (!batching) {
+      EventdClient::log_events(request, callback);
+      return;
+    }
+    std::string tags;
+    for (const auto& event : request.events()) {
+      tags += (tags.empty() ? "" : ",") + event.tag();
+    }
+    sent.push_back(tags);
+    callbacks.push_back(callback);
+  }
+
+  void complete_one(Status status = Status::OK) {
+    auto callback = callbacks.front();
+    callbacks.pop_front();
+    callback(status, Void());
+  }
+
+  // Loses the RPC, like a client giving up on it without a response
+  void drop_one() { callbacks.pop_front(); }
+
+  bool batching = false;
+  std::vector<std::string> sent;
+  std::deque<std::function<void(Status status, Void)>> callbacks;
+};
+
+Event make_event(const std::string& type, const std::string& tag) {
+  Event event;
+  event.set_stream_name("test");
+  event.set_event_type(type);
+  event.set_tag(tag);
+  return event;
+}
+
+}  // namespace
+
+class EventdPipelineTest : public ::testing::Test {
+ protected:
+  void log(EventdPipeline& pipeline, const std::string& tag) {
+    log(pipeline, "test_event", tag);
+  }
+
+  void log(
+      EventdPipeline& pipeline, const std::string& type,
+      const std::string& tag) {
+    pipeline.log_event(make_event(type, tag), [=](Status status, Void) {
+      if (!status.ok()) {
+        failed_tags.push_back(tag);
+      }
+    });
+  }
+
+  PendingEventdClient client;
+  std::vector<std::string> failed_tags;
+};
+
+TEST_F(EventdPipelineTest, test_in_flight_window) {
+  EventdPipelineConfig config;
+  config.max_in_flight = 2;
+  EventdPipeline pipeline(client, config);
+
+  for (int i = 0; i < 5; i++) {
+    log(pipeline, std::to_string(i));
+  }
+  EXPECT_EQ(client.sent, std::vector<std::string>({"0", "1"}));
+  EXPECT_EQ(pipeline.get_queue_size(), 3u);
+
+  // Every completed RPC makes room for a queued event, in order
+  client.complete_one();
+  EXPECT_EQ(client.sent, std::vector<std::string>({"0", "1", "2"}));
+  client.complete_one(Status(grpc::UNAVAILABLE, ""));
+  while (!client.callbacks.empty()) {
+    client.complete_one();
+  }
+  EXPECT_EQ(client.sent.size(), 5u);
+  EXPECT_EQ(pipeline.get_queue_size(), 0u);
+
+  auto stats = pipeline.get_stats();
+  EXPECT_EQ(stats.queued, 5u);
+  EXPECT_EQ(stats.sent, 4u);
+  EXPECT_EQ(stats.failed, 1u);
+  EXPECT_EQ(stats.dropped, 0u);
+  EXPECT_EQ(failed_tags, std::vector<std::string>({"1"}));
+}
+
+TEST_F(EventdPipelineTest, test_drop_oldest) {
+  EventdPipelineConfig config;
+  config.max_in_flight     = 1;
+  config.max_queued_events = 2;
+  EventdPipeline pipeline(client, config);
+
+  for (int i = 0; i < 5; i++) {
+    log(pipeline, std::to_string(i));
+  }
+  // 0 is in flight, 1 and 2 were pushed out by 3 and 4
+  EXPECT_EQ(failed_tags, std::vector<std::string>({"1", "2"}));
+  while (!client.callbacks.empty()) {
+    client.complete_one();
+  }
+  EXPECT_EQ(client.sent, std::vector<std::string>({"0", "3", "4"}));
+  EXPECT_EQ(pipeline.get_stats().dropped, 2u);
+}
+
+TEST_F(EventdPipelineTest, test_sample) {
+  EventdPipelineConfig config;
+  config.max_in_flight     = 1;
+  config.max_queued_events = 4;
+  config.overload_policy   = EventOverloadPolicy::SAMPLE;
+  config.sample_rate       = 2;
+  EventdPipeline pipeline(client, config);
+
+  for (int i = 0; i < 8; i++) {
+    log(pipeline, std::to_string(i));
+  }
+  // 0 in flight, 1 and 2 fill half of the queue, then 1 in 2 events is kept
+  // until the queue is full
+  EXPECT_EQ(failed_tags, std::vector<std::string>({"4", "6", "7"}));
+  while (!client.callbacks.empty()) {
+    client.complete_one();
+  }
+  EXPECT_EQ(client.sent, std::vector<std::string>({"0", "1", "2", "3", "5"}));
+  EXPECT_EQ(pipeline.get_stats().dropped, 3u);
+}
+
+TEST_F(EventdPipelineTest, test_coalescing) {
+  EventdPipelineConfig config;
+  config.max_in_flight = 1;
+  config.coalesced_event_types.insert("state");
+  EventdPipeline pipeline(client, config);
+
+  log(pipeline, "state", "a");
+  log(pipeline, "state", "a");
+  log(pipeline, "state", "b");
+  log(pipeline, "other", "b");
+  log(pipeline, "state", "a");
+  log(pipeline, "other", "b");
+  // The first "a" was in flight already, the second one is superseded
+  EXPECT_EQ(failed_tags, std::vector<std::string>({"a"}));
+  while (!client.callbacks.empty()) {
+    client.complete_one();
+  }
+  EXPECT_EQ(client.sent, std::vector<std::string>({"a", "a", "b", "b", "b"}));
+  auto stats = pipeline.get_stats();
+  EXPECT_EQ(stats.coalesced, 1u);
+  EXPECT_EQ(stats.sent, 5u);
+}
+
+TEST_F(EventdPipelineTest, test_lost_rpcs) {
+  EventdPipelineConfig config;
+  config.max_in_flight = 2;
+  EventdPipeline pipeline(client, config);
+
+  for (int i = 0; i < 40; i++) {
+    log(pipeline, std::to_string(i));
+  }
+  // RPCs failing or lost by the client give their slot back all the same
+  int completions = 0;
+  while (!client.callbacks.empty()) {
+    if (completions++ % 2) {
+      client.drop_one();
+    } else {
+      client.complete_one(Status(grpc::CANCELLED, ""));
+    }
+  }
+  EXPECT_EQ(client.sent.size(), 40u);
+  EXPECT_EQ(failed_tags.size(), 40u);
+  EXPECT_EQ(pipeline.get_queue_size(), 0u);
+  EXPECT_EQ(pipeline.get_stats().failed, 40u);
+
+  // The pipeline still has its whole window
+  log(pipeline, "a");
+  log(pipeline, "b");
+  EXPECT_EQ(client.callbacks.size(), 2u);
+  client.complete_one();
+  client.complete_one();
+}
+
+TEST_F(EventdPipelineTest, test_batching) {
+  EventdPipelineConfig config;
+  config.max_in_flight  = 1;
+  config.max_batch_size = 3;
+  client.batching       = true;
+  EventdPipeline pipeline(client, config);
+
+  for (int i = 0; i < 7; i++) {
+    log(pipeline, std::to_string(i));
+  }
+  client.complete_one();
+  client.complete_one(Status(grpc::UNAVAILABLE, ""));
+  client.complete_one();
+  EXPECT_EQ(
+      client.sent, std::vector<std::string>({"0", "1,2,3", "4,5,6"}));
+  // A failed batch fails all of its events
+  EXPECT_EQ(failed_tags, std::vector<std::string>({"1", "2", "3"}));
+  auto stats = pipeline.get_stats();
+  EXPECT_EQ(stats.sent, 4u);
+  EXPECT_EQ(stats.failed, 3u);
+}
+
+TEST_F(EventdPipelineTest, test_unbatched_fallback) {
+  EventdPipelineConfig config;
+  config.max_in_flight  = 1;
+  config.max_batch_size = 3;
+  client.batching       = true;
+  EventdPipeline pipeline(client, config);
+
+  for (int i = 0; i < 5; i++) {
+    log(pipeline, std::to_string(i));
+  }
+  client.complete_one();
+  // eventd does not know LogEvents, the batch is sent again event by event
+  client.complete_one(Status(grpc::UNIMPLEMENTED, ""));
+  while (!client.callbacks.empty()) {
+    client.complete_one();
+  }
+  EXPECT_EQ(
+      client.sent,
+      std::vector<std::string>({"0", "1,2,3", "1", "2", "3", "4"}));
+  EXPECT_TRUE(failed_tags.empty());
+  EXPECT_EQ(pipeline.get_stats().sent, 5u);
+}
+
+TEST(EventJsonWriterTest, test_json) {
+  EventJsonWriter writer;
+  writer.add("imsi", std::string("IMSI001010000000001"))
+      .add("enb_id", 138777000u)
+      .add("delta", -5)
+      .add("name", "quote\" back\\ tab\t ctl\x01");
+  writer.begin_array("list");
+  writer.begin_object().add("id", 1).end_object();
+  writer.begin_object().end_object();
+  writer.end_array();
+  writer.begin_array("empty").end_array();
+  EXPECT_EQ(
+      writer.str(),
+      "{\"imsi\":\"IMSI001010000000001\",\"enb_id\":138777000,\"delta\":-5,"
+      "\"name\":\"quote\\\" back\\\\ tab\\t ctl\\u0001\","
+      "\"list\":[{\"id\":1},{}],\"empty\":[]}");
+
+  // Whatever is left open is closed
+  EventJsonWriter unterminated;
+  unterminated.begin_array("list").begin_object();
+  EXPECT_EQ(unterminated.str(), "{\"list\":[{}]}");
+}
+
+}  // namespace magma
@@ -15,7 +15,7 @@ import json
 import logging
 import socket
 from contextlib import closing
-from typing import Any, Dict
+from typing import Any, Dict, List
 
 import grpc
 import jsonschema
@@ -51,7 +51,7 @@ class EventDRpcServicer(eventd_pb2_grpc.EventServiceServicer):
         logging.debug("Logging event: %s", request)
 
         try:
-            self._validator.validate_event(request.value, request.event_type)
+            value = self._get_value(request)
         except (KeyError, jsonschema.ValidationError) as e:
             logging.error("KeyError for log: %s. Error: %s", request, e)
             context.set_code(grpc.StatusCode.INVALID_ARGUMENT)
@@ -60,13 +60,50 @@ class EventDRpcServicer(eventd_pb2_grpc.EventServiceServicer):
             )
             return
 
-        value = {
-            'stream_name': request.stream_name,
-            'event_type': request.event_type,
-            'event_tag': request.tag,
-            'value': request.value,
-            'retry_on_failure': self._needs_retries(request.event_type),
+        if self._send_to_fluent_bit([value], context):
+            logging.debug("Successfully logged event: %s", request)
+
+    @return_void
+    def LogEvents(self, request: eventd_pb2.Events, context):
+        """
+        Logs a batch of events over a single connection to FluentBit.
+        """
+        logging.debug("Logging %d events", len(request.events))
+
+        values = []
+        invalid = 0
+        for event in request.events:
+            try:
+                values.append(self._get_value(event))
+            except (KeyError, jsonschema.ValidationError) as e:
+                logging.error("KeyError for log: %s. Error: %s", event, e)
+                invalid += 1
+
+        if values and not self._send_to_fluent_bit(values, context):
+            return
+        if invalid:
+            context.set_code(grpc.StatusCode.INVALID_ARGUMENT)
+            context.set_details(
+                'Event validation failed for {} of {} events'.format(
+                    invalid, len(request.events),
+                ),
+            )
+            return
+        logging.debug("Successfully logged %d events", len(values))
+
+    def _get_value(self, event: eventd_pb2.Event) -> Dict[str, Any]:
+        self._validator.validate_event(event.value, event.event_type)
+        return {
+            'stream_name': event.stream_name,
+            'event_type': event.event_type,
+            'event_tag': event.tag,
+            'value': event.value,
+            'retry_on_failure': self._needs_retries(event.event_type),
         }
+
+    def _send_to_fluent_bit(
+        self, values: List[Dict[str, Any]], context,
+    ) -> bool:
         try:
             with closing(
                 socket.create_connection(
@@ -74,8 +111,11 @@ class EventDRpcServicer(eventd_pb2_grpc.EventServiceServicer):
                 timeout=self._tcp_timeout,
                 ),
             ) as sock:
-                logging.debug('Sending log to FluentBit')
-                sock.sendall(json.dumps(value).encode('utf-8'))
+                logging.debug('Sending %d logs to FluentBit', len(values))
+                sock.sendall(
+                    '\n'.join(json.dumps(value) for value in values)
+                    .encode('utf-8'),
+                )
         except socket.error as e:
             logging.error('Connection to FluentBit failed: %s', e)
             logging.info(
@@ -87,9 +127,8 @@ class EventDRpcServicer(eventd_pb2_grpc.EventServiceServicer):
                 'Could not connect to FluentBit locally, Details: {}'
                 .format(e),
             )
-            return
-
-        logging.debug("Successfully logged event: %s", request)
+            return False
+        return True
 
     def _needs_retries(self, event_type: str) -> str:
         if event_type not in self._event_registry: